@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file    frame_source_file.c
+ * @author  PeleAB
+ * @brief   Raw RGB888 file replay source for the Linux host build
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "frame_source.h"
+#include "app_config.h"
+#include <stdio.h>
+
+typedef struct {
+    FILE *file;                 /**< Replay file */
+    const char *path;           /**< Replay file path */
+    bool loop;                  /**< Rewind at end of file */
+    uint32_t frames_read;       /**< Frames delivered so far */
+} file_source_state_t;
+
+static file_source_state_t s_file_state;
+
+static int file_source_start(frame_source_t *src)
+{
+    file_source_state_t *state = (file_source_state_t *)src->priv;
+
+    if (state->file == NULL) {
+        state->file = fopen(state->path, "rb");
+    }
+    return (state->file != NULL) ? 0 : -1;
+}
+
+static int file_source_acquire(frame_source_t *src, uint8_t *dest, uint32_t dest_size)
+{
+    file_source_state_t *state = (file_source_state_t *)src->priv;
+    const size_t frame_size = NN_WIDTH * NN_HEIGHT * NN_BPP;
+
+    if (state->file == NULL || dest_size < frame_size) {
+        return -1;
+    }
+
+    size_t n = fread(dest, 1, frame_size, state->file);
+    if (n < frame_size && state->loop && state->frames_read > 0) {
+        rewind(state->file);
+        n = fread(dest, 1, frame_size, state->file);
+    }
+    if (n < frame_size) {
+        /* A trailing partial frame is treated as end of stream */
+        return 1;
+    }
+
+    state->frames_read++;
+    return 0;
+}
+
+static void file_source_stop(frame_source_t *src)
+{
+    file_source_state_t *state = (file_source_state_t *)src->priv;
+
+    if (state->file != NULL) {
+        fclose(state->file);
+        state->file = NULL;
+    }
+}
+
+int frame_source_file_init(frame_source_t *src, const char *path, bool loop)
+{
+    if (src == NULL || path == NULL) {
+        return -1;
+    }
+
+    s_file_state.file = NULL;
+    s_file_state.path = path;
+    s_file_state.loop = loop;
+    s_file_state.frames_read = 0;
+
+    src->name = "file";
+    src->start = file_source_start;
+    src->acquire = file_source_acquire;
+    src->stop = file_source_stop;
+    src->priv = &s_file_state;
+    src->frame_timestamp = 0;
+    src->frames_dropped = 0;
+    return 0;
+}
@@ -0,0 +1,140 @@
+/**
+ ******************************************************************************
+ * @file    host_main.c
+ * @author  PeleAB
+ * @brief   Linux runner for the frame pipeline with stubbed networks
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "app_frame_processing.h"
+#include "perf_monitor.h"
+#include "target_embedding.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t nn_rgb[NN_WIDTH * NN_HEIGHT * NN_BPP];
+static uint8_t fr_rgb[FACE_RECOGNITION_WIDTH * FACE_RECOGNITION_HEIGHT * NN_BPP];
+
+static frame_processing_context_t g_frame_ctx;
+static frame_source_t g_source;
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s <frames.rgb> [-n frames] [-d detect_every] [-l] [-x]\n"
+            "  frames.rgb  back-to-back %dx%d RGB888 frames\n"
+            "  -n N        stop after N frames (default: end of file)\n"
+            "  -d N        run preprocessing/detection every N frames\n"
+            "  -l          loop the input file\n"
+            "  -x          end frames without faces after detection\n",
+            prog, NN_WIDTH, NN_HEIGHT);
+}
+
+static void print_frame(const frame_processing_context_t *ctx, uint32_t frame,
+                        const pipeline_timing_t *timing)
+{
+    const pd_pp_box_t *boxes = (const pd_pp_box_t *)ctx->face_detection.pp_output.pOutData;
+
+    printf("frame %u: %u ms, %u faces\n", frame, timing->total_time, ctx->face_count);
+    for (uint32_t i = 0; i < ctx->face_count; i++) {
+        printf("  face %u: conf=%.2f center=(%.3f,%.3f) size=%.3fx%.3f sim=%.3f\n", i,
+               boxes[i].prob, boxes[i].x_center, boxes[i].y_center,
+               boxes[i].width, boxes[i].height, ctx->face_similarity[i]);
+    }
+}
+
+static void print_statistics(const frame_processing_context_t *ctx)
+{
+    frame_processing_stats_t stats;
+    frame_processing_get_statistics(ctx, &stats);
+
+    printf("\n%-16s %8s %8s %10s %8s\n", "stage", "runs", "skips", "total_ms", "max_ms");
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++) {
+        printf("%-16s %8u %8u %10u %8u\n", ctx->stages[i].name, stats.stage_runs[i],
+               stats.stage_skips[i], stats.stage_total_time[i], stats.stage_max_time[i]);
+    }
+    printf("frames=%u early_exits=%u errors=%u avg_fps=%.1f\n", stats.frames_processed,
+           stats.early_exits, stats.errors, stats.average_fps);
+    printf("latency avg=%.1f max=%u ms steady_fps=%.1f dropped=%u\n",
+           (stats.frames_processed > 0) ? (float)stats.latency_total / (float)stats.frames_processed : 0.0f,
+           stats.latency_max, stats.steady_fps,
+           (ctx->source != NULL) ? ctx->source->frames_dropped : 0U);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    uint32_t max_frames = 0;
+    uint32_t detect_every = 1;
+    bool loop = false;
+    bool exit_without_faces = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            max_frames = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+            detect_every = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-l") == 0) {
+            loop = true;
+        } else if (strcmp(argv[i], "-x") == 0) {
+            exit_without_faces = true;
+        } else if (argv[i][0] != '-' && path == NULL) {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (path == NULL || (loop && max_frames == 0)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    embeddings_bank_init();
+    perf_monitor_init();
+
+    if (frame_processing_init(&g_frame_ctx, NULL) < 0 ||
+        frame_processing_attach_buffers(&g_frame_ctx, nn_rgb, fr_rgb) < 0) {
+        fprintf(stderr, "pipeline initialization failed\n");
+        return 1;
+    }
+    g_frame_ctx.exit_without_faces = exit_without_faces;
+    frame_processing_set_stage_interval(&g_frame_ctx, PIPELINE_STAGE_PREPROCESSING, detect_every);
+    frame_processing_set_stage_interval(&g_frame_ctx, PIPELINE_STAGE_DETECTION, detect_every);
+
+    if (frame_source_file_init(&g_source, path, loop) < 0 || frame_source_start(&g_source) < 0) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    frame_processing_set_source(&g_frame_ctx, &g_source);
+
+    for (uint32_t frame = 0; max_frames == 0 || frame < max_frames; frame++) {
+        pipeline_timing_t timing;
+        int ret = frame_processing_process_frame(&g_frame_ctx, NULL, NN_WIDTH, NN_HEIGHT, &timing);
+        if (ret == FRAME_PROCESSING_END_OF_STREAM) {
+            break;
+        }
+        if (ret < 0) {
+            fprintf(stderr, "frame %u failed: %d\n", frame, ret);
+            break;
+        }
+        print_frame(&g_frame_ctx, frame, &timing);
+    }
+
+    print_statistics(&g_frame_ctx);
+    printf("\n");
+    perf_monitor_print();
+    frame_processing_cleanup(&g_frame_ctx);
+    return 0;
+}
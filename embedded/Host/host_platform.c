@@ -0,0 +1,40 @@
+/**
+ ******************************************************************************
+ * @file    host_platform.c
+ * @author  PeleAB
+ * @brief   Minimal platform services for the Linux host build
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "host_platform.h"
+#include <time.h>
+
+uint32_t host_get_tick_ms(void)
+{
+    static uint64_t origin_ms;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    uint64_t now_ms = (uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U;
+    if (origin_ms == 0) {
+        origin_ms = now_ms;
+    }
+    return (uint32_t)(now_ms - origin_ms);
+}
+
+uint32_t host_get_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+}
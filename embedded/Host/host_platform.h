@@ -0,0 +1,44 @@
+/**
+ ******************************************************************************
+ * @file    host_platform.h
+ * @author  PeleAB
+ * @brief   Minimal platform services for the Linux host build
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Monotonic millisecond tick (HAL_GetTick equivalent)
+ * @return Milliseconds since the first call
+ */
+uint32_t host_get_tick_ms(void);
+
+/**
+ * @brief Monotonic nanosecond counter (DWT cycle counter stand-in)
+ * @return Nanoseconds, wrapping at 32 bits
+ */
+uint32_t host_get_time_ns(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_PLATFORM_H */
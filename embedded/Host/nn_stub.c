@@ -0,0 +1,171 @@
+/**
+ ******************************************************************************
+ * @file    nn_stub.c
+ * @author  PeleAB
+ * @brief   Stubbed neural networks for the Linux host build
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "nn_stub.h"
+#include <math.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* STUB TENSOR GEOMETRY (matches the face detection model)                  */
+/* ========================================================================= */
+
+#define PD_GRID                 32      /**< Detection heatmap grid size */
+#define PD_STRIDE               4.0f    /**< Input pixels per grid cell */
+#define PD_CELLS                (PD_GRID * PD_GRID)
+
+#define DET_INPUT_SIZE          (NN_WIDTH * NN_HEIGHT * NN_BPP * sizeof(float))
+#define DET_SCALE_COUNT         (PD_CELLS * 2)
+#define DET_LMS_COUNT           (PD_CELLS * AI_PD_MODEL_PP_NB_KEYPOINTS * 2)
+#define DET_HEATMAP_COUNT       (PD_CELLS)
+#define DET_OFFSET_COUNT        (PD_CELLS * 2)
+
+#define REC_INPUT_COUNT         (FACE_RECOGNITION_WIDTH * FACE_RECOGNITION_HEIGHT * NN_BPP)
+
+/* Landmarks relative to the box: left eye, right eye, nose, mouth corners */
+static const float s_landmarks[AI_PD_MODEL_PP_NB_KEYPOINTS][2] = {
+    {0.30f, 0.40f}, {0.70f, 0.40f}, {0.50f, 0.55f}, {0.35f, 0.75f}, {0.65f, 0.75f}
+};
+
+static float s_det_input[DET_INPUT_SIZE / sizeof(float)];
+static float s_det_scale[DET_SCALE_COUNT];
+static float s_det_lms[DET_LMS_COUNT];
+static float s_det_heatmap[DET_HEATMAP_COUNT];
+static float s_det_offset[DET_OFFSET_COUNT];
+
+static float s_rec_input[REC_INPUT_COUNT];
+static float s_rec_output[EMBEDDING_SIZE];
+
+static nn_stub_face_t s_faces[NN_STUB_MAX_FACES] = {
+    {0.5f, 0.5f, 0.4f, 0.9f}
+};
+static uint32_t s_face_count = 1;
+
+/* ========================================================================= */
+/* PRIVATE FUNCTIONS                                                         */
+/* ========================================================================= */
+
+static void stub_write_face(const nn_stub_face_t *face)
+{
+    const float px = face->x_center * NN_WIDTH / PD_STRIDE;
+    const float py = face->y_center * NN_HEIGHT / PD_STRIDE;
+    int gx = (int)px;
+    int gy = (int)py;
+
+    if (gx < 0 || gx >= PD_GRID || gy < 0 || gy >= PD_GRID) {
+        return;
+    }
+
+    const int cell = gy * PD_GRID + gx;
+    const float side = face->size * NN_WIDTH;
+
+    s_det_heatmap[cell] = face->confidence;
+    s_det_scale[cell * 2 + 0] = logf(side / PD_STRIDE);
+    s_det_scale[cell * 2 + 1] = logf(side / PD_STRIDE);
+    s_det_offset[cell * 2 + 0] = py - (float)gy - 0.5f;
+    s_det_offset[cell * 2 + 1] = px - (float)gx - 0.5f;
+
+    for (int k = 0; k < AI_PD_MODEL_PP_NB_KEYPOINTS; k++) {
+        s_det_lms[(cell * AI_PD_MODEL_PP_NB_KEYPOINTS + k) * 2 + 0] = s_landmarks[k][1];
+        s_det_lms[(cell * AI_PD_MODEL_PP_NB_KEYPOINTS + k) * 2 + 1] = s_landmarks[k][0];
+    }
+}
+
+static void stub_run_detection(void)
+{
+    memset(s_det_scale, 0, sizeof(s_det_scale));
+    memset(s_det_lms, 0, sizeof(s_det_lms));
+    memset(s_det_heatmap, 0, sizeof(s_det_heatmap));
+    memset(s_det_offset, 0, sizeof(s_det_offset));
+
+    for (uint32_t i = 0; i < s_face_count; i++) {
+        stub_write_face(&s_faces[i]);
+    }
+}
+
+static void stub_run_recognition(void)
+{
+    const uint32_t span = REC_INPUT_COUNT / EMBEDDING_SIZE;
+
+    for (uint32_t i = 0; i < EMBEDDING_SIZE; i++) {
+        float acc = 0.0f;
+        for (uint32_t j = 0; j < span; j++) {
+            acc += s_rec_input[i * span + j];
+        }
+        s_rec_output[i] = acc / (float)span;
+    }
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int nn_stub_bind_buffers(nn_stub_network_t network, nn_buffers_t *buffers)
+{
+    if (buffers == NULL) {
+        return -1;
+    }
+    memset(buffers, 0, sizeof(*buffers));
+
+    switch (network) {
+    case NN_STUB_FACE_DETECTION:
+        /* Same output order as the generated network: scale, lms, heatmap, offset */
+        buffers->input_buffer = s_det_input;
+        buffers->input_size = sizeof(s_det_input);
+        buffers->output_buffers[0] = s_det_scale;
+        buffers->output_sizes[0] = sizeof(s_det_scale);
+        buffers->output_buffers[1] = s_det_lms;
+        buffers->output_sizes[1] = sizeof(s_det_lms);
+        buffers->output_buffers[2] = s_det_heatmap;
+        buffers->output_sizes[2] = sizeof(s_det_heatmap);
+        buffers->output_buffers[3] = s_det_offset;
+        buffers->output_sizes[3] = sizeof(s_det_offset);
+        buffers->output_count = 4;
+        return 0;
+
+    case NN_STUB_FACE_RECOGNITION:
+        buffers->input_buffer = s_rec_input;
+        buffers->input_size = sizeof(s_rec_input);
+        buffers->output_buffers[0] = s_rec_output;
+        buffers->output_sizes[0] = sizeof(s_rec_output);
+        buffers->output_count = 1;
+        return 0;
+
+    default:
+        return -1;
+    }
+}
+
+void nn_stub_run(nn_stub_network_t network)
+{
+    if (network == NN_STUB_FACE_DETECTION) {
+        stub_run_detection();
+    } else if (network == NN_STUB_FACE_RECOGNITION) {
+        stub_run_recognition();
+    }
+}
+
+void nn_stub_set_faces(const nn_stub_face_t *faces, uint32_t count)
+{
+    if (count > NN_STUB_MAX_FACES) {
+        count = NN_STUB_MAX_FACES;
+    }
+    if (faces != NULL && count > 0) {
+        memcpy(s_faces, faces, count * sizeof(*faces));
+    }
+    s_face_count = (faces != NULL) ? count : 0;
+}
@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * @file    nn_stub.h
+ * @author  PeleAB
+ * @brief   Stubbed neural networks for the Linux host build
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef NN_STUB_H
+#define NN_STUB_H
+
+#include <stdint.h>
+#include "app_neural_network.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* STUB TYPES                                                                */
+/* ========================================================================= */
+
+#define NN_STUB_MAX_FACES   4   /**< Maximum number of synthetic faces */
+
+/**
+ * @brief Stubbed network identifier
+ */
+typedef enum {
+    NN_STUB_FACE_DETECTION = 0,         /**< Face detection network */
+    NN_STUB_FACE_RECOGNITION,           /**< Face recognition network */
+} nn_stub_network_t;
+
+/**
+ * @brief Synthetic face reported by the detection stub (normalized coordinates)
+ */
+typedef struct {
+    float x_center;                     /**< Box center X (0..1) */
+    float y_center;                     /**< Box center Y (0..1) */
+    float size;                         /**< Box side (0..1) */
+    float confidence;                   /**< Heatmap score */
+} nn_stub_face_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Bind the static stub buffers of a network
+ * @param network Network identifier
+ * @param buffers Buffer description to fill
+ * @return 0 on success, negative on error
+ */
+int nn_stub_bind_buffers(nn_stub_network_t network, nn_buffers_t *buffers);
+
+/**
+ * @brief Run one inference of a stubbed network
+ *
+ * Detection writes the configured faces into the raw output tensors so the
+ * real post-processing decodes them. Recognition pools the input tensor
+ * into a deterministic embedding.
+ *
+ * @param network Network identifier
+ */
+void nn_stub_run(nn_stub_network_t network);
+
+/**
+ * @brief Set the faces reported by the detection stub
+ * @param faces Array of faces (may be NULL when count is 0)
+ * @param count Number of faces (clamped to NN_STUB_MAX_FACES)
+ */
+void nn_stub_set_faces(const nn_stub_face_t *faces, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NN_STUB_H */
@@ -18,6 +18,8 @@
 #ifndef APP_CAM
 #define APP_CAM
 
+#include "frame_mailbox.h"
+
 #define CAMERA_FPS 30
 
 void CAM_Init(uint32_t *lcd_bg_width, uint32_t *lcd_bg_height, uint32_t *pitch_nn);
@@ -26,6 +28,9 @@ void CAM_Start(void);
 void CAM_DisplayPipe_Start(uint8_t *display_pipe_dst, uint32_t cam_mode);
 void CAM_DisplayPipe_Stop(void);
 void CAM_NNPipe_Start(uint8_t *nn_pipe_dst, uint32_t cam_mode);
+void CAM_NNPipe_DoubleBufferStart(uint8_t *nn_pipe_dst0, uint8_t *nn_pipe_dst1);
+void CAM_NNPipe_Stop(void);
+frame_mailbox_t *CAM_NNPipe_GetMailbox(void);
 void CAM_IspUpdate(void);
 
 #endif
@@ -44,6 +44,12 @@
 
 #define CAPTURE_FORMAT DCMIPP_PIXEL_PACKER_FORMAT_RGB565_1
 #define CAPTURE_BPP 2
+/* NN pipe capture: 1 = continuous into two buffers (pipeline never waits a
+ * full sensor frame), 0 = one snapshot per processed frame */
+#ifndef CAMERA_NN_CONTINUOUS_CAPTURE
+#define CAMERA_NN_CONTINUOUS_CAPTURE 1
+#endif
+
 /* Leave the driver use the default resolution */
 #define CAMERA_WIDTH 0
 #define CAMERA_HEIGHT 0
@@ -59,6 +65,11 @@
 #define NN_HEIGHT (128)
 #define NN_BPP (3)
 
+/* Relocatable network variants installed at boot (make RELOC_MODELS=1); the
+ * other flash slots can be selected at runtime with nn_model_select() */
+#define NN_DETECTION_MODEL_VARIANT      "centerface-128"
+#define NN_RECOGNITION_MODEL_VARIANT    "mobilefacenet-fast"
+
 #define COLOR_BGR (0)
 #define COLOR_RGB (1)
 #define COLOR_MODE COLOR_RGB
@@ -99,4 +110,10 @@
 #define WELCOME_MSG_1         "STM32N6 Face Recognition"
 #define WELCOME_MSG_2         "AI-Powered Smart Vision System"
 
+/* Overlay display task (LTDC line interrupt): boxes are extrapolated from
+ * their capture time for at most this long, and drawn this far in the past
+ * (0: latest prediction, > 0: interpolate between detections instead) */
+#define DISPLAY_OVERLAY_MAX_EXTRAPOLATION_MS  (150)
+#define DISPLAY_OVERLAY_RENDER_DELAY_MS       (0)
+
 #endif
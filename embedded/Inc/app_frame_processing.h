@@ -25,6 +25,7 @@
 #include "app_config_manager.h"
 #include "app_neural_network.h"
 #include "memory_pool.h"
+#include "frame_source.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,16 +36,110 @@ extern "C" {
 /* ========================================================================= */
 
 /**
- * @brief Frame processing context
+ * @brief Frame processing pipeline stage
+ */
+typedef enum {
+    PIPELINE_STAGE_CAPTURE = 0,              /**< Frame capture stage */
+    PIPELINE_STAGE_PREPROCESSING,            /**< Preprocessing stage */
+    PIPELINE_STAGE_DETECTION,                /**< Face detection stage */
+    PIPELINE_STAGE_TRACKING,                 /**< Object tracking stage */
+    PIPELINE_STAGE_RECOGNITION,              /**< Face recognition stage */
+    PIPELINE_STAGE_POSTPROCESSING,           /**< Post-processing stage */
+    PIPELINE_STAGE_OUTPUT,                   /**< Output stage */
+    PIPELINE_STAGE_COUNT
+} pipeline_stage_t;
+
+/**
+ * @brief Pipeline timing information
  */
 typedef struct {
+    uint32_t stage_times[PIPELINE_STAGE_COUNT]; /**< Individual stage times */
+    uint32_t total_time;                     /**< Total pipeline time */
+    uint32_t timestamp;                      /**< Frame timestamp */
+    uint32_t capture_timestamp;              /**< Sensor capture time (source time, else timestamp) */
+    uint32_t latency;                        /**< Capture to end of the output stage */
+} pipeline_timing_t;
+
+/**
+ * @brief Stage handler return codes (negative values are errors)
+ */
+typedef enum {
+    FRAME_STAGE_CONTINUE = 0,                /**< Proceed with the next stage */
+    FRAME_STAGE_EARLY_EXIT = 1,              /**< End the frame after this stage */
+    FRAME_STAGE_END_OF_STREAM = 2,           /**< Source exhausted, no frame (capture stage only) */
+} frame_stage_result_t;
+
+/** Stage still runs after an earlier stage requested an early exit */
+#define FRAME_STAGE_FLAG_ALWAYS_RUN          (1U << 0)
+
+/** Frames excluded from the steady-state frame rate (sensor and cache warm-up) */
+#define FRAME_PROCESSING_WARMUP_FRAMES       8
+
+/** Return value of frame_processing_process_frame() when the source is exhausted */
+#define FRAME_PROCESSING_END_OF_STREAM       FRAME_STAGE_END_OF_STREAM
+
+typedef struct frame_processing_context frame_processing_context_t;
+
+/**
+ * @brief Stage handler
+ * @param ctx Pointer to frame processing context
+ * @param user User data given at registration
+ * @return frame_stage_result_t value, negative on error
+ */
+typedef int (*frame_stage_fn_t)(frame_processing_context_t *ctx, void *user);
+
+/**
+ * @brief Registered pipeline stage
+ */
+typedef struct {
+    const char *name;                        /**< Stage name for logs */
+    frame_stage_fn_t fn;                     /**< Handler, NULL disables the stage */
+    void *user;                              /**< Handler user data */
+    uint32_t run_every_n;                    /**< Run interval in frames (0 or 1 = every frame) */
+    uint32_t flags;                          /**< FRAME_STAGE_FLAG_* */
+} frame_stage_t;
+
+/**
+ * @brief Frame processing statistics
+ */
+typedef struct {
+    uint32_t frames_processed;               /**< Frames run through the pipeline */
+    uint32_t early_exits;                    /**< Frames ended by an early exit */
+    uint32_t errors;                         /**< Frames aborted by a stage error */
+    uint32_t stage_runs[PIPELINE_STAGE_COUNT];       /**< Executions per stage */
+    uint32_t stage_skips[PIPELINE_STAGE_COUNT];      /**< Skips per stage (interval or exit) */
+    uint32_t stage_total_time[PIPELINE_STAGE_COUNT]; /**< Accumulated time per stage */
+    uint32_t stage_max_time[PIPELINE_STAGE_COUNT];   /**< Worst time per stage */
+    uint32_t total_time;                     /**< Accumulated pipeline time */
+    uint32_t latency_total;                  /**< Accumulated capture-to-result latency */
+    uint32_t latency_max;                    /**< Worst capture-to-result latency */
+    uint32_t steady_start_time;              /**< Start of the first frame after warm-up */
+    float average_fps;                       /**< Average frames per second */
+    float steady_fps;                        /**< Wall-clock frame rate after warm-up */
+} frame_processing_stats_t;
+
+/**
+ * @brief Image used to crop faces for recognition
+ */
+typedef struct {
+    const uint8_t *buffer;                   /**< Image data */
+    uint32_t width;                          /**< Width in pixels */
+    uint32_t height;                         /**< Height in pixels */
+    uint32_t stride;                         /**< Line stride in pixels */
+    uint32_t bpp;                            /**< 2 = RGB565, 3 = RGB888 */
+} frame_crop_source_t;
+
+/**
+ * @brief Frame processing context
+ */
+struct frame_processing_context {
     /* Neural network contexts */
     face_detection_nn_t face_detection;      /**< Face detection network */
     face_recognition_nn_t face_recognition;  /**< Face recognition network */
     
     
     /* Memory management */
-    memory_pool_t memory_pool;               /**< Memory pool manager */
+    memory_pool_t *memory_pool;              /**< Application memory pool */
     
     /* Configuration */
     app_config_t config;                     /**< Application configuration */
@@ -53,6 +148,20 @@ typedef struct {
     uint8_t *input_frame_buffer;             /**< Input frame buffer */
     uint8_t *processing_buffer;              /**< Processing buffer */
     
+    /* Stage graph */
+    frame_stage_t stages[PIPELINE_STAGE_COUNT]; /**< Registered stages, run in enum order */
+    frame_source_t *source;                  /**< Capture source for the capture stage */
+    frame_crop_source_t crop_source;         /**< Image faces are cropped from */
+    uint32_t (*time_source)(void);           /**< Millisecond time base */
+    bool exit_without_faces;                 /**< End the frame when detection finds no face */
+    
+    /* Current frame state */
+    const uint8_t *frame_input;              /**< Caller-provided frame, NULL to use source */
+    uint32_t face_count;                     /**< Faces found by the last detection */
+    float face_similarity[AI_PD_MODEL_PP_MAX_BOXES_LIMIT]; /**< Per-face recognition scores */
+    pipeline_timing_t last_timing;           /**< Timing of the last frame */
+    frame_processing_stats_t stats;          /**< Pipeline statistics */
+    
     /* Performance metrics */
     uint32_t frame_count;                    /**< Total processed frames */
     uint32_t detection_count;                /**< Total detections */
@@ -62,30 +171,7 @@ typedef struct {
     
     /* State management */
     bool is_initialized;                     /**< Initialization status */
-} frame_processing_context_t;
-
-/**
- * @brief Frame processing pipeline stage
- */
-typedef enum {
-    PIPELINE_STAGE_CAPTURE = 0,              /**< Frame capture stage */
-    PIPELINE_STAGE_PREPROCESSING,            /**< Preprocessing stage */
-    PIPELINE_STAGE_DETECTION,                /**< Face detection stage */
-    PIPELINE_STAGE_TRACKING,                 /**< Object tracking stage */
-    PIPELINE_STAGE_RECOGNITION,              /**< Face recognition stage */
-    PIPELINE_STAGE_POSTPROCESSING,           /**< Post-processing stage */
-    PIPELINE_STAGE_OUTPUT,                   /**< Output stage */
-    PIPELINE_STAGE_COUNT
-} pipeline_stage_t;
-
-/**
- * @brief Pipeline timing information
- */
-typedef struct {
-    uint32_t stage_times[PIPELINE_STAGE_COUNT]; /**< Individual stage times */
-    uint32_t total_time;                     /**< Total pipeline time */
-    uint32_t timestamp;                      /**< Frame timestamp */
-} pipeline_timing_t;
+};
 
 /* ========================================================================= */
 /* FUNCTION PROTOTYPES                                                       */
@@ -101,12 +187,17 @@ int frame_processing_init(frame_processing_context_t *ctx, const app_config_t *c
 
 /**
  * @brief Process single frame through complete pipeline
+ *
+ * Runs the registered stages in pipeline order, honouring their run interval
+ * and early exits, and records per-stage times.
+ *
  * @param ctx Pointer to frame processing context
- * @param input_frame Pointer to input frame data
+ * @param input_frame Pointer to RGB888 input frame, or NULL to pull one from the source
  * @param frame_width Frame width in pixels
  * @param frame_height Frame height in pixels
- * @param timing Pointer to store timing information
- * @return 0 on success, negative on error
+ * @param timing Pointer to store timing information (may be NULL)
+ * @return 0 on success, FRAME_PROCESSING_END_OF_STREAM when the source is
+ *         exhausted, negative on error
  */
 int frame_processing_process_frame(frame_processing_context_t *ctx,
                                   const uint8_t *input_frame,
@@ -124,10 +215,11 @@ int frame_processing_init_nn_buffers(frame_processing_context_t *ctx);
 /**
  * @brief Process frame capture stage
  * @param ctx Pointer to frame processing context
- * @param input_frame Pointer to input frame data
+ * @param input_frame Pointer to input frame data, or NULL to pull one from the source
  * @param frame_width Frame width in pixels
  * @param frame_height Frame height in pixels
- * @return 0 on success, negative on error
+ * @return 0 on success, FRAME_PROCESSING_END_OF_STREAM when the source is
+ *         exhausted, negative on error
  */
 int frame_processing_capture_stage(frame_processing_context_t *ctx,
                                   const uint8_t *input_frame,
@@ -144,7 +236,7 @@ int frame_processing_preprocessing_stage(frame_processing_context_t *ctx);
 /**
  * @brief Process face detection stage
  * @param ctx Pointer to frame processing context
- * @param detected_faces Pointer to store detected faces
+ * @param detected_faces Pointer to store detected faces (may be NULL)
  * @param max_faces Maximum number of faces to return
  * @param face_count Pointer to store actual number of faces
  * @return 0 on success, negative on error
@@ -167,8 +259,12 @@ int frame_processing_tracking_stage(frame_processing_context_t *ctx,
 
 /**
  * @brief Process face recognition stage
+ *
+ * Crops and aligns the face from the crop source into the processing buffer,
+ * runs the recognition network and scores it against the target embedding.
+ *
  * @param ctx Pointer to frame processing context
- * @param track_id Track identifier for recognition
+ * @param track_id Index of the face in the last detection results
  * @param similarity Pointer to store similarity score
  * @return 0 on success, negative on error
  */
@@ -213,7 +309,7 @@ int frame_processing_cleanup(frame_processing_context_t *ctx);
 /**
  * @brief Get frame processing statistics
  * @param ctx Pointer to frame processing context
- * @param stats Pointer to store statistics
+ * @param stats Pointer to frame_processing_stats_t to fill
  * @return 0 on success, negative on error
  */
 int frame_processing_get_statistics(const frame_processing_context_t *ctx, void *stats);
@@ -232,6 +328,75 @@ int frame_processing_reset(frame_processing_context_t *ctx);
  */
 bool frame_processing_validate(const frame_processing_context_t *ctx);
 
+/**
+ * @brief Register (or replace) the handler of a pipeline stage
+ * @param ctx Pointer to frame processing context
+ * @param stage Pipeline slot
+ * @param name Stage name for logs
+ * @param fn Stage handler, NULL disables the stage
+ * @param user User data passed to the handler
+ * @param flags FRAME_STAGE_FLAG_* flags
+ * @return 0 on success, negative on error
+ */
+int frame_processing_register_stage(frame_processing_context_t *ctx,
+                                    pipeline_stage_t stage,
+                                    const char *name,
+                                    frame_stage_fn_t fn,
+                                    void *user,
+                                    uint32_t flags);
+
+/**
+ * @brief Run a stage only once every N frames
+ * @param ctx Pointer to frame processing context
+ * @param stage Pipeline slot
+ * @param run_every_n Interval in frames (0 or 1 = every frame)
+ * @return 0 on success, negative on error
+ */
+int frame_processing_set_stage_interval(frame_processing_context_t *ctx,
+                                        pipeline_stage_t stage,
+                                        uint32_t run_every_n);
+
+/**
+ * @brief Attach the frame and processing buffers
+ * @param ctx Pointer to frame processing context
+ * @param input_frame_buffer NN input frame (NN_WIDTH x NN_HEIGHT RGB888)
+ * @param processing_buffer Aligned face buffer (FACE_RECOGNITION_WIDTH x HEIGHT RGB888)
+ * @return 0 on success, negative on error
+ */
+int frame_processing_attach_buffers(frame_processing_context_t *ctx,
+                                    uint8_t *input_frame_buffer,
+                                    uint8_t *processing_buffer);
+
+/**
+ * @brief Set the capture source used by the default capture stage
+ * @param ctx Pointer to frame processing context
+ * @param source Capture source
+ */
+void frame_processing_set_source(frame_processing_context_t *ctx, frame_source_t *source);
+
+/**
+ * @brief Set the image faces are cropped from for recognition
+ * @param ctx Pointer to frame processing context
+ * @param buffer Image data
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param stride Line stride in pixels
+ * @param bpp Bytes per pixel (2 = RGB565, 3 = RGB888)
+ */
+void frame_processing_set_crop_source(frame_processing_context_t *ctx,
+                                      const uint8_t *buffer,
+                                      uint32_t width,
+                                      uint32_t height,
+                                      uint32_t stride,
+                                      uint32_t bpp);
+
+/**
+ * @brief Get a pipeline stage name
+ * @param stage Pipeline slot
+ * @return Stage name
+ */
+const char *frame_processing_stage_name(pipeline_stage_t stage);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,7 @@
 #include "app_constants.h"
 #include "app_config_manager.h"
 #include "app_postprocess.h"
+#include "target_embedding.h"
 #include "memory_pool.h"
 
 /* ========================================================================= */
@@ -49,7 +50,9 @@ typedef struct {
     pd_model_pp_static_param_t pp_params; /**< Post-processing parameters */
     pd_postprocess_out_t pp_output;     /**< Post-processing output */
     uint32_t inference_time_ms;         /**< Last inference time */
+    uint32_t total_inference_time_ms;   /**< Accumulated inference time */
     uint32_t total_inferences;          /**< Total inference count */
+    uint32_t model_generation;          /**< Installed model the buffers belong to */
     bool is_initialized;                /**< Initialization status */
 } face_detection_nn_t;
 
@@ -61,10 +64,44 @@ typedef struct {
     float current_embedding[EMBEDDING_SIZE]; /**< Current face embedding */
     uint32_t inference_time_ms;         /**< Last inference time */
     uint32_t total_inferences;          /**< Total inference count */
+    uint32_t model_generation;          /**< Installed model the buffers belong to */
     bool embedding_valid;               /**< Embedding validity flag */
     bool is_initialized;                /**< Initialization status */
 } face_recognition_nn_t;
 
+/**
+ * @brief Network whose tensors the shared activation pools currently hold
+ *
+ * Both networks are compiled against the same internal pools (cpuRAM2,
+ * npuRAM3-6), so an inference of one overwrites every tensor of the other,
+ * its input and output buffers included. Inferences never run concurrently
+ * and a network's input must be written after the other network last ran.
+ */
+typedef enum {
+    NN_ACTIVATION_OWNER_NONE = 0,       /**< No tensor is valid */
+    NN_ACTIVATION_OWNER_DETECTION,      /**< Face detection tensors */
+    NN_ACTIVATION_OWNER_RECOGNITION,    /**< Face recognition tensors */
+} nn_activation_owner_t;
+
+/**
+ * @brief Network a model slot provides
+ */
+typedef enum {
+    NN_MODEL_DETECTION = 0,             /**< Face detection network */
+    NN_MODEL_RECOGNITION,               /**< Face recognition network */
+    NN_MODEL_ROLE_COUNT,
+} nn_model_role_t;
+
+/**
+ * @brief Flash slot holding one relocatable network variant
+ */
+typedef struct {
+    nn_model_role_t role;               /**< Network the image provides */
+    const char *variant;                /**< Variant name */
+    uint32_t address;                   /**< Image address in memory-mapped flash */
+    uint32_t size;                      /**< Slot size in bytes */
+} nn_model_slot_t;
+
 /* ========================================================================= */
 /* FUNCTION PROTOTYPES                                                       */
 /* ========================================================================= */
@@ -93,8 +130,13 @@ int nn_face_recognition_init(face_recognition_nn_t *nn_ctx,
 
 /**
  * @brief Process frame with face detection network
+ *
+ * Runs inference and post-processing; results are left in pp_output.
+ *
  * @param nn_ctx Pointer to face detection context
- * @param input_frame Pointer to input frame data
+ * @param input_frame Pointer to RGB888 input frame, or NULL if the input
+ *                    tensor was already prepared by the caller after
+ *                    nn_activation_claim(NN_ACTIVATION_OWNER_DETECTION)
  * @param frame_width Frame width in pixels
  * @param frame_height Frame height in pixels
  * @param config Pointer to application configuration
@@ -214,4 +256,49 @@ int nn_face_detection_deinit(face_detection_nn_t *nn_ctx,
 int nn_face_recognition_deinit(face_recognition_nn_t *nn_ctx,
                               memory_pool_t *memory_pool);
 
+/**
+ * @brief Claim the shared activation pools before writing a network input
+ *
+ * Tensors of the previous owner are no longer valid once this succeeds.
+ * @param owner Network about to use the pools
+ * @return 0 on success, -1 while an inference is running
+ */
+int nn_activation_claim(nn_activation_owner_t owner);
+
+/**
+ * @brief Get the network whose tensors the shared activation pools hold
+ * @return Current owner
+ */
+nn_activation_owner_t nn_activation_get_owner(void);
+
+/**
+ * @brief Install another variant of a network from its flash slot
+ *
+ * The image is checked before anything is overwritten. On success the
+ * activation pools hold no valid tensor and the network contexts rebind
+ * their buffers on their next inference. Statically linked networks
+ * (default build) cannot be replaced.
+ *
+ * @param role Network to replace
+ * @param variant Variant name of one of the slots
+ * @return 0 on success, -1 while an inference is running, -2 unknown
+ *         variant, -3 invalid image or install failure, -4 input or output
+ *         tensors not matching the frame pipeline
+ */
+int nn_model_select(nn_model_role_t role, const char *variant);
+
+/**
+ * @brief Get the variant installed for a network
+ * @param role Network
+ * @return Variant name, "static" for a statically linked network
+ */
+const char *nn_model_get_variant(nn_model_role_t role);
+
+/**
+ * @brief Get the flash slot table
+ * @param count Receives the number of slots
+ * @return Slot table
+ */
+const nn_model_slot_t *nn_model_get_slots(uint32_t *count);
+
 #endif /* APP_NEURAL_NETWORK_H */
\ No newline at end of file
@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file    box_motion.h
+ * @author  PeleAB
+ * @brief   Box motion model for rendering detections between inference results
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef BOX_MOTION_H
+#define BOX_MOTION_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* MODEL CONSTANTS                                                           */
+/* ========================================================================= */
+#define BOX_MOTION_MAX_TRACKS           10      /**< Boxes followed at once */
+#define BOX_MOTION_MAX_KEYPOINTS        8       /**< Keypoints carried per box */
+#define BOX_MOTION_DEFAULT_MIN_IOU      0.2f    /**< Overlap that continues a track */
+#define BOX_MOTION_DEFAULT_GAIN         0.5f    /**< Weight of a new velocity measurement */
+#define BOX_MOTION_DEFAULT_MAX_EXTRAP   150     /**< Prediction horizon in ms */
+
+/* ========================================================================= */
+/* MODEL TYPES                                                               */
+/* ========================================================================= */
+
+/**
+ * @brief Keypoint, normalized coordinates
+ */
+typedef struct {
+    float x;
+    float y;
+} box_motion_point_t;
+
+/**
+ * @brief Detection or predicted box, normalized coordinates
+ */
+typedef struct {
+    float x_center;
+    float y_center;
+    float width;
+    float height;
+    float prob;                         /**< Score shown with the box, not interpolated */
+    box_motion_point_t kps[BOX_MOTION_MAX_KEYPOINTS];
+} box_motion_box_t;
+
+/**
+ * @brief Model tuning
+ */
+typedef struct {
+    float min_iou;                      /**< Overlap with a track's prediction to continue it */
+    float velocity_gain;                /**< Weight of a new velocity measurement (0..1] */
+    uint32_t max_extrapolation_ms;      /**< Boxes stop moving this long after their detection */
+} box_motion_config_t;
+
+/**
+ * @brief One followed box
+ */
+typedef struct {
+    box_motion_box_t last;              /**< Latest detection */
+    box_motion_box_t prev;              /**< Detection before it */
+    uint32_t t_last;                    /**< Capture time of last, ms */
+    uint32_t t_prev;                    /**< Capture time of prev, ms */
+    float vx;                           /**< Center velocity, units per ms */
+    float vy;
+    float vw;                           /**< Size velocity, units per ms */
+    float vh;
+    uint32_t hits;                      /**< Detections matched to this track */
+} box_motion_track_t;
+
+/**
+ * @brief Model state
+ */
+typedef struct {
+    box_motion_config_t config;
+    uint32_t nb_keypoints;
+    uint32_t count;                     /**< Valid tracks */
+    box_motion_track_t tracks[BOX_MOTION_MAX_TRACKS];
+} box_motion_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Fill a configuration with the defaults
+ * @param config Configuration
+ */
+void box_motion_default_config(box_motion_config_t *config);
+
+/**
+ * @brief Initialize a model with no tracks
+ * @param motion Model
+ * @param config Tuning, NULL for the defaults
+ * @param nb_keypoints Keypoints per box (<= BOX_MOTION_MAX_KEYPOINTS)
+ * @return 0 on success, negative on error
+ */
+int box_motion_init(box_motion_t *motion, const box_motion_config_t *config, uint32_t nb_keypoints);
+
+/**
+ * @brief Feed the detections of one inference result
+ *
+ * Each detection continues the track whose prediction at t_ms overlaps it
+ * most (greedy, best overlap first) or starts a new one; tracks left without
+ * a detection are dropped.
+ *
+ * @param motion Model
+ * @param boxes Detections
+ * @param count Number of detections (extra ones beyond BOX_MOTION_MAX_TRACKS are ignored)
+ * @param t_ms Capture time of the frame the detections come from
+ * @return 0 on success, negative on error
+ */
+int box_motion_update(box_motion_t *motion, const box_motion_box_t *boxes, uint32_t count, uint32_t t_ms);
+
+/**
+ * @brief Boxes at a given time
+ *
+ * Between the last two detections of a track the box is interpolated; after
+ * the last one it is extrapolated with the track velocity for at most
+ * max_extrapolation_ms. Centers and keypoints are kept inside [0, 1].
+ *
+ * @param motion Model
+ * @param t_ms Time to predict, ms
+ * @param out Receives the boxes
+ * @param max Capacity of out
+ * @return Number of boxes written
+ */
+uint32_t box_motion_predict(const box_motion_t *motion, uint32_t t_ms, box_motion_box_t *out, uint32_t max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOX_MOTION_H */
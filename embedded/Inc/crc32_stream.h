@@ -0,0 +1,95 @@
+/**
+ ******************************************************************************
+ * @file    crc32_stream.h
+ * @author  PeleAB
+ * @brief   Incremental CRC32 of the PC stream packet payloads
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef CRC32_STREAM_H
+#define CRC32_STREAM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* CRC DEFINITION                                                            */
+/* ========================================================================= */
+/*
+ * STM32 CRC unit defaults: polynomial 0x04C11DB7, initial value 0xFFFFFFFF,
+ * no reflection, no final XOR. Whole 32-bit little-endian words of the data
+ * are fed first, then the last 1 to 3 bytes one by one, so the CRC covers
+ * exactly the bytes given. For lengths that are a multiple of 4 this is the
+ * value HAL_CRC_Calculate() returns in word mode.
+ */
+#define CRC32_STREAM_INIT               0xFFFFFFFFU
+
+/**
+ * @brief Running CRC of a byte stream fed in pieces of any size
+ *
+ * On target the CRC unit holds the running value: one stream at a time.
+ */
+typedef struct {
+    uint32_t crc;                       /**< CRC of the whole words fed so far */
+    uint8_t pending[4];                 /**< Bytes of the word being completed */
+    uint32_t pending_size;
+    uint32_t length;                    /**< Bytes fed so far */
+} crc32_stream_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Initialize the CRC engine (CRC unit on target, table on host)
+ * @return 0 on success, negative on error
+ */
+int crc32_stream_init(void);
+
+/**
+ * @brief Start a new CRC
+ * @param stream Stream state
+ */
+void crc32_stream_begin(crc32_stream_t *stream);
+
+/**
+ * @brief Feed the next bytes of the stream
+ * @param stream Stream state
+ * @param data Bytes, any alignment
+ * @param size Number of bytes
+ */
+void crc32_stream_update(crc32_stream_t *stream, const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Finish the CRC
+ * @param stream Stream state
+ * @return CRC of every byte fed since crc32_stream_begin()
+ */
+uint32_t crc32_stream_end(crc32_stream_t *stream);
+
+/**
+ * @brief CRC of a single buffer
+ * @param data Bytes
+ * @param size Number of bytes
+ * @return CRC
+ */
+uint32_t crc32_stream_compute(const uint8_t *data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC32_STREAM_H */
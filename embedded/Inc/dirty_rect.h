@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @file    dirty_rect.h
+ * @author  PeleAB
+ * @brief   Dirty-region tracking for the double-buffered overlay layer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef DIRTY_RECT_H
+#define DIRTY_RECT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* TRACKER CONSTANTS                                                         */
+/* ========================================================================= */
+#define DIRTY_RECT_MAX_REGIONS          32      /**< Regions kept per buffer */
+#define DIRTY_RECT_BUFFER_COUNT         2       /**< Overlay back buffers */
+#define DIRTY_RECT_MERGE_SLACK          1024    /**< Undrawn pixels accepted to save one clear */
+#define DIRTY_RECT_FULL_PERCENT         60      /**< Clear the whole layer above this coverage */
+
+/* ========================================================================= */
+/* TRACKER TYPES                                                             */
+/* ========================================================================= */
+
+/**
+ * @brief Screen region, x1/y1 exclusive
+ */
+typedef struct {
+    uint16_t x0;
+    uint16_t y0;
+    uint16_t x1;
+    uint16_t y1;
+} dirty_rect_t;
+
+/**
+ * @brief Coalesced regions of one buffer
+ */
+typedef struct {
+    dirty_rect_t rects[DIRTY_RECT_MAX_REGIONS];
+    uint32_t count;                     /**< Valid regions */
+    bool full;                          /**< Whole layer, rects ignored */
+} dirty_rect_list_t;
+
+/**
+ * @brief Clearing statistics
+ */
+typedef struct {
+    uint32_t frames;                    /**< Frames started */
+    uint32_t full_clears;               /**< Frames that cleared the whole layer */
+    uint64_t pixels_cleared;            /**< Pixels cleared over all frames */
+    uint64_t pixels_layer;              /**< Pixels a full clear per frame would have written */
+    uint32_t overflows;                 /**< Regions merged because a list was full */
+} dirty_rect_stats_t;
+
+/**
+ * @brief Tracker state
+ *
+ * Each back buffer remembers what was drawn into it, so the next frame
+ * rendered into the same buffer clears only those regions.
+ */
+typedef struct {
+    uint16_t width;                     /**< Layer width */
+    uint16_t height;                    /**< Layer height */
+    uint32_t active;                    /**< Buffer being drawn */
+    dirty_rect_list_t drawn[DIRTY_RECT_BUFFER_COUNT];
+    dirty_rect_stats_t stats;
+} dirty_rect_tracker_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Initialize a tracker; every buffer starts fully dirty
+ * @param tracker Tracker
+ * @param width Layer width in pixels
+ * @param height Layer height in pixels
+ * @return 0 on success, negative on error
+ */
+int dirty_rect_init(dirty_rect_tracker_t *tracker, uint32_t width, uint32_t height);
+
+/**
+ * @brief Start drawing into a buffer
+ *
+ * Returns what the previous frame drew into this buffer and starts an empty
+ * list for the new frame. The caller clears the returned regions first.
+ *
+ * @param tracker Tracker
+ * @param buffer Buffer index (0..DIRTY_RECT_BUFFER_COUNT-1)
+ * @param clear Receives the regions to clear
+ * @return 0 on success, negative on error
+ */
+int dirty_rect_begin_frame(dirty_rect_tracker_t *tracker, uint32_t buffer, dirty_rect_list_t *clear);
+
+/**
+ * @brief Record a region drawn into the active buffer
+ *
+ * The region is clipped to the layer; nothing is recorded if it lies
+ * outside.
+ *
+ * @param tracker Tracker
+ * @param x Left edge (may be negative)
+ * @param y Top edge (may be negative)
+ * @param width Width in pixels
+ * @param height Height in pixels
+ */
+void dirty_rect_mark(dirty_rect_tracker_t *tracker, int32_t x, int32_t y, int32_t width, int32_t height);
+
+/**
+ * @brief Mark every buffer fully dirty (layer drawn outside the tracker)
+ * @param tracker Tracker
+ */
+void dirty_rect_invalidate(dirty_rect_tracker_t *tracker);
+
+/**
+ * @brief Add a region to a list, coalescing it with the regions it overlaps
+ *
+ * Two regions are merged when their bounding box covers at most
+ * DIRTY_RECT_MERGE_SLACK pixels that neither covers. A full list merges the
+ * new region with the one that wastes the fewest pixels.
+ *
+ * @param list Region list
+ * @param rect Region to add (non-empty)
+ * @return true if a region was merged because the list was full
+ */
+bool dirty_rect_list_add(dirty_rect_list_t *list, const dirty_rect_t *rect);
+
+/**
+ * @brief Pixels written when clearing a list
+ * @param list Region list
+ * @param width Layer width, used for full lists
+ * @param height Layer height, used for full lists
+ * @return Pixel count
+ */
+uint32_t dirty_rect_list_area(const dirty_rect_list_t *list, uint32_t width, uint32_t height);
+
+/**
+ * @brief Get the clearing statistics
+ * @param tracker Tracker
+ * @param stats Receives the statistics
+ */
+void dirty_rect_get_stats(const dirty_rect_tracker_t *tracker, dirty_rect_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIRTY_RECT_H */
@@ -17,12 +17,24 @@ typedef struct
 extern Rectangle_TypeDef lcd_bg_area;
 extern Rectangle_TypeDef lcd_fg_area;
 #ifdef ENABLE_LCD_DISPLAY
-extern uint8_t lcd_fg_buffer[2][LCD_FG_WIDTH * LCD_FG_HEIGHT * 2];
+extern uint8_t *lcd_fg_buffer[2];
 #endif
 
 void LCD_init(void);
 void Display_WelcomeScreen(void);
-void Display_NetworkOutput(pd_postprocess_out_t *p_postprocess, uint32_t total_frame_time_ms, uint32_t boottime_ms, const void *ctx);
+/* Publish an inference result; the overlay is redrawn from the LTDC line
+ * interrupt, with boxes moved from their capture time to the refresh time */
+void Display_NetworkOutput(pd_postprocess_out_t *p_postprocess, uint32_t total_frame_time_ms, uint32_t boottime_ms,
+                           uint32_t capture_ms, const void *ctx);
+void Display_PrintOverlayStats(void);
+/* Hand the aligned face (RGB888) to the display task for the overlay
+ * thumbnail; rgb888 must stay unchanged until Display_Sync() */
+void Display_CaptureFace(const uint8_t *rgb888, uint32_t width, uint32_t height);
+/* Wait until the display task is done reading the captured face */
+void Display_Sync(void);
+/* Display task work pended by gfx2d fences and face captures; called from the
+ * LTDC interrupt */
+void Display_Task(void);
 
 
 
@@ -16,6 +16,46 @@ extern "C" {
 #include <stdbool.h>
 #include "app_postprocess.h"
 
+/* ========================================================================= */
+/* TRANSMIT QUEUE                                                            */
+/* ========================================================================= */
+#define PC_STREAM_TX_ARENA_SIZE         (160 * 1024)  /* Queued payloads: two frames and metrics */
+#define PC_STREAM_TX_RESERVE_SIZE       (16 * 1024)   /* Arena frames leave free for other messages */
+#define PC_STREAM_TX_WAIT_US            250000        /* Longest wait of a message for queue room */
+
+/* ========================================================================= */
+/* FRAMING                                                                   */
+/* ========================================================================= */
+#ifndef PC_STREAM_PROTOCOL_VERSION
+#define PC_STREAM_PROTOCOL_VERSION      2             /* 1: 64 KB packets, 2: chunked messages */
+#endif
+#define PC_STREAM_V2_CHUNK_SIZE         (16 * 1024)   /* Queue memory a v2 message holds at once */
+#define PC_STREAM_MAX_FRAME_WIDTH       1024          /* Widest frame row sent */
+
+/* ========================================================================= */
+/* TILE DELTA                                                                */
+/* ========================================================================= */
+#ifndef PC_STREAM_TILE_DELTA
+#define PC_STREAM_TILE_DELTA            1             /* Decimated v2 frames send changed tiles only */
+#endif
+#define PC_STREAM_DELTA_REF_SIZE        (400 * 240 * 2) /* Host copy of the decimated RGB565 frame */
+
+/* ========================================================================= */
+/* FRAME CODING                                                              */
+/* ========================================================================= */
+#ifndef PC_STREAM_FRAME_CODEC
+#define PC_STREAM_FRAME_CODEC           1             /* Whole frames go out coded when they shrink */
+#endif
+#define PC_STREAM_CODEC_BUFFER_SIZE     (4 + 240 * (1 + 400 * 2)) /* frame_codec_bound(400, 240, 2) */
+
+/* ========================================================================= */
+/* RATE CONTROL                                                              */
+/* ========================================================================= */
+#ifndef PC_STREAM_RATE_CONTROL
+#define PC_STREAM_RATE_CONTROL          1             /* Frames and crops sized to link and frame time */
+#endif
+#define PC_STREAM_MAX_STREAM_FRACTION   250           /* Permille of frame time spent in send calls */
+
 /* ========================================================================= */
 /* TYPE DEFINITIONS                                                          */
 /* ========================================================================= */
@@ -44,6 +84,23 @@ typedef struct {
     uint32_t crc_errors;           /* CRC error count */
     uint32_t timeouts;             /* Timeout error count */
     uint32_t last_heartbeat;       /* Last heartbeat timestamp */
+    uint32_t tx_queue_depth;       /* Packets queued or on the wire */
+    uint32_t tx_queue_max_depth;   /* Highest queue depth seen */
+    uint32_t tx_frames_dropped;    /* Frames dropped because the queue was full */
+    uint32_t tx_waits;             /* Messages that waited for queue room */
+    uint32_t tx_errors;            /* Failed transfers and messages refused after waiting */
+    uint32_t delta_keyframes;      /* Tile delta frames sent whole */
+    uint32_t delta_tiles_sent;     /* Tiles sent by tile delta frames */
+    uint32_t delta_tiles_total;    /* Tiles of the tile delta frames */
+    uint32_t codec_frames;         /* Whole frames coded */
+    uint32_t codec_bytes_in;       /* Pixel bytes of the coded frames (wraps) */
+    uint32_t codec_bytes_out;      /* Coded bytes (wraps) */
+    uint32_t codec_cycles_per_pixel; /* Coding cost of the last frame */
+    uint32_t rate_frames_skipped;  /* Frames held back by the rate control or the queue */
+    uint32_t rate_crops_skipped;   /* Face crops held back by the rate control or the queue */
+    uint32_t rate_scale;           /* Decimation of the last frame sent */
+    uint32_t rate_link_bytes_per_s; /* Link throughput estimate */
+    uint32_t rate_stream_fraction; /* Permille of the last frame time spent streaming */
 } protocol_stats_t;
 
 /* ========================================================================= */
@@ -55,8 +112,24 @@ typedef struct {
  */
 void Enhanced_PC_STREAM_Init(void);
 
+/**
+ * @brief Transmit DMA channel interrupt, called from GPDMA1_Channel0_IRQHandler
+ */
+void Enhanced_PC_STREAM_TxDmaIRQHandler(void);
+
+/**
+ * @brief PC UART interrupt, called from USART1_IRQHandler
+ */
+void Enhanced_PC_STREAM_UartIRQHandler(void);
+
 /**
  * @brief Send frame with enhanced protocol including metadata
+ *
+ * Frames are queued for transmission and dropped when the queue is full;
+ * every other message waits for room. With PC_STREAM_RATE_CONTROL, whole
+ * frames are decimated to what the link and the frame time allow and may
+ * be skipped, as may "ALN" crops; detections and metrics are always sent.
+ *
  * @param frame Pointer to frame data
  * @param width Frame width in pixels
  * @param height Frame height in pixels
@@ -64,7 +137,7 @@ void Enhanced_PC_STREAM_Init(void);
  * @param tag Frame type tag ("JPG" or "ALN")
  * @param detections Optional detection results
  * @param performance Optional performance metrics
- * @return true if successful, false otherwise
+ * @return true if the frame was queued, false otherwise
  */
 bool Enhanced_PC_STREAM_SendFrame(const uint8_t *frame, uint32_t width, uint32_t height,
                                  uint32_t bpp, const char *tag,
@@ -94,17 +167,82 @@ bool Enhanced_PC_STREAM_SendDetections(uint32_t frame_id, const pd_postprocess_o
  */
 bool Enhanced_PC_STREAM_SendPerformanceMetrics(const performance_metrics_t *metrics);
 
+/**
+ * @brief Send a timing summary serialized by perf_monitor_serialize()
+ * @param summary Serialized summary
+ * @param size Summary size in bytes
+ * @return true if successful, false otherwise
+ */
+bool Enhanced_PC_STREAM_SendPerfSummary(const uint8_t *summary, uint32_t size);
+
+/**
+ * @brief Send an epoch block table serialized by epoch_profiler_serialize()
+ * @param profile Serialized table
+ * @param size Table size in bytes
+ * @return true if successful, false otherwise
+ */
+bool Enhanced_PC_STREAM_SendEpochProfile(const uint8_t *profile, uint32_t size);
+
+/**
+ * @brief Send a stall report serialized by npu_stall_monitor_serialize()
+ * @param report Serialized report
+ * @param size Report size in bytes
+ * @return true if successful, false otherwise
+ */
+bool Enhanced_PC_STREAM_SendStallReport(const uint8_t *report, uint32_t size);
+
 /**
  * @brief Send periodic heartbeat packet
  */
 void Enhanced_PC_STREAM_SendHeartbeat(void);
 
+/**
+ * @brief Select the framing of every message but the heartbeat
+ * @param version 1 (legacy 64 KB packets) or 2 (chunked messages)
+ * @return 0 on success, -1 if the version is not supported
+ */
+int Enhanced_PC_STREAM_SetProtocolVersion(uint8_t version);
+
+/**
+ * @brief Get the framing in use
+ * @return Protocol version
+ */
+uint8_t Enhanced_PC_STREAM_GetProtocolVersion(void);
+
+/**
+ * @brief Turn the coding of whole frames on or off
+ *
+ * Coding pays when it takes less time than the wire time it saves; see
+ * the benchmark of Tests/test_frame_codec.c.
+ *
+ * @param enable true to send frames coded when they shrink
+ */
+void Enhanced_PC_STREAM_SetFrameCoding(bool enable);
+
+/**
+ * @brief Turn the rate control of frames and crops on or off
+ *
+ * Off, every frame is sent decimated by the fixed stream scale and every
+ * crop at full resolution, dropped only when the queue is full.
+ *
+ * @param enable true to size frames and crops to the link and frame time
+ */
+void Enhanced_PC_STREAM_SetRateControl(bool enable);
+
 /**
  * @brief Get protocol statistics
  * @param stats Pointer to statistics structure to fill
  */
 void Enhanced_PC_STREAM_GetStats(protocol_stats_t *stats);
 
+/**
+ * @brief Receive a raw image pushed by the PC (blocking)
+ * @param dest Destination buffer
+ * @param size Number of bytes to receive
+ * @return 0 on success, negative on error
+ */
+int Enhanced_PC_STREAM_ReceiveImage(uint8_t *dest, uint32_t size);
+
 /**
  * @brief Legacy compatibility function for existing code
  * @param frame Pointer to frame data
@@ -123,6 +261,7 @@ void Enhanced_PC_STREAM_SendFrameEx(const uint8_t *frame, uint32_t width, uint32
 /* Map old function names to new enhanced versions for backward compatibility */
 #define PC_STREAM_Init()                    Enhanced_PC_STREAM_Init()
 #define PC_STREAM_SendFrameEx(f,w,h,b,t)   Enhanced_PC_STREAM_SendFrameEx(f,w,h,b,t)
+#define PC_STREAM_ReceiveImage(d,s)        Enhanced_PC_STREAM_ReceiveImage(d,s)
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,167 @@
+/**
+ ******************************************************************************
+ * @file    epoch_profiler.h
+ * @author  PeleAB
+ * @brief   Per-epoch-block NPU/SW timing for the neural networks
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef EPOCH_PROFILER_H
+#define EPOCH_PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef APP_HOST_BUILD
+#include "ll_aton_runtime.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* PROFILER CONSTANTS                                                        */
+/* ========================================================================= */
+#define EPOCH_PROFILER_MAX_BLOCKS       256     /**< Epoch blocks recorded per network */
+#define EPOCH_PROFILER_WIRE_VERSION     1       /**< Serialized table format version */
+#define EPOCH_PROFILER_WIRE_HEADER_SIZE 12      /**< version, network, blocks, inferences, cycles/us */
+#define EPOCH_PROFILER_WIRE_BLOCK_SIZE  10      /**< first, last, flags, avg cycles */
+
+/** Epoch block flags mirrored from EpochBlock_Flags_t for host-side decoding */
+#define EPOCH_PROFILER_FLAG_BLOB        (1U << 2)
+#define EPOCH_PROFILER_FLAG_PURE_HW     (1U << 4)
+#define EPOCH_PROFILER_FLAG_PURE_SW     (1U << 5)
+#define EPOCH_PROFILER_FLAG_HYBRID      (1U << 6)
+#define EPOCH_PROFILER_FLAG_INTERNAL    (1U << 7)
+
+/* ========================================================================= */
+/* PROFILER TYPES                                                            */
+/* ========================================================================= */
+
+/**
+ * @brief Profiled networks
+ */
+typedef enum {
+    EPOCH_PROFILER_NET_DETECTION = 0,
+    EPOCH_PROFILER_NET_RECOGNITION,
+    EPOCH_PROFILER_NET_COUNT
+} epoch_profiler_net_t;
+
+/**
+ * @brief Timing of one epoch block, accumulated over inferences
+ */
+typedef struct {
+    int16_t epoch_first;                /**< First epoch in the block (-1 if unknown) */
+    int16_t epoch_last;                 /**< Last epoch in the block (EC blobs span many) */
+    uint16_t flags;                     /**< EpochBlock_Flags_t of the block */
+    uint32_t start;                     /**< Cycle count when the block started */
+    uint32_t last_cycles;               /**< Duration in the last inference */
+    uint64_t total_cycles;              /**< Duration summed over inferences */
+} epoch_profile_block_t;
+
+/**
+ * @brief Epoch block table of one network
+ */
+typedef struct {
+    epoch_profile_block_t blocks[EPOCH_PROFILER_MAX_BLOCKS];
+    uint16_t block_count;               /**< Blocks seen per inference */
+    uint16_t current;                   /**< Index of the running block */
+    uint32_t inferences;                /**< Completed inferences */
+    uint32_t overflows;                 /**< Blocks beyond EPOCH_PROFILER_MAX_BLOCKS */
+} epoch_profile_network_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Clear every table
+ */
+void epoch_profiler_reset(void);
+
+/**
+ * @brief Mark the start of an inference (block index back to 0)
+ * @param net Network
+ */
+void epoch_profiler_begin_inference(epoch_profiler_net_t net);
+
+/**
+ * @brief Mark the end of an inference
+ * @param net Network
+ */
+void epoch_profiler_end_inference(epoch_profiler_net_t net);
+
+/**
+ * @brief Record the start of the next epoch block
+ * @param net Network
+ * @param epoch_first First epoch in the block (-1 if unknown)
+ * @param epoch_last Last epoch in the block
+ * @param flags EpochBlock_Flags_t of the block
+ */
+void epoch_profiler_begin_block(epoch_profiler_net_t net, int16_t epoch_first,
+                                int16_t epoch_last, uint16_t flags);
+
+/**
+ * @brief Record the end of the running epoch block
+ * @param net Network
+ */
+void epoch_profiler_end_block(epoch_profiler_net_t net);
+
+/**
+ * @brief Get the table of a network
+ * @param net Network
+ * @return Table, NULL for an invalid network
+ */
+const epoch_profile_network_t *epoch_profiler_get(epoch_profiler_net_t net);
+
+/**
+ * @brief Get the epoch block currently running (safe to call from interrupts)
+ * @param net Receives the network
+ * @param block Receives the block index
+ * @return true if a block is running
+ */
+bool epoch_profiler_get_running(epoch_profiler_net_t *net, uint16_t *block);
+
+/**
+ * @brief Serialize the table of a network (average cycles per block)
+ *
+ * Little-endian layout: u8 version, u8 network, u16 block count,
+ * u32 inferences, u32 cycles per us, then per block i16 first epoch,
+ * i16 last epoch, u16 flags, u32 average cycles.
+ *
+ * @param net Network
+ * @param buffer Destination buffer
+ * @param size Destination size in bytes
+ * @return Bytes written, 0 on error or if the buffer is too small
+ */
+uint32_t epoch_profiler_serialize(epoch_profiler_net_t net, uint8_t *buffer, uint32_t size);
+
+#ifndef APP_HOST_BUILD
+/**
+ * @brief Time every epoch block of a network instance
+ *
+ * Registers the profiler with LL_ATON_RT_SetEpochCallback(). Epoch numbers
+ * need LL_ATON_EB_DBG_INFO (make EPOCH_PROFILE=1); otherwise they read -1.
+ *
+ * @param net Network the instance runs
+ * @param instance Network instance
+ */
+void epoch_profiler_attach(epoch_profiler_net_t net, NN_Instance_TypeDef *instance);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EPOCH_PROFILER_H */
@@ -0,0 +1,189 @@
+/**
+ ******************************************************************************
+ * @file    frame_codec.h
+ * @author  PeleAB
+ * @brief   Left predictor and Rice coding of streamed frame rows
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* CODING CONSTANTS                                                          */
+/* ========================================================================= */
+/*
+ * Coded frame: frame_codec_header_t, then one record per row:
+ *   k u8 | unary bytes u16 | unary bits | remainder bits
+ * or, for a row that would not shrink:
+ *   FRAME_CODEC_ROW_RAW u8 | row pixels as sent uncoded
+ *
+ * Samples are the pixel channels in order: gray; R5, G6, B5 of RGB565; the
+ * three bytes of RGB888. Each is predicted by the same channel of the pixel
+ * to its left (0 for the first pixel); the residual, modulo the channel
+ * range and zigzag mapped, is coded as (residual >> k) in unary (zeros then
+ * a 1) and its low k bits. Unary codes and remainders go in separate bit
+ * streams, most significant bit first, so that a decoder can split all the
+ * codes of a row at once.
+ */
+#define FRAME_CODEC_VERSION             1
+#define FRAME_CODEC_MAX_WIDTH           1024    /**< Widest row coded */
+#define FRAME_CODEC_MAX_CHANNELS        3
+#define FRAME_CODEC_MAX_K               7
+#define FRAME_CODEC_MAX_DROP_BITS       3       /**< RGB565 keeps 2 bits of red and blue */
+#define FRAME_CODEC_ROW_RAW             0xFF    /**< Row record holds the pixels as they are */
+#define FRAME_CODEC_ROW_HEADER_SIZE     3
+
+/* ========================================================================= */
+/* CODING TYPES                                                              */
+/* ========================================================================= */
+
+/**
+ * @brief Coded frame header
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t version;
+    uint8_t bpp;                        /**< 1 gray, 2 RGB565, 3 RGB888 */
+    uint8_t drop_bits;                  /**< Low bits cleared from every channel */
+    uint8_t reserved;
+} frame_codec_header_t;
+
+/**
+ * @brief Coding tuning
+ *
+ * drop_bits > 0 makes the coding near lossless: each channel loses its low
+ * drop_bits bits, which the decoder refills with the middle of the range.
+ * Raw rows stay exact.
+ */
+typedef struct {
+    uint32_t drop_bits;
+} frame_codec_config_t;
+
+/**
+ * @brief Coding statistics
+ */
+typedef struct {
+    uint32_t frames;
+    uint32_t rows;
+    uint32_t raw_rows;                  /**< Rows that did not shrink */
+    uint64_t bytes_in;                  /**< Uncoded bytes of the rows */
+    uint64_t bytes_out;                 /**< Coded bytes, headers included */
+} frame_codec_stats_t;
+
+/**
+ * @brief Encoder state; the row buffers keep the stack small
+ */
+typedef struct {
+    frame_codec_config_t config;
+    uint32_t width;
+    uint32_t bpp;
+    uint8_t *out;
+    uint32_t capacity;
+    uint32_t size;                      /**< Bytes written to out */
+    uint8_t residuals[FRAME_CODEC_MAX_WIDTH * FRAME_CODEC_MAX_CHANNELS];
+    uint8_t remainders[FRAME_CODEC_MAX_WIDTH * FRAME_CODEC_MAX_CHANNELS * FRAME_CODEC_MAX_K / 8 + 1];
+    frame_codec_stats_t stats;
+} frame_codec_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Fill a configuration with the defaults (lossless)
+ * @param config Configuration
+ */
+void frame_codec_default_config(frame_codec_config_t *config);
+
+/**
+ * @brief Initialize an encoder
+ * @param codec Encoder
+ * @param config Tuning, NULL for the defaults
+ * @return 0 on success, negative on error
+ */
+int frame_codec_init(frame_codec_t *codec, const frame_codec_config_t *config);
+
+/**
+ * @brief Largest coded size of a frame
+ *
+ * A row that would not shrink is sent raw behind its 1-byte record header,
+ * so a frame grows by at most one byte per row plus the frame header.
+ *
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param bpp Bytes per pixel
+ * @return Bytes
+ */
+uint32_t frame_codec_bound(uint32_t width, uint32_t height, uint32_t bpp);
+
+/**
+ * @brief Start coding a frame into a buffer
+ * @param codec Encoder
+ * @param width Width in pixels
+ * @param bpp Bytes per pixel: 1 gray, 2 RGB565 little endian, 3 RGB888
+ * @param out Coded frame
+ * @param capacity Size of out in bytes
+ * @return 0 on success, -1 for an unsupported format or a buffer smaller
+ *         than the header
+ */
+int frame_codec_begin(frame_codec_t *codec, uint32_t width, uint32_t bpp,
+                      uint8_t *out, uint32_t capacity);
+
+/**
+ * @brief Code the next row
+ * @param codec Encoder
+ * @param row width * bpp bytes
+ * @return 0 on success, -1 if out is full
+ */
+int frame_codec_encode_row(frame_codec_t *codec, const uint8_t *row);
+
+/**
+ * @brief Finish the frame
+ * @param codec Encoder
+ * @return Coded size in bytes
+ */
+uint32_t frame_codec_end(frame_codec_t *codec);
+
+/**
+ * @brief Decode a coded frame (host side of the coding)
+ * @param image Decoded frame, packed rows
+ * @param capacity Size of image in bytes
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param data Coded frame
+ * @param size Coded size
+ * @return Bytes per pixel on success, -1 if data is malformed or image is
+ *         too small
+ */
+int frame_codec_decode(uint8_t *image, uint32_t capacity, uint32_t width, uint32_t height,
+                       const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Get coding statistics
+ * @param codec Encoder
+ * @param stats Receives the statistics
+ */
+void frame_codec_get_stats(const frame_codec_t *codec, frame_codec_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAME_CODEC_H */
@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @file    frame_mailbox.h
+ * @author  PeleAB
+ * @brief   Lock-free single-producer/single-consumer frame handoff
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef FRAME_MAILBOX_H
+#define FRAME_MAILBOX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* MAILBOX CONSTANTS                                                         */
+/* ========================================================================= */
+#define FRAME_MAILBOX_CAPACITY          4   /**< Queue depth (power of two) */
+#define FRAME_MAILBOX_LATEST_SLOTS      3   /**< Triple buffer for latest-wins mode */
+
+/* ========================================================================= */
+/* MAILBOX TYPES                                                             */
+/* ========================================================================= */
+
+/**
+ * @brief Handoff policy
+ */
+typedef enum {
+    FRAME_MAILBOX_MODE_QUEUE,           /**< FIFO; new frames dropped when full */
+    FRAME_MAILBOX_MODE_LATEST,          /**< Single mailbox; unread frames overwritten */
+} frame_mailbox_mode_t;
+
+/**
+ * @brief Frame descriptor passed from the capture ISR to the pipeline
+ */
+typedef struct {
+    uint32_t buffer_index;              /**< Index of the capture buffer holding the frame */
+    uint32_t timestamp;                 /**< Capture completion time in ms */
+    uint32_t sequence;                  /**< Producer sequence number (starts at 0) */
+} frame_mailbox_entry_t;
+
+/**
+ * @brief Handoff statistics
+ */
+typedef struct {
+    uint32_t posted;                    /**< Frames offered by the producer */
+    uint32_t delivered;                 /**< Frames returned to the consumer */
+    uint32_t flushed;                   /**< Frames discarded by flush() */
+    uint32_t dropped_full;              /**< Queue mode: frames dropped, queue full */
+    uint32_t dropped_overwritten;       /**< Latest mode: frames replaced before read */
+} frame_mailbox_stats_t;
+
+/**
+ * @brief Mailbox state
+ *
+ * Producer-owned fields are only written from post(); consumer-owned fields
+ * only from pop()/wait()/flush(). Statistics may be read from either side.
+ */
+typedef struct {
+    frame_mailbox_mode_t mode;
+
+    /* Queue mode ring */
+    frame_mailbox_entry_t ring[FRAME_MAILBOX_CAPACITY];
+    atomic_uint head;                   /**< Producer index */
+    atomic_uint tail;                   /**< Consumer index */
+
+    /* Latest mode triple buffer */
+    frame_mailbox_entry_t slots[FRAME_MAILBOX_LATEST_SLOTS];
+    atomic_uint latest;                 /**< Published slot index | fresh flag */
+    uint32_t back_slot;                 /**< Producer-owned slot */
+    uint32_t front_slot;                /**< Consumer-owned slot */
+
+    /* Producer-owned */
+    uint32_t next_sequence;
+    atomic_uint posted;
+    atomic_uint dropped_full;
+    atomic_uint dropped_overwritten;
+
+    /* Consumer-owned */
+    atomic_uint delivered;
+    atomic_uint flushed;
+} frame_mailbox_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Initialize a mailbox (no producer or consumer may be active)
+ * @param mb Pointer to mailbox
+ * @param mode Handoff policy
+ * @return 0 on success, negative on error
+ */
+int frame_mailbox_init(frame_mailbox_t *mb, frame_mailbox_mode_t mode);
+
+/**
+ * @brief Post a captured frame (producer side, ISR safe)
+ * @param mb Pointer to mailbox
+ * @param buffer_index Capture buffer holding the frame
+ * @param timestamp Capture completion time in ms
+ * @return true if queued, false if dropped (queue mode full)
+ */
+bool frame_mailbox_post(frame_mailbox_t *mb, uint32_t buffer_index, uint32_t timestamp);
+
+/**
+ * @brief Take the next frame without blocking (consumer side)
+ * @param mb Pointer to mailbox
+ * @param entry Receives the frame descriptor
+ * @return true if a frame was available
+ */
+bool frame_mailbox_pop(frame_mailbox_t *mb, frame_mailbox_entry_t *entry);
+
+/**
+ * @brief Sleep until a frame is available (consumer side)
+ *
+ * The target sleeps with WFE between checks; the producer signals with SEV.
+ *
+ * @param mb Pointer to mailbox
+ * @param entry Receives the frame descriptor
+ * @param timeout_ms Maximum wait in ms, 0 to wait forever
+ * @return 0 on success, negative on timeout or error
+ */
+int frame_mailbox_wait(frame_mailbox_t *mb, frame_mailbox_entry_t *entry, uint32_t timeout_ms);
+
+/**
+ * @brief Discard every pending frame (consumer side)
+ * @param mb Pointer to mailbox
+ * @return Number of frames discarded
+ */
+uint32_t frame_mailbox_flush(frame_mailbox_t *mb);
+
+/**
+ * @brief Snapshot the handoff statistics
+ * @param mb Pointer to mailbox
+ * @param stats Receives the statistics
+ */
+void frame_mailbox_get_stats(const frame_mailbox_t *mb, frame_mailbox_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAME_MAILBOX_H */
@@ -0,0 +1,115 @@
+/**
+ ******************************************************************************
+ * @file    frame_source.h
+ * @author  PeleAB
+ * @brief   Pluggable capture sources feeding the frame processing pipeline
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef FRAME_SOURCE_H
+#define FRAME_SOURCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* FRAME SOURCE INTERFACE                                                    */
+/* ========================================================================= */
+
+typedef struct frame_source frame_source_t;
+
+/**
+ * @brief Capture source operations
+ *
+ * A source delivers RGB888 frames of the neural network input size into a
+ * caller-provided buffer. Sources are polled from the pipeline capture stage.
+ */
+struct frame_source {
+    const char *name;                                   /**< Source name for logs */
+    int (*start)(frame_source_t *src);                  /**< Start capturing (optional) */
+    int (*acquire)(frame_source_t *src, uint8_t *dest,
+                   uint32_t dest_size);                 /**< Fill dest with next frame */
+    void (*stop)(frame_source_t *src);                  /**< Stop capturing (optional) */
+    void *priv;                                         /**< Source private state */
+    uint32_t frame_timestamp;                           /**< Capture time of the last frame in ms, 0 if unknown */
+    uint32_t frames_dropped;                            /**< Frames captured but never delivered */
+};
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Start a capture source
+ * @param src Pointer to source
+ * @return 0 on success, negative on error
+ */
+int frame_source_start(frame_source_t *src);
+
+/**
+ * @brief Acquire the next frame from a capture source
+ * @param src Pointer to source
+ * @param dest Destination buffer (RGB888)
+ * @param dest_size Destination buffer size in bytes
+ * @return 0 on success, 1 when the source is exhausted, negative on error
+ */
+int frame_source_acquire(frame_source_t *src, uint8_t *dest, uint32_t dest_size);
+
+/**
+ * @brief Stop a capture source
+ * @param src Pointer to source
+ */
+void frame_source_stop(frame_source_t *src);
+
+#ifndef APP_HOST_BUILD
+/**
+ * @brief Initialize the DCMIPP camera source
+ *
+ * With CAMERA_NN_CONTINUOUS_CAPTURE the NN pipe runs continuously into two
+ * capture buffers and acquire() copies out the newest complete frame;
+ * otherwise every acquire() triggers and waits for a snapshot.
+ *
+ * @param src Pointer to source to initialize
+ * @param pitch_nn NN pipe line pitch returned by CAM_Init()
+ * @return 0 on success, negative on error
+ */
+int frame_source_camera_init(frame_source_t *src, uint32_t pitch_nn);
+
+/**
+ * @brief Initialize the PC stream source (raw RGB888 frames over UART)
+ * @param src Pointer to source to initialize
+ */
+void frame_source_pc_stream_init(frame_source_t *src);
+#else
+/**
+ * @brief Initialize a file replay source (Linux host build only)
+ *
+ * The file holds back-to-back raw RGB888 frames of the requested size.
+ *
+ * @param src Pointer to source to initialize
+ * @param path Path of the replay file
+ * @param loop Restart from the first frame at end of file
+ * @return 0 on success, negative on error
+ */
+int frame_source_file_init(frame_source_t *src, const char *path, bool loop);
+#endif /* APP_HOST_BUILD */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAME_SOURCE_H */
@@ -0,0 +1,191 @@
+/**
+ ******************************************************************************
+ * @file    gfx2d.h
+ * @author  PeleAB
+ * @brief   Asynchronous 2D operations on the overlay, DMA2D or software backed
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef GFX2D_H
+#define GFX2D_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* ENGINE CONSTANTS                                                          */
+/* ========================================================================= */
+#define GFX2D_QUEUE_DEPTH               32      /**< Queued operations (power of two) */
+#define GFX2D_WAIT_TIMEOUT_MS           100     /**< gfx2d_wait() gives up after this */
+
+/* ========================================================================= */
+/* ENGINE TYPES                                                              */
+/* ========================================================================= */
+
+/**
+ * @brief Pixel formats
+ */
+typedef enum {
+    GFX2D_FORMAT_ARGB4444 = 0,          /**< 16-bit, A in bits 15..12, B in bits 3..0 */
+    GFX2D_FORMAT_RGB888,                /**< 24-bit, bytes R, G, B in memory (camera pipe order) */
+} gfx2d_format_t;
+
+/**
+ * @brief Image in memory
+ */
+typedef struct {
+    uint8_t *pixels;                    /**< First pixel */
+    uint16_t width;                     /**< Width in pixels */
+    uint16_t height;                    /**< Height in pixels */
+    uint16_t stride;                    /**< Pixels per line, >= width */
+    gfx2d_format_t format;
+} gfx2d_surface_t;
+
+/**
+ * @brief Callback run in queue order once the operations before it are done
+ *
+ * With the DMA2D backend it runs from the DMA2D interrupt.
+ */
+typedef void (*gfx2d_fence_cb_t)(void *arg);
+
+/**
+ * @brief Engine statistics
+ */
+typedef struct {
+    uint32_t submitted;                 /**< Operations queued */
+    uint32_t completed;                 /**< Operations done */
+    uint32_t errors;                    /**< Transfer errors and timeouts */
+    uint32_t queue_full;                /**< Submissions that had to wait for a slot */
+    uint64_t pixels;                    /**< Pixels written */
+    uint64_t submit_cycles;             /**< CPU cycles spent queueing operations */
+    uint64_t wait_cycles;               /**< CPU cycles blocked waiting for the engine */
+    uint64_t sw_cycles;                 /**< CPU cycles spent executing operations in software */
+} gfx2d_stats_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Initialize the engine and clear its queue
+ *
+ * Target builds use DMA2D with its interrupt unless built with
+ * APP_GFX2D_SOFTWARE; host builds always use the software backend, which
+ * runs queued operations in order when the queue is drained.
+ *
+ * @return 0 on success, negative on error
+ */
+int gfx2d_init(void);
+
+/**
+ * @brief Queue a solid fill
+ *
+ * The region is clipped to dst. Operations are asynchronous: dst must not be
+ * touched by the CPU, and UTIL_LCD (which drives DMA2D itself) must not be
+ * used, until gfx2d_wait() returns.
+ *
+ * @param dst Destination (ARGB4444)
+ * @param x Left edge
+ * @param y Top edge
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param argb8888 Color, converted to the destination format
+ * @return 0 on success, negative on error
+ */
+int gfx2d_fill(const gfx2d_surface_t *dst, int32_t x, int32_t y, int32_t width, int32_t height,
+               uint32_t argb8888);
+
+/**
+ * @brief Queue a hollow rectangle as four fills
+ * @param dst Destination (ARGB4444)
+ * @param x Left edge
+ * @param y Top edge
+ * @param width Outer width in pixels
+ * @param height Outer height in pixels
+ * @param thickness Border thickness in pixels
+ * @param argb8888 Color
+ * @return 0 on success, negative on error
+ */
+int gfx2d_rect(const gfx2d_surface_t *dst, int32_t x, int32_t y, int32_t width, int32_t height,
+               uint32_t thickness, uint32_t argb8888);
+
+/**
+ * @brief Queue a copy of a whole image with format conversion
+ *
+ * The image is clipped to dst. src must stay unchanged until gfx2d_wait()
+ * returns.
+ *
+ * @param dst Destination (ARGB4444)
+ * @param x Left edge in dst
+ * @param y Top edge in dst
+ * @param src Source (ARGB4444 or RGB888)
+ * @return 0 on success, negative on error
+ */
+int gfx2d_blit(const gfx2d_surface_t *dst, int32_t x, int32_t y, const gfx2d_surface_t *src);
+
+/**
+ * @brief Queue a callback behind the operations already queued
+ * @param callback Callback
+ * @param arg Callback argument
+ * @return 0 on success, negative on error
+ */
+int gfx2d_fence(gfx2d_fence_cb_t callback, void *arg);
+
+/**
+ * @brief Wait until every queued operation is done
+ * @return 0 on success, negative on timeout or transfer error
+ */
+int gfx2d_wait(void);
+
+/**
+ * @brief Get queued operations going without waiting for DMA2D
+ *
+ * DMA2D starts each operation as it is queued, so this returns at once; the
+ * software backend only runs the queue when it is drained, so it does that
+ * here. Use it where gfx2d_wait() would block on hardware.
+ *
+ * @return 0 on success, negative on transfer error
+ */
+int gfx2d_flush(void);
+
+/**
+ * @brief Check whether the queue is empty
+ * @return true if no operation is queued or running
+ */
+bool gfx2d_idle(void);
+
+/**
+ * @brief Get the engine statistics
+ * @param stats Receives the statistics
+ */
+void gfx2d_get_stats(gfx2d_stats_t *stats);
+
+/**
+ * @brief Clear the engine statistics
+ */
+void gfx2d_reset_stats(void);
+
+/**
+ * @brief DMA2D interrupt entry (target DMA2D backend)
+ */
+void gfx2d_irq_handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFX2D_H */
@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @file    memory_planner.h
+ * @author  PeleAB
+ * @brief   Lifetime-based aliasing planner for application scratch buffers
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef MEMORY_PLANNER_H
+#define MEMORY_PLANNER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "memory_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* PLANNER CONSTANTS                                                         */
+/* ========================================================================= */
+#define MEMORY_PLAN_MAX_ENTRIES         8   /**< Maximum number of planned buffers */
+
+/* ========================================================================= */
+/* PLAN STRUCTURES                                                           */
+/* ========================================================================= */
+
+/**
+ * @brief One buffer and the inclusive range of pipeline stages it is live in
+ *
+ * Stages are pipeline_stage_t values, which run in increasing order within a
+ * frame. Buffers are assumed dead between frames.
+ */
+typedef struct {
+    const char *name;                   /**< Buffer name for the printed map */
+    uint32_t size;                      /**< Requested size in bytes */
+    uint32_t alignment;                 /**< Alignment (at least CACHE_LINE_ALIGNMENT) */
+    uint32_t first_stage;               /**< First stage the buffer is live in */
+    uint32_t last_stage;                /**< Last stage the buffer is live in */
+    uint32_t offset;                    /**< Assigned offset in the arena */
+    void **bind;                        /**< Receives the buffer address (optional) */
+} memory_plan_entry_t;
+
+/**
+ * @brief Aliasing plan over one arena
+ */
+typedef struct {
+    memory_plan_entry_t entries[MEMORY_PLAN_MAX_ENTRIES];  /**< Planned buffers */
+    uint32_t entry_count;               /**< Number of planned buffers */
+    uint32_t arena_size;                /**< Arena size required by the plan */
+    uint32_t unaliased_size;            /**< Size without aliasing, for reporting */
+    uint8_t *base;                      /**< Arena base once bound */
+    bool is_solved;                     /**< Offsets assigned */
+} memory_plan_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Initialize an empty plan
+ * @param plan Pointer to plan
+ * @return 0 on success, negative on error
+ */
+int memory_plan_init(memory_plan_t *plan);
+
+/**
+ * @brief Declare a buffer and its lifetime
+ * @param plan Pointer to plan
+ * @param name Buffer name
+ * @param size Buffer size in bytes
+ * @param alignment Alignment requirement (power of two, 0 for cache line)
+ * @param first_stage First stage the buffer is live in
+ * @param last_stage Last stage the buffer is live in
+ * @param bind Location updated with the buffer address by memory_plan_bind()
+ * @return 0 on success, negative on error
+ */
+int memory_plan_add(memory_plan_t *plan, const char *name, uint32_t size,
+                    uint32_t alignment, uint32_t first_stage, uint32_t last_stage,
+                    void **bind);
+
+/**
+ * @brief Assign arena offsets so that only buffers with disjoint lifetimes
+ *        share memory
+ *
+ * Buffers are placed largest first at the lowest offset that does not
+ * collide with an already placed buffer whose lifetime overlaps.
+ *
+ * @param plan Pointer to plan
+ * @return Arena size required by the plan, or 0 on error
+ */
+uint32_t memory_plan_solve(memory_plan_t *plan);
+
+/**
+ * @brief Bind a solved plan to an arena and publish the buffer addresses
+ * @param plan Pointer to plan
+ * @param base Arena base (cache line aligned)
+ * @param size Arena size in bytes
+ * @return 0 on success, negative on error
+ */
+int memory_plan_bind(memory_plan_t *plan, void *base, uint32_t size);
+
+/**
+ * @brief Solve a plan, allocate its arena from a pool region and bind it
+ * @param plan Pointer to plan
+ * @param pool Pool providing the arena
+ * @param region Region to allocate the arena from
+ * @param name Pool buffer name of the arena
+ * @return 0 on success, negative on error
+ */
+int memory_plan_allocate(memory_plan_t *plan, memory_pool_t *pool,
+                         memory_region_t region, const char *name);
+
+/**
+ * @brief Check that no two live-overlapping buffers share memory
+ * @param plan Pointer to plan
+ * @return true if the plan is consistent, false otherwise
+ */
+bool memory_plan_verify(const memory_plan_t *plan);
+
+/**
+ * @brief Print the offset/lifetime map of a plan
+ * @param plan Pointer to plan
+ */
+void memory_plan_print(const memory_plan_t *plan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMORY_PLANNER_H */
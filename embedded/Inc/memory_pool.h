@@ -19,6 +19,7 @@
 #ifndef MEMORY_POOL_H
 #define MEMORY_POOL_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "app_constants.h"
@@ -30,6 +31,39 @@
 #define MEMORY_POOL_MAX_BUFFERS         16  /**< Maximum number of managed buffers */
 #define MEMORY_POOL_NAME_LENGTH         32  /**< Maximum buffer name length */
 
+/** @brief Static arena sizes backing the default application pool */
+#ifndef MEMORY_POOL_AXISRAM_SIZE
+#define MEMORY_POOL_AXISRAM_SIZE        (256 * 1024)
+#endif
+#ifndef MEMORY_POOL_PSRAM_SIZE
+#define MEMORY_POOL_PSRAM_SIZE          (3 * 1024 * 1024)
+#endif
+#ifndef MEMORY_POOL_NPURAM_SIZE
+#define MEMORY_POOL_NPURAM_SIZE         (256 * 1024)
+#endif
+
+/* ========================================================================= */
+/* MEMORY REGIONS                                                            */
+/* ========================================================================= */
+typedef enum {
+    MEMORY_REGION_AXISRAM,              /**< Internal AXI SRAM (.bss) */
+    MEMORY_REGION_PSRAM,                /**< External PSRAM (.psram_bss) */
+    MEMORY_REGION_NPURAM,               /**< Free tail of NPU AXISRAM6 (.npuram_bss) */
+    MEMORY_REGION_COUNT
+} memory_region_t;
+
+/**
+ * @brief Static arena backing one memory region
+ */
+typedef struct {
+    const char *name;                   /**< Region name for debugging */
+    uint8_t *base;                      /**< Arena start (cache line aligned) */
+    uint32_t size;                      /**< Arena size in bytes */
+    bool cached;                        /**< Region is accessed through the D-cache */
+    uint32_t used;                      /**< Bytes currently allocated */
+    uint32_t peak;                      /**< Highest used value since reset */
+} memory_arena_t;
+
 /* ========================================================================= */
 /* MEMORY BUFFER TYPES                                                       */
 /* ========================================================================= */
@@ -53,6 +87,7 @@ typedef struct {
     size_t size;                        /**< Buffer size in bytes */
     size_t alignment;                   /**< Buffer alignment requirement */
     memory_buffer_type_t type;          /**< Buffer type */
+    memory_region_t region;             /**< Region the buffer lives in */
     char name[MEMORY_POOL_NAME_LENGTH]; /**< Buffer name for debugging */
     bool is_allocated;                  /**< Allocation status */
     bool is_cached;                     /**< Cache coherency required */
@@ -64,11 +99,16 @@ typedef struct {
 /* MEMORY POOL STRUCTURE                                                     */
 /* ========================================================================= */
 typedef struct {
+    memory_arena_t arenas[MEMORY_REGION_COUNT];        /**< Backing arenas per region */
     memory_buffer_t buffers[MEMORY_POOL_MAX_BUFFERS];  /**< Managed buffers */
     uint32_t buffer_count;                             /**< Number of active buffers */
     uint32_t total_allocated;                          /**< Total allocated memory */
     uint32_t peak_allocated;                           /**< Peak memory usage */
     uint32_t allocation_failures;                      /**< Allocation failure count */
+    uint32_t allocation_count;                         /**< Successful allocations */
+    uint32_t deallocation_count;                       /**< Successful frees */
+    uint32_t cache_clean_ops;                          /**< D-cache clean operations issued */
+    uint32_t cache_invalidate_ops;                     /**< D-cache invalidate operations issued */
     bool is_initialized;                               /**< Initialization status */
 } memory_pool_t;
 
@@ -78,9 +118,11 @@ typedef struct {
 typedef struct {
     uint32_t total_memory;              /**< Total managed memory */
     uint32_t used_memory;               /**< Currently used memory */
+    uint32_t peak_memory;               /**< Peak used memory since reset */
     uint32_t free_memory;               /**< Available memory */
-    uint32_t fragmentation_percent;     /**< Memory fragmentation percentage */
-    uint32_t cache_hit_rate;            /**< Cache hit rate percentage */
+    uint32_t largest_free_block;        /**< Largest contiguous free block */
+    uint32_t fragmentation_percent;     /**< Free memory not in the largest block */
+    uint32_t cache_hit_rate;            /**< Cache hit rate percentage (not measured, 0) */
     uint32_t allocation_count;          /**< Total allocations */
     uint32_t deallocation_count;        /**< Total deallocations */
 } memory_statistics_t;
@@ -90,14 +132,44 @@ typedef struct {
 /* ========================================================================= */
 
 /**
- * @brief Initialize memory pool manager
+ * @brief Initialize memory pool manager with no regions attached
  * @param pool Pointer to memory pool structure
  * @return 0 on success, negative on error
  */
 int memory_pool_init(memory_pool_t *pool);
 
 /**
- * @brief Allocate aligned memory buffer
+ * @brief Attach a static arena to a pool region
+ *
+ * The arena start is rounded up and its size rounded down to whole cache
+ * lines so that every buffer carved from it owns its cache lines.
+ *
+ * @param pool Pointer to memory pool structure
+ * @param region Region the arena backs
+ * @param base Arena start address
+ * @param size Arena size in bytes
+ * @param cached Region is accessed through the D-cache
+ * @return 0 on success, negative on error
+ */
+int memory_pool_add_region(memory_pool_t *pool, memory_region_t region,
+                           void *base, uint32_t size, bool cached);
+
+/**
+ * @brief Get the application pool backed by the static AXISRAM, PSRAM and
+ *        NPU RAM arenas (initialized on first use)
+ * @return Pointer to the application pool
+ */
+memory_pool_t *memory_pool_get_default(void);
+
+/**
+ * @brief Get the default region used for a buffer type
+ * @param type Buffer type
+ * @return Region used by memory_pool_alloc() for this type
+ */
+memory_region_t memory_pool_default_region(memory_buffer_type_t type);
+
+/**
+ * @brief Allocate aligned memory buffer in the default region of its type
  * @param pool Pointer to memory pool structure
  * @param size Buffer size in bytes
  * @param alignment Memory alignment requirement
@@ -108,6 +180,25 @@ int memory_pool_init(memory_pool_t *pool);
 void *memory_pool_alloc(memory_pool_t *pool, size_t size, size_t alignment, 
                         memory_buffer_type_t type, const char *name);
 
+/**
+ * @brief Allocate aligned memory buffer in a given region
+ *
+ * Buffers in cached regions are aligned to at least CACHE_LINE_ALIGNMENT and
+ * padded to whole cache lines, so cache maintenance on one buffer never
+ * touches its neighbours. Allocation is first-fit over the free gaps.
+ *
+ * @param pool Pointer to memory pool structure
+ * @param region Region to allocate from
+ * @param size Buffer size in bytes
+ * @param alignment Memory alignment requirement (power of two, 0 for default)
+ * @param type Buffer type
+ * @param name Buffer name for debugging
+ * @return Pointer to allocated buffer or NULL on failure
+ */
+void *memory_pool_alloc_region(memory_pool_t *pool, memory_region_t region,
+                               size_t size, size_t alignment,
+                               memory_buffer_type_t type, const char *name);
+
 /**
  * @brief Free memory buffer
  * @param pool Pointer to memory pool structure
@@ -133,7 +224,15 @@ memory_buffer_t *memory_pool_get_buffer(memory_pool_t *pool, void *ptr);
 memory_buffer_t *memory_pool_get_buffer_by_name(memory_pool_t *pool, const char *name);
 
 /**
- * @brief Invalidate cache for buffer
+ * @brief Clean cache for buffer (CPU writes made visible to DMA/NPU)
+ * @param pool Pointer to memory pool structure
+ * @param ptr Buffer pointer
+ * @return 0 on success, negative on error
+ */
+int memory_pool_clean_cache(memory_pool_t *pool, void *ptr);
+
+/**
+ * @brief Invalidate cache for buffer (DMA/NPU writes made visible to CPU)
  * @param pool Pointer to memory pool structure
  * @param ptr Buffer pointer
  * @return 0 on success, negative on error
@@ -149,13 +248,55 @@ int memory_pool_invalidate_cache(memory_pool_t *pool, void *ptr);
 int memory_pool_clean_invalidate_cache(memory_pool_t *pool, void *ptr);
 
 /**
- * @brief Get memory pool statistics
+ * @brief Clean cache for a sub-range of a managed buffer
+ *
+ * The range is widened to cache line boundaries, which never leaves the
+ * buffer since buffers are line aligned and padded. No-op for uncached
+ * buffers.
+ *
+ * @param pool Pointer to memory pool structure
+ * @param ptr Start of the range (inside a managed buffer)
+ * @param size Range size in bytes
+ * @return 0 on success, negative if the range is not inside one buffer
+ */
+int memory_pool_clean_range(memory_pool_t *pool, void *ptr, size_t size);
+
+/**
+ * @brief Invalidate cache for a sub-range of a managed buffer
+ * @param pool Pointer to memory pool structure
+ * @param ptr Start of the range (inside a managed buffer)
+ * @param size Range size in bytes
+ * @return 0 on success, negative if the range is not inside one buffer
+ */
+int memory_pool_invalidate_range(memory_pool_t *pool, void *ptr, size_t size);
+
+/**
+ * @brief Clean and invalidate cache for a sub-range of a managed buffer
+ * @param pool Pointer to memory pool structure
+ * @param ptr Start of the range (inside a managed buffer)
+ * @param size Range size in bytes
+ * @return 0 on success, negative if the range is not inside one buffer
+ */
+int memory_pool_clean_invalidate_range(memory_pool_t *pool, void *ptr, size_t size);
+
+/**
+ * @brief Get memory pool statistics over all regions
  * @param pool Pointer to memory pool structure
  * @param stats Pointer to statistics structure
  * @return 0 on success, negative on error
  */
 int memory_pool_get_statistics(memory_pool_t *pool, memory_statistics_t *stats);
 
+/**
+ * @brief Get statistics for one region
+ * @param pool Pointer to memory pool structure
+ * @param region Region to report
+ * @param stats Pointer to statistics structure
+ * @return 0 on success, negative on error
+ */
+int memory_pool_get_region_statistics(memory_pool_t *pool, memory_region_t region,
+                                      memory_statistics_t *stats);
+
 /**
  * @brief Print memory pool information
  * @param pool Pointer to memory pool structure
@@ -163,11 +304,15 @@ int memory_pool_get_statistics(memory_pool_t *pool, memory_statistics_t *stats);
 void memory_pool_print_info(memory_pool_t *pool);
 
 /**
- * @brief Defragment memory pool
+ * @brief Sort the buffer table by region and address, for reporting
+ *
+ * No memory moves: free gaps are coalesced on every free and live buffers
+ * stay put (callers hold raw pointers), so the pool has no defragmentation.
+ *
  * @param pool Pointer to memory pool structure
  * @return 0 on success, negative on error
  */
-int memory_pool_defragment(memory_pool_t *pool);
+int memory_pool_sort_buffers(memory_pool_t *pool);
 
 /**
  * @brief Validate memory pool integrity
@@ -177,7 +322,7 @@ int memory_pool_defragment(memory_pool_t *pool);
 bool memory_pool_validate(memory_pool_t *pool);
 
 /**
- * @brief Reset memory pool
+ * @brief Reset memory pool (frees every buffer, keeps the attached regions)
  * @param pool Pointer to memory pool structure
  * @return 0 on success, negative on error
  */
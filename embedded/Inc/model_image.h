@@ -0,0 +1,147 @@
+/**
+ ******************************************************************************
+ * @file    model_image.h
+ * @author  PeleAB
+ * @brief   Header checks of relocatable network images stored in flash slots
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef MODEL_IMAGE_H
+#define MODEL_IMAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* IMAGE CONSTANTS                                                           */
+/* ========================================================================= */
+
+/* Layout of the images built for ll_aton_reloc_install (ll_aton_reloc_network.c) */
+#define MODEL_IMAGE_MAGIC               0x4E49424EUL /**< AI_RELOC_MAGIC */
+#define MODEL_IMAGE_HEADER_SIZE         96U         /**< bin_hdr + sec_info + net_entries */
+#define MODEL_IMAGE_CTX_SIZE            64U         /**< ai_reloc_rt_ctx on a 32-bit MCU */
+#define MODEL_IMAGE_MAX_POOLS           10U         /**< Memory pool descriptors read by the runtime */
+#define MODEL_IMAGE_NAME_LEN            32U         /**< Stored c-name length, terminator included */
+
+#define MODEL_IMAGE_RT_MAJOR            8U          /**< AI_RELOC_RT_VERSION_MAJOR */
+#define MODEL_IMAGE_RT_MINOR            0U          /**< AI_RELOC_RT_VERSION_MINOR */
+#define MODEL_IMAGE_CPUID_CORTEX_M55    0xD22U      /**< CPUID part number */
+#define MODEL_IMAGE_FPABI_HARD          2U          /**< -mfloat-abi=hard */
+
+#define MODEL_IMAGE_EXTRA_SECURE        (1U << 0)   /**< Built for the secure state */
+#define MODEL_IMAGE_EXTRA_DBG_INFO      (1U << 1)   /**< Built with LL_ATON_EB_DBG_INFO */
+#define MODEL_IMAGE_EXTRA_ASYNC         (1U << 2)   /**< Built with LL_ATON_RT_ASYNC */
+
+#define MODEL_IMAGE_POOL_TYPE_RELOC     1U          /**< Pool placed at install time */
+#define MODEL_IMAGE_POOL_ID_PARAMS      0U          /**< Relocated pool holding the weights */
+#define MODEL_IMAGE_POOL_ID_EXT_RAM     1U          /**< Relocated pool in external RAM */
+
+/**
+ * @brief Image check status
+ */
+typedef enum {
+    MODEL_IMAGE_OK = 0,                 /**< Image can be installed */
+    MODEL_IMAGE_ERR_ARG = -1,           /**< Invalid argument */
+    MODEL_IMAGE_ERR_MAGIC = -2,         /**< Not a relocatable network image */
+    MODEL_IMAGE_ERR_LAYOUT = -3,        /**< Sections or descriptors outside the image */
+    MODEL_IMAGE_ERR_TARGET = -4,        /**< Built for another core, ABI or runtime mode */
+    MODEL_IMAGE_ERR_VERSION = -5,       /**< Built against another runtime version */
+    MODEL_IMAGE_ERR_MEMORY = -6,        /**< Slot, exec RAM or external RAM too small */
+} model_image_status_t;
+
+/* ========================================================================= */
+/* IMAGE STRUCTURES                                                          */
+/* ========================================================================= */
+
+/**
+ * @brief Memory pool descriptor of an image (ll_aton_reloc_mem_pool_desc)
+ */
+typedef struct {
+    uint32_t flags;                     /**< type << 24 | dtype << 16 | attr << 8 | id */
+    uint32_t file_offset;               /**< Offset of the initial content in the weights */
+    uint32_t dst;                       /**< Fixed address, or 0 for relocated pools */
+    uint32_t size;                      /**< Size in bytes */
+} model_image_pool_t;
+
+/**
+ * @brief Header information of a relocatable network image
+ */
+typedef struct {
+    char c_name[MODEL_IMAGE_NAME_LEN];  /**< Network c-name */
+    uint32_t flags;                     /**< Version, toolchain, ABI and CPUID flags */
+    uint32_t code_size;                 /**< Header, text and rodata, 8-byte rounded */
+    uint32_t image_size;                /**< Bytes the slot holds: code, relocations, weights */
+    uint32_t exec_ram_xip;              /**< Exec RAM needed when executing in place */
+    uint32_t exec_ram_copy;             /**< Exec RAM needed when the code is copied */
+    uint32_t params_offset;             /**< Offset of the weights in the image */
+    uint32_t params_size;               /**< Size of the weights */
+    uint32_t acts_size;                 /**< Activation size */
+    uint32_t ext_ram_size;              /**< External RAM requested for the activations */
+    uint32_t rt_version;                /**< Runtime version the image was built against */
+    model_image_pool_t pools[MODEL_IMAGE_MAX_POOLS]; /**< Memory pool descriptors */
+    uint32_t pool_count;                /**< Number of valid descriptors */
+} model_image_info_t;
+
+/**
+ * @brief What the firmware provides to an image
+ */
+typedef struct {
+    uint32_t slot_size;                 /**< Flash slot size */
+    uint32_t exec_ram_size;             /**< Exec RAM reserved for the network (XIP mode) */
+    uint32_t ext_ram_size;              /**< External RAM reserved for the network */
+    uint32_t cpuid;                     /**< CPUID part number */
+    uint32_t extra;                     /**< MODEL_IMAGE_EXTRA_xxx bits of the firmware */
+    uint32_t rt_version;                /**< major << 24 | minor << 16 | micro << 8 */
+} model_image_limits_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Read and bound-check the header of an image
+ *
+ * Only the header, the runtime context and the memory pool descriptors are
+ * read, so the image can be used in place from memory-mapped flash.
+ *
+ * @param image Image start (4-byte aligned)
+ * @param size Bytes readable from image (the slot size)
+ * @param info Receives the header information
+ * @return MODEL_IMAGE_OK, or a negative model_image_status_t
+ */
+int model_image_parse(const uint8_t *image, uint32_t size, model_image_info_t *info);
+
+/**
+ * @brief Check that a parsed image can be installed by this firmware
+ * @param info Parsed header information
+ * @param limits Firmware target and memory budgets
+ * @return MODEL_IMAGE_OK, or a negative model_image_status_t
+ */
+int model_image_check(const model_image_info_t *info, const model_image_limits_t *limits);
+
+/**
+ * @brief Get a printable reason for a status
+ * @param status Status returned by model_image_parse or model_image_check
+ * @return Static string
+ */
+const char *model_image_status_str(int status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MODEL_IMAGE_H */
@@ -0,0 +1,172 @@
+/**
+ ******************************************************************************
+ * @file    npu_stall_monitor.h
+ * @author  PeleAB
+ * @brief   Sampled NPU stream engine stall telemetry per memory pool
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef NPU_STALL_MONITOR_H
+#define NPU_STALL_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "epoch_profiler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* MONITOR CONSTANTS                                                         */
+/* ========================================================================= */
+#define NPU_STALL_MAX_ENGINES           10      /**< ATON stream engines on STM32N6 */
+#define NPU_STALL_SAMPLE_PERIOD_MS      1       /**< SysTick period the samples are taken at */
+#define NPU_STALL_WIRE_VERSION          1       /**< Serialized report format version */
+#define NPU_STALL_WIRE_HEADER_SIZE      10      /**< version, network, pools, period, samples, blocks */
+#define NPU_STALL_WIRE_POOL_SIZE        17      /**< pool, read/write running and stalled */
+#define NPU_STALL_WIRE_BLOCK_SIZE       7       /**< samples, read/write stalled, pool mask */
+
+/* ========================================================================= */
+/* MONITOR TYPES                                                             */
+/* ========================================================================= */
+
+/**
+ * @brief Memory pools the stream engines address
+ */
+typedef enum {
+    NPU_POOL_NPURAM = 0,                /**< AXISRAM3..6 */
+    NPU_POOL_CPURAM,                    /**< AXISRAM1/2 and FLEXMEM */
+    NPU_POOL_HYPERRAM,                  /**< xSPI1 PSRAM */
+    NPU_POOL_OCTOFLASH,                 /**< xSPI2 flash */
+    NPU_POOL_OTHER,
+    NPU_POOL_COUNT
+} npu_pool_t;
+
+/**
+ * @brief State of one running stream engine at a sample
+ *
+ * A stalled input engine (reads memory) is held by the stream switch
+ * consumer; a stalled output engine (writes memory) is not accepting data,
+ * i.e. its memory is the bottleneck.
+ */
+typedef struct {
+    uint32_t address;                   /**< Current stream address */
+    bool output;                        /**< Engine writes to memory */
+    bool stalled;                       /**< Link STALL signal was high */
+} npu_stall_engine_t;
+
+/**
+ * @brief Samples attributed to one memory pool
+ */
+typedef struct {
+    uint32_t read_running;              /**< Input engine samples on this pool */
+    uint32_t read_stalled;
+    uint32_t write_running;             /**< Output engine samples on this pool */
+    uint32_t write_stalled;
+} npu_stall_pool_stats_t;
+
+/**
+ * @brief Samples taken while one epoch block was running
+ */
+typedef struct {
+    uint16_t samples;
+    uint16_t read_stalled;              /**< Samples with a stalled input engine */
+    uint16_t write_stalled;             /**< Samples with a stalled output engine */
+    uint8_t pools;                      /**< Bit mask of npu_pool_t addressed */
+} npu_stall_block_stats_t;
+
+/**
+ * @brief Stall report of one network
+ */
+typedef struct {
+    npu_stall_pool_stats_t pools[NPU_POOL_COUNT];
+    npu_stall_block_stats_t blocks[EPOCH_PROFILER_MAX_BLOCKS];
+    uint32_t samples;                   /**< Samples taken while the network ran */
+} npu_stall_network_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Clear every report
+ */
+void npu_stall_monitor_reset(void);
+
+/**
+ * @brief Classify a stream address into a memory pool
+ * @param address NPU bus address (secure or non-secure alias)
+ * @return Memory pool
+ */
+npu_pool_t npu_stall_pool_from_address(uint32_t address);
+
+/**
+ * @brief Get a pool name for logs
+ * @param pool Memory pool
+ * @return Static name string
+ */
+const char *npu_stall_pool_name(npu_pool_t pool);
+
+/**
+ * @brief Account one sample of the running stream engines
+ * @param net Network that was running
+ * @param block Epoch block index that was running
+ * @param engines Running engines
+ * @param count Number of running engines
+ */
+void npu_stall_monitor_record(epoch_profiler_net_t net, uint16_t block,
+                              const npu_stall_engine_t *engines, uint32_t count);
+
+/**
+ * @brief Get the report of a network
+ * @param net Network
+ * @return Report, NULL for an invalid network
+ */
+const npu_stall_network_t *npu_stall_monitor_get(epoch_profiler_net_t net);
+
+/**
+ * @brief Serialize the report of a network
+ *
+ * Little-endian layout: u8 version, u8 network, u8 pool count, u8 sample
+ * period in ms, u32 samples, u16 block count; per pool u8 pool,
+ * u32 read running, u32 read stalled, u32 write running, u32 write stalled;
+ * then per epoch block (same order as the epoch profile) u16 samples,
+ * u16 read stalled, u16 write stalled, u8 pool mask.
+ *
+ * @param net Network
+ * @param buffer Destination buffer
+ * @param size Destination size in bytes
+ * @return Bytes written, 0 on error or if the buffer is too small
+ */
+uint32_t npu_stall_monitor_serialize(epoch_profiler_net_t net, uint8_t *buffer, uint32_t size);
+
+#ifndef APP_HOST_BUILD
+/**
+ * @brief Enable the ATON debug and trace unit
+ */
+void npu_stall_monitor_init(void);
+
+/**
+ * @brief Sample the stream engines of the running epoch block
+ *
+ * Called from SysTick_Handler; does nothing when no block is running.
+ */
+void npu_stall_monitor_sample(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NPU_STALL_MONITOR_H */
@@ -0,0 +1,175 @@
+/**
+ ******************************************************************************
+ * @file    perf_monitor.h
+ * @author  PeleAB
+ * @brief   Cycle-accurate timers for pipeline stages, networks and faces
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* MONITOR CONSTANTS                                                         */
+/* ========================================================================= */
+#define PERF_MONITOR_RING_SIZE          128     /**< Samples kept per probe (power of two) */
+#define PERF_MONITOR_EXPORT_PERIOD_MS   1000    /**< Summary export interval */
+#define PERF_MONITOR_WIRE_VERSION       1       /**< Serialized summary format version */
+#define PERF_MONITOR_WIRE_HEADER_SIZE   6       /**< version, probe count, timestamp */
+#define PERF_MONITOR_WIRE_PROBE_SIZE    21      /**< id, count, min, avg, p99, max */
+
+/* ========================================================================= */
+/* MONITOR TYPES                                                             */
+/* ========================================================================= */
+
+/**
+ * @brief Timed regions
+ *
+ * Stage probes follow pipeline_stage_t order.
+ */
+typedef enum {
+    PERF_PROBE_FRAME = 0,               /**< Whole pipeline frame */
+    PERF_PROBE_STAGE_CAPTURE,
+    PERF_PROBE_STAGE_PREPROCESSING,
+    PERF_PROBE_STAGE_DETECTION,
+    PERF_PROBE_STAGE_TRACKING,
+    PERF_PROBE_STAGE_RECOGNITION,
+    PERF_PROBE_STAGE_POSTPROCESSING,
+    PERF_PROBE_STAGE_OUTPUT,
+    PERF_PROBE_NN_DETECTION,            /**< Face detection inference */
+    PERF_PROBE_NN_RECOGNITION,          /**< Face recognition inference */
+    PERF_PROBE_FACE,                    /**< Crop, align and recognize one face */
+    PERF_PROBE_OVERLAY_CLEAR,           /**< Clear of the overlay regions drawn last time */
+    PERF_PROBE_FRAME_CODEC,             /**< Coding of a streamed frame */
+    PERF_PROBE_DISPLAY_TASK,            /**< One pass of the overlay display task (interrupt) */
+    PERF_PROBE_COUNT
+} perf_probe_t;
+
+/**
+ * @brief Per-probe samples and running totals
+ */
+typedef struct {
+    uint32_t ring[PERF_MONITOR_RING_SIZE]; /**< Most recent durations in cycles */
+    uint32_t count;                     /**< Samples recorded since reset */
+    uint32_t min;                       /**< Shortest duration in cycles */
+    uint32_t max;                       /**< Longest duration in cycles */
+    uint64_t total;                     /**< Sum of all durations in cycles */
+    uint32_t start;                     /**< Cycle count at the open begin() */
+} perf_probe_data_t;
+
+/**
+ * @brief Probe summary in microseconds
+ *
+ * min, max and avg cover every sample since reset; p99 covers the ring.
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t p99_us;
+    uint32_t max_us;
+} perf_summary_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Start the cycle counter and clear every probe
+ *
+ * On target this enables the DWT cycle counter; on the host durations come
+ * from clock_gettime() in nanoseconds.
+ */
+void perf_monitor_init(void);
+
+/**
+ * @brief Clear every probe without touching the cycle counter
+ */
+void perf_monitor_reset(void);
+
+/**
+ * @brief Read the free-running cycle counter
+ * @return Current cycle count (wraps)
+ */
+uint32_t perf_monitor_now(void);
+
+/**
+ * @brief Cycle counter ticks per microsecond
+ * @return Ticks per microsecond
+ */
+uint32_t perf_monitor_cycles_per_us(void);
+
+/**
+ * @brief Open a timed region (regions of different probes may nest)
+ * @param probe Probe to time
+ */
+void perf_monitor_begin(perf_probe_t probe);
+
+/**
+ * @brief Close the timed region opened by perf_monitor_begin()
+ * @param probe Probe being timed
+ */
+void perf_monitor_end(perf_probe_t probe);
+
+/**
+ * @brief Record a duration measured elsewhere
+ * @param probe Probe to update
+ * @param cycles Duration in cycles
+ */
+void perf_monitor_record(perf_probe_t probe, uint32_t cycles);
+
+/**
+ * @brief Summarize one probe
+ * @param probe Probe to summarize
+ * @param summary Receives the summary
+ * @return 0 on success, negative on error
+ */
+int perf_monitor_get_summary(perf_probe_t probe, perf_summary_t *summary);
+
+/**
+ * @brief Get a probe name for logs
+ * @param probe Probe
+ * @return Static name string
+ */
+const char *perf_monitor_probe_name(perf_probe_t probe);
+
+/**
+ * @brief Serialize the summary of every probe with samples
+ *
+ * Little-endian layout: u8 version, u8 probe count, u32 timestamp_ms, then
+ * per probe u8 id, u32 count, u32 min_us, u32 avg_us, u32 p99_us, u32 max_us.
+ *
+ * @param buffer Destination buffer
+ * @param size Destination size in bytes
+ * @param timestamp_ms Export time stamped into the header
+ * @return Bytes written, 0 if the buffer is too small
+ */
+uint32_t perf_monitor_serialize(uint8_t *buffer, uint32_t size, uint32_t timestamp_ms);
+
+/**
+ * @brief Print the summary of every probe with samples
+ */
+void perf_monitor_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERF_MONITOR_H */
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file    robust_framing.h
+ * @author  PeleAB
+ * @brief   PC stream wire framing (v1 packets, v2 chunked messages)
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef ROBUST_FRAMING_H
+#define ROBUST_FRAMING_H
+
+#include "uart_tx_queue.h"
+#include "crc32_stream.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* WIRE FORMAT                                                               */
+/* ========================================================================= */
+/*
+ * v1 packet:
+ *   SOF 0xAA | size u16 | XOR(3 previous bytes) | type u8 | seq u16 | payload | CRC32
+ *   size counts the 3-byte message header and the payload.
+ *
+ * v2 chunk (a message is one or more chunks sent back to back):
+ *   SOF 0xAB | version u8 | type u8 | flags u8 | seq u16 | chunk size u16 |
+ *   message size u32 | chunk offset u32 | XOR(16 previous bytes) | chunk | CRC32
+ *
+ * All fields are little endian; the CRC32 (crc32_stream) covers the payload,
+ * or for v2 the chunk, only.
+ */
+#define ROBUST_SOF_BYTE                 0xAA
+#define ROBUST_HEADER_SIZE              4
+#define ROBUST_MSG_HEADER_SIZE          3
+#define ROBUST_CRC_SIZE                 4
+#define ROBUST_MAX_PAYLOAD_SIZE         (64 * 1024)     /**< v1 size field limit */
+
+#define ROBUST_V2_SOF_BYTE              0xAB
+#define ROBUST_V2_HEADER_SIZE           17
+#define ROBUST_V2_FLAG_FIRST            0x01    /**< Chunk starts the message */
+#define ROBUST_V2_FLAG_LAST             0x02    /**< Chunk ends the message */
+#define ROBUST_V2_CHUNK_SIZE            (16 * 1024)     /**< Default chunk payload */
+#define ROBUST_V2_MAX_CHUNK_SIZE        0xFFFFU
+
+#define ROBUST_PROTOCOL_V1              1
+#define ROBUST_PROTOCOL_V2              2
+
+#if ROBUST_V2_HEADER_SIZE > UART_TX_MAX_HEAD
+#error "UART_TX_MAX_HEAD must hold a v2 chunk header"
+#endif
+
+/* ========================================================================= */
+/* MESSAGE WRITER                                                            */
+/* ========================================================================= */
+
+/**
+ * @brief Message being written into the transmit queue
+ *
+ * v1 messages reserve their whole payload; v2 messages reserve one chunk at a
+ * time and queue it as soon as it is full, so a message never needs more
+ * than a chunk of queue memory to be built.
+ */
+typedef struct {
+    uart_tx_queue_t *queue;
+    uint8_t version;
+    uint8_t message_type;
+    uint16_t sequence_id;
+    uint32_t message_size;              /**< Payload bytes announced */
+    uint32_t chunk_limit;               /**< Largest v2 chunk */
+    uint32_t written;                   /**< Payload bytes written so far */
+    uint8_t *chunk;                     /**< Open reservation, NULL if none */
+    uint32_t chunk_offset;              /**< Message offset of the open chunk */
+    uint32_t chunk_size;
+    uart_tx_class_t packet_class;       /**< Class of the next reservation */
+    crc32_stream_t crc;
+} robust_writer_t;
+
+/**
+ * @brief Start a message
+ *
+ * Only the first reservation uses packet_class: once a v2 message has
+ * started, its remaining chunks wait for room so it is never cut short.
+ *
+ * @param writer Writer
+ * @param queue Transmit queue
+ * @param version ROBUST_PROTOCOL_V1 or ROBUST_PROTOCOL_V2
+ * @param message_type Message type
+ * @param sequence_id Sequence ID
+ * @param message_size Payload size in bytes
+ * @param chunk_limit Largest v2 chunk (0 for ROBUST_V2_CHUNK_SIZE), unused for v1
+ * @param packet_class Back-pressure class of the message
+ * @return 0 on success, -1 if the queue refused it, -2 if it is too large
+ */
+int robust_writer_begin(robust_writer_t *writer, uart_tx_queue_t *queue, uint8_t version,
+                        uint8_t message_type, uint16_t sequence_id, uint32_t message_size,
+                        uint32_t chunk_limit, uart_tx_class_t packet_class);
+
+/**
+ * @brief Append payload bytes
+ * @param writer Writer
+ * @param data Bytes
+ * @param size Number of bytes, at most what remains of the announced size
+ * @return 0 on success, negative on error (the message is abandoned)
+ */
+int robust_writer_write(robust_writer_t *writer, const void *data, uint32_t size);
+
+/**
+ * @brief Queue the end of the message
+ * @param writer Writer
+ * @return 0 on success, negative if the payload is incomplete or the queue failed
+ */
+int robust_writer_end(robust_writer_t *writer);
+
+/**
+ * @brief Abandon the message; chunks already queued are still sent
+ * @param writer Writer
+ */
+void robust_writer_abort(robust_writer_t *writer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROBUST_FRAMING_H */
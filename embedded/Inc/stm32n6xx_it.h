@@ -33,6 +33,10 @@
 void SVC_Handler(void);
 void SysTick_Handler(void);
 void EXTI13_IRQHandler(void);
+void DMA2D_IRQHandler(void);
+void LTDC_LO_IRQHandler(void);
+void GPDMA1_Channel0_IRQHandler(void);
+void USART1_IRQHandler(void);
 
 #ifdef __cplusplus
 }
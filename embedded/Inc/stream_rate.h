@@ -0,0 +1,196 @@
+/**
+ ******************************************************************************
+ * @file    stream_rate.h
+ * @author  PeleAB
+ * @brief   Rate control of streamed images against link throughput and
+ *          pipeline time
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef STREAM_RATE_H
+#define STREAM_RATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* CONTROL CONSTANTS                                                         */
+/* ========================================================================= */
+#define STREAM_RATE_DEFAULT_LINK_BPS        (921600U * 8U / 10U) /**< 7.3 Mbaud, 10 bits a byte */
+#define STREAM_RATE_DEFAULT_PERIOD_US       33333U  /**< Frame period before one is measured */
+#define STREAM_RATE_DEFAULT_MAX_FRACTION    250U    /**< Permille of frame time spent streaming */
+#define STREAM_RATE_DEFAULT_MIN_SCALE       2U
+#define STREAM_RATE_DEFAULT_MAX_SCALE       8U
+#define STREAM_RATE_MIN_SAMPLE_US           5000U   /**< Shortest link throughput sample */
+#define STREAM_RATE_REFINE_HEADROOM         2U      /**< A finer scale must fit this many times over */
+#define STREAM_RATE_REFINE_FRAMES           8U      /**< Frames of headroom before a finer scale */
+#define STREAM_RATE_PROBE_RATIO             4U      /**< Coding ratio assumed by a first probe */
+#define STREAM_RATE_QUEUE_PERIODS           2U      /**< Periods the queue may take to drain */
+
+/* ========================================================================= */
+/* CONTROL TYPES                                                             */
+/* ========================================================================= */
+
+/**
+ * @brief Message classes
+ *
+ * One FRAME is streamed per pipeline frame: it opens the accounting window
+ * of the next period. RELIABLE messages (metrics, detections, embeddings)
+ * are always sent; the images leave room for them.
+ */
+typedef enum {
+    STREAM_RATE_FRAME = 0,              /**< Whole frame, decimated by scale */
+    STREAM_RATE_CROP,                   /**< Aligned face crop, full resolution or nothing */
+    STREAM_RATE_RELIABLE,
+    STREAM_RATE_CLASS_COUNT
+} stream_rate_class_t;
+
+/**
+ * @brief Decision for one message
+ */
+typedef struct {
+    bool send;
+    uint32_t scale;                     /**< Decimation of both axes, 1 for crops */
+} stream_rate_decision_t;
+
+/**
+ * @brief Control tuning
+ */
+typedef struct {
+    uint32_t link_bytes_per_s;          /**< Nominal link rate, the first estimate */
+    uint32_t default_period_us;
+    uint32_t max_fraction;              /**< Permille of the frame period spent in send calls */
+    uint32_t min_scale;                 /**< Finest decimation of whole frames */
+    uint32_t max_scale;                 /**< Coarsest decimation before skipping */
+} stream_rate_config_t;
+
+/**
+ * @brief Per-class running estimates and counts
+ */
+typedef struct {
+    uint32_t sent;
+    uint32_t skipped;
+    uint32_t ratio;                     /**< Sent bytes per 1000 pixel bytes (coding) */
+    uint32_t cost_ns_per_kb;            /**< Send call time per 1024 pixel bytes */
+} stream_rate_class_stats_t;
+
+/**
+ * @brief Controller state
+ */
+typedef struct {
+    stream_rate_config_t config;
+    uint32_t link_bytes_per_s;          /**< Throughput estimate */
+    uint32_t period_us;                 /**< Frame period estimate */
+    uint32_t reliable_reserve;          /**< Reliable bytes per period estimate */
+    uint32_t scale;                     /**< Decimation of the last frame sent */
+    uint32_t refine_frames;             /**< Frames in a row a finer scale had headroom */
+
+    bool link_sampled;
+    uint32_t sample_us;                 /**< Time of the last throughput sample */
+    uint32_t sample_bytes_sent;
+    uint32_t sample_pending;
+    uint32_t bytes_pending;             /**< Queued bytes at the last update */
+
+    bool window_open;
+    uint32_t window_start_us;
+    uint32_t window_bytes;              /**< Bytes queued in the current period */
+    uint32_t window_reliable;
+    uint32_t window_us;                 /**< Send call time in the current period */
+    uint32_t last_fraction;             /**< Permille of the last period spent streaming */
+
+    stream_rate_class_stats_t classes[STREAM_RATE_CLASS_COUNT];
+} stream_rate_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Fill a configuration with the defaults
+ * @param config Configuration
+ */
+void stream_rate_default_config(stream_rate_config_t *config);
+
+/**
+ * @brief Initialize a controller
+ * @param rate Controller
+ * @param config Tuning, NULL for the defaults
+ * @return 0 on success, negative on error
+ */
+int stream_rate_init(stream_rate_t *rate, const stream_rate_config_t *config);
+
+/**
+ * @brief Sample the link
+ *
+ * Throughput is only measured while the queue stays backlogged, when the
+ * bytes sent show what the link carries rather than what was offered. An
+ * idle link can only raise the estimate, and drifts it back toward the
+ * nominal rate so that one slow spell is not remembered forever.
+ *
+ * @param rate Controller
+ * @param now_us Time in microseconds (wraps)
+ * @param bytes_sent Bytes the link has sent so far (wraps)
+ * @param bytes_pending Bytes queued or in flight
+ */
+void stream_rate_update(stream_rate_t *rate, uint32_t now_us, uint32_t bytes_sent,
+                        uint32_t bytes_pending);
+
+/**
+ * @brief Decide whether and how to send an image
+ *
+ * An image may take what the link carries in STREAM_RATE_QUEUE_PERIODS
+ * periods, less the reliable reserve and the bytes still queued, so that a
+ * result queued behind it waits no longer than that; the send calls of a
+ * period may take max_fraction of it. A frame takes the finest scale that
+ * fits both; it coarsens at once but refines one step at a time, after
+ * STREAM_RATE_REFINE_FRAMES frames in which the finer scale fitted twice
+ * over, so the scale does not flip with every crop. Coding ratios start at
+ * 1000 (uncoded) and are learnt as images go out; a class not sent yet is
+ * probed once on an idle link if a 4:1 coding ratio would make it fit.
+ *
+ * @param rate Controller
+ * @param cls Message class
+ * @param now_us Time in microseconds (wraps)
+ * @param pixel_bytes Image size at scale 1
+ * @return Decision
+ */
+stream_rate_decision_t stream_rate_decide(stream_rate_t *rate, stream_rate_class_t cls,
+                                          uint32_t now_us, uint32_t pixel_bytes);
+
+/**
+ * @brief Account for a message queued
+ * @param rate Controller
+ * @param cls Message class
+ * @param pixel_bytes Image bytes processed at the chosen scale, 0 for reliable messages
+ * @param sent_bytes Payload bytes queued
+ * @param elapsed_us Time of the send call
+ */
+void stream_rate_record(stream_rate_t *rate, stream_rate_class_t cls, uint32_t pixel_bytes,
+                        uint32_t sent_bytes, uint32_t elapsed_us);
+
+/**
+ * @brief Count an image that was decided but not queued (queue full)
+ * @param rate Controller
+ * @param cls Message class
+ */
+void stream_rate_record_drop(stream_rate_t *rate, stream_rate_class_t cls);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STREAM_RATE_H */
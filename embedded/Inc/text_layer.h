@@ -0,0 +1,220 @@
+/**
+ ******************************************************************************
+ * @file    text_layer.h
+ * @author  PeleAB
+ * @brief   Cached overlay text drawn from a pre-rendered glyph atlas
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef TEXT_LAYER_H
+#define TEXT_LAYER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "fonts.h"
+#include "gfx2d.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* TEXT LAYER CONSTANTS                                                      */
+/* ========================================================================= */
+#define TEXT_LAYER_FIRST_CHAR           ' '     /**< First glyph of the fonts */
+#define TEXT_LAYER_GLYPH_COUNT          95      /**< ' ' to '~' */
+#define TEXT_LAYER_MAX_SLOTS            16      /**< Independent strings per buffer */
+#define TEXT_LAYER_MAX_CHARS            47      /**< Longest string kept per slot */
+#define TEXT_LAYER_BUFFER_COUNT         2       /**< Overlay back buffers */
+
+/* ========================================================================= */
+/* TEXT LAYER TYPES                                                          */
+/* ========================================================================= */
+
+/**
+ * @brief Glyphs of one font and color pair in ARGB4444
+ *
+ * Glyph g occupies glyph_width x glyph_height pixels starting at
+ * pixels + g * glyph_width * glyph_height.
+ */
+typedef struct {
+    uint16_t *pixels;
+    uint16_t glyph_width;
+    uint16_t glyph_height;
+} text_atlas_t;
+
+/**
+ * @brief String last drawn in a slot of one buffer
+ */
+typedef struct {
+    char text[TEXT_LAYER_MAX_CHARS + 1];
+    const text_atlas_t *atlas;
+    int32_t x;                          /**< Requested position */
+    int32_t y;
+    uint16_t x0;                        /**< Pixels covered, x1/y1 exclusive; empty if x0 == x1 */
+    uint16_t y0;
+    uint16_t x1;
+    uint16_t y1;
+    bool intact;                        /**< Pixels on screen still match text */
+    bool printed;                       /**< Printed since the buffer was started */
+} text_slot_t;
+
+/**
+ * @brief Drawing statistics
+ */
+typedef struct {
+    uint32_t prints;                    /**< text_layer_print() calls */
+    uint32_t redraws;                   /**< Prints that had to draw */
+    uint32_t glyphs;                    /**< Glyphs copied */
+    uint32_t erases;                    /**< Stale extents cleared */
+} text_layer_stats_t;
+
+/**
+ * @brief Text layer state
+ */
+typedef struct {
+    text_slot_t slots[TEXT_LAYER_BUFFER_COUNT][TEXT_LAYER_MAX_SLOTS];
+    uint32_t active;                    /**< Buffer being drawn */
+    gfx2d_surface_t surface;            /**< Its pixels (ARGB4444) */
+    text_layer_stats_t stats;
+} text_layer_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Bytes of storage needed by an atlas of a font
+ * @param font Bitmap font
+ * @return Size in bytes
+ */
+size_t text_atlas_size(const sFONT *font);
+
+/**
+ * @brief Render every glyph of a font into an atlas
+ *
+ * Set bits get fg, clear bits bg, as UTIL_LCD_DisplayChar() draws them; the
+ * colors are truncated to ARGB4444 the same way.
+ *
+ * @param atlas Atlas
+ * @param font Bitmap font (1 bit per pixel, rows padded to bytes, MSB first)
+ * @param fg_argb8888 Text color
+ * @param bg_argb8888 Background color
+ * @param storage At least text_atlas_size(font) bytes, 2-byte aligned
+ * @param size Size of storage
+ * @return 0 on success, negative on error
+ */
+int text_atlas_init(text_atlas_t *atlas, const sFONT *font, uint32_t fg_argb8888, uint32_t bg_argb8888,
+                    void *storage, size_t size);
+
+/**
+ * @brief Copy a string from an atlas, without caching
+ *
+ * Glyphs that do not fit horizontally are skipped, rows are clipped.
+ * Characters outside the atlas are drawn as spaces.
+ *
+ * @param atlas Atlas
+ * @param dst Destination (ARGB4444)
+ * @param x Left edge
+ * @param y Top edge
+ * @param text String
+ * @return Number of glyphs drawn
+ */
+uint32_t text_layer_draw(const text_atlas_t *atlas, const gfx2d_surface_t *dst, int32_t x, int32_t y,
+                         const char *text);
+
+/**
+ * @brief Initialize a text layer; every slot starts empty
+ * @param layer Text layer
+ */
+void text_layer_init(text_layer_t *layer);
+
+/**
+ * @brief Start drawing into a buffer
+ * @param layer Text layer
+ * @param buffer Buffer index (0..TEXT_LAYER_BUFFER_COUNT-1)
+ * @param surface Buffer pixels (ARGB4444)
+ * @return 0 on success, negative on error
+ */
+int text_layer_begin_frame(text_layer_t *layer, uint32_t buffer, const gfx2d_surface_t *surface);
+
+/**
+ * @brief Report pixels of the active buffer overwritten outside the layer
+ *
+ * Slots overlapping the region are redrawn by their next print.
+ *
+ * @param layer Text layer
+ * @param x0 Left edge
+ * @param y0 Top edge
+ * @param x1 Right edge, exclusive
+ * @param y1 Bottom edge, exclusive
+ */
+void text_layer_damage(text_layer_t *layer, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+
+/**
+ * @brief Show a string in a slot of the active buffer
+ *
+ * Nothing is drawn if the buffer already shows the same string with the same
+ * atlas at the same place. Otherwise the previous extents of the slot are
+ * cleared to transparent and the string is drawn.
+ *
+ * @param layer Text layer
+ * @param slot Slot index (0..TEXT_LAYER_MAX_SLOTS-1)
+ * @param atlas Atlas
+ * @param x Left edge
+ * @param y Top edge
+ * @param text String, truncated to TEXT_LAYER_MAX_CHARS
+ * @return 1 if drawn, 0 if unchanged, negative on error
+ */
+int text_layer_print(text_layer_t *layer, uint32_t slot, const text_atlas_t *atlas, int32_t x, int32_t y,
+                     const char *text);
+
+/**
+ * @brief Finish the active buffer: clear slots not printed since it was started
+ * @param layer Text layer
+ */
+void text_layer_end_frame(text_layer_t *layer);
+
+/**
+ * @brief Get the drawing statistics
+ * @param layer Text layer
+ * @param stats Receives the statistics
+ */
+void text_layer_get_stats(const text_layer_t *layer, text_layer_stats_t *stats);
+
+/**
+ * @brief Format an unsigned integer in decimal
+ * @param out Receives the digits and a terminating NUL (at least 11 bytes)
+ * @param value Value
+ * @return Number of characters written, NUL excluded
+ */
+uint32_t text_format_u32(char *out, uint32_t value);
+
+/**
+ * @brief Format a number with a fixed number of decimals, rounded half up
+ *
+ * Replaces snprintf("%.*f") for the small values shown on screen.
+ *
+ * @param out Receives the text and a terminating NUL (at least 16 bytes)
+ * @param value Value, |value| < 4e9 / 10^decimals
+ * @param decimals Digits after the point (0..3)
+ * @return Number of characters written, NUL excluded
+ */
+uint32_t text_format_fixed(char *out, float value, uint32_t decimals);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEXT_LAYER_H */
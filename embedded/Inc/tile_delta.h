@@ -0,0 +1,227 @@
+/**
+ ******************************************************************************
+ * @file    tile_delta.h
+ * @author  PeleAB
+ * @brief   Tile delta coding of streamed frames against the host's copy
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef TILE_DELTA_H
+#define TILE_DELTA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* CODING CONSTANTS                                                          */
+/* ========================================================================= */
+#define TILE_DELTA_TILE_SIZE            16      /**< Tile side in pixels */
+#define TILE_DELTA_MAX_TILES            2048    /**< 800x480 is 1500 tiles */
+#define TILE_DELTA_MAX_BPP              4
+#define TILE_DELTA_TILE_BYTES           (TILE_DELTA_TILE_SIZE * TILE_DELTA_TILE_SIZE * TILE_DELTA_MAX_BPP)
+#define TILE_DELTA_FLAG_KEYFRAME        0x01    /**< Every tile follows, no reference needed */
+
+#define TILE_DELTA_DEFAULT_SAD          8       /**< Mean pixel difference of a changed tile */
+#define TILE_DELTA_DEFAULT_PIXEL        48      /**< Pixel difference that changes a tile alone */
+#define TILE_DELTA_DEFAULT_KEYFRAME     50      /**< Frames between keyframes */
+
+/* ========================================================================= */
+/* CODING TYPES                                                              */
+/* ========================================================================= */
+
+/**
+ * @brief Delta message payload header
+ *
+ * Followed by tile_count tiles, each a little-endian u16 tile index (row
+ * major, tiles_x = ceil(width / tile_size)) then its pixels row by row,
+ * clipped at the right and bottom edges. The first 12 bytes match
+ * robust_frame_data_t.
+ */
+typedef struct __attribute__((packed)) {
+    char frame_type[4];
+    uint32_t width;
+    uint32_t height;
+    uint8_t bpp;
+    uint8_t flags;
+    uint8_t tile_size;
+    uint8_t reserved;
+    uint16_t frame_id;                  /**< Id of the frame once decoded */
+    uint16_t base_id;                   /**< Frame the tiles are applied to */
+    uint32_t tile_count;
+} tile_delta_header_t;
+
+/**
+ * @brief Frame to code, sampled from a larger source buffer
+ *
+ * Pixel (x, y) is at pixels + y * stride + x * step * bpp.
+ */
+typedef struct {
+    const uint8_t *pixels;
+    uint32_t width;
+    uint32_t height;
+    uint32_t bpp;                       /**< 1 gray, 2 RGB565, 3 RGB888, 4 */
+    uint32_t stride;                    /**< Bytes between sampled rows */
+    uint32_t step;                      /**< Source pixels between sampled pixels */
+} tile_delta_frame_t;
+
+/**
+ * @brief Coding tuning
+ *
+ * Pixel differences are the largest channel difference in 8-bit units.
+ * A tile left out of a delta differs from the frame by at most
+ * pixel_threshold on any pixel and sad_threshold on average.
+ */
+typedef struct {
+    uint32_t sad_threshold;             /**< Mean pixel difference that resends a tile */
+    uint32_t pixel_threshold;           /**< Single pixel difference that resends a tile */
+    uint32_t keyframe_interval;         /**< Frames between keyframes, 0 for none */
+} tile_delta_config_t;
+
+/**
+ * @brief Coding statistics
+ */
+typedef struct {
+    uint32_t frames;                    /**< Frames committed */
+    uint32_t keyframes;
+    uint32_t tiles_sent;
+    uint32_t tiles_total;               /**< Tiles of the frames committed */
+} tile_delta_stats_t;
+
+/**
+ * @brief Encoder state: the frame the host holds and the tiles planned
+ */
+typedef struct {
+    tile_delta_config_t config;
+    uint8_t *reference;                 /**< Host copy, packed rows */
+    uint32_t capacity;
+    uint32_t width;
+    uint32_t height;
+    uint32_t bpp;
+    uint32_t tiles_x;
+    uint32_t tiles_y;
+    bool valid;                         /**< reference matches what the host holds */
+    bool keyframe_requested;
+    bool keyframe;                      /**< Planned frame is a keyframe */
+    uint16_t frame_id;                  /**< Id of the reference */
+    uint32_t frames_since_keyframe;
+    uint32_t changed_count;
+    uint16_t changed[TILE_DELTA_MAX_TILES]; /**< Planned tiles */
+    tile_delta_stats_t stats;
+} tile_delta_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Fill a configuration with the defaults
+ * @param config Configuration
+ */
+void tile_delta_default_config(tile_delta_config_t *config);
+
+/**
+ * @brief Initialize an encoder; the first frame is a keyframe
+ * @param delta Encoder
+ * @param config Tuning, NULL for the defaults
+ * @param reference Buffer for the host copy of the frame
+ * @param capacity Size of reference in bytes
+ * @return 0 on success, negative on error
+ */
+int tile_delta_init(tile_delta_t *delta, const tile_delta_config_t *config,
+                    uint8_t *reference, uint32_t capacity);
+
+/**
+ * @brief Choose the tiles of a frame to send
+ *
+ * A keyframe is planned for the first frame, after a size or format change,
+ * every keyframe_interval frames and on request.
+ *
+ * @param delta Encoder
+ * @param frame Frame
+ * @return Number of tiles planned, -1 if the frame cannot be delta coded
+ *         (too large for the reference or unsupported format)
+ */
+int tile_delta_plan(tile_delta_t *delta, const tile_delta_frame_t *frame);
+
+/**
+ * @brief Payload size of the planned message
+ * @param delta Encoder
+ * @return Bytes, header included
+ */
+uint32_t tile_delta_payload_size(const tile_delta_t *delta);
+
+/**
+ * @brief Header of the planned message
+ * @param delta Encoder
+ * @param tag Frame type tag (3 characters)
+ * @param header Receives the header
+ */
+void tile_delta_get_header(const tile_delta_t *delta, const char *tag, tile_delta_header_t *header);
+
+/**
+ * @brief Pixels of a tile, packed row by row
+ * @param delta Encoder
+ * @param frame Frame being sent
+ * @param tile Tile index
+ * @param out Receives up to TILE_DELTA_TILE_BYTES bytes
+ * @return Number of bytes written
+ */
+uint32_t tile_delta_copy_tile(const tile_delta_t *delta, const tile_delta_frame_t *frame,
+                              uint32_t tile, uint8_t *out);
+
+/**
+ * @brief Record that the planned message reached the link
+ *
+ * Until then the reference keeps the previous frame, so a message that is
+ * dropped leaves the encoder in step with the host.
+ *
+ * @param delta Encoder
+ * @param frame Frame that was sent
+ */
+void tile_delta_commit(tile_delta_t *delta, const tile_delta_frame_t *frame);
+
+/**
+ * @brief Make the next planned frame a keyframe
+ * @param delta Encoder
+ */
+void tile_delta_request_keyframe(tile_delta_t *delta);
+
+/**
+ * @brief Apply a delta message to a decoded frame (host side of the coding)
+ * @param image Decoded frame, packed rows, updated in place
+ * @param capacity Size of image in bytes
+ * @param image_id Id of the frame in image, updated
+ * @param payload Message payload
+ * @param size Payload size
+ * @return 0 on success, -1 if the payload is malformed, -2 if image does not
+ *         hold the frame the delta applies to
+ */
+int tile_delta_apply(uint8_t *image, uint32_t capacity, uint16_t *image_id,
+                     const uint8_t *payload, uint32_t size);
+
+/**
+ * @brief Get coding statistics
+ * @param delta Encoder
+ * @param stats Receives the statistics
+ */
+void tile_delta_get_stats(const tile_delta_t *delta, tile_delta_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TILE_DELTA_H */
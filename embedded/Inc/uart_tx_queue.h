@@ -0,0 +1,197 @@
+/**
+ ******************************************************************************
+ * @file    uart_tx_queue.h
+ * @author  PeleAB
+ * @brief   Asynchronous packet transmit queue for the PC stream UART
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef UART_TX_QUEUE_H
+#define UART_TX_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================= */
+/* QUEUE CONSTANTS                                                           */
+/* ========================================================================= */
+#define UART_TX_QUEUE_DEPTH             16      /**< Packet descriptors, power of two */
+#define UART_TX_RELIABLE_SLOTS          4       /**< Descriptors droppable packets cannot take */
+#define UART_TX_MAX_HEAD                20      /**< Header bytes stored in a descriptor */
+#define UART_TX_MAX_TAIL                4       /**< Trailer (CRC) bytes stored in a descriptor */
+#define UART_TX_MAX_CHUNK               0xFFFFU /**< Longest single transfer (16-bit DMA count) */
+
+/* ========================================================================= */
+/* QUEUE TYPES                                                               */
+/* ========================================================================= */
+
+/**
+ * @brief What happens to a packet when the queue is full
+ */
+typedef enum {
+    UART_TX_DROPPABLE = 0,              /**< Refused at once (video frames) */
+    UART_TX_RELIABLE,                   /**< Waits for room (metrics, control) */
+} uart_tx_class_t;
+
+/**
+ * @brief Transmitter driven by the queue
+ *
+ * start() begins sending size bytes and returns at once; the driver calls
+ * uart_tx_queue_on_complete() (usually from its interrupt) when they are out.
+ */
+typedef struct {
+    int (*start)(void *ctx, const uint8_t *data, uint32_t size);    /**< 0 on success */
+    void (*poll)(void *ctx);            /**< Run while waiting for room, NULL if interrupt driven */
+    void *ctx;
+} uart_tx_port_t;
+
+/**
+ * @brief Queued packet: header, payload and trailer sent back to back
+ */
+typedef struct {
+    uint8_t head[UART_TX_MAX_HEAD];
+    uint8_t tail[UART_TX_MAX_TAIL];
+    uint8_t head_size;
+    uint8_t tail_size;
+    uint8_t segment;                    /**< Segment being sent: head, payload, tail */
+    const uint8_t *payload;
+    uint32_t payload_size;
+    uint32_t sent;                      /**< Bytes of the current segment already sent */
+    uint32_t arena_end;                 /**< Arena offset released when the packet is out */
+} uart_tx_packet_t;
+
+/**
+ * @brief Queue statistics
+ */
+typedef struct {
+    uint32_t packets_queued;
+    uint32_t packets_sent;
+    uint32_t bytes_sent;
+    uint32_t packets_dropped;           /**< Droppable packets refused for lack of room */
+    uint32_t reliable_waits;            /**< Reliable packets that had to wait for room */
+    uint32_t reliable_failures;         /**< Reliable packets refused (too large, timeout) */
+    uint32_t errors;                    /**< Transfers the transmitter failed */
+    uint32_t depth;                     /**< Packets queued or in flight */
+    uint32_t max_depth;                 /**< Highest depth seen */
+    uint32_t bytes_pending;             /**< Wire bytes queued or in flight */
+} uart_tx_stats_t;
+
+/**
+ * @brief Queue state
+ */
+typedef struct {
+    uart_tx_port_t port;
+    uint8_t *arena;                     /**< Payload storage, used as a ring */
+    uint32_t arena_size;
+    uint32_t arena_reserve;             /**< Arena bytes droppable packets leave free */
+    uint32_t arena_rd;                  /**< Start of the oldest live payload */
+    uint32_t arena_wr;                  /**< End of the newest payload */
+    uint32_t arena_live;                /**< Payloads in the arena, reservation included */
+    uint8_t *reserved;                  /**< Payload handed out, not committed yet */
+    uint32_t reserved_size;
+    uint32_t reserved_prev_wr;          /**< arena_wr before the reservation */
+    uart_tx_packet_t packets[UART_TX_QUEUE_DEPTH];
+    volatile uint32_t head;             /**< Next descriptor to fill */
+    volatile uint32_t tail;             /**< Descriptor being sent */
+    volatile bool busy;                 /**< A transfer is in flight */
+    uint32_t in_flight;                 /**< Bytes of the transfer in flight */
+    uint32_t timeout_cycles;            /**< Longest wait for room, perf_monitor ticks */
+    uart_tx_stats_t stats;
+} uart_tx_queue_t;
+
+/* ========================================================================= */
+/* FUNCTION PROTOTYPES                                                       */
+/* ========================================================================= */
+
+/**
+ * @brief Initialize an empty queue
+ * @param queue Queue
+ * @param port Transmitter
+ * @param arena Payload storage, word aligned, must stay valid while the queue is used
+ * @param arena_size Size of arena in bytes
+ * @param reserve Arena bytes kept for reliable packets
+ * @param wait_us Longest wait of a reliable packet for room
+ * @return 0 on success, negative on error
+ */
+int uart_tx_queue_init(uart_tx_queue_t *queue, const uart_tx_port_t *port, uint8_t *arena,
+                       uint32_t arena_size, uint32_t reserve, uint32_t wait_us);
+
+/**
+ * @brief Reserve payload storage for the next packet
+ *
+ * The caller writes the payload in place, then calls uart_tx_queue_commit().
+ * Only one reservation can be open at a time, from a single thread.
+ *
+ * @param queue Queue
+ * @param size Payload size in bytes (may be 0)
+ * @param packet_class Back-pressure class
+ * @return Word aligned payload storage, or NULL if the packet is refused
+ */
+uint8_t *uart_tx_queue_reserve(uart_tx_queue_t *queue, uint32_t size, uart_tx_class_t packet_class);
+
+/**
+ * @brief Queue the reserved payload between a header and a trailer
+ * @param queue Queue
+ * @param head Header bytes (at most UART_TX_MAX_HEAD)
+ * @param head_size Header size
+ * @param tail Trailer bytes (at most UART_TX_MAX_TAIL)
+ * @param tail_size Trailer size
+ * @return 0 on success, negative on error (the reservation is released)
+ */
+int uart_tx_queue_commit(uart_tx_queue_t *queue, const uint8_t *head, uint32_t head_size,
+                         const uint8_t *tail, uint32_t tail_size);
+
+/**
+ * @brief Drop the open reservation
+ * @param queue Queue
+ */
+void uart_tx_queue_cancel(uart_tx_queue_t *queue);
+
+/**
+ * @brief Transfer done: start the next segment or packet
+ *
+ * Called by the transmitter driver, usually from its completion interrupt.
+ *
+ * @param queue Queue
+ */
+void uart_tx_queue_on_complete(uart_tx_queue_t *queue);
+
+/**
+ * @brief Transfer failed: abandon the packet and go on with the next one
+ * @param queue Queue
+ */
+void uart_tx_queue_on_error(uart_tx_queue_t *queue);
+
+/**
+ * @brief Check whether every queued packet has been sent
+ * @param queue Queue
+ * @return true when nothing is queued or in flight
+ */
+bool uart_tx_queue_idle(const uart_tx_queue_t *queue);
+
+/**
+ * @brief Get the queue statistics
+ * @param queue Queue
+ * @param stats Receives the statistics
+ */
+void uart_tx_queue_get_stats(const uart_tx_queue_t *queue, uart_tx_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UART_TX_QUEUE_H */
@@ -548,6 +548,36 @@ static void __LL_LIB_Inputs_Batched_Memcpy_End_EpochBlock(const void *epoch_bloc
   }
 }
 
+static void __LL_LIB_Concat_DepthToSpace_End_EpochBlock(const void *epoch_block)
+{
+  __ll_lib_params_t *params = __ll_lib_get_params();
+
+  if (__ll_lib_set_wait_mask((LL_ATON_RT_EpochBlockItem_t *)epoch_block, 0))
+  {
+    __ll_lib_stop_transfer();
+  }
+
+  params->g_idx++;
+
+  if (params->g_idx < params->g_num_tensors)
+  {
+    /* only the start of the output window moves, to the next position inside each block */
+    ll_dma_stream_geometry geo;
+    int ret = ll_dma_concat_d2s_geometry(&params->special.concat_d2s.shape, params->g_idx, &geo);
+    LL_ATON_ASSERT(ret == 0); // must be checked before
+    LL_ATON_LIB_UNUSED(ret);
+
+    params->g_dst_o_src = params->special.concat_d2s.out_base + geo.offset_start;
+
+    /* loop back one epoch block */
+    LL_ATON_RT_DecCurrEpochBlock(1);
+  }
+  else
+  {
+    /* proceed to next epoch block */
+  }
+}
+
 static void __LL_LIB_Outputs_Channel_Split_Aton_Start_EpochBlock(const void *epoch_block)
 {
   __ll_lib_params_t *params = __ll_lib_get_params();
@@ -1183,6 +1213,20 @@ static LL_ATON_RT_EpochBlockItem_t _slice_split_like_epoch_block_array[] = {
     {.flags = EpochBlock_Flags_last_eb},
 };
 
+static LL_ATON_RT_EpochBlockItem_t _concat_d2s_epoch_block_array[] = {
+    // REMEMBER: static variables are not suited for multithreaded etc. environments
+    {
+        .start_epoch_block = __LL_LIB_Inputs_Batched_Memcpy_Start_EpochBlock,
+        .end_epoch_block = __LL_LIB_Concat_DepthToSpace_End_EpochBlock,
+        .flags = EpochBlock_Flags_internal,
+#ifdef LL_ATON_EB_DBG_INFO
+        .epoch_num = -12,
+        .last_epoch_num = -12,
+#endif
+    },
+    {.flags = EpochBlock_Flags_last_eb},
+};
+
 /**
  * @brief  performs a memory copy operation from `ninputs` inputs to one output using stream engines `dma_in` and
  * `dma_out`
@@ -1850,6 +1894,126 @@ int LL_ATON_LIB_DMA_DepthToSpace(const LL_LIB_TensorInfo_TypeDef *inputs, unsign
                                     dma_out);
 }
 
+/**
+ * @brief  performs a channel Concat of `blocksize_h * blocksize_w` inputs followed by a DCR DepthToSpace as a single
+ * transfer per input using stream engines `dma_in` and `dma_out`
+ * @param  list of input tensor info structures (the Concat inputs, in order)
+ * @param  number of inputs
+ * @param  output tensor info structures (the DepthToSpace output)
+ * @param  blocksize_h vertical dimension for the blocksize
+ * @param  blocksize_w horizontal dimension for the blocksize
+ *
+ * @note   Supports only equally shaped input tensors in ATON canonical format
+ *
+ * @note   An input may lie inside the output only if each of its elements is read before being overwritten
+ *
+ * @note   Each input is read sequentially and written into its own position of every output block
+ *         (see `ll_dma_concat_d2s_geometry()`), so the concatenated tensor is never materialized
+ *
+ * @note   Bit-sizes are rounded up to multiples of 8-bits
+ *
+ */
+int LL_ATON_LIB_DMA_Concat_DepthToSpace(const LL_LIB_TensorInfo_TypeDef *inputs, unsigned int ninputs,
+                                        const LL_LIB_TensorInfo_TypeDef *output, unsigned blocksize_h,
+                                        unsigned blocksize_w, int dma_in, int dma_out)
+{
+  if ((ninputs == 0) || (ninputs != blocksize_h * blocksize_w))
+    __LL_LIB_ERROR(_ERR_NINPUTS, LL_ATON_INVALID_PARAM);
+
+  if ((inputs[0].ndims != 4) || (output->ndims != 4))
+    __LL_LIB_ERROR(_ERR_SHAPE, LL_ATON_INVALID_PARAM);
+
+  int nbits = inputs[0].nbits;
+  int nbytes = (nbits + 7) >> 3;
+
+  if (nbits & 0x7)
+    __LL_LIB_ERROR(_ERR_FRACTIONAL, LL_ATON_INVALID_PARAM);
+
+  if (nbits != output->nbits)
+    __LL_LIB_ERROR(_ERR_NBITS, LL_ATON_INVALID_PARAM);
+
+  for (int i = 0; i < ninputs; i++)
+  {
+    if (inputs[i].ndims != 4 || inputs[i].nbits != nbits ||
+        inputs[i].batch != inputs[i].shape[TDIM_NCHANNELS]) // canonical format only
+      __LL_LIB_ERROR(_ERR_SHAPE_IN, LL_ATON_INVALID_PARAM);
+
+    for (int k = 0; k < 4; k++)
+    {
+      if (inputs[i].shape[k] != inputs[0].shape[k])
+        __LL_LIB_ERROR(_ERR_SHAPE_IN, LL_ATON_INVALID_PARAM);
+    }
+  }
+
+  ll_dma_concat_d2s_shape shape = {
+      .batches = inputs[0].shape[TDIM_NKERNELS],
+      .height = inputs[0].shape[TDIM_FHEIGHT],
+      .width = inputs[0].shape[TDIM_FWIDTH],
+      .channels = inputs[0].shape[TDIM_NCHANNELS],
+      .nbytes = nbytes,
+      .blocksize_h = blocksize_h,
+      .blocksize_w = blocksize_w,
+  };
+
+  if ((output->batch != output->shape[TDIM_NCHANNELS]) || (output->shape[TDIM_NKERNELS] != shape.batches) ||
+      (output->shape[TDIM_FHEIGHT] != shape.height * blocksize_h) ||
+      (output->shape[TDIM_FWIDTH] != shape.width * blocksize_w) || (output->shape[TDIM_NCHANNELS] != shape.channels))
+    __LL_LIB_ERROR(_ERR_SHAPE_OUT, LL_ATON_INVALID_PARAM);
+
+  ll_dma_stream_geometry geo;
+  if (ll_dma_concat_d2s_geometry(&shape, 0, &geo) != 0)
+    __LL_LIB_ERROR(_ERR_SHAPE, LL_ATON_INVALID_PARAM);
+
+  /* the input DMA goes just sequential with non batched input */
+  LL_Streng_TensorInitTypeDef _dma_in = {
+      .dir = 0, // input
+      .raw = 1,
+      .frame_tot_cnt = 1,
+      .nbits_in = (nbytes == 4) ? 16 : (nbytes * 8),
+      .nbits_out = (nbytes == 4) ? 16 : (nbytes * 8),
+      .nbits_unsigned = inputs[0].Qunsigned,
+  };
+
+  /* this DMA scatters one input pixel into each output block, at the input's position inside the block */
+  LL_Streng_TensorInitTypeDef _dma_out = {
+      .dir = 1, // output
+      .raw = 0,
+      .nbits_in = (nbytes == 4) ? 16 : (nbytes * 8),
+      .nbits_out = (nbytes == 4) ? 16 : (nbytes * 8),
+      .nbits_unsigned = inputs[0].Qunsigned,
+
+      .fwidth = geo.fwidth,
+      .batch_depth = geo.batch_depth,
+      .batch_offset = geo.batch_offset,
+
+      .fheight = geo.fheight,
+      .line_offset = geo.line_offset,
+
+      .frame_loop_cnt = geo.frame_loop_cnt,
+      .frame_offset = geo.frame_offset,
+
+      .frame_tot_cnt = geo.frame_tot_cnt,
+      .loop_offset = geo.loop_offset,
+  };
+
+  unsigned char *out_base = (unsigned char *)LL_Buffer_addr_start(output);
+
+  /* prepare epoch */
+  __ll_lib_prepare_inputs_epoch(inputs, ninputs, &_dma_in, &_dma_out, out_base + geo.offset_start, -1);
+
+  __ll_lib_params_t *params = __ll_lib_get_params();
+  params->special.concat_d2s.out_base = out_base;
+  params->special.concat_d2s.shape = shape;
+
+  /* configure stream switch */
+  __ll_lib_strswitch_set_dmas(dma_in, dma_out, _concat_d2s_epoch_block_array);
+
+  /* start epoch block sequence */
+  LL_ATON_RT_Insert_LibEpochBlockArray(_concat_d2s_epoch_block_array);
+
+  return LL_ATON_OK;
+}
+
 int LL_ATON_LIB_DMA_Transpose(const LL_LIB_TensorShape_TypeDef *input, const uint32_t *input_axes_offsets,
                               const LL_LIB_TensorShape_TypeDef *output, const uint32_t *output_axes_offsets,
                               const uint8_t *target_pos, const uint8_t *perm_to_use, int dma_in, int dma_out)
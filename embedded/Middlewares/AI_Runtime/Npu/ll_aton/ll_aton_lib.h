@@ -28,6 +28,7 @@ extern "C"
 #include "ll_aton_NN_interface.h"
 #include "ll_aton_caches_interface.h"
 #include "ll_aton_lib_sw_operators.h"
+#include "ll_dma_concat_d2s.h"
 
 #ifndef _LL_LIB_DEBUG
 #define _LL_LIB_DEBUG 1
@@ -182,6 +183,12 @@ int LL_LIB_TENSOR_ELEMENTS(const LL_LIB_TensorInfo_TypeDef *t);
         unsigned int out_line_size;
         unsigned char *in_curr;
       } concat_case3;
+      /* Concat_DepthToSpace */
+      struct
+      {
+        unsigned char *out_base;
+        ll_dma_concat_d2s_shape shape;
+      } concat_d2s;
       /* Pad */
       __ll_pad_sw_params_t pad;
     } special;
@@ -328,6 +335,33 @@ int LL_LIB_TENSOR_ELEMENTS(const LL_LIB_TensorInfo_TypeDef *t);
    *  * @}
    *   */
 
+  /**
+   * @brief  performs a channel Concat of `blocksize_h * blocksize_w` inputs followed by a DCR DepthToSpace as a single
+   * transfer per input using stream engines `dma_in` and `dma_out`
+   * @param  list of input tensor info structures (the Concat inputs, in order)
+   * @param  number of inputs
+   * @param  output tensor info structures (the DepthToSpace output)
+   * @param  blocksize_h vertical dimension for the blocksize
+   * @param  blocksize_w horizontal dimension for the blocksize
+   *
+   * @note   Supports only equally shaped input tensors in ATON canonical format
+   *
+   * @note   An input may lie inside the output only if each of its elements is read before being overwritten
+   *
+   * @note   The concatenated intermediate tensor is never written
+   *
+   */
+  /** @defgroup LL_ATON_LIB_DMA_Concat_DepthToSpace function
+   *  * @{
+   *   */
+
+  int LL_ATON_LIB_DMA_Concat_DepthToSpace(const LL_LIB_TensorInfo_TypeDef *, unsigned int,
+                                          const LL_LIB_TensorInfo_TypeDef *, unsigned, unsigned, int, int);
+
+  /**
+   *  * @}
+   *   */
+
   /**
    * @brief  performs a cast operation to/from Qmn and float
    * @param  input tensor info structure
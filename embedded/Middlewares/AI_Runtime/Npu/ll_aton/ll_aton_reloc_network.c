@@ -385,7 +385,7 @@ static int _ai_reloc_rt_checking(const struct ai_reloc_bin_hdr *bin)
     return AI_RELOC_RT_ERR_INVALID_BIN;
   }
 
-  if ((AI_RELOC_RT_GET_MAJOR(flags) != AI_RELOC_RT_VERSION_MAJOR) &&
+  if ((AI_RELOC_RT_GET_MAJOR(flags) != AI_RELOC_RT_VERSION_MAJOR) ||
       (AI_RELOC_RT_GET_MINOR(flags) != AI_RELOC_RT_VERSION_MINOR))
   {
     AI_RELOC_LOG("AI RELOC ERROR: Binary header - invalid version\r\n");
@@ -452,7 +452,8 @@ static int _ai_reloc_rt_checking(const struct ai_reloc_bin_hdr *bin)
 
   /* Runtime version */
   struct ai_reloc_rt_ctx *rt_ctx =
-      (struct ai_reloc_rt_ctx *)AI_RELOC_GET_ADDR(bin + AI_RELOC_GET_OFFSET(bin->sect.data_data), bin->vec.ctx);
+      (struct ai_reloc_rt_ctx *)AI_RELOC_GET_ADDR((uintptr_t)bin + AI_RELOC_GET_OFFSET(bin->sect.data_data),
+                                                  bin->vec.ctx);
 
   uint32_t rt_vers_ = LL_ATON_VERSION_MAJOR << 24 | LL_ATON_VERSION_MINOR << 16 | LL_ATON_VERSION_MICRO << 8;
 
@@ -489,7 +490,7 @@ static int _ai_reloc_prepare_mpools(const uintptr_t file_ptr, struct id_mpool_ma
   ll_aton_reloc_mem_pool_desc *cur_mem_c_desc;
 
   /* Set/check base param addr - user addr is used in priority */
-  if ((id_map->addr_0 == NULL) && (header->sect.params_offset == 0))
+  if ((id_map->addr_0 == 0) && (header->sect.params_offset == 0))
     return AI_RELOC_RT_ERR_PARAM_ADDR;
 
   if (id_map->addr_0 == 0)
@@ -850,7 +851,8 @@ int ll_aton_reloc_get_info(const uintptr_t file_ptr, ll_aton_reloc_info *rt)
   }
 
   struct ai_reloc_rt_ctx *rt_ctx =
-      (struct ai_reloc_rt_ctx *)AI_RELOC_GET_ADDR(bin + AI_RELOC_GET_OFFSET(bin->sect.data_data), bin->vec.ctx);
+      (struct ai_reloc_rt_ctx *)AI_RELOC_GET_ADDR((uintptr_t)bin + AI_RELOC_GET_OFFSET(bin->sect.data_data),
+                                                  bin->vec.ctx);
 
   rt->c_name = (const char *)AI_RELOC_GET_ADDR(bin, AI_RELOC_GET_OFFSET((int)rt_ctx->c_name));
   rt->variant = (uint32_t)bin->hdr.flags;
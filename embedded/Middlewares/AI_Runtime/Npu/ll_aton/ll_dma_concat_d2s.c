@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * @file    ll_dma_concat_d2s.c
+ * @author  PeleAB
+ * @brief   Stream engine geometry of the fused Concat + DepthToSpace DMA transfer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "ll_dma_concat_d2s.h"
+
+int ll_dma_concat_d2s_geometry(const ll_dma_concat_d2s_shape *shape, uint32_t input, ll_dma_stream_geometry *geo)
+{
+  if (shape == NULL || geo == NULL || shape->batches == 0 || shape->height == 0 || shape->width == 0 ||
+      shape->channels == 0 || shape->blocksize_h == 0 || shape->blocksize_w == 0 ||
+      (shape->nbytes != 1 && shape->nbytes != 2 && shape->nbytes != 4) ||
+      input >= shape->blocksize_h * shape->blocksize_w)
+  {
+    return -1;
+  }
+
+  const uint32_t pixel = shape->channels * shape->nbytes;
+  const uint32_t out_width = shape->width * shape->blocksize_w;
+  const uint32_t out_height = shape->height * shape->blocksize_h;
+  const uint32_t block_row = input / shape->blocksize_w;
+  const uint32_t block_col = input % shape->blocksize_w;
+
+  /* Same 32-bit handling as the other ll_aton_lib DMA helpers */
+  geo->elem_bytes = (shape->nbytes == 4) ? 2 : shape->nbytes;
+  geo->batch_depth = (shape->nbytes == 4) ? (2 * shape->channels) : shape->channels;
+
+  /* One input pixel per output block, one input line per block row, one frame per batch */
+  geo->offset_start = ((block_row * out_width) + block_col) * pixel;
+  geo->fwidth = shape->width;
+  geo->batch_offset = shape->blocksize_w * pixel;
+  geo->fheight = shape->height;
+  geo->line_offset = shape->blocksize_h * out_width * pixel;
+  geo->frame_loop_cnt = 1;
+  geo->frame_offset = 0;
+  geo->frame_tot_cnt = shape->batches;
+  geo->loop_offset = out_height * out_width * pixel;
+  return 0;
+}
+
+uint32_t ll_dma_stream_scatter(const ll_dma_stream_geometry *geo, const void *src, void *dst)
+{
+  const uint8_t *in = (const uint8_t *)src;
+  uint8_t *out = (uint8_t *)dst;
+  uint32_t consumed = 0;
+
+  for (uint32_t f = 0; f < geo->frame_tot_cnt; f++)
+  {
+    const uint32_t frame =
+        geo->offset_start + (f / geo->frame_loop_cnt) * geo->loop_offset + (f % geo->frame_loop_cnt) * geo->frame_offset;
+    for (uint32_t y = 0; y < geo->fheight; y++)
+    {
+      for (uint32_t x = 0; x < geo->fwidth; x++)
+      {
+        uint8_t *pixel = out + frame + y * geo->line_offset + x * geo->batch_offset;
+        const uint32_t n = geo->batch_depth * geo->elem_bytes;
+        memcpy(pixel, in + consumed, n);
+        consumed += n;
+      }
+    }
+  }
+  return consumed;
+}
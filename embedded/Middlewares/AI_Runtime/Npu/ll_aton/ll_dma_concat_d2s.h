@@ -0,0 +1,89 @@
+/**
+ ******************************************************************************
+ * @file    ll_dma_concat_d2s.h
+ * @author  PeleAB
+ * @brief   Stream engine geometry of the fused Concat + DepthToSpace DMA transfer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef __LL_DMA_CONCAT_D2S_H__
+#define __LL_DMA_CONCAT_D2S_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+  /**
+   * @brief Concat of blocksize_h * blocksize_w equally shaped HWC inputs along
+   *        the channels, followed by a DCR DepthToSpace with the same blocksize
+   *
+   * Input k lands on output row h * blocksize_h + k / blocksize_w and column
+   * w * blocksize_w + k % blocksize_w, channels unchanged, so each input can be
+   * streamed sequentially into a strided window of the final output.
+   */
+  typedef struct
+  {
+    uint32_t batches;     /**< N of every input and of the output */
+    uint32_t height;      /**< H of every input */
+    uint32_t width;       /**< W of every input */
+    uint32_t channels;    /**< C of every input and of the output */
+    uint32_t nbytes;      /**< Bytes per element (1, 2 or 4) */
+    uint32_t blocksize_h; /**< DepthToSpace vertical blocksize */
+    uint32_t blocksize_w; /**< DepthToSpace horizontal blocksize */
+  } ll_dma_concat_d2s_shape;
+
+  /**
+   * @brief Output stream engine fields, in bytes, as in LL_Streng_TensorInitTypeDef
+   *
+   * Frame f starts at offset_start + (f / frame_loop_cnt) * loop_offset +
+   * (f % frame_loop_cnt) * frame_offset; inside a frame, line y, pixel x and
+   * element d sit at y * line_offset + x * batch_offset + d * elem_bytes.
+   */
+  typedef struct
+  {
+    uint32_t offset_start;
+    uint32_t fwidth;
+    uint32_t fheight;
+    uint32_t batch_depth; /**< Stream elements per pixel */
+    uint32_t batch_offset;
+    uint32_t line_offset;
+    uint32_t frame_offset;
+    uint32_t frame_loop_cnt;
+    uint32_t frame_tot_cnt;
+    uint32_t loop_offset;
+    uint32_t elem_bytes; /**< Stream element size (32-bit data moves as 16-bit halves) */
+  } ll_dma_stream_geometry;
+
+  /**
+   * @brief Output DMA geometry writing concat input `input` into the DepthToSpace output
+   * @return 0 on success, negative when the shape or the input index is not supported
+   */
+  int ll_dma_concat_d2s_geometry(const ll_dma_concat_d2s_shape *shape, uint32_t input, ll_dma_stream_geometry *geo);
+
+  /**
+   * @brief Host functional model of an output stream engine
+   *
+   * Writes the sequential stream `src` to `dst` following `geo`, one element
+   * at a time, in the order the hardware emits addresses.
+   * @return Number of bytes consumed from `src`
+   */
+  uint32_t ll_dma_stream_scatter(const ll_dma_stream_geometry *geo, const void *src, void *dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
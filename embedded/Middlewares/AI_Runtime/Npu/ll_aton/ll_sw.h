@@ -591,6 +591,17 @@ extern "C"
     Tensor_info ozp;
   } Requantizelinear_sw_info;
 
+  /* DequantizeLinear -> PRelu -> QuantizeLinear collapsed into one integer epoch */
+  typedef struct Prelu_integer_sw_info
+  {
+    General general;
+    Tensor_info is;
+    Tensor_info izp;
+    Tensor_info slope;
+    Tensor_info os;
+    Tensor_info ozp;
+  } Prelu_integer_sw_info;
+
 #ifdef __cplusplus
 }
 #endif
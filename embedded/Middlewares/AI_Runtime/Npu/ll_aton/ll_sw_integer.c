@@ -25,6 +25,8 @@
 
 #include "ll_sw.h"
 #include "ll_sw_integer.h"
+#include "ll_sw_prelu_int8.h"
+#include "ll_sw_quant_int8.h"
 
 #include "ai_datatypes_internal.h"
 #include "ai_math_helpers.h"
@@ -63,6 +65,16 @@ static int helper_emit_shape_index_axis(int onnx_axis)
   }
 }
 
+// true when the tensor is channel-innermost and densely packed (no padding between rows/pixels)
+static bool helper_is_dense_hwc(const Tensor_info *tensor, uint32_t elem_size)
+{
+  const Tensor_dim_info *dim = &tensor->dim;
+  return tensor->stride.c == elem_size && tensor->stride.w == dim->tensor_c * elem_size &&
+         tensor->stride.h == dim->tensor_w * tensor->stride.w &&
+         (dim->tensor_b <= 1 || tensor->stride.b == dim->tensor_h * tensor->stride.h) &&
+         dim->num_elem == dim->tensor_b * dim->tensor_h * dim->tensor_w * dim->tensor_c;
+}
+
 /** QLinearMatMul forward function */
 void ll_sw_forward_qlinearmatmul(/* int processor, */ void *sw_info_struct)
 {
@@ -294,6 +306,24 @@ void ll_sw_forward_quantizelinear(/* int processor, */ void *sw_info_struct)
 {
   Quantizelinear_sw_info *sw_info = (Quantizelinear_sw_info *)sw_info_struct;
 
+  // contiguous fast path: per-tensor or per-channel (innermost axis) parameters, no stride handling
+  const ll_sw_quant_int8_params quant = {
+      .scale = (const float *)sw_info->os.mem.start_offset,
+      .zeropoint = sw_info->ozp.mem.start_offset,
+      .count = sw_info->os.dim.num_elem,
+      .is_signed = sw_info->general.output.format.is_signed,
+  };
+  const uint32_t channels = sw_info->general.output.dim.tensor_c;
+  if (sw_info->ozp.format.is_signed == sw_info->general.output.format.is_signed &&
+      helper_is_dense_hwc(&sw_info->general.input, sizeof(float)) &&
+      helper_is_dense_hwc(&sw_info->general.output, sizeof(int8_t)) &&
+      ll_sw_quantize_int8((const float *)sw_info->general.input.mem.start_offset,
+                          sw_info->general.output.mem.start_offset, sw_info->general.output.dim.num_elem / channels,
+                          channels, &quant) == 0)
+  {
+    return;
+  }
+
   // array init
   AI_ARRAY_OBJ_DECLARE(input_output_array, AI_ARRAY_FORMAT_FLOAT, sw_info->general.input.mem.start_offset,
                        sw_info->general.input.mem.start_offset, sw_info->general.input.dim.num_elem, )
@@ -341,6 +371,24 @@ void ll_sw_forward_dequantizelinear(/* int processor, */ void *sw_info_struct)
 {
   Dequantizelinear_sw_info *sw_info = (Dequantizelinear_sw_info *)sw_info_struct;
 
+  // contiguous fast path: per-tensor or per-channel (innermost axis) parameters, no stride handling
+  const ll_sw_quant_int8_params quant = {
+      .scale = (const float *)sw_info->is.mem.start_offset,
+      .zeropoint = sw_info->izp.mem.start_offset,
+      .count = sw_info->is.dim.num_elem,
+      .is_signed = sw_info->general.input.format.is_signed,
+  };
+  const uint32_t channels = sw_info->general.input.dim.tensor_c;
+  if (sw_info->izp.format.is_signed == sw_info->general.input.format.is_signed &&
+      helper_is_dense_hwc(&sw_info->general.input, sizeof(int8_t)) &&
+      helper_is_dense_hwc(&sw_info->general.output, sizeof(float)) &&
+      ll_sw_dequantize_int8(sw_info->general.input.mem.start_offset,
+                            (float *)sw_info->general.output.mem.start_offset,
+                            sw_info->general.input.dim.num_elem / channels, channels, &quant) == 0)
+  {
+    return;
+  }
+
   // array init
   int32_t format = sw_info->general.input.format.is_signed ? (AI_ARRAY_FORMAT_S8 | AI_FMT_FLAG_IS_IO)
                                                            : (AI_ARRAY_FORMAT_U8 | AI_FMT_FLAG_IS_IO);
@@ -1237,4 +1285,76 @@ void ll_sw_forward_resize_integer(/* int processor, */ void *sw_info_struct)
   }
 }
 
+//##########################################################################################
+/** Fused DequantizeLinear -> PRelu -> QuantizeLinear forward function (int8 -> int8) */
+void ll_sw_forward_prelu_integer(/* int processor, */ void *sw_info_struct)
+{
+  Prelu_integer_sw_info *sw_info = (Prelu_integer_sw_info *)sw_info_struct;
+  static int32_t m_neg[LL_SW_PRELU_INT8_MAX_CHANNELS];
+
+#ifdef LL_SW_ENABLE_ASSERTS
+  LL_ATON_ASSERT(sw_info->general.input.format.is_signed && sw_info->general.output.format.is_signed &&
+                 "fused PRelu supports int8 tensors only");
+#endif
+
+  const float in_scale = *((const float *)sw_info->is.mem.start_offset);
+  const int32_t in_zp = *((const int8_t *)sw_info->izp.mem.start_offset);
+  const float out_scale = *((const float *)sw_info->os.mem.start_offset);
+  const int32_t out_zp = *((const int8_t *)sw_info->ozp.mem.start_offset);
+  const float *slopes = (const float *)sw_info->slope.mem.start_offset;
+  const uint32_t channels = sw_info->general.input.dim.tensor_c;
+  // the generator pads channel-wise slopes to C + 1 elements, slope c at element c
+  const uint32_t slope_count = ll_sw_prelu_int8_slope_count(sw_info->slope.dim.num_elem, channels);
+  const int8_t *input = (const int8_t *)sw_info->general.input.mem.start_offset;
+  int8_t *output = (int8_t *)sw_info->general.output.mem.start_offset;
+
+  // no DQ/PRelu/Q epochs are left to fall back on: a slope operand that matches neither layout is fatal
+  LL_ATON_ASSERT(slope_count != 0 && "fused PRelu slope operand does not match the channels");
+  if (slope_count == 0)
+  {
+    return;
+  }
+
+  ll_sw_prelu_int8_params params;
+  const bool fixed = ll_sw_prelu_int8_prepare(&params, m_neg, in_scale, in_zp, slopes, slope_count, out_scale,
+                                              out_zp, channels) == 0;
+
+  if (helper_is_dense_hwc(&sw_info->general.input, sizeof(int8_t)) &&
+      helper_is_dense_hwc(&sw_info->general.output, sizeof(int8_t)))
+  {
+    const uint32_t pixels = sw_info->general.input.dim.num_elem / channels;
+    if (fixed)
+    {
+      ll_sw_prelu_int8_run(&params, input, output, pixels);
+    }
+    else
+    {
+      ll_sw_prelu_int8_reference(input, output, pixels, channels, in_scale, in_zp, slopes, slope_count, out_scale,
+                                 out_zp);
+    }
+    return;
+  }
+
+  // padded or channel-outer tensors: walk the strides one element at a time
+  const Tensor_info *in = &sw_info->general.input;
+  const Tensor_info *out = &sw_info->general.output;
+  const ll_sw_prelu_int8_layout layout = {
+      .batches = (in->dim.tensor_b > 1) ? in->dim.tensor_b : 1,
+      .height = in->dim.tensor_h,
+      .width = in->dim.tensor_w,
+      .channels = channels,
+      .in = {.b = in->stride.b, .h = in->stride.h, .w = in->stride.w, .c = in->stride.c},
+      .out = {.b = out->stride.b, .h = out->stride.h, .w = out->stride.w, .c = out->stride.c},
+  };
+  if (fixed)
+  {
+    ll_sw_prelu_int8_run_strided(&params, input, output, &layout);
+  }
+  else
+  {
+    ll_sw_prelu_int8_reference_strided(input, output, &layout, in_scale, in_zp, slopes, slope_count, out_scale,
+                                       out_zp);
+  }
+}
+
 #endif // LL_ATON_SW_FALLBACK == 1
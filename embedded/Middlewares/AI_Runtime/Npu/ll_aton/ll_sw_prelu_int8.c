@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @file    ll_sw_prelu_int8.c
+ * @author  PeleAB
+ * @brief   Fused int8 -> int8 PReLU kernel for the ll_aton SW fallback path
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include <stddef.h>
+
+#include "ll_sw_prelu_int8.h"
+
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+#include <arm_mve.h>
+#define LL_SW_PRELU_INT8_MVE 1
+#endif
+
+#define Q_MIN (-128)
+#define Q_MAX 127
+
+static inline int32_t prelu_int8_clamp(int32_t v)
+{
+  return (v < Q_MIN) ? Q_MIN : ((v > Q_MAX) ? Q_MAX : v);
+}
+
+static inline int8_t prelu_int8_fixed(const ll_sw_prelu_int8_params *params, int8_t q, uint32_t c)
+{
+  const int32_t round = (int32_t)1 << (params->shift - 1);
+  const int32_t d = (int32_t)q - params->in_zp;
+  const int32_t m = (d < 0) ? params->m_neg[c] : params->m_pos;
+  return (int8_t)prelu_int8_clamp(((d * m + round) >> params->shift) + params->out_zp);
+}
+
+static inline int8_t prelu_int8_float(int8_t q, float in_scale, int32_t in_zp, float slope, float out_scale,
+                                      int32_t out_zp)
+{
+  const float x = (float)((int32_t)q - in_zp) * in_scale;
+  const float y = (x < 0.0f) ? x * slope : x;
+  const float r = nearbyintf(y / out_scale) + (float)out_zp;
+  return (int8_t)((r < (float)Q_MIN) ? Q_MIN : ((r > (float)Q_MAX) ? Q_MAX : (int32_t)r));
+}
+
+int ll_sw_prelu_int8_prepare(ll_sw_prelu_int8_params *params, int32_t *m_neg, float in_scale, int32_t in_zp,
+                             const float *slopes, uint32_t slope_count, float out_scale, int32_t out_zp,
+                             uint32_t channels)
+{
+  if (params == NULL || m_neg == NULL || slopes == NULL || channels == 0 ||
+      channels > LL_SW_PRELU_INT8_MAX_CHANNELS || (slope_count != 1 && slope_count != channels) ||
+      !(in_scale > 0.0f) || !(out_scale > 0.0f))
+  {
+    return -1;
+  }
+
+  const float ratio = in_scale / out_scale;
+  float max_ratio = ratio;
+  for (uint32_t c = 0; c < channels; c++)
+  {
+    const float r = fabsf(slopes[(slope_count == 1) ? 0 : c] * ratio);
+    if (!isfinite(r))
+    {
+      return -1;
+    }
+    max_ratio = (r > max_ratio) ? r : max_ratio;
+  }
+
+  /* max_ratio < 2^exp, so 2^(MULT_BITS - exp) keeps every multiplier below 2^MULT_BITS */
+  int exp;
+  (void)frexpf(max_ratio, &exp);
+  int32_t shift = LL_SW_PRELU_INT8_MULT_BITS - exp;
+  if (shift > 31)
+  {
+    shift = 31;
+  }
+  if (shift < 1)
+  {
+    return -1;
+  }
+
+  const float one = ldexpf(1.0f, shift);
+  for (uint32_t c = 0; c < channels; c++)
+  {
+    m_neg[c] = (int32_t)lroundf(slopes[(slope_count == 1) ? 0 : c] * ratio * one);
+  }
+  params->m_pos = (int32_t)lroundf(ratio * one);
+  params->m_neg = m_neg;
+  params->shift = shift;
+  params->in_zp = in_zp;
+  params->out_zp = out_zp;
+  params->channels = channels;
+  return 0;
+}
+
+uint32_t ll_sw_prelu_int8_slope_count(uint32_t operand_elems, uint32_t channels)
+{
+  if (operand_elems == 1)
+  {
+    return 1;
+  }
+  return (operand_elems == channels || operand_elems == channels + 1) ? channels : 0;
+}
+
+void ll_sw_prelu_int8_run(const ll_sw_prelu_int8_params *params, const int8_t *input, int8_t *output,
+                          uint32_t pixels)
+{
+  const uint32_t channels = params->channels;
+  const int32_t shift = params->shift;
+
+#ifdef LL_SW_PRELU_INT8_MVE
+  const int32x4_t m_pos = vdupq_n_s32(params->m_pos);
+  const int32x4_t q_min = vdupq_n_s32(Q_MIN);
+  const int32x4_t q_max = vdupq_n_s32(Q_MAX);
+
+  for (uint32_t p = 0; p < pixels; p++)
+  {
+    const int32_t *m_neg = params->m_neg;
+    int32_t left = (int32_t)channels;
+    while (left > 0)
+    {
+      const mve_pred16_t tail = vctp32q((uint32_t)left);
+      const int32x4_t d = vsubq_n_s32(vldrbq_z_s32(input, tail), params->in_zp);
+      /* Pick the per-channel slope multiplier below the zero point */
+      const int32x4_t m = vpselq_s32(vldrwq_z_s32(m_neg, tail), m_pos, vcmpltq_n_s32(d, 0));
+      int32x4_t y = vrshlq_n_s32(vmulq_s32(d, m), -shift);
+      y = vminq_s32(vmaxq_s32(vaddq_n_s32(y, params->out_zp), q_min), q_max);
+      vstrbq_p_s32(output, y, tail);
+
+      input += 4;
+      output += 4;
+      m_neg += 4;
+      left -= 4;
+    }
+    /* Rewind the tail overshoot so the next pixel starts on its first channel */
+    input += left;
+    output += left;
+  }
+#else
+  (void)shift;
+
+  for (uint32_t p = 0; p < pixels; p++)
+  {
+    for (uint32_t c = 0; c < channels; c++)
+    {
+      output[c] = prelu_int8_fixed(params, input[c], c);
+    }
+    input += channels;
+    output += channels;
+  }
+#endif
+}
+
+void ll_sw_prelu_int8_run_strided(const ll_sw_prelu_int8_params *params, const int8_t *input, int8_t *output,
+                                  const ll_sw_prelu_int8_layout *layout)
+{
+  for (uint32_t b = 0; b < layout->batches; b++)
+  {
+    for (uint32_t h = 0; h < layout->height; h++)
+    {
+      for (uint32_t w = 0; w < layout->width; w++)
+      {
+        const int8_t *in = input + b * layout->in.b + h * layout->in.h + w * layout->in.w;
+        int8_t *out = output + b * layout->out.b + h * layout->out.h + w * layout->out.w;
+        for (uint32_t c = 0; c < layout->channels; c++)
+        {
+          out[c * layout->out.c] = prelu_int8_fixed(params, in[c * layout->in.c], c);
+        }
+      }
+    }
+  }
+}
+
+void ll_sw_prelu_int8_reference(const int8_t *input, int8_t *output, uint32_t pixels, uint32_t channels,
+                                float in_scale, int32_t in_zp, const float *slopes, uint32_t slope_count,
+                                float out_scale, int32_t out_zp)
+{
+  for (uint32_t p = 0; p < pixels; p++)
+  {
+    for (uint32_t c = 0; c < channels; c++)
+    {
+      output[c] = prelu_int8_float(input[c], in_scale, in_zp, slopes[(slope_count == 1) ? 0 : c], out_scale, out_zp);
+    }
+    input += channels;
+    output += channels;
+  }
+}
+
+void ll_sw_prelu_int8_reference_strided(const int8_t *input, int8_t *output, const ll_sw_prelu_int8_layout *layout,
+                                        float in_scale, int32_t in_zp, const float *slopes, uint32_t slope_count,
+                                        float out_scale, int32_t out_zp)
+{
+  for (uint32_t b = 0; b < layout->batches; b++)
+  {
+    for (uint32_t h = 0; h < layout->height; h++)
+    {
+      for (uint32_t w = 0; w < layout->width; w++)
+      {
+        const int8_t *in = input + b * layout->in.b + h * layout->in.h + w * layout->in.w;
+        int8_t *out = output + b * layout->out.b + h * layout->out.h + w * layout->out.w;
+        for (uint32_t c = 0; c < layout->channels; c++)
+        {
+          out[c * layout->out.c] = prelu_int8_float(in[c * layout->in.c], in_scale, in_zp,
+                                                    slopes[(slope_count == 1) ? 0 : c], out_scale, out_zp);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,145 @@
+/**
+ ******************************************************************************
+ * @file    ll_sw_prelu_int8.h
+ * @author  PeleAB
+ * @brief   Fused int8 -> int8 PReLU kernel for the ll_aton SW fallback path
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef __LL_SW_PRELU_INT8_H__
+#define __LL_SW_PRELU_INT8_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/** Largest channel count handled by the fixed-point path (recognizer max is 512) */
+#define LL_SW_PRELU_INT8_MAX_CHANNELS 1024
+
+/** Multipliers are kept below 2^22 so (q - zp) * m fits in 31 bits */
+#define LL_SW_PRELU_INT8_MULT_BITS 22
+
+  /**
+   * @brief Fixed-point form of DequantizeLinear -> PRelu -> QuantizeLinear
+   *
+   * y = ((q - in_zp) * m + 2^(shift - 1)) >> shift + out_zp, where m is
+   * m_pos = s_in / s_out for q >= in_zp and m_neg[c] = alpha[c] * s_in / s_out
+   * below it. All multipliers share one shift so the MVE and scalar loops
+   * select the multiplier per lane and requantize once.
+   */
+  typedef struct
+  {
+    int32_t m_pos;         /**< Multiplier for the positive side */
+    const int32_t *m_neg;  /**< Per-channel multipliers for the negative side */
+    int32_t shift;         /**< Common rounding right shift */
+    int32_t in_zp;         /**< Input zero point */
+    int32_t out_zp;        /**< Output zero point */
+    uint32_t channels;     /**< Innermost (channel) dimension */
+  } ll_sw_prelu_int8_params;
+
+  /** Byte strides of an int8 tensor, as in the ll_sw tensor descriptors */
+  typedef struct
+  {
+    uint32_t b;
+    uint32_t h;
+    uint32_t w;
+    uint32_t c;
+  } ll_sw_prelu_int8_strides;
+
+  /** Shape and strides of a tensor that is not dense channel-innermost */
+  typedef struct
+  {
+    uint32_t batches;
+    uint32_t height;
+    uint32_t width;
+    uint32_t channels;
+    ll_sw_prelu_int8_strides in;   /**< Input strides */
+    ll_sw_prelu_int8_strides out;  /**< Output strides */
+  } ll_sw_prelu_int8_layout;
+
+  /**
+   * @brief Build the fixed-point parameters from the float quantization data
+   * @param params       Parameters to fill
+   * @param m_neg        Storage for @p channels negative-side multipliers
+   * @param in_scale     Input scale (DequantizeLinear)
+   * @param in_zp        Input zero point
+   * @param slopes       PRelu slopes; @p slope_count is 1 (uniform) or channels
+   * @param slope_count  Number of entries in @p slopes
+   * @param out_scale    Output scale (QuantizeLinear)
+   * @param out_zp       Output zero point
+   * @param channels     Channel count, at most LL_SW_PRELU_INT8_MAX_CHANNELS
+   * @return 0 on success, negative when the ratios do not fit the fixed-point range
+   */
+  int ll_sw_prelu_int8_prepare(ll_sw_prelu_int8_params *params, int32_t *m_neg, float in_scale, int32_t in_zp,
+                               const float *slopes, uint32_t slope_count, float out_scale, int32_t out_zp,
+                               uint32_t channels);
+
+  /**
+   * @brief Slopes to use from a generated slope operand
+   *
+   * The code generator lays a channel-wise (1, C, 1, 1) slope out as a
+   * 1x(C+1)x1x1 operand: slope c is element c and the last element is
+   * padding (c_info.json and the graph dump show the C ONNX values from
+   * offset 0 in a C+1 buffer). It is never read.
+   *
+   * @param operand_elems Elements of the slope operand
+   * @param channels      Channel count of the input tensor
+   * @return 1 (uniform slope) or @p channels, 0 for any other layout
+   */
+  uint32_t ll_sw_prelu_int8_slope_count(uint32_t operand_elems, uint32_t channels);
+
+  /**
+   * @brief Run the fused kernel on a channel-innermost int8 tensor
+   * @param params  Parameters from ll_sw_prelu_int8_prepare()
+   * @param input   Input tensor, @p pixels x channels
+   * @param output  Output tensor, same layout, must not overlap @p input
+   * @param pixels  Number of channel vectors (b * h * w)
+   */
+  void ll_sw_prelu_int8_run(const ll_sw_prelu_int8_params *params, const int8_t *input, int8_t *output,
+                            uint32_t pixels);
+
+  /**
+   * @brief Scalar ll_sw_prelu_int8_run() for padded or channel-outer tensors
+   * @param params  Parameters from ll_sw_prelu_int8_prepare(), channels == layout->channels
+   * @param input   First input element
+   * @param output  First output element, must not overlap @p input
+   * @param layout  Shape and strides of both tensors
+   */
+  void ll_sw_prelu_int8_run_strided(const ll_sw_prelu_int8_params *params, const int8_t *input, int8_t *output,
+                                    const ll_sw_prelu_int8_layout *layout);
+
+  /**
+   * @brief Float reference: dequantize, PRelu, quantize (round half to even)
+   *
+   * Also the fallback when the parameters do not fit ll_sw_prelu_int8_prepare();
+   * @p slope_count is 1 or @p channels.
+   */
+  void ll_sw_prelu_int8_reference(const int8_t *input, int8_t *output, uint32_t pixels, uint32_t channels,
+                                  float in_scale, int32_t in_zp, const float *slopes, uint32_t slope_count,
+                                  float out_scale, int32_t out_zp);
+
+  /**
+   * @brief ll_sw_prelu_int8_reference() for padded or channel-outer tensors
+   */
+  void ll_sw_prelu_int8_reference_strided(const int8_t *input, int8_t *output, const ll_sw_prelu_int8_layout *layout,
+                                          float in_scale, int32_t in_zp, const float *slopes, uint32_t slope_count,
+                                          float out_scale, int32_t out_zp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ ******************************************************************************
+ * @file    ll_sw_quant_int8.c
+ * @author  PeleAB
+ * @brief   Contiguous QuantizeLinear / DequantizeLinear kernels for the ll_aton SW path
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include <stddef.h>
+
+#include "ll_sw_quant_int8.h"
+
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 2)
+#include <arm_mve.h>
+#define LL_SW_QUANT_INT8_MVE 1
+#endif
+
+/* Rounded values beyond this saturate for any 8-bit zero point */
+#define QUANT_ROUND_LIMIT 512.0f
+
+/* Per-channel tables, rebuilt on each call; scales are inverted for quantization */
+static float s_scale[LL_SW_QUANT_INT8_MAX_CHANNELS];
+static int32_t s_zeropoint[LL_SW_QUANT_INT8_MAX_CHANNELS];
+
+static inline int32_t quant_zeropoint(const ll_sw_quant_int8_params *params, uint32_t i)
+{
+  return params->is_signed ? (int32_t)((const int8_t *)params->zeropoint)[i]
+                           : (int32_t)((const uint8_t *)params->zeropoint)[i];
+}
+
+static inline int32_t quant_load(const void *input, uint32_t i, bool is_signed)
+{
+  return is_signed ? (int32_t)((const int8_t *)input)[i] : (int32_t)((const uint8_t *)input)[i];
+}
+
+/* Same saturation as the MVE convert / add / narrow chain */
+static inline uint8_t quant_store(float value, int32_t zp, int32_t q_min, int32_t q_max)
+{
+  value = (value < -QUANT_ROUND_LIMIT) ? -QUANT_ROUND_LIMIT : ((value > QUANT_ROUND_LIMIT) ? QUANT_ROUND_LIMIT : value);
+  int32_t q = (int32_t)lrintf(value) + zp;
+  q = (q < q_min) ? q_min : ((q > q_max) ? q_max : q);
+  return (uint8_t)q;
+}
+
+static int quant_check(const void *input, const void *output, uint32_t channels,
+                       const ll_sw_quant_int8_params *params)
+{
+  if (input == NULL || output == NULL || params == NULL || params->scale == NULL || params->zeropoint == NULL ||
+      channels == 0 || (params->count != 1 && params->count != channels) ||
+      channels > LL_SW_QUANT_INT8_MAX_CHANNELS)
+  {
+    return -1;
+  }
+  for (uint32_t c = 0; c < params->count; c++)
+  {
+    if (!(params->scale[c] > 0.0f))
+    {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/* Float/int32 copies of the per-channel parameters for the vector loads */
+static void quant_build_tables(const ll_sw_quant_int8_params *params, uint32_t channels, bool inverse)
+{
+  for (uint32_t c = 0; c < channels; c++)
+  {
+    s_scale[c] = inverse ? 1.0f / params->scale[c] : params->scale[c];
+    s_zeropoint[c] = quant_zeropoint(params, c);
+  }
+}
+
+/* ========================================================================= */
+/* SCALAR REFERENCE                                                          */
+/* ========================================================================= */
+
+int ll_sw_quantize_int8_reference(const float *input, void *output, uint32_t pixels, uint32_t channels,
+                                  const ll_sw_quant_int8_params *params)
+{
+  if (quant_check(input, output, channels, params) != 0)
+  {
+    return -1;
+  }
+
+  const int32_t q_min = params->is_signed ? -128 : 0;
+  const int32_t q_max = params->is_signed ? 127 : 255;
+  uint8_t *out = (uint8_t *)output;
+  for (uint32_t i = 0; i < pixels * channels; i++)
+  {
+    const uint32_t c = (params->count == 1) ? 0 : i % channels;
+    out[i] = quant_store(input[i] * (1.0f / params->scale[c]), quant_zeropoint(params, c), q_min, q_max);
+  }
+  return 0;
+}
+
+int ll_sw_dequantize_int8_reference(const void *input, float *output, uint32_t pixels, uint32_t channels,
+                                    const ll_sw_quant_int8_params *params)
+{
+  if (quant_check(input, output, channels, params) != 0)
+  {
+    return -1;
+  }
+
+  for (uint32_t i = 0; i < pixels * channels; i++)
+  {
+    const uint32_t c = (params->count == 1) ? 0 : i % channels;
+    output[i] = (float)(quant_load(input, i, params->is_signed) - quant_zeropoint(params, c)) * params->scale[c];
+  }
+  return 0;
+}
+
+/* ========================================================================= */
+/* CONTIGUOUS FAST PATHS                                                     */
+/* ========================================================================= */
+
+#ifdef LL_SW_QUANT_INT8_MVE
+/* 8 elements per step: vld2q splits even/odd lanes, the two saturating
+ * narrows put them back in order as int16, and vstrbq narrows to bytes */
+static inline void quant_mve_8(const float *in, uint8_t *out, float32x4x2_t inv, int32x4x2_t zp, int16x8_t q_min,
+                               int16x8_t q_max)
+{
+  const float32x4x2_t x = vld2q_f32(in);
+  const int32x4_t even = vqaddq_s32(vcvtnq_s32_f32(vmulq_f32(x.val[0], inv.val[0])), zp.val[0]);
+  const int32x4_t odd = vqaddq_s32(vcvtnq_s32_f32(vmulq_f32(x.val[1], inv.val[1])), zp.val[1]);
+  int16x8_t q = vqmovntq_s32(vqmovnbq_s32(vdupq_n_s16(0), even), odd);
+  q = vminq_s16(vmaxq_s16(q, q_min), q_max);
+  vstrbq_s16((int8_t *)out, q);
+}
+
+static inline void dequant_mve_8(const uint8_t *in, float *out, bool is_signed, float32x4x2_t scale,
+                                 int32x4x2_t zp)
+{
+  const int16x8_t q = is_signed ? vldrbq_s16((const int8_t *)in) : vreinterpretq_s16_u16(vldrbq_u16(in));
+  float32x4x2_t y;
+  y.val[0] = vmulq_f32(vcvtq_f32_s32(vsubq_s32(vmovlbq_s16(q), zp.val[0])), scale.val[0]);
+  y.val[1] = vmulq_f32(vcvtq_f32_s32(vsubq_s32(vmovltq_s16(q), zp.val[1])), scale.val[1]);
+  vst2q_f32(out, y);
+}
+#endif
+
+int ll_sw_quantize_int8(const float *input, void *output, uint32_t pixels, uint32_t channels,
+                        const ll_sw_quant_int8_params *params)
+{
+  if (quant_check(input, output, channels, params) != 0)
+  {
+    return -1;
+  }
+
+  const int32_t q_min = params->is_signed ? -128 : 0;
+  const int32_t q_max = params->is_signed ? 127 : 255;
+  uint8_t *out = (uint8_t *)output;
+
+  if (params->count == 1)
+  {
+    /* Per-tensor: the whole buffer is one run */
+    const float inv = 1.0f / params->scale[0];
+    const int32_t zp = quant_zeropoint(params, 0);
+    uint32_t n = pixels * channels;
+#ifdef LL_SW_QUANT_INT8_MVE
+    const float32x4x2_t inv_v = {{vdupq_n_f32(inv), vdupq_n_f32(inv)}};
+    const int32x4x2_t zp_v = {{vdupq_n_s32(zp), vdupq_n_s32(zp)}};
+    for (; n >= 8; n -= 8)
+    {
+      quant_mve_8(input, out, inv_v, zp_v, vdupq_n_s16((int16_t)q_min), vdupq_n_s16((int16_t)q_max));
+      input += 8;
+      out += 8;
+    }
+#endif
+    for (uint32_t i = 0; i < n; i++)
+    {
+      out[i] = quant_store(input[i] * inv, zp, q_min, q_max);
+    }
+    return 0;
+  }
+
+  /* Per-channel: walk each pixel against the channel tables */
+  quant_build_tables(params, channels, true);
+  for (uint32_t p = 0; p < pixels; p++)
+  {
+    uint32_t c = 0;
+#ifdef LL_SW_QUANT_INT8_MVE
+    for (; c + 8 <= channels; c += 8)
+    {
+      quant_mve_8(input + c, out + c, vld2q_f32(&s_scale[c]), vld2q_s32(&s_zeropoint[c]),
+                  vdupq_n_s16((int16_t)q_min), vdupq_n_s16((int16_t)q_max));
+    }
+#endif
+    for (; c < channels; c++)
+    {
+      out[c] = quant_store(input[c] * s_scale[c], s_zeropoint[c], q_min, q_max);
+    }
+    input += channels;
+    out += channels;
+  }
+  return 0;
+}
+
+int ll_sw_dequantize_int8(const void *input, float *output, uint32_t pixels, uint32_t channels,
+                          const ll_sw_quant_int8_params *params)
+{
+  if (quant_check(input, output, channels, params) != 0)
+  {
+    return -1;
+  }
+
+  const bool is_signed = params->is_signed;
+  const uint8_t *in = (const uint8_t *)input;
+
+  if (params->count == 1)
+  {
+    const float scale = params->scale[0];
+    const int32_t zp = quant_zeropoint(params, 0);
+    uint32_t n = pixels * channels;
+#ifdef LL_SW_QUANT_INT8_MVE
+    const float32x4x2_t scale_v = {{vdupq_n_f32(scale), vdupq_n_f32(scale)}};
+    const int32x4x2_t zp_v = {{vdupq_n_s32(zp), vdupq_n_s32(zp)}};
+    for (; n >= 8; n -= 8)
+    {
+      dequant_mve_8(in, output, is_signed, scale_v, zp_v);
+      in += 8;
+      output += 8;
+    }
+#endif
+    for (uint32_t i = 0; i < n; i++)
+    {
+      output[i] = (float)(quant_load(in, i, is_signed) - zp) * scale;
+    }
+    return 0;
+  }
+
+  quant_build_tables(params, channels, false);
+  for (uint32_t p = 0; p < pixels; p++)
+  {
+    uint32_t c = 0;
+#ifdef LL_SW_QUANT_INT8_MVE
+    for (; c + 8 <= channels; c += 8)
+    {
+      dequant_mve_8(in + c, output + c, is_signed, vld2q_f32(&s_scale[c]), vld2q_s32(&s_zeropoint[c]));
+    }
+#endif
+    for (; c < channels; c++)
+    {
+      output[c] = (float)(quant_load(in, c, is_signed) - s_zeropoint[c]) * s_scale[c];
+    }
+    in += channels;
+    output += channels;
+  }
+  return 0;
+}
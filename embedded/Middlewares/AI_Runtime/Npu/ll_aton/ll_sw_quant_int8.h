@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * @file    ll_sw_quant_int8.h
+ * @author  PeleAB
+ * @brief   Contiguous QuantizeLinear / DequantizeLinear kernels for the ll_aton SW path
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2024 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef __LL_SW_QUANT_INT8_H__
+#define __LL_SW_QUANT_INT8_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Largest channel count of the per-channel fast path */
+#define LL_SW_QUANT_INT8_MAX_CHANNELS 1024
+
+  /**
+   * @brief Quantization of a channel-innermost 8-bit tensor
+   *
+   * count is 1 for per-tensor quantization or the channel count for
+   * per-channel quantization along the innermost axis. The zero points are
+   * int8 when is_signed is set, uint8 otherwise, like the tensor itself.
+   */
+  typedef struct
+  {
+    const float *scale;    /**< count scales */
+    const void *zeropoint; /**< count zero points */
+    uint32_t count;        /**< 1 (per-tensor) or channels (per-channel) */
+    bool is_signed;        /**< int8 when set, uint8 otherwise */
+  } ll_sw_quant_int8_params;
+
+  /**
+   * @brief q = saturate(round_half_even(x * (1 / scale)) + zp) over a dense tensor
+   * @param input     pixels x channels floats
+   * @param output    pixels x channels int8/uint8 values
+   * @param pixels    Number of channel vectors (b * h * w)
+   * @param channels  Innermost dimension
+   * @param params    Quantization parameters
+   * @return 0 on success, negative when the parameters are not supported
+   */
+  int ll_sw_quantize_int8(const float *input, void *output, uint32_t pixels, uint32_t channels,
+                          const ll_sw_quant_int8_params *params);
+
+  /**
+   * @brief x = (q - zp) * scale over a dense tensor
+   * @return 0 on success, negative when the parameters are not supported
+   */
+  int ll_sw_dequantize_int8(const void *input, float *output, uint32_t pixels, uint32_t channels,
+                            const ll_sw_quant_int8_params *params);
+
+  /** @brief Scalar reference of ll_sw_quantize_int8(), one element at a time */
+  int ll_sw_quantize_int8_reference(const float *input, void *output, uint32_t pixels, uint32_t channels,
+                                    const ll_sw_quant_int8_params *params);
+
+  /** @brief Scalar reference of ll_sw_dequantize_int8(), one element at a time */
+  int ll_sw_dequantize_int8_reference(const void *input, float *output, uint32_t pixels, uint32_t channels,
+                                      const ll_sw_quant_int8_params *params);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -191,9 +191,9 @@ static void LL_ATON_End_EpochBlock_60(const void *epoch_block)
 {
   /* *** MCU cache invalidate (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 122880))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 124416))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 122880))) /* Equivalent hex address = 0x342fe000UL */, 1536);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 124416))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 125952))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 124416))) /* Equivalent hex address = 0x342fe600UL */, 1536);
 
   LL_ATON_LIB_UNUSED(epoch_block);
 
@@ -201,7 +201,7 @@ static void LL_ATON_End_EpochBlock_60(const void *epoch_block)
   LL_Switch_Init(NULL, 0);
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=Concat node=ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626 */
+/* kind=Concat node=ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626 (fused: ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626 -> ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628) */
   static const uint32_t ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_in_60__shape_1_24_4_4[] = { 1, 4, 4, 24 };
   static const uint32_t ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_in_60__mem_shape_L_1_24_4_4[] = { 1, 4, 4, 24 };
   static const float ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_in_60_Relu_255_out_0_quant_scale[] = { 0.00676214136183262 };
@@ -310,102 +310,6 @@ static void LL_ATON_End_EpochBlock_60(const void *epoch_block)
     }
   };
 
-  static const uint32_t ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60__shape_1_96_4_4[] = { 1, 4, 4, 96 };
-  static const uint32_t ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60__mem_shape_L_1_96_4_4[] = { 1, 4, 4, 96 };
-  static const float ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627_quant_scale[] = { 0.00676214136183262 };
-  static const int16_t ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627_quant_offset[] = { -128 };
-  static const LL_Buffer_InfoTypeDef ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60[] = {
-    {
-      .name = "ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627",
-      .addr_base = {(unsigned char *)(0x342e0000UL) /* Equivalent hex address = 0x342e0000UL */},
-      .offset_start = 122880,
-      .offset_end = 124416,
-      .offset_limit = 124480,
-      .is_user_allocated = 0,
-      .is_param = 0,
-      .epoch = 60,
-      .batch = 96,
-      .mem_shape = ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60__mem_shape_L_1_96_4_4,
-      .mem_ndims = 4,
-      .chpos = CHPos_Last,
-      .Qm = 7,
-      .Qn = 0,
-      .Qunsigned = 0,
-      .type = DataType_INT8,
-      .nbits = 8,
-      .ndims = 4,
-      .shape = ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60__shape_1_96_4_4,
-      .per_channel = 0,
-      .scale = ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627_quant_scale,
-      .offset = ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627_quant_offset,
-    },
-    {
-      .name = NULL,
-    }
-  };
-
-  LL_ATON_LIB_Concat(ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_in_60, 4, ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_out_60, 1, 8, 9);
-
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 122880))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 124416))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 122880))) /* Equivalent hex address = 0x342fe000UL */, 1536);
-
-}
-
-
-/* scheduling epoch=61   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_61(const void *epoch_block)
-{
-  /* *** MCU cache invalidate (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 124416))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 125952))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 124416))) /* Equivalent hex address = 0x342fe600UL */, 1536);
-
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* Reset the stream switch */
-  LL_Switch_Init(NULL, 0);
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DepthToSpace node=ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628 */
-  static const uint32_t ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61__shape_1_96_4_4[] = { 1, 4, 4, 96 };
-  static const uint32_t ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61__mem_shape_L_1_96_4_4[] = { 1, 4, 4, 96 };
-  static const float ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627_quant_scale[] = { 0.00676214136183262 };
-  static const int16_t ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627_quant_offset[] = { -128 };
-  static const LL_Buffer_InfoTypeDef ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61[] = {
-    {
-      .name = "ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627",
-      .addr_base = {(unsigned char *)(0x342e0000UL) /* Equivalent hex address = 0x342e0000UL */},
-      .offset_start = 122880,
-      .offset_end = 124416,
-      .offset_limit = 124480,
-      .is_user_allocated = 0,
-      .is_param = 0,
-      .epoch = 61,
-      .batch = 96,
-      .mem_shape = ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61__mem_shape_L_1_96_4_4,
-      .mem_ndims = 4,
-      .chpos = CHPos_Last,
-      .Qm = 7,
-      .Qn = 0,
-      .Qunsigned = 0,
-      .type = DataType_INT8,
-      .nbits = 8,
-      .ndims = 4,
-      .shape = ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61__shape_1_96_4_4,
-      .per_channel = 0,
-      .scale = ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627_quant_scale,
-      .offset = ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_627_quant_offset,
-    },
-    {
-      .name = NULL,
-    }
-  };
-
   static const uint32_t ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_out_61__shape_1_24_8_8[] = { 1, 8, 8, 24 };
   static const uint32_t ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_out_61__mem_shape_L_1_24_8_8[] = { 1, 8, 8, 24 };
   static const float ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_out_61_ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_out_629_quant_scale[] = { 0.00676214136183262 };
@@ -440,7 +344,7 @@ static void LL_ATON_End_EpochBlock_61(const void *epoch_block)
     }
   };
 
-  LL_ATON_LIB_DMA_DepthToSpace(ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_in_61, 1, ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_out_61, 2, 2, 0, 1);
+  LL_ATON_LIB_DMA_Concat_DepthToSpace(ConvTranspose_256_expanded_resize_0_resize_NN_expansion_concat_626_tensor_info_in_60, 4, ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628_tensor_info_out_61, 2, 2, 8, 9);
 
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
@@ -451,6 +355,17 @@ static void LL_ATON_End_EpochBlock_61(const void *epoch_block)
 }
 
 
+/* scheduling epoch=61   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_61(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* ConvTranspose_256_expanded_resize_0_resize_NN_to_expansion_dts_628 fused into epoch 60 (LL_ATON_LIB_DMA_Concat_DepthToSpace) */
+
+}
+
+
 // Epoch Controller Blob (name='_ec_blob_62') micro instructions needed
 
 // Epoch Controller Blob (name='_ec_blob_62') start function
@@ -753,9 +668,9 @@ static void LL_ATON_End_EpochBlock_68(const void *epoch_block)
 {
   /* *** MCU cache invalidate (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 221184))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 245760))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 221184))) /* Equivalent hex address = 0x34316000UL */, 24576);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 245760))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 270336))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 245760))) /* Equivalent hex address = 0x3431c000UL */, 24576);
 
   LL_ATON_LIB_UNUSED(epoch_block);
 
@@ -763,7 +678,7 @@ static void LL_ATON_End_EpochBlock_68(const void *epoch_block)
   LL_Switch_Init(NULL, 0);
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=Concat node=ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640 */
+/* kind=Concat node=ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640 (fused: ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640 -> ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642) */
   static const uint32_t ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_in_68__shape_1_24_16_16[] = { 1, 16, 16, 24 };
   static const uint32_t ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_in_68__mem_shape_L_1_24_16_16[] = { 1, 16, 16, 24 };
   static const float ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_in_68_Dequantize_267_out_0_quant_scale[] = { 0.0368081703782082 };
@@ -872,102 +787,6 @@ static void LL_ATON_End_EpochBlock_68(const void *epoch_block)
     }
   };
 
-  static const uint32_t ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68__shape_1_96_16_16[] = { 1, 16, 16, 96 };
-  static const uint32_t ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68__mem_shape_L_1_96_16_16[] = { 1, 16, 16, 96 };
-  static const float ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641_quant_scale[] = { 0.0368081703782082 };
-  static const int16_t ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641_quant_offset[] = { -128 };
-  static const LL_Buffer_InfoTypeDef ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68[] = {
-    {
-      .name = "ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641",
-      .addr_base = {(unsigned char *)(0x342e0000UL) /* Equivalent hex address = 0x342e0000UL */},
-      .offset_start = 221184,
-      .offset_end = 245760,
-      .offset_limit = 245824,
-      .is_user_allocated = 0,
-      .is_param = 0,
-      .epoch = 68,
-      .batch = 96,
-      .mem_shape = ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68__mem_shape_L_1_96_16_16,
-      .mem_ndims = 4,
-      .chpos = CHPos_Last,
-      .Qm = 7,
-      .Qn = 0,
-      .Qunsigned = 0,
-      .type = DataType_INT8,
-      .nbits = 8,
-      .ndims = 4,
-      .shape = ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68__shape_1_96_16_16,
-      .per_channel = 0,
-      .scale = ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641_quant_scale,
-      .offset = ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641_quant_offset,
-    },
-    {
-      .name = NULL,
-    }
-  };
-
-  LL_ATON_LIB_Concat(ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_in_68, 4, ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_out_68, 1, 4, 0);
-
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 221184))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 245760))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 221184))) /* Equivalent hex address = 0x34316000UL */, 24576);
-
-}
-
-
-/* scheduling epoch=69   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_69(const void *epoch_block)
-{
-  /* *** MCU cache invalidate (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 245760))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 270336))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 245760))) /* Equivalent hex address = 0x3431c000UL */, 24576);
-
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* Reset the stream switch */
-  LL_Switch_Init(NULL, 0);
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DepthToSpace node=ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642 */
-  static const uint32_t ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69__shape_1_96_16_16[] = { 1, 16, 16, 96 };
-  static const uint32_t ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69__mem_shape_L_1_96_16_16[] = { 1, 16, 16, 96 };
-  static const float ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641_quant_scale[] = { 0.0368081703782082 };
-  static const int16_t ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641_quant_offset[] = { -128 };
-  static const LL_Buffer_InfoTypeDef ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69[] = {
-    {
-      .name = "ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641",
-      .addr_base = {(unsigned char *)(0x342e0000UL) /* Equivalent hex address = 0x342e0000UL */},
-      .offset_start = 221184,
-      .offset_end = 245760,
-      .offset_limit = 245824,
-      .is_user_allocated = 0,
-      .is_param = 0,
-      .epoch = 69,
-      .batch = 96,
-      .mem_shape = ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69__mem_shape_L_1_96_16_16,
-      .mem_ndims = 4,
-      .chpos = CHPos_Last,
-      .Qm = 7,
-      .Qn = 0,
-      .Qunsigned = 0,
-      .type = DataType_INT8,
-      .nbits = 8,
-      .ndims = 4,
-      .shape = ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69__shape_1_96_16_16,
-      .per_channel = 0,
-      .scale = ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641_quant_scale,
-      .offset = ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_641_quant_offset,
-    },
-    {
-      .name = NULL,
-    }
-  };
-
   static const uint32_t ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_out_69__shape_1_24_32_32[] = { 1, 32, 32, 24 };
   static const uint32_t ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_out_69__mem_shape_L_1_24_32_32[] = { 1, 32, 32, 24 };
   static const float ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_out_69_ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_out_643_quant_scale[] = { 0.0368081703782082 };
@@ -1002,7 +821,7 @@ static void LL_ATON_End_EpochBlock_69(const void *epoch_block)
     }
   };
 
-  LL_ATON_LIB_DMA_DepthToSpace(ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_in_69, 1, ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_out_69, 2, 2, 5, 6);
+  LL_ATON_LIB_DMA_Concat_DepthToSpace(ConvTranspose_268_expanded_resize_16_resize_NN_expansion_concat_640_tensor_info_in_68, 4, ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642_tensor_info_out_69, 2, 2, 4, 0);
 
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
@@ -1013,6 +832,17 @@ static void LL_ATON_End_EpochBlock_69(const void *epoch_block)
 }
 
 
+/* scheduling epoch=69   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_69(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* ConvTranspose_268_expanded_resize_16_resize_NN_to_expansion_dts_642 fused into epoch 68 (LL_ATON_LIB_DMA_Concat_DepthToSpace) */
+
+}
+
+
 // Epoch Controller Blob (name='_ec_blob_70') micro instructions needed
 
 // Epoch Controller Blob (name='_ec_blob_70') start function
@@ -205,8 +205,8 @@ static void LL_ATON_End_EpochBlock_4(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_5 */
-  Dequantizelinear_sw_info dequantizelinear2_sw_info = {
+/* kind=PRelu node=PReLU_6 (fused: Dequantize_5 -> PReLU_6 -> Quantize_7) */
+  Prelu_integer_sw_info prelu_integer0_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 56,
@@ -227,29 +227,49 @@ static void LL_ATON_End_EpochBlock_4(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241424))) /* Equivalent hex address = 0x7212f150UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 65,
+    .slope.dim.num_elem = 65,
+    .slope.stride.b = 260,
+    .slope.stride.h = 260,
+    .slope.stride.w = 260,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1239728))) /* Equivalent hex address = 0x7212eab0UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240512))) /* Equivalent hex address = 0x7212edc0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241648))) /* Equivalent hex address = 0x7212f230UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 56,
     .general.output.dim.tensor_w = 56,
     .general.output.dim.tensor_c = 64,
     .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 802816,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.stride.b = 200704,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 64,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_5 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear2_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_6 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer0_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 11 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */, 802816);
+  /*     memory pool: 1 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
 
 }
 
@@ -260,57 +280,7 @@ static void LL_ATON_End_EpochBlock_5(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_6 */
-  Activ_sw_info activ3_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 56,
-    .general.input.dim.tensor_w = 56,
-    .general.input.dim.tensor_c = 64,
-    .general.input.dim.num_elem = 200704,
-    .general.input.stride.b = 802816,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 65,
-    .operand.dim.num_elem = 65,
-    .operand.stride.b = 260,
-    .operand.stride.h = 260,
-    .operand.stride.w = 260,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1239728))) /* Equivalent hex address = 0x7212eab0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 56,
-    .general.output.dim.tensor_w = 56,
-    .general.output.dim.tensor_c = 64,
-    .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 802816,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) /* Equivalent hex address = 0x341c4000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_6 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ3_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 11 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 1605632))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) /* Equivalent hex address = 0x341c4000UL */, 802816);
+  /* PReLU_6 fused into epoch 4 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -321,53 +291,7 @@ static void LL_ATON_End_EpochBlock_6(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_7 */
-  Quantizelinear_sw_info quantizelinear4_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 56,
-    .general.input.dim.tensor_w = 56,
-    .general.input.dim.tensor_c = 64,
-    .general.input.dim.num_elem = 200704,
-    .general.input.stride.b = 802816,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) /* Equivalent hex address = 0x341c4000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240512))) /* Equivalent hex address = 0x7212edc0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241648))) /* Equivalent hex address = 0x7212f230UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 56,
-    .general.output.dim.tensor_w = 56,
-    .general.output.dim.tensor_c = 64,
-    .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 64,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_7 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear4_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
+  /* Quantize_7 fused into epoch 4 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -395,8 +319,8 @@ static void LL_ATON_End_EpochBlock_8(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_11 */
-  Dequantizelinear_sw_info dequantizelinear5_sw_info = {
+/* kind=PRelu node=PReLU_12 (fused: Dequantize_11 -> PReLU_12 -> Quantize_13) */
+  Prelu_integer_sw_info prelu_integer1_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 56,
@@ -417,29 +341,49 @@ static void LL_ATON_End_EpochBlock_8(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241440))) /* Equivalent hex address = 0x7212f160UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 65,
+    .slope.dim.num_elem = 65,
+    .slope.stride.b = 260,
+    .slope.stride.h = 260,
+    .slope.stride.w = 260,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240000))) /* Equivalent hex address = 0x7212ebc0UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240528))) /* Equivalent hex address = 0x7212edd0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241664))) /* Equivalent hex address = 0x7212f240UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 56,
     .general.output.dim.tensor_w = 56,
     .general.output.dim.tensor_c = 64,
     .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 802816,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.stride.b = 200704,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 64,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_11 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear5_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_12 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer1_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 11 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */, 802816);
+  /*     memory pool: 2 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 200704))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 200704);
 
 }
 
@@ -450,57 +394,7 @@ static void LL_ATON_End_EpochBlock_9(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_12 */
-  Activ_sw_info activ6_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 56,
-    .general.input.dim.tensor_w = 56,
-    .general.input.dim.tensor_c = 64,
-    .general.input.dim.num_elem = 200704,
-    .general.input.stride.b = 802816,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 65,
-    .operand.dim.num_elem = 65,
-    .operand.stride.b = 260,
-    .operand.stride.h = 260,
-    .operand.stride.w = 260,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240000))) /* Equivalent hex address = 0x7212ebc0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 56,
-    .general.output.dim.tensor_w = 56,
-    .general.output.dim.tensor_c = 64,
-    .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 802816,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 1708032))) /* Equivalent hex address = 0x342a1000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_12 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ6_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 11 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 1708032))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 2510848))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 1708032))) /* Equivalent hex address = 0x342a1000UL */, 802816);
+  /* PReLU_12 fused into epoch 8 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -511,53 +405,7 @@ static void LL_ATON_End_EpochBlock_10(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_13 */
-  Quantizelinear_sw_info quantizelinear7_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 56,
-    .general.input.dim.tensor_w = 56,
-    .general.input.dim.tensor_c = 64,
-    .general.input.dim.num_elem = 200704,
-    .general.input.stride.b = 802816,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 1708032))) /* Equivalent hex address = 0x342a1000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240528))) /* Equivalent hex address = 0x7212edd0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241664))) /* Equivalent hex address = 0x7212f240UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 56,
-    .general.output.dim.tensor_w = 56,
-    .general.output.dim.tensor_c = 64,
-    .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 64,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_13 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear7_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 200704);
+  /* Quantize_13 fused into epoch 8 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -585,8 +433,8 @@ static void LL_ATON_End_EpochBlock_12(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_17 */
-  Dequantizelinear_sw_info dequantizelinear8_sw_info = {
+/* kind=PRelu node=PReLU_18 (fused: Dequantize_17 -> PReLU_18 -> Quantize_19) */
+  Prelu_integer_sw_info prelu_integer2_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 56,
@@ -607,29 +455,49 @@ static void LL_ATON_End_EpochBlock_12(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241408))) /* Equivalent hex address = 0x7212f140UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1233424))) /* Equivalent hex address = 0x7212d210UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240336))) /* Equivalent hex address = 0x7212ed10UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241472))) /* Equivalent hex address = 0x7212f180UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 56,
     .general.output.dim.tensor_w = 56,
     .general.output.dim.tensor_c = 128,
     .general.output.dim.num_elem = 401408,
-    .general.output.stride.b = 1605632,
-    .general.output.stride.h = 28672,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.stride.b = 401408,
+    .general.output.stride.h = 7168,
+    .general.output.stride.w = 128,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_17 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear8_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_18 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer2_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 11 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 1605632))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */, 1605632);
+  /*     memory pool: 1 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
 
 }
 
@@ -640,57 +508,7 @@ static void LL_ATON_End_EpochBlock_13(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_18 */
-  Activ_sw_info activ9_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 56,
-    .general.input.dim.tensor_w = 56,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 401408,
-    .general.input.stride.b = 1605632,
-    .general.input.stride.h = 28672,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1233424))) /* Equivalent hex address = 0x7212d210UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 56,
-    .general.output.dim.tensor_w = 56,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 401408,
-    .general.output.stride.b = 1605632,
-    .general.output.stride.h = 28672,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x90000000UL + 0))) /* Equivalent hex address = 0x90000000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_18 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ9_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 7 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x90000000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x90000000UL + 1605632))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x90000000UL + 0))) /* Equivalent hex address = 0x90000000UL */, 1605632);
+  /* PReLU_18 fused into epoch 12 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -701,53 +519,7 @@ static void LL_ATON_End_EpochBlock_14(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_19 */
-  Quantizelinear_sw_info quantizelinear10_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 56,
-    .general.input.dim.tensor_w = 56,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 401408,
-    .general.input.stride.b = 1605632,
-    .general.input.stride.h = 28672,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x90000000UL + 0))) /* Equivalent hex address = 0x90000000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240336))) /* Equivalent hex address = 0x7212ed10UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241472))) /* Equivalent hex address = 0x7212f180UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 56,
-    .general.output.dim.tensor_w = 56,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 401408,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 128,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_19 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear10_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /* Quantize_19 fused into epoch 12 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -775,8 +547,8 @@ static void LL_ATON_End_EpochBlock_16(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_23 */
-  Dequantizelinear_sw_info dequantizelinear11_sw_info = {
+/* kind=PRelu node=PReLU_24 (fused: Dequantize_23 -> PReLU_24 -> Quantize_25) */
+  Prelu_integer_sw_info prelu_integer3_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
@@ -797,29 +569,49 @@ static void LL_ATON_End_EpochBlock_16(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241488))) /* Equivalent hex address = 0x7212f190UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1233952))) /* Equivalent hex address = 0x7212d420UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240768))) /* Equivalent hex address = 0x7212eec0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241904))) /* Equivalent hex address = 0x7212f330UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 28,
     .general.output.dim.tensor_w = 28,
     .general.output.dim.tensor_c = 128,
     .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
+    .general.output.stride.b = 100352,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 128,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_23 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear11_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_24 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer3_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
 
 }
 
@@ -830,57 +622,7 @@ static void LL_ATON_End_EpochBlock_17(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_24 */
-  Activ_sw_info activ12_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1233952))) /* Equivalent hex address = 0x7212d420UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_24 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ12_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
+  /* PReLU_24 fused into epoch 16 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -891,53 +633,7 @@ static void LL_ATON_End_EpochBlock_18(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_25 */
-  Quantizelinear_sw_info quantizelinear13_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240768))) /* Equivalent hex address = 0x7212eec0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241904))) /* Equivalent hex address = 0x7212f330UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 128,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_25 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear13_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
+  /* Quantize_25 fused into epoch 16 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -965,8 +661,8 @@ static void LL_ATON_End_EpochBlock_21(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_32 */
-  Dequantizelinear_sw_info dequantizelinear14_sw_info = {
+/* kind=PRelu node=PReLU_33 (fused: Dequantize_32 -> PReLU_33 -> Quantize_34) */
+  Prelu_integer_sw_info prelu_integer4_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
@@ -987,29 +683,49 @@ static void LL_ATON_End_EpochBlock_21(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241504))) /* Equivalent hex address = 0x7212f1a0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1234480))) /* Equivalent hex address = 0x7212d630UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240784))) /* Equivalent hex address = 0x7212eed0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241920))) /* Equivalent hex address = 0x7212f340UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 28,
     .general.output.dim.tensor_w = 28,
     .general.output.dim.tensor_c = 128,
     .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
+    .general.output.stride.b = 100352,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 128,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_32 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear14_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_33 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer4_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
 
 }
 
@@ -1020,57 +736,7 @@ static void LL_ATON_End_EpochBlock_22(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_33 */
-  Activ_sw_info activ15_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1234480))) /* Equivalent hex address = 0x7212d630UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_33 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ15_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
+  /* PReLU_33 fused into epoch 21 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -1081,53 +747,7 @@ static void LL_ATON_End_EpochBlock_23(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_34 */
-  Quantizelinear_sw_info quantizelinear16_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240784))) /* Equivalent hex address = 0x7212eed0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241920))) /* Equivalent hex address = 0x7212f340UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 128,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_34 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear16_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
+  /* Quantize_34 fused into epoch 21 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -1155,8 +775,8 @@ static void LL_ATON_End_EpochBlock_25(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_38 */
-  Dequantizelinear_sw_info dequantizelinear17_sw_info = {
+/* kind=PRelu node=PReLU_39 (fused: Dequantize_38 -> PReLU_39 -> Quantize_40) */
+  Prelu_integer_sw_info prelu_integer5_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
@@ -1177,29 +797,49 @@ static void LL_ATON_End_EpochBlock_25(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241520))) /* Equivalent hex address = 0x7212f1b0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1235008))) /* Equivalent hex address = 0x7212d840UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240800))) /* Equivalent hex address = 0x7212eee0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241936))) /* Equivalent hex address = 0x7212f350UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 28,
     .general.output.dim.tensor_w = 28,
     .general.output.dim.tensor_c = 128,
     .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
+    .general.output.stride.b = 100352,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 128,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_38 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear17_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_39 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer5_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
 
 }
 
@@ -1210,57 +850,7 @@ static void LL_ATON_End_EpochBlock_26(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_39 */
-  Activ_sw_info activ18_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1235008))) /* Equivalent hex address = 0x7212d840UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_39 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ18_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
+  /* PReLU_39 fused into epoch 25 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -1271,53 +861,7 @@ static void LL_ATON_End_EpochBlock_27(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_40 */
-  Quantizelinear_sw_info quantizelinear19_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240800))) /* Equivalent hex address = 0x7212eee0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241936))) /* Equivalent hex address = 0x7212f350UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 128,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_40 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear19_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
+  /* Quantize_40 fused into epoch 25 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -1345,8 +889,8 @@ static void LL_ATON_End_EpochBlock_30(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_50 */
-  Dequantizelinear_sw_info dequantizelinear20_sw_info = {
+/* kind=PRelu node=PReLU_51 (fused: Dequantize_50 -> PReLU_51 -> Quantize_52) */
+  Prelu_integer_sw_info prelu_integer6_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
@@ -1367,29 +911,49 @@ static void LL_ATON_End_EpochBlock_30(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241536))) /* Equivalent hex address = 0x7212f1c0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1235536))) /* Equivalent hex address = 0x7212da50UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240816))) /* Equivalent hex address = 0x7212eef0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241952))) /* Equivalent hex address = 0x7212f360UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 28,
     .general.output.dim.tensor_w = 28,
     .general.output.dim.tensor_c = 128,
     .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
+    .general.output.stride.b = 100352,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 128,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_50 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear20_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_51 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer6_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
 
 }
 
@@ -1400,89 +964,85 @@ static void LL_ATON_End_EpochBlock_31(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_51 fused into epoch 30 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_51 */
-  Activ_sw_info activ21_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1235536))) /* Equivalent hex address = 0x7212da50UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_51 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ21_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
+
+/* scheduling epoch=32   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_32(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_52 fused into epoch 30 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_33') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_33') start function
+static void _ec_blob_cache_start_func_33(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 2 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 100352))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 100352);
 
-}
+};
 
 
-/* scheduling epoch=32   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=34   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_32(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_34(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_52 */
-  Quantizelinear_sw_info quantizelinear22_sw_info = {
+/* kind=PRelu node=PReLU_57 (fused: Dequantize_56 -> PReLU_57 -> Quantize_58) */
+  Prelu_integer_sw_info prelu_integer7_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
     .general.input.dim.tensor_w = 28,
     .general.input.dim.tensor_c = 128,
     .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
+    .general.input.stride.b = 100352,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 128,
+    .general.input.stride.c = 1,
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240416))) /* Equivalent hex address = 0x7212ed60UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241552))) /* Equivalent hex address = 0x7212f1d0UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1236064))) /* Equivalent hex address = 0x7212dc60UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240816))) /* Equivalent hex address = 0x7212eef0UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240832))) /* Equivalent hex address = 0x7212ef00UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241952))) /* Equivalent hex address = 0x7212f360UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241968))) /* Equivalent hex address = 0x7212f370UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -1497,12 +1057,12 @@ static void LL_ATON_End_EpochBlock_32(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_52 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear22_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_57 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer7_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
@@ -1512,10 +1072,32 @@ static void LL_ATON_End_EpochBlock_32(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_33') micro instructions needed
+/* scheduling epoch=35   nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_33') start function
-static void _ec_blob_cache_start_func_33(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_35(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_57 fused into epoch 34 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=36   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_36(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_58 fused into epoch 34 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_37') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_37') start function
+static void _ec_blob_cache_start_func_37(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
@@ -1527,16 +1109,16 @@ static void _ec_blob_cache_start_func_33(const void *epoch_block) {
 };
 
 
-/* scheduling epoch=34   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=39   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_34(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_39(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_56 */
-  Dequantizelinear_sw_info dequantizelinear23_sw_info = {
+/* kind=PRelu node=PReLU_69 (fused: Dequantize_68 -> PReLU_69 -> Quantize_70) */
+  Prelu_integer_sw_info prelu_integer8_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
@@ -1550,129 +1132,145 @@ static void LL_ATON_End_EpochBlock_34(const void *epoch_block)
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240416))) /* Equivalent hex address = 0x7212ed60UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240432))) /* Equivalent hex address = 0x7212ed70UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241552))) /* Equivalent hex address = 0x7212f1d0UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241568))) /* Equivalent hex address = 0x7212f1e0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1236592))) /* Equivalent hex address = 0x7212de70UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240848))) /* Equivalent hex address = 0x7212ef10UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241984))) /* Equivalent hex address = 0x7212f380UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 28,
     .general.output.dim.tensor_w = 28,
     .general.output.dim.tensor_c = 128,
     .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.stride.b = 100352,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 128,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_56 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear23_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_69 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer8_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
 
 }
 
 
-/* scheduling epoch=35   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=40   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_35(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_40(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_69 fused into epoch 39 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_57 */
-  Activ_sw_info activ24_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1236064))) /* Equivalent hex address = 0x7212dc60UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_57 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ24_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
+
+/* scheduling epoch=41   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_41(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_70 fused into epoch 39 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_42') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_42') start function
+static void _ec_blob_cache_start_func_42(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 2 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 100352))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 100352);
 
-}
+};
 
 
-/* scheduling epoch=36   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=43   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_36(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_43(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_58 */
-  Quantizelinear_sw_info quantizelinear25_sw_info = {
+/* kind=PRelu node=PReLU_75 (fused: Dequantize_74 -> PReLU_75 -> Quantize_76) */
+  Prelu_integer_sw_info prelu_integer9_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
     .general.input.dim.tensor_w = 28,
     .general.input.dim.tensor_c = 128,
     .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
+    .general.input.stride.b = 100352,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 128,
+    .general.input.stride.c = 1,
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240448))) /* Equivalent hex address = 0x7212ed80UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241584))) /* Equivalent hex address = 0x7212f1f0UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1237120))) /* Equivalent hex address = 0x7212e080UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240832))) /* Equivalent hex address = 0x7212ef00UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240864))) /* Equivalent hex address = 0x7212ef20UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241968))) /* Equivalent hex address = 0x7212f370UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242000))) /* Equivalent hex address = 0x7212f390UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -1687,12 +1285,12 @@ static void LL_ATON_End_EpochBlock_36(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_58 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear25_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_75 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer9_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
@@ -1702,10 +1300,32 @@ static void LL_ATON_End_EpochBlock_36(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_37') micro instructions needed
+/* scheduling epoch=44   nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_37') start function
-static void _ec_blob_cache_start_func_37(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_44(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_75 fused into epoch 43 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=45   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_45(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_76 fused into epoch 43 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_46') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_46') start function
+static void _ec_blob_cache_start_func_46(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
@@ -1717,16 +1337,16 @@ static void _ec_blob_cache_start_func_37(const void *epoch_block) {
 };
 
 
-/* scheduling epoch=39   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=48   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_39(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_48(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_68 */
-  Dequantizelinear_sw_info dequantizelinear26_sw_info = {
+/* kind=PRelu node=PReLU_87 (fused: Dequantize_86 -> PReLU_87 -> Quantize_88) */
+  Prelu_integer_sw_info prelu_integer10_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
@@ -1740,129 +1360,145 @@ static void LL_ATON_End_EpochBlock_39(const void *epoch_block)
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240432))) /* Equivalent hex address = 0x7212ed70UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240464))) /* Equivalent hex address = 0x7212ed90UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241568))) /* Equivalent hex address = 0x7212f1e0UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241600))) /* Equivalent hex address = 0x7212f200UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1237648))) /* Equivalent hex address = 0x7212e290UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240880))) /* Equivalent hex address = 0x7212ef30UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242016))) /* Equivalent hex address = 0x7212f3a0UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 28,
     .general.output.dim.tensor_w = 28,
     .general.output.dim.tensor_c = 128,
     .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
+    .general.output.stride.b = 100352,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 128,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_68 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear26_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_87 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer10_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
 
 }
 
 
-/* scheduling epoch=40   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=49   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_40(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_49(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_87 fused into epoch 48 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_69 */
-  Activ_sw_info activ27_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1236592))) /* Equivalent hex address = 0x7212de70UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_69 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ27_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
+
+/* scheduling epoch=50   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_50(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_88 fused into epoch 48 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_51') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_51') start function
+static void _ec_blob_cache_start_func_51(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 2 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 100352))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 100352);
 
-}
+};
 
 
-/* scheduling epoch=41   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=52   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_41(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_52(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_70 */
-  Quantizelinear_sw_info quantizelinear28_sw_info = {
+/* kind=PRelu node=PReLU_93 (fused: Dequantize_92 -> PReLU_93 -> Quantize_94) */
+  Prelu_integer_sw_info prelu_integer11_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
     .general.input.dim.tensor_w = 28,
     .general.input.dim.tensor_c = 128,
     .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
+    .general.input.stride.b = 100352,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 128,
+    .general.input.stride.c = 1,
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240480))) /* Equivalent hex address = 0x7212eda0UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241616))) /* Equivalent hex address = 0x7212f210UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 129,
+    .slope.dim.num_elem = 129,
+    .slope.stride.b = 516,
+    .slope.stride.h = 516,
+    .slope.stride.w = 516,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1238176))) /* Equivalent hex address = 0x7212e4a0UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240848))) /* Equivalent hex address = 0x7212ef10UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240896))) /* Equivalent hex address = 0x7212ef40UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241984))) /* Equivalent hex address = 0x7212f380UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242032))) /* Equivalent hex address = 0x7212f3b0UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -1877,12 +1513,12 @@ static void LL_ATON_End_EpochBlock_41(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_70 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear28_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_93 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer11_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
@@ -1892,2447 +1528,319 @@ static void LL_ATON_End_EpochBlock_41(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_42') micro instructions needed
+/* scheduling epoch=53   nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_42') start function
-static void _ec_blob_cache_start_func_42(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
+static void LL_ATON_End_EpochBlock_53(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_93 fused into epoch 52 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=54   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_54(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_94 fused into epoch 52 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_55') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_55') start function
+static void _ec_blob_cache_start_func_55(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 100352))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 100352);
+  /*     memory pool: 1 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
 
 };
 
 
-/* scheduling epoch=43   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=57   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_43(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_57(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_74 */
-  Dequantizelinear_sw_info dequantizelinear29_sw_info = {
+/* kind=PRelu node=PReLU_105 (fused: Dequantize_104 -> PReLU_105 -> Quantize_106) */
+  Prelu_integer_sw_info prelu_integer12_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 28,
     .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 100352,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 128,
+    .general.input.dim.tensor_c = 256,
+    .general.input.dim.num_elem = 200704,
+    .general.input.stride.b = 200704,
+    .general.input.stride.h = 7168,
+    .general.input.stride.w = 256,
     .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240448))) /* Equivalent hex address = 0x7212ed80UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240320))) /* Equivalent hex address = 0x7212ed00UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241584))) /* Equivalent hex address = 0x7212f1f0UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241456))) /* Equivalent hex address = 0x7212f170UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1214704))) /* Equivalent hex address = 0x721288f0UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240544))) /* Equivalent hex address = 0x7212ede0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241680))) /* Equivalent hex address = 0x7212f250UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 28,
     .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
+    .general.output.dim.tensor_c = 256,
+    .general.output.dim.num_elem = 200704,
+    .general.output.stride.b = 200704,
+    .general.output.stride.h = 7168,
+    .general.output.stride.w = 256,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_74 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear29_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_105 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer12_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
 
 }
 
 
-/* scheduling epoch=44   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=58   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_44(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_58(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_105 fused into epoch 57 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_75 */
-  Activ_sw_info activ30_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1237120))) /* Equivalent hex address = 0x7212e080UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_75 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ30_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
+
+/* scheduling epoch=59   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_59(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_106 fused into epoch 57 (ll_sw_forward_prelu_integer) */
 
 }
 
 
-/* scheduling epoch=45   nodes=1   ------------------------------------------------------------------- */
+// Epoch Controller Blob (name='_ec_blob_60') micro instructions needed
 
-static void LL_ATON_End_EpochBlock_45(const void *epoch_block)
+// Epoch Controller Blob (name='_ec_blob_60') start function
+static void _ec_blob_cache_start_func_60(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
+  /*     memory pool: 1 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
+
+};
+
+
+/* scheduling epoch=61   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_61(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_76 */
-  Quantizelinear_sw_info quantizelinear31_sw_info = {
+/* kind=PRelu node=PReLU_111 (fused: Dequantize_110 -> PReLU_111 -> Quantize_112) */
+  Prelu_integer_sw_info prelu_integer13_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.dim.tensor_h = 14,
+    .general.input.dim.tensor_w = 14,
+    .general.input.dim.tensor_c = 256,
+    .general.input.dim.num_elem = 50176,
+    .general.input.stride.b = 50176,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 256,
+    .general.input.stride.c = 1,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240560))) /* Equivalent hex address = 0x7212edf0UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241696))) /* Equivalent hex address = 0x7212f260UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1215744))) /* Equivalent hex address = 0x72128d00UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240864))) /* Equivalent hex address = 0x7212ef20UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241008))) /* Equivalent hex address = 0x7212efb0UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242000))) /* Equivalent hex address = 0x7212f390UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242144))) /* Equivalent hex address = 0x7212f420UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 100352,
+    .general.output.dim.tensor_h = 14,
+    .general.output.dim.tensor_w = 14,
+    .general.output.dim.tensor_c = 256,
+    .general.output.dim.num_elem = 50176,
+    .general.output.stride.b = 50176,
     .general.output.stride.h = 3584,
-    .general.output.stride.w = 128,
+    .general.output.stride.w = 256,
     .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_76 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear31_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_111 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer13_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
 
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_46') micro instructions needed
+/* scheduling epoch=62   nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_46') start function
-static void _ec_blob_cache_start_func_46(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_62(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_111 fused into epoch 61 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=63   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_63(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_112 fused into epoch 61 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_64') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_64') start function
+static void _ec_blob_cache_start_func_64(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 100352))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 100352);
+  /*     memory pool: 1 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
 
 };
 
 
-/* scheduling epoch=48   nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=66   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_48(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_66(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_86 */
-  Dequantizelinear_sw_info dequantizelinear32_sw_info = {
+/* kind=PRelu node=PReLU_120 (fused: Dequantize_119 -> PReLU_120 -> Quantize_121) */
+  Prelu_integer_sw_info prelu_integer14_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 100352,
+    .general.input.dim.tensor_h = 14,
+    .general.input.dim.tensor_w = 14,
+    .general.input.dim.tensor_c = 256,
+    .general.input.dim.num_elem = 50176,
+    .general.input.stride.b = 50176,
     .general.input.stride.h = 3584,
-    .general.input.stride.w = 128,
+    .general.input.stride.w = 256,
     .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240464))) /* Equivalent hex address = 0x7212ed90UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240576))) /* Equivalent hex address = 0x7212ee00UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241600))) /* Equivalent hex address = 0x7212f200UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_86 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear32_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
-
-}
-
-
-/* scheduling epoch=49   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_49(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_87 */
-  Activ_sw_info activ33_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1237648))) /* Equivalent hex address = 0x7212e290UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_87 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ33_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
-
-}
-
-
-/* scheduling epoch=50   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_50(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_88 */
-  Quantizelinear_sw_info quantizelinear34_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240880))) /* Equivalent hex address = 0x7212ef30UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242016))) /* Equivalent hex address = 0x7212f3a0UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 128,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_88 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear34_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_51') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_51') start function
-static void _ec_blob_cache_start_func_51(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 100352))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 100352);
-
-};
-
-
-/* scheduling epoch=52   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_52(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_92 */
-  Dequantizelinear_sw_info dequantizelinear35_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 100352,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 128,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240480))) /* Equivalent hex address = 0x7212eda0UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241616))) /* Equivalent hex address = 0x7212f210UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_92 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear35_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
-
-}
-
-
-/* scheduling epoch=53   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_53(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_93 */
-  Activ_sw_info activ36_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 129,
-    .operand.dim.num_elem = 129,
-    .operand.stride.b = 516,
-    .operand.stride.h = 516,
-    .operand.stride.w = 516,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1238176))) /* Equivalent hex address = 0x7212e4a0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_93 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ36_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
-
-}
-
-
-/* scheduling epoch=54   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_54(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_94 */
-  Quantizelinear_sw_info quantizelinear37_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 128,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 512,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240896))) /* Equivalent hex address = 0x7212ef40UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242032))) /* Equivalent hex address = 0x7212f3b0UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 128,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 128,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_94 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear37_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_55') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_55') start function
-static void _ec_blob_cache_start_func_55(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-};
-
-
-/* scheduling epoch=57   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_57(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_104 */
-  Dequantizelinear_sw_info dequantizelinear38_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 200704,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240320))) /* Equivalent hex address = 0x7212ed00UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241456))) /* Equivalent hex address = 0x7212f170UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 802816,
-    .general.output.stride.h = 28672,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_104 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear38_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 11 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */, 802816);
-
-}
-
-
-/* scheduling epoch=58   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_58(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_105 */
-  Activ_sw_info activ39_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 200704,
-    .general.input.stride.b = 802816,
-    .general.input.stride.h = 28672,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 0))) /* Equivalent hex address = 0x34100000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1214704))) /* Equivalent hex address = 0x721288f0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 802816,
-    .general.output.stride.h = 28672,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) /* Equivalent hex address = 0x341c4000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_105 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ39_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 11 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 1605632))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) /* Equivalent hex address = 0x341c4000UL */, 802816);
-
-}
-
-
-/* scheduling epoch=59   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_59(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_106 */
-  Quantizelinear_sw_info quantizelinear40_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 28,
-    .general.input.dim.tensor_w = 28,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 200704,
-    .general.input.stride.b = 802816,
-    .general.input.stride.h = 28672,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34100000UL + 802816))) /* Equivalent hex address = 0x341c4000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240544))) /* Equivalent hex address = 0x7212ede0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241680))) /* Equivalent hex address = 0x7212f250UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 28,
-    .general.output.dim.tensor_w = 28,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 200704,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_106 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear40_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_60') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_60') start function
-static void _ec_blob_cache_start_func_60(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=61   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_61(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_110 */
-  Dequantizelinear_sw_info dequantizelinear41_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240560))) /* Equivalent hex address = 0x7212edf0UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241696))) /* Equivalent hex address = 0x7212f260UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_110 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear41_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=62   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_62(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_111 */
-  Activ_sw_info activ42_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1215744))) /* Equivalent hex address = 0x72128d00UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_111 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ42_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=63   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_63(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_112 */
-  Quantizelinear_sw_info quantizelinear43_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241008))) /* Equivalent hex address = 0x7212efb0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242144))) /* Equivalent hex address = 0x7212f420UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_112 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear43_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_64') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_64') start function
-static void _ec_blob_cache_start_func_64(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=66   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_66(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_119 */
-  Dequantizelinear_sw_info dequantizelinear44_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240576))) /* Equivalent hex address = 0x7212ee00UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241712))) /* Equivalent hex address = 0x7212f270UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_119 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear44_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=67   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_67(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_120 */
-  Activ_sw_info activ45_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1216784))) /* Equivalent hex address = 0x72129110UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_120 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ45_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=68   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_68(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_121 */
-  Quantizelinear_sw_info quantizelinear46_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241024))) /* Equivalent hex address = 0x7212efc0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242160))) /* Equivalent hex address = 0x7212f430UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_121 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear46_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_69') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_69') start function
-static void _ec_blob_cache_start_func_69(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=70   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_70(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_125 */
-  Dequantizelinear_sw_info dequantizelinear47_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240592))) /* Equivalent hex address = 0x7212ee10UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241728))) /* Equivalent hex address = 0x7212f280UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_125 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear47_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=71   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_71(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_126 */
-  Activ_sw_info activ48_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1217824))) /* Equivalent hex address = 0x72129520UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_126 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ48_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=72   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_72(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_127 */
-  Quantizelinear_sw_info quantizelinear49_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241040))) /* Equivalent hex address = 0x7212efd0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242176))) /* Equivalent hex address = 0x7212f440UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_127 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear49_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_73') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_73') start function
-static void _ec_blob_cache_start_func_73(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=75   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_75(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_137 */
-  Dequantizelinear_sw_info dequantizelinear50_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240608))) /* Equivalent hex address = 0x7212ee20UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241744))) /* Equivalent hex address = 0x7212f290UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_137 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear50_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=76   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_76(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_138 */
-  Activ_sw_info activ51_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1218864))) /* Equivalent hex address = 0x72129930UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_138 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ51_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=77   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_77(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_139 */
-  Quantizelinear_sw_info quantizelinear52_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241056))) /* Equivalent hex address = 0x7212efe0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242192))) /* Equivalent hex address = 0x7212f450UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_139 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear52_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_78') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_78') start function
-static void _ec_blob_cache_start_func_78(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=79   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_79(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_143 */
-  Dequantizelinear_sw_info dequantizelinear53_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240624))) /* Equivalent hex address = 0x7212ee30UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241760))) /* Equivalent hex address = 0x7212f2a0UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_143 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear53_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=80   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_80(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_144 */
-  Activ_sw_info activ54_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1219904))) /* Equivalent hex address = 0x72129d40UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_144 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ54_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=81   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_81(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_145 */
-  Quantizelinear_sw_info quantizelinear55_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241072))) /* Equivalent hex address = 0x7212eff0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242208))) /* Equivalent hex address = 0x7212f460UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_145 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear55_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_82') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_82') start function
-static void _ec_blob_cache_start_func_82(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=84   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_84(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_155 */
-  Dequantizelinear_sw_info dequantizelinear56_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240640))) /* Equivalent hex address = 0x7212ee40UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241776))) /* Equivalent hex address = 0x7212f2b0UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_155 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear56_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=85   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_85(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_156 */
-  Activ_sw_info activ57_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1220944))) /* Equivalent hex address = 0x7212a150UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_156 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ57_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=86   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_86(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_157 */
-  Quantizelinear_sw_info quantizelinear58_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241088))) /* Equivalent hex address = 0x7212f000UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242224))) /* Equivalent hex address = 0x7212f470UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_157 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear58_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_87') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_87') start function
-static void _ec_blob_cache_start_func_87(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=88   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_88(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_161 */
-  Dequantizelinear_sw_info dequantizelinear59_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240656))) /* Equivalent hex address = 0x7212ee50UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241792))) /* Equivalent hex address = 0x7212f2c0UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_161 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear59_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=89   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_89(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_162 */
-  Activ_sw_info activ60_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1221984))) /* Equivalent hex address = 0x7212a560UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_162 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ60_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=90   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_90(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_163 */
-  Quantizelinear_sw_info quantizelinear61_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241104))) /* Equivalent hex address = 0x7212f010UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242240))) /* Equivalent hex address = 0x7212f480UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_163 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear61_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_91') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_91') start function
-static void _ec_blob_cache_start_func_91(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=93   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_93(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_173 */
-  Dequantizelinear_sw_info dequantizelinear62_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240672))) /* Equivalent hex address = 0x7212ee60UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241808))) /* Equivalent hex address = 0x7212f2d0UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_173 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear62_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=94   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_94(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_174 */
-  Activ_sw_info activ63_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1223024))) /* Equivalent hex address = 0x7212a970UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_174 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ63_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=95   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_95(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_175 */
-  Quantizelinear_sw_info quantizelinear64_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241120))) /* Equivalent hex address = 0x7212f020UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242256))) /* Equivalent hex address = 0x7212f490UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_175 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear64_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
-
-}
-
-
-// Epoch Controller Blob (name='_ec_blob_96') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_96') start function
-static void _ec_blob_cache_start_func_96(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=97   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_97(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_179 */
-  Dequantizelinear_sw_info dequantizelinear65_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240688))) /* Equivalent hex address = 0x7212ee70UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241824))) /* Equivalent hex address = 0x7212f2e0UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_179 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear65_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=98   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_98(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_180 */
-  Activ_sw_info activ66_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1224064))) /* Equivalent hex address = 0x7212ad80UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_180 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ66_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=99   nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_99(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_181 */
-  Quantizelinear_sw_info quantizelinear67_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241712))) /* Equivalent hex address = 0x7212f270UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1216784))) /* Equivalent hex address = 0x72129110UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241136))) /* Equivalent hex address = 0x7212f030UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241024))) /* Equivalent hex address = 0x7212efc0UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242272))) /* Equivalent hex address = 0x7212f4a0UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242160))) /* Equivalent hex address = 0x7212f430UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -4347,12 +1855,12 @@ static void LL_ATON_End_EpochBlock_99(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_181 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear67_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_120 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer14_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
@@ -4362,10 +1870,32 @@ static void LL_ATON_End_EpochBlock_99(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_100') micro instructions needed
+/* scheduling epoch=67   nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_100') start function
-static void _ec_blob_cache_start_func_100(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_67(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_120 fused into epoch 66 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=68   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_68(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_121 fused into epoch 66 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_69') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_69') start function
+static void _ec_blob_cache_start_func_69(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
@@ -4377,16 +1907,16 @@ static void _ec_blob_cache_start_func_100(const void *epoch_block) {
 };
 
 
-/* scheduling epoch=102  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=70   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_102(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_70(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_191 */
-  Dequantizelinear_sw_info dequantizelinear68_sw_info = {
+/* kind=PRelu node=PReLU_126 (fused: Dequantize_125 -> PReLU_126 -> Quantize_127) */
+  Prelu_integer_sw_info prelu_integer15_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 14,
@@ -4400,129 +1930,31 @@ static void LL_ATON_End_EpochBlock_102(const void *epoch_block)
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240704))) /* Equivalent hex address = 0x7212ee80UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240592))) /* Equivalent hex address = 0x7212ee10UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241840))) /* Equivalent hex address = 0x7212f2f0UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241728))) /* Equivalent hex address = 0x7212f280UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_191 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear68_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=103  nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_103(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_192 */
-  Activ_sw_info activ69_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1225104))) /* Equivalent hex address = 0x7212b190UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_192 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ69_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
-
-}
-
-
-/* scheduling epoch=104  nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_104(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_193 */
-  Quantizelinear_sw_info quantizelinear70_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1217824))) /* Equivalent hex address = 0x72129520UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241152))) /* Equivalent hex address = 0x7212f040UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241040))) /* Equivalent hex address = 0x7212efd0UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242288))) /* Equivalent hex address = 0x7212f4b0UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242176))) /* Equivalent hex address = 0x7212f440UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -4537,12 +1969,12 @@ static void LL_ATON_End_EpochBlock_104(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_193 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear70_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_126 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer15_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
@@ -4552,167 +1984,91 @@ static void LL_ATON_End_EpochBlock_104(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_105') micro instructions needed
-
-// Epoch Controller Blob (name='_ec_blob_105') start function
-static void _ec_blob_cache_start_func_105(const void *epoch_block) {
-  LL_ATON_LIB_UNUSED(epoch_block);
-
-  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
-
-};
-
-
-/* scheduling epoch=106  nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_106(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
+/* scheduling epoch=71   nodes=1   ------------------------------------------------------------------- */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_197 */
-  Dequantizelinear_sw_info dequantizelinear71_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 3584,
-    .general.input.stride.w = 256,
-    .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 1,
-    /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240720))) /* Equivalent hex address = 0x7212ee90UL */,
-    .is.format.is_signed = 1,
-    .is.dim.num_elem = 1,
-    /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241856))) /* Equivalent hex address = 0x7212f300UL */,
-    .izp.format.is_signed = 1,
-    .izp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
-  };
+static void LL_ATON_End_EpochBlock_71(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_197 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear71_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
+  /* PReLU_126 fused into epoch 70 (ll_sw_forward_prelu_integer) */
 
 }
 
 
-/* scheduling epoch=107  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=72   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_107(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_72(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* Quantize_127 fused into epoch 70 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_198 */
-  Activ_sw_info activ72_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1226144))) /* Equivalent hex address = 0x7212b5a0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_198 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ72_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
+
+// Epoch Controller Blob (name='_ec_blob_73') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_73') start function
+static void _ec_blob_cache_start_func_73(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
 
-}
+};
 
 
-/* scheduling epoch=108  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=75   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_108(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_75(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_199 */
-  Quantizelinear_sw_info quantizelinear73_sw_info = {
+/* kind=PRelu node=PReLU_138 (fused: Dequantize_137 -> PReLU_138 -> Quantize_139) */
+  Prelu_integer_sw_info prelu_integer16_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 14,
     .general.input.dim.tensor_w = 14,
     .general.input.dim.tensor_c = 256,
     .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
+    .general.input.stride.b = 50176,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 256,
+    .general.input.stride.c = 1,
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240608))) /* Equivalent hex address = 0x7212ee20UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241744))) /* Equivalent hex address = 0x7212f290UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1218864))) /* Equivalent hex address = 0x72129930UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241168))) /* Equivalent hex address = 0x7212f050UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241056))) /* Equivalent hex address = 0x7212efe0UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242304))) /* Equivalent hex address = 0x7212f4c0UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242192))) /* Equivalent hex address = 0x7212f450UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -4727,12 +2083,12 @@ static void LL_ATON_End_EpochBlock_108(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_199 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear73_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_138 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer16_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
@@ -4742,10 +2098,32 @@ static void LL_ATON_End_EpochBlock_108(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_109') micro instructions needed
+/* scheduling epoch=76   nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_109') start function
-static void _ec_blob_cache_start_func_109(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_76(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_138 fused into epoch 75 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=77   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_77(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_139 fused into epoch 75 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_78') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_78') start function
+static void _ec_blob_cache_start_func_78(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
@@ -4757,16 +2135,16 @@ static void _ec_blob_cache_start_func_109(const void *epoch_block) {
 };
 
 
-/* scheduling epoch=111  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=79   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_111(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_79(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_209 */
-  Dequantizelinear_sw_info dequantizelinear74_sw_info = {
+/* kind=PRelu node=PReLU_144 (fused: Dequantize_143 -> PReLU_144 -> Quantize_145) */
+  Prelu_integer_sw_info prelu_integer17_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 14,
@@ -4780,129 +2158,145 @@ static void LL_ATON_End_EpochBlock_111(const void *epoch_block)
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240736))) /* Equivalent hex address = 0x7212eea0UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240624))) /* Equivalent hex address = 0x7212ee30UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241872))) /* Equivalent hex address = 0x7212f310UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241760))) /* Equivalent hex address = 0x7212f2a0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1219904))) /* Equivalent hex address = 0x72129d40UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241072))) /* Equivalent hex address = 0x7212eff0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242208))) /* Equivalent hex address = 0x7212f460UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 14,
     .general.output.dim.tensor_w = 14,
     .general.output.dim.tensor_c = 256,
     .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.stride.b = 50176,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 256,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_209 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear74_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_144 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer17_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
 
 }
 
 
-/* scheduling epoch=112  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=80   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_112(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_80(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_144 fused into epoch 79 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_210 */
-  Activ_sw_info activ75_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1227184))) /* Equivalent hex address = 0x7212b9b0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_210 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ75_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
+
+/* scheduling epoch=81   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_81(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_145 fused into epoch 79 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_82') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_82') start function
+static void _ec_blob_cache_start_func_82(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
 
-}
+};
 
 
-/* scheduling epoch=113  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=84   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_113(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_84(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_211 */
-  Quantizelinear_sw_info quantizelinear76_sw_info = {
+/* kind=PRelu node=PReLU_156 (fused: Dequantize_155 -> PReLU_156 -> Quantize_157) */
+  Prelu_integer_sw_info prelu_integer18_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 14,
     .general.input.dim.tensor_w = 14,
     .general.input.dim.tensor_c = 256,
     .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
+    .general.input.stride.b = 50176,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 256,
+    .general.input.stride.c = 1,
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240640))) /* Equivalent hex address = 0x7212ee40UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241776))) /* Equivalent hex address = 0x7212f2b0UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1220944))) /* Equivalent hex address = 0x7212a150UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241184))) /* Equivalent hex address = 0x7212f060UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241088))) /* Equivalent hex address = 0x7212f000UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242320))) /* Equivalent hex address = 0x7212f4d0UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242224))) /* Equivalent hex address = 0x7212f470UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -4917,12 +2311,12 @@ static void LL_ATON_End_EpochBlock_113(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_211 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear76_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_156 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer18_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
@@ -4932,10 +2326,32 @@ static void LL_ATON_End_EpochBlock_113(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_114') micro instructions needed
+/* scheduling epoch=85   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_85(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_156 fused into epoch 84 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=86   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_86(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_157 fused into epoch 84 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_87') micro instructions needed
 
-// Epoch Controller Blob (name='_ec_blob_114') start function
-static void _ec_blob_cache_start_func_114(const void *epoch_block) {
+// Epoch Controller Blob (name='_ec_blob_87') start function
+static void _ec_blob_cache_start_func_87(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
@@ -4947,16 +2363,16 @@ static void _ec_blob_cache_start_func_114(const void *epoch_block) {
 };
 
 
-/* scheduling epoch=115  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=88   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_115(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_88(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_215 */
-  Dequantizelinear_sw_info dequantizelinear77_sw_info = {
+/* kind=PRelu node=PReLU_162 (fused: Dequantize_161 -> PReLU_162 -> Quantize_163) */
+  Prelu_integer_sw_info prelu_integer19_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 14,
@@ -4970,129 +2386,145 @@ static void LL_ATON_End_EpochBlock_115(const void *epoch_block)
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240752))) /* Equivalent hex address = 0x7212eeb0UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240656))) /* Equivalent hex address = 0x7212ee50UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241888))) /* Equivalent hex address = 0x7212f320UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241792))) /* Equivalent hex address = 0x7212f2c0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1221984))) /* Equivalent hex address = 0x7212a560UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241104))) /* Equivalent hex address = 0x7212f010UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242240))) /* Equivalent hex address = 0x7212f480UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 14,
     .general.output.dim.tensor_w = 14,
     .general.output.dim.tensor_c = 256,
     .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.stride.b = 50176,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 256,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_215 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear77_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_162 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer19_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 200704);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
 
 }
 
 
-/* scheduling epoch=116  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=89   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_116(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_89(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_162 fused into epoch 88 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_216 */
-  Activ_sw_info activ78_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1228224))) /* Equivalent hex address = 0x7212bdc0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 50176,
-    .general.output.stride.b = 200704,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_216 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ78_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
+
+/* scheduling epoch=90   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_90(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_163 fused into epoch 88 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_91') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_91') start function
+static void _ec_blob_cache_start_func_91(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 200704);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
 
-}
+};
 
 
-/* scheduling epoch=117  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=93   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_117(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_93(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_217 */
-  Quantizelinear_sw_info quantizelinear79_sw_info = {
+/* kind=PRelu node=PReLU_174 (fused: Dequantize_173 -> PReLU_174 -> Quantize_175) */
+  Prelu_integer_sw_info prelu_integer20_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 14,
     .general.input.dim.tensor_w = 14,
     .general.input.dim.tensor_c = 256,
     .general.input.dim.num_elem = 50176,
-    .general.input.stride.b = 200704,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
+    .general.input.stride.b = 50176,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 256,
+    .general.input.stride.c = 1,
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240672))) /* Equivalent hex address = 0x7212ee60UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241808))) /* Equivalent hex address = 0x7212f2d0UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1223024))) /* Equivalent hex address = 0x7212a970UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241200))) /* Equivalent hex address = 0x7212f070UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241120))) /* Equivalent hex address = 0x7212f020UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242336))) /* Equivalent hex address = 0x7212f4e0UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242256))) /* Equivalent hex address = 0x7212f490UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -5107,12 +2539,12 @@ static void LL_ATON_End_EpochBlock_117(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_217 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear79_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_174 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer20_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
@@ -5122,737 +2554,889 @@ static void LL_ATON_End_EpochBlock_117(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_118') micro instructions needed
+/* scheduling epoch=94   nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_118') start function
-static void _ec_blob_cache_start_func_118(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_94(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_174 fused into epoch 93 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=95   nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_95(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_175 fused into epoch 93 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_96') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_96') start function
+static void _ec_blob_cache_start_func_96(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 100352))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 100352);
+  /*     memory pool: 1 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
 
 };
 
 
-/* scheduling epoch=120  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=97   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_120(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_97(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_227 */
-  Dequantizelinear_sw_info dequantizelinear80_sw_info = {
+/* kind=PRelu node=PReLU_180 (fused: Dequantize_179 -> PReLU_180 -> Quantize_181) */
+  Prelu_integer_sw_info prelu_integer21_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 14,
     .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 512,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 100352,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 512,
+    .general.input.dim.tensor_c = 256,
+    .general.input.dim.num_elem = 50176,
+    .general.input.stride.b = 50176,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 256,
     .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240496))) /* Equivalent hex address = 0x7212edb0UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240688))) /* Equivalent hex address = 0x7212ee70UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241632))) /* Equivalent hex address = 0x7212f220UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241824))) /* Equivalent hex address = 0x7212f2e0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1224064))) /* Equivalent hex address = 0x7212ad80UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241136))) /* Equivalent hex address = 0x7212f030UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242272))) /* Equivalent hex address = 0x7212f4a0UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 14,
     .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 512,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 28672,
-    .general.output.stride.w = 2048,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.dim.tensor_c = 256,
+    .general.output.dim.num_elem = 50176,
+    .general.output.stride.b = 50176,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 256,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_227 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear80_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_180 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer21_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 401408);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
 
 }
 
 
-/* scheduling epoch=121  nodes=1   ------------------------------------------------------------------- */
-
-static void LL_ATON_End_EpochBlock_121(const void *epoch_block)
-{
-  LL_ATON_LIB_UNUSED(epoch_block);
-
+/* scheduling epoch=98   nodes=1   ------------------------------------------------------------------- */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_228 */
-  Activ_sw_info activ81_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 14,
-    .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 512,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 28672,
-    .general.input.stride.w = 2048,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 513,
-    .operand.dim.num_elem = 513,
-    .operand.stride.b = 2052,
-    .operand.stride.h = 2052,
-    .operand.stride.w = 2052,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1204736))) /* Equivalent hex address = 0x72126200UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 14,
-    .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 512,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 401408,
-    .general.output.stride.h = 28672,
-    .general.output.stride.w = 2048,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+static void LL_ATON_End_EpochBlock_98(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_228 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ81_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 2 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 401408))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 401408);
+  /* PReLU_180 fused into epoch 97 (ll_sw_forward_prelu_integer) */
 
 }
 
 
-/* scheduling epoch=122  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=99   nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_122(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_99(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_181 fused into epoch 97 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_100') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_100') start function
+static void _ec_blob_cache_start_func_100(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
+  /*     memory pool: 1 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
+
+};
+
+
+/* scheduling epoch=102  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_102(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_229 */
-  Quantizelinear_sw_info quantizelinear82_sw_info = {
+/* kind=PRelu node=PReLU_192 (fused: Dequantize_191 -> PReLU_192 -> Quantize_193) */
+  Prelu_integer_sw_info prelu_integer22_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 14,
     .general.input.dim.tensor_w = 14,
-    .general.input.dim.tensor_c = 512,
-    .general.input.dim.num_elem = 100352,
-    .general.input.stride.b = 401408,
-    .general.input.stride.h = 28672,
-    .general.input.stride.w = 2048,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.dim.tensor_c = 256,
+    .general.input.dim.num_elem = 50176,
+    .general.input.stride.b = 50176,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 256,
+    .general.input.stride.c = 1,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240704))) /* Equivalent hex address = 0x7212ee80UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241840))) /* Equivalent hex address = 0x7212f2f0UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1225104))) /* Equivalent hex address = 0x7212b190UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240912))) /* Equivalent hex address = 0x7212ef50UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241152))) /* Equivalent hex address = 0x7212f040UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242048))) /* Equivalent hex address = 0x7212f3c0UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242288))) /* Equivalent hex address = 0x7212f4b0UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 14,
     .general.output.dim.tensor_w = 14,
-    .general.output.dim.tensor_c = 512,
-    .general.output.dim.num_elem = 100352,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 512,
+    .general.output.dim.tensor_c = 256,
+    .general.output.dim.num_elem = 50176,
+    .general.output.stride.b = 50176,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 256,
     .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_229 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear82_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_192 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer22_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
 
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_123') micro instructions needed
+/* scheduling epoch=103  nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_123') start function
-static void _ec_blob_cache_start_func_123(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_103(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_192 fused into epoch 102 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=104  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_104(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_193 fused into epoch 102 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_105') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_105') start function
+static void _ec_blob_cache_start_func_105(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 125440))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */, 25088);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
 
 };
 
 
-/* scheduling epoch=124  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=106  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_124(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_106(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_233 */
-  Dequantizelinear_sw_info dequantizelinear83_sw_info = {
+/* kind=PRelu node=PReLU_198 (fused: Dequantize_197 -> PReLU_198 -> Quantize_199) */
+  Prelu_integer_sw_info prelu_integer23_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 512,
-    .general.input.dim.num_elem = 25088,
-    .general.input.stride.b = 25088,
+    .general.input.dim.tensor_h = 14,
+    .general.input.dim.tensor_w = 14,
+    .general.input.dim.tensor_c = 256,
+    .general.input.dim.num_elem = 50176,
+    .general.input.stride.b = 50176,
     .general.input.stride.h = 3584,
-    .general.input.stride.w = 512,
+    .general.input.stride.w = 256,
     .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240928))) /* Equivalent hex address = 0x7212ef60UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240720))) /* Equivalent hex address = 0x7212ee90UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242064))) /* Equivalent hex address = 0x7212f3d0UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241856))) /* Equivalent hex address = 0x7212f300UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1226144))) /* Equivalent hex address = 0x7212b5a0UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241168))) /* Equivalent hex address = 0x7212f050UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242304))) /* Equivalent hex address = 0x7212f4c0UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 512,
-    .general.output.dim.num_elem = 25088,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 2048,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.dim.tensor_h = 14,
+    .general.output.dim.tensor_w = 14,
+    .general.output.dim.tensor_c = 256,
+    .general.output.dim.num_elem = 50176,
+    .general.output.stride.b = 50176,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 256,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_233 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear83_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_198 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer23_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
 
 }
 
 
-/* scheduling epoch=125  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=107  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_125(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_107(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_198 fused into epoch 106 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_234 */
-  Activ_sw_info activ84_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 512,
-    .general.input.dim.num_elem = 25088,
-    .general.input.stride.b = 100352,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 2048,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 513,
-    .operand.dim.num_elem = 513,
-    .operand.stride.b = 2052,
-    .operand.stride.h = 2052,
-    .operand.stride.w = 2052,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1206800))) /* Equivalent hex address = 0x72126a10UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 512,
-    .general.output.dim.num_elem = 25088,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 2048,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_234 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ84_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */, 100352);
+
+/* scheduling epoch=108  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_108(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_199 fused into epoch 106 (ll_sw_forward_prelu_integer) */
 
 }
 
 
-/* scheduling epoch=126  nodes=1   ------------------------------------------------------------------- */
+// Epoch Controller Blob (name='_ec_blob_109') micro instructions needed
 
-static void LL_ATON_End_EpochBlock_126(const void *epoch_block)
+// Epoch Controller Blob (name='_ec_blob_109') start function
+static void _ec_blob_cache_start_func_109(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
+  /*     memory pool: 1 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
+
+};
+
+
+/* scheduling epoch=111  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_111(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_235 */
-  Quantizelinear_sw_info quantizelinear85_sw_info = {
+/* kind=PRelu node=PReLU_210 (fused: Dequantize_209 -> PReLU_210 -> Quantize_211) */
+  Prelu_integer_sw_info prelu_integer24_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 512,
-    .general.input.dim.num_elem = 25088,
-    .general.input.stride.b = 100352,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 2048,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.dim.tensor_h = 14,
+    .general.input.dim.tensor_w = 14,
+    .general.input.dim.tensor_c = 256,
+    .general.input.dim.num_elem = 50176,
+    .general.input.stride.b = 50176,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 256,
+    .general.input.stride.c = 1,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240736))) /* Equivalent hex address = 0x7212eea0UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241872))) /* Equivalent hex address = 0x7212f310UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1227184))) /* Equivalent hex address = 0x7212b9b0UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241296))) /* Equivalent hex address = 0x7212f0d0UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241184))) /* Equivalent hex address = 0x7212f060UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242432))) /* Equivalent hex address = 0x7212f540UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242320))) /* Equivalent hex address = 0x7212f4d0UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 512,
-    .general.output.dim.num_elem = 25088,
-    .general.output.stride.b = 25088,
+    .general.output.dim.tensor_h = 14,
+    .general.output.dim.tensor_w = 14,
+    .general.output.dim.tensor_c = 256,
+    .general.output.dim.num_elem = 50176,
+    .general.output.stride.b = 50176,
     .general.output.stride.h = 3584,
-    .general.output.stride.w = 512,
+    .general.output.stride.w = 256,
     .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_235 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear85_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_210 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer24_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 25088))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 25088);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
 
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_127') micro instructions needed
+/* scheduling epoch=112  nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_127') start function
-static void _ec_blob_cache_start_func_127(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_112(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_210 fused into epoch 111 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=113  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_113(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_211 fused into epoch 111 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_114') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_114') start function
+static void _ec_blob_cache_start_func_114(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 62720))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */, 12544);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 250880))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */, 50176);
 
 };
 
 
-/* scheduling epoch=129  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=115  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_129(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_115(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_242 */
-  Dequantizelinear_sw_info dequantizelinear86_sw_info = {
+/* kind=PRelu node=PReLU_216 (fused: Dequantize_215 -> PReLU_216 -> Quantize_217) */
+  Prelu_integer_sw_info prelu_integer25_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
+    .general.input.dim.tensor_h = 14,
+    .general.input.dim.tensor_w = 14,
     .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 12544,
-    .general.input.stride.h = 1792,
+    .general.input.dim.num_elem = 50176,
+    .general.input.stride.b = 50176,
+    .general.input.stride.h = 3584,
     .general.input.stride.w = 256,
     .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) /* Equivalent hex address = 0x34311000UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241216))) /* Equivalent hex address = 0x7212f080UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240752))) /* Equivalent hex address = 0x7212eeb0UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242352))) /* Equivalent hex address = 0x7212f4f0UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241888))) /* Equivalent hex address = 0x7212f320UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1228224))) /* Equivalent hex address = 0x7212bdc0UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241200))) /* Equivalent hex address = 0x7212f070UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242336))) /* Equivalent hex address = 0x7212f4e0UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
+    .general.output.dim.tensor_h = 14,
+    .general.output.dim.tensor_w = 14,
     .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 12544,
+    .general.output.dim.num_elem = 50176,
     .general.output.stride.b = 50176,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 256,
+    .general.output.stride.c = 1,
+    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_242 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear86_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_216 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer25_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 50176);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 451584))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 401408))) /* Equivalent hex address = 0x34342000UL */, 50176);
 
 }
 
 
-/* scheduling epoch=130  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=116  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_130(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_116(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_216 fused into epoch 115 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_243 */
-  Activ_sw_info activ87_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1229264))) /* Equivalent hex address = 0x7212c1d0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_243 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ87_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */, 50176);
+
+/* scheduling epoch=117  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_117(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_217 fused into epoch 115 (ll_sw_forward_prelu_integer) */
 
 }
 
 
-/* scheduling epoch=131  nodes=1   ------------------------------------------------------------------- */
+// Epoch Controller Blob (name='_ec_blob_118') micro instructions needed
 
-static void LL_ATON_End_EpochBlock_131(const void *epoch_block)
+// Epoch Controller Blob (name='_ec_blob_118') start function
+static void _ec_blob_cache_start_func_118(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
+  /*     memory pool: 2 */
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 100352))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */, 100352);
+
+};
+
+
+/* scheduling epoch=120  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_120(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_244 */
-  Quantizelinear_sw_info quantizelinear88_sw_info = {
+/* kind=PRelu node=PReLU_228 (fused: Dequantize_227 -> PReLU_228 -> Quantize_229) */
+  Prelu_integer_sw_info prelu_integer26_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 50176,
+    .general.input.dim.tensor_h = 14,
+    .general.input.dim.tensor_w = 14,
+    .general.input.dim.tensor_c = 512,
+    .general.input.dim.num_elem = 100352,
+    .general.input.stride.b = 100352,
     .general.input.stride.h = 7168,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.stride.w = 512,
+    .general.input.stride.c = 1,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x34270000UL + 0))) /* Equivalent hex address = 0x34270000UL */,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240496))) /* Equivalent hex address = 0x7212edb0UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241632))) /* Equivalent hex address = 0x7212f220UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 513,
+    .slope.dim.num_elem = 513,
+    .slope.stride.b = 2052,
+    .slope.stride.h = 2052,
+    .slope.stride.w = 2052,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1204736))) /* Equivalent hex address = 0x72126200UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241328))) /* Equivalent hex address = 0x7212f0f0UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240912))) /* Equivalent hex address = 0x7212ef50UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242464))) /* Equivalent hex address = 0x7212f560UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242048))) /* Equivalent hex address = 0x7212f3c0UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 12544,
-    .general.output.stride.h = 1792,
-    .general.output.stride.w = 256,
+    .general.output.dim.tensor_h = 14,
+    .general.output.dim.tensor_w = 14,
+    .general.output.dim.tensor_c = 512,
+    .general.output.dim.num_elem = 100352,
+    .general.output.stride.b = 100352,
+    .general.output.stride.h = 7168,
+    .general.output.stride.w = 512,
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_244 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear88_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_228 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer26_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 12544))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 12544);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
+
+}
+
+
+/* scheduling epoch=121  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_121(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_228 fused into epoch 120 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=122  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_122(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_229 fused into epoch 120 (ll_sw_forward_prelu_integer) */
 
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_132') micro instructions needed
+// Epoch Controller Blob (name='_ec_blob_123') micro instructions needed
 
-// Epoch Controller Blob (name='_ec_blob_132') start function
-static void _ec_blob_cache_start_func_132(const void *epoch_block) {
+// Epoch Controller Blob (name='_ec_blob_123') start function
+static void _ec_blob_cache_start_func_123(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 62720))) */
-  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */, 12544);
+  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 125440))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */, 25088);
 
 };
 
 
-/* scheduling epoch=133  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=124  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_133(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_124(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_248 */
-  Dequantizelinear_sw_info dequantizelinear89_sw_info = {
+/* kind=PRelu node=PReLU_234 (fused: Dequantize_233 -> PReLU_234 -> Quantize_235) */
+  Prelu_integer_sw_info prelu_integer27_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 7,
     .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 12544,
-    .general.input.stride.h = 1792,
-    .general.input.stride.w = 256,
+    .general.input.dim.tensor_c = 512,
+    .general.input.dim.num_elem = 25088,
+    .general.input.stride.b = 25088,
+    .general.input.stride.h = 3584,
+    .general.input.stride.w = 512,
     .general.input.stride.c = 1,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
+    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241232))) /* Equivalent hex address = 0x7212f090UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1240928))) /* Equivalent hex address = 0x7212ef60UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242368))) /* Equivalent hex address = 0x7212f500UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242064))) /* Equivalent hex address = 0x7212f3d0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 513,
+    .slope.dim.num_elem = 513,
+    .slope.stride.b = 2052,
+    .slope.stride.h = 2052,
+    .slope.stride.w = 2052,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1206800))) /* Equivalent hex address = 0x72126a10UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241296))) /* Equivalent hex address = 0x7212f0d0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242432))) /* Equivalent hex address = 0x7212f540UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 7,
     .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
+    .general.output.dim.tensor_c = 512,
+    .general.output.dim.num_elem = 25088,
+    .general.output.stride.b = 25088,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 512,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_248 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear89_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_234 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer27_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 50176);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 25088))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 25088);
 
 }
 
 
-/* scheduling epoch=134  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=125  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_134(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_125(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_234 fused into epoch 124 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_249 */
-  Activ_sw_info activ90_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1230304))) /* Equivalent hex address = 0x7212c5e0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_249 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ90_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
+
+/* scheduling epoch=126  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_126(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_235 fused into epoch 124 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_127') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_127') start function
+static void _ec_blob_cache_start_func_127(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */, 50176);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 62720))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */, 12544);
 
-}
+};
 
 
-/* scheduling epoch=135  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=129  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_135(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_129(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_250 */
-  Quantizelinear_sw_info quantizelinear91_sw_info = {
+/* kind=PRelu node=PReLU_243 (fused: Dequantize_242 -> PReLU_243 -> Quantize_244) */
+  Prelu_integer_sw_info prelu_integer28_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 7,
     .general.input.dim.tensor_w = 7,
     .general.input.dim.tensor_c = 256,
     .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
+    .general.input.stride.b = 12544,
+    .general.input.stride.h = 1792,
+    .general.input.stride.w = 256,
+    .general.input.stride.c = 1,
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241216))) /* Equivalent hex address = 0x7212f080UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242352))) /* Equivalent hex address = 0x7212f4f0UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1229264))) /* Equivalent hex address = 0x7212c1d0UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241344))) /* Equivalent hex address = 0x7212f100UL */,
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241328))) /* Equivalent hex address = 0x7212f0f0UL */,
     .os.format.is_signed = 1,
     .os.dim.num_elem = 1,
     /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242480))) /* Equivalent hex address = 0x7212f570UL */,
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242464))) /* Equivalent hex address = 0x7212f560UL */,
     .ozp.format.is_signed = 1,
     .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
@@ -5867,12 +3451,12 @@ static void LL_ATON_End_EpochBlock_135(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_250 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear91_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_243 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer28_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
@@ -5882,10 +3466,32 @@ static void LL_ATON_End_EpochBlock_135(const void *epoch_block)
 }
 
 
-// Epoch Controller Blob (name='_ec_blob_136') micro instructions needed
+/* scheduling epoch=130  nodes=1   ------------------------------------------------------------------- */
 
-// Epoch Controller Blob (name='_ec_blob_136') start function
-static void _ec_blob_cache_start_func_136(const void *epoch_block) {
+static void LL_ATON_End_EpochBlock_130(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_243 fused into epoch 129 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=131  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_131(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_244 fused into epoch 129 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_132') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_132') start function
+static void _ec_blob_cache_start_func_132(const void *epoch_block) {
   LL_ATON_LIB_UNUSED(epoch_block);
 
   /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
@@ -5897,16 +3503,16 @@ static void _ec_blob_cache_start_func_136(const void *epoch_block) {
 };
 
 
-/* scheduling epoch=138  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=133  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_138(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_133(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_260 */
-  Dequantizelinear_sw_info dequantizelinear92_sw_info = {
+/* kind=PRelu node=PReLU_249 (fused: Dequantize_248 -> PReLU_249 -> Quantize_250) */
+  Prelu_integer_sw_info prelu_integer29_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 7,
@@ -5920,123 +3526,139 @@ static void LL_ATON_End_EpochBlock_138(const void *epoch_block)
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
     .general.input.format.is_signed = 1,
     /* "is" tensor-related info: */
-    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241248))) /* Equivalent hex address = 0x7212f0a0UL */,
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241232))) /* Equivalent hex address = 0x7212f090UL */,
     .is.format.is_signed = 1,
     .is.dim.num_elem = 1,
     /* "izp" tensor-related info: */
-    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242384))) /* Equivalent hex address = 0x7212f510UL */,
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242368))) /* Equivalent hex address = 0x7212f500UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1230304))) /* Equivalent hex address = 0x7212c5e0UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241344))) /* Equivalent hex address = 0x7212f100UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242480))) /* Equivalent hex address = 0x7212f570UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 7,
     .general.output.dim.tensor_w = 7,
     .general.output.dim.tensor_c = 256,
     .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
+    .general.output.stride.b = 12544,
+    .general.output.stride.h = 1792,
+    .general.output.stride.w = 256,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_260 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear92_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_249 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer29_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 50176);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 12544))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 12544);
 
 }
 
 
-/* scheduling epoch=139  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=134  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_139(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_134(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
+  /* PReLU_249 fused into epoch 133 (ll_sw_forward_prelu_integer) */
 
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_261 */
-  Activ_sw_info activ93_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1231344))) /* Equivalent hex address = 0x7212c9f0UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
+}
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_261 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ93_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
+
+/* scheduling epoch=135  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_135(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_250 fused into epoch 133 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+// Epoch Controller Blob (name='_ec_blob_136') micro instructions needed
+
+// Epoch Controller Blob (name='_ec_blob_136') start function
+static void _ec_blob_cache_start_func_136(const void *epoch_block) {
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* *** MCU cache invalidate (only) operation (HW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */, 50176);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 62720))) */
+  LL_ATON_Cache_MCU_Invalidate_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */, 12544);
 
-}
+};
 
 
-/* scheduling epoch=140  nodes=1   ------------------------------------------------------------------- */
+/* scheduling epoch=138  nodes=1   ------------------------------------------------------------------- */
 
-static void LL_ATON_End_EpochBlock_140(const void *epoch_block)
+static void LL_ATON_End_EpochBlock_138(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_262 */
-  Quantizelinear_sw_info quantizelinear94_sw_info = {
+/* kind=PRelu node=PReLU_261 (fused: Dequantize_260 -> PReLU_261 -> Quantize_262) */
+  Prelu_integer_sw_info prelu_integer30_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 7,
     .general.input.dim.tensor_w = 7,
     .general.input.dim.tensor_c = 256,
     .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
+    .general.input.stride.b = 12544,
+    .general.input.stride.h = 1792,
+    .general.input.stride.w = 256,
+    .general.input.stride.c = 1,
     .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
-    .general.input.format.is_signed = 0,
+    .general.input.format.is_signed = 1,
+    /* "is" tensor-related info: */
+    .is.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241248))) /* Equivalent hex address = 0x7212f0a0UL */,
+    .is.format.is_signed = 1,
+    .is.dim.num_elem = 1,
+    /* "izp" tensor-related info: */
+    .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242384))) /* Equivalent hex address = 0x7212f510UL */,
+    .izp.format.is_signed = 1,
+    .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1231344))) /* Equivalent hex address = 0x7212c9f0UL */,
+    .slope.format.is_signed = 0,
     /* "os" tensor-related info: */
     .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241360))) /* Equivalent hex address = 0x7212f110UL */,
     .os.format.is_signed = 1,
@@ -6057,12 +3679,12 @@ static void LL_ATON_End_EpochBlock_140(const void *epoch_block)
     .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
     .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_262 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear94_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_261 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer30_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
@@ -6072,6 +3694,28 @@ static void LL_ATON_End_EpochBlock_140(const void *epoch_block)
 }
 
 
+/* scheduling epoch=139  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_139(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* PReLU_261 fused into epoch 138 (ll_sw_forward_prelu_integer) */
+
+}
+
+
+/* scheduling epoch=140  nodes=1   ------------------------------------------------------------------- */
+
+static void LL_ATON_End_EpochBlock_140(const void *epoch_block)
+{
+  LL_ATON_LIB_UNUSED(epoch_block);
+
+  /* Quantize_262 fused into epoch 138 (ll_sw_forward_prelu_integer) */
+
+}
+
+
 // Epoch Controller Blob (name='_ec_blob_141') micro instructions needed
 
 // Epoch Controller Blob (name='_ec_blob_141') start function
@@ -6095,8 +3739,8 @@ static void LL_ATON_End_EpochBlock_142(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_266 */
-  Dequantizelinear_sw_info dequantizelinear95_sw_info = {
+/* kind=PRelu node=PReLU_267 (fused: Dequantize_266 -> PReLU_267 -> Quantize_268) */
+  Prelu_integer_sw_info prelu_integer31_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 7,
@@ -6117,29 +3761,49 @@ static void LL_ATON_End_EpochBlock_142(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242400))) /* Equivalent hex address = 0x7212f520UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 257,
+    .slope.dim.num_elem = 257,
+    .slope.stride.b = 1028,
+    .slope.stride.h = 1028,
+    .slope.stride.w = 1028,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1232384))) /* Equivalent hex address = 0x7212ce00UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241376))) /* Equivalent hex address = 0x7212f120UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242512))) /* Equivalent hex address = 0x7212f590UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 7,
     .general.output.dim.tensor_w = 7,
     .general.output.dim.tensor_c = 256,
     .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
+    .general.output.stride.b = 12544,
+    .general.output.stride.h = 1792,
+    .general.output.stride.w = 256,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_266 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear95_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_267 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer31_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 50176);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 12544))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 12544);
 
 }
 
@@ -6150,57 +3814,7 @@ static void LL_ATON_End_EpochBlock_143(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_267 */
-  Activ_sw_info activ96_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 257,
-    .operand.dim.num_elem = 257,
-    .operand.stride.b = 1028,
-    .operand.stride.h = 1028,
-    .operand.stride.w = 1028,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1232384))) /* Equivalent hex address = 0x7212ce00UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 50176,
-    .general.output.stride.h = 7168,
-    .general.output.stride.w = 1024,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_267 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ96_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */, 50176);
+  /* PReLU_267 fused into epoch 142 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -6211,53 +3825,7 @@ static void LL_ATON_End_EpochBlock_144(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_268 */
-  Quantizelinear_sw_info quantizelinear97_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 256,
-    .general.input.dim.num_elem = 12544,
-    .general.input.stride.b = 50176,
-    .general.input.stride.h = 7168,
-    .general.input.stride.w = 1024,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 50176))) /* Equivalent hex address = 0x342ec400UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241376))) /* Equivalent hex address = 0x7212f120UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242512))) /* Equivalent hex address = 0x7212f590UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 256,
-    .general.output.dim.num_elem = 12544,
-    .general.output.stride.b = 12544,
-    .general.output.stride.h = 1792,
-    .general.output.stride.w = 256,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_268 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear97_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 12544))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 12544);
+  /* Quantize_268 fused into epoch 142 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -6285,8 +3853,8 @@ static void LL_ATON_End_EpochBlock_147(const void *epoch_block)
 
 
 /* Unit= 27 [PROCESSOR 0] */
-/* kind=DequantizeLinear node=Dequantize_278 */
-  Dequantizelinear_sw_info dequantizelinear98_sw_info = {
+/* kind=PRelu node=PReLU_279 (fused: Dequantize_278 -> PReLU_279 -> Quantize_280) */
+  Prelu_integer_sw_info prelu_integer32_sw_info = {
     /* "general.input" tensor-related info: */
     .general.input.dim.tensor_b = 1,
     .general.input.dim.tensor_h = 7,
@@ -6307,29 +3875,49 @@ static void LL_ATON_End_EpochBlock_147(const void *epoch_block)
     .izp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242080))) /* Equivalent hex address = 0x7212f3e0UL */,
     .izp.format.is_signed = 1,
     .izp.dim.num_elem = 1,
+    /* "slope" tensor-related info: */
+    .slope.dim.tensor_b = 1,
+    .slope.dim.tensor_h = 1,
+    .slope.dim.tensor_w = 1,
+    .slope.dim.tensor_c = 513,
+    .slope.dim.num_elem = 513,
+    .slope.stride.b = 2052,
+    .slope.stride.h = 2052,
+    .slope.stride.w = 2052,
+    .slope.stride.c = 4,
+    .slope.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1208864))) /* Equivalent hex address = 0x72127220UL */,
+    .slope.format.is_signed = 0,
+    /* "os" tensor-related info: */
+    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241312))) /* Equivalent hex address = 0x7212f0e0UL */,
+    .os.format.is_signed = 1,
+    .os.dim.num_elem = 1,
+    /* "ozp" tensor-related info: */
+    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242448))) /* Equivalent hex address = 0x7212f550UL */,
+    .ozp.format.is_signed = 1,
+    .ozp.dim.num_elem = 1,
     /* "general.output" tensor-related info: */
     .general.output.dim.tensor_b = 1,
     .general.output.dim.tensor_h = 7,
     .general.output.dim.tensor_w = 7,
     .general.output.dim.tensor_c = 512,
     .general.output.dim.num_elem = 25088,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 2048,
-    .general.output.stride.c = 4,
+    .general.output.stride.b = 25088,
+    .general.output.stride.h = 3584,
+    .general.output.stride.w = 512,
+    .general.output.stride.c = 1,
     .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_DEQUANTIZELINEAR,
+    .general.output.format.is_signed = 1,
+    .general.type = LL_SW_PRELU,
   };
 
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Dequantize_278 mapped on EmbedNets (INTEGER) as DequantizeLinear | Category: Format-Converter */
-  ll_sw_forward_dequantizelinear(&dequantizelinear98_sw_info);
+  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */
+  /* Node PReLU_279 mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */
+  ll_sw_forward_prelu_integer(&prelu_integer32_sw_info);
   /* *** MCU cache clean (only) operation (SW, whole range) *** */
   /*     memory pool: 1 */
   /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 100352);
+  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 25088))) */
+  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 25088);
 
 }
 
@@ -6340,57 +3928,7 @@ static void LL_ATON_End_EpochBlock_148(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=PRelu node=PReLU_279 */
-  Activ_sw_info activ99_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 512,
-    .general.input.dim.num_elem = 25088,
-    .general.input.stride.b = 100352,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 2048,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.input.format.is_signed = 0,
-    /* "operand" tensor-related info: */
-    .operand.dim.tensor_b = 1,
-    .operand.dim.tensor_h = 1,
-    .operand.dim.tensor_w = 1,
-    .operand.dim.tensor_c = 513,
-    .operand.dim.num_elem = 513,
-    .operand.stride.b = 2052,
-    .operand.stride.h = 2052,
-    .operand.stride.w = 2052,
-    .operand.stride.c = 4,
-    .operand.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1208864))) /* Equivalent hex address = 0x72127220UL */,
-    .operand.format.is_signed = 0,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 512,
-    .general.output.dim.num_elem = 25088,
-    .general.output.stride.b = 100352,
-    .general.output.stride.h = 14336,
-    .general.output.stride.w = 2048,
-    .general.output.stride.c = 4,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */,
-    .general.output.format.is_signed = 0,
-    .general.type = LL_SW_PRELU,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node PReLU_279 mapped on EmbedNets (FLOAT) as PRelu | Category: Computational */
-  ll_sw_forward_activ(&activ99_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 200704))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */, 100352);
+  /* PReLU_279 fused into epoch 147 (ll_sw_forward_prelu_integer) */
 
 }
 
@@ -6401,53 +3939,7 @@ static void LL_ATON_End_EpochBlock_149(const void *epoch_block)
 {
   LL_ATON_LIB_UNUSED(epoch_block);
 
-
-/* Unit= 27 [PROCESSOR 0] */
-/* kind=QuantizeLinear node=Quantize_280 */
-  Quantizelinear_sw_info quantizelinear100_sw_info = {
-    /* "general.input" tensor-related info: */
-    .general.input.dim.tensor_b = 1,
-    .general.input.dim.tensor_h = 7,
-    .general.input.dim.tensor_w = 7,
-    .general.input.dim.tensor_c = 512,
-    .general.input.dim.num_elem = 25088,
-    .general.input.stride.b = 100352,
-    .general.input.stride.h = 14336,
-    .general.input.stride.w = 2048,
-    .general.input.stride.c = 4,
-    .general.input.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 100352))) /* Equivalent hex address = 0x342f8800UL */,
-    .general.input.format.is_signed = 0,
-    /* "os" tensor-related info: */
-    .os.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1241312))) /* Equivalent hex address = 0x7212f0e0UL */,
-    .os.format.is_signed = 1,
-    .os.dim.num_elem = 1,
-    /* "ozp" tensor-related info: */
-    .ozp.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x72000000UL + 1242448))) /* Equivalent hex address = 0x7212f550UL */,
-    .ozp.format.is_signed = 1,
-    .ozp.dim.num_elem = 1,
-    /* "general.output" tensor-related info: */
-    .general.output.dim.tensor_b = 1,
-    .general.output.dim.tensor_h = 7,
-    .general.output.dim.tensor_w = 7,
-    .general.output.dim.tensor_c = 512,
-    .general.output.dim.num_elem = 25088,
-    .general.output.stride.b = 25088,
-    .general.output.stride.h = 3584,
-    .general.output.stride.w = 512,
-    .general.output.stride.c = 1,
-    .general.output.mem.start_offset = ((unsigned char *)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */,
-    .general.output.format.is_signed = 1,
-    .general.type = LL_SW_QUANTIZELINEAR,
-  };
-
-  /* Low Level SW Layer function invocation. This will exploit EmbedNets libs) */
-  /* Node Quantize_280 mapped on EmbedNets (INTEGER) as QuantizeLinear | Category: Format-Converter */
-  ll_sw_forward_quantizelinear(&quantizelinear100_sw_info);
-  /* *** MCU cache clean (only) operation (SW, whole range) *** */
-  /*     memory pool: 1 */
-  /*     start: ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) */
-  /*     end:   ((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 25088))) */
-  LL_ATON_Cache_MCU_Clean_Range(((uintptr_t)(ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR(0x342e0000UL + 0))) /* Equivalent hex address = 0x342e0000UL */, 25088);
+  /* Quantize_280 fused into epoch 147 (ll_sw_forward_prelu_integer) */
 
 }
 
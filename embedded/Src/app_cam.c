@@ -21,6 +21,7 @@
 #include "app_cam.h"
 #include "app_config.h"
 #include "crop_img.h"
+#include "frame_mailbox.h"
 
 #if defined(USE_IMX335_SENSOR)
   #define GAMMA_CONVERSION 0
@@ -30,7 +31,11 @@
   #define GAMMA_CONVERSION 0
 #endif
 
-extern int32_t cameraFrameReceived;
+/* NN pipe frames handed from the DCMIPP ISR to the pipeline */
+static frame_mailbox_t nn_pipe_mailbox;
+/* Capture buffers the NN pipe cycles through, and frames completed since start */
+static uint32_t nn_pipe_buffer_count = 1;
+static uint32_t nn_pipe_frame_count;
 
 static void DCMIPP_PipeInitDisplay(CMW_CameraInit_t *camConf, uint32_t *bg_width, uint32_t *bg_height)
 {
@@ -136,6 +141,8 @@ void CAM_Init(uint32_t *lcd_bg_width, uint32_t *lcd_bg_height, uint32_t *pitch_n
   cam_conf.anti_flicker = 0;
   cam_conf.mirror_flip = CAMERA_FLIP;
 
+  frame_mailbox_init(&nn_pipe_mailbox, FRAME_MAILBOX_MODE_LATEST);
+
   ret = CMW_CAMERA_Init(&cam_conf);
   assert(ret == CMW_ERROR_NONE);
   DCMIPP_PipeInitDisplay(&cam_conf, lcd_bg_width, lcd_bg_height);
@@ -160,10 +167,30 @@ void CAM_NNPipe_Start(uint8_t *nn_pipe_dst, uint32_t cam_mode)
 {
   int ret;
 
+  nn_pipe_buffer_count = 1;
+  nn_pipe_frame_count = 0;
   ret = CMW_CAMERA_Start(DCMIPP_PIPE2, nn_pipe_dst, cam_mode);
   assert(ret == CMW_ERROR_NONE);
 }
 
+void CAM_NNPipe_DoubleBufferStart(uint8_t *nn_pipe_dst0, uint8_t *nn_pipe_dst1)
+{
+  int ret;
+
+  /* DCMIPP alternates between the two addresses, starting with the first */
+  nn_pipe_buffer_count = 2;
+  nn_pipe_frame_count = 0;
+  ret = CMW_CAMERA_DoubleBufferStart(DCMIPP_PIPE2, nn_pipe_dst0, nn_pipe_dst1, CMW_MODE_CONTINUOUS);
+  assert(ret == CMW_ERROR_NONE);
+}
+
+void CAM_NNPipe_Stop(void)
+{
+  int ret;
+  ret = CMW_CAMERA_Suspend(DCMIPP_PIPE2);
+  assert(ret == CMW_ERROR_NONE);
+}
+
 void CAM_DisplayPipe_Stop()
 {
   int ret;
@@ -171,6 +198,11 @@ void CAM_DisplayPipe_Stop()
   assert(ret == CMW_ERROR_NONE);
 }
 
+frame_mailbox_t *CAM_NNPipe_GetMailbox(void)
+{
+  return &nn_pipe_mailbox;
+}
+
 void CAM_IspUpdate(void)
 {
   int ret = CMW_ERROR_NONE;
@@ -188,7 +220,8 @@ int CMW_CAMERA_PIPE_FrameEventCallback(uint32_t pipe)
   switch (pipe)
   {
     case DCMIPP_PIPE2 :
-      cameraFrameReceived++;
+      frame_mailbox_post(&nn_pipe_mailbox, nn_pipe_frame_count % nn_pipe_buffer_count, HAL_GetTick());
+      nn_pipe_frame_count++;
       break;
   }
   return 0;
@@ -17,6 +17,7 @@
  */
 
 #include "app_config_manager.h"
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -0,0 +1,600 @@
+/**
+ ******************************************************************************
+ * @file    app_frame_processing.c
+ * @author  PeleAB
+ * @brief   Frame processing pipeline built from registered stages
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "app_frame_processing.h"
+#include "crop_img.h"
+#include "perf_monitor.h"
+#include "target_embedding.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#define FRAME_PROCESSING_GET_TICK()     HAL_GetTick()
+#else
+#include "host_platform.h"
+#define FRAME_PROCESSING_GET_TICK()     host_get_tick_ms()
+#endif
+
+_Static_assert(PERF_PROBE_STAGE_OUTPUT - PERF_PROBE_STAGE_CAPTURE + 1 == PIPELINE_STAGE_COUNT,
+               "stage probes must mirror pipeline_stage_t");
+
+/* ========================================================================= */
+/* PRIVATE DATA                                                              */
+/* ========================================================================= */
+
+static const char *const s_stage_names[PIPELINE_STAGE_COUNT] = {
+    [PIPELINE_STAGE_CAPTURE]        = "capture",
+    [PIPELINE_STAGE_PREPROCESSING]  = "preprocessing",
+    [PIPELINE_STAGE_DETECTION]      = "detection",
+    [PIPELINE_STAGE_TRACKING]       = "tracking",
+    [PIPELINE_STAGE_RECOGNITION]    = "recognition",
+    [PIPELINE_STAGE_POSTPROCESSING] = "postprocessing",
+    [PIPELINE_STAGE_OUTPUT]         = "output",
+};
+
+static uint32_t frame_processing_default_time(void)
+{
+    return FRAME_PROCESSING_GET_TICK();
+}
+
+/* ========================================================================= */
+/* DEFAULT STAGE HANDLERS                                                    */
+/* ========================================================================= */
+
+static int default_capture_stage(frame_processing_context_t *ctx, void *user)
+{
+    (void)user;
+    return frame_processing_capture_stage(ctx, ctx->frame_input, NN_WIDTH, NN_HEIGHT);
+}
+
+static int default_preprocessing_stage(frame_processing_context_t *ctx, void *user)
+{
+    (void)user;
+    return frame_processing_preprocessing_stage(ctx);
+}
+
+static int default_detection_stage(frame_processing_context_t *ctx, void *user)
+{
+    (void)user;
+    uint32_t face_count = 0;
+
+    int ret = frame_processing_detection_stage(ctx, NULL, 0, &face_count);
+    if (ret < 0) {
+        return ret;
+    }
+    if (face_count == 0 && ctx->exit_without_faces) {
+        return FRAME_STAGE_EARLY_EXIT;
+    }
+    return FRAME_STAGE_CONTINUE;
+}
+
+static int default_tracking_stage(frame_processing_context_t *ctx, void *user)
+{
+    (void)user;
+    return frame_processing_tracking_stage(ctx,
+                                           (const pd_pp_box_t *)ctx->face_detection.pp_output.pOutData,
+                                           ctx->face_count);
+}
+
+static int default_recognition_stage(frame_processing_context_t *ctx, void *user)
+{
+    (void)user;
+    const pd_pp_box_t *boxes = (const pd_pp_box_t *)ctx->face_detection.pp_output.pOutData;
+
+    for (uint32_t i = 0; i < ctx->face_count; i++) {
+        ctx->face_similarity[i] = 0.0f;
+        if (boxes[i].prob < ctx->config.face_detection.confidence_threshold) {
+            continue;
+        }
+        if (frame_processing_recognition_stage(ctx, i, &ctx->face_similarity[i]) < 0) {
+            return -1;
+        }
+    }
+    return FRAME_STAGE_CONTINUE;
+}
+
+static int default_postprocessing_stage(frame_processing_context_t *ctx, void *user)
+{
+    (void)user;
+    return frame_processing_postprocessing_stage(ctx, &ctx->last_timing);
+}
+
+static int default_output_stage(frame_processing_context_t *ctx, void *user)
+{
+    (void)user;
+    return frame_processing_output_stage(ctx, &ctx->last_timing);
+}
+
+static const frame_stage_fn_t s_default_stages[PIPELINE_STAGE_COUNT] = {
+    [PIPELINE_STAGE_CAPTURE]        = default_capture_stage,
+    [PIPELINE_STAGE_PREPROCESSING]  = default_preprocessing_stage,
+    [PIPELINE_STAGE_DETECTION]      = default_detection_stage,
+    [PIPELINE_STAGE_TRACKING]       = default_tracking_stage,
+    [PIPELINE_STAGE_RECOGNITION]    = default_recognition_stage,
+    [PIPELINE_STAGE_POSTPROCESSING] = default_postprocessing_stage,
+    [PIPELINE_STAGE_OUTPUT]         = default_output_stage,
+};
+
+/* ========================================================================= */
+/* INITIALIZATION AND CONFIGURATION                                          */
+/* ========================================================================= */
+
+int frame_processing_init(frame_processing_context_t *ctx, const app_config_t *config)
+{
+    if (ctx == NULL) {
+        return -1;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+
+    if (config != NULL) {
+        ctx->config = *config;
+    } else {
+        config_manager_init(&ctx->config);
+    }
+
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++) {
+        ctx->stages[i].name = s_stage_names[i];
+        ctx->stages[i].fn = s_default_stages[i];
+        ctx->stages[i].run_every_n = 1;
+    }
+    ctx->time_source = frame_processing_default_time;
+    ctx->memory_pool = memory_pool_get_default();
+
+    int ret = frame_processing_init_nn_buffers(ctx);
+    if (ret < 0) {
+        return ret;
+    }
+
+    ctx->is_initialized = true;
+    return 0;
+}
+
+int frame_processing_init_nn_buffers(frame_processing_context_t *ctx)
+{
+    if (ctx == NULL) {
+        return -1;
+    }
+
+    /* Recognition is loaded lazily on the first detected face */
+    if (nn_face_detection_init(&ctx->face_detection, &ctx->config, ctx->memory_pool) < 0) {
+        return -2;
+    }
+    return 0;
+}
+
+int frame_processing_register_stage(frame_processing_context_t *ctx,
+                                    pipeline_stage_t stage,
+                                    const char *name,
+                                    frame_stage_fn_t fn,
+                                    void *user,
+                                    uint32_t flags)
+{
+    if (ctx == NULL || stage >= PIPELINE_STAGE_COUNT) {
+        return -1;
+    }
+
+    frame_stage_t *entry = &ctx->stages[stage];
+    entry->name = (name != NULL) ? name : s_stage_names[stage];
+    entry->fn = fn;
+    entry->user = user;
+    entry->flags = flags;
+    return 0;
+}
+
+int frame_processing_set_stage_interval(frame_processing_context_t *ctx,
+                                        pipeline_stage_t stage,
+                                        uint32_t run_every_n)
+{
+    if (ctx == NULL || stage >= PIPELINE_STAGE_COUNT) {
+        return -1;
+    }
+
+    ctx->stages[stage].run_every_n = (run_every_n == 0) ? 1 : run_every_n;
+    return 0;
+}
+
+int frame_processing_attach_buffers(frame_processing_context_t *ctx,
+                                    uint8_t *input_frame_buffer,
+                                    uint8_t *processing_buffer)
+{
+    if (ctx == NULL || input_frame_buffer == NULL || processing_buffer == NULL) {
+        return -1;
+    }
+
+    ctx->input_frame_buffer = input_frame_buffer;
+    ctx->processing_buffer = processing_buffer;
+
+    /* Default to cropping faces from the NN input frame */
+    if (ctx->crop_source.buffer == NULL) {
+        frame_processing_set_crop_source(ctx, input_frame_buffer, NN_WIDTH, NN_HEIGHT,
+                                         NN_WIDTH, NN_BPP);
+    }
+    return 0;
+}
+
+void frame_processing_set_source(frame_processing_context_t *ctx, frame_source_t *source)
+{
+    if (ctx != NULL) {
+        ctx->source = source;
+    }
+}
+
+void frame_processing_set_crop_source(frame_processing_context_t *ctx,
+                                      const uint8_t *buffer,
+                                      uint32_t width,
+                                      uint32_t height,
+                                      uint32_t stride,
+                                      uint32_t bpp)
+{
+    if (ctx == NULL) {
+        return;
+    }
+
+    ctx->crop_source.buffer = buffer;
+    ctx->crop_source.width = width;
+    ctx->crop_source.height = height;
+    ctx->crop_source.stride = stride;
+    ctx->crop_source.bpp = bpp;
+}
+
+const char *frame_processing_stage_name(pipeline_stage_t stage)
+{
+    return (stage < PIPELINE_STAGE_COUNT) ? s_stage_names[stage] : "unknown";
+}
+
+/* ========================================================================= */
+/* PIPELINE EXECUTION                                                        */
+/* ========================================================================= */
+
+int frame_processing_process_frame(frame_processing_context_t *ctx,
+                                  const uint8_t *input_frame,
+                                  uint32_t frame_width,
+                                  uint32_t frame_height,
+                                  pipeline_timing_t *timing)
+{
+    if (!frame_processing_validate(ctx)) {
+        return -1;
+    }
+    if (input_frame != NULL && (frame_width != NN_WIDTH || frame_height != NN_HEIGHT)) {
+        return -2;
+    }
+
+    const uint32_t frame_index = ctx->stats.frames_processed;
+    pipeline_timing_t *t = &ctx->last_timing;
+    bool exiting = false;
+    int ret = 0;
+
+    memset(t, 0, sizeof(*t));
+    ctx->frame_input = input_frame;
+    t->timestamp = ctx->time_source();
+    t->capture_timestamp = t->timestamp;
+    perf_monitor_begin(PERF_PROBE_FRAME);
+
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++) {
+        frame_stage_t *stage = &ctx->stages[i];
+
+        if (stage->fn == NULL) {
+            continue;
+        }
+        if ((exiting && !(stage->flags & FRAME_STAGE_FLAG_ALWAYS_RUN)) ||
+            (frame_index % stage->run_every_n) != 0) {
+            ctx->stats.stage_skips[i]++;
+            continue;
+        }
+
+        uint32_t start = ctx->time_source();
+        perf_monitor_begin((perf_probe_t)(PERF_PROBE_STAGE_CAPTURE + i));
+        ret = stage->fn(ctx, stage->user);
+        perf_monitor_end((perf_probe_t)(PERF_PROBE_STAGE_CAPTURE + i));
+        uint32_t elapsed = ctx->time_source() - start;
+
+        t->stage_times[i] = elapsed;
+        ctx->stats.stage_runs[i]++;
+        ctx->stats.stage_total_time[i] += elapsed;
+        if (elapsed > ctx->stats.stage_max_time[i]) {
+            ctx->stats.stage_max_time[i] = elapsed;
+        }
+
+        if (ret < 0) {
+            ctx->stats.errors++;
+            break;
+        }
+        if (ret == FRAME_STAGE_END_OF_STREAM && i == PIPELINE_STAGE_CAPTURE) {
+            break;
+        }
+        if (i == PIPELINE_STAGE_CAPTURE && ctx->frame_input == NULL &&
+            ctx->source != NULL && ctx->source->frame_timestamp != 0) {
+            /* Latency starts when the sensor finished the frame, not when we asked */
+            t->capture_timestamp = ctx->source->frame_timestamp;
+        }
+        if (ret == FRAME_STAGE_EARLY_EXIT && !exiting) {
+            exiting = true;
+            ctx->stats.early_exits++;
+        }
+        ret = 0;
+    }
+
+    const uint32_t end = ctx->time_source();
+    t->total_time = end - t->timestamp;
+    t->latency = end - t->capture_timestamp;
+    ctx->frame_input = NULL;
+
+    if (timing != NULL) {
+        *timing = *t;
+    }
+    if (ret != 0) {
+        return ret;
+    }
+
+    perf_monitor_end(PERF_PROBE_FRAME);
+    ctx->stats.frames_processed++;
+    return frame_processing_update_metrics(ctx, t);
+}
+
+/* ========================================================================= */
+/* BUILT-IN STAGES                                                           */
+/* ========================================================================= */
+
+int frame_processing_capture_stage(frame_processing_context_t *ctx,
+                                  const uint8_t *input_frame,
+                                  uint32_t frame_width,
+                                  uint32_t frame_height)
+{
+    const uint32_t frame_size = NN_WIDTH * NN_HEIGHT * NN_BPP;
+
+    if (ctx == NULL || ctx->input_frame_buffer == NULL) {
+        return -1;
+    }
+
+    if (input_frame != NULL) {
+        if (frame_width != NN_WIDTH || frame_height != NN_HEIGHT) {
+            return -2;
+        }
+        if (input_frame != ctx->input_frame_buffer) {
+            memcpy(ctx->input_frame_buffer, input_frame, frame_size);
+        }
+        return 0;
+    }
+
+    if (ctx->source == NULL) {
+        return -3;
+    }
+    int ret = frame_source_acquire(ctx->source, ctx->input_frame_buffer, frame_size);
+    return (ret == 1) ? FRAME_STAGE_END_OF_STREAM : ret;
+}
+
+int frame_processing_preprocessing_stage(frame_processing_context_t *ctx)
+{
+    if (ctx == NULL || ctx->input_frame_buffer == NULL) {
+        return -1;
+    }
+
+    /* The detector input lives in the pools shared with the recognizer */
+    if (nn_activation_claim(NN_ACTIVATION_OWNER_DETECTION) < 0) {
+        return -2;
+    }
+
+    const nn_buffers_t *buffers = &ctx->face_detection.buffers;
+    img_rgb_to_chw_float(ctx->input_frame_buffer, (float32_t *)buffers->input_buffer,
+                         NN_WIDTH * NN_BPP, NN_WIDTH, NN_HEIGHT);
+    return nn_clean_invalidate_input_buffer(buffers, ctx->memory_pool);
+}
+
+int frame_processing_detection_stage(frame_processing_context_t *ctx,
+                                    pd_pp_box_t *detected_faces,
+                                    uint32_t max_faces,
+                                    uint32_t *face_count)
+{
+    if (ctx == NULL || face_count == NULL) {
+        return -1;
+    }
+
+    int ret = nn_face_detection_process(&ctx->face_detection, NULL, NN_WIDTH, NN_HEIGHT,
+                                        &ctx->config);
+    if (ret < 0) {
+        ctx->face_count = 0;
+        return ret;
+    }
+
+    ctx->face_count = ctx->face_detection.pp_output.box_nb;
+    ctx->detection_count += ctx->face_count;
+
+    if (detected_faces != NULL) {
+        return nn_face_detection_get_results(&ctx->face_detection, detected_faces, max_faces,
+                                             face_count);
+    }
+
+    *face_count = ctx->face_count;
+    return 0;
+}
+
+int frame_processing_tracking_stage(frame_processing_context_t *ctx,
+                                   const pd_pp_box_t *detected_faces,
+                                   uint32_t face_count)
+{
+    /* Tracker-free pipeline: detections are used as-is */
+    if (ctx == NULL || (face_count > 0 && detected_faces == NULL)) {
+        return -1;
+    }
+    return 0;
+}
+
+int frame_processing_recognition_stage(frame_processing_context_t *ctx,
+                                      uint32_t track_id,
+                                      float *similarity)
+{
+    if (ctx == NULL || similarity == NULL || ctx->processing_buffer == NULL ||
+        track_id >= ctx->face_count) {
+        return -1;
+    }
+
+    const frame_crop_source_t *src = &ctx->crop_source;
+    if (src->buffer == NULL) {
+        return -2;
+    }
+
+    /* Lazy initialization of face recognition network */
+    if (nn_face_recognition_init(&ctx->face_recognition, &ctx->config, ctx->memory_pool) < 0) {
+        return -3;
+    }
+
+    perf_monitor_begin(PERF_PROBE_FACE);
+
+    const pd_pp_box_t *box = &((const pd_pp_box_t *)ctx->face_detection.pp_output.pOutData)[track_id];
+    const float padding = ctx->config.face_recognition.bbox_padding_factor;
+    const float cx = box->x_center * src->width;
+    const float cy = box->y_center * src->height;
+    const float w = box->width * src->width * padding;
+    const float h = box->height * src->height * padding;
+    const float lx = box->pKps[0].x * src->width;
+    const float ly = box->pKps[0].y * src->height;
+    const float rx = box->pKps[1].x * src->width;
+    const float ry = box->pKps[1].y * src->height;
+
+    if (src->bpp == 2) {
+        img_crop_align565_to_888((uint8_t *)src->buffer, src->stride, ctx->processing_buffer,
+                                 src->width, src->height,
+                                 FACE_RECOGNITION_WIDTH, FACE_RECOGNITION_HEIGHT,
+                                 cx, cy, w, h, lx, ly, rx, ry);
+    } else {
+        img_crop_align((uint8_t *)src->buffer, ctx->processing_buffer,
+                       src->width, src->height,
+                       FACE_RECOGNITION_WIDTH, FACE_RECOGNITION_HEIGHT, src->bpp,
+                       cx, cy, w, h, lx, ly, rx, ry);
+    }
+
+    int ret = nn_face_recognition_process(&ctx->face_recognition, ctx->processing_buffer,
+                                          FACE_RECOGNITION_WIDTH, FACE_RECOGNITION_HEIGHT,
+                                          &ctx->config);
+    if (ret < 0) {
+        return ret;
+    }
+
+    *similarity = nn_calculate_embedding_similarity(ctx->face_recognition.current_embedding,
+                                                    target_embedding, EMBEDDING_SIZE);
+    perf_monitor_end(PERF_PROBE_FACE);
+    ctx->recognition_count++;
+    return 0;
+}
+
+int frame_processing_postprocessing_stage(frame_processing_context_t *ctx,
+                                         const pipeline_timing_t *timing)
+{
+    (void)timing;
+    return (ctx != NULL) ? 0 : -1;
+}
+
+int frame_processing_output_stage(frame_processing_context_t *ctx,
+                                 const pipeline_timing_t *timing)
+{
+    (void)timing;
+
+    if (ctx == NULL) {
+        return -1;
+    }
+
+    /* Drop stale output lines before the next inference writes them */
+    return nn_invalidate_output_buffers(&ctx->face_detection.buffers, ctx->memory_pool);
+}
+
+/* ========================================================================= */
+/* METRICS AND STATE                                                         */
+/* ========================================================================= */
+
+int frame_processing_update_metrics(frame_processing_context_t *ctx,
+                                   const pipeline_timing_t *timing)
+{
+    if (ctx == NULL || timing == NULL) {
+        return -1;
+    }
+
+    ctx->frame_count++;
+    ctx->last_process_time = timing->total_time;
+    ctx->stats.total_time += timing->total_time;
+
+    if (ctx->stats.total_time > 0) {
+        ctx->average_fps = (1000.0f * (float)ctx->frame_count) / (float)ctx->stats.total_time;
+    }
+    ctx->stats.average_fps = ctx->average_fps;
+
+    ctx->stats.latency_total += timing->latency;
+    if (timing->latency > ctx->stats.latency_max) {
+        ctx->stats.latency_max = timing->latency;
+    }
+
+    /* Wall clock, so time spent waiting for the sensor between frames counts */
+    if (ctx->frame_count == FRAME_PROCESSING_WARMUP_FRAMES + 1) {
+        ctx->stats.steady_start_time = timing->timestamp;
+    }
+    if (ctx->frame_count > FRAME_PROCESSING_WARMUP_FRAMES) {
+        const uint32_t elapsed = timing->timestamp + timing->total_time - ctx->stats.steady_start_time;
+        if (elapsed > 0) {
+            ctx->stats.steady_fps = (1000.0f * (float)(ctx->frame_count - FRAME_PROCESSING_WARMUP_FRAMES)) /
+                                    (float)elapsed;
+        }
+    }
+    return 0;
+}
+
+int frame_processing_cleanup(frame_processing_context_t *ctx)
+{
+    if (ctx == NULL) {
+        return -1;
+    }
+
+    frame_source_stop(ctx->source);
+    nn_face_recognition_deinit(&ctx->face_recognition, ctx->memory_pool);
+    nn_face_detection_deinit(&ctx->face_detection, ctx->memory_pool);
+    ctx->is_initialized = false;
+    return 0;
+}
+
+int frame_processing_get_statistics(const frame_processing_context_t *ctx, void *stats)
+{
+    if (ctx == NULL || stats == NULL) {
+        return -1;
+    }
+
+    memcpy(stats, &ctx->stats, sizeof(frame_processing_stats_t));
+    return 0;
+}
+
+int frame_processing_reset(frame_processing_context_t *ctx)
+{
+    if (ctx == NULL) {
+        return -1;
+    }
+
+    memset(&ctx->stats, 0, sizeof(ctx->stats));
+    memset(&ctx->last_timing, 0, sizeof(ctx->last_timing));
+    ctx->face_count = 0;
+    ctx->frame_count = 0;
+    ctx->detection_count = 0;
+    ctx->recognition_count = 0;
+    ctx->average_fps = 0.0f;
+    ctx->last_process_time = 0;
+    return 0;
+}
+
+bool frame_processing_validate(const frame_processing_context_t *ctx)
+{
+    return ctx != NULL && ctx->is_initialized && ctx->time_source != NULL &&
+           ctx->input_frame_buffer != NULL;
+}
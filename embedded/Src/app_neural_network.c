@@ -0,0 +1,769 @@
+/**
+ ******************************************************************************
+ * @file    app_neural_network.c
+ * @author  PeleAB
+ * @brief   Neural network processing module for face detection and recognition
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "app_neural_network.h"
+#include "crop_img.h"
+#include "face_utils.h"
+#include "perf_monitor.h"
+#include "epoch_profiler.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#include "ll_aton_runtime.h"
+#include "nn_runner.h"
+#ifdef APP_RELOC_MODELS
+#include "ll_aton_reloc_network.h"
+#include "ll_aton_version.h"
+#include "model_image.h"
+#endif
+#else
+#include "host_platform.h"
+#include "nn_stub.h"
+#endif
+
+/* ========================================================================= */
+/* PLATFORM BACKEND                                                          */
+/* ========================================================================= */
+
+typedef enum {
+    NN_NETWORK_FACE_DETECTION = NN_MODEL_DETECTION,
+    NN_NETWORK_FACE_RECOGNITION = NN_MODEL_RECOGNITION,
+} nn_network_id_t;
+
+#ifndef APP_HOST_BUILD
+#ifdef APP_RELOC_MODELS
+/* Relocatable images: the code executes in place from the flash slot, the
+ * data/got/bss tables go to a per-network exec RAM area (the statically
+ * linked networks keep the same tables in .data/.bss) */
+#define NN_BACKEND_RELOCATABLE      1
+#define NN_RELOC_EXEC_RAM_SIZE      (64 * 1024)
+
+/* hyperRAM activations below the application PSRAM region, one half per
+ * network so installing one never overwrites pools initialised by the other */
+#define NN_RELOC_EXT_RAM_ADDR       0x90000000UL
+#define NN_RELOC_EXT_RAM_SIZE       (8 * 1024 * 1024)
+
+#if defined(__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+#define NN_RELOC_EXTRA_SECURE       MODEL_IMAGE_EXTRA_SECURE
+#else
+#define NN_RELOC_EXTRA_SECURE       0U
+#endif
+#ifdef LL_ATON_EB_DBG_INFO
+#define NN_RELOC_EXTRA_DBG_INFO     MODEL_IMAGE_EXTRA_DBG_INFO
+#else
+#define NN_RELOC_EXTRA_DBG_INFO     0U
+#endif
+#if LL_ATON_RT_MODE == LL_ATON_RT_ASYNC
+#define NN_RELOC_EXTRA_ASYNC        MODEL_IMAGE_EXTRA_ASYNC
+#else
+#define NN_RELOC_EXTRA_ASYNC        0U
+#endif
+
+static NN_Instance_TypeDef s_nn_instances[NN_MODEL_ROLE_COUNT];
+static uint8_t s_nn_exec_ram[NN_MODEL_ROLE_COUNT][NN_RELOC_EXEC_RAM_SIZE] __attribute__((aligned(32)));
+
+static NN_Instance_TypeDef *nn_backend_instance(nn_network_id_t id)
+{
+    return &s_nn_instances[id];
+}
+
+static const LL_Buffer_InfoTypeDef *nn_backend_input_info(nn_network_id_t id)
+{
+    return ll_aton_reloc_get_input_buffers_info(&s_nn_instances[id], -1);
+}
+
+static const LL_Buffer_InfoTypeDef *nn_backend_output_info(nn_network_id_t id)
+{
+    return ll_aton_reloc_get_output_buffers_info(&s_nn_instances[id], -1);
+}
+
+/* The header is checked against this firmware before the runtime writes
+ * anything, so a rejected image leaves the installed network untouched */
+static int nn_backend_install(nn_network_id_t id, const nn_model_slot_t *slot)
+{
+    const uint8_t *image = (const uint8_t *)slot->address;
+    const model_image_limits_t limits = {
+        .slot_size = slot->size,
+        .exec_ram_size = NN_RELOC_EXEC_RAM_SIZE,
+        .ext_ram_size = NN_RELOC_EXT_RAM_SIZE,
+        .cpuid = MODEL_IMAGE_CPUID_CORTEX_M55,
+        .extra = NN_RELOC_EXTRA_SECURE | NN_RELOC_EXTRA_DBG_INFO | NN_RELOC_EXTRA_ASYNC,
+        .rt_version = (LL_ATON_VERSION_MAJOR << 24) | (LL_ATON_VERSION_MINOR << 16) |
+                      (LL_ATON_VERSION_MICRO << 8),
+    };
+    model_image_info_t info;
+
+    int ret = model_image_parse(image, slot->size, &info);
+    if (ret == MODEL_IMAGE_OK) {
+        ret = model_image_check(&info, &limits);
+    }
+    if (ret != MODEL_IMAGE_OK) {
+        printf("Model slot %s @0x%08lx rejected: %s\n", slot->variant,
+               (unsigned long)slot->address, model_image_status_str(ret));
+        return -1;
+    }
+
+    const ll_aton_reloc_config config = {
+        .exec_ram_addr = (uintptr_t)s_nn_exec_ram[id],
+        .exec_ram_size = NN_RELOC_EXEC_RAM_SIZE,
+        .ext_ram_addr = NN_RELOC_EXT_RAM_ADDR + (uint32_t)id * NN_RELOC_EXT_RAM_SIZE,
+        .ext_ram_size = NN_RELOC_EXT_RAM_SIZE,
+        .ext_param_addr = 0,
+        .mode = AI_RELOC_RT_LOAD_MODE_XIP,
+    };
+    ret = ll_aton_reloc_install((uintptr_t)image, &config, &s_nn_instances[id]);
+    if (ret != AI_RELOC_RT_ERR_NONE) {
+        printf("Model slot %s install failed: %d\n", slot->variant, ret);
+        memset(&s_nn_instances[id], 0, sizeof(s_nn_instances[id]));
+        return -1;
+    }
+
+    printf("Model %s installed: %s, %lu bytes of weights, %lu bytes exec RAM\n", slot->variant,
+           info.c_name, (unsigned long)info.params_size, (unsigned long)info.exec_ram_xip);
+    return 0;
+}
+#else
+#define NN_BACKEND_RELOCATABLE      0
+
+/* Neural Network Instance Declarations */
+LL_ATON_DECLARE_NAMED_NN_INSTANCE_AND_INTERFACE(face_detection);
+LL_ATON_DECLARE_NAMED_NN_INSTANCE_AND_INTERFACE(face_recognition);
+
+static NN_Instance_TypeDef *nn_backend_instance(nn_network_id_t id)
+{
+    return (id == NN_NETWORK_FACE_DETECTION) ? &NN_Instance_face_detection : &NN_Instance_face_recognition;
+}
+
+static const LL_Buffer_InfoTypeDef *nn_backend_input_info(nn_network_id_t id)
+{
+    return (id == NN_NETWORK_FACE_DETECTION) ? LL_ATON_Input_Buffers_Info_face_detection() :
+                                               LL_ATON_Input_Buffers_Info_face_recognition();
+}
+
+static const LL_Buffer_InfoTypeDef *nn_backend_output_info(nn_network_id_t id)
+{
+    return (id == NN_NETWORK_FACE_DETECTION) ? LL_ATON_Output_Buffers_Info_face_detection() :
+                                               LL_ATON_Output_Buffers_Info_face_recognition();
+}
+
+/* Statically linked networks cannot be replaced */
+static int nn_backend_install(nn_network_id_t id, const nn_model_slot_t *slot)
+{
+    (void)id;
+    (void)slot;
+    return -1;
+}
+#endif /* APP_RELOC_MODELS */
+
+static int nn_backend_bind(nn_network_id_t id, nn_buffers_t *buffers)
+{
+    const LL_Buffer_InfoTypeDef *in_info = nn_backend_input_info(id);
+    const LL_Buffer_InfoTypeDef *out_info = nn_backend_output_info(id);
+
+#ifdef APP_EPOCH_PROFILE
+    epoch_profiler_attach((id == NN_NETWORK_FACE_DETECTION) ? EPOCH_PROFILER_NET_DETECTION :
+                          EPOCH_PROFILER_NET_RECOGNITION, nn_backend_instance(id));
+#endif
+
+    if (!in_info || !out_info) {
+        return -1;
+    }
+
+    memset(buffers, 0, sizeof(*buffers));
+    buffers->input_buffer = (void *)LL_Buffer_addr_start(&in_info[0]);
+    buffers->input_size = LL_Buffer_len(&in_info[0]);
+
+    while (out_info[buffers->output_count].name != NULL &&
+           buffers->output_count < NN_MAX_OUTPUT_BUFFERS) {
+        buffers->output_buffers[buffers->output_count] =
+            (void *)LL_Buffer_addr_start(&out_info[buffers->output_count]);
+        buffers->output_sizes[buffers->output_count] =
+            LL_Buffer_len(&out_info[buffers->output_count]);
+        buffers->output_count++;
+    }
+
+    return 0;
+}
+
+static void nn_backend_run(nn_network_id_t id)
+{
+    NN_Instance_TypeDef *inst = nn_backend_instance(id);
+    RunNetworkSync(inst);
+    LL_ATON_RT_DeInit_Network(inst);
+}
+
+static uint32_t nn_backend_get_tick(void)
+{
+    return HAL_GetTick();
+}
+
+static void nn_backend_cache_clean_invalidate(void *addr, uint32_t size)
+{
+    SCB_CleanInvalidateDCache_by_Addr(addr, size);
+}
+
+static void nn_backend_cache_invalidate(void *addr, uint32_t size)
+{
+    SCB_InvalidateDCache_by_Addr(addr, size);
+}
+#else
+/* The stubs serve every variant, so slot selection runs as on the target */
+#define NN_BACKEND_RELOCATABLE      1
+
+static int nn_backend_install(nn_network_id_t id, const nn_model_slot_t *slot)
+{
+    (void)id;
+    (void)slot;
+    return 0;
+}
+
+static int nn_backend_bind(nn_network_id_t id, nn_buffers_t *buffers)
+{
+    return nn_stub_bind_buffers((id == NN_NETWORK_FACE_DETECTION) ?
+                                NN_STUB_FACE_DETECTION : NN_STUB_FACE_RECOGNITION, buffers);
+}
+
+static void nn_backend_run(nn_network_id_t id)
+{
+    nn_stub_run((id == NN_NETWORK_FACE_DETECTION) ?
+                NN_STUB_FACE_DETECTION : NN_STUB_FACE_RECOGNITION);
+}
+
+static uint32_t nn_backend_get_tick(void)
+{
+    return host_get_tick_ms();
+}
+
+static void nn_backend_cache_clean_invalidate(void *addr, uint32_t size)
+{
+    (void)addr;
+    (void)size;
+}
+
+static void nn_backend_cache_invalidate(void *addr, uint32_t size)
+{
+    (void)addr;
+    (void)size;
+}
+#endif /* APP_HOST_BUILD */
+
+/* Pool-owned buffers honour their is_cached flag; buffers owned by the NPU
+ * runtime are not in the pool and get a raw D-cache operation */
+static void nn_cache_clean_invalidate(memory_pool_t *memory_pool, void *addr, uint32_t size)
+{
+    if (memory_pool_clean_invalidate_range(memory_pool, addr, size) < 0) {
+        nn_backend_cache_clean_invalidate(addr, size);
+    }
+}
+
+static void nn_cache_invalidate(memory_pool_t *memory_pool, void *addr, uint32_t size)
+{
+    if (memory_pool_invalidate_range(memory_pool, addr, size) < 0) {
+        nn_backend_cache_invalidate(addr, size);
+    }
+}
+
+/* ========================================================================= */
+/* SHARED ACTIVATION MEMORY                                                  */
+/* ========================================================================= */
+
+static nn_activation_owner_t s_activation_owner = NN_ACTIVATION_OWNER_NONE;
+static volatile bool s_inference_running = false;
+
+int nn_activation_claim(nn_activation_owner_t owner)
+{
+    if (s_inference_running) {
+        return -1;
+    }
+    s_activation_owner = owner;
+    return 0;
+}
+
+nn_activation_owner_t nn_activation_get_owner(void)
+{
+    return s_activation_owner;
+}
+
+/* Runs one network with exclusive use of the shared pools; its tensors stay
+ * valid until the other network claims them */
+static int nn_run_exclusive(nn_network_id_t id)
+{
+    const nn_activation_owner_t owner = (id == NN_NETWORK_FACE_DETECTION) ?
+                                        NN_ACTIVATION_OWNER_DETECTION :
+                                        NN_ACTIVATION_OWNER_RECOGNITION;
+    if (s_inference_running || s_activation_owner != owner) {
+        return -1;
+    }
+
+    s_inference_running = true;
+    nn_backend_run(id);
+    s_inference_running = false;
+    return 0;
+}
+
+/* ========================================================================= */
+/* MODEL SLOTS                                                               */
+/* ========================================================================= */
+
+/* Flash slots written by scripts/compile_model.sh (stm32_tools_config.json) */
+static const nn_model_slot_t s_model_slots[] = {
+    { NN_MODEL_DETECTION,   "centerface-128",         0x71000000UL, 0x00800000UL },
+    { NN_MODEL_DETECTION,   "centerface-192",         0x71800000UL, 0x00800000UL },
+    { NN_MODEL_RECOGNITION, "mobilefacenet-fast",     0x72000000UL, 0x01000000UL },
+    { NN_MODEL_RECOGNITION, "mobilefacenet-accurate", 0x73000000UL, 0x01000000UL },
+};
+
+#define NN_MODEL_SLOT_COUNT (sizeof(s_model_slots) / sizeof(s_model_slots[0]))
+
+static const nn_model_slot_t *s_model_active[NN_MODEL_ROLE_COUNT];
+static uint32_t s_model_generation[NN_MODEL_ROLE_COUNT];
+
+static const nn_model_slot_t *nn_model_find(nn_model_role_t role, const char *variant)
+{
+    for (uint32_t i = 0; i < NN_MODEL_SLOT_COUNT; i++) {
+        if (s_model_slots[i].role == role && strcmp(s_model_slots[i].variant, variant) == 0) {
+            return &s_model_slots[i];
+        }
+    }
+    return NULL;
+}
+
+/* The frame pipeline geometry is fixed at build time (NN_WIDTH, the
+ * recognizer crop), so a variant is only usable if its tensors match it */
+static bool nn_model_io_matches(nn_model_role_t role, const nn_buffers_t *buffers)
+{
+    if (role == NN_MODEL_DETECTION) {
+        return buffers->input_size == NN_WIDTH * NN_HEIGHT * NN_BPP * sizeof(float32_t) &&
+               buffers->output_count == 4 &&
+               buffers->output_sizes[2] == (NN_WIDTH / 4) * (NN_HEIGHT / 4) * sizeof(float32_t);
+    }
+    return buffers->input_size ==
+               FACE_RECOGNITION_WIDTH * FACE_RECOGNITION_HEIGHT * NN_BPP * sizeof(float32_t) &&
+           buffers->output_count >= 1 && buffers->output_sizes[0] >= EMBEDDING_SIZE * sizeof(float32_t);
+}
+
+/* A failed install may have overwritten the exec RAM of the installed variant */
+static void nn_model_restore(nn_model_role_t role)
+{
+    const nn_model_slot_t *previous = s_model_active[role];
+    if (previous == NULL) {
+        return;
+    }
+    s_model_active[role] = NULL;
+    if (nn_backend_install((nn_network_id_t)role, previous) == 0) {
+        s_model_active[role] = previous;
+    }
+    s_model_generation[role]++;
+}
+
+int nn_model_select(nn_model_role_t role, const char *variant)
+{
+    if (role >= NN_MODEL_ROLE_COUNT || variant == NULL) {
+        return -2;
+    }
+    if (s_inference_running) {
+        return -1;
+    }
+    const nn_model_slot_t *slot = nn_model_find(role, variant);
+    if (slot == NULL) {
+        return -2;
+    }
+
+    /* Installing resets the runtime state the shared pools belong to */
+    s_activation_owner = NN_ACTIVATION_OWNER_NONE;
+    nn_buffers_t buffers;
+    int ret = 0;
+    if (nn_backend_install((nn_network_id_t)role, slot) < 0) {
+        ret = -3;
+    } else if (nn_backend_bind((nn_network_id_t)role, &buffers) < 0 || !nn_model_io_matches(role, &buffers)) {
+        printf("Model %s does not match the frame pipeline\n", slot->variant);
+        ret = -4;
+    }
+    if (ret < 0) {
+        nn_model_restore(role);
+        return ret;
+    }
+
+    s_model_active[role] = slot;
+    s_model_generation[role]++;
+    return 0;
+}
+
+const char *nn_model_get_variant(nn_model_role_t role)
+{
+    if (role >= NN_MODEL_ROLE_COUNT) {
+        return NULL;
+    }
+    if (!NN_BACKEND_RELOCATABLE) {
+        return "static";
+    }
+    return (s_model_active[role] != NULL) ? s_model_active[role]->variant : NULL;
+}
+
+const nn_model_slot_t *nn_model_get_slots(uint32_t *count)
+{
+    if (count != NULL) {
+        *count = NN_MODEL_SLOT_COUNT;
+    }
+    return s_model_slots;
+}
+
+/* Boot: the configured variant, else the first slot of the role that installs */
+static int nn_model_install_default(nn_model_role_t role, const char *variant)
+{
+    if (!NN_BACKEND_RELOCATABLE || s_model_active[role] != NULL) {
+        return 0;
+    }
+    if (nn_model_select(role, variant) == 0) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < NN_MODEL_SLOT_COUNT; i++) {
+        if (s_model_slots[i].role == role && nn_model_select(role, s_model_slots[i].variant) == 0) {
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/* Buffers move when another variant is installed; contexts rebind lazily */
+static int nn_model_rebind(nn_network_id_t id, nn_buffers_t *buffers, uint32_t *generation)
+{
+    if (*generation == s_model_generation[id]) {
+        return 0;
+    }
+    if (s_model_active[id] == NULL && NN_BACKEND_RELOCATABLE) {
+        return -1;
+    }
+    if (nn_backend_bind(id, buffers) < 0) {
+        return -1;
+    }
+    *generation = s_model_generation[id];
+    return 0;
+}
+
+/* ========================================================================= */
+/* INITIALIZATION                                                            */
+/* ========================================================================= */
+
+int nn_face_detection_init(face_detection_nn_t *nn_ctx,
+                          const app_config_t *config,
+                          memory_pool_t *memory_pool)
+{
+    (void)config;
+    (void)memory_pool;
+
+    if (nn_ctx == NULL) {
+        return -1;
+    }
+
+    memset(nn_ctx, 0, sizeof(*nn_ctx));
+
+    if (nn_model_install_default(NN_MODEL_DETECTION, NN_DETECTION_MODEL_VARIANT) < 0 ||
+        nn_backend_bind(NN_NETWORK_FACE_DETECTION, &nn_ctx->buffers) < 0) {
+        return -2;
+    }
+    nn_ctx->model_generation = s_model_generation[NN_MODEL_DETECTION];
+    if (app_postprocess_init(&nn_ctx->pp_params) != 0) {
+        return -3;
+    }
+
+    nn_ctx->is_initialized = true;
+
+    printf("Face Detection Network Ready: %lu bytes, %lu outputs\n",
+           (unsigned long)nn_ctx->buffers.input_size,
+           (unsigned long)nn_ctx->buffers.output_count);
+    return 0;
+}
+
+int nn_face_recognition_init(face_recognition_nn_t *nn_ctx,
+                            const app_config_t *config,
+                            memory_pool_t *memory_pool)
+{
+    (void)config;
+    (void)memory_pool;
+
+    if (nn_ctx == NULL) {
+        return -1;
+    }
+    if (nn_ctx->is_initialized) {
+        return 0;
+    }
+
+    memset(nn_ctx, 0, sizeof(*nn_ctx));
+
+    if (nn_model_install_default(NN_MODEL_RECOGNITION, NN_RECOGNITION_MODEL_VARIANT) < 0 ||
+        nn_backend_bind(NN_NETWORK_FACE_RECOGNITION, &nn_ctx->buffers) < 0) {
+        return -2;
+    }
+    nn_ctx->model_generation = s_model_generation[NN_MODEL_RECOGNITION];
+
+    nn_ctx->is_initialized = true;
+
+    printf("Face Recognition Network Loaded: %lu bytes -> %lu bytes\n",
+           (unsigned long)nn_ctx->buffers.input_size,
+           (unsigned long)nn_ctx->buffers.output_sizes[0]);
+    return 0;
+}
+
+/* ========================================================================= */
+/* INFERENCE                                                                 */
+/* ========================================================================= */
+
+int nn_face_detection_process(face_detection_nn_t *nn_ctx,
+                             const uint8_t *input_frame,
+                             uint32_t frame_width,
+                             uint32_t frame_height,
+                             const app_config_t *config)
+{
+    (void)config;
+
+    if (nn_ctx == NULL || !nn_ctx->is_initialized) {
+        return -1;
+    }
+
+    /* A prepared input went to the tensor of the variant installed before */
+    const bool was_stale = nn_ctx->model_generation != s_model_generation[NN_MODEL_DETECTION];
+    if (nn_model_rebind(NN_NETWORK_FACE_DETECTION, &nn_ctx->buffers, &nn_ctx->model_generation) < 0) {
+        return -1;
+    }
+
+    /* A NULL frame means the caller already prepared the input tensor */
+    if (input_frame == NULL && was_stale) {
+        return -4;
+    }
+    if (input_frame != NULL) {
+        if (frame_width != NN_WIDTH || frame_height != NN_HEIGHT) {
+            return -2;
+        }
+        if (nn_activation_claim(NN_ACTIVATION_OWNER_DETECTION) < 0) {
+            return -4;
+        }
+        img_rgb_to_chw_float((uint8_t *)input_frame, (float32_t *)nn_ctx->buffers.input_buffer,
+                             NN_WIDTH * NN_BPP, NN_WIDTH, NN_HEIGHT);
+        nn_clean_invalidate_input_buffer(&nn_ctx->buffers, NULL);
+    }
+
+    uint32_t start_time = nn_backend_get_tick();
+    perf_monitor_begin(PERF_PROBE_NN_DETECTION);
+    /* Fails when the recognizer ran since the input tensor was written */
+    int ret = nn_run_exclusive(NN_NETWORK_FACE_DETECTION);
+    perf_monitor_end(PERF_PROBE_NN_DETECTION);
+    if (ret < 0) {
+        return -4;
+    }
+    nn_ctx->inference_time_ms = nn_backend_get_tick() - start_time;
+    nn_ctx->total_inference_time_ms += nn_ctx->inference_time_ms;
+    nn_ctx->total_inferences++;
+
+    nn_invalidate_output_buffers(&nn_ctx->buffers, NULL);
+
+    if (app_postprocess_run(nn_ctx->buffers.output_buffers, (int)nn_ctx->buffers.output_count,
+                            &nn_ctx->pp_output, &nn_ctx->pp_params) != 0) {
+        nn_ctx->pp_output.box_nb = 0;
+        return -3;
+    }
+
+    return 0;
+}
+
+int nn_face_recognition_process(face_recognition_nn_t *nn_ctx,
+                               const uint8_t *face_region,
+                               uint32_t region_width,
+                               uint32_t region_height,
+                               const app_config_t *config)
+{
+    (void)config;
+
+    if (nn_ctx == NULL || !nn_ctx->is_initialized || face_region == NULL) {
+        return -1;
+    }
+    if (region_width != FACE_RECOGNITION_WIDTH || region_height != FACE_RECOGNITION_HEIGHT) {
+        return -2;
+    }
+
+    if (nn_model_rebind(NN_NETWORK_FACE_RECOGNITION, &nn_ctx->buffers, &nn_ctx->model_generation) < 0) {
+        return -1;
+    }
+    if (nn_activation_claim(NN_ACTIVATION_OWNER_RECOGNITION) < 0) {
+        return -4;
+    }
+    img_rgb_to_chw_float_norm((uint8_t *)face_region, (float32_t *)nn_ctx->buffers.input_buffer,
+                              region_width * NN_BPP, region_width, region_height);
+    nn_clean_invalidate_input_buffer(&nn_ctx->buffers, NULL);
+
+    uint32_t start_time = nn_backend_get_tick();
+    perf_monitor_begin(PERF_PROBE_NN_RECOGNITION);
+    int ret = nn_run_exclusive(NN_NETWORK_FACE_RECOGNITION);
+    perf_monitor_end(PERF_PROBE_NN_RECOGNITION);
+    if (ret < 0) {
+        return -4;
+    }
+    nn_ctx->inference_time_ms = nn_backend_get_tick() - start_time;
+    nn_ctx->total_inferences++;
+
+    nn_invalidate_output_buffers(&nn_ctx->buffers, NULL);
+
+    const float32_t *output = (const float32_t *)nn_ctx->buffers.output_buffers[0];
+    for (uint32_t i = 0; i < EMBEDDING_SIZE; i++) {
+        nn_ctx->current_embedding[i] = output[i];
+    }
+    nn_ctx->embedding_valid = true;
+
+    return 0;
+}
+
+/* ========================================================================= */
+/* RESULTS                                                                   */
+/* ========================================================================= */
+
+int nn_face_detection_get_results(const face_detection_nn_t *nn_ctx,
+                                 pd_pp_box_t *boxes,
+                                 uint32_t max_boxes,
+                                 uint32_t *box_count)
+{
+    if (nn_ctx == NULL || box_count == NULL) {
+        return -1;
+    }
+
+    uint32_t count = nn_ctx->pp_output.box_nb;
+    if (boxes != NULL) {
+        if (count > max_boxes) {
+            count = max_boxes;
+        }
+        memcpy(boxes, nn_ctx->pp_output.pOutData, count * sizeof(pd_pp_box_t));
+    }
+
+    *box_count = count;
+    return 0;
+}
+
+int nn_face_recognition_get_embedding(const face_recognition_nn_t *nn_ctx,
+                                     float *embedding,
+                                     uint32_t embedding_size)
+{
+    if (nn_ctx == NULL || embedding == NULL || !nn_ctx->embedding_valid) {
+        return -1;
+    }
+    if (embedding_size > EMBEDDING_SIZE) {
+        embedding_size = EMBEDDING_SIZE;
+    }
+
+    memcpy(embedding, nn_ctx->current_embedding, embedding_size * sizeof(float));
+    return 0;
+}
+
+float nn_calculate_embedding_similarity(const float *embedding1,
+                                       const float *embedding2,
+                                       uint32_t embedding_size)
+{
+    if (embedding1 == NULL || embedding2 == NULL || embedding_size == 0) {
+        return 0.0f;
+    }
+    return embedding_cosine_similarity(embedding1, embedding2, embedding_size);
+}
+
+/* ========================================================================= */
+/* BUFFER MANAGEMENT                                                         */
+/* ========================================================================= */
+
+int nn_prepare_input_buffer(const nn_buffers_t *nn_ctx,
+                           const uint8_t *input_data,
+                           uint32_t data_size)
+{
+    if (nn_ctx == NULL || input_data == NULL || data_size > nn_ctx->input_size) {
+        return -1;
+    }
+
+    memcpy(nn_ctx->input_buffer, input_data, data_size);
+    nn_backend_cache_clean_invalidate(nn_ctx->input_buffer, data_size);
+    return 0;
+}
+
+int nn_invalidate_output_buffers(const nn_buffers_t *nn_ctx,
+                                memory_pool_t *memory_pool)
+{
+    if (nn_ctx == NULL) {
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < nn_ctx->output_count; i++) {
+        nn_cache_invalidate(memory_pool, nn_ctx->output_buffers[i], nn_ctx->output_sizes[i]);
+    }
+    return 0;
+}
+
+int nn_clean_invalidate_input_buffer(const nn_buffers_t *nn_ctx,
+                                    memory_pool_t *memory_pool)
+{
+    if (nn_ctx == NULL) {
+        return -1;
+    }
+
+    nn_cache_clean_invalidate(memory_pool, nn_ctx->input_buffer, nn_ctx->input_size);
+    return 0;
+}
+
+/* ========================================================================= */
+/* METRICS AND TEARDOWN                                                      */
+/* ========================================================================= */
+
+int nn_get_performance_metrics(const face_detection_nn_t *nn_ctx,
+                              float *avg_inference_time,
+                              uint32_t *total_inferences)
+{
+    if (nn_ctx == NULL) {
+        return -1;
+    }
+
+    if (avg_inference_time != NULL) {
+        *avg_inference_time = (nn_ctx->total_inferences > 0) ?
+            (float)nn_ctx->total_inference_time_ms / (float)nn_ctx->total_inferences : 0.0f;
+    }
+    if (total_inferences != NULL) {
+        *total_inferences = nn_ctx->total_inferences;
+    }
+    return 0;
+}
+
+int nn_face_detection_deinit(face_detection_nn_t *nn_ctx,
+                            memory_pool_t *memory_pool)
+{
+    (void)memory_pool;
+
+    if (nn_ctx == NULL) {
+        return -1;
+    }
+
+    memset(nn_ctx, 0, sizeof(*nn_ctx));
+    return 0;
+}
+
+int nn_face_recognition_deinit(face_recognition_nn_t *nn_ctx,
+                              memory_pool_t *memory_pool)
+{
+    (void)memory_pool;
+
+    if (nn_ctx == NULL) {
+        return -1;
+    }
+
+    memset(nn_ctx, 0, sizeof(*nn_ctx));
+    return 0;
+}
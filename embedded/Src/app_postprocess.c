@@ -1,6 +1,5 @@
 #include "app_postprocess.h"
 #include "app_config.h"
-#include "ll_aton_NN_interface.h"
 #include <assert.h>
 #include <string.h>
 
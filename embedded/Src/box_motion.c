@@ -0,0 +1,230 @@
+/**
+ ******************************************************************************
+ * @file    box_motion.c
+ * @author  PeleAB
+ * @brief   Box motion model for rendering detections between inference results
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "box_motion.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static float box_motion_clamp01(float v)
+{
+    return (v < 0.0f) ? 0.0f : (v > 1.0f) ? 1.0f : v;
+}
+
+static float box_motion_iou(const box_motion_box_t *a, const box_motion_box_t *b)
+{
+    const float ax0 = a->x_center - a->width / 2, ax1 = a->x_center + a->width / 2;
+    const float ay0 = a->y_center - a->height / 2, ay1 = a->y_center + a->height / 2;
+    const float bx0 = b->x_center - b->width / 2, bx1 = b->x_center + b->width / 2;
+    const float by0 = b->y_center - b->height / 2, by1 = b->y_center + b->height / 2;
+    const float iw = ((ax1 < bx1) ? ax1 : bx1) - ((ax0 > bx0) ? ax0 : bx0);
+    const float ih = ((ay1 < by1) ? ay1 : by1) - ((ay0 > by0) ? ay0 : by0);
+
+    if (iw <= 0.0f || ih <= 0.0f) {
+        return 0.0f;
+    }
+    const float inter = iw * ih;
+    const float uni = a->width * a->height + b->width * b->height - inter;
+    return (uni > 0.0f) ? inter / uni : 0.0f;
+}
+
+/* Linear blend a + (b - a) * f of geometry and keypoints; score from b */
+static void box_motion_lerp(const box_motion_box_t *a, const box_motion_box_t *b, float f,
+                            uint32_t nb_keypoints, box_motion_box_t *out)
+{
+    out->x_center = a->x_center + (b->x_center - a->x_center) * f;
+    out->y_center = a->y_center + (b->y_center - a->y_center) * f;
+    out->width = a->width + (b->width - a->width) * f;
+    out->height = a->height + (b->height - a->height) * f;
+    out->prob = b->prob;
+    for (uint32_t k = 0; k < nb_keypoints; k++) {
+        out->kps[k].x = a->kps[k].x + (b->kps[k].x - a->kps[k].x) * f;
+        out->kps[k].y = a->kps[k].y + (b->kps[k].y - a->kps[k].y) * f;
+    }
+}
+
+static void box_motion_predict_track(const box_motion_t *motion, const box_motion_track_t *track,
+                                     uint32_t t_ms, box_motion_box_t *out)
+{
+    const uint32_t nb_kp = motion->nb_keypoints;
+    /* Signed differences so the tick counter may wrap */
+    const int32_t since_prev = (int32_t)(t_ms - track->t_prev);
+    const int32_t since_last = (int32_t)(t_ms - track->t_last);
+    const int32_t span = (int32_t)(track->t_last - track->t_prev);
+
+    *out = track->last;
+    if (since_prev <= 0 && span > 0) {
+        *out = track->prev;
+        out->prob = track->last.prob;
+    } else if (since_last < 0 && span > 0) {
+        box_motion_lerp(&track->prev, &track->last, (float)since_prev / (float)span, nb_kp, out);
+    } else if (since_last > 0) {
+        const uint32_t horizon = motion->config.max_extrapolation_ms;
+        const float dt = (float)(((uint32_t)since_last < horizon) ? (uint32_t)since_last : horizon);
+        const float dx = track->vx * dt, dy = track->vy * dt;
+        out->x_center += dx;
+        out->y_center += dy;
+        out->width += track->vw * dt;
+        out->height += track->vh * dt;
+        out->width = (out->width > 0.0f) ? out->width : 0.0f;
+        out->height = (out->height > 0.0f) ? out->height : 0.0f;
+        for (uint32_t k = 0; k < nb_kp; k++) {
+            out->kps[k].x += dx;
+            out->kps[k].y += dy;
+        }
+    }
+
+    out->x_center = box_motion_clamp01(out->x_center);
+    out->y_center = box_motion_clamp01(out->y_center);
+    for (uint32_t k = 0; k < nb_kp; k++) {
+        out->kps[k].x = box_motion_clamp01(out->kps[k].x);
+        out->kps[k].y = box_motion_clamp01(out->kps[k].y);
+    }
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+void box_motion_default_config(box_motion_config_t *config)
+{
+    if (config == NULL) {
+        return;
+    }
+    config->min_iou = BOX_MOTION_DEFAULT_MIN_IOU;
+    config->velocity_gain = BOX_MOTION_DEFAULT_GAIN;
+    config->max_extrapolation_ms = BOX_MOTION_DEFAULT_MAX_EXTRAP;
+}
+
+int box_motion_init(box_motion_t *motion, const box_motion_config_t *config, uint32_t nb_keypoints)
+{
+    if (motion == NULL || nb_keypoints > BOX_MOTION_MAX_KEYPOINTS) {
+        return -1;
+    }
+    if (config != NULL && (config->velocity_gain <= 0.0f || config->velocity_gain > 1.0f)) {
+        return -1;
+    }
+
+    memset(motion, 0, sizeof(*motion));
+    if (config != NULL) {
+        motion->config = *config;
+    } else {
+        box_motion_default_config(&motion->config);
+    }
+    motion->nb_keypoints = nb_keypoints;
+    return 0;
+}
+
+int box_motion_update(box_motion_t *motion, const box_motion_box_t *boxes, uint32_t count, uint32_t t_ms)
+{
+    static box_motion_track_t next[BOX_MOTION_MAX_TRACKS];
+    box_motion_box_t predicted[BOX_MOTION_MAX_TRACKS];
+    int32_t track_of[BOX_MOTION_MAX_TRACKS];
+    bool taken[BOX_MOTION_MAX_TRACKS] = { false };
+
+    if (motion == NULL || (boxes == NULL && count > 0)) {
+        return -1;
+    }
+    count = (count < BOX_MOTION_MAX_TRACKS) ? count : BOX_MOTION_MAX_TRACKS;
+
+    for (uint32_t j = 0; j < motion->count; j++) {
+        box_motion_predict_track(motion, &motion->tracks[j], t_ms, &predicted[j]);
+    }
+
+    /* Greedy assignment, best overlap first */
+    for (uint32_t i = 0; i < count; i++) {
+        track_of[i] = -1;
+    }
+    for (;;) {
+        float best = motion->config.min_iou;
+        int32_t best_i = -1, best_j = -1;
+        for (uint32_t i = 0; i < count; i++) {
+            if (track_of[i] >= 0) {
+                continue;
+            }
+            for (uint32_t j = 0; j < motion->count; j++) {
+                const float iou = taken[j] ? 0.0f : box_motion_iou(&boxes[i], &predicted[j]);
+                if (iou >= best && iou > 0.0f) {
+                    best = iou;
+                    best_i = (int32_t)i;
+                    best_j = (int32_t)j;
+                }
+            }
+        }
+        if (best_i < 0) {
+            break;
+        }
+        track_of[best_i] = best_j;
+        taken[best_j] = true;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        box_motion_track_t *t = &next[i];
+        if (track_of[i] < 0) {
+            memset(t, 0, sizeof(*t));
+            t->last = boxes[i];
+            t->prev = boxes[i];
+            t->t_last = t_ms;
+            t->t_prev = t_ms;
+            t->hits = 1;
+            continue;
+        }
+
+        *t = motion->tracks[track_of[i]];
+        const int32_t dt = (int32_t)(t_ms - t->t_last);
+        if (dt > 0) {
+            const float inv = 1.0f / (float)dt;
+            const float vx = (boxes[i].x_center - t->last.x_center) * inv;
+            const float vy = (boxes[i].y_center - t->last.y_center) * inv;
+            const float vw = (boxes[i].width - t->last.width) * inv;
+            const float vh = (boxes[i].height - t->last.height) * inv;
+            /* The first measurement replaces the zero velocity of a new track */
+            const float g = (t->hits == 1) ? 1.0f : motion->config.velocity_gain;
+            t->vx += g * (vx - t->vx);
+            t->vy += g * (vy - t->vy);
+            t->vw += g * (vw - t->vw);
+            t->vh += g * (vh - t->vh);
+            t->prev = t->last;
+            t->t_prev = t->t_last;
+        }
+        t->last = boxes[i];
+        t->t_last = t_ms;
+        t->hits++;
+    }
+
+    memcpy(motion->tracks, next, count * sizeof(next[0]));
+    motion->count = count;
+    return 0;
+}
+
+uint32_t box_motion_predict(const box_motion_t *motion, uint32_t t_ms, box_motion_box_t *out, uint32_t max)
+{
+    if (motion == NULL || out == NULL) {
+        return 0;
+    }
+
+    const uint32_t n = (motion->count < max) ? motion->count : max;
+    for (uint32_t j = 0; j < n; j++) {
+        box_motion_predict_track(motion, &motion->tracks[j], t_ms, &out[j]);
+    }
+    return n;
+}
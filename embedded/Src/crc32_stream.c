@@ -0,0 +1,183 @@
+/**
+ ******************************************************************************
+ * @file    crc32_stream.c
+ * @author  PeleAB
+ * @brief   Incremental CRC32 of the PC stream packet payloads
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "crc32_stream.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#endif
+
+#define CRC32_STREAM_POLYNOMIAL         0x04C11DB7U
+#define CRC32_STREAM_BLOCK_WORDS        64U     /* Staging for unaligned words */
+
+#ifndef APP_HOST_BUILD
+static CRC_HandleTypeDef hcrc;
+#else
+static uint32_t crc32_table[256];
+static bool crc32_table_ready;
+#endif
+
+/* ========================================================================= */
+/* CRC ENGINE                                                                */
+/* ========================================================================= */
+
+#ifdef APP_HOST_BUILD
+static inline uint32_t crc32_step(uint32_t crc, uint8_t byte)
+{
+    return (crc << 8) ^ crc32_table[(crc >> 24) ^ byte];
+}
+#endif
+
+/* Feed whole little-endian words */
+static void crc32_feed_words(crc32_stream_t *stream, const uint8_t *data, uint32_t words)
+{
+    if (words == 0) {
+        return;
+    }
+
+#ifndef APP_HOST_BUILD
+    if (((uintptr_t)data & 3U) == 0) {
+        stream->crc = HAL_CRC_Accumulate(&hcrc, (uint32_t *)(uintptr_t)data, words);
+        return;
+    }
+    uint32_t block[CRC32_STREAM_BLOCK_WORDS];
+    while (words > 0) {
+        const uint32_t n = (words < CRC32_STREAM_BLOCK_WORDS) ? words : CRC32_STREAM_BLOCK_WORDS;
+        memcpy(block, data, n * 4U);
+        stream->crc = HAL_CRC_Accumulate(&hcrc, block, n);
+        data += n * 4U;
+        words -= n;
+    }
+#else
+    uint32_t crc = stream->crc;
+    for (uint32_t i = 0; i < words; i++, data += 4) {
+        crc = crc32_step(crc, data[3]);
+        crc = crc32_step(crc, data[2]);
+        crc = crc32_step(crc, data[1]);
+        crc = crc32_step(crc, data[0]);
+    }
+    stream->crc = crc;
+#endif
+}
+
+/* Feed the last 1 to 3 bytes, in order */
+static void crc32_feed_bytes(crc32_stream_t *stream, const uint8_t *data, uint32_t size)
+{
+#ifndef APP_HOST_BUILD
+    hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_BYTES;
+    stream->crc = HAL_CRC_Accumulate(&hcrc, (uint32_t *)(uintptr_t)data, size);
+    hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_WORDS;
+#else
+    for (uint32_t i = 0; i < size; i++) {
+        stream->crc = crc32_step(stream->crc, data[i]);
+    }
+#endif
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int crc32_stream_init(void)
+{
+#ifndef APP_HOST_BUILD
+    hcrc.Instance = CRC;
+    hcrc.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_ENABLE;
+    hcrc.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_ENABLE;
+    hcrc.Init.CRCLength = CRC_POLYLENGTH_32B;
+    hcrc.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_NONE;
+    hcrc.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE;
+    hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_WORDS;
+    __HAL_RCC_CRC_CLK_ENABLE();
+
+    if (HAL_CRC_Init(&hcrc) != HAL_OK) {
+        return -1;
+    }
+#else
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i << 24;
+        for (uint32_t bit = 0; bit < 8; bit++) {
+            c = (c & 0x80000000U) ? (c << 1) ^ CRC32_STREAM_POLYNOMIAL : c << 1;
+        }
+        crc32_table[i] = c;
+    }
+    crc32_table_ready = true;
+#endif
+    return 0;
+}
+
+void crc32_stream_begin(crc32_stream_t *stream)
+{
+#ifndef APP_HOST_BUILD
+    __HAL_CRC_DR_RESET(&hcrc);
+#else
+    if (!crc32_table_ready) {
+        crc32_stream_init();
+    }
+#endif
+    stream->crc = CRC32_STREAM_INIT;
+    stream->pending_size = 0;
+    stream->length = 0;
+}
+
+void crc32_stream_update(crc32_stream_t *stream, const uint8_t *data, uint32_t size)
+{
+    if (size == 0) {
+        return;
+    }
+    stream->length += size;
+
+    /* Complete the word a previous piece left open */
+    if (stream->pending_size > 0) {
+        const uint32_t take = (size < 4U - stream->pending_size) ? size : 4U - stream->pending_size;
+        memcpy(&stream->pending[stream->pending_size], data, take);
+        stream->pending_size += take;
+        data += take;
+        size -= take;
+        if (stream->pending_size < 4U) {
+            return;
+        }
+        crc32_feed_words(stream, stream->pending, 1);
+        stream->pending_size = 0;
+    }
+
+    crc32_feed_words(stream, data, size / 4U);
+    stream->pending_size = size & 3U;
+    memcpy(stream->pending, data + (size & ~3U), stream->pending_size);
+}
+
+uint32_t crc32_stream_end(crc32_stream_t *stream)
+{
+    if (stream->pending_size > 0) {
+        crc32_feed_bytes(stream, stream->pending, stream->pending_size);
+        stream->pending_size = 0;
+    }
+    return stream->crc;
+}
+
+uint32_t crc32_stream_compute(const uint8_t *data, uint32_t size)
+{
+    crc32_stream_t stream;
+
+    crc32_stream_begin(&stream);
+    crc32_stream_update(&stream, data, size);
+    return crc32_stream_end(&stream);
+}
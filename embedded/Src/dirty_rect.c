@@ -0,0 +1,209 @@
+/**
+ ******************************************************************************
+ * @file    dirty_rect.c
+ * @author  PeleAB
+ * @brief   Dirty-region tracking for the double-buffered overlay layer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "dirty_rect.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static uint32_t dirty_rect_area(const dirty_rect_t *r)
+{
+    return (uint32_t)(r->x1 - r->x0) * (uint32_t)(r->y1 - r->y0);
+}
+
+static dirty_rect_t dirty_rect_union(const dirty_rect_t *a, const dirty_rect_t *b)
+{
+    dirty_rect_t u;
+    u.x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    u.y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    u.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    u.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    return u;
+}
+
+/* Pixels of the bounding box covered by neither region */
+static uint32_t dirty_rect_waste(const dirty_rect_t *a, const dirty_rect_t *b)
+{
+    const dirty_rect_t u = dirty_rect_union(a, b);
+    uint32_t overlap = 0;
+    const uint16_t ix0 = (a->x0 > b->x0) ? a->x0 : b->x0;
+    const uint16_t iy0 = (a->y0 > b->y0) ? a->y0 : b->y0;
+    const uint16_t ix1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    const uint16_t iy1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+
+    if (ix0 < ix1 && iy0 < iy1) {
+        overlap = (uint32_t)(ix1 - ix0) * (uint32_t)(iy1 - iy0);
+    }
+    return dirty_rect_area(&u) + overlap - dirty_rect_area(a) - dirty_rect_area(b);
+}
+
+static void dirty_rect_remove(dirty_rect_list_t *list, uint32_t index)
+{
+    list->rects[index] = list->rects[--list->count];
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int dirty_rect_init(dirty_rect_tracker_t *tracker, uint32_t width, uint32_t height)
+{
+    if (tracker == NULL || width == 0 || height == 0 || width > UINT16_MAX || height > UINT16_MAX) {
+        return -1;
+    }
+
+    memset(tracker, 0, sizeof(*tracker));
+    tracker->width = (uint16_t)width;
+    tracker->height = (uint16_t)height;
+    /* Back buffer contents are unknown until cleared once */
+    dirty_rect_invalidate(tracker);
+    return 0;
+}
+
+int dirty_rect_begin_frame(dirty_rect_tracker_t *tracker, uint32_t buffer, dirty_rect_list_t *clear)
+{
+    if (tracker == NULL || clear == NULL || buffer >= DIRTY_RECT_BUFFER_COUNT) {
+        return -1;
+    }
+
+    const uint32_t layer = (uint32_t)tracker->width * tracker->height;
+    *clear = tracker->drawn[buffer];
+    if (!clear->full && dirty_rect_list_area(clear, tracker->width, tracker->height) * 100U >=
+                        layer * DIRTY_RECT_FULL_PERCENT) {
+        /* One large fill beats many overlapping ones */
+        clear->full = true;
+    }
+    if (clear->full) {
+        clear->count = 0;
+        tracker->stats.full_clears++;
+    }
+
+    tracker->stats.frames++;
+    tracker->stats.pixels_cleared += dirty_rect_list_area(clear, tracker->width, tracker->height);
+    tracker->stats.pixels_layer += layer;
+
+    tracker->active = buffer;
+    tracker->drawn[buffer].count = 0;
+    tracker->drawn[buffer].full = false;
+    return 0;
+}
+
+void dirty_rect_mark(dirty_rect_tracker_t *tracker, int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    if (tracker == NULL || width <= 0 || height <= 0) {
+        return;
+    }
+
+    dirty_rect_list_t *list = &tracker->drawn[tracker->active];
+    if (list->full) {
+        return;
+    }
+
+    /* Clip in 64 bits so x + width cannot overflow */
+    int64_t x0 = x, y0 = y, x1 = (int64_t)x + width, y1 = (int64_t)y + height;
+    x0 = (x0 < 0) ? 0 : x0;
+    y0 = (y0 < 0) ? 0 : y0;
+    x1 = (x1 > tracker->width) ? tracker->width : x1;
+    y1 = (y1 > tracker->height) ? tracker->height : y1;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const dirty_rect_t rect = { (uint16_t)x0, (uint16_t)y0, (uint16_t)x1, (uint16_t)y1 };
+    if (dirty_rect_list_add(list, &rect)) {
+        tracker->stats.overflows++;
+    }
+}
+
+void dirty_rect_invalidate(dirty_rect_tracker_t *tracker)
+{
+    if (tracker == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < DIRTY_RECT_BUFFER_COUNT; i++) {
+        tracker->drawn[i].count = 0;
+        tracker->drawn[i].full = true;
+    }
+}
+
+bool dirty_rect_list_add(dirty_rect_list_t *list, const dirty_rect_t *rect)
+{
+    bool overflow = false;
+
+    if (list == NULL || rect == NULL || list->full || rect->x0 >= rect->x1 || rect->y0 >= rect->y1) {
+        return false;
+    }
+
+    /* A merged region may now reach others, so rescan after every merge */
+    dirty_rect_t r = *rect;
+    uint32_t i = 0;
+    while (i < list->count) {
+        if (dirty_rect_waste(&list->rects[i], &r) <= DIRTY_RECT_MERGE_SLACK) {
+            r = dirty_rect_union(&list->rects[i], &r);
+            dirty_rect_remove(list, i);
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    while (list->count == DIRTY_RECT_MAX_REGIONS) {
+        uint32_t best = 0;
+        uint32_t best_waste = UINT32_MAX;
+        for (i = 0; i < list->count; i++) {
+            const uint32_t waste = dirty_rect_waste(&list->rects[i], &r);
+            if (waste < best_waste) {
+                best_waste = waste;
+                best = i;
+            }
+        }
+        r = dirty_rect_union(&list->rects[best], &r);
+        dirty_rect_remove(list, best);
+        overflow = true;
+    }
+
+    list->rects[list->count++] = r;
+    return overflow;
+}
+
+uint32_t dirty_rect_list_area(const dirty_rect_list_t *list, uint32_t width, uint32_t height)
+{
+    if (list == NULL) {
+        return 0;
+    }
+    if (list->full) {
+        return width * height;
+    }
+
+    uint32_t area = 0;
+    for (uint32_t i = 0; i < list->count; i++) {
+        area += dirty_rect_area(&list->rects[i]);
+    }
+    return area;
+}
+
+void dirty_rect_get_stats(const dirty_rect_tracker_t *tracker, dirty_rect_stats_t *stats)
+{
+    if (tracker == NULL || stats == NULL) {
+        return;
+    }
+    *stats = tracker->stats;
+}
@@ -7,7 +7,15 @@
 #include "pd_model_pp_if.h"
 #include "pd_pp_output_if.h"
 #include "app_constants.h"
+#include "memory_pool.h"
+#include "dirty_rect.h"
+#include "perf_monitor.h"
+#include "gfx2d.h"
+#include "box_motion.h"
+#include "text_layer.h"
 #include <math.h>
+#include <stdio.h>
+#include <string.h>
 #ifdef ENABLE_LCD_DISPLAY
 #include "stm32n6570_discovery_lcd.h"
 #include "stm32_lcd_ex.h"
@@ -52,36 +60,200 @@ Rectangle_TypeDef lcd_fg_area = {
 };
 
 #ifdef ENABLE_LCD_DISPLAY
-__attribute__ ((section (".psram_bss")))
-__attribute__ ((aligned (32)))
-uint8_t lcd_fg_buffer[2][LCD_FG_WIDTH * LCD_FG_HEIGHT * 2];
+/* ARGB4444 overlay back buffers, allocated from the application pool */
+uint8_t *lcd_fg_buffer[2];
 static int lcd_fg_buffer_rd_idx;
 static BSP_LCD_LayerConfig_t LayerConfig = {0};
 /* Removed global tracker reference - now passed as parameter */
 
+/* Regions drawn into each overlay buffer, cleared when the buffer is reused */
+static dirty_rect_tracker_t overlay_dirty;
+/* Cycles of the last full-layer clear, the cost every frame used to pay */
+static uint32_t overlay_full_clear_cycles;
+/* Overlay buffers as gfx2d destinations */
+static gfx2d_surface_t overlay_surface[2];
+/* Best aligned faces in the overlay format: one shown, one being captured */
+static gfx2d_surface_t face_thumbnail[2];
+static uint32_t face_thumbnail_shown;
+static volatile bool face_thumbnail_captured;
+
+/* Face capture handed by the pipeline to the display task, which owns the
+ * gfx2d queue */
+typedef enum {
+  FACE_CAPTURE_IDLE = 0,
+  FACE_CAPTURE_REQUESTED,              /* face_capture_src set, task pended */
+  FACE_CAPTURE_QUEUED,                 /* Blit and fence queued */
+  FACE_CAPTURE_ABANDONED,              /* Display_Sync() timed out on it */
+} face_capture_state_t;
+
+static volatile face_capture_state_t face_capture_state;
+static const uint8_t *volatile face_capture_src;
+static volatile uint32_t face_capture_timeouts;
+
+/* Best face of the frame, set by the recognition stage */
+extern bool g_cropped_face_valid;
+extern float g_current_similarity;
+
+/* Latest inference result, published by the pipeline for the display task.
+ * The pipeline writes it with the LTDC interrupt masked. */
+typedef struct {
+  uint32_t generation;                 /* Results published so far */
+  uint32_t total_frame_time_ms;
+  uint32_t boottime_ms;
+  bool face_valid;
+  float face_similarity;
+} overlay_result_t;
+
+static box_motion_t overlay_motion;
+static overlay_result_t overlay_result;
+/* Overlay refresh in progress: DMA2D clears the back buffer between the two
+ * display task passes of a refresh */
+typedef enum {
+  OVERLAY_IDLE = 0,
+  OVERLAY_CLEARING,                    /* Clears and their fence queued */
+  OVERLAY_CLEARED,                     /* Clears done, CPU drawing pending */
+  OVERLAY_FINISHING,                   /* Boxes and the reload fence queued */
+} overlay_phase_t;
+
+static volatile overlay_phase_t overlay_phase;
+/* Display task state, only touched from the LTDC interrupt and fences */
+static box_motion_box_t overlay_predicted[BOX_MOTION_MAX_TRACKS];
+static pd_pp_point_t overlay_kps[BOX_MOTION_MAX_TRACKS][AI_PD_MODEL_PP_NB_KEYPOINTS];
+static pd_pp_box_t overlay_boxes[BOX_MOTION_MAX_TRACKS];
+static uint32_t overlay_box_count;
+static uint32_t overlay_refresh_ms;
+static uint32_t overlay_clear_start;
+static bool overlay_clear_full;
+static uint32_t overlay_rendered_generation;
+static bool overlay_welcome_drawn;
+static volatile uint32_t overlay_refreshes;
+static volatile uint32_t overlay_refreshes_busy;
+static uint32_t welcome_t0;
+
+/* Overlay text, redrawn only where it changed, from glyphs pre-rendered in
+ * PSRAM: white on the translucent info band and white on transparent */
+static text_layer_t overlay_text;
+static text_atlas_t text_atlas_info;
+static text_atlas_t text_atlas_label;
+
+enum {
+  TEXT_SLOT_FPS = 0,
+  TEXT_SLOT_EMBEDDINGS,
+  TEXT_SLOT_BOOT_TIME,
+  TEXT_SLOT_WELCOME_1,
+  TEXT_SLOT_WELCOME_2,
+  TEXT_SLOT_THUMBNAIL,
+  TEXT_SLOT_LABEL,                     /* One per box from here */
+};
+
 #define SIMILARITY_COLOR_THRESHOLD 0.7f
+#define TEXT_INFO_BACK_COLOR       0x40000000
+#define FACE_THUMBNAIL_X           24 /* Left band, outside the camera image */
+#define FACE_THUMBNAIL_Y           24
+#define WELCOME_DURATION_MS        4000
+/* Below DMA2D and the camera; gfx2d fences pend it to continue their work */
+#define DISPLAY_TASK_IRQ_PRIORITY  0x0E
+/* Display_Sync() stops waiting for a face capture after this */
+#define FACE_CAPTURE_TIMEOUT_MS    GFX2D_WAIT_TIMEOUT_MS
+
+/* Fence callback: the clears are done, the CPU may draw into the buffer */
+static void OverlayCleared(void *arg)
+{
+  (void)arg;
+  uint32_t cycles = perf_monitor_now() - overlay_clear_start;
+  perf_monitor_record(PERF_PROBE_OVERLAY_CLEAR, cycles);
+  if (overlay_clear_full) {
+    overlay_full_clear_cycles = cycles;
+  }
+  overlay_phase = OVERLAY_CLEARED;
+  /* The drawing runs in the display task, not at DMA2D priority */
+  HAL_NVIC_SetPendingIRQ(LTDC_LO_IRQn);
+}
+
+/* Queue the clears of what the previous frame drew into the buffer about to
+ * be drawn; OverlayCleared() resumes the refresh once they are done */
+static int ClearOverlay(void)
+{
+  const gfx2d_surface_t *dst = &overlay_surface[lcd_fg_buffer_rd_idx];
+  dirty_rect_list_t clear;
+
+  overlay_clear_start = perf_monitor_now();
+  dirty_rect_begin_frame(&overlay_dirty, lcd_fg_buffer_rd_idx, &clear);
+  text_layer_begin_frame(&overlay_text, lcd_fg_buffer_rd_idx, dst);
+  if (clear.full) {
+    gfx2d_fill(dst, lcd_fg_area.X0, lcd_fg_area.Y0, lcd_fg_area.XSize, lcd_fg_area.YSize, 0x00000000);
+    text_layer_damage(&overlay_text, lcd_fg_area.X0, lcd_fg_area.Y0, lcd_fg_area.X0 + lcd_fg_area.XSize,
+                      lcd_fg_area.Y0 + lcd_fg_area.YSize);
+  }
+  for (uint32_t i = 0; i < clear.count; i++) {
+    gfx2d_fill(dst, clear.rects[i].x0, clear.rects[i].y0, clear.rects[i].x1 - clear.rects[i].x0,
+               clear.rects[i].y1 - clear.rects[i].y0, 0x00000000);
+    text_layer_damage(&overlay_text, clear.rects[i].x0, clear.rects[i].y0, clear.rects[i].x1, clear.rects[i].y1);
+  }
+  overlay_clear_full = clear.full;
+  /* Text and lines are drawn by the CPU, after the clears */
+  return gfx2d_fence(OverlayCleared, NULL);
+}
+
+static void MarkOverlay(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+  dirty_rect_mark(&overlay_dirty, x, y, width, height);
+}
+
+/* Text is not tracked in overlay_dirty: the text layer clears its own stale
+ * strings and redraws the ones the clears above went through */
+static void OverlayPrintAt(uint32_t slot, const text_atlas_t *atlas, uint32_t x_pos, uint32_t y_pos,
+                           Text_AlignModeTypdef mode, const char *text)
+{
+  /* Same placement as UTIL_LCD_DisplayStringAt() */
+  uint32_t size = strlen(text);
+  uint32_t line_chars = lcd_fg_area.XSize / atlas->glyph_width;
+  uint32_t column;
+  switch (mode) {
+    case CENTER_MODE:
+      column = x_pos + ((line_chars - size) * atlas->glyph_width) / 2;
+      break;
+    case RIGHT_MODE:
+      column = -x_pos + ((line_chars - size) * atlas->glyph_width);
+      break;
+    default:
+      column = x_pos;
+      break;
+  }
+  if ((column < 1) || (column >= 0x8000)) {
+    column = 1;
+  }
+  text_layer_print(&overlay_text, slot, atlas, (int32_t)column, (int32_t)y_pos, text);
+}
+
+/* "<value>%" with the given decimals, without the printf float path */
+static void FormatPercent(char *out, float value, uint32_t decimals)
+{
+  uint32_t n = text_format_fixed(out, value, decimals);
+  out[n] = '%';
+  out[n + 1] = '\0';
+}
+
+/* Screen rectangle of a detection, clamped to the camera image */
+static void BoxToScreen(const pd_pp_box_t *box, uint32_t *x0, uint32_t *y0, uint32_t *width, uint32_t *height)
+{
+  *x0 = (uint32_t)((box->x_center - box->width / 2) * ((float)lcd_bg_area.XSize)) + lcd_bg_area.X0;
+  *y0 = (uint32_t)((box->y_center - box->height / 2) * ((float)lcd_bg_area.YSize));
+  *width  = (uint32_t)(box->width  * ((float)lcd_bg_area.XSize));
+  *height = (uint32_t)(box->height * ((float)lcd_bg_area.YSize));
+  *x0 = *x0 < lcd_bg_area.X0 + lcd_bg_area.XSize ? *x0 : lcd_bg_area.X0 + lcd_bg_area.XSize - 1;
+  *y0 = *y0 < lcd_bg_area.Y0 + lcd_bg_area.YSize ? *y0 : lcd_bg_area.Y0 + lcd_bg_area.YSize - 1;
+  *width  = ((*x0 + *width)  < lcd_bg_area.X0 + lcd_bg_area.XSize) ? *width  : (lcd_bg_area.X0 + lcd_bg_area.XSize - *x0 - 1);
+  *height = ((*y0 + *height) < lcd_bg_area.Y0 + lcd_bg_area.YSize) ? *height : (lcd_bg_area.Y0 + lcd_bg_area.YSize - *y0 - 1);
+}
 
 static void DrawPDBoundingBoxes(const pd_pp_box_t *boxes, uint32_t nb,
                                 const void *ctx)
 {
-  UTIL_LCD_FillRect(lcd_fg_area.X0, lcd_fg_area.Y0, lcd_fg_area.XSize,
-                    lcd_fg_area.YSize, 0x00000000);
   for (uint32_t i = 0; i < nb; i++) {
-    uint32_t x0 = (uint32_t)((boxes[i].x_center - boxes[i].width / 2) *
-                              ((float)lcd_bg_area.XSize)) + lcd_bg_area.X0;
-    uint32_t y0 = (uint32_t)((boxes[i].y_center - boxes[i].height / 2) *
-                              ((float)lcd_bg_area.YSize));
-    uint32_t width  = (uint32_t)(boxes[i].width  * ((float)lcd_bg_area.XSize));
-    uint32_t height = (uint32_t)(boxes[i].height * ((float)lcd_bg_area.YSize));
-    x0 = x0 < lcd_bg_area.X0 + lcd_bg_area.XSize ? x0 : lcd_bg_area.X0 + lcd_bg_area.XSize - 1;
-    y0 = y0 < lcd_bg_area.Y0 + lcd_bg_area.YSize ? y0 : lcd_bg_area.Y0 + lcd_bg_area.YSize - 1;
-    width  = ((x0 + width)  < lcd_bg_area.X0 + lcd_bg_area.XSize) ? width  : (lcd_bg_area.X0 + lcd_bg_area.XSize - x0 - 1);
-    height = ((y0 + height) < lcd_bg_area.Y0 + lcd_bg_area.YSize) ? height : (lcd_bg_area.Y0 + lcd_bg_area.YSize - y0 - 1);
-    
-    /* Choose color based on similarity threshold */
-    uint32_t color_idx = boxes[i].prob >= SIMILARITY_COLOR_THRESHOLD ? 1 : 0;
-    UTIL_LCD_DrawRect(x0, y0, width, height, colors[color_idx]);
-    
+    uint32_t x0, y0, width, height;
+    BoxToScreen(&boxes[i], &x0, &y0, &width, &height);
+
     /* Draw alignment region visualization with rotation (shows actual crop area) */
     if (boxes[i].prob >= SIMILARITY_COLOR_THRESHOLD) {
       /* Get eye positions for rotation calculation */
@@ -137,17 +309,92 @@ static void DrawPDBoundingBoxes(const pd_pp_box_t *boxes, uint32_t nb,
         if (x1 < lcd_bg_area.X0 + lcd_bg_area.XSize && y1 < lcd_bg_area.Y0 + lcd_bg_area.YSize &&
             x2 < lcd_bg_area.X0 + lcd_bg_area.XSize && y2 < lcd_bg_area.Y0 + lcd_bg_area.YSize) {
           UTIL_LCD_DrawLine(x1, y1, x2, y2, UTIL_LCD_COLOR_CYAN);
+          MarkOverlay(x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2,
+                      (x1 < x2 ? x2 - x1 : x1 - x2) + 1, (y1 < y2 ? y2 - y1 : y1 - y2) + 1);
         }
       }
     }
-    
-    /* Display similarity percentage above bounding box */
-    UTIL_LCDEx_PrintfAt(x0, y0 - 15, LEFT_MODE, "%.1f%%", boxes[i].prob * 100.f);
   }
   /* Tracker-specific overlay removed - now using detection-based display */
   (void)ctx;  /* Context parameter unused in simplified version */
 }
 
+/* Box outlines go to DMA2D after the CPU drawing is done */
+static void QueueBoundingBoxes(const pd_pp_box_t *boxes, uint32_t nb)
+{
+  const gfx2d_surface_t *dst = &overlay_surface[lcd_fg_buffer_rd_idx];
+
+  for (uint32_t i = 0; i < nb; i++) {
+    uint32_t x0, y0, width, height;
+    BoxToScreen(&boxes[i], &x0, &y0, &width, &height);
+
+    /* Choose color based on similarity threshold */
+    uint32_t color_idx = boxes[i].prob >= SIMILARITY_COLOR_THRESHOLD ? 1 : 0;
+    gfx2d_rect(dst, x0, y0, width, height, 1, colors[color_idx]);
+    MarkOverlay(x0, y0, width, 1);
+    MarkOverlay(x0, y0 + height - 1, width, 1);
+    MarkOverlay(x0, y0, 1, height);
+    MarkOverlay(x0 + width - 1, y0, 1, height);
+  }
+}
+
+static void QueueFaceThumbnail(void)
+{
+  const gfx2d_surface_t *thumbnail = &face_thumbnail[face_thumbnail_shown];
+
+  if (!overlay_result.face_valid || thumbnail->pixels == NULL) {
+    return;
+  }
+  gfx2d_blit(&overlay_surface[lcd_fg_buffer_rd_idx], FACE_THUMBNAIL_X, FACE_THUMBNAIL_Y, thumbnail);
+  MarkOverlay(FACE_THUMBNAIL_X, FACE_THUMBNAIL_Y, thumbnail->width, thumbnail->height);
+}
+
+/* Similarity above each box (inside it at the top edge) */
+static void PrintBoxLabels(const pd_pp_box_t *boxes, uint32_t nb)
+{
+  char label[16];
+
+  nb = nb < TEXT_LAYER_MAX_SLOTS - TEXT_SLOT_LABEL ? nb : TEXT_LAYER_MAX_SLOTS - TEXT_SLOT_LABEL;
+  for (uint32_t i = 0; i < nb; i++) {
+    uint32_t x0, y0, width, height;
+    BoxToScreen(&boxes[i], &x0, &y0, &width, &height);
+    FormatPercent(label, boxes[i].prob * 100.f, 1);
+    OverlayPrintAt(TEXT_SLOT_LABEL + i, &text_atlas_label, x0, y0 >= 15 ? y0 - 15 : 0, LEFT_MODE, label);
+  }
+}
+
+static void PrintFaceThumbnailLabel(void)
+{
+  const gfx2d_surface_t *thumbnail = &face_thumbnail[face_thumbnail_shown];
+  char label[16];
+
+  if (!overlay_result.face_valid || thumbnail->pixels == NULL) {
+    return;
+  }
+  FormatPercent(label, overlay_result.face_similarity * 100.f, 0);
+  OverlayPrintAt(TEXT_SLOT_THUMBNAIL, &text_atlas_info, FACE_THUMBNAIL_X, FACE_THUMBNAIL_Y + thumbnail->height + 4,
+                 LEFT_MODE, label);
+}
+
+/* Fence callback: the buffer is complete, latch it at the next blanking */
+static void ReloadOverlay(void *arg)
+{
+  (void)arg;
+  HAL_LTDC_ReloadLayer(&hlcd_ltdc, LTDC_RELOAD_VERTICAL_BLANKING, LTDC_LAYER_2);
+  overlay_phase = OVERLAY_IDLE;
+}
+
+/* Fence callback: the face is in the hidden thumbnail, rgb888 is free */
+static void FaceCaptured(void *arg)
+{
+  (void)arg;
+  if (face_capture_state == FACE_CAPTURE_QUEUED) {
+    /* Shown from the next published result */
+    face_thumbnail_captured = true;
+  }
+  face_capture_state = FACE_CAPTURE_IDLE;
+}
+
 static void DrawPdLandmarks(const pd_pp_box_t *boxes, uint32_t nb, uint32_t nb_kp)
 {
   for (uint32_t i = 0; i < nb; i++) {
@@ -157,6 +404,7 @@ static void DrawPdLandmarks(const pd_pp_box_t *boxes, uint32_t nb, uint32_t nb_k
       x = x < lcd_bg_area.X0 + lcd_bg_area.XSize ? x : lcd_bg_area.X0 + lcd_bg_area.XSize - 1;
       y = y < lcd_bg_area.Y0 + lcd_bg_area.YSize ? y : lcd_bg_area.Y0 + lcd_bg_area.YSize - 1;
       UTIL_LCD_SetPixel(x, y, UTIL_LCD_COLOR_RED);
+      MarkOverlay(x, y, 1, 1);
     }
   }
 }
@@ -164,6 +412,7 @@ static void DrawPdLandmarks(const pd_pp_box_t *boxes, uint32_t nb, uint32_t nb_k
 #endif /* ENABLE_LCD_DISPLAY */
 
 #ifdef ENABLE_PC_STREAM
+/* One frame per pipeline frame: the PC stream rate control decimates or skips it */
 static void StreamOutputPd(const pd_postprocess_out_t *p_postprocess)
 {
   SCB_InvalidateDCache_by_Addr(img_buffer, sizeof(img_buffer));
@@ -174,43 +423,209 @@ static void StreamOutputPd(const pd_postprocess_out_t *p_postprocess)
 #ifdef ENABLE_LCD_DISPLAY
 static void PrintInfo(uint32_t nb_rois, uint32_t total_frame_time_ms, uint32_t boottime_ms)
 {
-  UTIL_LCD_SetBackColor(0x40000000);
+  char line[TEXT_LAYER_MAX_CHARS + 1];
+  uint32_t n;
+
 //  UTIL_LCDEx_PrintfAt(0, LINE(2), CENTER_MODE, "Objects %u", nb_rois);
-  UTIL_LCDEx_PrintfAt(0, LINE(20), CENTER_MODE, "FPS: %u", 1000/total_frame_time_ms);
-  UTIL_LCDEx_PrintfAt(0, LINE(21), CENTER_MODE, "Embeddings: %d/%d", embeddings_bank_count(), EMBEDDING_BANK_SIZE);
-  UTIL_LCDEx_PrintfAt(0, LINE(22), CENTER_MODE, "Boot time: %ums", boottime_ms);
-  UTIL_LCD_SetBackColor(0);
+  (void)nb_rois;
+  memcpy(line, "FPS: ", 5);
+  text_format_u32(&line[5], total_frame_time_ms ? 1000/total_frame_time_ms : 0);
+  OverlayPrintAt(TEXT_SLOT_FPS, &text_atlas_info, 0, LINE(20), CENTER_MODE, line);
+
+  memcpy(line, "Embeddings: ", 12);
+  n = 12 + text_format_u32(&line[12], (uint32_t)embeddings_bank_count());
+  line[n++] = '/';
+  text_format_u32(&line[n], EMBEDDING_BANK_SIZE);
+  OverlayPrintAt(TEXT_SLOT_EMBEDDINGS, &text_atlas_info, 0, LINE(21), CENTER_MODE, line);
+
+  memcpy(line, "Boot time: ", 11);
+  n = 11 + text_format_u32(&line[11], boottime_ms);
+  memcpy(&line[n], "ms", 3);
+  OverlayPrintAt(TEXT_SLOT_BOOT_TIME, &text_atlas_info, 0, LINE(22), CENTER_MODE, line);
   Display_WelcomeScreen();
 }
+
+static bool WelcomeActive(uint32_t now)
+{
+  if (welcome_t0 == 0)
+    welcome_t0 = now;
+  return now - welcome_t0 < WELCOME_DURATION_MS;
+}
+
+/* Something on screen changes at this refresh */
+static bool OverlayNeedsRefresh(uint32_t now)
+{
+  if (overlay_result.generation != overlay_rendered_generation || WelcomeActive(now) || overlay_welcome_drawn) {
+    return true;
+  }
+  for (uint32_t i = 0; i < overlay_motion.count; i++) {
+    if (now - overlay_motion.tracks[i].t_last <= overlay_motion.config.max_extrapolation_ms) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Display task, line event pass: predicts the boxes for this refresh and
+ * queues the clears. It never waits on DMA2D. */
+static void RenderOverlay(void)
+{
+  uint32_t now = HAL_GetTick();
+
+  if (!OverlayNeedsRefresh(now)) {
+    return;
+  }
+  /* Never wait on the previous refresh */
+  if (overlay_phase != OVERLAY_IDLE) {
+    overlay_refreshes_busy++;
+    return;
+  }
+
+  uint32_t nb = box_motion_predict(&overlay_motion, now - DISPLAY_OVERLAY_RENDER_DELAY_MS, overlay_predicted,
+                                   BOX_MOTION_MAX_TRACKS);
+  for (uint32_t i = 0; i < nb; i++) {
+    overlay_boxes[i].prob     = overlay_predicted[i].prob;
+    overlay_boxes[i].x_center = overlay_predicted[i].x_center;
+    overlay_boxes[i].y_center = overlay_predicted[i].y_center;
+    overlay_boxes[i].width    = overlay_predicted[i].width;
+    overlay_boxes[i].height   = overlay_predicted[i].height;
+    overlay_boxes[i].pKps     = overlay_kps[i];
+    for (uint32_t k = 0; k < AI_PD_MODEL_PP_NB_KEYPOINTS; k++) {
+      overlay_kps[i][k].x = overlay_predicted[i].kps[k].x;
+      overlay_kps[i][k].y = overlay_predicted[i].kps[k].y;
+    }
+  }
+  overlay_box_count = nb;
+  overlay_refresh_ms = now;
+  overlay_rendered_generation = overlay_result.generation;
+
+  /* The previous refresh has run its reload fence */
+  HAL_LTDC_SetAddress_NoReload(&hlcd_ltdc, (uint32_t)lcd_fg_buffer[lcd_fg_buffer_rd_idx], LTDC_LAYER_2);
+  overlay_phase = OVERLAY_CLEARING;
+  if (ClearOverlay() != 0) {
+    overlay_phase = OVERLAY_IDLE;
+  }
+  gfx2d_flush();
+}
+
+/* Display task, pass after the clears: CPU drawing for at most
+ * BOX_MOTION_MAX_TRACKS boxes, then DMA2D finishes the buffer */
+static void FinishOverlay(void)
+{
+  const pd_pp_box_t *boxes = overlay_boxes;
+  uint32_t nb = overlay_box_count;
+
+  /* Text first: clearing a stale string must not cut through the lines */
+  PrintBoxLabels(boxes, nb);
+  PrintFaceThumbnailLabel();
+  PrintInfo(nb, overlay_result.total_frame_time_ms, overlay_result.boottime_ms);
+  text_layer_end_frame(&overlay_text);
+  overlay_welcome_drawn = WelcomeActive(overlay_refresh_ms);
+  DrawPDBoundingBoxes(boxes, nb, NULL);
+  DrawPdLandmarks(boxes, nb, AI_PD_MODEL_PP_NB_KEYPOINTS);
+
+  /* The reload latches the buffer at the next blanking */
+  QueueBoundingBoxes(boxes, nb);
+  QueueFaceThumbnail();
+  overlay_phase = OVERLAY_FINISHING;
+  if (gfx2d_fence(ReloadOverlay, NULL) != 0) {
+    overlay_phase = OVERLAY_IDLE;
+  }
+  lcd_fg_buffer_rd_idx = 1 - lcd_fg_buffer_rd_idx;
+  overlay_refreshes++;
+  gfx2d_flush();
+}
+
+/* Copy the requested face into the hidden thumbnail; the pipeline's buffer
+ * is free again once FaceCaptured() runs */
+static void QueueFaceCapture(void)
+{
+  const gfx2d_surface_t src = {
+    .pixels = (uint8_t *)face_capture_src,
+    .width  = face_thumbnail[0].width,
+    .height = face_thumbnail[0].height,
+    .stride = face_thumbnail[0].width,
+    .format = GFX2D_FORMAT_RGB888,
+  };
+
+  face_capture_state = FACE_CAPTURE_QUEUED;
+  if (gfx2d_blit(&face_thumbnail[1 - face_thumbnail_shown], 0, 0, &src) != 0 ||
+      gfx2d_fence(FaceCaptured, NULL) != 0) {
+    face_capture_state = FACE_CAPTURE_IDLE;
+  }
+  gfx2d_flush();
+}
+
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  uint32_t start = perf_monitor_now();
+
+  RenderOverlay();
+  perf_monitor_record(PERF_PROBE_DISPLAY_TASK, perf_monitor_now() - start);
+  /* The HAL disarms the line event each time it fires */
+  __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_LI);
+}
+
+void Display_Task(void)
+{
+  uint32_t start = perf_monitor_now();
+  bool ran = false;
+
+  if (face_capture_state == FACE_CAPTURE_REQUESTED) {
+    QueueFaceCapture();
+    ran = true;
+  }
+  if (overlay_phase == OVERLAY_CLEARED) {
+    FinishOverlay();
+    ran = true;
+  }
+  if (ran) {
+    perf_monitor_record(PERF_PROBE_DISPLAY_TASK, perf_monitor_now() - start);
+  }
+}
 #endif /* ENABLE_LCD_DISPLAY */
 
-void Display_NetworkOutput(pd_postprocess_out_t *p_postprocess, uint32_t total_frame_time_ms, uint32_t boottime_ts, const void *ctx)
+void Display_NetworkOutput(pd_postprocess_out_t *p_postprocess, uint32_t total_frame_time_ms, uint32_t boottime_ts,
+                           uint32_t capture_ms, const void *ctx)
 {
 #ifdef ENABLE_LCD_DISPLAY
-  int ret = HAL_LTDC_SetAddress_NoReload(&hlcd_ltdc,
-                                         (uint32_t)lcd_fg_buffer[lcd_fg_buffer_rd_idx],
-                                         LTDC_LAYER_2);
-  assert(ret == HAL_OK);
-  DrawPDBoundingBoxes(p_postprocess->pOutData, p_postprocess->box_nb, ctx);
-  DrawPdLandmarks(p_postprocess->pOutData, p_postprocess->box_nb, AI_PD_MODEL_PP_NB_KEYPOINTS);
-  
-  /* Display cropped face if available - access via external global variables */
-  extern uint8_t fr_rgb[];
-  extern bool g_cropped_face_valid;
-  extern float g_current_similarity;
-  
+  static box_motion_box_t detections[BOX_MOTION_MAX_TRACKS];
+  uint32_t nb = p_postprocess->box_nb < BOX_MOTION_MAX_TRACKS ? p_postprocess->box_nb : BOX_MOTION_MAX_TRACKS;
+
+  for (uint32_t i = 0; i < nb; i++) {
+    const pd_pp_box_t *box = &p_postprocess->pOutData[i];
+    detections[i].prob     = box->prob;
+    detections[i].x_center = box->x_center;
+    detections[i].y_center = box->y_center;
+    detections[i].width    = box->width;
+    detections[i].height   = box->height;
+    for (uint32_t k = 0; k < AI_PD_MODEL_PP_NB_KEYPOINTS; k++) {
+      detections[i].kps[k].x = box->pKps[k].x;
+      detections[i].kps[k].y = box->pKps[k].y;
+    }
+  }
+
+  /* Publish to the display task; drawing happens there, at panel rate */
+  HAL_NVIC_DisableIRQ(LTDC_LO_IRQn);
+  box_motion_update(&overlay_motion, detections, nb, capture_ms);
+  overlay_result.total_frame_time_ms = total_frame_time_ms;
+  overlay_result.boottime_ms = boottime_ts;
+  overlay_result.face_valid = g_cropped_face_valid;
+  overlay_result.face_similarity = g_current_similarity;
+  if (face_thumbnail_captured) {
+    face_thumbnail_shown = 1 - face_thumbnail_shown;
+    face_thumbnail_captured = false;
+  }
+  overlay_result.generation++;
+  HAL_NVIC_EnableIRQ(LTDC_LO_IRQn);
 #endif
 #ifdef ENABLE_PC_STREAM
   StreamOutputPd(p_postprocess);
 #endif
-#ifdef ENABLE_LCD_DISPLAY
-  PrintInfo(p_postprocess->box_nb, total_frame_time_ms, boottime_ts);
-  ret = HAL_LTDC_ReloadLayer(&hlcd_ltdc, LTDC_RELOAD_VERTICAL_BLANKING, LTDC_LAYER_2);
-  assert(ret == HAL_OK);
-  lcd_fg_buffer_rd_idx = 1 - lcd_fg_buffer_rd_idx;
-#else
-  (void)inference_ms;
+#ifndef ENABLE_LCD_DISPLAY
+  (void)total_frame_time_ms;
   (void)boottime_ts;
+  (void)capture_ms;
 #endif
   (void)p_postprocess; /* in case both features are disabled */
   (void)ctx; /* in case LCD display is disabled */
@@ -219,6 +634,14 @@ void Display_NetworkOutput(pd_postprocess_out_t *p_postprocess, uint32_t total_f
 #ifdef ENABLE_LCD_DISPLAY
 void LCD_init(void)
 {
+  memory_pool_t *pool = memory_pool_get_default();
+  for (int i = 0; i < 2; i++) {
+    lcd_fg_buffer[i] = memory_pool_alloc_region(pool, MEMORY_REGION_PSRAM, LCD_FG_FRAMEBUFFER_SIZE,
+                                                CACHE_LINE_ALIGNMENT, MEMORY_BUFFER_TYPE_FRAME_CAPTURE,
+                                                i == 0 ? "lcd_fg_buffer0" : "lcd_fg_buffer1");
+    assert(lcd_fg_buffer[i] != NULL);
+  }
+
   BSP_LCD_Init(0, LCD_ORIENTATION_LANDSCAPE);
 
   LayerConfig.X0          = lcd_bg_area.X0;
@@ -235,7 +658,7 @@ void LCD_init(void)
   LayerConfig.X1 = lcd_fg_area.X0 + lcd_fg_area.XSize;
   LayerConfig.Y1 = lcd_fg_area.Y0 + lcd_fg_area.YSize;
   LayerConfig.PixelFormat = LCD_PIXEL_FORMAT_ARGB4444;
-  LayerConfig.Address = (uint32_t)lcd_fg_buffer;
+  LayerConfig.Address = (uint32_t)lcd_fg_buffer[0];
 
   BSP_LCD_ConfigLayer(0, LTDC_LAYER_2, &LayerConfig);
   UTIL_LCD_SetFuncDriver(&LCD_Driver);
@@ -243,20 +666,129 @@ void LCD_init(void)
   UTIL_LCD_Clear(0x00000000);
   UTIL_LCD_SetFont(&Font20);
   UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_WHITE);
+
+  /* Second buffer is uninitialized; both get one full clear on first use */
+  dirty_rect_init(&overlay_dirty, lcd_fg_area.XSize, lcd_fg_area.YSize);
+
+  for (int i = 0; i < 2; i++) {
+    overlay_surface[i].pixels = lcd_fg_buffer[i];
+    overlay_surface[i].width  = lcd_fg_area.XSize;
+    overlay_surface[i].height = lcd_fg_area.YSize;
+    overlay_surface[i].stride = lcd_fg_area.XSize;
+    overlay_surface[i].format = GFX2D_FORMAT_ARGB4444;
+  }
+  for (int i = 0; i < 2; i++) {
+    face_thumbnail[i].pixels = memory_pool_alloc(pool, FACE_RECOGNITION_WIDTH * FACE_RECOGNITION_HEIGHT * 2,
+                                                 CACHE_LINE_ALIGNMENT, MEMORY_BUFFER_TYPE_POSTPROCESSING,
+                                                 i == 0 ? "face_thumbnail0" : "face_thumbnail1");
+    face_thumbnail[i].width  = FACE_RECOGNITION_WIDTH;
+    face_thumbnail[i].height = FACE_RECOGNITION_HEIGHT;
+    face_thumbnail[i].stride = FACE_RECOGNITION_WIDTH;
+    face_thumbnail[i].format = GFX2D_FORMAT_ARGB4444;
+  }
+
+  /* After BSP_LCD_Init(), which configures DMA2D for UTIL_LCD */
+  gfx2d_init();
+
+  size_t atlas_size = text_atlas_size(&Font20);
+  void *atlas_info = memory_pool_alloc_region(pool, MEMORY_REGION_PSRAM, atlas_size, CACHE_LINE_ALIGNMENT,
+                                              MEMORY_BUFFER_TYPE_POSTPROCESSING, "text_atlas_info");
+  void *atlas_label = memory_pool_alloc_region(pool, MEMORY_REGION_PSRAM, atlas_size, CACHE_LINE_ALIGNMENT,
+                                               MEMORY_BUFFER_TYPE_POSTPROCESSING, "text_atlas_label");
+  assert(atlas_info != NULL && atlas_label != NULL);
+  text_atlas_init(&text_atlas_info, &Font20, UTIL_LCD_COLOR_WHITE, TEXT_INFO_BACK_COLOR, atlas_info, atlas_size);
+  text_atlas_init(&text_atlas_label, &Font20, UTIL_LCD_COLOR_WHITE, 0x00000000, atlas_label, atlas_size);
+  text_layer_init(&overlay_text);
+
+  box_motion_config_t motion_config;
+  box_motion_default_config(&motion_config);
+  motion_config.max_extrapolation_ms = DISPLAY_OVERLAY_MAX_EXTRAPOLATION_MS;
+  box_motion_init(&overlay_motion, &motion_config, AI_PD_MODEL_PP_NB_KEYPOINTS);
+
+  /* Start the display task: one refresh per panel frame, from the start of
+   * vertical sync */
+  HAL_NVIC_SetPriority(LTDC_LO_IRQn, DISPLAY_TASK_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(LTDC_LO_IRQn);
+  HAL_LTDC_ProgramLineEvent(&hlcd_ltdc, 0);
 }
 
-void Display_WelcomeScreen(void)
+void Display_CaptureFace(const uint8_t *rgb888, uint32_t width, uint32_t height)
 {
-  static uint32_t t0 = 0;
-  if (t0 == 0)
-    t0 = HAL_GetTick();
+  if (face_thumbnail[0].pixels == NULL || width != face_thumbnail[0].width || height != face_thumbnail[0].height) {
+    return;
+  }
+  /* One capture at a time; Display_Sync() ends the previous one */
+  if (face_capture_state != FACE_CAPTURE_IDLE) {
+    return;
+  }
+  face_capture_src = rgb888;
+  face_capture_state = FACE_CAPTURE_REQUESTED;
+  /* The display task queues it now, not at the next line event */
+  HAL_NVIC_SetPendingIRQ(LTDC_LO_IRQn);
+}
+
+void Display_Sync(void)
+{
+  uint32_t start = HAL_GetTick();
+
+  /* Only the capture: the display task's own refresh is not waited for */
+  while (face_capture_state == FACE_CAPTURE_REQUESTED || face_capture_state == FACE_CAPTURE_QUEUED) {
+    if (HAL_GetTick() - start > FACE_CAPTURE_TIMEOUT_MS) {
+      /* Nothing is aborted: a late blit only spoils a thumbnail never shown */
+      uint32_t primask = __get_PRIMASK();
+      __disable_irq();
+      if (face_capture_state == FACE_CAPTURE_REQUESTED) {
+        face_capture_state = FACE_CAPTURE_IDLE;
+      } else if (face_capture_state == FACE_CAPTURE_QUEUED) {
+        face_capture_state = FACE_CAPTURE_ABANDONED;
+      }
+      __set_PRIMASK(primask);
+      face_capture_timeouts++;
+      return;
+    }
+  }
+}
 
-  if (HAL_GetTick() - t0 < 4000)
+void Display_PrintOverlayStats(void)
+{
+  dirty_rect_stats_t stats;
+  perf_summary_t clear;
+  perf_summary_t task;
+
+  dirty_rect_get_stats(&overlay_dirty, &stats);
+  perf_monitor_get_summary(PERF_PROBE_OVERLAY_CLEAR, &clear);
+  perf_monitor_get_summary(PERF_PROBE_DISPLAY_TASK, &task);
+  if (stats.frames == 0 || stats.pixels_layer == 0) {
+    return;
+  }
+
+  uint32_t full_us = overlay_full_clear_cycles / perf_monitor_cycles_per_us();
+  printf("Overlay clear: %lu%% of layer (%lu KB/frame saved), avg %lu us vs %lu us full, "
+         "%lu full clears, %lu overflows\n",
+         (unsigned long)(stats.pixels_cleared * 100U / stats.pixels_layer),
+         (unsigned long)((stats.pixels_layer - stats.pixels_cleared) * 2U / stats.frames / 1024U),
+         (unsigned long)clear.avg_us, (unsigned long)full_us,
+         (unsigned long)stats.full_clears, (unsigned long)stats.overflows);
+  printf("Overlay refresh: %lu panel-rate refreshes for %lu results, %lu skipped while the last one was busy\n",
+         (unsigned long)overlay_refreshes, (unsigned long)overlay_result.generation,
+         (unsigned long)overlay_refreshes_busy);
+  /* Stage probes include the display task passes that preempted them */
+  printf("Display task: avg %lu us, max %lu us per pass; %lu face captures timed out\n",
+         (unsigned long)task.avg_us, (unsigned long)task.max_us, (unsigned long)face_capture_timeouts);
+
+  text_layer_stats_t text;
+  text_layer_get_stats(&overlay_text, &text);
+  printf("Overlay text: %lu of %lu strings redrawn, %lu glyphs, %lu stale strings cleared\n",
+         (unsigned long)text.redraws, (unsigned long)text.prints, (unsigned long)text.glyphs,
+         (unsigned long)text.erases);
+}
+
+void Display_WelcomeScreen(void)
+{
+  if (WelcomeActive(HAL_GetTick()))
   {
-    UTIL_LCD_SetBackColor(0x40000000);
-    UTIL_LCDEx_PrintfAt(0, LINE(17), CENTER_MODE, WELCOME_MSG_1);
-    UTIL_LCDEx_PrintfAt(0, LINE(18), CENTER_MODE, WELCOME_MSG_2);
-    UTIL_LCD_SetBackColor(0);
+    OverlayPrintAt(TEXT_SLOT_WELCOME_1, &text_atlas_info, 0, LINE(17), CENTER_MODE, WELCOME_MSG_1);
+    OverlayPrintAt(TEXT_SLOT_WELCOME_2, &text_atlas_info, 0, LINE(18), CENTER_MODE, WELCOME_MSG_2);
   }
 }
 
@@ -270,4 +802,23 @@ void Display_WelcomeScreen(void)
 {
 }
 
+void Display_PrintOverlayStats(void)
+{
+}
+
+void Display_CaptureFace(const uint8_t *rgb888, uint32_t width, uint32_t height)
+{
+  (void)rgb888;
+  (void)width;
+  (void)height;
+}
+
+void Display_Sync(void)
+{
+}
+
+void Display_Task(void)
+{
+}
+
 #endif /* ENABLE_LCD_DISPLAY */
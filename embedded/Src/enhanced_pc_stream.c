@@ -1,7 +1,7 @@
 /**
  ******************************************************************************
  * @file    enhanced_pc_stream.c
- * @brief   Enhanced PC streaming with robust 4-byte header protocol
+ * @brief   Enhanced PC streaming with robust v1/v2 framed protocol
  ******************************************************************************
  */
 
@@ -9,8 +9,13 @@
 #include "stm32n6570_discovery.h"
 #include "stm32n6570_discovery_conf.h"
 #include "stm32n6xx_hal_uart.h"
-#include "stm32n6xx_hal_crc.h"
 #include "app_config.h"
+#include "memory_pool.h"
+#include "robust_framing.h"
+#include "tile_delta.h"
+#include "frame_codec.h"
+#include "stream_rate.h"
+#include "perf_monitor.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
@@ -19,13 +24,10 @@
 /* CONFIGURATION CONSTANTS                                                   */
 /* ========================================================================= */
 
-#define ROBUST_SOF_BYTE             0xAA
-#define ROBUST_HEADER_SIZE          4   // Back to 4 bytes for header only
-#define ROBUST_CRC_SIZE             4   // CRC32 at end of packet
-#define ROBUST_MAX_PAYLOAD_SIZE     (64 * 1024)
-#define ROBUST_MSG_HEADER_SIZE      3
-#define UART_TIMEOUT                1000
+/* Framing constants (SOF, header and CRC sizes) are in robust_framing.h */
+#define ROBUST_MAX_DETECTIONS       10  // Reasonable limit for streaming
 #define STREAM_SCALE                2
+#define PC_TX_DMA_IRQ_PRIORITY      0x0D
 /* ========================================================================= */
 /* MESSAGE TYPES                                                             */
 /* ========================================================================= */
@@ -39,7 +41,11 @@ typedef enum {
     ROBUST_MSG_ERROR_REPORT = 0x06,
     ROBUST_MSG_COMMAND_REQUEST = 0x07,
     ROBUST_MSG_COMMAND_RESPONSE = 0x08,
-    ROBUST_MSG_DEBUG_INFO = 0x09
+    ROBUST_MSG_DEBUG_INFO = 0x09,
+    ROBUST_MSG_PERF_SUMMARY = 0x0A,
+    ROBUST_MSG_EPOCH_PROFILE = 0x0B,
+    ROBUST_MSG_STALL_REPORT = 0x0C,
+    ROBUST_MSG_FRAME_DELTA = 0x0D
 } robust_message_type_t;
 
 /* ========================================================================= */
@@ -67,12 +73,33 @@ typedef struct __attribute__((packed)) {
  * @brief Frame data payload format for raw grayscale frames
  */
 typedef struct __attribute__((packed)) {
-    char frame_type[4];         /* Frame type: "JPG", "ALN", etc. */
+    char frame_type[3];         /* Frame type: "JPG", "ALN", etc. */
+    uint8_t flags;              /* ROBUST_FRAME_FLAG_*, 0 in older firmware */
     uint32_t width;             /* Frame width */
     uint32_t height;            /* Frame height */
     /* Raw grayscale image data follows (1 byte per pixel) */
 } robust_frame_data_t;
 
+#define ROBUST_FRAME_FLAG_CODED     0x01    /* Pixels are a frame_codec stream */
+
+/**
+ * @brief Piece of a message payload, gathered into the transmit queue
+ */
+typedef struct {
+    const void *data;
+    uint32_t size;
+} robust_segment_t;
+
+/**
+ * @brief Heartbeat payload; always v1 framed so any decoder reads it
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t timestamp;         /* HAL tick */
+    uint8_t protocol_version;   /* Framing of the other messages */
+    uint8_t reserved;
+    uint16_t chunk_size;        /* Largest v2 chunk payload */
+} robust_heartbeat_t;
+
 /**
  * @brief Embedding data payload format
  */
@@ -89,6 +116,7 @@ typedef struct {
     bool initialized;
     uint32_t last_heartbeat_time;
     uint16_t sequence_counters[16]; /* Sequence counters per message type */
+    uint8_t protocol_version;       /* Framing of every message but the heartbeat */
 } enhanced_protocol_ctx_t;
 
 /* ========================================================================= */
@@ -109,60 +137,27 @@ static MX_UART_InitTypeDef PcUartInit = {
 /* Protocol context */
 static enhanced_protocol_ctx_t g_protocol_ctx = {0};
 
-/* CRC handle for payload validation */
-static CRC_HandleTypeDef hcrc;
+/* Transmit queue: payloads are built in its arena and sent by DMA */
+static uart_tx_queue_t pc_tx_queue;
+static DMA_HandleTypeDef hdma_pc_tx;
 
-/* Buffers */
-__attribute__ ((section (".psram_bss")))
-__attribute__((aligned (32)))
-static uint8_t temp_buffer[64 * 1024];
+/* Tile delta encoder of the decimated frames, NULL reference when off */
+static tile_delta_t pc_delta;
+static bool pc_delta_ready;
 
-__attribute__ ((section (".psram_bss")))
-__attribute__((aligned (32)))
-static uint8_t stream_buffer[320 * 240];  // Raw grayscale frame buffer
+/* Coder of whole frames and the coded frame being sent, NULL when off */
+static frame_codec_t pc_codec;
+static uint8_t *pc_codec_buffer;
+static bool pc_codec_enabled = (PC_STREAM_FRAME_CODEC > 0);
+
+/* Rate control of frames and crops */
+static stream_rate_t pc_rate;
+static bool pc_rate_enabled = (PC_STREAM_RATE_CONTROL > 0);
 
 /* ========================================================================= */
 /* UTILITY FUNCTIONS                                                         */
 /* ========================================================================= */
 
-/**
- * @brief Initialize CRC32 peripheral
- */
-static bool crc32_init(void)
-{
-    hcrc.Instance = CRC;
-    hcrc.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_ENABLE;
-    hcrc.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_ENABLE;
-
-    hcrc.Init.CRCLength=CRC_POLYLENGTH_32B;
-
-    hcrc.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_NONE;
-
-    hcrc.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE;
-
-    hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_WORDS;
-    __HAL_RCC_CRC_CLK_ENABLE();
-    
-    if (HAL_CRC_Init(&hcrc) != HAL_OK) {
-        return false;
-    }
-    
-    return true;
-}
-
-/**
- * @brief Calculate CRC32 for payload data
- */
-static uint32_t calculate_crc32(const uint8_t *data, uint32_t length)
-{
-    if (!data || length == 0) {
-        return 0;
-    }
-    
-    return HAL_CRC_Calculate(&hcrc, (uint32_t*)data, (length+3)/4);
-}
-
-
 /**
  * @brief Get next sequence ID for message type
  */
@@ -199,98 +194,299 @@ static uint8_t rgb888_to_gray(uint8_t r, uint8_t g, uint8_t b)
 /* ========================================================================= */
 
 /**
- * @brief Send raw message with robust header and CRC32 at packet end
+ * @brief Start a DMA transfer for the transmit queue
  */
-static bool robust_send_message(robust_message_type_t message_type, 
-                               const uint8_t *payload, uint32_t payload_size)
+static int pc_tx_start(void *ctx, const uint8_t *data, uint32_t size)
+{
+    UART_HandleTypeDef *huart = (UART_HandleTypeDef *)ctx;
+
+    /* The DMA reads memory: write the bytes back from the D-cache first */
+    SCB_CleanDCache_by_Addr((void *)data, (int32_t)size);
+    return (HAL_UART_Transmit_DMA(huart, data, (uint16_t)size) == HAL_OK) ? 0 : -1;
+}
+
+/**
+ * @brief Route USART1 transmissions through a GPDMA channel
+ */
+static bool pc_tx_dma_init(UART_HandleTypeDef *huart)
+{
+    __HAL_RCC_GPDMA1_CLK_ENABLE();
+
+    hdma_pc_tx.Instance = GPDMA1_Channel0;
+    hdma_pc_tx.Init.Request = GPDMA1_REQUEST_USART1_TX;
+    hdma_pc_tx.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hdma_pc_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma_pc_tx.Init.SrcInc = DMA_SINC_INCREMENTED;
+    hdma_pc_tx.Init.DestInc = DMA_DINC_FIXED;
+    hdma_pc_tx.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_BYTE;
+    hdma_pc_tx.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+    hdma_pc_tx.Init.Priority = DMA_LOW_PRIORITY_LOW_WEIGHT;
+    hdma_pc_tx.Init.SrcBurstLength = 1;
+    hdma_pc_tx.Init.DestBurstLength = 1;
+    hdma_pc_tx.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hdma_pc_tx.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hdma_pc_tx.Init.Mode = DMA_NORMAL;
+    if (HAL_DMA_Init(&hdma_pc_tx) != HAL_OK) {
+        return false;
+    }
+    if (HAL_DMA_ConfigChannelAttributes(&hdma_pc_tx, DMA_CHANNEL_PRIV | DMA_CHANNEL_SEC |
+                                        DMA_CHANNEL_SRC_SEC | DMA_CHANNEL_DEST_SEC) != HAL_OK) {
+        return false;
+    }
+    __HAL_LINKDMA(huart, hdmatx, hdma_pc_tx);
+
+    /* The UART completes a transfer once its last byte has left the shifter */
+    HAL_NVIC_SetPriority(GPDMA1_Channel0_IRQn, PC_TX_DMA_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(GPDMA1_Channel0_IRQn);
+    HAL_NVIC_SetPriority(USART1_IRQn, PC_TX_DMA_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(USART1_IRQn);
+    return true;
+}
+
+/**
+ * @brief Feed the link state to the rate control
+ * @return Time in microseconds, the rate control's clock
+ */
+static uint32_t pc_rate_sample(void)
+{
+    const uint32_t now_us = HAL_GetTick() * 1000U;
+    uart_tx_stats_t tx;
+    uart_tx_queue_get_stats(&pc_tx_queue, &tx);
+    stream_rate_update(&pc_rate, now_us, tx.bytes_sent, tx.bytes_pending);
+    return now_us;
+}
+
+/**
+ * @brief Microseconds since a perf_monitor_now() timestamp
+ */
+static uint32_t pc_rate_elapsed_us(uint32_t start)
+{
+    const uint32_t cycles_per_us = perf_monitor_cycles_per_us();
+    return (cycles_per_us > 0) ? (perf_monitor_now() - start) / cycles_per_us : 0;
+}
+
+/**
+ * @brief Start a message in the transmit queue
+ * @param writer Writer to start
+ * @param message_type Message type
+ * @param payload_size Payload size in bytes, message header excluded
+ * @param packet_class Frames are droppable, everything else is reliable
+ * @return true if the payload can be written, false if the message is refused
+ */
+static bool robust_begin_message(robust_writer_t *writer, robust_message_type_t message_type,
+                                 uint32_t payload_size, uart_tx_class_t packet_class)
 {
     if (!g_protocol_ctx.initialized) {
         return false;
     }
-    
-    if (payload_size > ROBUST_MAX_PAYLOAD_SIZE - ROBUST_MSG_HEADER_SIZE) {
+
+    // The heartbeat carries the version announcement: keep it readable by v1 decoders
+    uint8_t version = (message_type == ROBUST_MSG_HEARTBEAT) ? ROBUST_PROTOCOL_V1
+                                                             : g_protocol_ctx.protocol_version;
+    int ret = robust_writer_begin(writer, &pc_tx_queue, version, (uint8_t)message_type,
+                                  get_next_sequence_id(message_type), payload_size,
+                                  PC_STREAM_V2_CHUNK_SIZE, packet_class);
+    if (ret == -2) {
         g_protocol_ctx.stats.crc_errors++; // Reuse for send errors
+    }
+    return ret == 0;
+}
+
+/**
+ * @brief Queue a message whose payload is scattered over several buffers
+ *
+ * The DMA reads the payload after the caller's buffers are reused, so the
+ * segments are gathered into the queue in the same pass that feeds the CRC.
+ */
+static bool robust_send_segments(robust_message_type_t message_type,
+                                 const robust_segment_t *segments, uint32_t count)
+{
+    uint32_t payload_size = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        payload_size += segments[i].size;
+    }
+
+    const uint32_t start = perf_monitor_now();
+    robust_writer_t writer;
+    if (!robust_begin_message(&writer, message_type, payload_size, UART_TX_RELIABLE)) {
         return false;
     }
-    
-    // Calculate total payload size (message header + payload data, not including CRC32)
-    uint32_t total_payload_size = ROBUST_MSG_HEADER_SIZE + payload_size;
-    
-    // Validate payload size
-    if (total_payload_size > ROBUST_MAX_PAYLOAD_SIZE) {
-        g_protocol_ctx.stats.crc_errors++; // Reuse for send errors
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (robust_writer_write(&writer, segments[i].data, segments[i].size) != 0) {
+            return false;
+        }
+    }
+    if (robust_writer_end(&writer) != 0) {
         return false;
     }
+
+    // The images of the next frames leave room for these
+    stream_rate_record(&pc_rate, STREAM_RATE_RELIABLE, 0, payload_size, pc_rate_elapsed_us(start));
+    return true;
+}
+
+/**
+ * @brief Queue a message with a single payload buffer
+ */
+static bool robust_send_message(robust_message_type_t message_type,
+                               const uint8_t *payload, uint32_t payload_size)
+{
+    const robust_segment_t segment = { payload, payload_size };
+    return robust_send_segments(message_type, &segment, 1);
+}
+
+/**
+ * @brief Row y of a frame as sent, subsampled by scale_factor
+ *
+ * Native format frames keep their pixels; otherwise they are converted to
+ * grayscale for v1 decoders.
+ */
+static const uint8_t *robust_frame_row(const uint8_t *frame, uint32_t width, uint32_t bpp,
+                                       uint32_t scale_factor, uint32_t output_width,
+                                       bool native_format, uint32_t y)
+{
+    static uint8_t line_out[PC_STREAM_MAX_FRAME_WIDTH * 4];
+    const uint8_t *line = frame + (y * scale_factor) * width * bpp;
     
-    // Prepare message header
-    uint8_t msg_header[ROBUST_MSG_HEADER_SIZE];
-    msg_header[0] = (uint8_t)message_type;
-    uint16_t sequence_id = get_next_sequence_id(message_type);
-    msg_header[1] = (uint8_t)(sequence_id & 0xFF);
-    msg_header[2] = (uint8_t)((sequence_id >> 8) & 0xFF);
-    
-    // Calculate CRC32 only on payload data (header has its own checksum)
-    uint32_t payload_crc32 = 0;
-//    uint8_t test_data[4] = {0x01, 0x02, 0x03, 0x04};
-    if (payload_size > 0) {
-        payload_crc32 = calculate_crc32(payload, payload_size);
-    }
-    
-    // Prepare CRC32 bytes (little endian)
-    uint8_t crc32_bytes[ROBUST_CRC_SIZE];
-    crc32_bytes[0] = (uint8_t)(payload_crc32 & 0xFF);
-    crc32_bytes[1] = (uint8_t)((payload_crc32 >> 8) & 0xFF);
-    crc32_bytes[2] = (uint8_t)((payload_crc32 >> 16) & 0xFF);
-    crc32_bytes[3] = (uint8_t)((payload_crc32 >> 24) & 0xFF);
-    
-    // Prepare frame header
-    uint8_t frame_header[ROBUST_HEADER_SIZE];
-    frame_header[0] = ROBUST_SOF_BYTE;
-    frame_header[1] = (uint8_t)(total_payload_size & 0xFF);
-    frame_header[2] = (uint8_t)((total_payload_size >> 8) & 0xFF);
-    frame_header[3] = frame_header[0] ^ frame_header[1] ^ frame_header[2]; // XOR checksum
-    
-    HAL_StatusTypeDef status;
-    
-    // Send frame header
-    status = HAL_UART_Transmit(&hcom_uart[COM1], frame_header, 
-                              ROBUST_HEADER_SIZE, UART_TIMEOUT);
-    if (status != HAL_OK) {
-        g_protocol_ctx.stats.crc_errors++; // Reuse for send errors
-        return false;
+    if (native_format && scale_factor == 1) {
+        return line;
     }
+    for (uint32_t x = 0; x < output_width; x++) {
+        const uint8_t *px = line + x * scale_factor * bpp;
+        if (native_format) {
+            memcpy(&line_out[x * bpp], px, bpp);
+        } else if (bpp == 2) {
+            line_out[x] = rgb565_to_gray((uint16_t)(px[0] | (px[1] << 8)));
+        } else if (bpp == 3) {
+            line_out[x] = rgb888_to_gray(px[0], px[1], px[2]);
+        } else {
+            line_out[x] = px[0];
+        }
+    }
+    return line_out;
+}
+
+/**
+ * @brief Code a frame into pc_codec_buffer
+ * @return Coded size, 0 if the frame is not coded or would not shrink
+ */
+static uint32_t robust_code_frame(const uint8_t *frame, uint32_t width, uint32_t bpp,
+                                  uint32_t scale_factor, uint32_t output_width,
+                                  uint32_t output_height, bool native_format)
+{
+    const uint32_t sent_bpp = native_format ? bpp : 1;
+    const uint32_t raw_size = output_width * output_height * sent_bpp;
     
-    // Send message header
-    status = HAL_UART_Transmit(&hcom_uart[COM1], msg_header, 
-                              ROBUST_MSG_HEADER_SIZE, UART_TIMEOUT);
-    if (status != HAL_OK) {
-        g_protocol_ctx.stats.crc_errors++; // Reuse for send errors
-        return false;
+    if (!pc_codec_enabled || pc_codec_buffer == NULL ||
+        frame_codec_begin(&pc_codec, output_width, sent_bpp, pc_codec_buffer,
+                          PC_STREAM_CODEC_BUFFER_SIZE) != 0) {
+        return 0;
     }
     
-    // Send payload data if any
-    if (payload_size > 0) {
-        status = HAL_UART_Transmit(&hcom_uart[COM1], (uint8_t*)payload, 
-                                  payload_size, UART_TIMEOUT);
-        if (status != HAL_OK) {
-            g_protocol_ctx.stats.crc_errors++; // Reuse for send errors
-            return false;
+    const uint32_t start = perf_monitor_now();
+    for (uint32_t y = 0; y < output_height; y++) {
+        const uint8_t *row = robust_frame_row(frame, width, bpp, scale_factor, output_width,
+                                              native_format, y);
+        if (frame_codec_encode_row(&pc_codec, row) != 0) {
+            return 0;
         }
     }
+    const uint32_t size = frame_codec_end(&pc_codec);
+    const uint32_t cycles = perf_monitor_now() - start;
     
-    // Send CRC32
-    status = HAL_UART_Transmit(&hcom_uart[COM1], crc32_bytes, 
-                              ROBUST_CRC_SIZE, UART_TIMEOUT);
-    if (status != HAL_OK) {
-        g_protocol_ctx.stats.crc_errors++; // Reuse for send errors
+    perf_monitor_record(PERF_PROBE_FRAME_CODEC, cycles);
+    g_protocol_ctx.stats.codec_cycles_per_pixel = cycles / (output_width * output_height);
+    return (size < raw_size) ? size : 0;
+}
+
+/**
+ * @brief Queue a whole frame, subsampled by scale_factor, coded when it shrinks
+ * @param sent_size Payload size queued
+ */
+static bool robust_send_frame_full(const uint8_t *frame, uint32_t width, uint32_t bpp,
+                                   uint32_t scale_factor, uint32_t output_width,
+                                   uint32_t output_height, bool native_format, const char *tag,
+                                   uint32_t *sent_size)
+{
+    // The decoder tells the pixel format from the payload size
+    uint32_t row_size = output_width * (native_format ? bpp : 1);
+    uint32_t coded_size = robust_code_frame(frame, width, bpp, scale_factor, output_width,
+                                            output_height, native_format);
+    uint32_t total_size = sizeof(robust_frame_data_t) +
+                          ((coded_size > 0) ? coded_size : row_size * output_height);
+    *sent_size = total_size;
+    
+    // Frames are dropped rather than held back when the link is behind
+    robust_writer_t writer;
+    if (!robust_begin_message(&writer, ROBUST_MSG_FRAME_DATA, total_size, UART_TX_DROPPABLE)) {
         return false;
     }
     
-    // Update statistics
-    g_protocol_ctx.stats.packets_sent++;
-    g_protocol_ctx.stats.bytes_sent += ROBUST_HEADER_SIZE + total_payload_size + ROBUST_CRC_SIZE;
+    // Prepare frame data header
+    robust_frame_data_t frame_data = {
+        .flags = (coded_size > 0) ? ROBUST_FRAME_FLAG_CODED : 0,
+        .width = output_width,
+        .height = output_height
+    };
+    
+    // Copy frame type (preserve original tag for different frame types)
+    strncpy(frame_data.frame_type, tag, sizeof(frame_data.frame_type));
+    int ret = robust_writer_write(&writer, &frame_data, sizeof(robust_frame_data_t));
+    
+    if (coded_size > 0) {
+        ret = (ret == 0) ? robust_writer_write(&writer, pc_codec_buffer, coded_size) : ret;
+        return (ret == 0) && (robust_writer_end(&writer) == 0);
+    }
+    
+    // Subsample each row into a line buffer; the writer copies it into the queue
+    for (uint32_t y = 0; y < output_height && ret == 0; y++) {
+        ret = robust_writer_write(&writer, robust_frame_row(frame, width, bpp, scale_factor,
+                                                            output_width, native_format, y),
+                                  row_size);
+    }
     
-    return true;
+    return (ret == 0) && (robust_writer_end(&writer) == 0);
+}
+
+/**
+ * @brief Queue the tiles of a frame that changed since the host's copy
+ * @param sent_size Payload size queued
+ * @return 1 if sent, 0 if dropped, -1 if the frame cannot be delta coded
+ */
+static int robust_send_frame_delta(const tile_delta_frame_t *frame, const char *tag,
+                                   uint32_t *sent_size)
+{
+    if (tile_delta_plan(&pc_delta, frame) < 0) {
+        return -1;
+    }
+
+    *sent_size = tile_delta_payload_size(&pc_delta);
+    robust_writer_t writer;
+    if (!robust_begin_message(&writer, ROBUST_MSG_FRAME_DELTA, *sent_size, UART_TX_DROPPABLE)) {
+        return 0;
+    }
+
+    tile_delta_header_t header;
+    tile_delta_get_header(&pc_delta, tag, &header);
+    int ret = robust_writer_write(&writer, &header, sizeof(header));
+
+    static uint8_t tile_pixels[TILE_DELTA_TILE_BYTES];
+    for (uint32_t i = 0; i < pc_delta.changed_count && ret == 0; i++) {
+        const uint16_t tile = pc_delta.changed[i];
+        const uint32_t size = tile_delta_copy_tile(&pc_delta, frame, tile, tile_pixels);
+        ret = robust_writer_write(&writer, &tile, sizeof(tile));
+        if (ret == 0) {
+            ret = robust_writer_write(&writer, tile_pixels, size);
+        }
+    }
+    if (ret != 0 || robust_writer_end(&writer) != 0) {
+        return 0;
+    }
+
+    // Only now does the host hold the new tiles
+    tile_delta_commit(&pc_delta, frame);
+    return 1;
 }
 
 /* ========================================================================= */
@@ -306,14 +502,58 @@ void Enhanced_PC_STREAM_Init(void)
         return;
     }
     
+    /* Queued packets outlive the frame that produced them: not scratch memory */
+    uint8_t *tx_arena = memory_pool_alloc_region(memory_pool_get_default(), MEMORY_REGION_PSRAM,
+                                                 PC_STREAM_TX_ARENA_SIZE, CACHE_LINE_ALIGNMENT,
+                                                 MEMORY_BUFFER_TYPE_PROTOCOL, "pc_tx_arena");
+    if (tx_arena == NULL) {
+        printf("Failed to allocate PC stream transmit arena\n");
+        return;
+    }
+    
+#if (PC_STREAM_TILE_DELTA > 0)
+    uint8_t *delta_ref = memory_pool_alloc_region(memory_pool_get_default(), MEMORY_REGION_PSRAM,
+                                                  PC_STREAM_DELTA_REF_SIZE, CACHE_LINE_ALIGNMENT,
+                                                  MEMORY_BUFFER_TYPE_PROTOCOL, "pc_delta_ref");
+    pc_delta_ready = (tile_delta_init(&pc_delta, NULL, delta_ref, PC_STREAM_DELTA_REF_SIZE) == 0);
+    if (!pc_delta_ready) {
+        printf("PC stream tile delta disabled: no reference buffer\n");
+    }
+#endif
+    
+#if (PC_STREAM_FRAME_CODEC > 0)
+    frame_codec_init(&pc_codec, NULL);
+    pc_codec_buffer = memory_pool_alloc_region(memory_pool_get_default(), MEMORY_REGION_PSRAM,
+                                               PC_STREAM_CODEC_BUFFER_SIZE, CACHE_LINE_ALIGNMENT,
+                                               MEMORY_BUFFER_TYPE_PROTOCOL, "pc_codec_buf");
+    if (pc_codec_buffer == NULL) {
+        printf("PC stream frame coding disabled: no buffer\n");
+    }
+#endif
+    
+    stream_rate_config_t rate_config;
+    stream_rate_default_config(&rate_config);
+    rate_config.link_bytes_per_s = PcUartInit.BaudRate / 10U;  // 8N1: 10 bits a byte
+    rate_config.max_fraction = PC_STREAM_MAX_STREAM_FRACTION;
+    rate_config.min_scale = STREAM_SCALE;
+    stream_rate_init(&pc_rate, &rate_config);
+    
     BSP_COM_Init(COM1, &PcUartInit);
     
+    const uart_tx_port_t port = { pc_tx_start, NULL, &hcom_uart[COM1] };
+    if (!pc_tx_dma_init(&hcom_uart[COM1]) ||
+        uart_tx_queue_init(&pc_tx_queue, &port, tx_arena, PC_STREAM_TX_ARENA_SIZE,
+                           PC_STREAM_TX_RESERVE_SIZE, PC_STREAM_TX_WAIT_US) != 0) {
+        printf("Failed to initialize PC stream transmit DMA\n");
+        return;
+    }
+    
 #if (USE_COM_LOG > 0)
     BSP_COM_SelectLogPort(COM1);
 #endif
     
     // Initialize CRC32 peripheral
-    if (!crc32_init()) {
+    if (crc32_stream_init() != 0) {
         printf("Failed to initialize CRC32 peripheral\n");
         return;
     }
@@ -321,6 +561,9 @@ void Enhanced_PC_STREAM_Init(void)
     // Clear statistics
     memset(&g_protocol_ctx.stats, 0, sizeof(g_protocol_ctx.stats));
     memset(g_protocol_ctx.sequence_counters, 0, sizeof(g_protocol_ctx.sequence_counters));
+    if (g_protocol_ctx.protocol_version == 0) {
+        g_protocol_ctx.protocol_version = PC_STREAM_PROTOCOL_VERSION;
+    }
     
     g_protocol_ctx.initialized = true;
     
@@ -331,70 +574,79 @@ void Enhanced_PC_STREAM_Init(void)
 }
 
 /**
- * @brief Send frame with enhanced protocol as raw grayscale data
+ * @brief Send frame with enhanced protocol
+ *
+ * v2 streams the frame in its own pixel format, one chunk at a time; v1 is
+ * limited to 64 KB packets, so frames go out as grayscale clamped to 320x240.
  */
 bool Enhanced_PC_STREAM_SendFrame(const uint8_t *frame, uint32_t width, uint32_t height,
                                  uint32_t bpp, const char *tag,
                                  const pd_postprocess_out_t *detections,
                                  const performance_metrics_t *performance)
 {
-    if (!frame || !tag) {
+    if (!frame || !tag || bpp == 0 || bpp > 4 || !g_protocol_ctx.initialized) {
         return false;
     }
     
     // Determine scaling based on frame type (ALN frames are full resolution)
     bool full_resolution = (strcmp(tag, "ALN") == 0);
-    uint32_t scale_factor = full_resolution ? 1 : STREAM_SCALE;
+    bool native_format = (g_protocol_ctx.protocol_version >= ROBUST_PROTOCOL_V2);
+    uint32_t sent_bpp = native_format ? bpp : 1;
+    
+    // Decimate or skip the image to fit the link and the frame time
+    stream_rate_class_t rate_class = full_resolution ? STREAM_RATE_CROP : STREAM_RATE_FRAME;
+    stream_rate_decision_t decision = { true, full_resolution ? 1U : STREAM_SCALE };
+    if (pc_rate_enabled) {
+        decision = stream_rate_decide(&pc_rate, rate_class, pc_rate_sample(),
+                                      width * height * sent_bpp);
+    }
+    uint32_t scale_factor = decision.scale;
     
     uint32_t output_width = width / scale_factor;
     uint32_t output_height = height / scale_factor;
     
-    if (output_width > 320) output_width = 320;   // Max width limit
-    if (output_height > 240) output_height = 240; // Max height limit
-    
-    // Convert to grayscale and send raw data
-    for (uint32_t y = 0; y < output_height; y++) {
-        const uint8_t *line = frame + (y * scale_factor) * width * bpp;
-        for (uint32_t x = 0; x < output_width; x++) {
-            if (bpp == 2) {
-                const uint16_t *line16 = (const uint16_t *)line;
-                uint16_t px = line16[x * scale_factor];
-                stream_buffer[y * output_width + x] = rgb565_to_gray(px);
-            } else if (bpp == 3) {
-                const uint8_t *px = line + x * scale_factor * 3;
-                stream_buffer[y * output_width + x] = rgb888_to_gray(px[0], px[1], px[2]);
-            } else {
-                stream_buffer[y * output_width + x] = line[x * scale_factor];
-            }
-        }
+    if (!native_format) {
+        if (output_width > 320) output_width = 320;   // Max width limit
+        if (output_height > 240) output_height = 240; // Max height limit
     }
-    
-    // Prepare frame data header
-    robust_frame_data_t frame_data = {
-        .width = output_width,
-        .height = output_height
-    };
-    
-    // Copy frame type (preserve original tag for different frame types)
-    strncpy(frame_data.frame_type, tag, 3);
-    frame_data.frame_type[3] = '\0';
-    
-    // Calculate total payload size using raw grayscale data
-    uint32_t raw_data_size = output_width * output_height; // 1 byte per pixel
-    uint32_t total_size = sizeof(robust_frame_data_t) + raw_data_size;
-    
-    if (total_size > ROBUST_MAX_PAYLOAD_SIZE - ROBUST_MSG_HEADER_SIZE) {
-        g_protocol_ctx.stats.crc_errors++; // Reuse for send errors
-        return false;
+    if (output_width > PC_STREAM_MAX_FRAME_WIDTH) {
+        output_width = PC_STREAM_MAX_FRAME_WIDTH;
     }
     
-    // Build payload directly in temp_buffer with raw grayscale data
-    memcpy(temp_buffer, &frame_data, sizeof(robust_frame_data_t));
-    memcpy(temp_buffer + sizeof(robust_frame_data_t), stream_buffer, raw_data_size);
-    
-    bool frame_sent = robust_send_message(ROBUST_MSG_FRAME_DATA, temp_buffer, total_size);
+    bool frame_sent = false;
+    if (decision.send) {
+        const uint32_t start = perf_monitor_now();
+        uint32_t sent_size = 0;
+        
+        // Decimated frames of a mostly static scene: send the tiles that changed
+        int delta_sent = -1;
+        if (native_format && !full_resolution && pc_delta_ready) {
+            const tile_delta_frame_t delta_frame = {
+                .pixels = frame,
+                .width = output_width,
+                .height = output_height,
+                .bpp = bpp,
+                .stride = width * bpp * scale_factor,
+                .step = scale_factor,
+            };
+            delta_sent = robust_send_frame_delta(&delta_frame, tag, &sent_size);
+        }
+        
+        frame_sent = (delta_sent > 0);
+        if (delta_sent < 0) {
+            frame_sent = robust_send_frame_full(frame, width, bpp, scale_factor, output_width,
+                                                output_height, native_format, tag, &sent_size);
+        }
+        
+        if (!frame_sent) {
+            stream_rate_record_drop(&pc_rate, rate_class);
+        } else {
+            stream_rate_record(&pc_rate, rate_class, output_width * output_height * sent_bpp,
+                               sent_size, pc_rate_elapsed_us(start));
+        }
+    }
     
-    // Send performance metrics if available
+    // Send performance metrics if available, whether or not the image went out
     if (performance) {
         Enhanced_PC_STREAM_SendPerformanceMetrics(performance);
     }
@@ -412,32 +664,20 @@ bool Enhanced_PC_STREAM_SendFrame(const uint8_t *frame, uint32_t width, uint32_t
  */
 bool Enhanced_PC_STREAM_SendEmbedding(const float *embedding, uint32_t size)
 {
-    if (!embedding || size == 0 || size > 1024) {
+    if (!embedding || size == 0 || size > 1024 || !g_protocol_ctx.initialized) {
         return false;
     }
     
-    uint8_t *buffer = temp_buffer;
-    uint32_t offset = 0;
-    
     // Prepare embedding data header
     robust_embedding_data_t emb_data = {
         .embedding_size = size
     };
     
-    memcpy(buffer + offset, &emb_data, sizeof(robust_embedding_data_t));
-    offset += sizeof(robust_embedding_data_t);
-    
-    // Add embedding data
-    uint32_t embedding_bytes = size * sizeof(float);
-    if (offset + embedding_bytes > sizeof(temp_buffer)) {
-        g_protocol_ctx.stats.crc_errors++; // Reuse for send errors
-        return false;
-    }
-    
-    memcpy(buffer + offset, embedding, embedding_bytes);
-    offset += embedding_bytes;
-    
-    return robust_send_message(ROBUST_MSG_EMBEDDING_DATA, buffer, offset);
+    const robust_segment_t segments[] = {
+        { &emb_data, sizeof(robust_embedding_data_t) },
+        { embedding, size * sizeof(float) },
+    };
+    return robust_send_segments(ROBUST_MSG_EMBEDDING_DATA, segments, 2);
 }
 
 /**
@@ -445,13 +685,10 @@ bool Enhanced_PC_STREAM_SendEmbedding(const float *embedding, uint32_t size)
  */
 bool Enhanced_PC_STREAM_SendDetections(uint32_t frame_id, const pd_postprocess_out_t *detections)
 {
-    if (!detections || detections->box_nb == 0) {
+    if (!detections || detections->box_nb == 0 || !g_protocol_ctx.initialized) {
         return false;
     }
     
-    uint8_t *buffer = temp_buffer;
-    uint32_t offset = 0;
-    
     // Prepare detection data header
     struct __attribute__((packed)) {
         uint32_t frame_id;
@@ -461,20 +698,21 @@ bool Enhanced_PC_STREAM_SendDetections(uint32_t frame_id, const pd_postprocess_o
         .detection_count = detections->box_nb
     };
     
-    memcpy(buffer + offset, &det_header, sizeof(det_header));
-    offset += sizeof(det_header);
+    typedef struct __attribute__((packed)) {
+        uint32_t class_id;
+        float x, y, w, h;
+        float confidence;
+        uint32_t keypoint_count;
+    } det_t;
     
     // Add detection data (limit to reasonable number)
-    uint32_t max_detections = 10;  // Reasonable limit for streaming
-    for (uint32_t i = 0; i < detections->box_nb && i < max_detections; i++) {
+    uint32_t det_count = (detections->box_nb < ROBUST_MAX_DETECTIONS) ? detections->box_nb : ROBUST_MAX_DETECTIONS;
+    det_t dets[ROBUST_MAX_DETECTIONS];
+    
+    for (uint32_t i = 0; i < det_count; i++) {
         const pd_pp_box_t *box = &detections->pOutData[i];
         
-        struct __attribute__((packed)) {
-            uint32_t class_id;
-            float x, y, w, h;
-            float confidence;
-            uint32_t keypoint_count;
-        } det = {
+        dets[i] = (det_t) {
             .class_id = 0,  // Default class (person detection)
             .x = box->x_center,
             .y = box->y_center,
@@ -483,16 +721,13 @@ bool Enhanced_PC_STREAM_SendDetections(uint32_t frame_id, const pd_postprocess_o
             .confidence = box->prob,
             .keypoint_count = 0  // No keypoints for now
         };
-        
-        if (offset + sizeof(det) > sizeof(temp_buffer)) {
-            break;  // Buffer full
-        }
-        
-        memcpy(buffer + offset, &det, sizeof(det));
-        offset += sizeof(det);
     }
     
-    return robust_send_message(ROBUST_MSG_DETECTION_RESULTS, buffer, offset);
+    const robust_segment_t segments[] = {
+        { &det_header, sizeof(det_header) },
+        { dets, det_count * sizeof(det_t) },
+    };
+    return robust_send_segments(ROBUST_MSG_DETECTION_RESULTS, segments, 2);
 }
 
 /**
@@ -509,14 +744,99 @@ bool Enhanced_PC_STREAM_SendPerformanceMetrics(const performance_metrics_t *metr
                               sizeof(performance_metrics_t));
 }
 
+/**
+ * @brief Send a serialized timing summary
+ */
+bool Enhanced_PC_STREAM_SendPerfSummary(const uint8_t *summary, uint32_t size)
+{
+    if (!summary || size == 0) {
+        return false;
+    }
+
+    return robust_send_message(ROBUST_MSG_PERF_SUMMARY, summary, size);
+}
+
+/**
+ * @brief Send a serialized per-epoch-block timing table
+ */
+bool Enhanced_PC_STREAM_SendEpochProfile(const uint8_t *profile, uint32_t size)
+{
+    if (!profile || size == 0) {
+        return false;
+    }
+
+    return robust_send_message(ROBUST_MSG_EPOCH_PROFILE, profile, size);
+}
+
+/**
+ * @brief Send a serialized per-pool stream engine stall report
+ */
+bool Enhanced_PC_STREAM_SendStallReport(const uint8_t *report, uint32_t size)
+{
+    if (!report || size == 0) {
+        return false;
+    }
+
+    return robust_send_message(ROBUST_MSG_STALL_REPORT, report, size);
+}
+
 /**
  * @brief Send periodic heartbeat packet
  */
 void Enhanced_PC_STREAM_SendHeartbeat(void)
 {
-    uint32_t timestamp = HAL_GetTick();
-    robust_send_message(ROBUST_MSG_HEARTBEAT, (const uint8_t*)&timestamp, sizeof(timestamp));
-    g_protocol_ctx.last_heartbeat_time = timestamp;
+    // The PC learns which framing to expect from the heartbeat
+    robust_heartbeat_t heartbeat = {
+        .timestamp = HAL_GetTick(),
+        .protocol_version = g_protocol_ctx.protocol_version,
+        .chunk_size = PC_STREAM_V2_CHUNK_SIZE
+    };
+    robust_send_message(ROBUST_MSG_HEARTBEAT, (const uint8_t*)&heartbeat, sizeof(heartbeat));
+    g_protocol_ctx.last_heartbeat_time = heartbeat.timestamp;
+}
+
+/**
+ * @brief Select the framing of the PC stream
+ */
+int Enhanced_PC_STREAM_SetProtocolVersion(uint8_t version)
+{
+    if (version != ROBUST_PROTOCOL_V1 && version != ROBUST_PROTOCOL_V2) {
+        return -1;
+    }
+    g_protocol_ctx.protocol_version = version;
+    if (pc_delta_ready) {
+        tile_delta_request_keyframe(&pc_delta);
+    }
+    
+    // Announce the change before any message uses the new framing
+    if (g_protocol_ctx.initialized) {
+        Enhanced_PC_STREAM_SendHeartbeat();
+    }
+    return 0;
+}
+
+/**
+ * @brief Get the framing of the PC stream
+ */
+uint8_t Enhanced_PC_STREAM_GetProtocolVersion(void)
+{
+    return g_protocol_ctx.protocol_version;
+}
+
+/**
+ * @brief Turn the coding of whole frames on or off
+ */
+void Enhanced_PC_STREAM_SetFrameCoding(bool enable)
+{
+    pc_codec_enabled = enable;
+}
+
+/**
+ * @brief Turn the rate control of frames and crops on or off
+ */
+void Enhanced_PC_STREAM_SetRateControl(bool enable)
+{
+    pc_rate_enabled = enable;
 }
 
 /**
@@ -526,6 +846,99 @@ void Enhanced_PC_STREAM_GetStats(protocol_stats_t *stats)
 {
     if (stats) {
         memcpy(stats, &g_protocol_ctx.stats, sizeof(protocol_stats_t));
+        
+        uart_tx_stats_t tx;
+        uart_tx_queue_get_stats(&pc_tx_queue, &tx);
+        stats->packets_sent = tx.packets_sent;
+        stats->bytes_sent = tx.bytes_sent;
+        stats->tx_queue_depth = tx.depth;
+        stats->tx_queue_max_depth = tx.max_depth;
+        stats->tx_frames_dropped = tx.packets_dropped;
+        stats->tx_waits = tx.reliable_waits;
+        stats->tx_errors = tx.errors + tx.reliable_failures;
+        
+        tile_delta_stats_t delta;
+        tile_delta_get_stats(&pc_delta, &delta);
+        stats->delta_keyframes = delta.keyframes;
+        stats->delta_tiles_sent = delta.tiles_sent;
+        stats->delta_tiles_total = delta.tiles_total;
+        
+        frame_codec_stats_t codec;
+        frame_codec_get_stats(&pc_codec, &codec);
+        stats->codec_frames = codec.frames;
+        stats->codec_bytes_in = (uint32_t)codec.bytes_in;
+        stats->codec_bytes_out = (uint32_t)codec.bytes_out;
+        
+        stats->rate_frames_skipped = pc_rate.classes[STREAM_RATE_FRAME].skipped;
+        stats->rate_crops_skipped = pc_rate.classes[STREAM_RATE_CROP].skipped;
+        stats->rate_scale = pc_rate.scale;
+        stats->rate_link_bytes_per_s = pc_rate.link_bytes_per_s;
+        stats->rate_stream_fraction = pc_rate.last_fraction;
+    }
+}
+
+/**
+ * @brief Receive a raw image pushed by the PC (blocking)
+ */
+int Enhanced_PC_STREAM_ReceiveImage(uint8_t *dest, uint32_t size)
+{
+    if (!g_protocol_ctx.initialized || dest == NULL) {
+        return -1;
+    }
+
+    /* HAL_UART_Receive takes a 16-bit length, so large frames are chunked */
+    uint32_t received = 0;
+    while (received < size) {
+        uint32_t chunk = size - received;
+        if (chunk > 0xFFFFU) {
+            chunk = 0xFFFFU;
+        }
+        if (HAL_UART_Receive(&hcom_uart[COM1], dest + received, (uint16_t)chunk,
+                             HAL_MAX_DELAY) != HAL_OK) {
+            g_protocol_ctx.stats.timeouts++;
+            return -1;
+        }
+        received += chunk;
+    }
+
+    g_protocol_ctx.stats.packets_received++;
+    g_protocol_ctx.stats.bytes_received += size;
+    return 0;
+}
+
+/**
+ * @brief Transmit DMA channel interrupt
+ */
+void Enhanced_PC_STREAM_TxDmaIRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&hdma_pc_tx);
+}
+
+/**
+ * @brief PC UART interrupt
+ */
+void Enhanced_PC_STREAM_UartIRQHandler(void)
+{
+    HAL_UART_IRQHandler(&hcom_uart[COM1]);
+}
+
+/**
+ * @brief UART transfer complete: move the transmit queue on
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    if (huart == &hcom_uart[COM1]) {
+        uart_tx_queue_on_complete(&pc_tx_queue);
+    }
+}
+
+/**
+ * @brief UART error: abandon the packet on the wire
+ */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    if (huart == &hcom_uart[COM1] && huart->gState == HAL_UART_STATE_READY) {
+        uart_tx_queue_on_error(&pc_tx_queue);
     }
 }
 
@@ -0,0 +1,219 @@
+/**
+ ******************************************************************************
+ * @file    epoch_profiler.c
+ * @author  PeleAB
+ * @brief   Per-epoch-block NPU/SW timing for the neural networks
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "epoch_profiler.h"
+#include "perf_monitor.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* PRIVATE DATA                                                              */
+/* ========================================================================= */
+
+static epoch_profile_network_t s_networks[EPOCH_PROFILER_NET_COUNT];
+
+/* Network whose block is running, EPOCH_PROFILER_NET_COUNT when idle */
+static volatile epoch_profiler_net_t s_running = EPOCH_PROFILER_NET_COUNT;
+
+#ifndef APP_HOST_BUILD
+/* Instance registered for each network, to map callbacks back to a table */
+static const NN_Instance_TypeDef *s_instances[EPOCH_PROFILER_NET_COUNT];
+#endif
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static void epoch_put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+}
+
+static void epoch_put_u32(uint8_t *p, uint32_t v)
+{
+    epoch_put_u16(p, (uint16_t)(v & 0xFFFF));
+    epoch_put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+void epoch_profiler_reset(void)
+{
+    memset(s_networks, 0, sizeof(s_networks));
+    s_running = EPOCH_PROFILER_NET_COUNT;
+}
+
+void epoch_profiler_begin_inference(epoch_profiler_net_t net)
+{
+    if ((unsigned)net < EPOCH_PROFILER_NET_COUNT) {
+        s_networks[net].current = 0;
+    }
+}
+
+void epoch_profiler_end_inference(epoch_profiler_net_t net)
+{
+    if ((unsigned)net < EPOCH_PROFILER_NET_COUNT) {
+        s_networks[net].inferences++;
+    }
+}
+
+void epoch_profiler_begin_block(epoch_profiler_net_t net, int16_t epoch_first,
+                                int16_t epoch_last, uint16_t flags)
+{
+    if ((unsigned)net >= EPOCH_PROFILER_NET_COUNT) {
+        return;
+    }
+
+    epoch_profile_network_t *table = &s_networks[net];
+    if (table->current >= EPOCH_PROFILER_MAX_BLOCKS) {
+        table->overflows++;
+        return;
+    }
+
+    epoch_profile_block_t *block = &table->blocks[table->current];
+    block->epoch_first = epoch_first;
+    block->epoch_last = epoch_last;
+    block->flags = flags;
+    block->start = perf_monitor_now();
+    s_running = net;
+}
+
+void epoch_profiler_end_block(epoch_profiler_net_t net)
+{
+    if ((unsigned)net >= EPOCH_PROFILER_NET_COUNT) {
+        return;
+    }
+
+    epoch_profile_network_t *table = &s_networks[net];
+    s_running = EPOCH_PROFILER_NET_COUNT;
+    if (table->current >= EPOCH_PROFILER_MAX_BLOCKS) {
+        return;
+    }
+
+    epoch_profile_block_t *block = &table->blocks[table->current];
+    block->last_cycles = perf_monitor_now() - block->start;
+    block->total_cycles += block->last_cycles;
+
+    table->current++;
+    if (table->current > table->block_count) {
+        table->block_count = table->current;
+    }
+}
+
+const epoch_profile_network_t *epoch_profiler_get(epoch_profiler_net_t net)
+{
+    return ((unsigned)net < EPOCH_PROFILER_NET_COUNT) ? &s_networks[net] : NULL;
+}
+
+bool epoch_profiler_get_running(epoch_profiler_net_t *net, uint16_t *block)
+{
+    const epoch_profiler_net_t running = s_running;
+    if (running >= EPOCH_PROFILER_NET_COUNT || net == NULL || block == NULL) {
+        return false;
+    }
+
+    *net = running;
+    *block = s_networks[running].current;
+    return true;
+}
+
+uint32_t epoch_profiler_serialize(epoch_profiler_net_t net, uint8_t *buffer, uint32_t size)
+{
+    const epoch_profile_network_t *table = epoch_profiler_get(net);
+    if (table == NULL || buffer == NULL) {
+        return 0;
+    }
+
+    const uint32_t total = EPOCH_PROFILER_WIRE_HEADER_SIZE +
+                           (uint32_t)table->block_count * EPOCH_PROFILER_WIRE_BLOCK_SIZE;
+    if (size < total) {
+        return 0;
+    }
+
+    buffer[0] = EPOCH_PROFILER_WIRE_VERSION;
+    buffer[1] = (uint8_t)net;
+    epoch_put_u16(buffer + 2, table->block_count);
+    epoch_put_u32(buffer + 4, table->inferences);
+    epoch_put_u32(buffer + 8, perf_monitor_cycles_per_us());
+
+    uint8_t *p = buffer + EPOCH_PROFILER_WIRE_HEADER_SIZE;
+    for (uint32_t i = 0; i < table->block_count; i++) {
+        const epoch_profile_block_t *block = &table->blocks[i];
+        const uint64_t avg = (table->inferences > 0) ? block->total_cycles / table->inferences :
+                                                       block->total_cycles;
+        epoch_put_u16(p, (uint16_t)block->epoch_first);
+        epoch_put_u16(p + 2, (uint16_t)block->epoch_last);
+        epoch_put_u16(p + 4, block->flags);
+        epoch_put_u32(p + 6, (avg > UINT32_MAX) ? UINT32_MAX : (uint32_t)avg);
+        p += EPOCH_PROFILER_WIRE_BLOCK_SIZE;
+    }
+    return total;
+}
+
+#ifndef APP_HOST_BUILD
+/* ========================================================================= */
+/* LL_ATON RUNTIME HOOK                                                      */
+/* ========================================================================= */
+
+static void epoch_profiler_callback(LL_ATON_RT_Callbacktype_t ctype,
+                                    const NN_Instance_TypeDef *nn_instance,
+                                    const EpochBlock_ItemTypeDef *epoch_block)
+{
+    epoch_profiler_net_t net = EPOCH_PROFILER_NET_COUNT;
+    for (int i = 0; i < EPOCH_PROFILER_NET_COUNT; i++) {
+        if (s_instances[i] == nn_instance) {
+            net = (epoch_profiler_net_t)i;
+        }
+    }
+
+    switch (ctype) {
+    case LL_ATON_RT_Callbacktype_NN_Init:
+        epoch_profiler_begin_inference(net);
+        break;
+    case LL_ATON_RT_Callbacktype_NN_DeInit:
+        epoch_profiler_end_inference(net);
+        break;
+    case LL_ATON_RT_Callbacktype_PRE_START:
+#ifdef LL_ATON_EB_DBG_INFO
+        epoch_profiler_begin_block(net, epoch_block->epoch_num, epoch_block->last_epoch_num,
+                                   epoch_block->flags);
+#else
+        epoch_profiler_begin_block(net, -1, -1, epoch_block->flags);
+#endif
+        break;
+    case LL_ATON_RT_Callbacktype_POST_END:
+        epoch_profiler_end_block(net);
+        break;
+    default:
+        break;
+    }
+}
+
+void epoch_profiler_attach(epoch_profiler_net_t net, NN_Instance_TypeDef *instance)
+{
+    if ((unsigned)net >= EPOCH_PROFILER_NET_COUNT || instance == NULL) {
+        return;
+    }
+
+    s_instances[net] = instance;
+    LL_ATON_RT_SetEpochCallback(epoch_profiler_callback, instance);
+}
+#endif /* APP_HOST_BUILD */
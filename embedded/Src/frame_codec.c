@@ -0,0 +1,373 @@
+/**
+ ******************************************************************************
+ * @file    frame_codec.c
+ * @author  PeleAB
+ * @brief   Left predictor and Rice coding of streamed frame rows
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "frame_codec.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* PRIVATE TYPES                                                             */
+/* ========================================================================= */
+
+/* Most significant bit first; writes past end are counted, not stored */
+typedef struct {
+    uint8_t *p;
+    uint8_t *end;
+    uint32_t acc;
+    uint32_t bits;
+} frame_codec_bit_writer_t;
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint32_t acc;
+    uint32_t bits;
+} frame_codec_bit_reader_t;
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static inline uint32_t frame_codec_channels(uint32_t bpp)
+{
+    return (bpp == 2) ? 3 : bpp;
+}
+
+/* Bits of each sample of a pixel before drop_bits */
+static inline uint32_t frame_codec_channel_bits(uint32_t bpp, uint32_t channel)
+{
+    if (bpp == 2) {
+        return (channel == 1) ? 6 : 5;
+    }
+    return 8;
+}
+
+static inline void frame_codec_put_bits(frame_codec_bit_writer_t *w, uint32_t value, uint32_t count)
+{
+    w->acc = (w->acc << count) | value;
+    w->bits += count;
+    while (w->bits >= 8) {
+        w->bits -= 8;
+        if (w->p < w->end) {
+            *w->p = (uint8_t)(w->acc >> w->bits);
+        }
+        w->p++;
+    }
+}
+
+static inline void frame_codec_flush_bits(frame_codec_bit_writer_t *w)
+{
+    if (w->bits > 0) {
+        frame_codec_put_bits(w, 0, 8 - w->bits);
+    }
+}
+
+/* Zeros before the next 1, which is consumed; -1 past the end */
+static inline int32_t frame_codec_get_unary(frame_codec_bit_reader_t *r)
+{
+    int32_t q = 0;
+
+    for (;;) {
+        const uint32_t window = r->acc & ((1U << r->bits) - 1U);
+        if (window != 0) {
+            const uint32_t top = 32U - (uint32_t)__builtin_clz(window);
+            q += (int32_t)(r->bits - top);
+            r->bits = top - 1U;
+            return q;
+        }
+        q += (int32_t)r->bits;
+        if (r->p >= r->end) {
+            return -1;
+        }
+        r->acc = *r->p++;
+        r->bits = 8;
+    }
+}
+
+static inline int32_t frame_codec_get_bits(frame_codec_bit_reader_t *r, uint32_t count)
+{
+    while (r->bits < count) {
+        if (r->p >= r->end) {
+            return -1;
+        }
+        r->acc = (r->acc << 8) | *r->p++;
+        r->bits += 8;
+    }
+    r->bits -= count;
+    return (int32_t)((r->acc >> r->bits) & ((1U << count) - 1U));
+}
+
+/* Channel values of a row into zigzag mapped left residuals; returns their sum */
+static uint32_t frame_codec_residuals(frame_codec_t *codec, const uint8_t *row)
+{
+    const uint32_t drop = codec->config.drop_bits;
+    uint8_t *z = codec->residuals;
+    uint32_t sum = 0;
+
+    if (codec->bpp == 2) {
+        uint32_t left[3] = { 0, 0, 0 };
+        const uint32_t bits[3] = { 5 - drop, 6 - drop, 5 - drop };
+        for (uint32_t x = 0; x < codec->width; x++) {
+            const uint32_t px = (uint32_t)row[2 * x] | ((uint32_t)row[2 * x + 1] << 8);
+            const uint32_t value[3] = { px >> 11, (px >> 5) & 0x3F, px & 0x1F };
+            for (uint32_t c = 0; c < 3; c++) {
+                const uint32_t v = value[c] >> drop;
+                const uint32_t mask = (1U << bits[c]) - 1U;
+                const uint32_t d = (v - left[c]) & mask;
+                left[c] = v;
+                *z = (uint8_t)((d <= (mask >> 1)) ? 2U * d : 2U * (mask + 1U - d) - 1U);
+                sum += *z++;
+            }
+        }
+        return sum;
+    }
+
+    const uint32_t bpp = codec->bpp;
+    const uint32_t mask = 0xFFU >> drop;
+    uint32_t left[FRAME_CODEC_MAX_CHANNELS] = { 0, 0, 0 };
+    for (uint32_t i = 0, c = 0; i < codec->width * bpp; i++) {
+        const uint32_t v = (uint32_t)row[i] >> drop;
+        const uint32_t d = (v - left[c]) & mask;
+        left[c] = v;
+        *z = (uint8_t)((d <= (mask >> 1)) ? 2U * d : 2U * (mask + 1U - d) - 1U);
+        sum += *z++;
+        c = (c + 1 == bpp) ? 0 : c + 1;
+    }
+    return sum;
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+void frame_codec_default_config(frame_codec_config_t *config)
+{
+    config->drop_bits = 0;
+}
+
+int frame_codec_init(frame_codec_t *codec, const frame_codec_config_t *config)
+{
+    if (codec == NULL || (config != NULL && config->drop_bits > FRAME_CODEC_MAX_DROP_BITS)) {
+        return -1;
+    }
+
+    memset(codec, 0, sizeof(*codec));
+    if (config != NULL) {
+        codec->config = *config;
+    } else {
+        frame_codec_default_config(&codec->config);
+    }
+    return 0;
+}
+
+uint32_t frame_codec_bound(uint32_t width, uint32_t height, uint32_t bpp)
+{
+    return (uint32_t)sizeof(frame_codec_header_t) + height * (1U + width * bpp);
+}
+
+int frame_codec_begin(frame_codec_t *codec, uint32_t width, uint32_t bpp,
+                      uint8_t *out, uint32_t capacity)
+{
+    if (out == NULL || width == 0 || width > FRAME_CODEC_MAX_WIDTH || bpp == 0 ||
+        bpp > FRAME_CODEC_MAX_CHANNELS || capacity < sizeof(frame_codec_header_t)) {
+        return -1;
+    }
+
+    const frame_codec_header_t header = {
+        .version = FRAME_CODEC_VERSION,
+        .bpp = (uint8_t)bpp,
+        .drop_bits = (uint8_t)codec->config.drop_bits,
+    };
+    memcpy(out, &header, sizeof(header));
+
+    codec->width = width;
+    codec->bpp = bpp;
+    codec->out = out;
+    codec->capacity = capacity;
+    codec->size = sizeof(header);
+    codec->stats.bytes_out += sizeof(header);
+    return 0;
+}
+
+int frame_codec_encode_row(frame_codec_t *codec, const uint8_t *row)
+{
+    const uint32_t row_bytes = codec->width * codec->bpp;
+    const uint32_t n = codec->width * frame_codec_channels(codec->bpp);
+    const uint32_t room = codec->capacity - codec->size;
+    uint8_t *record = codec->out + codec->size;
+
+    /* Rice parameter from the mean residual */
+    const uint32_t sum = frame_codec_residuals(codec, row);
+    uint32_t k = 0;
+    while (k < FRAME_CODEC_MAX_K && (n << k) < sum) {
+        k++;
+    }
+
+    /* Coded only while smaller than the raw record, and only if it fits */
+    const uint32_t remainder_bytes = (n * k + 7U) / 8U;
+    uint32_t coded = row_bytes + 1U;
+    if (FRAME_CODEC_ROW_HEADER_SIZE + remainder_bytes < row_bytes + 1U) {
+        uint32_t limit = row_bytes + 1U - FRAME_CODEC_ROW_HEADER_SIZE - remainder_bytes;
+        if (room < FRAME_CODEC_ROW_HEADER_SIZE + remainder_bytes + limit) {
+            limit = (room > FRAME_CODEC_ROW_HEADER_SIZE + remainder_bytes)
+                  ? room - FRAME_CODEC_ROW_HEADER_SIZE - remainder_bytes : 0;
+        }
+
+        frame_codec_bit_writer_t unary = {
+            record + FRAME_CODEC_ROW_HEADER_SIZE, record + FRAME_CODEC_ROW_HEADER_SIZE + limit, 0, 0
+        };
+        frame_codec_bit_writer_t low = {
+            codec->remainders, codec->remainders + sizeof(codec->remainders), 0, 0
+        };
+        const uint32_t low_mask = (1U << k) - 1U;
+        for (uint32_t i = 0; i < n && unary.p < unary.end; i++) {
+            uint32_t q = (uint32_t)codec->residuals[i] >> k;
+            while (q >= 24U) {
+                frame_codec_put_bits(&unary, 0, 24);
+                q -= 24U;
+            }
+            frame_codec_put_bits(&unary, 1, q + 1U);
+            frame_codec_put_bits(&low, codec->residuals[i] & low_mask, k);
+        }
+        frame_codec_flush_bits(&unary);
+        frame_codec_flush_bits(&low);
+
+        const uint32_t unary_bytes = (uint32_t)(unary.p - (record + FRAME_CODEC_ROW_HEADER_SIZE));
+        if (unary.p <= unary.end && unary_bytes < limit &&
+            low.p == codec->remainders + remainder_bytes) {
+            record[0] = (uint8_t)k;
+            record[1] = (uint8_t)(unary_bytes & 0xFF);
+            record[2] = (uint8_t)(unary_bytes >> 8);
+            memcpy(record + FRAME_CODEC_ROW_HEADER_SIZE + unary_bytes, codec->remainders,
+                   remainder_bytes);
+            coded = FRAME_CODEC_ROW_HEADER_SIZE + unary_bytes + remainder_bytes;
+        }
+    }
+
+    if (coded > row_bytes) {
+        if (room < row_bytes + 1U) {
+            return -1;
+        }
+        record[0] = FRAME_CODEC_ROW_RAW;
+        memcpy(record + 1, row, row_bytes);
+        coded = row_bytes + 1U;
+        codec->stats.raw_rows++;
+    }
+
+    codec->size += coded;
+    codec->stats.rows++;
+    codec->stats.bytes_in += row_bytes;
+    codec->stats.bytes_out += coded;
+    return 0;
+}
+
+uint32_t frame_codec_end(frame_codec_t *codec)
+{
+    codec->stats.frames++;
+    return codec->size;
+}
+
+int frame_codec_decode(uint8_t *image, uint32_t capacity, uint32_t width, uint32_t height,
+                       const uint8_t *data, uint32_t size)
+{
+    frame_codec_header_t header;
+
+    if (size < sizeof(header)) {
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+    const uint32_t bpp = header.bpp;
+    const uint32_t drop = header.drop_bits;
+    if (header.version != FRAME_CODEC_VERSION || bpp == 0 || bpp > FRAME_CODEC_MAX_CHANNELS ||
+        drop > FRAME_CODEC_MAX_DROP_BITS || (uint64_t)width * height * bpp > capacity) {
+        return -1;
+    }
+
+    const uint32_t channels = frame_codec_channels(bpp);
+    const uint32_t n = width * channels;
+    const uint32_t row_bytes = width * bpp;
+    const uint32_t fill = (drop > 0) ? 1U << (drop - 1U) : 0;
+    uint32_t pos = sizeof(header);
+
+    for (uint32_t y = 0; y < height; y++) {
+        uint8_t *out = image + y * row_bytes;
+        if (pos >= size) {
+            return -1;
+        }
+        if (data[pos] == FRAME_CODEC_ROW_RAW) {
+            if (size - pos - 1U < row_bytes) {
+                return -1;
+            }
+            memcpy(out, &data[pos + 1], row_bytes);
+            pos += 1U + row_bytes;
+            continue;
+        }
+
+        const uint32_t k = data[pos];
+        if (k > FRAME_CODEC_MAX_K || size - pos < FRAME_CODEC_ROW_HEADER_SIZE) {
+            return -1;
+        }
+        const uint32_t unary_bytes = (uint32_t)data[pos + 1] | ((uint32_t)data[pos + 2] << 8);
+        const uint32_t remainder_bytes = (n * k + 7U) / 8U;
+        pos += FRAME_CODEC_ROW_HEADER_SIZE;
+        if (size - pos < unary_bytes + remainder_bytes) {
+            return -1;
+        }
+
+        frame_codec_bit_reader_t unary = { &data[pos], &data[pos + unary_bytes], 0, 0 };
+        frame_codec_bit_reader_t low = {
+            &data[pos + unary_bytes], &data[pos + unary_bytes + remainder_bytes], 0, 0
+        };
+        uint32_t left[FRAME_CODEC_MAX_CHANNELS] = { 0, 0, 0 };
+        uint32_t value[FRAME_CODEC_MAX_CHANNELS];
+        for (uint32_t x = 0; x < width; x++) {
+            for (uint32_t c = 0; c < channels; c++) {
+                const int32_t q = frame_codec_get_unary(&unary);
+                const int32_t r = frame_codec_get_bits(&low, k);
+                const uint32_t mask = (1U << (frame_codec_channel_bits(bpp, c) - drop)) - 1U;
+                if (q < 0 || r < 0) {
+                    return -1;
+                }
+                const uint32_t z = ((uint32_t)q << k) | (uint32_t)r;
+                if (z > mask) {
+                    return -1;
+                }
+                const uint32_t d = (z & 1U) ? mask + 1U - ((z + 1U) >> 1) : z >> 1;
+                left[c] = (left[c] + d) & mask;
+                value[c] = (left[c] << drop) | fill;
+            }
+            if (bpp == 2) {
+                const uint32_t px = (value[0] << 11) | (value[1] << 5) | value[2];
+                out[2 * x] = (uint8_t)(px & 0xFF);
+                out[2 * x + 1] = (uint8_t)(px >> 8);
+            } else {
+                for (uint32_t c = 0; c < bpp; c++) {
+                    out[x * bpp + c] = (uint8_t)value[c];
+                }
+            }
+        }
+        pos += unary_bytes + remainder_bytes;
+    }
+
+    return (pos == size) ? (int)bpp : -1;
+}
+
+void frame_codec_get_stats(const frame_codec_t *codec, frame_codec_stats_t *stats)
+{
+    *stats = codec->stats;
+}
@@ -0,0 +1,185 @@
+/**
+ ******************************************************************************
+ * @file    frame_mailbox.c
+ * @author  PeleAB
+ * @brief   Lock-free single-producer/single-consumer frame handoff
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "frame_mailbox.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#define FRAME_MAILBOX_GET_TICK()        HAL_GetTick()
+#define FRAME_MAILBOX_SIGNAL()          __SEV()
+#define FRAME_MAILBOX_SLEEP()           __WFE()
+#else
+#include <sched.h>
+#include "host_platform.h"
+#define FRAME_MAILBOX_GET_TICK()        host_get_tick_ms()
+#define FRAME_MAILBOX_SIGNAL()          do { } while (0)
+#define FRAME_MAILBOX_SLEEP()           sched_yield()
+#endif
+
+/* ========================================================================= */
+/* PRIVATE CONSTANTS                                                         */
+/* ========================================================================= */
+
+/* Latest mode: low bits hold the published slot, this bit marks it unread */
+#define FRAME_MAILBOX_FRESH             0x80000000U
+#define FRAME_MAILBOX_SLOT_MASK         0x0000FFFFU
+
+#if (FRAME_MAILBOX_CAPACITY & (FRAME_MAILBOX_CAPACITY - 1)) != 0
+#error "FRAME_MAILBOX_CAPACITY must be a power of two"
+#endif
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int frame_mailbox_init(frame_mailbox_t *mb, frame_mailbox_mode_t mode)
+{
+    if (mb == NULL) {
+        return -1;
+    }
+
+    memset(mb, 0, sizeof(*mb));
+    mb->mode = mode;
+    atomic_init(&mb->head, 0);
+    atomic_init(&mb->tail, 0);
+
+    /* Slot 0 published (not fresh), producer writes 1, consumer holds 2 */
+    atomic_init(&mb->latest, 0);
+    mb->back_slot = 1;
+    mb->front_slot = 2;
+
+    atomic_init(&mb->posted, 0);
+    atomic_init(&mb->dropped_full, 0);
+    atomic_init(&mb->dropped_overwritten, 0);
+    atomic_init(&mb->delivered, 0);
+    atomic_init(&mb->flushed, 0);
+    return 0;
+}
+
+bool frame_mailbox_post(frame_mailbox_t *mb, uint32_t buffer_index, uint32_t timestamp)
+{
+    const uint32_t sequence = mb->next_sequence++;
+    atomic_fetch_add_explicit(&mb->posted, 1, memory_order_relaxed);
+
+    if (mb->mode == FRAME_MAILBOX_MODE_LATEST) {
+        frame_mailbox_entry_t *slot = &mb->slots[mb->back_slot];
+        slot->buffer_index = buffer_index;
+        slot->timestamp = timestamp;
+        slot->sequence = sequence;
+
+        /* Publish the back slot and take over whichever slot was published */
+        uint32_t prev = atomic_exchange_explicit(&mb->latest, mb->back_slot | FRAME_MAILBOX_FRESH,
+                                                 memory_order_acq_rel);
+        mb->back_slot = prev & FRAME_MAILBOX_SLOT_MASK;
+        if (prev & FRAME_MAILBOX_FRESH) {
+            atomic_fetch_add_explicit(&mb->dropped_overwritten, 1, memory_order_relaxed);
+        }
+        FRAME_MAILBOX_SIGNAL();
+        return true;
+    }
+
+    const uint32_t head = atomic_load_explicit(&mb->head, memory_order_relaxed);
+    const uint32_t tail = atomic_load_explicit(&mb->tail, memory_order_acquire);
+    if (head - tail >= FRAME_MAILBOX_CAPACITY) {
+        atomic_fetch_add_explicit(&mb->dropped_full, 1, memory_order_relaxed);
+        return false;
+    }
+
+    frame_mailbox_entry_t *entry = &mb->ring[head & (FRAME_MAILBOX_CAPACITY - 1)];
+    entry->buffer_index = buffer_index;
+    entry->timestamp = timestamp;
+    entry->sequence = sequence;
+    atomic_store_explicit(&mb->head, head + 1, memory_order_release);
+    FRAME_MAILBOX_SIGNAL();
+    return true;
+}
+
+bool frame_mailbox_pop(frame_mailbox_t *mb, frame_mailbox_entry_t *entry)
+{
+    if (mb->mode == FRAME_MAILBOX_MODE_LATEST) {
+        if ((atomic_load_explicit(&mb->latest, memory_order_relaxed) & FRAME_MAILBOX_FRESH) == 0) {
+            return false;
+        }
+        /* Hand our slot back and take the freshly published one */
+        uint32_t prev = atomic_exchange_explicit(&mb->latest, mb->front_slot, memory_order_acq_rel);
+        mb->front_slot = prev & FRAME_MAILBOX_SLOT_MASK;
+        *entry = mb->slots[mb->front_slot];
+    } else {
+        const uint32_t tail = atomic_load_explicit(&mb->tail, memory_order_relaxed);
+        const uint32_t head = atomic_load_explicit(&mb->head, memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        *entry = mb->ring[tail & (FRAME_MAILBOX_CAPACITY - 1)];
+        atomic_store_explicit(&mb->tail, tail + 1, memory_order_release);
+    }
+
+    atomic_fetch_add_explicit(&mb->delivered, 1, memory_order_relaxed);
+    return true;
+}
+
+int frame_mailbox_wait(frame_mailbox_t *mb, frame_mailbox_entry_t *entry, uint32_t timeout_ms)
+{
+    if (mb == NULL || entry == NULL) {
+        return -1;
+    }
+
+    const uint32_t start = FRAME_MAILBOX_GET_TICK();
+    while (!frame_mailbox_pop(mb, entry)) {
+        if (timeout_ms != 0 && (FRAME_MAILBOX_GET_TICK() - start) >= timeout_ms) {
+            return -2;
+        }
+        /* A post between the check and the sleep leaves the event flag set */
+        FRAME_MAILBOX_SLEEP();
+    }
+    return 0;
+}
+
+uint32_t frame_mailbox_flush(frame_mailbox_t *mb)
+{
+    frame_mailbox_entry_t entry;
+    uint32_t count = 0;
+
+    if (mb == NULL) {
+        return 0;
+    }
+
+    while (frame_mailbox_pop(mb, &entry)) {
+        count++;
+    }
+    atomic_fetch_sub_explicit(&mb->delivered, count, memory_order_relaxed);
+    atomic_fetch_add_explicit(&mb->flushed, count, memory_order_relaxed);
+    return count;
+}
+
+void frame_mailbox_get_stats(const frame_mailbox_t *mb, frame_mailbox_stats_t *stats)
+{
+    if (mb == NULL || stats == NULL) {
+        return;
+    }
+
+    /* C11 atomic_load takes a non-const pointer */
+    frame_mailbox_t *m = (frame_mailbox_t *)mb;
+    stats->posted = atomic_load_explicit(&m->posted, memory_order_relaxed);
+    stats->delivered = atomic_load_explicit(&m->delivered, memory_order_relaxed);
+    stats->flushed = atomic_load_explicit(&m->flushed, memory_order_relaxed);
+    stats->dropped_full = atomic_load_explicit(&m->dropped_full, memory_order_relaxed);
+    stats->dropped_overwritten = atomic_load_explicit(&m->dropped_overwritten, memory_order_relaxed);
+}
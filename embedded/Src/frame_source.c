@@ -0,0 +1,283 @@
+/**
+ ******************************************************************************
+ * @file    frame_source.c
+ * @author  PeleAB
+ * @brief   Camera and PC stream capture sources for the frame pipeline
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "frame_source.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "app_config.h"
+#include "app_constants.h"
+#include "app_cam.h"
+#include "cmw_camera.h"
+#include "enhanced_pc_stream.h"
+#include "memory_pool.h"
+#endif
+
+/* ========================================================================= */
+/* GENERIC DISPATCH                                                          */
+/* ========================================================================= */
+
+int frame_source_start(frame_source_t *src)
+{
+    if (src == NULL) {
+        return -1;
+    }
+    return (src->start != NULL) ? src->start(src) : 0;
+}
+
+int frame_source_acquire(frame_source_t *src, uint8_t *dest, uint32_t dest_size)
+{
+    if (src == NULL || src->acquire == NULL || dest == NULL) {
+        return -1;
+    }
+    return src->acquire(src, dest, dest_size);
+}
+
+void frame_source_stop(frame_source_t *src)
+{
+    if (src != NULL && src->stop != NULL) {
+        src->stop(src);
+    }
+}
+
+#ifndef APP_HOST_BUILD
+/* ========================================================================= */
+/* CAMERA SOURCE                                                             */
+/* ========================================================================= */
+
+/* Upper bound on one frame; a stalled sensor fails the frame instead of hanging */
+#define CAMERA_SOURCE_TIMEOUT_MS    1000
+#define CAMERA_SOURCE_BUFFER_COUNT  2
+
+typedef struct {
+    uint32_t pitch_nn;      /**< DCMIPP NN pipe line pitch in bytes */
+    uint8_t *dcmipp_out_nn; /**< Snapshot capture buffer used when the pitch is padded */
+    uint8_t *capture[CAMERA_SOURCE_BUFFER_COUNT]; /**< Continuous mode capture buffers */
+    uint32_t frames_torn;   /**< Continuous mode: frames overwritten while being copied */
+} camera_source_state_t;
+
+static camera_source_state_t s_camera_state;
+
+/**
+ * @brief Copy a DCMIPP frame into the NN frame, dropping any line padding
+ */
+static void camera_source_copy(const camera_source_state_t *state, uint8_t *dest, const uint8_t *capture)
+{
+    const uint32_t line_size = NN_WIDTH * NN_BPP;
+
+    if (state->pitch_nn == line_size) {
+        memcpy(dest, capture, line_size * NN_HEIGHT);
+        return;
+    }
+    for (uint32_t y = 0; y < NN_HEIGHT; y++) {
+        memcpy(dest + y * line_size, capture + y * state->pitch_nn, line_size);
+    }
+}
+
+#if CAMERA_NN_CONTINUOUS_CAPTURE
+/**
+ * @brief Start the NN pipe continuously, alternating between two buffers
+ */
+static int camera_source_start(frame_source_t *src)
+{
+    camera_source_state_t *state = (camera_source_state_t *)src->priv;
+    memory_pool_t *pool = memory_pool_get_default();
+
+    for (int i = 0; i < CAMERA_SOURCE_BUFFER_COUNT; i++) {
+        memory_pool_invalidate_range(pool, state->capture[i], state->pitch_nn * NN_HEIGHT);
+    }
+    frame_mailbox_init(CAM_NNPipe_GetMailbox(), FRAME_MAILBOX_MODE_LATEST);
+    CAM_NNPipe_DoubleBufferStart(state->capture[0], state->capture[1]);
+    return 0;
+}
+
+/**
+ * @brief Copy out the newest complete frame while DCMIPP fills the other buffer
+ *
+ * Processing slower than the sensor shows up as overwritten mailbox frames.
+ * A frame is also discarded when the sensor completed another one during the
+ * copy, since DCMIPP may then already be writing over the buffer being read.
+ */
+static int camera_source_acquire(frame_source_t *src, uint8_t *dest, uint32_t dest_size)
+{
+    camera_source_state_t *state = (camera_source_state_t *)src->priv;
+    const uint32_t capture_size = state->pitch_nn * NN_HEIGHT;
+    frame_mailbox_t *mailbox = CAM_NNPipe_GetMailbox();
+    memory_pool_t *pool = memory_pool_get_default();
+    frame_mailbox_entry_t frame;
+    frame_mailbox_stats_t stats;
+
+    if (dest_size < NN_WIDTH * NN_BPP * NN_HEIGHT) {
+        return -1;
+    }
+
+    CAM_IspUpdate();
+
+    for (;;) {
+        if (frame_mailbox_wait(mailbox, &frame, CAMERA_SOURCE_TIMEOUT_MS) < 0) {
+            return -2;
+        }
+
+        uint8_t *capture = state->capture[frame.buffer_index % CAMERA_SOURCE_BUFFER_COUNT];
+        memory_pool_invalidate_range(pool, capture, capture_size);
+        camera_source_copy(state, dest, capture);
+
+        frame_mailbox_get_stats(mailbox, &stats);
+        if (stats.posted - frame.sequence < CAMERA_SOURCE_BUFFER_COUNT) {
+            break;
+        }
+        state->frames_torn++;
+    }
+
+    src->frame_timestamp = frame.timestamp;
+    src->frames_dropped = stats.dropped_overwritten + state->frames_torn;
+    return 0;
+}
+
+static void camera_source_stop(frame_source_t *src)
+{
+    (void)src;
+    CAM_NNPipe_Stop();
+}
+#else
+/**
+ * @brief Capture one snapshot from the DCMIPP NN pipe
+ */
+static int camera_source_acquire(frame_source_t *src, uint8_t *dest, uint32_t dest_size)
+{
+    const camera_source_state_t *state = (const camera_source_state_t *)src->priv;
+    const uint32_t line_size = NN_WIDTH * NN_BPP;
+    const bool padded = (state->pitch_nn != line_size);
+
+    if (dest_size < line_size * NN_HEIGHT) {
+        return -1;
+    }
+
+    CAM_IspUpdate();
+
+    memory_pool_t *pool = memory_pool_get_default();
+    uint8_t *capture_buffer = padded ? state->dcmipp_out_nn : dest;
+
+    /* Drop dirty lines left by buffers aliasing the target before DMA writes it */
+    memory_pool_invalidate_range(pool, capture_buffer,
+                                 padded ? state->pitch_nn * NN_HEIGHT : line_size * NN_HEIGHT);
+    frame_mailbox_t *mailbox = CAM_NNPipe_GetMailbox();
+    frame_mailbox_entry_t frame;
+
+    /* Drop completions left over from an earlier snapshot */
+    frame_mailbox_flush(mailbox);
+    CAM_NNPipe_Start(capture_buffer, CMW_MODE_SNAPSHOT);
+
+    /* Sleep until the DCMIPP frame event posts the snapshot */
+    if (frame_mailbox_wait(mailbox, &frame, CAMERA_SOURCE_TIMEOUT_MS) < 0) {
+        return -2;
+    }
+    src->frame_timestamp = frame.timestamp;
+
+    if (padded) {
+        memory_pool_invalidate_range(pool, state->dcmipp_out_nn, state->pitch_nn * NN_HEIGHT);
+        camera_source_copy(state, dest, state->dcmipp_out_nn);
+    } else if (memory_pool_invalidate_range(pool, dest, line_size * NN_HEIGHT) < 0) {
+        /* Destination not owned by the pool: fall back to a raw invalidate */
+        SCB_InvalidateDCache_by_Addr(dest, line_size * NN_HEIGHT);
+    }
+
+    return 0;
+}
+#endif /* CAMERA_NN_CONTINUOUS_CAPTURE */
+
+/**
+ * @brief Allocate a DCMIPP capture buffer, internal SRAM first then PSRAM
+ */
+static uint8_t *camera_source_alloc(uint32_t size, const char *name)
+{
+    memory_pool_t *pool = memory_pool_get_default();
+    uint8_t *buffer = memory_pool_alloc_region(pool, MEMORY_REGION_AXISRAM, size, CACHE_LINE_ALIGNMENT,
+                                               MEMORY_BUFFER_TYPE_FRAME_CAPTURE, name);
+    if (buffer == NULL) {
+        buffer = memory_pool_alloc_region(pool, MEMORY_REGION_PSRAM, size, CACHE_LINE_ALIGNMENT,
+                                          MEMORY_BUFFER_TYPE_FRAME_CAPTURE, name);
+    }
+    return buffer;
+}
+
+int frame_source_camera_init(frame_source_t *src, uint32_t pitch_nn)
+{
+    memset(&s_camera_state, 0, sizeof(s_camera_state));
+    s_camera_state.pitch_nn = pitch_nn;
+
+#if CAMERA_NN_CONTINUOUS_CAPTURE
+    static const char *const names[CAMERA_SOURCE_BUFFER_COUNT] = { "dcmipp_nn_0", "dcmipp_nn_1" };
+    for (int i = 0; i < CAMERA_SOURCE_BUFFER_COUNT; i++) {
+        s_camera_state.capture[i] = camera_source_alloc(pitch_nn * NN_HEIGHT, names[i]);
+        if (s_camera_state.capture[i] == NULL) {
+            return -1;
+        }
+    }
+    src->start = camera_source_start;
+    src->stop = camera_source_stop;
+#else
+    /* The intermediate buffer is only needed when DCMIPP pads its lines */
+    if (pitch_nn != NN_WIDTH * NN_BPP) {
+        s_camera_state.dcmipp_out_nn = camera_source_alloc(DCMIPP_OUT_NN_BUFF_LEN, "dcmipp_out_nn");
+        if (s_camera_state.dcmipp_out_nn == NULL) {
+            return -1;
+        }
+    }
+    src->start = NULL;
+    src->stop = NULL;
+#endif
+
+    src->name = "camera";
+    src->acquire = camera_source_acquire;
+    src->priv = &s_camera_state;
+    src->frame_timestamp = 0;
+    src->frames_dropped = 0;
+    return 0;
+}
+
+/* ========================================================================= */
+/* PC STREAM SOURCE                                                          */
+/* ========================================================================= */
+
+/**
+ * @brief Receive one raw RGB888 frame pushed by the host over UART
+ */
+static int pc_stream_source_acquire(frame_source_t *src, uint8_t *dest, uint32_t dest_size)
+{
+    const uint32_t frame_size = NN_WIDTH * NN_HEIGHT * NN_BPP;
+    (void)src;
+
+    if (dest_size < frame_size) {
+        return -1;
+    }
+    return Enhanced_PC_STREAM_ReceiveImage(dest, frame_size);
+}
+
+void frame_source_pc_stream_init(frame_source_t *src)
+{
+    src->name = "pc_stream";
+    src->start = NULL;
+    src->acquire = pc_stream_source_acquire;
+    src->stop = NULL;
+    src->priv = NULL;
+    src->frame_timestamp = 0;
+    src->frames_dropped = 0;
+}
+#endif /* APP_HOST_BUILD */
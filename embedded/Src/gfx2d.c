@@ -0,0 +1,537 @@
+/**
+ ******************************************************************************
+ * @file    gfx2d.c
+ * @author  PeleAB
+ * @brief   Asynchronous 2D operations on the overlay, DMA2D or software backed
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "gfx2d.h"
+#include "perf_monitor.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#define GFX2D_ENTER_CRITICAL()          uint32_t gfx2d_primask = __get_PRIMASK(); __disable_irq()
+#define GFX2D_EXIT_CRITICAL()           __set_PRIMASK(gfx2d_primask)
+#else
+#define GFX2D_ENTER_CRITICAL()          do { } while (0)
+#define GFX2D_EXIT_CRITICAL()           do { } while (0)
+#endif
+
+/* Host builds, and target builds made with APP_GFX2D_SOFTWARE, run the
+ * queue on the CPU when it is drained */
+#if !defined(APP_HOST_BUILD) && !defined(APP_GFX2D_SOFTWARE)
+#define GFX2D_USE_DMA2D                 1
+#else
+#define GFX2D_USE_DMA2D                 0
+#endif
+
+/* ========================================================================= */
+/* PRIVATE TYPES AND STATE                                                   */
+/* ========================================================================= */
+
+#define GFX2D_QUEUE_MASK                (GFX2D_QUEUE_DEPTH - 1U)
+
+#if (GFX2D_QUEUE_DEPTH & (GFX2D_QUEUE_DEPTH - 1)) != 0
+#error "GFX2D_QUEUE_DEPTH must be a power of two"
+#endif
+
+typedef enum {
+    GFX2D_OP_FILL,
+    GFX2D_OP_BLIT,
+    GFX2D_OP_FENCE,
+} gfx2d_op_type_t;
+
+/* Operations are clipped when queued; dst is always ARGB4444 */
+typedef struct {
+    gfx2d_op_type_t type;
+    uint8_t *dst;
+    const uint8_t *src;
+    uint16_t dst_stride;                /* Pixels */
+    uint16_t src_stride;                /* Pixels */
+    uint16_t width;
+    uint16_t height;
+    gfx2d_format_t src_format;
+    uint32_t color;                     /* ARGB8888 */
+    gfx2d_fence_cb_t callback;
+    void *arg;
+} gfx2d_op_t;
+
+static gfx2d_op_t s_queue[GFX2D_QUEUE_DEPTH];
+static volatile uint32_t s_head;        /* Written by the submitter */
+static volatile uint32_t s_tail;        /* Written by the completion path */
+static volatile bool s_running;         /* DMA2D transfer in flight */
+static volatile bool s_failed;          /* Error since the last gfx2d_wait() */
+static gfx2d_stats_t s_stats;
+
+#if GFX2D_USE_DMA2D
+static DMA2D_HandleTypeDef s_dma2d;
+#endif
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static uint32_t gfx2d_bytes_per_pixel(gfx2d_format_t format)
+{
+    return (format == GFX2D_FORMAT_RGB888) ? 3U : 2U;
+}
+
+static bool gfx2d_surface_valid(const gfx2d_surface_t *surface)
+{
+    return surface != NULL && surface->pixels != NULL && surface->width != 0 && surface->height != 0 &&
+           surface->stride >= surface->width &&
+           (surface->format == GFX2D_FORMAT_ARGB4444 || surface->format == GFX2D_FORMAT_RGB888);
+}
+
+/* Clip [x, x + w) to [0, limit); returns false if nothing is left */
+static bool gfx2d_clip(int32_t *x, int32_t *w, int32_t *skip, uint32_t limit)
+{
+    int64_t x0 = *x, x1 = (int64_t)*x + *w;
+    *skip = (x0 < 0) ? (int32_t)-x0 : 0;
+    x0 = (x0 < 0) ? 0 : x0;
+    x1 = (x1 > (int64_t)limit) ? (int64_t)limit : x1;
+    if (x0 >= x1) {
+        return false;
+    }
+    *x = (int32_t)x0;
+    *w = (int32_t)(x1 - x0);
+    return true;
+}
+
+/* Account an operation leaving the queue; runs in the completion context */
+static void gfx2d_retire(const gfx2d_op_t *op, bool ok)
+{
+    if (ok) {
+        s_stats.completed++;
+        if (op->type != GFX2D_OP_FENCE) {
+            s_stats.pixels += (uint64_t)op->width * op->height;
+        }
+    } else {
+        s_stats.errors++;
+        s_failed = true;
+    }
+    s_tail = s_tail + 1U;
+}
+
+#if GFX2D_USE_DMA2D
+
+/* ========================================================================= */
+/* DMA2D BACKEND                                                             */
+/* ========================================================================= */
+
+/* Whole lines for wide regions, one line per row for narrow ones */
+static void gfx2d_dcache_rows(const uint8_t *first, uint32_t row_bytes, uint32_t stride_bytes,
+                              uint32_t rows, bool invalidate)
+{
+    if (row_bytes * 4U >= stride_bytes) {
+        const int32_t span = (int32_t)((rows - 1U) * stride_bytes + row_bytes);
+        if (invalidate) {
+            SCB_CleanInvalidateDCache_by_Addr((void *)first, span);
+        } else {
+            SCB_CleanDCache_by_Addr((void *)first, span);
+        }
+        return;
+    }
+    for (uint32_t y = 0; y < rows; y++, first += stride_bytes) {
+        if (invalidate) {
+            SCB_CleanInvalidateDCache_by_Addr((void *)first, (int32_t)row_bytes);
+        } else {
+            SCB_CleanDCache_by_Addr((void *)first, (int32_t)row_bytes);
+        }
+    }
+}
+
+static void gfx2d_dma2d_kick(void);
+
+static void gfx2d_dma2d_done(DMA2D_HandleTypeDef *hdma2d)
+{
+    (void)hdma2d;
+    gfx2d_retire(&s_queue[s_tail & GFX2D_QUEUE_MASK], true);
+    s_running = false;
+    gfx2d_dma2d_kick();
+}
+
+static void gfx2d_dma2d_error(DMA2D_HandleTypeDef *hdma2d)
+{
+    (void)hdma2d;
+    gfx2d_retire(&s_queue[s_tail & GFX2D_QUEUE_MASK], false);
+    s_running = false;
+    gfx2d_dma2d_kick();
+}
+
+static int gfx2d_dma2d_start(const gfx2d_op_t *op)
+{
+    s_dma2d.Instance = DMA2D;
+    s_dma2d.Init.Mode = (op->type == GFX2D_OP_FILL) ? DMA2D_R2M :
+                        (op->src_format == GFX2D_FORMAT_ARGB4444) ? DMA2D_M2M : DMA2D_M2M_PFC;
+    s_dma2d.Init.ColorMode = DMA2D_OUTPUT_ARGB4444;
+    s_dma2d.Init.OutputOffset = op->dst_stride - op->width;
+    s_dma2d.Init.AlphaInverted = DMA2D_REGULAR_ALPHA;
+    s_dma2d.Init.RedBlueSwap = DMA2D_RB_REGULAR;
+    s_dma2d.Init.BytesSwap = DMA2D_BYTES_REGULAR;
+    s_dma2d.Init.LineOffsetMode = DMA2D_LOM_PIXELS;
+    s_dma2d.XferCpltCallback = gfx2d_dma2d_done;
+    s_dma2d.XferErrorCallback = gfx2d_dma2d_error;
+    if (HAL_DMA2D_Init(&s_dma2d) != HAL_OK) {
+        return -1;
+    }
+
+    uint32_t source = op->color;
+    if (op->type == GFX2D_OP_BLIT) {
+        DMA2D_LayerCfgTypeDef *layer = &s_dma2d.LayerCfg[1];
+        layer->InputOffset = op->src_stride - op->width;
+        layer->InputColorMode = (op->src_format == GFX2D_FORMAT_RGB888) ? DMA2D_INPUT_RGB888 : DMA2D_INPUT_ARGB4444;
+        layer->AlphaMode = DMA2D_NO_MODIF_ALPHA;
+        layer->InputAlpha = 0xFFU;
+        layer->AlphaInverted = DMA2D_REGULAR_ALPHA;
+        /* DMA2D RGB888 is B, G, R in memory; the camera pipe writes R, G, B */
+        layer->RedBlueSwap = (op->src_format == GFX2D_FORMAT_RGB888) ? DMA2D_RB_SWAP : DMA2D_RB_REGULAR;
+        layer->ChromaSubSampling = DMA2D_NO_CSS;
+        if (HAL_DMA2D_ConfigLayer(&s_dma2d, 1) != HAL_OK) {
+            return -1;
+        }
+        source = (uint32_t)op->src;
+    }
+    return (HAL_DMA2D_Start_IT(&s_dma2d, source, (uint32_t)op->dst, op->width, op->height) == HAL_OK) ? 0 : -1;
+}
+
+/* Start the next transfer; called with the DMA2D interrupt masked or from it */
+static void gfx2d_dma2d_kick(void)
+{
+    while (!s_running && s_tail != s_head) {
+        const gfx2d_op_t *op = &s_queue[s_tail & GFX2D_QUEUE_MASK];
+        if (op->type == GFX2D_OP_FENCE) {
+            gfx2d_retire(op, true);
+            op->callback(op->arg);
+        } else if (gfx2d_dma2d_start(op) == 0) {
+            s_running = true;
+        } else {
+            gfx2d_retire(op, false);
+        }
+    }
+}
+
+#else
+
+/* ========================================================================= */
+/* SOFTWARE BACKEND                                                          */
+/* ========================================================================= */
+
+/* Same truncation as the DMA2D output converter: keep the 4 MSBs */
+static uint16_t gfx2d_to_argb4444(uint32_t a, uint32_t r, uint32_t g, uint32_t b)
+{
+    return (uint16_t)(((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4));
+}
+
+static void gfx2d_sw_execute(const gfx2d_op_t *op)
+{
+    if (op->type == GFX2D_OP_FILL) {
+        const uint32_t c = op->color;
+        const uint16_t pixel = gfx2d_to_argb4444(c >> 24, (c >> 16) & 0xFFU, (c >> 8) & 0xFFU, c & 0xFFU);
+        for (uint32_t y = 0; y < op->height; y++) {
+            uint16_t *row = (uint16_t *)(op->dst + (size_t)y * op->dst_stride * 2U);
+            for (uint32_t x = 0; x < op->width; x++) {
+                row[x] = pixel;
+            }
+        }
+    } else if (op->type == GFX2D_OP_BLIT && op->src_format == GFX2D_FORMAT_ARGB4444) {
+        for (uint32_t y = 0; y < op->height; y++) {
+            memcpy(op->dst + (size_t)y * op->dst_stride * 2U, op->src + (size_t)y * op->src_stride * 2U,
+                   (size_t)op->width * 2U);
+        }
+    } else if (op->type == GFX2D_OP_BLIT) {
+        /* RGB888 has no alpha: opaque, as with DMA2D_NO_MODIF_ALPHA */
+        for (uint32_t y = 0; y < op->height; y++) {
+            const uint8_t *in = op->src + (size_t)y * op->src_stride * 3U;
+            uint16_t *row = (uint16_t *)(op->dst + (size_t)y * op->dst_stride * 2U);
+            for (uint32_t x = 0; x < op->width; x++, in += 3) {
+                row[x] = gfx2d_to_argb4444(0xFFU, in[0], in[1], in[2]);
+            }
+        }
+    }
+}
+
+static void gfx2d_sw_run_one(void)
+{
+    const gfx2d_op_t *op = &s_queue[s_tail & GFX2D_QUEUE_MASK];
+    const uint32_t start = perf_monitor_now();
+
+    if (op->type == GFX2D_OP_FENCE) {
+        gfx2d_retire(op, true);
+        op->callback(op->arg);
+    } else {
+        gfx2d_sw_execute(op);
+        gfx2d_retire(op, true);
+    }
+    s_stats.sw_cycles += perf_monitor_now() - start;
+}
+
+#endif /* GFX2D_USE_DMA2D */
+
+#if GFX2D_USE_DMA2D
+/* Counted in cycles: waits may run in interrupts that SysTick cannot preempt */
+static bool gfx2d_timed_out(uint32_t start)
+{
+    return perf_monitor_now() - start > GFX2D_WAIT_TIMEOUT_MS * 1000U * perf_monitor_cycles_per_us();
+}
+#endif
+
+/* Make room in a full queue; false once the wait begun at start times out */
+static bool gfx2d_wait_slot(uint32_t start)
+{
+#if GFX2D_USE_DMA2D
+    if (gfx2d_timed_out(start)) {
+        GFX2D_ENTER_CRITICAL();
+        s_stats.errors++;
+        GFX2D_EXIT_CRITICAL();
+        return false;
+    }
+#else
+    (void)start;
+    gfx2d_sw_run_one();
+#endif
+    return true;
+}
+
+static int gfx2d_submit(const gfx2d_op_t *op)
+{
+    const uint32_t start = perf_monitor_now();
+    uint32_t wait_start = 0;
+    bool waited = false;
+
+#if GFX2D_USE_DMA2D
+    /* Write back CPU pixels and drop the lines DMA2D is about to replace */
+    if (op->type != GFX2D_OP_FENCE) {
+        gfx2d_dcache_rows(op->dst, op->width * 2U, op->dst_stride * 2U, op->height, true);
+    }
+    if (op->type == GFX2D_OP_BLIT) {
+        const uint32_t bpp = gfx2d_bytes_per_pixel(op->src_format);
+        gfx2d_dcache_rows(op->src, op->width * bpp, op->src_stride * bpp, op->height, false);
+    }
+#endif
+
+    /* The room check and the store share one critical section: a submitter
+     * in an interrupt must not take the slot between them */
+    for (;;) {
+        bool queued = false;
+        GFX2D_ENTER_CRITICAL();
+        if (s_head - s_tail < GFX2D_QUEUE_DEPTH) {
+            s_queue[s_head & GFX2D_QUEUE_MASK] = *op;
+            s_head = s_head + 1U;
+            s_stats.submitted++;
+            /* Software backend waits are counted in sw_cycles */
+            const uint32_t now = perf_monitor_now();
+            const uint32_t blocked = waited ? now - wait_start : 0U;
+            s_stats.submit_cycles += now - start - blocked;
+#if GFX2D_USE_DMA2D
+            s_stats.wait_cycles += blocked;
+            gfx2d_dma2d_kick();
+#endif
+            queued = true;
+        } else if (!waited) {
+            s_stats.queue_full++;
+        }
+        GFX2D_EXIT_CRITICAL();
+
+        if (queued) {
+            return 0;
+        }
+        if (!waited) {
+            waited = true;
+            wait_start = perf_monitor_now();
+        }
+        if (!gfx2d_wait_slot(wait_start)) {
+            return -1;
+        }
+    }
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int gfx2d_init(void)
+{
+    s_head = 0;
+    s_tail = 0;
+    s_running = false;
+    s_failed = false;
+    memset(s_queue, 0, sizeof(s_queue));
+    memset(&s_stats, 0, sizeof(s_stats));
+
+#if GFX2D_USE_DMA2D
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+    memset(&s_dma2d, 0, sizeof(s_dma2d));
+    HAL_NVIC_SetPriority(DMA2D_IRQn, 0x07, 0);
+    HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+#endif
+    return 0;
+}
+
+int gfx2d_fill(const gfx2d_surface_t *dst, int32_t x, int32_t y, int32_t width, int32_t height,
+               uint32_t argb8888)
+{
+    int32_t skip;
+
+    if (!gfx2d_surface_valid(dst) || dst->format != GFX2D_FORMAT_ARGB4444 || width < 0 || height < 0) {
+        return -1;
+    }
+    if (!gfx2d_clip(&x, &width, &skip, dst->width) || !gfx2d_clip(&y, &height, &skip, dst->height)) {
+        return 0;
+    }
+
+    const gfx2d_op_t op = {
+        .type = GFX2D_OP_FILL,
+        .dst = dst->pixels + ((size_t)y * dst->stride + (size_t)x) * 2U,
+        .dst_stride = dst->stride,
+        .width = (uint16_t)width,
+        .height = (uint16_t)height,
+        .color = argb8888,
+    };
+    return gfx2d_submit(&op);
+}
+
+int gfx2d_rect(const gfx2d_surface_t *dst, int32_t x, int32_t y, int32_t width, int32_t height,
+               uint32_t thickness, uint32_t argb8888)
+{
+    const int32_t t = (int32_t)thickness;
+
+    if (thickness == 0 || thickness > INT16_MAX || width < 0 || height < 0) {
+        return -1;
+    }
+    if (width <= 2 * t || height <= 2 * t) {
+        return gfx2d_fill(dst, x, y, width, height, argb8888);
+    }
+
+    int ret = gfx2d_fill(dst, x, y, width, t, argb8888);
+    ret |= gfx2d_fill(dst, x, y + height - t, width, t, argb8888);
+    ret |= gfx2d_fill(dst, x, y + t, t, height - 2 * t, argb8888);
+    ret |= gfx2d_fill(dst, x + width - t, y + t, t, height - 2 * t, argb8888);
+    return (ret != 0) ? -1 : 0;
+}
+
+int gfx2d_blit(const gfx2d_surface_t *dst, int32_t x, int32_t y, const gfx2d_surface_t *src)
+{
+    int32_t width, height, skip_x, skip_y;
+
+    if (!gfx2d_surface_valid(dst) || dst->format != GFX2D_FORMAT_ARGB4444 || !gfx2d_surface_valid(src)) {
+        return -1;
+    }
+    width = src->width;
+    height = src->height;
+    if (!gfx2d_clip(&x, &width, &skip_x, dst->width) || !gfx2d_clip(&y, &height, &skip_y, dst->height)) {
+        return 0;
+    }
+
+    const uint32_t bpp = gfx2d_bytes_per_pixel(src->format);
+    const gfx2d_op_t op = {
+        .type = GFX2D_OP_BLIT,
+        .dst = dst->pixels + ((size_t)y * dst->stride + (size_t)x) * 2U,
+        .src = src->pixels + ((size_t)skip_y * src->stride + (size_t)skip_x) * bpp,
+        .dst_stride = dst->stride,
+        .src_stride = src->stride,
+        .width = (uint16_t)width,
+        .height = (uint16_t)height,
+        .src_format = src->format,
+    };
+    return gfx2d_submit(&op);
+}
+
+int gfx2d_fence(gfx2d_fence_cb_t callback, void *arg)
+{
+    if (callback == NULL) {
+        return -1;
+    }
+
+    const gfx2d_op_t op = {
+        .type = GFX2D_OP_FENCE,
+        .callback = callback,
+        .arg = arg,
+    };
+    return gfx2d_submit(&op);
+}
+
+int gfx2d_wait(void)
+{
+    int ret = 0;
+
+#if GFX2D_USE_DMA2D
+    const uint32_t start = perf_monitor_now();
+    while (s_tail != s_head) {
+        if (gfx2d_timed_out(start)) {
+            /* Drop what is left so UTIL_LCD can use DMA2D again */
+            HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+            HAL_DMA2D_Abort(&s_dma2d);
+            s_stats.errors += s_head - s_tail;
+            s_tail = s_head;
+            s_running = false;
+            HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+            ret = -1;
+            break;
+        }
+    }
+    s_stats.wait_cycles += perf_monitor_now() - start;
+#else
+    while (s_tail != s_head) {
+        gfx2d_sw_run_one();
+    }
+#endif
+
+    if (s_failed) {
+        s_failed = false;
+        ret = -1;
+    }
+    return ret;
+}
+
+int gfx2d_flush(void)
+{
+#if GFX2D_USE_DMA2D
+    /* DMA2D is already working through the queue */
+    return 0;
+#else
+    return gfx2d_wait();
+#endif
+}
+
+bool gfx2d_idle(void)
+{
+    return s_tail == s_head;
+}
+
+void gfx2d_get_stats(gfx2d_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    GFX2D_ENTER_CRITICAL();
+    *stats = s_stats;
+    GFX2D_EXIT_CRITICAL();
+}
+
+void gfx2d_reset_stats(void)
+{
+    GFX2D_ENTER_CRITICAL();
+    memset(&s_stats, 0, sizeof(s_stats));
+    GFX2D_EXIT_CRITICAL();
+}
+
+void gfx2d_irq_handler(void)
+{
+#if GFX2D_USE_DMA2D
+    HAL_DMA2D_IRQHandler(&s_dma2d);
+#endif
+}
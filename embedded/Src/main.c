@@ -35,7 +35,6 @@
 #include <math.h>
 #include "stm32n6xx_hal_rif.h"
 #include "app_system.h"
-#include "nn_runner.h"
 #include "enhanced_pc_stream.h"
 
 #include "crop_img.h"
@@ -47,8 +46,12 @@
 #include "app_constants.h"
 #include "app_config_manager.h"
 #include "memory_pool.h"
+#include "memory_planner.h"
 #include "app_neural_network.h"
 #include "app_frame_processing.h"
+#include "perf_monitor.h"
+#include "epoch_profiler.h"
+#include "npu_stall_monitor.h"
 
 /* Legacy compatibility - constants moved to app_constants.h */
 #define REVERIFY_INTERVAL_MS        FACE_REVERIFY_INTERVAL_MS
@@ -58,37 +61,6 @@
 #define SIMILARITY_THRESHOLD        FACE_SIMILARITY_THRESHOLD
 #define LONG_PRESS_MS               BUTTON_LONG_PRESS_DURATION_MS
 
-/* Neural Network Context Structure */
-typedef struct {
-    /* Face Detection Network */
-    uint8_t *detection_input_buffer;
-    float32_t *detection_output_buffers[MAX_NUMBER_OUTPUT];
-    int32_t detection_output_lengths[MAX_NUMBER_OUTPUT];
-    uint32_t detection_input_length;
-    int detection_output_count;
-    
-    /* Face Recognition Network */
-    uint8_t *recognition_input_buffer;
-    float32_t *recognition_output_buffer;
-    uint32_t recognition_input_length;
-    uint32_t recognition_output_length;
-    
-    /* Network Instance References */
-    bool detection_initialized;
-    bool recognition_initialized;
-} nn_context_t;
-
-/* ========================================================================= */
-/* SIMPLE TARGET DETECTION APPROACH                                        */
-/* ========================================================================= */
-
-/**
- * @brief Pixel coordinates structure
- */
-typedef struct {
-    float cx, cy, w, h, lx, ly, rx, ry;
-} pixel_coords_t;
-
 /* Simplified Application State Machine - No Tracking */
 typedef enum {
     PIPE_STATE_DETECT_AND_VERIFY = 0  /* Single state: detect faces and verify immediately */
@@ -98,17 +70,10 @@ typedef enum {
  * @brief Enhanced application context structure
  */
 typedef struct {
-    /* Centralized Neural Network Context */
-    nn_context_t nn_ctx;
-    
-    /* Post-processing */
-    pd_model_pp_static_param_t pp_params;
-    pd_postprocess_out_t pp_output;
-    
     /* Configuration management */
     app_config_t config;                    /**< Application configuration */
     
-    /* Frame processing pipeline */
+    /* Frame processing pipeline (owns the networks and detection results) */
     frame_processing_context_t frame_ctx;   /**< Frame processing context */
     
     /* State Management - Simplified */
@@ -141,26 +106,21 @@ typedef struct {
     /* Performance monitoring */
     performance_metrics_t performance;      /**< Performance metrics */
     uint32_t frame_count;                   /**< Frame counter */
+    uint32_t boot_time;                     /**< Tick at pipeline start */
+    uint32_t perf_export_time;              /**< Tick of the last timing summary export */
 } app_context_t;
 
-/* Global Variables */
-volatile int32_t cameraFrameReceived;
-
 /* Global variables for cropped face display */
 bool g_cropped_face_valid = false;
 float g_current_similarity = 0.0f;
 
-/* Optimized Memory Buffers - Using PSRAM for large buffers to reduce boot time */
-__attribute__ ((section (".psram_bss")))
-__attribute__((aligned (32)))
-uint8_t nn_rgb[NN_WIDTH * NN_HEIGHT * NN_BPP];  /* 128x128x3 = 49KB */
+/* Pipeline frame buffers, aliased by lifetime in one scratch arena at init */
+static uint8_t *nn_rgb;  /* 128x128x3 = 49KB */
+static uint8_t *fr_rgb;  /* 112x112x3 = 37KB */
+static memory_plan_t g_scratch_plan;
 
-__attribute__ ((section (".psram_bss")))
-__attribute__((aligned (32)))
-uint8_t fr_rgb[FR_WIDTH * FR_HEIGHT * NN_BPP];  /* 112x112x3 = 37KB */
-
-__attribute__ ((aligned (32)))
-uint8_t dcmipp_out_nn[DCMIPP_OUT_NN_BUFF_LEN];  /* Camera output buffer */
+/* Capture source feeding the pipeline (camera or PC stream) */
+static frame_source_t g_frame_source;
 
 #ifdef DUMMY_INPUT_BUFFER
 /* ========================================================================= */
@@ -182,8 +142,8 @@ static void load_dual_dummy_buffers(void)
     printf("Loading dual dummy buffers (test image)...\n");
     /* Load nn_rgb (128x128 RGB888) for neural network input */
     memcpy(nn_rgb, dummy_test_nn_rgb, DUMMY_TEST_NN_RGB_SIZE);
-    /* Invalidate cache after loading PSRAM data */
-    SCB_InvalidateDCache_by_Addr((uint32_t*)nn_rgb, DUMMY_TEST_NN_RGB_SIZE);
+    /* Write the test image back to PSRAM */
+    memory_pool_clean_range(memory_pool_get_default(), nn_rgb, DUMMY_TEST_NN_RGB_SIZE);
     printf("   nn_rgb: 128x128 RGB888 (%d bytes)\n", DUMMY_TEST_NN_RGB_SIZE);
     
     printf("Dual dummy buffers loaded: consistent test data for detection + cropping\n");
@@ -209,118 +169,23 @@ static app_context_t g_app_ctx = {
 
 
 /* Function Prototypes */
-static int nn_init_detection(nn_context_t *nn_ctx);
-static int nn_init_recognition_lazy(nn_context_t *nn_ctx);
-static void nn_cleanup(nn_context_t *nn_ctx);
 static int app_init(app_context_t *ctx);
 static int app_main_loop(app_context_t *ctx);
 static void app_camera_init(uint32_t *pitch_nn);
 static void app_display_init(void);
 static void app_input_start(void);
-static int  app_get_frame(uint8_t *dest, uint32_t pitch_nn);
-static void app_output(pd_postprocess_out_t *res, uint32_t total_frame_time_ms, uint32_t boot_ms, const app_context_t *ctx);
+static int app_source_init(app_context_t *ctx, uint32_t pitch_nn);
+static void app_output(pd_postprocess_out_t *res, uint32_t total_frame_time_ms, uint32_t boot_ms,
+                       uint32_t capture_ms, const app_context_t *ctx);
 static void handle_user_button(app_context_t *ctx);
-static float verify_box(app_context_t *ctx, const pd_pp_box_t *box);
 static void process_frame_detections(app_context_t *ctx, pd_pp_box_t *boxes, uint32_t box_count);
 static void update_led_status(app_context_t *ctx);
 static void update_target_detection_history(app_context_t *ctx, bool target_found_this_frame);
 static void compute_target_detection_status(app_context_t *ctx);
-static float run_face_recognition_on_face(app_context_t *ctx, const pd_pp_box_t *box);
-static int convert_box_coordinates(const pd_pp_box_t *box, pixel_coords_t *pixel_coords);
-static int crop_face_region(const pixel_coords_t *coords, uint8_t *output_buffer);
-static float calculate_face_similarity(const float32_t *embedding, const float32_t *target_embedding, uint32_t embedding_size);
-static void cleanup_nn_buffers(float32_t **nn_out, int32_t *nn_out_len, int number_output);
-
-/* Neural Network Instance Declarations */
-LL_ATON_DECLARE_NAMED_NN_INSTANCE_AND_INTERFACE(face_detection);
-LL_ATON_DECLARE_NAMED_NN_INSTANCE_AND_INTERFACE(face_recognition);
-
-/**
- * @brief Initialize face detection network only (for faster boot)
- * @param nn_ctx Neural network context to initialize
- * @return 0 on success, negative on error
- */
-static int nn_init_detection(nn_context_t *nn_ctx)
-{
-    /* Clear context */
-    memset(nn_ctx, 0, sizeof(*nn_ctx));
-    
-    /* Initialize Face Detection Network */
-    const LL_Buffer_InfoTypeDef *detection_in_info = LL_ATON_Input_Buffers_Info_face_detection();
-    const LL_Buffer_InfoTypeDef *detection_out_info = LL_ATON_Output_Buffers_Info_face_detection();
-    
-    if (!detection_in_info || !detection_out_info) {
-        return -1; /* Failed to get buffer info */
-    }
-    
-    /* Setup detection input buffer */
-    nn_ctx->detection_input_buffer = (uint8_t *) LL_Buffer_addr_start(&detection_in_info[0]);
-    nn_ctx->detection_input_length = LL_Buffer_len(&detection_in_info[0]);
-    
-    /* Setup detection output buffers */
-    nn_ctx->detection_output_count = 0;
-    while (detection_out_info[nn_ctx->detection_output_count].name != NULL && 
-           nn_ctx->detection_output_count < MAX_NUMBER_OUTPUT) {
-        nn_ctx->detection_output_buffers[nn_ctx->detection_output_count] = 
-            (float32_t *) LL_Buffer_addr_start(&detection_out_info[nn_ctx->detection_output_count]);
-        nn_ctx->detection_output_lengths[nn_ctx->detection_output_count] = 
-            LL_Buffer_len(&detection_out_info[nn_ctx->detection_output_count]);
-        nn_ctx->detection_output_count++;
-    }
-    
-    nn_ctx->detection_initialized = true;
-    
-    printf("Face Detection Network Ready: %lu bytes, %d outputs\n", 
-           nn_ctx->detection_input_length, nn_ctx->detection_output_count);
-    
-    return 0;
-}
+static float run_face_recognition_on_face(app_context_t *ctx, uint32_t face_idx);
+static int app_register_stages(app_context_t *ctx);
+static int app_alloc_buffers(void);
 
-/**
- * @brief Initialize face recognition network lazily (when first face detected)
- * @param nn_ctx Neural network context to initialize
- * @return 0 on success, negative on error
- */
-static int nn_init_recognition_lazy(nn_context_t *nn_ctx)
-{
-    if (nn_ctx->recognition_initialized) {
-        return 0; /* Already initialized */
-    }
-    
-    /* Initialize Face Recognition Network */
-    const LL_Buffer_InfoTypeDef *recognition_in_info = LL_ATON_Input_Buffers_Info_face_recognition();
-    const LL_Buffer_InfoTypeDef *recognition_out_info = LL_ATON_Output_Buffers_Info_face_recognition();
-    
-    if (!recognition_in_info || !recognition_out_info) {
-        return -2; /* Failed to get face recognition buffer info */
-    }
-    
-    /* Setup recognition buffers */
-    nn_ctx->recognition_input_buffer = (uint8_t *) LL_Buffer_addr_start(&recognition_in_info[0]);
-    nn_ctx->recognition_input_length = LL_Buffer_len(&recognition_in_info[0]);
-    nn_ctx->recognition_output_buffer = (float32_t *) LL_Buffer_addr_start(&recognition_out_info[0]);
-    nn_ctx->recognition_output_length = LL_Buffer_len(&recognition_out_info[0]);
-    
-    nn_ctx->recognition_initialized = true;
-    
-    printf("Face Recognition Network Loaded: %lu bytes -> %lu bytes\n", 
-           nn_ctx->recognition_input_length, nn_ctx->recognition_output_length);
-    
-    return 0;
-}
-
-/**
- * @brief Clean up neural network resources
- * @param nn_ctx Neural network context to clean up
- */
-static void nn_cleanup(nn_context_t *nn_ctx)
-{
-    if (nn_ctx && (nn_ctx->detection_initialized || nn_ctx->recognition_initialized)) {
-        /* Clean up any network-specific resources if needed */
-        memset(nn_ctx, 0, sizeof(*nn_ctx));
-        printf("🧹 Neural Networks cleaned up\n");
-    }
-}
 /* ========================================================================= */
 /* FUNCTION IMPLEMENTATIONS                                                  */
 /* ========================================================================= */
@@ -360,48 +225,94 @@ static void app_input_start(void)
 }
 
 /**
- * @brief Capture frame from camera or PC stream
- * @param dest Destination buffer for frame data
- * @param pitch_nn Neural network pitch value
- * @return 0 on success, non-zero on failure
+ * @brief Plan and allocate the pipeline scratch buffers
+ *
+ * Buffers whose stage lifetimes do not overlap share memory. The arena goes
+ * to internal SRAM when it fits and falls back to PSRAM otherwise.
+ *
+ * @return 0 on success, negative on error
  */
-static int app_get_frame(uint8_t *dest, uint32_t pitch_nn)
+static int app_alloc_buffers(void)
 {
+    memory_pool_t *pool = memory_pool_get_default();
+    memory_plan_t *plan = &g_scratch_plan;
+
 #if INPUT_SRC_MODE == INPUT_SRC_CAMERA
-    CAM_IspUpdate();
-    
-    uint8_t *capture_buffer = (pitch_nn != (NN_WIDTH * NN_BPP)) ? dcmipp_out_nn : dest;
-    CAM_NNPipe_Start(capture_buffer, CMW_MODE_SNAPSHOT);
+    /* Faces are cropped from the display pipe: nn_rgb dies after preprocessing */
+    const uint32_t nn_rgb_last_stage = PIPELINE_STAGE_PREPROCESSING;
+#else
+    /* Faces are cropped from nn_rgb itself */
+    const uint32_t nn_rgb_last_stage = PIPELINE_STAGE_RECOGNITION;
+#endif
 
-    /* Optimized frame capture - reduced blocking time */
-    while (cameraFrameReceived == 0) {
-        /* Could add a timeout here for better responsiveness */
+    memory_plan_init(plan);
+    memory_plan_add(plan, "nn_rgb", NN_WIDTH * NN_HEIGHT * NN_BPP, 0,
+                    PIPELINE_STAGE_CAPTURE, nn_rgb_last_stage, (void **)&nn_rgb);
+    memory_plan_add(plan, "fr_rgb", FR_WIDTH * FR_HEIGHT * NN_BPP, 0,
+                    PIPELINE_STAGE_RECOGNITION, PIPELINE_STAGE_RECOGNITION, (void **)&fr_rgb);
+
+    int ret = memory_plan_allocate(plan, pool, MEMORY_REGION_AXISRAM, "scratch");
+    if (ret == -2) {
+        ret = memory_plan_allocate(plan, pool, MEMORY_REGION_PSRAM, "scratch");
+    }
+    if (ret < 0) {
+        return ret;
     }
-    cameraFrameReceived = 0;
-    SCB_InvalidateDCache_by_Addr(dest, NN_WIDTH * NN_HEIGHT * NN_BPP);
 
+    memory_plan_print(plan);
     return 0;
+}
+
+/**
+ * @brief Select the capture source and the image faces are cropped from
+ * @param ctx Application context
+ * @param pitch_nn Neural network pitch value
+ * @return 0 on success, negative on error
+ */
+static int app_source_init(app_context_t *ctx, uint32_t pitch_nn)
+{
+#if INPUT_SRC_MODE == INPUT_SRC_CAMERA
+    if (frame_source_camera_init(&g_frame_source, pitch_nn) < 0) {
+        return -1;
+    }
+
+    /* Faces are cropped from the full resolution display pipe (RGB565) */
+#ifdef DUMMY_INPUT_BUFFER
+    const uint8_t *crop_buffer = (const uint8_t *)dummy_test_img_buffer;
+#else
+    const uint8_t *crop_buffer = img_buffer;
+#endif
+    frame_processing_set_crop_source(&ctx->frame_ctx, crop_buffer,
+                                     lcd_bg_area.XSize, lcd_bg_area.YSize,
+                                     lcd_bg_area.XSize, 2);
 #else
-    return PC_STREAM_ReceiveImage(dest, NN_WIDTH * NN_HEIGHT * NN_BPP);
+    (void)pitch_nn;
+    frame_source_pc_stream_init(&g_frame_source);
+    /* Faces are cropped from the NN input frame (default crop source) */
 #endif
+    frame_source_start(&g_frame_source);
+    frame_processing_set_source(&ctx->frame_ctx, &g_frame_source);
+    return 0;
 }
 
-
 /**
  * @brief Display network output results
  * @param res Post-processing results
  * @param inf_ms Inference time in milliseconds
  * @param boot_ms Boot time in milliseconds
+ * @param capture_ms Capture time of the frame the results come from
  * @param ctx Application context with current frame results
  */
-static void app_output(pd_postprocess_out_t *res, uint32_t total_frame_time_ms, uint32_t boot_ms, const app_context_t *ctx)
+static void app_output(pd_postprocess_out_t *res, uint32_t total_frame_time_ms, uint32_t boot_ms,
+                       uint32_t capture_ms, const app_context_t *ctx)
 {
 #if defined(ENABLE_PC_STREAM) || defined(ENABLE_LCD_DISPLAY)
-    Display_NetworkOutput(res, total_frame_time_ms, boot_ms, ctx);
+    Display_NetworkOutput(res, total_frame_time_ms, boot_ms, capture_ms, ctx);
 #else
     (void)res;
     (void)total_frame_time_ms;
     (void)boot_ms;
+    (void)capture_ms;
     (void)ctx;
 #endif
 }
@@ -446,151 +357,37 @@ static void compute_target_detection_status(app_context_t *ctx)
     ctx->target_detected = (positive_detections >= 3);
 }
 
-/**
- * @brief Convert normalized coordinates to pixel coordinates
- * @param box Bounding box with normalized coordinates
- * @param pixel_coords Output pixel coordinates structure
- * @return 0 on success, negative on error
- */
-static int convert_box_coordinates(const pd_pp_box_t *box, 
-                                  pixel_coords_t *pixel_coords)
-{
-    if (!box || !pixel_coords) {
-        return -1;
-    }
-    
-    pixel_coords->cx = box->x_center * lcd_bg_area.XSize;
-    pixel_coords->cy = box->y_center * lcd_bg_area.YSize;
-    pixel_coords->w  = box->width  * lcd_bg_area.XSize * FACE_BBOX_PADDING_FACTOR;
-    pixel_coords->h  = box->height * lcd_bg_area.YSize * FACE_BBOX_PADDING_FACTOR;
-    pixel_coords->lx = box->pKps[0].x * lcd_bg_area.XSize;
-    pixel_coords->ly = box->pKps[0].y * lcd_bg_area.YSize;
-    pixel_coords->rx = box->pKps[1].x * lcd_bg_area.XSize;
-    pixel_coords->ry = box->pKps[1].y * lcd_bg_area.YSize;
-    
-    return 0;
-}
-
-/**
- * @brief Crop face region from input image
- * @param coords Pixel coordinates structure
- * @param output_buffer Output buffer for cropped face
- * @return 0 on success, negative on error
- */
-static int crop_face_region(const pixel_coords_t *coords,
-                           uint8_t *output_buffer)
-{
-    if (!coords || !output_buffer) {
-        return -1;
-    }
-    
-#if INPUT_SRC_MODE == INPUT_SRC_CAMERA
-#ifdef DUMMY_INPUT_BUFFER
-    img_crop_align565_to_888(dummy_test_img_buffer, lcd_bg_area.XSize, output_buffer,
-                            lcd_bg_area.XSize, lcd_bg_area.YSize,
-                            FACE_RECOGNITION_WIDTH, FACE_RECOGNITION_HEIGHT,
-                            coords->cx, coords->cy, coords->w, coords->h,
-                            coords->lx, coords->ly, coords->rx, coords->ry);
-#else
-    img_crop_align565_to_888(img_buffer, lcd_bg_area.XSize, output_buffer,
-                            lcd_bg_area.XSize, lcd_bg_area.YSize,
-                            FACE_RECOGNITION_WIDTH, FACE_RECOGNITION_HEIGHT,
-                            coords->cx, coords->cy, coords->w, coords->h, 
-                            coords->lx, coords->ly, coords->rx, coords->ry);
-#endif //DUMMY_INPUT_BUFFER
-
-#else
-    img_crop_align(nn_rgb, output_buffer,
-                   NN_WIDTH, NN_HEIGHT,
-                   FACE_RECOGNITION_WIDTH, FACE_RECOGNITION_HEIGHT, NN_BPP,
-                   coords->cx, coords->cy, coords->w, coords->h, 
-                   coords->lx, coords->ly, coords->rx, coords->ry);
-#endif
-    
-    return 0;
-}
-
-/**
- * @brief Calculate face similarity with target embedding
- * @param embedding Current face embedding
- * @param target_embedding Target embedding for comparison
- * @param embedding_size Size of embedding arrays
- * @return Cosine similarity score (0.0 to 1.0)
- */
-static float calculate_face_similarity(const float32_t *embedding,
-                                      const float32_t *target_embedding,
-                                      uint32_t embedding_size)
-{
-    if (!embedding || !target_embedding || embedding_size == 0) {
-        return 0.0f;
-    }
-    
-    return embedding_cosine_similarity(embedding, target_embedding, embedding_size);
-}
-
 /**
  * @brief Run face recognition on a single face
  * @param ctx Application context
- * @param box Bounding box of face to recognize
+ * @param face_idx Index of the face in the detection results
  * @return Similarity score (0.0 to 1.0)
  */
-static float run_face_recognition_on_face(app_context_t *ctx, const pd_pp_box_t *box)
+static float run_face_recognition_on_face(app_context_t *ctx, uint32_t face_idx)
 {
-    pixel_coords_t pixel_coords;
-    float32_t embedding[EMBEDDING_SIZE];
-    
-    /* Lazy initialization of face recognition network */
-    if (!ctx->nn_ctx.recognition_initialized) {
-        if (nn_init_recognition_lazy(&ctx->nn_ctx) < 0) {
-            printf("Face recognition network lazy initialization failed\n");
-            return 0.0f;
-        }
-    }
-    
-    /* Convert coordinates */
-    if (convert_box_coordinates(box, &pixel_coords) < 0) {
-        return 0.0f;
-    }
-    
-    /* Crop face region */
-    if (crop_face_region(&pixel_coords, fr_rgb) < 0) {
+    float similarity = 0.0f;
+
+    /* The thumbnail of an earlier face may still be reading fr_rgb */
+    Display_Sync();
+
+    /* Crop, align, run the network and score against the target embedding */
+    if (frame_processing_recognition_stage(&ctx->frame_ctx, face_idx, &similarity) < 0) {
+        printf("Face recognition failed\n");
         return 0.0f;
     }
-    
-    /* Prepare input for face recognition network */
-    img_rgb_to_chw_float_norm(fr_rgb, (float32_t*)ctx->nn_ctx.recognition_input_buffer, 
-                             FR_WIDTH * NN_BPP, FR_WIDTH, FR_HEIGHT);
-    
-    SCB_CleanInvalidateDCache_by_Addr(ctx->nn_ctx.recognition_input_buffer, 
-                                     ctx->nn_ctx.recognition_input_length);
-    
-    /* Run face recognition inference */
-    RunNetworkSync(&NN_Instance_face_recognition);
-    SCB_InvalidateDCache_by_Addr(ctx->nn_ctx.recognition_output_buffer, 
-                                ctx->nn_ctx.recognition_output_length);
-    
-    /* Convert output to float embedding */
-    for (uint32_t i = 0; i < EMBEDDING_SIZE; i++) {
-        embedding[i] = ((float32_t)ctx->nn_ctx.recognition_output_buffer[i]);
-    }
-    
-    /* Calculate similarity */
-    float similarity = calculate_face_similarity(embedding, target_embedding, EMBEDDING_SIZE);
-    
+
     /* Store embedding in context (for button press functionality) */
     /* The last face processed will have its embedding stored - this will be overwritten */
     /* but the process_frame_detections will ensure best face embedding is preserved */
-    for (uint32_t i = 0; i < EMBEDDING_SIZE; i++) {
-        ctx->current_embedding[i] = embedding[i];
-    }
+    nn_face_recognition_get_embedding(&ctx->frame_ctx.face_recognition,
+                                      ctx->current_embedding, EMBEDDING_SIZE);
     ctx->embedding_valid = 1;
     
     /* Send results via PC stream */
     Enhanced_PC_STREAM_SendFrame(fr_rgb, FACE_RECOGNITION_WIDTH, 
                                 FACE_RECOGNITION_HEIGHT, NN_BPP, "ALN", NULL, NULL);
-    Enhanced_PC_STREAM_SendEmbedding(embedding, EMBEDDING_SIZE);
+    Enhanced_PC_STREAM_SendEmbedding(ctx->current_embedding, EMBEDDING_SIZE);
     
-    LL_ATON_RT_DeInit_Network(&NN_Instance_face_recognition);
     return similarity;
 }
 
@@ -623,22 +420,6 @@ static void handle_user_button(app_context_t *ctx)
 }
 
 
-/**
- * @brief Legacy verify_box function - now uses run_face_recognition_on_face
- * @param ctx Application context
- * @param box Bounding box to verify
- * @return Similarity score (0.0 to 1.0)
- */
-static float verify_box(app_context_t *ctx, const pd_pp_box_t *box)
-{
-    /* Legacy function - just call the new implementation */
-    return run_face_recognition_on_face(ctx, box);
-}
-
-/**
- * @brief Initialize application context and neural networks
- * @param ctx Application context
- */
 /**
  * @brief Initialize application context and subsystems
  * @param ctx Application context pointer
@@ -670,17 +451,29 @@ static int app_init(app_context_t *ctx)
     BSP_PB_Init(BUTTON_USER1, BUTTON_MODE_GPIO);
     
     /* Initialize face detection network only (lazy load face recognition) */
-    ret = nn_init_detection(&ctx->nn_ctx);
+    ret = frame_processing_init(&ctx->frame_ctx, &ctx->config);
     if (ret < 0) {
         printf("Face detection network initialization failed: %d\n", ret);
         return ret;
     }
+    ret = app_alloc_buffers();
+    if (ret < 0) {
+        printf("Frame buffer allocation failed: %d\n", ret);
+        return ret;
+    }
+    ret = frame_processing_attach_buffers(&ctx->frame_ctx, nn_rgb, fr_rgb);
+    if (ret < 0) {
+        return ret;
+    }
     
     /* Background initialization - can be done while other systems start */
     Enhanced_PC_STREAM_Init();
-    app_postprocess_init(&ctx->pp_params);
+    perf_monitor_init();
+#ifdef APP_NPU_STALLS
+    npu_stall_monitor_init();
+#endif
     
-    return 0;
+    return app_register_stages(ctx);
 }
 
 /**
@@ -717,7 +510,7 @@ static void process_frame_detections(app_context_t *ctx, pd_pp_box_t *boxes, uin
             if (boxes[i].prob >= FACE_DETECTION_CONFIDENCE_THRESHOLD) {
                 printf("   Face %u: detection=%.1f%% -> ", i + 1, boxes[i].prob * 100.0f);
                 
-                float similarity = run_face_recognition_on_face(ctx, &boxes[i]);
+                float similarity = run_face_recognition_on_face(ctx, i);
                 
                 /* Update the box with the recognition similarity (not detection confidence) */
                 boxes[i].prob = similarity;
@@ -739,6 +532,7 @@ static void process_frame_detections(app_context_t *ctx, pd_pp_box_t *boxes, uin
                     /* Store for LCD display */
                     g_cropped_face_valid = true;
                     g_current_similarity = similarity;
+                    Display_CaptureFace(fr_rgb, FACE_RECOGNITION_WIDTH, FACE_RECOGNITION_HEIGHT);
                     
                     /* Store best embedding (copy from current_embedding set by run_face_recognition_on_face) */
                     for (uint32_t j = 0; j < EMBEDDING_SIZE; j++) {
@@ -754,6 +548,8 @@ static void process_frame_detections(app_context_t *ctx, pd_pp_box_t *boxes, uin
                 boxes[i].prob = 0.05f;
             }
         }
+        /* fr_rgb is reused by the next stage */
+        Display_Sync();
     }
     
     /* Update target detection history */
@@ -813,32 +609,14 @@ static void update_led_status(app_context_t *ctx)
     }
 }
 
-/**
- * @brief Clean up neural network output buffers
- * @param nn_out Array of neural network output buffers
- * @param nn_out_len Array of buffer lengths
- * @param number_output Number of outputs
- */
-static void cleanup_nn_buffers(float32_t **nn_out, int32_t *nn_out_len, int number_output)
-{
-    for (int i = 0; i < number_output; i++) {
-        SCB_InvalidateDCache_by_Addr(nn_out[i], nn_out_len[i]);
-    }
-}
-
-/**
- * @brief Main application loop
- * @param ctx Application context
- */
-/* Removed unused helper functions to fix compilation warnings */
-
-
 /* ========================================================================= */
 /* EDUCATIONAL FACE RECOGNITION PIPELINE                                    */
 /* ========================================================================= */
 /*
  * This pipeline demonstrates a complete face detection and recognition system
- * with multi-face tracking capability, broken down into clear stages:
+ * with multi-face tracking capability, broken down into clear stages. Stages
+ * 1-3 are the built-in stages of the frame processing engine
+ * (app_frame_processing.c); stages 4-6 are registered below by the application.
  *
  * PIPELINE OVERVIEW:
  * ┌─────────────────────────────────────────────────────────────────────────┐
@@ -876,115 +654,44 @@ static void cleanup_nn_buffers(float32_t **nn_out, int32_t *nn_out_len, int numb
 /* PIPELINE STAGE FUNCTIONS                                                 */
 /* ========================================================================= */
 
-/**
- * @brief Pipeline Stage 1: Frame Capture and Preprocessing
- * @param ctx Application context
- * @param pitch_nn Neural network pitch value
- * @return 0 on success, negative on error
- */
-static int pipeline_stage_capture_and_preprocess(app_context_t *ctx, uint32_t pitch_nn)
-{
-    printf("PIPELINE STAGE 1: Frame Capture\n");
-    
-    /* Step 1.1: Capture frame from camera or PC stream */
-    if (app_get_frame(nn_rgb, pitch_nn) != 0) {
-        printf("Frame capture failed\n");
-        return -1;
-    }
-    
 #ifdef DUMMY_INPUT_BUFFER
-    /* Step 1.1.5: Override both img_buffer and nn_rgb with dummy data for testing */
-    load_dual_dummy_buffers();
-#endif
-    
-    /* Step 1.2: Convert RGB to neural network input format */
-    printf("   Converting RGB to CHW format for neural network...\n");
-    img_rgb_to_chw_float(nn_rgb, (float32_t *)ctx->nn_ctx.detection_input_buffer, 
-                        NN_WIDTH * NN_BPP, NN_WIDTH, NN_HEIGHT);
-    
-
-
-    /* Step 1.3: Prepare data for neural network (cache management) */
-    printf("   🧠 Preparing %lu bytes for neural network input...\n", ctx->nn_ctx.detection_input_length);
-    SCB_CleanInvalidateDCache_by_Addr(ctx->nn_ctx.detection_input_buffer, 
-                                     ctx->nn_ctx.detection_input_length);
-    
-    printf("Frame captured and preprocessed (%dx%d -> %lu bytes)\n", 
-           NN_WIDTH, NN_HEIGHT, ctx->nn_ctx.detection_input_length);
-    return 0;
-}
-
 /**
- * @brief Pipeline Stage 2: Face Detection Neural Network
- * @param ctx Application context
- * @return 0 on success, negative on error
+ * @brief Pipeline Stage 1: Frame Capture with dummy buffer override
+ * @param frame_ctx Frame processing context
+ * @param user Application context
+ * @return Stage result, negative on error
  */
-static int pipeline_stage_face_detection(app_context_t *ctx)
+static int pipeline_stage_capture_dummy(frame_processing_context_t *frame_ctx, void *user)
 {
-    printf("🧠 PIPELINE STAGE 2: Face Detection Network\n");
-    
-    /* Step 2.1: Run face detection neural network */
-    printf("   Running face detection neural network inference...\n");
-    uint32_t start_time = HAL_GetTick();
-    RunNetworkSync(&NN_Instance_face_detection);
-    uint32_t inference_time = HAL_GetTick() - start_time;
-    
-    /* Step 2.2: Network cleanup */
-    printf("   🧹 Cleaning up neural network resources...\n");
-    LL_ATON_RT_DeInit_Network(&NN_Instance_face_detection);
-    
-    printf("Face detection completed in %lu ms (%d outputs ready)\n", 
-           inference_time, ctx->nn_ctx.detection_output_count);
-    return 0;
-}
+    (void)user;
 
-/**
- * @brief Pipeline Stage 3: Post-Processing and Face Extraction
- * @param ctx Application context
- * @return 0 on success, negative on error
- */
-static int pipeline_stage_postprocessing(app_context_t *ctx)
-{
-    printf("PIPELINE STAGE 3: Post-Processing\n");
-    
-    /* Step 3.1: Run post-processing to extract bounding boxes */
-    printf("   Processing %d neural network outputs...\n", ctx->nn_ctx.detection_output_count);
-    int32_t ret = app_postprocess_run((void **) ctx->nn_ctx.detection_output_buffers, 
-                                     ctx->nn_ctx.detection_output_count, 
-                                     &ctx->pp_output, &ctx->pp_params);
+    int ret = frame_processing_capture_stage(frame_ctx, NULL, NN_WIDTH, NN_HEIGHT);
     if (ret != 0) {
-        printf("Post-processing failed\n");
-        return -1;
-    }
-    
-    /* Step 3.2: Extract detected faces */
-    pd_pp_box_t *boxes = (pd_pp_box_t *)ctx->pp_output.pOutData;
-    printf("   Extracted %d face bounding boxes\n", ctx->pp_output.box_nb);
-    
-    /* Step 3.3: Log detection details for educational purposes */
-    for (uint32_t i = 0; i < ctx->pp_output.box_nb && i < 3; i++) {
-        printf("   Face %d: confidence=%.3f, center=(%.2f,%.2f), size=%.2fx%.2f\n", 
-               i + 1, boxes[i].prob, boxes[i].x_center, boxes[i].y_center, 
-               boxes[i].width, boxes[i].height);
+        return ret;
     }
     
-    printf("Post-processing completed: %d faces detected\n", ctx->pp_output.box_nb);
-    
-    return 0;
+    /* Override both img_buffer and nn_rgb with dummy data for testing */
+    load_dual_dummy_buffers();
+    return FRAME_STAGE_CONTINUE;
 }
+#endif /* DUMMY_INPUT_BUFFER */
 
 /**
  * @brief Pipeline Stage 4: Face Recognition and Verification
- * @param ctx Application context
- * @return 0 on success, negative on error
+ * @param frame_ctx Frame processing context
+ * @param user Application context
+ * @return Stage result, negative on error
  */
-static int pipeline_stage_face_recognition(app_context_t *ctx)
+static int pipeline_stage_face_recognition(frame_processing_context_t *frame_ctx, void *user)
 {
-    printf("PIPELINE STAGE 4: Face Recognition\n");
+    app_context_t *ctx = (app_context_t *)user;
+    
+    //HINT: for dummy input the first elements of frame_ctx->face_detection.buffers.output_buffers[0] should look like: {1.89764965, 1.77754533, 1.62140954, 1.64543045, 1.68146181, 1.68146181, 1.92167056...}
+    //HINT: for dummy input the pp_output.pOutData.x_center = 0.5113132 pp_output.pOutData.y_center = 0.543815017
     
     /* Step 4.1: Process all detected faces with recognition */
-    pd_pp_box_t *boxes = (pd_pp_box_t *)ctx->pp_output.pOutData;
-    process_frame_detections(ctx, boxes, ctx->pp_output.box_nb);
+    pd_pp_box_t *boxes = (pd_pp_box_t *)frame_ctx->face_detection.pp_output.pOutData;
+    process_frame_detections(ctx, boxes, frame_ctx->face_count);
     
     /* Step 4.2: Log recognition results */
     if (ctx->face_detected) {
@@ -996,17 +703,19 @@ static int pipeline_stage_face_recognition(app_context_t *ctx)
         printf("ℹ️ No faces above threshold detected\n");
     }
     
-    return 0;
+    return FRAME_STAGE_CONTINUE;
 }
 
 /**
  * @brief Pipeline Stage 5: System Status Update
- * @param ctx Application context
- * @return 0 on success, negative on error
+ * @param frame_ctx Frame processing context
+ * @param user Application context
+ * @return Stage result, negative on error
  */
-static int pipeline_stage_system_update(app_context_t *ctx)
+static int pipeline_stage_system_update(frame_processing_context_t *frame_ctx, void *user)
 {
-    printf("PIPELINE STAGE 5: System Status Update\n");
+    app_context_t *ctx = (app_context_t *)user;
+    (void)frame_ctx;
     
     /* Step 5.1: Update LED status based on recognition results */
     update_led_status(ctx);
@@ -1017,44 +726,94 @@ static int pipeline_stage_system_update(app_context_t *ctx)
     /* Step 5.3: Send heartbeat for PC communication */
     Enhanced_PC_STREAM_SendHeartbeat();
     
-    printf("System status updated\n");
-    return 0;
+    return FRAME_STAGE_CONTINUE;
 }
 
 /**
  * @brief Pipeline Stage 6: Output and Performance Metrics
- * @param ctx Application context
- * @param frame_start_time Start time of frame processing
- * @param boot_time System boot time
- * @return 0 on success, negative on error
+ * @param frame_ctx Frame processing context
+ * @param user Application context
+ * @return Stage result, negative on error
  */
-static int pipeline_stage_output_and_metrics(app_context_t *ctx, uint32_t frame_start_time, uint32_t boot_time)
+static int pipeline_stage_output_and_metrics(frame_processing_context_t *frame_ctx, void *user)
 {
-    printf("PIPELINE STAGE 6: Output and Metrics\n");
+    app_context_t *ctx = (app_context_t *)user;
+    pd_postprocess_out_t *pp_output = &frame_ctx->face_detection.pp_output;
     
     /* Step 6.1: Calculate performance metrics */
-    uint32_t frame_end_time = HAL_GetTick();
-    uint32_t total_frame_time = frame_end_time - frame_start_time;
+    const uint32_t now = frame_ctx->time_source();
+    uint32_t total_frame_time = now - frame_ctx->last_timing.timestamp;
     
     ctx->frame_count++;
-    ctx->performance.fps = 1000.0f / (total_frame_time + 1);
-    ctx->performance.inference_time_ms = total_frame_time;
+    ctx->performance.fps = (frame_ctx->stats.steady_fps > 0.0f) ? frame_ctx->stats.steady_fps :
+                           (total_frame_time > 0) ? 1000.0f / (float)total_frame_time : 0.0f;
+    ctx->performance.inference_time_ms = frame_ctx->face_detection.inference_time_ms;
     ctx->performance.frame_count = ctx->frame_count;
-    ctx->performance.detection_count = ctx->pp_output.box_nb;
+    ctx->performance.detection_count = pp_output->box_nb;
     
     /* Step 6.2: Display results */
-    app_output(&ctx->pp_output, total_frame_time, boot_time, ctx);
+    app_output(pp_output, total_frame_time, ctx->boot_time, frame_ctx->last_timing.capture_timestamp, ctx);
     
     /* Step 6.3: Clean up neural network buffers */
-    cleanup_nn_buffers(ctx->nn_ctx.detection_output_buffers, 
-                      ctx->nn_ctx.detection_output_lengths, 
-                      ctx->nn_ctx.detection_output_count);
+    frame_processing_output_stage(frame_ctx, &frame_ctx->last_timing);
     
     printf("Frame processing completed: %.1f FPS, %lu ms total\n", 
            ctx->performance.fps, total_frame_time);
+    printf("Camera-to-result: %lu ms, steady-state %.1f FPS, %lu frames dropped\n",
+           frame_ctx->time_source() - frame_ctx->last_timing.capture_timestamp,
+           frame_ctx->stats.steady_fps,
+           (frame_ctx->source != NULL) ? frame_ctx->source->frames_dropped : 0UL);
+
+    /* Step 6.4: Periodic stage/network/face timing summary for the host */
+    if (now - ctx->perf_export_time >= PERF_MONITOR_EXPORT_PERIOD_MS) {
+        static uint8_t summary[PERF_MONITOR_WIRE_HEADER_SIZE + PERF_PROBE_COUNT * PERF_MONITOR_WIRE_PROBE_SIZE];
+        uint32_t size = perf_monitor_serialize(summary, sizeof(summary), now);
+        Enhanced_PC_STREAM_SendPerfSummary(summary, size);
+        Display_PrintOverlayStats();
+#ifdef APP_EPOCH_PROFILE
+        static uint8_t profile[EPOCH_PROFILER_WIRE_HEADER_SIZE +
+                               EPOCH_PROFILER_MAX_BLOCKS * EPOCH_PROFILER_WIRE_BLOCK_SIZE];
+        for (int net = 0; net < EPOCH_PROFILER_NET_COUNT; net++) {
+            size = epoch_profiler_serialize((epoch_profiler_net_t)net, profile, sizeof(profile));
+            Enhanced_PC_STREAM_SendEpochProfile(profile, size);
+#ifdef APP_NPU_STALLS
+            _Static_assert(NPU_STALL_WIRE_HEADER_SIZE + NPU_POOL_COUNT * NPU_STALL_WIRE_POOL_SIZE +
+                           EPOCH_PROFILER_MAX_BLOCKS * NPU_STALL_WIRE_BLOCK_SIZE <= sizeof(profile),
+                           "stall report must fit the epoch profile buffer");
+            size = npu_stall_monitor_serialize((epoch_profiler_net_t)net, profile, sizeof(profile));
+            Enhanced_PC_STREAM_SendStallReport(profile, size);
+#endif
+        }
+#endif
+        ctx->perf_export_time = now;
+    }
     printf("═══════════════════════════════════════════════════════════\n");
     
-    return 0;
+    return FRAME_STAGE_CONTINUE;
+}
+
+/**
+ * @brief Register the application stages with the frame processing engine
+ * @param ctx Application context
+ * @return 0 on success, negative on error
+ */
+static int app_register_stages(app_context_t *ctx)
+{
+    frame_processing_context_t *frame_ctx = &ctx->frame_ctx;
+    int ret = 0;
+
+#ifdef DUMMY_INPUT_BUFFER
+    ret |= frame_processing_register_stage(frame_ctx, PIPELINE_STAGE_CAPTURE, "capture_dummy",
+                                           pipeline_stage_capture_dummy, ctx, 0);
+#endif
+    ret |= frame_processing_register_stage(frame_ctx, PIPELINE_STAGE_RECOGNITION, "recognition",
+                                           pipeline_stage_face_recognition, ctx, 0);
+    ret |= frame_processing_register_stage(frame_ctx, PIPELINE_STAGE_POSTPROCESSING, "system_update",
+                                           pipeline_stage_system_update, ctx, 0);
+    ret |= frame_processing_register_stage(frame_ctx, PIPELINE_STAGE_OUTPUT, "output",
+                                           pipeline_stage_output_and_metrics, ctx, 0);
+
+    return (ret == 0) ? 0 : -1;
 }
 
 /**
@@ -1065,7 +824,7 @@ static int pipeline_stage_output_and_metrics(app_context_t *ctx, uint32_t frame_
 static int app_main_loop(app_context_t *ctx)
 {
     /* Verify at least detection network is initialized */
-    if (!ctx->nn_ctx.detection_initialized) {
+    if (!ctx->frame_ctx.face_detection.is_initialized) {
         printf("Face detection network not initialized!\n");
         return -1;
     }
@@ -1078,50 +837,33 @@ static int app_main_loop(app_context_t *ctx)
     app_camera_init(&pitch_nn);
     app_display_init();
     app_input_start();
+    if (app_source_init(ctx, pitch_nn) < 0) {
+        printf("Capture source initialization failed\n");
+        return -1;
+    }
+    memory_pool_print_info(memory_pool_get_default());
     printf("Systems initialized, starting pipeline\n");
     printf("═══════════════════════════════════════════════════════════\n");
     
-    uint32_t boot_time = HAL_GetTick();
+    ctx->boot_time = HAL_GetTick();
 
-    /* Main processing loop with clear pipeline stages */
+    /* Main processing loop: the engine runs the stages in pipeline order */
     while (1) {
-        uint32_t frame_start_time = HAL_GetTick();
+        pipeline_timing_t timing;
         printf("STARTING FRAME %lu PROCESSING PIPELINE\n", ctx->frame_count + 1);
 
-        /* Stage 1: Frame Capture and Preprocessing */
-        if (pipeline_stage_capture_and_preprocess(ctx, pitch_nn) != 0) {
-            continue; /* Skip this frame on error */
+        int ret = frame_processing_process_frame(&ctx->frame_ctx, NULL, NN_WIDTH, NN_HEIGHT,
+                                                 &timing);
+        if (ret == FRAME_PROCESSING_END_OF_STREAM) {
+            printf("Capture source exhausted after %lu frames\n", ctx->frame_count);
+            frame_source_stop(&g_frame_source);
+            break;
         }
-        //HINT: for dummy input the first elements of (float32_t *)ctx->nn_ctx.detection_input_buffer should look like: {206, 209, 211, 212, 213, 213, 214, 214, 214, 214, 213 <repeats 14 times>, 212, 212, 211, 208, 207, 204, 199, 193, 189, 182, 174, 163, 151, 139, 129, 119, 110, 104, 104, 106, 108, 114, 121, 126, 132, 137, 140, 141, 147, 152, 152, 152, 153, 153, 154, 154, 154, 154, 153, 151, 152, 152, 151, 150, 149, 149, 147, 146, 142, 135, 126, 114, 107, 97, 87, 73, 60, 47, 32, 19, 12, 14, 19, 26, 32, 37, 42, 52, 60, 63, 67, 70, 70, 71, 72, 72}
-
-        /* Stage 2: Face Detection Neural Network */
-        if (pipeline_stage_face_detection(ctx) != 0) {
-            continue; /* Skip this frame on error */
-        }
-        
-        //HINT: for dummy input the first elements of ctx->nn_ctx.detection_output_buffers[0] should look like: {1.89764965, 1.77754533, 1.62140954, 1.64543045, 1.68146181, 1.68146181, 1.92167056...}
-
-        /* Stage 3: Post-Processing and Face Extraction */
-        if (pipeline_stage_postprocessing(ctx) != 0) {
-            continue; /* Skip this frame on error */
-        }
-        
-        //HINT: for dummy input the cctx->pp_output->pOutData.x_center = 0.5113132 ctx->pp_output->pOutData.y_center = 0.543815017
-
-        /* Stage 4: Face Recognition and Verification */
-        if (pipeline_stage_face_recognition(ctx) != 0) {
-            continue; /* Skip this frame on error */
-        }
-        
-        /* Stage 5: System Status Update */
-        if (pipeline_stage_system_update(ctx) != 0) {
-            continue; /* Skip this frame on error */
-        }
-        
-        /* Stage 6: Output and Performance Metrics */
-        if (pipeline_stage_output_and_metrics(ctx, frame_start_time, boot_time) != 0) {
+        if (ret != 0) {
+            printf("Frame processing failed: %d\n", ret);
             continue; /* Skip this frame on error */
         }
+        //HINT: for dummy input the first elements of (float32_t *)ctx->frame_ctx.face_detection.buffers.input_buffer should look like: {206, 209, 211, 212, 213, 213, 214, 214, 214, 214, 213 <repeats 14 times>, 212, 212, 211, 208, 207, 204, 199, 193, 189, 182, 174, 163, 151, 139, 129, 119, 110, 104, 104, 106, 108, 114, 121, 126, 132, 137, 140, 141, 147, 152, 152, 152, 153, 153, 154, 154, 154, 154, 153, 151, 152, 152, 151, 150, 149, 149, 147, 146, 142, 135, 126, 114, 107, 97, 87, 73, 60, 47, 32, 19, 12, 14, 19, 26, 32, 37, 42, 52, 60, 63, 67, 70, 70, 71, 72, 72}
     }
     
     return 0;
@@ -1150,11 +892,11 @@ int main(void)
     /* Start main application loop */
     ret = app_main_loop(&g_app_ctx);
     
-    /* Cleanup neural networks (never reached in normal operation) */
-    nn_cleanup(&g_app_ctx.nn_ctx);
+    /* Cleanup neural networks (reached when the capture source is exhausted) */
+    frame_processing_cleanup(&g_app_ctx.frame_ctx);
     
     (void)ret; /* Suppress unused variable warning */
-    return 0; /* Never reached */
+    return 0;
 }
 
 
@@ -0,0 +1,242 @@
+/**
+ ******************************************************************************
+ * @file    memory_planner.c
+ * @author  PeleAB
+ * @brief   Lifetime-based aliasing planner for application scratch buffers
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "memory_planner.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+#define MEMORY_PLAN_ALIGN_UP(v, a)      (((v) + ((a) - 1U)) & ~((a) - 1U))
+
+/* Entries are padded to whole cache lines so aliased buffers never share one */
+static uint32_t memory_plan_padded_size(const memory_plan_entry_t *entry)
+{
+    return MEMORY_PLAN_ALIGN_UP(entry->size, (uint32_t)CACHE_LINE_ALIGNMENT);
+}
+
+static bool memory_plan_lifetimes_overlap(const memory_plan_entry_t *a,
+                                          const memory_plan_entry_t *b)
+{
+    return a->first_stage <= b->last_stage && b->first_stage <= a->last_stage;
+}
+
+static bool memory_plan_ranges_overlap(const memory_plan_entry_t *a,
+                                       const memory_plan_entry_t *b)
+{
+    return a->offset < b->offset + memory_plan_padded_size(b) &&
+           b->offset < a->offset + memory_plan_padded_size(a);
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int memory_plan_init(memory_plan_t *plan)
+{
+    if (plan == NULL) {
+        return -1;
+    }
+
+    memset(plan, 0, sizeof(*plan));
+    return 0;
+}
+
+int memory_plan_add(memory_plan_t *plan, const char *name, uint32_t size,
+                    uint32_t alignment, uint32_t first_stage, uint32_t last_stage,
+                    void **bind)
+{
+    if (plan == NULL || size == 0 || first_stage > last_stage ||
+        (alignment & (alignment - 1U)) != 0) {
+        return -1;
+    }
+    if (plan->entry_count >= MEMORY_PLAN_MAX_ENTRIES) {
+        return -2;
+    }
+
+    memory_plan_entry_t *entry = &plan->entries[plan->entry_count++];
+    entry->name = (name != NULL) ? name : "?";
+    entry->size = size;
+    entry->alignment = (alignment < CACHE_LINE_ALIGNMENT) ? CACHE_LINE_ALIGNMENT : alignment;
+    entry->first_stage = first_stage;
+    entry->last_stage = last_stage;
+    entry->offset = 0;
+    entry->bind = bind;
+
+    plan->is_solved = false;
+    plan->base = NULL;
+    return 0;
+}
+
+uint32_t memory_plan_solve(memory_plan_t *plan)
+{
+    if (plan == NULL || plan->entry_count == 0) {
+        return 0;
+    }
+
+    /* Largest first, ties in declaration order */
+    uint32_t order[MEMORY_PLAN_MAX_ENTRIES];
+    for (uint32_t i = 0; i < plan->entry_count; i++) {
+        uint32_t j = i;
+        while (j > 0 && plan->entries[order[j - 1]].size < plan->entries[i].size) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    plan->arena_size = 0;
+    plan->unaliased_size = 0;
+    for (uint32_t n = 0; n < plan->entry_count; n++) {
+        memory_plan_entry_t *entry = &plan->entries[order[n]];
+        entry->offset = 0;
+
+        /* Bump past every placed buffer that is live at the same time */
+        bool moved = true;
+        while (moved) {
+            moved = false;
+            for (uint32_t p = 0; p < n; p++) {
+                const memory_plan_entry_t *placed = &plan->entries[order[p]];
+                if (memory_plan_lifetimes_overlap(entry, placed) &&
+                    memory_plan_ranges_overlap(entry, placed)) {
+                    entry->offset = MEMORY_PLAN_ALIGN_UP(placed->offset + memory_plan_padded_size(placed),
+                                                         entry->alignment);
+                    moved = true;
+                }
+            }
+        }
+
+        uint32_t end = entry->offset + memory_plan_padded_size(entry);
+        if (end > plan->arena_size) {
+            plan->arena_size = end;
+        }
+        plan->unaliased_size += memory_plan_padded_size(entry);
+    }
+
+    plan->is_solved = true;
+    return plan->arena_size;
+}
+
+int memory_plan_bind(memory_plan_t *plan, void *base, uint32_t size)
+{
+    if (plan == NULL || base == NULL || !plan->is_solved) {
+        return -1;
+    }
+    if (size < plan->arena_size) {
+        return -2;
+    }
+
+#ifndef NDEBUG
+    if (!memory_plan_verify(plan)) {
+        return -3;
+    }
+#endif
+
+    plan->base = (uint8_t *)base;
+    for (uint32_t i = 0; i < plan->entry_count; i++) {
+        memory_plan_entry_t *entry = &plan->entries[i];
+        if ((((uintptr_t)base + entry->offset) & (entry->alignment - 1U)) != 0) {
+            return -4;
+        }
+        if (entry->bind != NULL) {
+            *entry->bind = plan->base + entry->offset;
+        }
+    }
+    return 0;
+}
+
+int memory_plan_allocate(memory_plan_t *plan, memory_pool_t *pool,
+                         memory_region_t region, const char *name)
+{
+    if (plan == NULL || pool == NULL) {
+        return -1;
+    }
+
+    uint32_t size = memory_plan_solve(plan);
+    if (size == 0) {
+        return -1;
+    }
+
+    uint32_t alignment = CACHE_LINE_ALIGNMENT;
+    for (uint32_t i = 0; i < plan->entry_count; i++) {
+        if (plan->entries[i].alignment > alignment) {
+            alignment = plan->entries[i].alignment;
+        }
+    }
+
+    void *arena = memory_pool_alloc_region(pool, region, size, alignment,
+                                           MEMORY_BUFFER_TYPE_TEMPORARY, name);
+    if (arena == NULL) {
+        return -2;
+    }
+
+    int ret = memory_plan_bind(plan, arena, size);
+    if (ret < 0) {
+        memory_pool_free(pool, arena);
+    }
+    return ret;
+}
+
+bool memory_plan_verify(const memory_plan_t *plan)
+{
+    if (plan == NULL || !plan->is_solved) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < plan->entry_count; i++) {
+        const memory_plan_entry_t *a = &plan->entries[i];
+        if ((a->offset & (a->alignment - 1U)) != 0 ||
+            a->offset + memory_plan_padded_size(a) > plan->arena_size) {
+            return false;
+        }
+        for (uint32_t j = i + 1; j < plan->entry_count; j++) {
+            const memory_plan_entry_t *b = &plan->entries[j];
+            if (memory_plan_lifetimes_overlap(a, b) && memory_plan_ranges_overlap(a, b)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void memory_plan_print(const memory_plan_t *plan)
+{
+    if (plan == NULL) {
+        return;
+    }
+
+    printf("=== Scratch Memory Plan ===\n");
+    for (uint32_t i = 0; i < plan->entry_count; i++) {
+        const memory_plan_entry_t *entry = &plan->entries[i];
+        printf("  %-16s +0x%06lX %7lu bytes  stages %lu..%lu",
+               entry->name, (unsigned long)entry->offset, (unsigned long)entry->size,
+               (unsigned long)entry->first_stage, (unsigned long)entry->last_stage);
+        for (uint32_t j = 0; j < plan->entry_count; j++) {
+            if (j != i && !memory_plan_lifetimes_overlap(entry, &plan->entries[j]) &&
+                memory_plan_ranges_overlap(entry, &plan->entries[j])) {
+                printf("  aliases %s", plan->entries[j].name);
+            }
+        }
+        printf("\n");
+    }
+    printf("Arena: %lu bytes (%lu without aliasing, %lu saved)\n",
+           (unsigned long)plan->arena_size, (unsigned long)plan->unaliased_size,
+           (unsigned long)(plan->unaliased_size - plan->arena_size));
+}
@@ -0,0 +1,659 @@
+/**
+ ******************************************************************************
+ * @file    memory_pool.c
+ * @author  PeleAB
+ * @brief   Typed static arena allocator with cache maintenance integration
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "memory_pool.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#else
+#include "host_platform.h"
+#endif
+
+/* ========================================================================= */
+/* PRIVATE CONSTANTS AND MACROS                                              */
+/* ========================================================================= */
+
+#define MEMORY_POOL_ALIGN_UP(v, a)      (((v) + ((a) - 1U)) & ~((uintptr_t)(a) - 1U))
+#define MEMORY_POOL_ALIGN_DOWN(v, a)    ((v) & ~((uintptr_t)(a) - 1U))
+
+#ifndef APP_HOST_BUILD
+#define MEMORY_POOL_GET_TICK()          HAL_GetTick()
+#else
+#define MEMORY_POOL_GET_TICK()          host_get_tick_ms()
+#endif
+
+/* ========================================================================= */
+/* STATIC ARENAS                                                             */
+/* ========================================================================= */
+
+#ifndef APP_HOST_BUILD
+__attribute__ ((aligned (CACHE_LINE_ALIGNMENT)))
+static uint8_t s_axisram_arena[MEMORY_POOL_AXISRAM_SIZE];
+
+__attribute__ ((section (".psram_bss")))
+__attribute__ ((aligned (CACHE_LINE_ALIGNMENT)))
+static uint8_t s_psram_arena[MEMORY_POOL_PSRAM_SIZE];
+
+/* Placed by the linker in the part of AXISRAM6 neither network uses */
+__attribute__ ((section (".npuram_bss")))
+__attribute__ ((aligned (CACHE_LINE_ALIGNMENT)))
+static uint8_t s_npuram_arena[MEMORY_POOL_NPURAM_SIZE];
+#else
+static uint8_t s_axisram_arena[MEMORY_POOL_AXISRAM_SIZE] __attribute__ ((aligned (CACHE_LINE_ALIGNMENT)));
+static uint8_t s_psram_arena[MEMORY_POOL_PSRAM_SIZE] __attribute__ ((aligned (CACHE_LINE_ALIGNMENT)));
+static uint8_t s_npuram_arena[MEMORY_POOL_NPURAM_SIZE] __attribute__ ((aligned (CACHE_LINE_ALIGNMENT)));
+#endif
+
+static memory_pool_t s_default_pool;
+
+static const char *const s_region_names[MEMORY_REGION_COUNT] = {
+    [MEMORY_REGION_AXISRAM] = "AXISRAM",
+    [MEMORY_REGION_PSRAM]   = "PSRAM",
+    [MEMORY_REGION_NPURAM]  = "NPURAM",
+};
+
+/* Default placement per buffer type: hot CPU buffers stay internal */
+static const memory_region_t s_type_regions[MEMORY_BUFFER_TYPE_COUNT] = {
+    [MEMORY_BUFFER_TYPE_NN_INPUT]       = MEMORY_REGION_PSRAM,
+    [MEMORY_BUFFER_TYPE_NN_OUTPUT]      = MEMORY_REGION_NPURAM,
+    [MEMORY_BUFFER_TYPE_FRAME_CAPTURE]  = MEMORY_REGION_PSRAM,
+    [MEMORY_BUFFER_TYPE_PREPROCESSING]  = MEMORY_REGION_AXISRAM,
+    [MEMORY_BUFFER_TYPE_POSTPROCESSING] = MEMORY_REGION_AXISRAM,
+    [MEMORY_BUFFER_TYPE_TRACKING]       = MEMORY_REGION_AXISRAM,
+    [MEMORY_BUFFER_TYPE_PROTOCOL]       = MEMORY_REGION_PSRAM,
+    [MEMORY_BUFFER_TYPE_TEMPORARY]      = MEMORY_REGION_AXISRAM,
+};
+
+/* ========================================================================= */
+/* CACHE BACKEND                                                             */
+/* ========================================================================= */
+
+static void memory_pool_dcache_clean(uintptr_t addr, uint32_t size)
+{
+#ifndef APP_HOST_BUILD
+    SCB_CleanDCache_by_Addr((void *)addr, (int32_t)size);
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+static void memory_pool_dcache_invalidate(uintptr_t addr, uint32_t size)
+{
+#ifndef APP_HOST_BUILD
+    SCB_InvalidateDCache_by_Addr((void *)addr, (int32_t)size);
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+static void memory_pool_dcache_clean_invalidate(uintptr_t addr, uint32_t size)
+{
+#ifndef APP_HOST_BUILD
+    SCB_CleanInvalidateDCache_by_Addr((void *)addr, (int32_t)size);
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static bool memory_pool_is_power_of_two(size_t value)
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+/**
+ * @brief Find the allocated buffer containing [addr, addr + size)
+ */
+static memory_buffer_t *memory_pool_find_containing(memory_pool_t *pool,
+                                                    uintptr_t addr, size_t size)
+{
+    for (uint32_t i = 0; i < pool->buffer_count; i++) {
+        memory_buffer_t *buf = &pool->buffers[i];
+        uintptr_t start = (uintptr_t)buf->ptr;
+        if (addr >= start && addr + size <= start + buf->size) {
+            return buf;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief First-fit search for an aligned gap in a region
+ * @return Aligned start address, or 0 if no gap fits
+ */
+static uintptr_t memory_pool_find_gap(const memory_pool_t *pool, memory_region_t region,
+                                      size_t size, size_t alignment)
+{
+    const memory_arena_t *arena = &pool->arenas[region];
+    const uintptr_t arena_end = (uintptr_t)arena->base + arena->size;
+    uintptr_t candidate = MEMORY_POOL_ALIGN_UP((uintptr_t)arena->base, alignment);
+
+    while (candidate + size <= arena_end) {
+        bool moved = false;
+        for (uint32_t i = 0; i < pool->buffer_count; i++) {
+            const memory_buffer_t *buf = &pool->buffers[i];
+            uintptr_t start = (uintptr_t)buf->ptr;
+            uintptr_t end = start + buf->size;
+            if (buf->region == region && candidate < end && start < candidate + size) {
+                candidate = MEMORY_POOL_ALIGN_UP(end, alignment);
+                moved = true;
+            }
+        }
+        if (!moved) {
+            return candidate;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Largest contiguous free block of a region
+ */
+static uint32_t memory_pool_largest_gap(const memory_pool_t *pool, memory_region_t region)
+{
+    const memory_arena_t *arena = &pool->arenas[region];
+    uintptr_t cursor = (uintptr_t)arena->base;
+    const uintptr_t arena_end = cursor + arena->size;
+    uint32_t largest = 0;
+
+    /* Walk the buffers of this region in address order */
+    while (cursor < arena_end) {
+        uintptr_t next_start = arena_end;
+        uintptr_t next_end = arena_end;
+        for (uint32_t i = 0; i < pool->buffer_count; i++) {
+            const memory_buffer_t *buf = &pool->buffers[i];
+            uintptr_t start = (uintptr_t)buf->ptr;
+            if (buf->region == region && start >= cursor && start < next_start) {
+                next_start = start;
+                next_end = start + buf->size;
+            }
+        }
+        if (next_start - cursor > largest) {
+            largest = (uint32_t)(next_start - cursor);
+        }
+        cursor = next_end;
+    }
+    return largest;
+}
+
+static void memory_pool_touch(memory_buffer_t *buf)
+{
+    buf->access_count++;
+    buf->last_access_time = MEMORY_POOL_GET_TICK();
+}
+
+typedef enum {
+    MEMORY_CACHE_CLEAN,
+    MEMORY_CACHE_INVALIDATE,
+    MEMORY_CACHE_CLEAN_INVALIDATE,
+} memory_cache_op_t;
+
+/**
+ * @brief Apply a cache operation to a line-widened range inside one buffer
+ */
+static int memory_pool_cache_op(memory_pool_t *pool, void *ptr, size_t size,
+                                bool whole_buffer, memory_cache_op_t op)
+{
+    if (pool == NULL || ptr == NULL) {
+        return -1;
+    }
+
+    memory_buffer_t *buf = memory_pool_find_containing(pool, (uintptr_t)ptr,
+                                                       whole_buffer ? 1 : size);
+    if (buf == NULL || (whole_buffer && buf->ptr != ptr)) {
+        return -2;
+    }
+
+    memory_pool_touch(buf);
+    if (!buf->is_cached) {
+        return 0;
+    }
+
+    uintptr_t start = whole_buffer ? (uintptr_t)buf->ptr : (uintptr_t)ptr;
+    uintptr_t end = start + (whole_buffer ? buf->size : size);
+    start = MEMORY_POOL_ALIGN_DOWN(start, CACHE_LINE_ALIGNMENT);
+    end = MEMORY_POOL_ALIGN_UP(end, CACHE_LINE_ALIGNMENT);
+    if (end == start) {
+        return 0;
+    }
+
+    switch (op) {
+    case MEMORY_CACHE_CLEAN:
+        memory_pool_dcache_clean(start, (uint32_t)(end - start));
+        pool->cache_clean_ops++;
+        break;
+    case MEMORY_CACHE_INVALIDATE:
+        memory_pool_dcache_invalidate(start, (uint32_t)(end - start));
+        pool->cache_invalidate_ops++;
+        break;
+    default:
+        memory_pool_dcache_clean_invalidate(start, (uint32_t)(end - start));
+        pool->cache_clean_ops++;
+        pool->cache_invalidate_ops++;
+        break;
+    }
+    return 0;
+}
+
+/* ========================================================================= */
+/* INITIALIZATION                                                            */
+/* ========================================================================= */
+
+int memory_pool_init(memory_pool_t *pool)
+{
+    if (pool == NULL) {
+        return -1;
+    }
+
+    memset(pool, 0, sizeof(*pool));
+    for (int r = 0; r < MEMORY_REGION_COUNT; r++) {
+        pool->arenas[r].name = s_region_names[r];
+    }
+    pool->is_initialized = true;
+    return 0;
+}
+
+int memory_pool_add_region(memory_pool_t *pool, memory_region_t region,
+                           void *base, uint32_t size, bool cached)
+{
+    if (pool == NULL || !pool->is_initialized || region >= MEMORY_REGION_COUNT || base == NULL) {
+        return -1;
+    }
+    if (pool->arenas[region].size != 0) {
+        return -2;
+    }
+
+    uintptr_t start = MEMORY_POOL_ALIGN_UP((uintptr_t)base, CACHE_LINE_ALIGNMENT);
+    uintptr_t end = MEMORY_POOL_ALIGN_DOWN((uintptr_t)base + size, CACHE_LINE_ALIGNMENT);
+    if (end <= start) {
+        return -3;
+    }
+
+    memory_arena_t *arena = &pool->arenas[region];
+    arena->base = (uint8_t *)start;
+    arena->size = (uint32_t)(end - start);
+    arena->cached = cached;
+    arena->used = 0;
+    arena->peak = 0;
+    return 0;
+}
+
+memory_pool_t *memory_pool_get_default(void)
+{
+    if (!s_default_pool.is_initialized) {
+        memory_pool_init(&s_default_pool);
+        memory_pool_add_region(&s_default_pool, MEMORY_REGION_AXISRAM,
+                               s_axisram_arena, sizeof(s_axisram_arena), true);
+        memory_pool_add_region(&s_default_pool, MEMORY_REGION_PSRAM,
+                               s_psram_arena, sizeof(s_psram_arena), true);
+        memory_pool_add_region(&s_default_pool, MEMORY_REGION_NPURAM,
+                               s_npuram_arena, sizeof(s_npuram_arena), true);
+    }
+    return &s_default_pool;
+}
+
+memory_region_t memory_pool_default_region(memory_buffer_type_t type)
+{
+    return (type < MEMORY_BUFFER_TYPE_COUNT) ? s_type_regions[type] : MEMORY_REGION_AXISRAM;
+}
+
+/* ========================================================================= */
+/* ALLOCATION                                                                */
+/* ========================================================================= */
+
+void *memory_pool_alloc(memory_pool_t *pool, size_t size, size_t alignment,
+                        memory_buffer_type_t type, const char *name)
+{
+    return memory_pool_alloc_region(pool, memory_pool_default_region(type),
+                                    size, alignment, type, name);
+}
+
+void *memory_pool_alloc_region(memory_pool_t *pool, memory_region_t region,
+                               size_t size, size_t alignment,
+                               memory_buffer_type_t type, const char *name)
+{
+    if (pool == NULL || !pool->is_initialized) {
+        return NULL;
+    }
+    if (region >= MEMORY_REGION_COUNT || type >= MEMORY_BUFFER_TYPE_COUNT || size == 0 ||
+        (alignment != 0 && !memory_pool_is_power_of_two(alignment))) {
+        pool->allocation_failures++;
+        return NULL;
+    }
+
+    memory_arena_t *arena = &pool->arenas[region];
+    if (arena->size == 0 || pool->buffer_count >= MEMORY_POOL_MAX_BUFFERS) {
+        pool->allocation_failures++;
+        return NULL;
+    }
+
+    /* Cached buffers own whole cache lines so maintenance stays range-exact */
+    if (alignment < CACHE_LINE_ALIGNMENT && arena->cached) {
+        alignment = CACHE_LINE_ALIGNMENT;
+    }
+    if (alignment == 0) {
+        alignment = sizeof(uint32_t);
+    }
+    size_t padded = arena->cached ? MEMORY_POOL_ALIGN_UP(size, CACHE_LINE_ALIGNMENT)
+                                  : MEMORY_POOL_ALIGN_UP(size, sizeof(uint32_t));
+
+    uintptr_t addr = memory_pool_find_gap(pool, region, padded, alignment);
+    if (addr == 0) {
+        pool->allocation_failures++;
+        return NULL;
+    }
+
+    memory_buffer_t *buf = &pool->buffers[pool->buffer_count++];
+    memset(buf, 0, sizeof(*buf));
+    buf->ptr = (void *)addr;
+    buf->size = padded;
+    buf->alignment = alignment;
+    buf->type = type;
+    buf->region = region;
+    buf->is_allocated = true;
+    buf->is_cached = arena->cached;
+    buf->last_access_time = MEMORY_POOL_GET_TICK();
+    if (name != NULL) {
+        strncpy(buf->name, name, MEMORY_POOL_NAME_LENGTH - 1);
+    }
+
+    arena->used += (uint32_t)padded;
+    if (arena->used > arena->peak) {
+        arena->peak = arena->used;
+    }
+    pool->total_allocated += (uint32_t)padded;
+    if (pool->total_allocated > pool->peak_allocated) {
+        pool->peak_allocated = pool->total_allocated;
+    }
+    pool->allocation_count++;
+
+    return buf->ptr;
+}
+
+int memory_pool_free(memory_pool_t *pool, void *ptr)
+{
+    if (pool == NULL || ptr == NULL) {
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < pool->buffer_count; i++) {
+        memory_buffer_t *buf = &pool->buffers[i];
+        if (buf->ptr != ptr) {
+            continue;
+        }
+
+        pool->arenas[buf->region].used -= (uint32_t)buf->size;
+        pool->total_allocated -= (uint32_t)buf->size;
+        pool->deallocation_count++;
+
+        /* Keep the table dense; the gap is reusable immediately */
+        pool->buffers[i] = pool->buffers[--pool->buffer_count];
+        memset(&pool->buffers[pool->buffer_count], 0, sizeof(memory_buffer_t));
+        return 0;
+    }
+    return -2;
+}
+
+memory_buffer_t *memory_pool_get_buffer(memory_pool_t *pool, void *ptr)
+{
+    if (pool == NULL || ptr == NULL) {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < pool->buffer_count; i++) {
+        if (pool->buffers[i].ptr == ptr) {
+            return &pool->buffers[i];
+        }
+    }
+    return NULL;
+}
+
+memory_buffer_t *memory_pool_get_buffer_by_name(memory_pool_t *pool, const char *name)
+{
+    if (pool == NULL || name == NULL) {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < pool->buffer_count; i++) {
+        if (strncmp(pool->buffers[i].name, name, MEMORY_POOL_NAME_LENGTH) == 0) {
+            return &pool->buffers[i];
+        }
+    }
+    return NULL;
+}
+
+/* ========================================================================= */
+/* CACHE MAINTENANCE                                                         */
+/* ========================================================================= */
+
+int memory_pool_clean_cache(memory_pool_t *pool, void *ptr)
+{
+    return memory_pool_cache_op(pool, ptr, 0, true, MEMORY_CACHE_CLEAN);
+}
+
+int memory_pool_invalidate_cache(memory_pool_t *pool, void *ptr)
+{
+    return memory_pool_cache_op(pool, ptr, 0, true, MEMORY_CACHE_INVALIDATE);
+}
+
+int memory_pool_clean_invalidate_cache(memory_pool_t *pool, void *ptr)
+{
+    return memory_pool_cache_op(pool, ptr, 0, true, MEMORY_CACHE_CLEAN_INVALIDATE);
+}
+
+int memory_pool_clean_range(memory_pool_t *pool, void *ptr, size_t size)
+{
+    return memory_pool_cache_op(pool, ptr, size, false, MEMORY_CACHE_CLEAN);
+}
+
+int memory_pool_invalidate_range(memory_pool_t *pool, void *ptr, size_t size)
+{
+    return memory_pool_cache_op(pool, ptr, size, false, MEMORY_CACHE_INVALIDATE);
+}
+
+int memory_pool_clean_invalidate_range(memory_pool_t *pool, void *ptr, size_t size)
+{
+    return memory_pool_cache_op(pool, ptr, size, false, MEMORY_CACHE_CLEAN_INVALIDATE);
+}
+
+/* ========================================================================= */
+/* STATISTICS AND DIAGNOSTICS                                                */
+/* ========================================================================= */
+
+int memory_pool_get_region_statistics(memory_pool_t *pool, memory_region_t region,
+                                      memory_statistics_t *stats)
+{
+    if (pool == NULL || stats == NULL || region >= MEMORY_REGION_COUNT) {
+        return -1;
+    }
+
+    const memory_arena_t *arena = &pool->arenas[region];
+    memset(stats, 0, sizeof(*stats));
+    stats->total_memory = arena->size;
+    stats->used_memory = arena->used;
+    stats->peak_memory = arena->peak;
+    stats->free_memory = arena->size - arena->used;
+    stats->largest_free_block = (arena->size != 0) ? memory_pool_largest_gap(pool, region) : 0;
+    if (stats->free_memory > 0) {
+        stats->fragmentation_percent =
+            100U - (uint32_t)(((uint64_t)stats->largest_free_block * 100U) / stats->free_memory);
+    }
+    stats->allocation_count = pool->allocation_count;
+    stats->deallocation_count = pool->deallocation_count;
+    return 0;
+}
+
+int memory_pool_get_statistics(memory_pool_t *pool, memory_statistics_t *stats)
+{
+    if (pool == NULL || stats == NULL) {
+        return -1;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    for (int r = 0; r < MEMORY_REGION_COUNT; r++) {
+        memory_statistics_t region_stats;
+        memory_pool_get_region_statistics(pool, (memory_region_t)r, &region_stats);
+        stats->total_memory += region_stats.total_memory;
+        stats->used_memory += region_stats.used_memory;
+        stats->free_memory += region_stats.free_memory;
+        if (region_stats.largest_free_block > stats->largest_free_block) {
+            stats->largest_free_block = region_stats.largest_free_block;
+        }
+    }
+    stats->peak_memory = pool->peak_allocated;
+
+    /* Weighted over regions: free bytes outside each region's largest gap */
+    uint32_t stranded = 0;
+    for (int r = 0; r < MEMORY_REGION_COUNT; r++) {
+        const memory_arena_t *arena = &pool->arenas[r];
+        if (arena->size != 0) {
+            stranded += (arena->size - arena->used) - memory_pool_largest_gap(pool, (memory_region_t)r);
+        }
+    }
+    if (stats->free_memory > 0) {
+        stats->fragmentation_percent = (uint32_t)(((uint64_t)stranded * 100U) / stats->free_memory);
+    }
+    stats->allocation_count = pool->allocation_count;
+    stats->deallocation_count = pool->deallocation_count;
+    return 0;
+}
+
+void memory_pool_print_info(memory_pool_t *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+
+    printf("=== Memory Pool ===\n");
+    for (int r = 0; r < MEMORY_REGION_COUNT; r++) {
+        const memory_arena_t *arena = &pool->arenas[r];
+        if (arena->size == 0) {
+            continue;
+        }
+        printf("%-8s base=0x%08lX size=%lu used=%lu peak=%lu%s\n",
+               arena->name, (unsigned long)(uintptr_t)arena->base,
+               (unsigned long)arena->size, (unsigned long)arena->used,
+               (unsigned long)arena->peak, arena->cached ? " cached" : "");
+        for (uint32_t i = 0; i < pool->buffer_count; i++) {
+            const memory_buffer_t *buf = &pool->buffers[i];
+            if (buf->region != (memory_region_t)r) {
+                continue;
+            }
+            printf("  %-20s +0x%06lX %7lu bytes align=%lu\n", buf->name,
+                   (unsigned long)((uintptr_t)buf->ptr - (uintptr_t)arena->base),
+                   (unsigned long)buf->size, (unsigned long)buf->alignment);
+        }
+    }
+    printf("Total: %lu bytes, peak %lu, failures %lu\n",
+           (unsigned long)pool->total_allocated, (unsigned long)pool->peak_allocated,
+           (unsigned long)pool->allocation_failures);
+}
+
+int memory_pool_sort_buffers(memory_pool_t *pool)
+{
+    if (pool == NULL) {
+        return -1;
+    }
+
+    /* Insertion sort by (region, address); the table holds at most 16 entries */
+    for (uint32_t i = 1; i < pool->buffer_count; i++) {
+        memory_buffer_t key = pool->buffers[i];
+        uint32_t j = i;
+        while (j > 0 && (pool->buffers[j - 1].region > key.region ||
+                         (pool->buffers[j - 1].region == key.region &&
+                          (uintptr_t)pool->buffers[j - 1].ptr > (uintptr_t)key.ptr))) {
+            pool->buffers[j] = pool->buffers[j - 1];
+            j--;
+        }
+        pool->buffers[j] = key;
+    }
+    return 0;
+}
+
+bool memory_pool_validate(memory_pool_t *pool)
+{
+    if (pool == NULL || !pool->is_initialized || pool->buffer_count > MEMORY_POOL_MAX_BUFFERS) {
+        return false;
+    }
+
+    uint32_t total = 0;
+    uint32_t used[MEMORY_REGION_COUNT] = {0};
+    for (uint32_t i = 0; i < pool->buffer_count; i++) {
+        const memory_buffer_t *buf = &pool->buffers[i];
+        if (!buf->is_allocated || buf->region >= MEMORY_REGION_COUNT) {
+            return false;
+        }
+
+        const memory_arena_t *arena = &pool->arenas[buf->region];
+        uintptr_t start = (uintptr_t)buf->ptr;
+        if (start < (uintptr_t)arena->base || start + buf->size > (uintptr_t)arena->base + arena->size) {
+            return false;
+        }
+        if ((start & (buf->alignment - 1)) != 0) {
+            return false;
+        }
+        if (buf->is_cached && ((start | buf->size) & (CACHE_LINE_ALIGNMENT - 1)) != 0) {
+            return false;
+        }
+        for (uint32_t j = i + 1; j < pool->buffer_count; j++) {
+            uintptr_t other = (uintptr_t)pool->buffers[j].ptr;
+            if (start < other + pool->buffers[j].size && other < start + buf->size) {
+                return false;
+            }
+        }
+        used[buf->region] += (uint32_t)buf->size;
+        total += (uint32_t)buf->size;
+    }
+
+    for (int r = 0; r < MEMORY_REGION_COUNT; r++) {
+        if (used[r] != pool->arenas[r].used) {
+            return false;
+        }
+    }
+    return total == pool->total_allocated;
+}
+
+int memory_pool_reset(memory_pool_t *pool)
+{
+    if (pool == NULL || !pool->is_initialized) {
+        return -1;
+    }
+
+    memset(pool->buffers, 0, sizeof(pool->buffers));
+    pool->buffer_count = 0;
+    pool->total_allocated = 0;
+    pool->peak_allocated = 0;
+    pool->allocation_failures = 0;
+    pool->allocation_count = 0;
+    pool->deallocation_count = 0;
+    pool->cache_clean_ops = 0;
+    pool->cache_invalidate_ops = 0;
+    for (int r = 0; r < MEMORY_REGION_COUNT; r++) {
+        pool->arenas[r].used = 0;
+        pool->arenas[r].peak = 0;
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+/**
+ ******************************************************************************
+ * @file    model_image.c
+ * @author  PeleAB
+ * @brief   Header checks of relocatable network images stored in flash slots
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "model_image.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+/* Header words: bin_hdr, sec_info, then net_entries */
+enum {
+    HDR_MAGIC = 0,
+    HDR_FLAGS,
+    HDR_DATA_START,
+    HDR_DATA_END,
+    HDR_DATA_DATA,
+    HDR_BSS_START,
+    HDR_BSS_END,
+    HDR_GOT_START,
+    HDR_GOT_END,
+    HDR_REL_START,
+    HDR_REL_END,
+    HDR_PARAMS_START,
+    HDR_PARAMS_OFFSET,
+    HDR_VEC_CTX = 23,
+};
+
+/* ai_reloc_rt_ctx words read before installation */
+enum {
+    CTX_C_NAME = 5,
+    CTX_ACTS_SZ,
+    CTX_PARAMS_SZ,
+    CTX_EXT_RAM_SZ,
+    CTX_RT_VERSION_DESC,
+    CTX_RT_VERSION,
+};
+
+#define MODEL_IMAGE_POOL_DESC_SIZE      20U     /* name, flags, foff, dst, size */
+#define MODEL_IMAGE_OFFSET(v)           ((v) & 0x0FFFFFFFUL)
+#define MODEL_IMAGE_IN_RAM(v)           (((v) & 0xF0000000UL) == 0x40000000UL)
+#define MODEL_IMAGE_ROUND_UP(v)         (((v) + 7U) & ~7U)
+
+/* Images are little-endian like the target; read unaligned-safe */
+static uint32_t model_image_word(const uint8_t *image, uint32_t offset)
+{
+    uint32_t value;
+    memcpy(&value, image + offset, sizeof(value));
+    return value;
+}
+
+static bool model_image_fits(uint32_t offset, uint32_t length, uint32_t size)
+{
+    return offset <= size && length <= size - offset;
+}
+
+static uint32_t model_image_max(uint32_t a, uint32_t b)
+{
+    return (a > b) ? a : b;
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int model_image_parse(const uint8_t *image, uint32_t size, model_image_info_t *info)
+{
+    uint32_t hdr[HDR_VEC_CTX + 1];
+
+    if (image == NULL || info == NULL || ((uintptr_t)image & 0x3U) != 0) {
+        return MODEL_IMAGE_ERR_ARG;
+    }
+    memset(info, 0, sizeof(*info));
+    if (size < MODEL_IMAGE_HEADER_SIZE) {
+        return MODEL_IMAGE_ERR_LAYOUT;
+    }
+    for (uint32_t i = 0; i <= HDR_VEC_CTX; i++) {
+        hdr[i] = model_image_word(image, i * 4U);
+    }
+    if (hdr[HDR_MAGIC] != MODEL_IMAGE_MAGIC) {
+        return MODEL_IMAGE_ERR_MAGIC;
+    }
+
+    /* The data section (data, got) is stored at data_data; bss only exists in RAM */
+    const uint32_t data_data = MODEL_IMAGE_OFFSET(hdr[HDR_DATA_DATA]);
+    const uint32_t bss_start = MODEL_IMAGE_OFFSET(hdr[HDR_BSS_START]);
+    const uint32_t bss_end = MODEL_IMAGE_OFFSET(hdr[HDR_BSS_END]);
+    const uint32_t rel_start = MODEL_IMAGE_OFFSET(hdr[HDR_REL_START]);
+    const uint32_t rel_end = MODEL_IMAGE_OFFSET(hdr[HDR_REL_END]);
+    const uint32_t ctx = MODEL_IMAGE_OFFSET(hdr[HDR_VEC_CTX]);
+
+    if (data_data < MODEL_IMAGE_HEADER_SIZE || bss_start > bss_end ||
+        MODEL_IMAGE_OFFSET(hdr[HDR_DATA_END]) > bss_start ||
+        MODEL_IMAGE_OFFSET(hdr[HDR_GOT_END]) > bss_start ||
+        !model_image_fits(data_data, bss_start, size) ||
+        rel_start > rel_end || rel_end > size ||
+        !model_image_fits(ctx, MODEL_IMAGE_CTX_SIZE, bss_start)) {
+        return MODEL_IMAGE_ERR_LAYOUT;
+    }
+
+    const uint32_t ctx_offset = data_data + ctx;
+    const uint32_t c_name = MODEL_IMAGE_OFFSET(model_image_word(image, ctx_offset + CTX_C_NAME * 4U));
+    if (c_name >= size) {
+        return MODEL_IMAGE_ERR_LAYOUT;
+    }
+    const uint32_t name_len = size - c_name;
+    for (uint32_t i = 0; i < MODEL_IMAGE_NAME_LEN - 1U && i < name_len && image[c_name + i] != '\0'; i++) {
+        info->c_name[i] = (char)image[c_name + i];
+    }
+
+    info->flags = hdr[HDR_FLAGS];
+    info->code_size = MODEL_IMAGE_ROUND_UP(data_data);
+    info->exec_ram_xip = MODEL_IMAGE_ROUND_UP(bss_end);
+    info->exec_ram_copy = info->exec_ram_xip + info->code_size;
+    info->params_offset = MODEL_IMAGE_OFFSET(hdr[HDR_PARAMS_OFFSET]);
+    info->params_size = model_image_word(image, ctx_offset + CTX_PARAMS_SZ * 4U);
+    info->acts_size = model_image_word(image, ctx_offset + CTX_ACTS_SZ * 4U);
+    info->ext_ram_size = MODEL_IMAGE_ROUND_UP(model_image_word(image, ctx_offset + CTX_EXT_RAM_SZ * 4U));
+    info->rt_version = model_image_word(image, ctx_offset + CTX_RT_VERSION * 4U);
+
+    /* Weights follow the code unless the image was built for a separate param address */
+    info->image_size = model_image_max(rel_end, data_data + bss_start);
+    if (info->params_offset != 0) {
+        if (!model_image_fits(info->params_offset, info->params_size, size)) {
+            return MODEL_IMAGE_ERR_LAYOUT;
+        }
+        info->image_size = model_image_max(info->image_size, info->params_offset + info->params_size);
+    }
+
+    /* Memory pool descriptors, same walk as ll_aton_reloc_get_mem_pool_desc */
+    if (MODEL_IMAGE_IN_RAM(hdr[HDR_PARAMS_START])) {
+        uint32_t desc = data_data + MODEL_IMAGE_OFFSET(hdr[HDR_PARAMS_START]);
+        while (info->pool_count < MODEL_IMAGE_MAX_POOLS) {
+            if (!model_image_fits(desc, MODEL_IMAGE_POOL_DESC_SIZE, data_data + bss_start)) {
+                return MODEL_IMAGE_ERR_LAYOUT;
+            }
+            const uint32_t name = model_image_word(image, desc);
+            const uint32_t flags = model_image_word(image, desc + 4U);
+            if (name == 0 || flags == 0) {
+                break;
+            }
+            model_image_pool_t *pool = &info->pools[info->pool_count++];
+            pool->flags = flags;
+            pool->file_offset = model_image_word(image, desc + 8U);
+            pool->dst = model_image_word(image, desc + 12U);
+            pool->size = model_image_word(image, desc + 16U);
+            desc += MODEL_IMAGE_POOL_DESC_SIZE;
+        }
+    }
+
+    return MODEL_IMAGE_OK;
+}
+
+int model_image_check(const model_image_info_t *info, const model_image_limits_t *limits)
+{
+    if (info == NULL || limits == NULL) {
+        return MODEL_IMAGE_ERR_ARG;
+    }
+
+    /* Same acceptance rules as _ai_reloc_rt_checking, before touching any RAM */
+    const uint32_t flags = info->flags;
+    if (((flags >> 28) & 0xFU) != MODEL_IMAGE_RT_MAJOR || ((flags >> 24) & 0xFU) != MODEL_IMAGE_RT_MINOR) {
+        return MODEL_IMAGE_ERR_VERSION;
+    }
+    if ((flags & 0xFFFU) != limits->cpuid || ((flags >> 13) & 0x3U) != MODEL_IMAGE_FPABI_HARD ||
+        ((flags >> 20) & 0x7U) != (limits->extra & 0x7U)) {
+        return MODEL_IMAGE_ERR_TARGET;
+    }
+    if ((info->rt_version & 0xFFFFFF00UL) != (limits->rt_version & 0xFFFFFF00UL)) {
+        return MODEL_IMAGE_ERR_VERSION;
+    }
+
+    if (info->image_size > limits->slot_size || info->exec_ram_xip > limits->exec_ram_size ||
+        info->ext_ram_size > limits->ext_ram_size) {
+        return MODEL_IMAGE_ERR_MEMORY;
+    }
+    for (uint32_t i = 0; i < info->pool_count; i++) {
+        const model_image_pool_t *pool = &info->pools[i];
+        const uint32_t type = (pool->flags >> 24) & 0xFFU;
+        const uint32_t id = pool->flags & 0xFFU;
+        if (type != MODEL_IMAGE_POOL_TYPE_RELOC) {
+            continue;
+        }
+        if (id == MODEL_IMAGE_POOL_ID_PARAMS &&
+            !model_image_fits(pool->file_offset, pool->size, info->params_size)) {
+            return MODEL_IMAGE_ERR_LAYOUT;
+        }
+        if (id == MODEL_IMAGE_POOL_ID_EXT_RAM && MODEL_IMAGE_ROUND_UP(pool->size) > limits->ext_ram_size) {
+            return MODEL_IMAGE_ERR_MEMORY;
+        }
+    }
+    return MODEL_IMAGE_OK;
+}
+
+const char *model_image_status_str(int status)
+{
+    switch (status) {
+    case MODEL_IMAGE_OK:
+        return "ok";
+    case MODEL_IMAGE_ERR_ARG:
+        return "invalid argument";
+    case MODEL_IMAGE_ERR_MAGIC:
+        return "not a relocatable network image";
+    case MODEL_IMAGE_ERR_LAYOUT:
+        return "sections outside the image";
+    case MODEL_IMAGE_ERR_TARGET:
+        return "built for another target";
+    case MODEL_IMAGE_ERR_VERSION:
+        return "built for another runtime version";
+    case MODEL_IMAGE_ERR_MEMORY:
+        return "does not fit the reserved memory";
+    default:
+        return "unknown";
+    }
+}
@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @file    npu_stall_monitor.c
+ * @author  PeleAB
+ * @brief   Sampled NPU stream engine stall telemetry per memory pool
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "npu_stall_monitor.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "ll_aton.h"
+#include "ll_aton_dbgtrc.h"
+#endif
+
+/* ========================================================================= */
+/* ADDRESS MAP                                                               */
+/* ========================================================================= */
+
+/* Secure aliases; bit 28 clear gives the non-secure ones (0x24.../0x34...) */
+#define NPU_ADDR_SECURE_BIT     0x10000000U
+#define NPU_ADDR_CPURAM_START   0x34000000U     /* FLEXMEM, AXISRAM1, AXISRAM2 */
+#define NPU_ADDR_NPURAM_START   0x34200000U     /* AXISRAM3..6 */
+#define NPU_ADDR_NPURAM_END     0x343C0000U
+#define NPU_ADDR_OCTOFLASH_START 0x70000000U
+#define NPU_ADDR_HYPERRAM_START 0x90000000U
+#define NPU_ADDR_XSPI_SIZE      0x10000000U
+
+/* ========================================================================= */
+/* PRIVATE DATA                                                              */
+/* ========================================================================= */
+
+static npu_stall_network_t s_networks[EPOCH_PROFILER_NET_COUNT];
+
+static const char *const s_pool_names[NPU_POOL_COUNT] = {
+    [NPU_POOL_NPURAM]    = "npuRAM",
+    [NPU_POOL_CPURAM]    = "cpuRAM",
+    [NPU_POOL_HYPERRAM]  = "hyperRAM",
+    [NPU_POOL_OCTOFLASH] = "octoFlash",
+    [NPU_POOL_OTHER]     = "other",
+};
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static void stall_put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+}
+
+static void stall_put_u32(uint8_t *p, uint32_t v)
+{
+    stall_put_u16(p, (uint16_t)(v & 0xFFFF));
+    stall_put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+static void stall_inc_u16(uint16_t *counter)
+{
+    if (*counter < UINT16_MAX) {
+        (*counter)++;
+    }
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+void npu_stall_monitor_reset(void)
+{
+    memset(s_networks, 0, sizeof(s_networks));
+}
+
+npu_pool_t npu_stall_pool_from_address(uint32_t address)
+{
+    if (address >= NPU_ADDR_HYPERRAM_START && address - NPU_ADDR_HYPERRAM_START < NPU_ADDR_XSPI_SIZE) {
+        return NPU_POOL_HYPERRAM;
+    }
+    if (address >= NPU_ADDR_OCTOFLASH_START && address - NPU_ADDR_OCTOFLASH_START < NPU_ADDR_XSPI_SIZE) {
+        return NPU_POOL_OCTOFLASH;
+    }
+
+    const uint32_t secure = address | NPU_ADDR_SECURE_BIT;
+    if ((address & 0xF0000000U) == 0x20000000U || (address & 0xF0000000U) == 0x30000000U) {
+        if (secure >= NPU_ADDR_NPURAM_START && secure < NPU_ADDR_NPURAM_END) {
+            return NPU_POOL_NPURAM;
+        }
+        if (secure >= NPU_ADDR_CPURAM_START && secure < NPU_ADDR_NPURAM_START) {
+            return NPU_POOL_CPURAM;
+        }
+    }
+    return NPU_POOL_OTHER;
+}
+
+const char *npu_stall_pool_name(npu_pool_t pool)
+{
+    return ((unsigned)pool < NPU_POOL_COUNT) ? s_pool_names[pool] : "?";
+}
+
+void npu_stall_monitor_record(epoch_profiler_net_t net, uint16_t block,
+                              const npu_stall_engine_t *engines, uint32_t count)
+{
+    if ((unsigned)net >= EPOCH_PROFILER_NET_COUNT || (engines == NULL && count > 0)) {
+        return;
+    }
+
+    npu_stall_network_t *report = &s_networks[net];
+    bool read_stalled = false;
+    bool write_stalled = false;
+    uint8_t pools = 0;
+
+    report->samples++;
+    for (uint32_t i = 0; i < count; i++) {
+        const npu_pool_t pool = npu_stall_pool_from_address(engines[i].address);
+        npu_stall_pool_stats_t *stats = &report->pools[pool];
+
+        pools |= (uint8_t)(1U << pool);
+        if (engines[i].output) {
+            stats->write_running++;
+            stats->write_stalled += engines[i].stalled ? 1U : 0U;
+            write_stalled |= engines[i].stalled;
+        } else {
+            stats->read_running++;
+            stats->read_stalled += engines[i].stalled ? 1U : 0U;
+            read_stalled |= engines[i].stalled;
+        }
+    }
+
+    if (block < EPOCH_PROFILER_MAX_BLOCKS) {
+        npu_stall_block_stats_t *stats = &report->blocks[block];
+        stall_inc_u16(&stats->samples);
+        if (read_stalled) {
+            stall_inc_u16(&stats->read_stalled);
+        }
+        if (write_stalled) {
+            stall_inc_u16(&stats->write_stalled);
+        }
+        stats->pools |= pools;
+    }
+}
+
+const npu_stall_network_t *npu_stall_monitor_get(epoch_profiler_net_t net)
+{
+    return ((unsigned)net < EPOCH_PROFILER_NET_COUNT) ? &s_networks[net] : NULL;
+}
+
+uint32_t npu_stall_monitor_serialize(epoch_profiler_net_t net, uint8_t *buffer, uint32_t size)
+{
+    const npu_stall_network_t *report = npu_stall_monitor_get(net);
+    const epoch_profile_network_t *profile = epoch_profiler_get(net);
+    if (report == NULL || profile == NULL || buffer == NULL) {
+        return 0;
+    }
+
+    /* Blocks line up with the epoch profile of the same network */
+    const uint16_t block_count = profile->block_count;
+    const uint32_t total = NPU_STALL_WIRE_HEADER_SIZE + NPU_POOL_COUNT * NPU_STALL_WIRE_POOL_SIZE +
+                           (uint32_t)block_count * NPU_STALL_WIRE_BLOCK_SIZE;
+    if (size < total) {
+        return 0;
+    }
+
+    buffer[0] = NPU_STALL_WIRE_VERSION;
+    buffer[1] = (uint8_t)net;
+    buffer[2] = NPU_POOL_COUNT;
+    buffer[3] = NPU_STALL_SAMPLE_PERIOD_MS;
+    stall_put_u32(buffer + 4, report->samples);
+    stall_put_u16(buffer + 8, block_count);
+
+    uint8_t *p = buffer + NPU_STALL_WIRE_HEADER_SIZE;
+    for (int i = 0; i < NPU_POOL_COUNT; i++) {
+        const npu_stall_pool_stats_t *stats = &report->pools[i];
+        p[0] = (uint8_t)i;
+        stall_put_u32(p + 1, stats->read_running);
+        stall_put_u32(p + 5, stats->read_stalled);
+        stall_put_u32(p + 9, stats->write_running);
+        stall_put_u32(p + 13, stats->write_stalled);
+        p += NPU_STALL_WIRE_POOL_SIZE;
+    }
+
+    for (uint32_t i = 0; i < block_count; i++) {
+        const npu_stall_block_stats_t *stats = &report->blocks[i];
+        stall_put_u16(p, stats->samples);
+        stall_put_u16(p + 2, stats->read_stalled);
+        stall_put_u16(p + 4, stats->write_stalled);
+        p[6] = stats->pools;
+        p += NPU_STALL_WIRE_BLOCK_SIZE;
+    }
+    return total;
+}
+
+#ifndef APP_HOST_BUILD
+/* ========================================================================= */
+/* STREAM ENGINE SAMPLING                                                    */
+/* ========================================================================= */
+
+void npu_stall_monitor_init(void)
+{
+    LL_Dbgtrc_Init(0);
+    npu_stall_monitor_reset();
+}
+
+void npu_stall_monitor_sample(void)
+{
+    epoch_profiler_net_t net;
+    uint16_t block;
+    if (!epoch_profiler_get_running(&net, &block)) {
+        return;
+    }
+
+    npu_stall_engine_t engines[NPU_STALL_MAX_ENGINES];
+    uint32_t count = 0;
+
+    for (unsigned int i = 0; i < ATON_STRENG_NUM && count < NPU_STALL_MAX_ENGINES; i++) {
+        const uint32_t ctrl = ATON_STRENG_CTRL_GET(i);
+        if (!ATON_STRENG_CTRL_GET_RUNNING(ctrl)) {
+            continue;
+        }
+
+        /* Input engines source a switch link, output engines sink one */
+        npu_stall_engine_t *engine = &engines[count++];
+        engine->address = ATON_STRENG_ADDR_GET(i);
+        engine->output = (ATON_STRENG_CTRL_GET_DIR(ctrl) != 0);
+        engine->stalled = engine->output ?
+            (LL_Dbgtrc_Read_IStall(0, GET_STRSWTCH_DEST(ATON_STRSWITCH_DSTSTRENG0_OFFSET) + i) == 1) :
+            (LL_Dbgtrc_Read_OStall(0, ATON_LINK_STRENG0 + i) == 1);
+    }
+
+    npu_stall_monitor_record(net, block, engines, count);
+}
+#endif /* APP_HOST_BUILD */
@@ -0,0 +1,240 @@
+/**
+ ******************************************************************************
+ * @file    perf_monitor.c
+ * @author  PeleAB
+ * @brief   Cycle-accurate timers for pipeline stages, networks and faces
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "perf_monitor.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#else
+#include "host_platform.h"
+#endif
+
+#if (PERF_MONITOR_RING_SIZE & (PERF_MONITOR_RING_SIZE - 1)) != 0
+#error "PERF_MONITOR_RING_SIZE must be a power of two"
+#endif
+
+/* ========================================================================= */
+/* PRIVATE DATA                                                              */
+/* ========================================================================= */
+
+static perf_probe_data_t s_probes[PERF_PROBE_COUNT];
+
+static const char *const s_probe_names[PERF_PROBE_COUNT] = {
+    [PERF_PROBE_FRAME]                = "frame",
+    [PERF_PROBE_STAGE_CAPTURE]        = "capture",
+    [PERF_PROBE_STAGE_PREPROCESSING]  = "preprocessing",
+    [PERF_PROBE_STAGE_DETECTION]      = "detection",
+    [PERF_PROBE_STAGE_TRACKING]       = "tracking",
+    [PERF_PROBE_STAGE_RECOGNITION]    = "recognition",
+    [PERF_PROBE_STAGE_POSTPROCESSING] = "postprocessing",
+    [PERF_PROBE_STAGE_OUTPUT]         = "output",
+    [PERF_PROBE_NN_DETECTION]         = "nn_detection",
+    [PERF_PROBE_NN_RECOGNITION]       = "nn_recognition",
+    [PERF_PROBE_FACE]                 = "face",
+    [PERF_PROBE_OVERLAY_CLEAR]        = "overlay_clear",
+    [PERF_PROBE_FRAME_CODEC]          = "frame_codec",
+    [PERF_PROBE_DISPLAY_TASK]         = "display_task",
+};
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static void perf_put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+    p[2] = (uint8_t)((v >> 16) & 0xFF);
+    p[3] = (uint8_t)((v >> 24) & 0xFF);
+}
+
+static uint32_t perf_cycles_to_us(uint64_t cycles)
+{
+    return (uint32_t)(cycles / perf_monitor_cycles_per_us());
+}
+
+/* 99th percentile of the ring by sorting a copy (small, export path only) */
+static uint32_t perf_ring_p99(const perf_probe_data_t *data)
+{
+    static uint32_t sorted[PERF_MONITOR_RING_SIZE];
+    const uint32_t n = (data->count < PERF_MONITOR_RING_SIZE) ? data->count : PERF_MONITOR_RING_SIZE;
+
+    memcpy(sorted, data->ring, n * sizeof(sorted[0]));
+    for (uint32_t i = 1; i < n; i++) {
+        uint32_t v = sorted[i];
+        uint32_t j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+    /* Nearest rank: ceil(0.99 * n) */
+    return sorted[(99U * n + 99U) / 100U - 1U];
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+void perf_monitor_init(void)
+{
+#ifndef APP_HOST_BUILD
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    perf_monitor_reset();
+}
+
+void perf_monitor_reset(void)
+{
+    memset(s_probes, 0, sizeof(s_probes));
+    for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+        s_probes[i].min = UINT32_MAX;
+    }
+}
+
+uint32_t perf_monitor_now(void)
+{
+#ifndef APP_HOST_BUILD
+    return DWT->CYCCNT;
+#else
+    return host_get_time_ns();
+#endif
+}
+
+uint32_t perf_monitor_cycles_per_us(void)
+{
+#ifndef APP_HOST_BUILD
+    return SystemCoreClock / 1000000U;
+#else
+    return 1000U;
+#endif
+}
+
+void perf_monitor_begin(perf_probe_t probe)
+{
+    if ((unsigned)probe < PERF_PROBE_COUNT) {
+        s_probes[probe].start = perf_monitor_now();
+    }
+}
+
+void perf_monitor_end(perf_probe_t probe)
+{
+    if ((unsigned)probe < PERF_PROBE_COUNT) {
+        perf_monitor_record(probe, perf_monitor_now() - s_probes[probe].start);
+    }
+}
+
+void perf_monitor_record(perf_probe_t probe, uint32_t cycles)
+{
+    if ((unsigned)probe >= PERF_PROBE_COUNT) {
+        return;
+    }
+
+    perf_probe_data_t *data = &s_probes[probe];
+    data->ring[data->count & (PERF_MONITOR_RING_SIZE - 1)] = cycles;
+    data->count++;
+    data->total += cycles;
+    if (cycles < data->min) {
+        data->min = cycles;
+    }
+    if (cycles > data->max) {
+        data->max = cycles;
+    }
+}
+
+int perf_monitor_get_summary(perf_probe_t probe, perf_summary_t *summary)
+{
+    if ((unsigned)probe >= PERF_PROBE_COUNT || summary == NULL) {
+        return -1;
+    }
+
+    const perf_probe_data_t *data = &s_probes[probe];
+    memset(summary, 0, sizeof(*summary));
+    summary->count = data->count;
+    if (data->count == 0) {
+        return 0;
+    }
+
+    summary->min_us = perf_cycles_to_us(data->min);
+    summary->avg_us = perf_cycles_to_us(data->total / data->count);
+    summary->p99_us = perf_cycles_to_us(perf_ring_p99(data));
+    summary->max_us = perf_cycles_to_us(data->max);
+    return 0;
+}
+
+const char *perf_monitor_probe_name(perf_probe_t probe)
+{
+    return ((unsigned)probe < PERF_PROBE_COUNT) ? s_probe_names[probe] : "?";
+}
+
+uint32_t perf_monitor_serialize(uint8_t *buffer, uint32_t size, uint32_t timestamp_ms)
+{
+    if (buffer == NULL || size < PERF_MONITOR_WIRE_HEADER_SIZE) {
+        return 0;
+    }
+
+    uint32_t offset = PERF_MONITOR_WIRE_HEADER_SIZE;
+    uint8_t probe_count = 0;
+
+    for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+        perf_summary_t summary;
+        perf_monitor_get_summary((perf_probe_t)i, &summary);
+        if (summary.count == 0) {
+            continue;
+        }
+        if (offset + PERF_MONITOR_WIRE_PROBE_SIZE > size) {
+            return 0;
+        }
+
+        uint8_t *p = buffer + offset;
+        p[0] = (uint8_t)i;
+        perf_put_u32(p + 1, summary.count);
+        perf_put_u32(p + 5, summary.min_us);
+        perf_put_u32(p + 9, summary.avg_us);
+        perf_put_u32(p + 13, summary.p99_us);
+        perf_put_u32(p + 17, summary.max_us);
+        offset += PERF_MONITOR_WIRE_PROBE_SIZE;
+        probe_count++;
+    }
+
+    buffer[0] = PERF_MONITOR_WIRE_VERSION;
+    buffer[1] = probe_count;
+    perf_put_u32(buffer + 2, timestamp_ms);
+    return offset;
+}
+
+void perf_monitor_print(void)
+{
+    printf("%-16s %8s %10s %10s %10s %10s\n", "probe", "count", "min_us", "avg_us", "p99_us", "max_us");
+    for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+        perf_summary_t summary;
+        perf_monitor_get_summary((perf_probe_t)i, &summary);
+        if (summary.count == 0) {
+            continue;
+        }
+        printf("%-16s %8lu %10lu %10lu %10lu %10lu\n", s_probe_names[i],
+               (unsigned long)summary.count, (unsigned long)summary.min_us,
+               (unsigned long)summary.avg_us, (unsigned long)summary.p99_us,
+               (unsigned long)summary.max_us);
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ ******************************************************************************
+ * @file    robust_framing.c
+ * @author  PeleAB
+ * @brief   PC stream wire framing (v1 packets, v2 chunked messages)
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "robust_framing.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static void robust_put_u16(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)(value & 0xFF);
+    p[1] = (uint8_t)((value >> 8) & 0xFF);
+}
+
+static void robust_put_u32(uint8_t *p, uint32_t value)
+{
+    robust_put_u16(p, value & 0xFFFF);
+    robust_put_u16(p + 2, value >> 16);
+}
+
+static uint8_t robust_xor(const uint8_t *data, uint32_t size)
+{
+    uint8_t checksum = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        checksum ^= data[i];
+    }
+    return checksum;
+}
+
+/* Reserve the next chunk (the whole payload for v1) */
+static int robust_reserve_chunk(robust_writer_t *writer)
+{
+    uint32_t size = writer->message_size - writer->written;
+    if (writer->version >= ROBUST_PROTOCOL_V2 && size > writer->chunk_limit) {
+        size = writer->chunk_limit;
+    }
+
+    writer->chunk = uart_tx_queue_reserve(writer->queue, size, writer->packet_class);
+    if (writer->chunk == NULL) {
+        return -1;
+    }
+    writer->chunk_offset = writer->written;
+    writer->chunk_size = size;
+    writer->packet_class = UART_TX_RELIABLE;
+    crc32_stream_begin(&writer->crc);
+    return 0;
+}
+
+/* Queue the open chunk between its header and its CRC */
+static int robust_commit_chunk(robust_writer_t *writer)
+{
+    uint8_t header[ROBUST_V2_HEADER_SIZE];
+    uint32_t header_size;
+
+    if (writer->version >= ROBUST_PROTOCOL_V2) {
+        uint8_t flags = 0;
+        if (writer->chunk_offset == 0) {
+            flags |= ROBUST_V2_FLAG_FIRST;
+        }
+        if (writer->chunk_offset + writer->chunk_size == writer->message_size) {
+            flags |= ROBUST_V2_FLAG_LAST;
+        }
+        header[0] = ROBUST_V2_SOF_BYTE;
+        header[1] = ROBUST_PROTOCOL_V2;
+        header[2] = writer->message_type;
+        header[3] = flags;
+        robust_put_u16(&header[4], writer->sequence_id);
+        robust_put_u16(&header[6], writer->chunk_size);
+        robust_put_u32(&header[8], writer->message_size);
+        robust_put_u32(&header[12], writer->chunk_offset);
+        header[16] = robust_xor(header, 16);
+        header_size = ROBUST_V2_HEADER_SIZE;
+    } else {
+        const uint32_t size = ROBUST_MSG_HEADER_SIZE + writer->message_size;
+        header[0] = ROBUST_SOF_BYTE;
+        robust_put_u16(&header[1], size);
+        header[3] = robust_xor(header, 3);
+        header[4] = writer->message_type;
+        robust_put_u16(&header[5], writer->sequence_id);
+        header_size = ROBUST_HEADER_SIZE + ROBUST_MSG_HEADER_SIZE;
+    }
+
+    uint8_t crc[ROBUST_CRC_SIZE];
+    robust_put_u32(crc, crc32_stream_end(&writer->crc));
+
+    writer->chunk = NULL;
+    return uart_tx_queue_commit(writer->queue, header, header_size, crc, ROBUST_CRC_SIZE);
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int robust_writer_begin(robust_writer_t *writer, uart_tx_queue_t *queue, uint8_t version,
+                        uint8_t message_type, uint16_t sequence_id, uint32_t message_size,
+                        uint32_t chunk_limit, uart_tx_class_t packet_class)
+{
+    if (writer == NULL || queue == NULL) {
+        return -2;
+    }
+
+    memset(writer, 0, sizeof(*writer));
+    if (version >= ROBUST_PROTOCOL_V2) {
+        if (chunk_limit == 0) {
+            chunk_limit = ROBUST_V2_CHUNK_SIZE;
+        }
+        if (chunk_limit > ROBUST_V2_MAX_CHUNK_SIZE) {
+            return -2;
+        }
+    } else if (message_size > ROBUST_MAX_PAYLOAD_SIZE - ROBUST_MSG_HEADER_SIZE) {
+        return -2;
+    }
+
+    writer->queue = queue;
+    writer->version = (version >= ROBUST_PROTOCOL_V2) ? ROBUST_PROTOCOL_V2 : ROBUST_PROTOCOL_V1;
+    writer->message_type = message_type;
+    writer->sequence_id = sequence_id;
+    writer->message_size = message_size;
+    writer->chunk_limit = chunk_limit;
+    writer->packet_class = packet_class;
+    return robust_reserve_chunk(writer);
+}
+
+int robust_writer_write(robust_writer_t *writer, const void *data, uint32_t size)
+{
+    const uint8_t *src = (const uint8_t *)data;
+
+    if (writer->chunk == NULL || size > writer->message_size - writer->written) {
+        robust_writer_abort(writer);
+        return -1;
+    }
+
+    while (size > 0) {
+        /* A full chunk goes out as soon as more payload follows */
+        if (writer->written == writer->chunk_offset + writer->chunk_size) {
+            if (robust_commit_chunk(writer) != 0 || robust_reserve_chunk(writer) != 0) {
+                return -1;
+            }
+        }
+
+        const uint32_t room = writer->chunk_offset + writer->chunk_size - writer->written;
+        const uint32_t n = (size < room) ? size : room;
+        uint8_t *dest = writer->chunk + (writer->written - writer->chunk_offset);
+
+        memcpy(dest, src, n);
+        crc32_stream_update(&writer->crc, dest, n);
+        writer->written += n;
+        src += n;
+        size -= n;
+    }
+    return 0;
+}
+
+int robust_writer_end(robust_writer_t *writer)
+{
+    if (writer->chunk == NULL || writer->written != writer->message_size) {
+        robust_writer_abort(writer);
+        return -1;
+    }
+    return robust_commit_chunk(writer);
+}
+
+void robust_writer_abort(robust_writer_t *writer)
+{
+    if (writer->chunk != NULL) {
+        uart_tx_queue_cancel(writer->queue);
+        writer->chunk = NULL;
+    }
+}
@@ -22,6 +22,13 @@
 
 #include "cmw_camera.h"
 #include "stm32n6570_discovery.h"
+#include "stm32n6570_discovery_lcd.h"
+#include "gfx2d.h"
+#include "display_utils.h"
+#include "enhanced_pc_stream.h"
+#ifdef APP_NPU_STALLS
+#include "npu_stall_monitor.h"
+#endif
 
 /**
   * @brief   This function handles NMI exception.
@@ -138,6 +145,9 @@ void PendSV_Handler(void)
 void SysTick_Handler(void)
 {
   HAL_IncTick();
+#ifdef APP_NPU_STALLS
+  npu_stall_monitor_sample();
+#endif
 }
 
 /******************************************************************************/
@@ -161,4 +171,27 @@ void DCMIPP_IRQHandler(void)
 void EXTI13_IRQHandler(void)
 {
   BSP_PB_IRQHandler(BUTTON_USER1);
-}
\ No newline at end of file
+}
+
+void DMA2D_IRQHandler(void)
+{
+  gfx2d_irq_handler();
+}
+
+void LTDC_LO_IRQHandler(void)
+{
+  HAL_LTDC_IRQHandler(&hlcd_ltdc);
+  Display_Task();
+}
+
+#if (USE_BSP_COM_FEATURE > 0)
+void GPDMA1_Channel0_IRQHandler(void)
+{
+  Enhanced_PC_STREAM_TxDmaIRQHandler();
+}
+
+void USART1_IRQHandler(void)
+{
+  Enhanced_PC_STREAM_UartIRQHandler();
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,235 @@
+/**
+ ******************************************************************************
+ * @file    stream_rate.c
+ * @author  PeleAB
+ * @brief   Rate control of streamed images against link throughput and
+ *          pipeline time
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "stream_rate.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Periods longer than this are pauses (debugger, reconfiguration), not frames */
+#define STREAM_RATE_MAX_PERIOD_US       1000000U
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+/* Exponential average, new samples weigh 1/4 */
+static inline uint32_t stream_rate_average(uint32_t average, uint32_t sample)
+{
+    return (uint32_t)((int64_t)average + ((int64_t)sample - (int64_t)average) / 4);
+}
+
+/* End the accounting period opened by the previous frame */
+static void stream_rate_close_window(stream_rate_t *rate, uint32_t now_us)
+{
+    if (rate->window_open) {
+        const uint32_t elapsed = now_us - rate->window_start_us;
+        if (elapsed > 0 && elapsed <= STREAM_RATE_MAX_PERIOD_US) {
+            rate->period_us = stream_rate_average(rate->period_us, elapsed);
+            rate->last_fraction = (uint32_t)((uint64_t)rate->window_us * 1000U / elapsed);
+        }
+        rate->reliable_reserve = stream_rate_average(rate->reliable_reserve, rate->window_reliable);
+    }
+
+    rate->window_open = true;
+    rate->window_start_us = now_us;
+    rate->window_bytes = 0;
+    rate->window_reliable = 0;
+    rate->window_us = 0;
+}
+
+/* Whether an image at a scale fits the budget left, divided by the given factor */
+static bool stream_rate_fits(const stream_rate_class_stats_t *stats, uint32_t pixel_bytes,
+                             uint32_t scale, int64_t bytes_left, int64_t time_left, uint32_t divisor)
+{
+    const uint64_t pixels = pixel_bytes / (scale * scale);
+    const int64_t bytes = (int64_t)(pixels * stats->ratio / 1000U);
+    const int64_t time = (int64_t)(pixels * stats->cost_ns_per_kb / 1024U / 1000U);
+    return bytes * divisor <= bytes_left && time * divisor <= time_left;
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+void stream_rate_default_config(stream_rate_config_t *config)
+{
+    config->link_bytes_per_s = STREAM_RATE_DEFAULT_LINK_BPS;
+    config->default_period_us = STREAM_RATE_DEFAULT_PERIOD_US;
+    config->max_fraction = STREAM_RATE_DEFAULT_MAX_FRACTION;
+    config->min_scale = STREAM_RATE_DEFAULT_MIN_SCALE;
+    config->max_scale = STREAM_RATE_DEFAULT_MAX_SCALE;
+}
+
+int stream_rate_init(stream_rate_t *rate, const stream_rate_config_t *config)
+{
+    if (rate == NULL) {
+        return -1;
+    }
+
+    memset(rate, 0, sizeof(*rate));
+    if (config != NULL) {
+        rate->config = *config;
+    } else {
+        stream_rate_default_config(&rate->config);
+    }
+    if (rate->config.link_bytes_per_s == 0 || rate->config.default_period_us == 0 ||
+        rate->config.max_fraction == 0 || rate->config.max_fraction > 1000U ||
+        rate->config.min_scale == 0 || rate->config.max_scale < rate->config.min_scale) {
+        return -1;
+    }
+
+    rate->link_bytes_per_s = rate->config.link_bytes_per_s;
+    rate->period_us = rate->config.default_period_us;
+    rate->scale = rate->config.min_scale;
+    for (uint32_t i = 0; i < STREAM_RATE_CLASS_COUNT; i++) {
+        rate->classes[i].ratio = 1000U;
+    }
+    return 0;
+}
+
+void stream_rate_update(stream_rate_t *rate, uint32_t now_us, uint32_t bytes_sent,
+                        uint32_t bytes_pending)
+{
+    rate->bytes_pending = bytes_pending;
+    if (!rate->link_sampled) {
+        rate->link_sampled = true;
+        rate->sample_us = now_us;
+        rate->sample_bytes_sent = bytes_sent;
+        rate->sample_pending = bytes_pending;
+        return;
+    }
+
+    const uint32_t elapsed = now_us - rate->sample_us;
+    if (elapsed < STREAM_RATE_MIN_SAMPLE_US) {
+        return;
+    }
+
+    const uint64_t sample = (uint64_t)(bytes_sent - rate->sample_bytes_sent) * 1000000U / elapsed;
+    const uint32_t measured = (sample > UINT32_MAX) ? UINT32_MAX : (uint32_t)sample;
+    if (rate->sample_pending > 0 && bytes_pending > 0) {
+        rate->link_bytes_per_s = stream_rate_average(rate->link_bytes_per_s, measured);
+    } else if (measured > rate->link_bytes_per_s) {
+        rate->link_bytes_per_s = measured;
+    } else if (rate->link_bytes_per_s < rate->config.link_bytes_per_s) {
+        rate->link_bytes_per_s += (rate->config.link_bytes_per_s - rate->link_bytes_per_s) / 16U;
+    }
+
+    rate->sample_us = now_us;
+    rate->sample_bytes_sent = bytes_sent;
+    rate->sample_pending = bytes_pending;
+}
+
+stream_rate_decision_t stream_rate_decide(stream_rate_t *rate, stream_rate_class_t cls,
+                                          uint32_t now_us, uint32_t pixel_bytes)
+{
+    stream_rate_decision_t decision = { true, 1 };
+
+    if (cls >= STREAM_RATE_RELIABLE) {
+        return decision;
+    }
+    if (cls == STREAM_RATE_FRAME) {
+        stream_rate_close_window(rate, now_us);
+    }
+
+    /* What the link carries over the horizon once the queue and the reserve are served */
+    const int64_t link_bytes = (int64_t)rate->link_bytes_per_s * rate->period_us *
+                               STREAM_RATE_QUEUE_PERIODS / 1000000;
+    const int64_t bytes_left = link_bytes - rate->reliable_reserve - rate->bytes_pending;
+    const int64_t time_left = (int64_t)rate->config.max_fraction * rate->period_us / 1000 -
+                              rate->window_us;
+
+    const stream_rate_class_stats_t *stats = &rate->classes[cls];
+    const uint32_t first = (cls == STREAM_RATE_FRAME) ? rate->config.min_scale : 1U;
+    const uint32_t last = (cls == STREAM_RATE_FRAME) ? rate->config.max_scale : 1U;
+    uint32_t scale = first;
+    while (scale <= last && !stream_rate_fits(stats, pixel_bytes, scale, bytes_left, time_left, 1U)) {
+        scale++;
+    }
+
+    if (scale <= last) {
+        decision.scale = scale;
+        if (cls != STREAM_RATE_FRAME) {
+            return decision;
+        }
+
+        /* Finer than the last frame one step at a time, after frames of headroom */
+        if (scale < rate->scale) {
+            const bool headroom = stream_rate_fits(stats, pixel_bytes, rate->scale - 1U, bytes_left,
+                                                   time_left, STREAM_RATE_REFINE_HEADROOM);
+            rate->refine_frames = headroom ? rate->refine_frames + 1U : 0;
+            if (rate->refine_frames >= STREAM_RATE_REFINE_FRAMES) {
+                rate->refine_frames = 0;
+                rate->scale--;
+            }
+            decision.scale = rate->scale;
+        } else {
+            rate->refine_frames = 0;
+            rate->scale = scale;
+        }
+        return decision;
+    }
+
+    /* A class never sent has an uncoded ratio: probe it once if coding could make it fit */
+    if (stats->sent == 0 && rate->bytes_pending == 0 &&
+        stream_rate_fits(stats, pixel_bytes, last, bytes_left * STREAM_RATE_PROBE_RATIO, time_left, 1U)) {
+        decision.scale = last;
+        if (cls == STREAM_RATE_FRAME) {
+            rate->scale = last;
+        }
+        return decision;
+    }
+
+    rate->classes[cls].skipped++;
+    decision.send = false;
+    return decision;
+}
+
+void stream_rate_record(stream_rate_t *rate, stream_rate_class_t cls, uint32_t pixel_bytes,
+                        uint32_t sent_bytes, uint32_t elapsed_us)
+{
+    if (cls >= STREAM_RATE_CLASS_COUNT) {
+        return;
+    }
+
+    stream_rate_class_stats_t *stats = &rate->classes[cls];
+    rate->window_bytes += sent_bytes;
+    rate->window_us += elapsed_us;
+    rate->bytes_pending += sent_bytes;
+    stats->sent++;
+    if (cls == STREAM_RATE_RELIABLE) {
+        rate->window_reliable += sent_bytes;
+        return;
+    }
+    if (pixel_bytes == 0) {
+        return;
+    }
+
+    /* The first sample replaces the optimistic initial guess */
+    const uint32_t ratio = (uint32_t)((uint64_t)sent_bytes * 1000U / pixel_bytes);
+    const uint32_t cost = (uint32_t)((uint64_t)elapsed_us * 1000U * 1024U / pixel_bytes);
+    stats->ratio = (stats->sent == 1) ? ratio : stream_rate_average(stats->ratio, ratio);
+    stats->cost_ns_per_kb = (stats->sent == 1) ? cost : stream_rate_average(stats->cost_ns_per_kb, cost);
+}
+
+void stream_rate_record_drop(stream_rate_t *rate, stream_rate_class_t cls)
+{
+    if (cls < STREAM_RATE_CLASS_COUNT) {
+        rate->classes[cls].skipped++;
+    }
+}
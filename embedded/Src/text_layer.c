@@ -0,0 +1,355 @@
+/**
+ ******************************************************************************
+ * @file    text_layer.c
+ * @author  PeleAB
+ * @brief   Cached overlay text drawn from a pre-rendered glyph atlas
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "text_layer.h"
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#endif
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+/* Same truncation as CONVERTARGB88882ARGB4444() in stm32_lcd.c */
+static uint16_t text_to_argb4444(uint32_t c)
+{
+    return (uint16_t)(((c >> 28) << 12) | (((c >> 20) & 0xFU) << 8) | (((c >> 12) & 0xFU) << 4) | ((c >> 4) & 0xFU));
+}
+
+static uint16_t *text_row(const gfx2d_surface_t *dst, uint32_t x, uint32_t y)
+{
+    return (uint16_t *)dst->pixels + (size_t)y * dst->stride + x;
+}
+
+static void text_fill(const gfx2d_surface_t *dst, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1)
+{
+    for (uint32_t y = y0; y < y1; y++) {
+        memset(text_row(dst, x0, y), 0, (size_t)(x1 - x0) * 2U);
+    }
+}
+
+/* Pixels text_layer_draw() covers; empty if x0 == x1 */
+static void text_extents(const text_atlas_t *atlas, const gfx2d_surface_t *dst, int32_t x, int32_t y,
+                         uint32_t length, text_slot_t *slot)
+{
+    const int64_t right = (int64_t)dst->width;
+    int64_t y0 = y, y1 = (int64_t)y + atlas->glyph_height;
+    int64_t x0 = x, x1 = x;
+    uint32_t fitting = 0;
+
+    /* Whole glyphs only, as UTIL_LCD_DisplayStringAt() */
+    for (uint32_t i = 0; i < length; i++) {
+        const int64_t gx = (int64_t)x + (int64_t)i * atlas->glyph_width;
+        if (gx >= 0 && gx + atlas->glyph_width <= right) {
+            x0 = (fitting == 0) ? gx : x0;
+            x1 = gx + atlas->glyph_width;
+            fitting++;
+        }
+    }
+    y0 = (y0 < 0) ? 0 : y0;
+    y1 = (y1 > (int64_t)dst->height) ? (int64_t)dst->height : y1;
+    if (fitting == 0 || y0 >= y1) {
+        slot->x0 = slot->x1 = slot->y0 = slot->y1 = 0;
+        return;
+    }
+    slot->x0 = (uint16_t)x0;
+    slot->x1 = (uint16_t)x1;
+    slot->y0 = (uint16_t)y0;
+    slot->y1 = (uint16_t)y1;
+}
+
+static bool text_overlaps(const text_slot_t *slot, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    return slot->x0 < slot->x1 && x0 < slot->x1 && slot->x0 < x1 && y0 < slot->y1 && slot->y0 < y1;
+}
+
+/* The display reads the buffer from memory, not through the CPU cache */
+static void text_flush(const text_layer_t *layer, const text_slot_t *slot)
+{
+#ifndef APP_HOST_BUILD
+    for (uint32_t y = slot->y0; y < slot->y1; y++) {
+        SCB_CleanDCache_by_Addr((void *)text_row(&layer->surface, slot->x0, y), (int32_t)(slot->x1 - slot->x0) * 2);
+    }
+#else
+    (void)layer;
+    (void)slot;
+#endif
+}
+
+/* Pixels of other slots under self were overwritten. Slots not printed yet in
+ * this frame redraw when printed; with redraw, the printed ones (which self
+ * covered legitimately unless it was just erased) are restored now. */
+static void text_repair(text_layer_t *layer, const text_slot_t *self, bool redraw)
+{
+    for (uint32_t s = 0; s < TEXT_LAYER_MAX_SLOTS; s++) {
+        text_slot_t *other = &layer->slots[layer->active][s];
+        if (other == self || !text_overlaps(other, self->x0, self->y0, self->x1, self->y1)) {
+            continue;
+        }
+        if (!other->printed) {
+            other->intact = false;
+        } else if (redraw) {
+            layer->stats.glyphs += text_layer_draw(other->atlas, &layer->surface, other->x, other->y, other->text);
+            text_flush(layer, other);
+        }
+    }
+}
+
+static void text_erase(text_layer_t *layer, text_slot_t *slot)
+{
+    if (slot->x0 < slot->x1) {
+        text_fill(&layer->surface, slot->x0, slot->y0, slot->x1, slot->y1);
+        text_flush(layer, slot);
+        text_repair(layer, slot, true);
+        layer->stats.erases++;
+    }
+    slot->x0 = slot->x1 = slot->y0 = slot->y1 = 0;
+    slot->text[0] = '\0';
+    slot->atlas = NULL;
+    slot->intact = false;
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+size_t text_atlas_size(const sFONT *font)
+{
+    if (font == NULL) {
+        return 0;
+    }
+    return (size_t)TEXT_LAYER_GLYPH_COUNT * font->Width * font->Height * sizeof(uint16_t);
+}
+
+int text_atlas_init(text_atlas_t *atlas, const sFONT *font, uint32_t fg_argb8888, uint32_t bg_argb8888,
+                    void *storage, size_t size)
+{
+    if (atlas == NULL || font == NULL || font->table == NULL || storage == NULL ||
+        font->Width == 0 || font->Width > 24 || font->Height == 0 || size < text_atlas_size(font) ||
+        ((uintptr_t)storage & 1U) != 0) {
+        return -1;
+    }
+
+    const uint32_t width = font->Width;
+    const uint32_t bytes = (width + 7U) / 8U;
+    const uint32_t offset = 8U * bytes - width;
+    const uint16_t fg = text_to_argb4444(fg_argb8888);
+    const uint16_t bg = text_to_argb4444(bg_argb8888);
+    uint16_t *out = (uint16_t *)storage;
+
+    for (uint32_t g = 0; g < TEXT_LAYER_GLYPH_COUNT; g++) {
+        const uint8_t *glyph = &font->table[g * font->Height * bytes];
+        for (uint32_t row = 0; row < font->Height; row++, glyph += bytes) {
+            uint32_t line = 0;
+            for (uint32_t b = 0; b < bytes; b++) {
+                line = (line << 8) | glyph[b];
+            }
+            for (uint32_t j = 0; j < width; j++) {
+                *out++ = (line & (1U << (width - j + offset - 1U))) ? fg : bg;
+            }
+        }
+    }
+
+    atlas->pixels = (uint16_t *)storage;
+    atlas->glyph_width = font->Width;
+    atlas->glyph_height = font->Height;
+    return 0;
+}
+
+uint32_t text_layer_draw(const text_atlas_t *atlas, const gfx2d_surface_t *dst, int32_t x, int32_t y,
+                         const char *text)
+{
+    uint32_t drawn = 0;
+
+    if (atlas == NULL || atlas->pixels == NULL || dst == NULL || dst->pixels == NULL || text == NULL ||
+        dst->format != GFX2D_FORMAT_ARGB4444) {
+        return 0;
+    }
+
+    const uint32_t gw = atlas->glyph_width, gh = atlas->glyph_height;
+    const int64_t y1 = (int64_t)y + gh;
+    const uint32_t row0 = (y < 0) ? (uint32_t)-(int64_t)y : 0U;
+    const uint32_t row1 = (y1 > (int64_t)dst->height) ? (uint32_t)((int64_t)dst->height - y) : gh;
+    if ((int64_t)y >= (int64_t)dst->height || y1 <= 0) {
+        return 0;
+    }
+
+    for (int64_t gx = x; *text != '\0'; text++, gx += gw) {
+        if (gx < 0 || gx + gw > dst->width) {
+            continue;
+        }
+        uint32_t c = (uint8_t)*text - (uint32_t)TEXT_LAYER_FIRST_CHAR;
+        c = (c < TEXT_LAYER_GLYPH_COUNT) ? c : 0U;
+        const uint16_t *src = atlas->pixels + (size_t)c * gw * gh + (size_t)row0 * gw;
+        for (uint32_t row = row0; row < row1; row++, src += gw) {
+            memcpy(text_row(dst, (uint32_t)gx, (uint32_t)(y + (int32_t)row)), src, gw * 2U);
+        }
+        drawn++;
+    }
+    return drawn;
+}
+
+void text_layer_init(text_layer_t *layer)
+{
+    if (layer == NULL) {
+        return;
+    }
+    memset(layer, 0, sizeof(*layer));
+}
+
+int text_layer_begin_frame(text_layer_t *layer, uint32_t buffer, const gfx2d_surface_t *surface)
+{
+    if (layer == NULL || surface == NULL || surface->pixels == NULL || buffer >= TEXT_LAYER_BUFFER_COUNT ||
+        surface->format != GFX2D_FORMAT_ARGB4444) {
+        return -1;
+    }
+
+    layer->active = buffer;
+    layer->surface = *surface;
+    for (uint32_t s = 0; s < TEXT_LAYER_MAX_SLOTS; s++) {
+        layer->slots[buffer][s].printed = false;
+    }
+    return 0;
+}
+
+void text_layer_damage(text_layer_t *layer, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    if (layer == NULL) {
+        return;
+    }
+    for (uint32_t s = 0; s < TEXT_LAYER_MAX_SLOTS; s++) {
+        text_slot_t *slot = &layer->slots[layer->active][s];
+        if (text_overlaps(slot, x0, y0, x1, y1)) {
+            slot->intact = false;
+        }
+    }
+}
+
+int text_layer_print(text_layer_t *layer, uint32_t slot_index, const text_atlas_t *atlas, int32_t x, int32_t y,
+                     const char *text)
+{
+    if (layer == NULL || atlas == NULL || text == NULL || slot_index >= TEXT_LAYER_MAX_SLOTS ||
+        layer->surface.pixels == NULL) {
+        return -1;
+    }
+
+    text_slot_t *slot = &layer->slots[layer->active][slot_index];
+    const size_t length = strnlen(text, TEXT_LAYER_MAX_CHARS);
+    layer->stats.prints++;
+    slot->printed = true;
+
+    if (slot->intact && slot->atlas == atlas && slot->x == x && slot->y == y &&
+        strncmp(slot->text, text, length) == 0 && slot->text[length] == '\0') {
+        return 0;
+    }
+
+    text_slot_t next = *slot;
+    text_extents(atlas, &layer->surface, x, y, (uint32_t)length, &next);
+    /* Only what the new string will not overwrite needs clearing */
+    if (slot->x0 < slot->x1 && (next.x0 > slot->x0 || next.x1 < slot->x1 || next.y0 > slot->y0 ||
+                                next.y1 < slot->y1)) {
+        text_erase(layer, slot);
+    }
+
+    memcpy(next.text, text, length);
+    next.text[length] = '\0';
+    next.atlas = atlas;
+    next.x = x;
+    next.y = y;
+    next.intact = true;
+    next.printed = true;
+    *slot = next;
+
+    layer->stats.glyphs += text_layer_draw(atlas, &layer->surface, x, y, slot->text);
+    layer->stats.redraws++;
+    text_flush(layer, slot);
+    /* Slots printed later in the frame still go on top */
+    text_repair(layer, slot, false);
+    return 1;
+}
+
+void text_layer_end_frame(text_layer_t *layer)
+{
+    if (layer == NULL || layer->surface.pixels == NULL) {
+        return;
+    }
+    for (uint32_t s = 0; s < TEXT_LAYER_MAX_SLOTS; s++) {
+        text_slot_t *slot = &layer->slots[layer->active][s];
+        if (!slot->printed && slot->x0 < slot->x1) {
+            text_erase(layer, slot);
+        }
+    }
+}
+
+void text_layer_get_stats(const text_layer_t *layer, text_layer_stats_t *stats)
+{
+    if (layer == NULL || stats == NULL) {
+        return;
+    }
+    *stats = layer->stats;
+}
+
+uint32_t text_format_u32(char *out, uint32_t value)
+{
+    char digits[10];
+    uint32_t n = 0;
+
+    do {
+        digits[n++] = (char)('0' + value % 10U);
+        value /= 10U;
+    } while (value != 0);
+
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = digits[n - 1U - i];
+    }
+    out[n] = '\0';
+    return n;
+}
+
+uint32_t text_format_fixed(char *out, float value, uint32_t decimals)
+{
+    static const uint32_t scale[] = { 1U, 10U, 100U, 1000U };
+    uint32_t n = 0;
+
+    decimals = (decimals < 3U) ? decimals : 3U;
+    if (value < 0.0f) {
+        value = -value;
+        out[n++] = '-';
+    }
+
+    const uint32_t scaled = (uint32_t)(value * (float)scale[decimals] + 0.5f);
+    n += text_format_u32(&out[n], scaled / scale[decimals]);
+    if (decimals > 0) {
+        uint32_t frac = scaled % scale[decimals];
+        out[n++] = '.';
+        for (uint32_t d = decimals; d > 0; d--) {
+            out[n + d - 1U] = (char)('0' + frac % 10U);
+            frac /= 10U;
+        }
+        n += decimals;
+        out[n] = '\0';
+    }
+    /* "-0.0" reads as a glitch on screen */
+    if (out[0] == '-' && scaled == 0) {
+        memmove(out, out + 1, n);
+        n--;
+    }
+    return n;
+}
@@ -0,0 +1,298 @@
+/**
+ ******************************************************************************
+ * @file    tile_delta.c
+ * @author  PeleAB
+ * @brief   Tile delta coding of streamed frames against the host's copy
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "tile_delta.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+static inline uint32_t tile_delta_absdiff(uint32_t a, uint32_t b)
+{
+    return (a > b) ? a - b : b - a;
+}
+
+/* Largest channel difference of two pixels, 8-bit units */
+static inline uint32_t tile_delta_pixel_diff(const uint8_t *a, const uint8_t *b, uint32_t bpp)
+{
+    uint32_t diff = 0;
+
+    if (bpp == 2) {
+        const uint32_t pa = (uint32_t)a[0] | ((uint32_t)a[1] << 8);
+        const uint32_t pb = (uint32_t)b[0] | ((uint32_t)b[1] << 8);
+        const uint32_t dr = tile_delta_absdiff((pa >> 11) & 0x1F, (pb >> 11) & 0x1F) << 3;
+        const uint32_t dg = tile_delta_absdiff((pa >> 5) & 0x3F, (pb >> 5) & 0x3F) << 2;
+        const uint32_t db = tile_delta_absdiff(pa & 0x1F, pb & 0x1F) << 3;
+        diff = (dr > dg) ? dr : dg;
+        return (db > diff) ? db : diff;
+    }
+    for (uint32_t c = 0; c < bpp; c++) {
+        const uint32_t d = tile_delta_absdiff(a[c], b[c]);
+        diff = (d > diff) ? d : diff;
+    }
+    return diff;
+}
+
+/* Pixel rectangle of a tile, clipped to the frame */
+static void tile_delta_tile_rect(const tile_delta_t *delta, uint32_t tile, uint32_t *x0,
+                                 uint32_t *y0, uint32_t *w, uint32_t *h)
+{
+    *x0 = (tile % delta->tiles_x) * TILE_DELTA_TILE_SIZE;
+    *y0 = (tile / delta->tiles_x) * TILE_DELTA_TILE_SIZE;
+    *w = (delta->width - *x0 < TILE_DELTA_TILE_SIZE) ? delta->width - *x0 : TILE_DELTA_TILE_SIZE;
+    *h = (delta->height - *y0 < TILE_DELTA_TILE_SIZE) ? delta->height - *y0 : TILE_DELTA_TILE_SIZE;
+}
+
+static inline const uint8_t *tile_delta_frame_pixel(const tile_delta_frame_t *frame,
+                                                    uint32_t x, uint32_t y)
+{
+    return frame->pixels + y * frame->stride + x * frame->step * frame->bpp;
+}
+
+/* Whether a tile drifted past the thresholds from the reference */
+static bool tile_delta_tile_changed(const tile_delta_t *delta, const tile_delta_frame_t *frame,
+                                    uint32_t tile)
+{
+    uint32_t x0, y0, w, h;
+    tile_delta_tile_rect(delta, tile, &x0, &y0, &w, &h);
+
+    const uint32_t sad_limit = delta->config.sad_threshold * w * h;
+    const uint32_t ref_stride = delta->width * delta->bpp;
+    const uint32_t src_step = frame->step * frame->bpp;
+    uint32_t sad = 0;
+
+    for (uint32_t y = 0; y < h; y++) {
+        const uint8_t *src = tile_delta_frame_pixel(frame, x0, y0 + y);
+        const uint8_t *ref = delta->reference + (y0 + y) * ref_stride + x0 * delta->bpp;
+        for (uint32_t x = 0; x < w; x++, src += src_step, ref += delta->bpp) {
+            const uint32_t diff = tile_delta_pixel_diff(src, ref, delta->bpp);
+            sad += diff;
+            if (diff > delta->config.pixel_threshold) {
+                return true;
+            }
+        }
+        if (sad > sad_limit) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+void tile_delta_default_config(tile_delta_config_t *config)
+{
+    config->sad_threshold = TILE_DELTA_DEFAULT_SAD;
+    config->pixel_threshold = TILE_DELTA_DEFAULT_PIXEL;
+    config->keyframe_interval = TILE_DELTA_DEFAULT_KEYFRAME;
+}
+
+int tile_delta_init(tile_delta_t *delta, const tile_delta_config_t *config,
+                    uint8_t *reference, uint32_t capacity)
+{
+    if (delta == NULL || reference == NULL || capacity == 0) {
+        return -1;
+    }
+
+    memset(delta, 0, sizeof(*delta));
+    if (config != NULL) {
+        delta->config = *config;
+    } else {
+        tile_delta_default_config(&delta->config);
+    }
+    delta->reference = reference;
+    delta->capacity = capacity;
+    return 0;
+}
+
+int tile_delta_plan(tile_delta_t *delta, const tile_delta_frame_t *frame)
+{
+    if (frame == NULL || frame->pixels == NULL || frame->width == 0 || frame->height == 0 ||
+        frame->bpp == 0 || frame->bpp > TILE_DELTA_MAX_BPP || frame->step == 0) {
+        return -1;
+    }
+
+    const uint32_t tiles_x = (frame->width + TILE_DELTA_TILE_SIZE - 1) / TILE_DELTA_TILE_SIZE;
+    const uint32_t tiles_y = (frame->height + TILE_DELTA_TILE_SIZE - 1) / TILE_DELTA_TILE_SIZE;
+    if (tiles_x * tiles_y > TILE_DELTA_MAX_TILES ||
+        (uint64_t)frame->width * frame->height * frame->bpp > delta->capacity) {
+        return -1;
+    }
+
+    delta->keyframe = !delta->valid || delta->keyframe_requested ||
+                      frame->width != delta->width || frame->height != delta->height ||
+                      frame->bpp != delta->bpp ||
+                      (delta->config.keyframe_interval > 0 &&
+                       delta->frames_since_keyframe + 1 >= delta->config.keyframe_interval);
+    if (delta->keyframe) {
+        /* Host copy unknown: the geometry is the new frame's from now on */
+        delta->valid = false;
+        delta->width = frame->width;
+        delta->height = frame->height;
+        delta->bpp = frame->bpp;
+    }
+    delta->tiles_x = tiles_x;
+    delta->tiles_y = tiles_y;
+
+    delta->changed_count = 0;
+    for (uint32_t tile = 0; tile < tiles_x * tiles_y; tile++) {
+        if (delta->keyframe || tile_delta_tile_changed(delta, frame, tile)) {
+            delta->changed[delta->changed_count++] = (uint16_t)tile;
+        }
+    }
+    return (int)delta->changed_count;
+}
+
+uint32_t tile_delta_payload_size(const tile_delta_t *delta)
+{
+    uint32_t size = sizeof(tile_delta_header_t);
+
+    for (uint32_t i = 0; i < delta->changed_count; i++) {
+        uint32_t x0, y0, w, h;
+        tile_delta_tile_rect(delta, delta->changed[i], &x0, &y0, &w, &h);
+        size += sizeof(uint16_t) + w * h * delta->bpp;
+    }
+    return size;
+}
+
+void tile_delta_get_header(const tile_delta_t *delta, const char *tag, tile_delta_header_t *header)
+{
+    memset(header, 0, sizeof(*header));
+    strncpy(header->frame_type, tag, 3);
+    header->width = delta->width;
+    header->height = delta->height;
+    header->bpp = (uint8_t)delta->bpp;
+    header->flags = delta->keyframe ? TILE_DELTA_FLAG_KEYFRAME : 0;
+    header->tile_size = TILE_DELTA_TILE_SIZE;
+    header->frame_id = (uint16_t)(delta->frame_id + 1U);
+    header->base_id = delta->keyframe ? header->frame_id : delta->frame_id;
+    header->tile_count = delta->changed_count;
+}
+
+uint32_t tile_delta_copy_tile(const tile_delta_t *delta, const tile_delta_frame_t *frame,
+                              uint32_t tile, uint8_t *out)
+{
+    uint32_t x0, y0, w, h;
+    tile_delta_tile_rect(delta, tile, &x0, &y0, &w, &h);
+
+    uint8_t *dest = out;
+    for (uint32_t y = 0; y < h; y++) {
+        const uint8_t *src = tile_delta_frame_pixel(frame, x0, y0 + y);
+        if (frame->step == 1) {
+            memcpy(dest, src, w * frame->bpp);
+            dest += w * frame->bpp;
+            continue;
+        }
+        for (uint32_t x = 0; x < w; x++, src += frame->step * frame->bpp, dest += frame->bpp) {
+            memcpy(dest, src, frame->bpp);
+        }
+    }
+    return (uint32_t)(dest - out);
+}
+
+void tile_delta_commit(tile_delta_t *delta, const tile_delta_frame_t *frame)
+{
+    const uint32_t ref_stride = delta->width * delta->bpp;
+    uint8_t tile_pixels[TILE_DELTA_TILE_BYTES];
+
+    for (uint32_t i = 0; i < delta->changed_count; i++) {
+        uint32_t x0, y0, w, h;
+        tile_delta_tile_rect(delta, delta->changed[i], &x0, &y0, &w, &h);
+        tile_delta_copy_tile(delta, frame, delta->changed[i], tile_pixels);
+        for (uint32_t y = 0; y < h; y++) {
+            memcpy(delta->reference + (y0 + y) * ref_stride + x0 * delta->bpp,
+                   &tile_pixels[y * w * delta->bpp], w * delta->bpp);
+        }
+    }
+
+    delta->frame_id++;
+    delta->valid = true;
+    delta->stats.frames++;
+    delta->stats.tiles_sent += delta->changed_count;
+    delta->stats.tiles_total += delta->tiles_x * delta->tiles_y;
+    if (delta->keyframe) {
+        delta->keyframe_requested = false;
+        delta->frames_since_keyframe = 0;
+        delta->stats.keyframes++;
+    } else {
+        delta->frames_since_keyframe++;
+    }
+    delta->changed_count = 0;
+}
+
+void tile_delta_request_keyframe(tile_delta_t *delta)
+{
+    delta->keyframe_requested = true;
+}
+
+int tile_delta_apply(uint8_t *image, uint32_t capacity, uint16_t *image_id,
+                     const uint8_t *payload, uint32_t size)
+{
+    tile_delta_header_t header;
+
+    if (size < sizeof(header)) {
+        return -1;
+    }
+    memcpy(&header, payload, sizeof(header));
+    if (header.bpp == 0 || header.bpp > TILE_DELTA_MAX_BPP || header.tile_size == 0 ||
+        (uint64_t)header.width * header.height * header.bpp > capacity) {
+        return -1;
+    }
+    if (!(header.flags & TILE_DELTA_FLAG_KEYFRAME) && header.base_id != *image_id) {
+        return -2;
+    }
+
+    const uint32_t tiles_x = (header.width + header.tile_size - 1) / header.tile_size;
+    const uint32_t tiles_y = (header.height + header.tile_size - 1) / header.tile_size;
+    const uint32_t stride = header.width * header.bpp;
+    uint32_t pos = sizeof(header);
+
+    for (uint32_t i = 0; i < header.tile_count; i++) {
+        if (size - pos < sizeof(uint16_t)) {
+            return -1;
+        }
+        const uint32_t tile = (uint32_t)payload[pos] | ((uint32_t)payload[pos + 1] << 8);
+        pos += sizeof(uint16_t);
+        if (tile >= tiles_x * tiles_y) {
+            return -1;
+        }
+
+        const uint32_t x0 = (tile % tiles_x) * header.tile_size;
+        const uint32_t y0 = (tile / tiles_x) * header.tile_size;
+        const uint32_t w = (header.width - x0 < header.tile_size) ? header.width - x0 : header.tile_size;
+        const uint32_t h = (header.height - y0 < header.tile_size) ? header.height - y0 : header.tile_size;
+        if (size - pos < w * h * header.bpp) {
+            return -1;
+        }
+        for (uint32_t y = 0; y < h; y++, pos += w * header.bpp) {
+            memcpy(image + (y0 + y) * stride + x0 * header.bpp, &payload[pos], w * header.bpp);
+        }
+    }
+
+    *image_id = header.frame_id;
+    return (pos == size) ? 0 : -1;
+}
+
+void tile_delta_get_stats(const tile_delta_t *delta, tile_delta_stats_t *stats)
+{
+    *stats = delta->stats;
+}
@@ -0,0 +1,342 @@
+/**
+ ******************************************************************************
+ * @file    uart_tx_queue.c
+ * @author  PeleAB
+ * @brief   Asynchronous packet transmit queue for the PC stream UART
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "uart_tx_queue.h"
+#include "perf_monitor.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifndef APP_HOST_BUILD
+#include "main.h"
+#define UART_TX_ENTER_CRITICAL()        uint32_t uart_tx_primask = __get_PRIMASK(); __disable_irq()
+#define UART_TX_EXIT_CRITICAL()         __set_PRIMASK(uart_tx_primask)
+#else
+#define UART_TX_ENTER_CRITICAL()        do { } while (0)
+#define UART_TX_EXIT_CRITICAL()         do { } while (0)
+#endif
+
+#define UART_TX_QUEUE_MASK              (UART_TX_QUEUE_DEPTH - 1U)
+#define UART_TX_ARENA_SPAN(size)        (((size) + 3U) & ~3U)   /* Payloads stay word aligned */
+
+#if (UART_TX_QUEUE_DEPTH & (UART_TX_QUEUE_DEPTH - 1)) != 0
+#error "UART_TX_QUEUE_DEPTH must be a power of two"
+#endif
+
+/* Packet segments, in wire order */
+enum {
+    UART_TX_SEGMENT_HEAD = 0,
+    UART_TX_SEGMENT_PAYLOAD,
+    UART_TX_SEGMENT_TAIL,
+    UART_TX_SEGMENT_DONE,
+    UART_TX_SEGMENT_ABORTED,
+};
+
+/* ========================================================================= */
+/* PRIVATE HELPERS                                                           */
+/* ========================================================================= */
+
+/* Contiguous block of size bytes leaving at least keep bytes free, or -1.
+ * Blocks are released oldest first; a block that does not fit before the end
+ * of the arena starts over at 0 and the end stays unused until then. */
+static int64_t uart_tx_arena_alloc(uart_tx_queue_t *queue, uint32_t size, uint32_t keep)
+{
+    const uint32_t rd = queue->arena_rd, wr = queue->arena_wr, end = queue->arena_size;
+
+    if (queue->arena_live == 0) {
+        queue->arena_rd = 0;
+        queue->arena_wr = 0;
+        return ((uint64_t)size + keep <= end) ? 0 : -1;
+    }
+    if (wr == rd) {
+        return -1;
+    }
+    if (wr > rd) {
+        if ((uint64_t)wr + size <= end && (uint64_t)(end - wr - size) + rd >= keep) {
+            return wr;
+        }
+        return ((uint64_t)size + keep <= rd) ? 0 : -1;
+    }
+    return ((uint64_t)wr + size + keep <= rd) ? (int64_t)wr : -1;
+}
+
+static void uart_tx_release(uart_tx_queue_t *queue, const uart_tx_packet_t *packet)
+{
+    if (packet->payload_size == 0) {
+        return;
+    }
+    queue->arena_rd = packet->arena_end;
+    queue->arena_live--;
+}
+
+static const uint8_t *uart_tx_segment(const uart_tx_packet_t *packet, uint32_t *size)
+{
+    switch (packet->segment) {
+    case UART_TX_SEGMENT_HEAD:
+        *size = packet->head_size;
+        return packet->head;
+    case UART_TX_SEGMENT_PAYLOAD:
+        *size = packet->payload_size;
+        return packet->payload;
+    case UART_TX_SEGMENT_TAIL:
+        *size = packet->tail_size;
+        return packet->tail;
+    default:
+        *size = 0;
+        return NULL;
+    }
+}
+
+/* Wire bytes of a packet not sent yet */
+static uint32_t uart_tx_packet_pending(const uart_tx_packet_t *packet)
+{
+    uint32_t pending = 0;
+    switch (packet->segment) {
+    case UART_TX_SEGMENT_HEAD:
+        pending += packet->head_size + packet->payload_size;
+        break;
+    case UART_TX_SEGMENT_PAYLOAD:
+        pending += packet->payload_size;
+        break;
+    case UART_TX_SEGMENT_TAIL:
+        break;
+    default:
+        return 0;
+    }
+    return pending + packet->tail_size - packet->sent;
+}
+
+/* Start the next transfer if the transmitter is free; called with interrupts masked */
+static void uart_tx_kick(uart_tx_queue_t *queue)
+{
+    while (!queue->busy && queue->tail != queue->head) {
+        uart_tx_packet_t *packet = &queue->packets[queue->tail & UART_TX_QUEUE_MASK];
+        uint32_t size;
+        const uint8_t *data = uart_tx_segment(packet, &size);
+
+        if (packet->segment >= UART_TX_SEGMENT_DONE) {
+            if (packet->segment == UART_TX_SEGMENT_DONE) {
+                queue->stats.packets_sent++;
+            }
+            uart_tx_release(queue, packet);
+            queue->tail = queue->tail + 1U;
+            continue;
+        }
+        if (packet->sent >= size) {
+            packet->segment++;
+            packet->sent = 0;
+            continue;
+        }
+
+        const uint32_t chunk = (size - packet->sent < UART_TX_MAX_CHUNK) ? size - packet->sent : UART_TX_MAX_CHUNK;
+        queue->busy = true;
+        queue->in_flight = chunk;
+        if (queue->port.start(queue->port.ctx, data + packet->sent, chunk) != 0) {
+            queue->busy = false;
+            queue->stats.errors++;
+            packet->segment = UART_TX_SEGMENT_ABORTED;
+        }
+    }
+}
+
+/* ========================================================================= */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================= */
+
+int uart_tx_queue_init(uart_tx_queue_t *queue, const uart_tx_port_t *port, uint8_t *arena,
+                       uint32_t arena_size, uint32_t reserve, uint32_t wait_us)
+{
+    if (queue == NULL || port == NULL || port->start == NULL || arena == NULL || arena_size == 0 ||
+        reserve >= arena_size || ((uintptr_t)arena & 3U) != 0) {
+        return -1;
+    }
+
+    memset(queue, 0, sizeof(*queue));
+    queue->port = *port;
+    queue->arena = arena;
+    queue->arena_size = arena_size;
+    queue->arena_reserve = reserve;
+    queue->timeout_cycles = wait_us * perf_monitor_cycles_per_us();
+    return 0;
+}
+
+uint8_t *uart_tx_queue_reserve(uart_tx_queue_t *queue, uint32_t size, uart_tx_class_t packet_class)
+{
+    if (queue == NULL || queue->arena == NULL || queue->reserved != NULL) {
+        return NULL;
+    }
+
+    const bool droppable = (packet_class == UART_TX_DROPPABLE);
+    const uint32_t slots = droppable ? UART_TX_QUEUE_DEPTH - UART_TX_RELIABLE_SLOTS : UART_TX_QUEUE_DEPTH;
+    const uint32_t keep = droppable ? queue->arena_reserve : 0U;
+    const uint32_t span = UART_TX_ARENA_SPAN(size);
+    bool waited = false;
+    uint32_t t0 = 0;
+
+    for (;;) {
+        int64_t offset = -1;
+        bool drained;
+        {
+            UART_TX_ENTER_CRITICAL();
+            if (queue->head - queue->tail < slots) {
+                offset = (size == 0) ? 0 : uart_tx_arena_alloc(queue, span, keep);
+            }
+            if (offset >= 0) {
+                queue->reserved_prev_wr = queue->arena_wr;
+                if (size > 0) {
+                    queue->arena_wr = (uint32_t)offset + span;
+                    queue->arena_live++;
+                }
+            }
+            drained = (queue->head == queue->tail);
+            UART_TX_EXIT_CRITICAL();
+        }
+
+        if (offset >= 0) {
+            queue->reserved = queue->arena + offset;
+            queue->reserved_size = size;
+            return queue->reserved;
+        }
+        if (droppable) {
+            queue->stats.packets_dropped++;
+            return NULL;
+        }
+        if (!waited) {
+            waited = true;
+            t0 = perf_monitor_now();
+            queue->stats.reliable_waits++;
+        }
+        /* Nothing left to wait for, or the transmitter is stuck */
+        if (drained || perf_monitor_now() - t0 > queue->timeout_cycles) {
+            queue->stats.reliable_failures++;
+            return NULL;
+        }
+        if (queue->port.poll != NULL) {
+            queue->port.poll(queue->port.ctx);
+        }
+    }
+}
+
+int uart_tx_queue_commit(uart_tx_queue_t *queue, const uint8_t *head, uint32_t head_size,
+                         const uint8_t *tail, uint32_t tail_size)
+{
+    if (queue == NULL || queue->reserved == NULL) {
+        return -1;
+    }
+    if (head_size > UART_TX_MAX_HEAD || tail_size > UART_TX_MAX_TAIL ||
+        (head == NULL && head_size > 0) || (tail == NULL && tail_size > 0)) {
+        uart_tx_queue_cancel(queue);
+        return -1;
+    }
+
+    /* The reservation holds a descriptor, only the producer moves head */
+    uart_tx_packet_t *packet = &queue->packets[queue->head & UART_TX_QUEUE_MASK];
+    if (head_size > 0) {
+        memcpy(packet->head, head, head_size);
+    }
+    if (tail_size > 0) {
+        memcpy(packet->tail, tail, tail_size);
+    }
+    packet->head_size = (uint8_t)head_size;
+    packet->tail_size = (uint8_t)tail_size;
+    packet->segment = UART_TX_SEGMENT_HEAD;
+    packet->payload = queue->reserved;
+    packet->payload_size = queue->reserved_size;
+    packet->sent = 0;
+    packet->arena_end = (uint32_t)(queue->reserved - queue->arena) + UART_TX_ARENA_SPAN(queue->reserved_size);
+    queue->reserved = NULL;
+    queue->stats.packets_queued++;
+
+    UART_TX_ENTER_CRITICAL();
+    queue->head = queue->head + 1U;
+    const uint32_t depth = queue->head - queue->tail;
+    if (depth > queue->stats.max_depth) {
+        queue->stats.max_depth = depth;
+    }
+    uart_tx_kick(queue);
+    UART_TX_EXIT_CRITICAL();
+    return 0;
+}
+
+void uart_tx_queue_cancel(uart_tx_queue_t *queue)
+{
+    if (queue == NULL || queue->reserved == NULL) {
+        return;
+    }
+
+    UART_TX_ENTER_CRITICAL();
+    if (queue->reserved_size > 0) {
+        queue->arena_wr = queue->reserved_prev_wr;
+        queue->arena_live--;
+    }
+    UART_TX_EXIT_CRITICAL();
+    queue->reserved = NULL;
+}
+
+void uart_tx_queue_on_complete(uart_tx_queue_t *queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+
+    UART_TX_ENTER_CRITICAL();
+    if (queue->busy) {
+        uart_tx_packet_t *packet = &queue->packets[queue->tail & UART_TX_QUEUE_MASK];
+        packet->sent += queue->in_flight;
+        queue->stats.bytes_sent += queue->in_flight;
+        queue->busy = false;
+        uart_tx_kick(queue);
+    }
+    UART_TX_EXIT_CRITICAL();
+}
+
+void uart_tx_queue_on_error(uart_tx_queue_t *queue)
+{
+    if (queue == NULL) {
+        return;
+    }
+
+    UART_TX_ENTER_CRITICAL();
+    if (queue->busy) {
+        queue->packets[queue->tail & UART_TX_QUEUE_MASK].segment = UART_TX_SEGMENT_ABORTED;
+        queue->stats.errors++;
+        queue->busy = false;
+        uart_tx_kick(queue);
+    }
+    UART_TX_EXIT_CRITICAL();
+}
+
+bool uart_tx_queue_idle(const uart_tx_queue_t *queue)
+{
+    return queue == NULL || queue->head == queue->tail;
+}
+
+void uart_tx_queue_get_stats(const uart_tx_queue_t *queue, uart_tx_stats_t *stats)
+{
+    if (queue == NULL || stats == NULL) {
+        return;
+    }
+
+    UART_TX_ENTER_CRITICAL();
+    *stats = queue->stats;
+    stats->depth = queue->head - queue->tail;
+    stats->bytes_pending = 0;
+    for (uint32_t i = queue->tail; i != queue->head; i++) {
+        stats->bytes_pending += uart_tx_packet_pending(&queue->packets[i & UART_TX_QUEUE_MASK]);
+    }
+    UART_TX_EXIT_CRITICAL();
+}
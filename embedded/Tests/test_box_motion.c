@@ -0,0 +1,224 @@
+/**
+ ******************************************************************************
+ * @file    test_box_motion.c
+ * @author  PeleAB
+ * @brief   Host tests for the display box motion model
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "box_motion.h"
+#include "test_common.h"
+#include <string.h>
+
+#define EPS     1e-4f
+
+static box_motion_t motion;
+
+static box_motion_box_t make_box(float x, float y, float size, float prob)
+{
+    box_motion_box_t b;
+    memset(&b, 0, sizeof(b));
+    b.x_center = x;
+    b.y_center = y;
+    b.width = size;
+    b.height = size;
+    b.prob = prob;
+    b.kps[0].x = x - size / 4;
+    b.kps[0].y = y;
+    b.kps[1].x = x + size / 4;
+    b.kps[1].y = y;
+    return b;
+}
+
+static void init(uint32_t max_extrapolation_ms)
+{
+    box_motion_config_t config;
+    box_motion_default_config(&config);
+    config.velocity_gain = 0.5f;
+    config.max_extrapolation_ms = max_extrapolation_ms;
+    TEST_ASSERT_EQ(box_motion_init(&motion, &config, 2), 0);
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_new_box_stays_put(void)
+{
+    box_motion_box_t in = make_box(0.5f, 0.5f, 0.2f, 0.9f), out[2];
+
+    init(150);
+    TEST_ASSERT_EQ(box_motion_update(&motion, &in, 1, 1000), 0);
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 1000, out, 2), 1U);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.5f, EPS);
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 1100, out, 2), 1U);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.5f, EPS);
+    TEST_ASSERT_NEAR(out[0].kps[1].x, 0.55f, EPS);
+    TEST_ASSERT_NEAR(out[0].prob, 0.9f, EPS);
+}
+
+static void test_extrapolates_and_stops_at_horizon(void)
+{
+    box_motion_box_t in, out[1];
+
+    init(150);
+    in = make_box(0.30f, 0.50f, 0.2f, 0.8f);
+    box_motion_update(&motion, &in, 1, 1000);
+    in = make_box(0.40f, 0.45f, 0.2f, 0.7f);
+    box_motion_update(&motion, &in, 1, 1100);
+
+    /* 0.001 per ms in x, -0.0005 in y */
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 1150, out, 1), 1U);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.45f, EPS);
+    TEST_ASSERT_NEAR(out[0].y_center, 0.425f, EPS);
+    TEST_ASSERT_NEAR(out[0].kps[0].x, 0.40f, EPS);
+    TEST_ASSERT_NEAR(out[0].width, 0.2f, EPS);
+    TEST_ASSERT_NEAR(out[0].prob, 0.7f, EPS);
+
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 1400, out, 1), 1U);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.55f, EPS);
+}
+
+static void test_interpolates_between_detections(void)
+{
+    box_motion_box_t in, out[1];
+
+    init(150);
+    in = make_box(0.20f, 0.60f, 0.1f, 0.5f);
+    box_motion_update(&motion, &in, 1, 2000);
+    in = make_box(0.25f, 0.55f, 0.2f, 0.6f);
+    box_motion_update(&motion, &in, 1, 2100);
+
+    box_motion_predict(&motion, 2025, out, 1);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.2125f, EPS);
+    TEST_ASSERT_NEAR(out[0].y_center, 0.5875f, EPS);
+    TEST_ASSERT_NEAR(out[0].width, 0.125f, EPS);
+    TEST_ASSERT_NEAR(out[0].prob, 0.6f, EPS);
+
+    /* Before the older detection: hold it */
+    box_motion_predict(&motion, 1900, out, 1);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.20f, EPS);
+}
+
+static void test_velocity_is_smoothed(void)
+{
+    box_motion_box_t in, out[1];
+
+    init(1000);
+    in = make_box(0.10f, 0.5f, 0.3f, 0.5f);
+    box_motion_update(&motion, &in, 1, 0);
+    in = make_box(0.20f, 0.5f, 0.3f, 0.5f);
+    box_motion_update(&motion, &in, 1, 100);     /* v = 0.001 */
+    in = make_box(0.20f, 0.5f, 0.3f, 0.5f);
+    box_motion_update(&motion, &in, 1, 200);     /* measured 0, smoothed 0.0005 */
+
+    box_motion_predict(&motion, 300, out, 1);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.25f, EPS);
+}
+
+static void test_matches_by_overlap(void)
+{
+    box_motion_box_t in[2], out[2];
+
+    init(150);
+    in[0] = make_box(0.20f, 0.5f, 0.2f, 0.5f);
+    in[1] = make_box(0.70f, 0.5f, 0.2f, 0.5f);
+    box_motion_update(&motion, in, 2, 0);
+
+    /* Same faces, reported in the other order */
+    in[0] = make_box(0.72f, 0.5f, 0.2f, 0.5f);
+    in[1] = make_box(0.18f, 0.5f, 0.2f, 0.5f);
+    box_motion_update(&motion, in, 2, 100);
+
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 150, out, 2), 2U);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.73f, EPS);
+    TEST_ASSERT_NEAR(out[1].x_center, 0.17f, EPS);
+}
+
+static void test_lost_and_far_boxes_restart(void)
+{
+    box_motion_box_t in, out[2];
+
+    init(150);
+    in = make_box(0.20f, 0.5f, 0.1f, 0.5f);
+    box_motion_update(&motion, &in, 1, 0);
+
+    /* No overlap: a new box, not a jump */
+    in = make_box(0.80f, 0.5f, 0.1f, 0.5f);
+    box_motion_update(&motion, &in, 1, 100);
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 200, out, 2), 1U);
+    TEST_ASSERT_NEAR(out[0].x_center, 0.80f, EPS);
+
+    TEST_ASSERT_EQ(box_motion_update(&motion, NULL, 0, 200), 0);
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 250, out, 2), 0U);
+}
+
+static void test_prediction_stays_in_frame(void)
+{
+    box_motion_box_t in, out[1];
+
+    init(1000);
+    in = make_box(0.80f, 0.5f, 0.2f, 0.5f);
+    box_motion_update(&motion, &in, 1, 0);
+    in = make_box(0.90f, 0.5f, 0.2f, 0.5f);
+    box_motion_update(&motion, &in, 1, 100);
+
+    box_motion_predict(&motion, 600, out, 1);
+    TEST_ASSERT_NEAR(out[0].x_center, 1.0f, EPS);
+    TEST_ASSERT_NEAR(out[0].kps[1].x, 1.0f, EPS);
+}
+
+static void test_tick_wrap(void)
+{
+    box_motion_box_t in, out[1];
+
+    init(150);
+    in = make_box(0.40f, 0.5f, 0.2f, 0.5f);
+    box_motion_update(&motion, &in, 1, 0xFFFFFFC0U);
+    in = make_box(0.50f, 0.5f, 0.2f, 0.5f);
+    box_motion_update(&motion, &in, 1, 0x24U);      /* 100 ms later */
+
+    box_motion_predict(&motion, 0x56U, out, 1);     /* 50 ms after */
+    TEST_ASSERT_NEAR(out[0].x_center, 0.55f, EPS);
+}
+
+static void test_invalid_arguments(void)
+{
+    box_motion_config_t config;
+    box_motion_box_t out[1];
+
+    box_motion_default_config(&config);
+    TEST_ASSERT(box_motion_init(NULL, NULL, 0) < 0);
+    TEST_ASSERT(box_motion_init(&motion, NULL, BOX_MOTION_MAX_KEYPOINTS + 1) < 0);
+    config.velocity_gain = 0.0f;
+    TEST_ASSERT(box_motion_init(&motion, &config, 0) < 0);
+    TEST_ASSERT_EQ(box_motion_init(&motion, NULL, 5), 0);
+    TEST_ASSERT(box_motion_update(&motion, NULL, 1, 0) < 0);
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 0, NULL, 1), 0U);
+    TEST_ASSERT_EQ(box_motion_predict(&motion, 0, out, 1), 0U);
+}
+
+int main(void)
+{
+    printf("test_box_motion\n");
+    RUN_TEST(test_new_box_stays_put);
+    RUN_TEST(test_extrapolates_and_stops_at_horizon);
+    RUN_TEST(test_interpolates_between_detections);
+    RUN_TEST(test_velocity_is_smoothed);
+    RUN_TEST(test_matches_by_overlap);
+    RUN_TEST(test_lost_and_far_boxes_restart);
+    RUN_TEST(test_prediction_stays_in_frame);
+    RUN_TEST(test_tick_wrap);
+    RUN_TEST(test_invalid_arguments);
+    TEST_EXIT();
+}
@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * @file    test_common.h
+ * @author  PeleAB
+ * @brief   Minimal assertion helpers for the Linux host unit tests
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static int test_failures;
+
+#define TEST_ASSERT(cond)                                                       \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "%s:%d: assertion failed: %s\n", __FILE__, __LINE__, \
+                    #cond);                                                     \
+            test_failures++;                                                    \
+        }                                                                       \
+    } while (0)
+
+#define TEST_ASSERT_EQ(a, b)        TEST_ASSERT((a) == (b))
+
+#define TEST_ASSERT_NEAR(a, b, eps) TEST_ASSERT(((a) - (b)) < (eps) && ((b) - (a)) < (eps))
+
+#define RUN_TEST(fn)                                                            \
+    do {                                                                        \
+        int before = test_failures;                                             \
+        fn();                                                                   \
+        printf("  %-48s %s\n", #fn, (test_failures == before) ? "ok" : "FAIL"); \
+    } while (0)
+
+#define TEST_EXIT()                                                             \
+    do {                                                                        \
+        if (test_failures) {                                                    \
+            fprintf(stderr, "%d assertion(s) failed\n", test_failures);         \
+            return EXIT_FAILURE;                                                \
+        }                                                                       \
+        return EXIT_SUCCESS;                                                    \
+    } while (0)
+
+#endif /* TEST_COMMON_H */
@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file    test_crc32_stream.c
+ * @author  PeleAB
+ * @brief   Host tests for the incremental PC stream CRC32
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "crc32_stream.h"
+#include "test_common.h"
+#include <string.h>
+
+#define PATTERN_SIZE    1027U
+
+static uint8_t pattern[PATTERN_SIZE + 4];
+
+static void fill_pattern(uint8_t *data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++) {
+        data[i] = (uint8_t)(i * 7U);
+    }
+}
+
+/* Values computed by calculate_stm32_crc32() in python_tools/robust_protocol.py */
+static void test_matches_host_decoder(void)
+{
+    TEST_ASSERT_EQ(crc32_stream_compute((const uint8_t *)"", 0), 0xFFFFFFFFU);
+    TEST_ASSERT_EQ(crc32_stream_compute((const uint8_t *)"1", 1), 0x9EFBCF93U);
+    TEST_ASSERT_EQ(crc32_stream_compute((const uint8_t *)"12", 2), 0x3FEC5E6AU);
+    TEST_ASSERT_EQ(crc32_stream_compute((const uint8_t *)"123", 3), 0xD952F164U);
+    TEST_ASSERT_EQ(crc32_stream_compute((const uint8_t *)"1234", 4), 0xC2091428U);
+    TEST_ASSERT_EQ(crc32_stream_compute((const uint8_t *)"123456789", 9), 0xBF99399CU);
+
+    fill_pattern(pattern, PATTERN_SIZE);
+    TEST_ASSERT_EQ(crc32_stream_compute(pattern, PATTERN_SIZE), 0x297F7E4DU);
+}
+
+/* The CRC covers the given bytes only, whatever follows them */
+static void test_exact_length(void)
+{
+    fill_pattern(pattern, PATTERN_SIZE);
+    const uint32_t reference = crc32_stream_compute(pattern, PATTERN_SIZE);
+
+    for (uint32_t junk = 0; junk < 4; junk++) {
+        memset(&pattern[PATTERN_SIZE], (int)(0x11U * (junk + 1U)), 4);
+        TEST_ASSERT_EQ(crc32_stream_compute(pattern, PATTERN_SIZE), reference);
+    }
+    TEST_ASSERT(crc32_stream_compute(pattern, PATTERN_SIZE - 1U) != reference);
+}
+
+static void test_any_split_gives_same_crc(void)
+{
+    fill_pattern(pattern, PATTERN_SIZE);
+    const uint32_t reference = crc32_stream_compute(pattern, PATTERN_SIZE);
+
+    for (uint32_t split = 0; split <= 16; split++) {
+        crc32_stream_t stream;
+        crc32_stream_begin(&stream);
+        crc32_stream_update(&stream, pattern, split);
+        crc32_stream_update(&stream, pattern + split, PATTERN_SIZE - split);
+        TEST_ASSERT_EQ(crc32_stream_end(&stream), reference);
+    }
+
+    /* Pieces of 1 to 7 bytes, starting at every alignment */
+    for (uint32_t piece = 1; piece <= 7; piece++) {
+        crc32_stream_t stream;
+        crc32_stream_begin(&stream);
+        for (uint32_t offset = 0; offset < PATTERN_SIZE; offset += piece) {
+            const uint32_t size = (PATTERN_SIZE - offset < piece) ? PATTERN_SIZE - offset : piece;
+            crc32_stream_update(&stream, pattern + offset, size);
+        }
+        TEST_ASSERT_EQ(stream.length, PATTERN_SIZE);
+        TEST_ASSERT_EQ(crc32_stream_end(&stream), reference);
+    }
+}
+
+static void test_unaligned_source(void)
+{
+    fill_pattern(pattern, PATTERN_SIZE);
+    const uint32_t reference = crc32_stream_compute(pattern, 1000);
+
+    for (uint32_t shift = 1; shift < 4; shift++) {
+        memmove(pattern + shift, pattern, 1000);
+        TEST_ASSERT_EQ(crc32_stream_compute(pattern + shift, 1000), reference);
+        memmove(pattern, pattern + shift, 1000);
+    }
+}
+
+int main(void)
+{
+    printf("test_crc32_stream\n");
+    TEST_ASSERT_EQ(crc32_stream_init(), 0);
+    RUN_TEST(test_matches_host_decoder);
+    RUN_TEST(test_exact_length);
+    RUN_TEST(test_any_split_gives_same_crc);
+    RUN_TEST(test_unaligned_source);
+    TEST_EXIT();
+}
@@ -0,0 +1,274 @@
+/**
+ ******************************************************************************
+ * @file    test_dirty_rect.c
+ * @author  PeleAB
+ * @brief   Host tests for the overlay dirty-region tracker
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "dirty_rect.h"
+#include "test_common.h"
+#include <string.h>
+
+#define LAYER_WIDTH     800U
+#define LAYER_HEIGHT    480U
+
+static dirty_rect_tracker_t tracker;
+
+/* Software overlay: non-zero pixels are drawn, the tracker must cover them */
+static uint8_t layer[DIRTY_RECT_BUFFER_COUNT][LAYER_HEIGHT][LAYER_WIDTH];
+
+static void draw(uint32_t buffer, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    for (int32_t j = y; j < y + h; j++) {
+        for (int32_t i = x; i < x + w; i++) {
+            if (i >= 0 && j >= 0 && i < (int32_t)LAYER_WIDTH && j < (int32_t)LAYER_HEIGHT) {
+                layer[buffer][j][i] = 1;
+            }
+        }
+    }
+    dirty_rect_mark(&tracker, x, y, w, h);
+}
+
+static void draw_box(uint32_t buffer, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    draw(buffer, x, y, w, 1);
+    draw(buffer, x, y + h - 1, w, 1);
+    draw(buffer, x, y, 1, h);
+    draw(buffer, x + w - 1, y, 1, h);
+    draw(buffer, x, y - 15, 6 * 14, 20);
+}
+
+static uint32_t clear(uint32_t buffer, const dirty_rect_list_t *list)
+{
+    uint32_t written = 0;
+    if (list->full) {
+        memset(layer[buffer], 0, sizeof(layer[buffer]));
+        return LAYER_WIDTH * LAYER_HEIGHT;
+    }
+    for (uint32_t r = 0; r < list->count; r++) {
+        for (uint32_t j = list->rects[r].y0; j < list->rects[r].y1; j++) {
+            memset(&layer[buffer][j][list->rects[r].x0], 0, list->rects[r].x1 - list->rects[r].x0);
+            written += list->rects[r].x1 - list->rects[r].x0;
+        }
+    }
+    return written;
+}
+
+static bool layer_is_clear(uint32_t buffer)
+{
+    for (uint32_t j = 0; j < LAYER_HEIGHT; j++) {
+        for (uint32_t i = 0; i < LAYER_WIDTH; i++) {
+            if (layer[buffer][j][i] != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void test_first_use_clears_whole_layer(void)
+{
+    dirty_rect_list_t list;
+
+    TEST_ASSERT_EQ(dirty_rect_init(&tracker, LAYER_WIDTH, LAYER_HEIGHT), 0);
+    for (uint32_t b = 0; b < DIRTY_RECT_BUFFER_COUNT; b++) {
+        TEST_ASSERT_EQ(dirty_rect_begin_frame(&tracker, b, &list), 0);
+        TEST_ASSERT(list.full);
+        TEST_ASSERT_EQ(list.count, 0);
+    }
+
+    /* Nothing drawn since: nothing to clear */
+    TEST_ASSERT_EQ(dirty_rect_begin_frame(&tracker, 0, &list), 0);
+    TEST_ASSERT(!list.full);
+    TEST_ASSERT_EQ(list.count, 0);
+
+    TEST_ASSERT_EQ(dirty_rect_init(NULL, LAYER_WIDTH, LAYER_HEIGHT), -1);
+    TEST_ASSERT_EQ(dirty_rect_init(&tracker, 0, LAYER_HEIGHT), -1);
+    TEST_ASSERT_EQ(dirty_rect_begin_frame(&tracker, DIRTY_RECT_BUFFER_COUNT, &list), -1);
+}
+
+static void test_regions_follow_their_buffer(void)
+{
+    dirty_rect_list_t list;
+
+    dirty_rect_init(&tracker, LAYER_WIDTH, LAYER_HEIGHT);
+    dirty_rect_begin_frame(&tracker, 0, &list);
+    dirty_rect_mark(&tracker, 10, 10, 20, 20);
+    dirty_rect_begin_frame(&tracker, 1, &list);
+    dirty_rect_mark(&tracker, 500, 300, 40, 10);
+
+    /* Buffer 0 gets back what was drawn into buffer 0, not the last frame */
+    dirty_rect_begin_frame(&tracker, 0, &list);
+    TEST_ASSERT(!list.full);
+    TEST_ASSERT_EQ(list.count, 1);
+    TEST_ASSERT_EQ(list.rects[0].x0, 10);
+    TEST_ASSERT_EQ(list.rects[0].y1, 30);
+
+    dirty_rect_begin_frame(&tracker, 1, &list);
+    TEST_ASSERT_EQ(list.count, 1);
+    TEST_ASSERT_EQ(list.rects[0].x0, 500);
+    TEST_ASSERT_EQ(list.rects[0].x1, 540);
+
+    /* Invalidation forces a full clear of every buffer */
+    dirty_rect_invalidate(&tracker);
+    dirty_rect_begin_frame(&tracker, 0, &list);
+    TEST_ASSERT(list.full);
+}
+
+static void test_marks_are_clipped(void)
+{
+    dirty_rect_list_t list;
+
+    dirty_rect_init(&tracker, LAYER_WIDTH, LAYER_HEIGHT);
+    dirty_rect_begin_frame(&tracker, 0, &list);
+    dirty_rect_mark(&tracker, -5, -10, 20, 20);
+    dirty_rect_mark(&tracker, 790, 470, 100, 100);
+    dirty_rect_mark(&tracker, 900, 10, 10, 10);
+    dirty_rect_mark(&tracker, 10, 10, 0, 10);
+    dirty_rect_mark(&tracker, INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX);
+
+    dirty_rect_begin_frame(&tracker, 0, &list);
+    TEST_ASSERT_EQ(list.count, 2);
+    TEST_ASSERT_EQ(dirty_rect_list_area(&list, LAYER_WIDTH, LAYER_HEIGHT), 15U * 10U + 10U * 10U);
+}
+
+static void test_overlapping_regions_coalesce(void)
+{
+    dirty_rect_list_t list;
+    dirty_rect_t r;
+
+    memset(&list, 0, sizeof(list));
+    r = (dirty_rect_t){ 0, 0, 100, 100 };
+    dirty_rect_list_add(&list, &r);
+    r = (dirty_rect_t){ 10, 10, 50, 50 };
+    dirty_rect_list_add(&list, &r);
+    TEST_ASSERT_EQ(list.count, 1);
+
+    /* Overlapping and touching regions with little waste merge */
+    r = (dirty_rect_t){ 90, 0, 200, 100 };
+    dirty_rect_list_add(&list, &r);
+    TEST_ASSERT_EQ(list.count, 1);
+    TEST_ASSERT_EQ(list.rects[0].x1, 200);
+
+    /* Perpendicular edges of a large box stay apart */
+    memset(&list, 0, sizeof(list));
+    r = (dirty_rect_t){ 100, 100, 300, 101 };
+    dirty_rect_list_add(&list, &r);
+    r = (dirty_rect_t){ 100, 100, 101, 300 };
+    dirty_rect_list_add(&list, &r);
+    TEST_ASSERT_EQ(list.count, 2);
+
+    /* A region bridging two others pulls them into one */
+    memset(&list, 0, sizeof(list));
+    r = (dirty_rect_t){ 0, 0, 40, 40 };
+    dirty_rect_list_add(&list, &r);
+    r = (dirty_rect_t){ 80, 0, 120, 40 };
+    dirty_rect_list_add(&list, &r);
+    TEST_ASSERT_EQ(list.count, 2);
+    r = (dirty_rect_t){ 20, 0, 100, 40 };
+    dirty_rect_list_add(&list, &r);
+    TEST_ASSERT_EQ(list.count, 1);
+    TEST_ASSERT_EQ(list.rects[0].x0, 0);
+    TEST_ASSERT_EQ(list.rects[0].x1, 120);
+}
+
+static void test_full_list_merges_cheapest_pair(void)
+{
+    dirty_rect_list_t list;
+    dirty_rect_t r;
+
+    /* Diagonal 4x4 regions far enough apart not to coalesce */
+    memset(&list, 0, sizeof(list));
+    for (uint32_t i = 0; i < DIRTY_RECT_MAX_REGIONS; i++) {
+        r = (dirty_rect_t){ (uint16_t)(i * 40), (uint16_t)(i * 40), (uint16_t)(i * 40 + 4), (uint16_t)(i * 40 + 4) };
+        TEST_ASSERT(!dirty_rect_list_add(&list, &r));
+    }
+    TEST_ASSERT_EQ(list.count, DIRTY_RECT_MAX_REGIONS);
+
+    /* Past the last one: merged with it, not with a farther one */
+    r = (dirty_rect_t){ 1300, 1300, 1304, 1304 };
+    TEST_ASSERT(dirty_rect_list_add(&list, &r));
+    TEST_ASSERT_EQ(list.count, DIRTY_RECT_MAX_REGIONS);
+    bool found = false;
+    for (uint32_t i = 0; i < list.count; i++) {
+        if (list.rects[i].x0 == 31 * 40 && list.rects[i].y0 == 31 * 40 && list.rects[i].x1 == 1304) {
+            found = true;
+        }
+    }
+    TEST_ASSERT(found);
+}
+
+static void test_animated_overlay_is_fully_cleared(void)
+{
+    dirty_rect_list_t list;
+    dirty_rect_stats_t stats;
+
+    memset(layer, 0, sizeof(layer));
+    dirty_rect_init(&tracker, LAYER_WIDTH, LAYER_HEIGHT);
+
+    /* Moving faces, landmarks, a label each, status text; even 12 faces are cleared */
+    for (uint32_t frame = 0; frame < 200; frame++) {
+        const uint32_t buffer = frame % DIRTY_RECT_BUFFER_COUNT;
+        dirty_rect_begin_frame(&tracker, buffer, &list);
+        clear(buffer, &list);
+        TEST_ASSERT(layer_is_clear(buffer));
+
+        const uint32_t faces = (frame / 20) % 13;
+        for (uint32_t f = 0; f < faces; f++) {
+            const int32_t x = (int32_t)((f * 97 + frame * 3) % 700);
+            const int32_t y = (int32_t)((f * 53 + frame * 2) % 400);
+            draw_box(buffer, x, y, 60 + (int32_t)f * 5, 70);
+            for (int32_t k = 0; k < 5; k++) {
+                draw(buffer, x + 15 + k * 7, y + 25 + k * 3, 1, 1);
+            }
+        }
+        draw(buffer, 316, 400, 168, 20);
+        draw(buffer, 274, 420, 252, 20);
+    }
+
+    dirty_rect_get_stats(&tracker, &stats);
+    TEST_ASSERT_EQ(stats.frames, 200);
+    TEST_ASSERT_EQ(stats.pixels_layer, 200ULL * LAYER_WIDTH * LAYER_HEIGHT);
+    TEST_ASSERT(stats.overflows > 0);
+    /* Far less than a full clear per frame */
+    TEST_ASSERT(stats.pixels_cleared * 10U < stats.pixels_layer);
+    printf("    cleared %.1f%% of the layer, %lu full clears, %lu overflow merges\n",
+           100.0 * (double)stats.pixels_cleared / (double)stats.pixels_layer,
+           (unsigned long)stats.full_clears, (unsigned long)stats.overflows);
+}
+
+static void test_heavy_coverage_falls_back_to_full_clear(void)
+{
+    dirty_rect_list_t list;
+
+    dirty_rect_init(&tracker, LAYER_WIDTH, LAYER_HEIGHT);
+    dirty_rect_begin_frame(&tracker, 0, &list);
+    dirty_rect_mark(&tracker, 0, 0, LAYER_WIDTH, LAYER_HEIGHT * DIRTY_RECT_FULL_PERCENT / 100);
+    dirty_rect_begin_frame(&tracker, 0, &list);
+    TEST_ASSERT(list.full);
+    TEST_ASSERT_EQ(list.count, 0);
+}
+
+int main(void)
+{
+    printf("test_dirty_rect\n");
+    RUN_TEST(test_first_use_clears_whole_layer);
+    RUN_TEST(test_regions_follow_their_buffer);
+    RUN_TEST(test_marks_are_clipped);
+    RUN_TEST(test_overlapping_regions_coalesce);
+    RUN_TEST(test_full_list_merges_cheapest_pair);
+    RUN_TEST(test_animated_overlay_is_fully_cleared);
+    RUN_TEST(test_heavy_coverage_falls_back_to_full_clear);
+    TEST_EXIT();
+}
@@ -0,0 +1,252 @@
+/**
+ ******************************************************************************
+ * @file    test_dma_concat_d2s.c
+ * @author  PeleAB
+ * @brief   Host tests of the fused Concat + DepthToSpace DMA index mapping
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "ll_aton_lib.h"
+#include "ll_dma_concat_d2s.h"
+#include "test_common.h"
+#include <string.h>
+
+/* Largest input: the detector's 16x16x24 int8; most inputs: 3 x 2 blocks */
+#define MAX_INPUTS          6
+#define MAX_INPUT_BYTES     (16 * 16 * 24)
+#define MAX_TENSOR_BYTES    (MAX_INPUTS * MAX_INPUT_BYTES)
+
+static uint8_t s_inputs[MAX_INPUTS][MAX_INPUT_BYTES];
+static uint8_t s_concat[MAX_TENSOR_BYTES];
+static uint8_t s_expected[MAX_TENSOR_BYTES];
+static uint8_t s_fused[MAX_TENSOR_BYTES];
+static uint8_t s_written[MAX_TENSOR_BYTES];
+
+static uint32_t s_rng = 0x2545F491U;
+
+static uint32_t rng_next(void)
+{
+    s_rng = s_rng * 1664525U + 1013904223U;
+    return s_rng >> 8;
+}
+
+/* The SW operators report parameter errors through the library error hook */
+void __ll_lib_error(int err_code, int line, const char *func)
+{
+    printf("    ll_aton_lib error %d at %s:%d\n", err_code, func, line);
+}
+
+/* ========================================================================= */
+/* REFERENCE: SW CONCAT + LL_ATON_LIB_SW_DepthToSpace                         */
+/* ========================================================================= */
+
+/* Dense HWC tensor seen through the NCHW shape/axis offsets of the SW operators */
+static void hwc_tensor(LL_LIB_TensorShape_TypeDef *t, uint32_t *shape, uint32_t *axes_offsets, void *data,
+                       uint32_t n, uint32_t h, uint32_t w, uint32_t c, uint32_t nbytes)
+{
+    shape[0] = n;
+    shape[1] = c;
+    shape[2] = h;
+    shape[3] = w;
+    axes_offsets[0] = h * w * c * nbytes;
+    axes_offsets[1] = nbytes;
+    axes_offsets[2] = w * c * nbytes;
+    axes_offsets[3] = c * nbytes;
+
+    memset(t, 0, sizeof(*t));
+    t->addr_base.p = data;
+    t->offset_start = 0;
+    t->offset_end = n * h * w * c * nbytes;
+    t->ndims = 4;
+    t->nbits = (uint8_t)(nbytes * 8);
+    t->shape = shape;
+}
+
+/* Channel concat of the inputs followed by the SW DCR DepthToSpace */
+static void reference(const ll_dma_concat_d2s_shape *s, uint8_t *out)
+{
+    const uint32_t ninputs = s->blocksize_h * s->blocksize_w;
+    const uint32_t pixel = s->channels * s->nbytes;
+    const uint32_t pixels = s->batches * s->height * s->width;
+
+    for (uint32_t p = 0; p < pixels; p++) {
+        for (uint32_t k = 0; k < ninputs; k++) {
+            memcpy(&s_concat[(p * ninputs + k) * pixel], &s_inputs[k][p * pixel], pixel);
+        }
+    }
+
+    LL_LIB_TensorShape_TypeDef in, output;
+    uint32_t in_shape[4], in_axes[4], out_shape[4], out_axes[4];
+    hwc_tensor(&in, in_shape, in_axes, s_concat, s->batches, s->height, s->width, s->channels * ninputs,
+               s->nbytes);
+    hwc_tensor(&output, out_shape, out_axes, out, s->batches, s->height * s->blocksize_h,
+               s->width * s->blocksize_w, s->channels, s->nbytes);
+    TEST_ASSERT_EQ(LL_ATON_LIB_SW_DepthToSpace(&in, in_axes, &output, out_axes, s->blocksize_h, s->blocksize_w, 0),
+                   LL_ATON_OK);
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static uint32_t output_bytes(const ll_dma_concat_d2s_shape *s)
+{
+    return s->batches * s->height * s->blocksize_h * s->width * s->blocksize_w * s->channels * s->nbytes;
+}
+
+static void check_fused(const ll_dma_concat_d2s_shape *s)
+{
+    const uint32_t ninputs = s->blocksize_h * s->blocksize_w;
+    const uint32_t in_bytes = s->batches * s->height * s->width * s->channels * s->nbytes;
+    const uint32_t out_bytes = output_bytes(s);
+
+    for (uint32_t k = 0; k < ninputs; k++) {
+        for (uint32_t i = 0; i < in_bytes; i++) {
+            s_inputs[k][i] = (uint8_t)rng_next();
+        }
+    }
+    reference(s, s_expected);
+
+    /* One stream per input, each reading its whole tensor in order */
+    memset(s_fused, 0, out_bytes);
+    for (uint32_t k = 0; k < ninputs; k++) {
+        ll_dma_stream_geometry geo;
+        TEST_ASSERT_EQ(ll_dma_concat_d2s_geometry(s, k, &geo), 0);
+        TEST_ASSERT_EQ(ll_dma_stream_scatter(&geo, s_inputs[k], s_fused), in_bytes);
+    }
+    TEST_ASSERT(memcmp(s_fused, s_expected, out_bytes) == 0);
+
+    /* Every output byte is written by exactly one input */
+    int overlaps = 0;
+    memset(s_written, 0, out_bytes);
+    for (uint32_t k = 0; k < ninputs; k++) {
+        ll_dma_stream_geometry geo;
+        ll_dma_concat_d2s_geometry(s, k, &geo);
+        memset(s_concat, 0xFF, in_bytes);
+        memset(s_fused, 0, out_bytes);
+        ll_dma_stream_scatter(&geo, s_concat, s_fused);
+        for (uint32_t i = 0; i < out_bytes; i++) {
+            overlaps += (s_fused[i] && s_written[i]);
+            s_written[i] |= s_fused[i];
+        }
+    }
+    TEST_ASSERT_EQ(overlaps, 0);
+    TEST_ASSERT(memchr(s_written, 0, out_bytes) == NULL);
+}
+
+static void test_model_matches_dma_depth_to_space(void)
+{
+    /* LL_ATON_LIB_DMA_DepthToSpace output stream (RowToImage with stride ==
+     * blocksize) on the detector's 4x4x96 -> 8x8x24 layer, field for field */
+    const ll_dma_concat_d2s_shape s = { 1, 4, 4, 24, 1, 2, 2 };
+    const uint32_t out_w = 8, out_h = 8, out_c = 24;
+    const ll_dma_stream_geometry geo = {
+        .offset_start = 0,
+        .fwidth = 2,
+        .batch_depth = out_c,
+        .batch_offset = out_c,
+        .fheight = 2,
+        .line_offset = out_w * out_c,
+        .frame_loop_cnt = out_w / 2,
+        .frame_offset = 2 * out_c,
+        .frame_tot_cnt = (out_h / 2) * (out_w / 2),
+        .loop_offset = 2 * out_w * out_c,
+        .elem_bytes = 1,
+    };
+
+    for (uint32_t k = 0; k < 4; k++) {
+        for (uint32_t i = 0; i < 4 * 4 * 24; i++) {
+            s_inputs[k][i] = (uint8_t)rng_next();
+        }
+    }
+    reference(&s, s_expected);
+    TEST_ASSERT_EQ(ll_dma_stream_scatter(&geo, s_concat, s_fused), 4 * 4 * 96);
+    TEST_ASSERT(memcmp(s_fused, s_expected, out_w * out_h * out_c) == 0);
+}
+
+static void test_detector_upsampling_layers(void)
+{
+    /* Epochs 60/61, 64/65 and 68/69: four int8 inputs of 24 channels, 2x2 blocks */
+    static const ll_dma_concat_d2s_shape shapes[] = {
+        { 1, 4, 4, 24, 1, 2, 2 },
+        { 1, 8, 8, 24, 1, 2, 2 },
+        { 1, 16, 16, 24, 1, 2, 2 },
+    };
+    for (uint32_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+        check_fused(&shapes[i]);
+    }
+}
+
+static void test_detector_input_inside_output(void)
+{
+    /* Epoch 60 places Relu_255_out_0 768 bytes into the DepthToSpace output;
+     * streaming reads every pixel before the output catches up with it */
+    const ll_dma_concat_d2s_shape s = { 1, 4, 4, 24, 1, 2, 2 };
+    const uint32_t in_bytes = 4 * 4 * 24;
+    const uint32_t out_bytes = output_bytes(&s);
+
+    for (uint32_t k = 0; k < 4; k++) {
+        for (uint32_t i = 0; i < in_bytes; i++) {
+            s_inputs[k][i] = (k == 0) ? (uint8_t)rng_next() : (uint8_t)0x80;
+        }
+    }
+    reference(&s, s_expected);
+
+    memset(s_fused, 0, out_bytes);
+    memcpy(&s_fused[768], s_inputs[0], in_bytes);
+    for (uint32_t k = 0; k < 4; k++) {
+        ll_dma_stream_geometry geo;
+        TEST_ASSERT_EQ(ll_dma_concat_d2s_geometry(&s, k, &geo), 0);
+        ll_dma_stream_scatter(&geo, (k == 0) ? (const void *)&s_fused[768] : (const void *)s_inputs[k], s_fused);
+    }
+    TEST_ASSERT(memcmp(s_fused, s_expected, out_bytes) == 0);
+}
+
+static void test_other_shapes(void)
+{
+    static const ll_dma_concat_d2s_shape shapes[] = {
+        { 1, 3, 5, 7, 1, 2, 3 },
+        { 2, 6, 5, 24, 1, 3, 2 },
+        { 1, 4, 3, 5, 2, 2, 2 },
+        { 2, 6, 5, 24, 4, 3, 2 },
+        { 1, 1, 1, 1, 1, 1, 1 },
+    };
+    for (uint32_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+        check_fused(&shapes[i]);
+    }
+}
+
+static void test_rejects_unsupported_shapes(void)
+{
+    ll_dma_concat_d2s_shape s = { 1, 4, 4, 24, 1, 2, 2 };
+    ll_dma_stream_geometry geo;
+
+    TEST_ASSERT(ll_dma_concat_d2s_geometry(&s, 4, &geo) < 0);
+    s.nbytes = 3;
+    TEST_ASSERT(ll_dma_concat_d2s_geometry(&s, 0, &geo) < 0);
+    s.nbytes = 1;
+    s.blocksize_w = 0;
+    TEST_ASSERT(ll_dma_concat_d2s_geometry(&s, 0, &geo) < 0);
+    TEST_ASSERT(ll_dma_concat_d2s_geometry(NULL, 0, &geo) < 0);
+}
+
+int main(void)
+{
+    printf("test_dma_concat_d2s\n");
+    RUN_TEST(test_model_matches_dma_depth_to_space);
+    RUN_TEST(test_detector_upsampling_layers);
+    RUN_TEST(test_detector_input_inside_output);
+    RUN_TEST(test_other_shapes);
+    RUN_TEST(test_rejects_unsupported_shapes);
+    TEST_EXIT();
+}
@@ -0,0 +1,126 @@
+/**
+ ******************************************************************************
+ * @file    test_epoch_profiler.c
+ * @author  PeleAB
+ * @brief   Host tests for the per-epoch-block profiler
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "epoch_profiler.h"
+#include "perf_monitor.h"
+#include "test_common.h"
+#include <string.h>
+#include <time.h>
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Run one inference of three blocks: SW epoch 1, EC blob 2..40, HW epoch 41 */
+static void run_inference(epoch_profiler_net_t net, const struct timespec *sw_delay)
+{
+    epoch_profiler_begin_inference(net);
+    epoch_profiler_begin_block(net, 1, 1, EPOCH_PROFILER_FLAG_PURE_SW);
+    nanosleep(sw_delay, NULL);
+    epoch_profiler_end_block(net);
+    epoch_profiler_begin_block(net, 2, 40, EPOCH_PROFILER_FLAG_BLOB | EPOCH_PROFILER_FLAG_PURE_HW);
+    epoch_profiler_end_block(net);
+    epoch_profiler_begin_block(net, 41, 41, EPOCH_PROFILER_FLAG_PURE_HW);
+    epoch_profiler_end_block(net);
+    epoch_profiler_end_inference(net);
+}
+
+static void test_blocks_accumulate_per_network(void)
+{
+    const struct timespec delay = { 0, 2000000 };
+
+    perf_monitor_init();
+    epoch_profiler_reset();
+    run_inference(EPOCH_PROFILER_NET_RECOGNITION, &delay);
+    run_inference(EPOCH_PROFILER_NET_RECOGNITION, &delay);
+
+    const epoch_profile_network_t *table = epoch_profiler_get(EPOCH_PROFILER_NET_RECOGNITION);
+    TEST_ASSERT(table != NULL);
+    TEST_ASSERT_EQ(table->block_count, 3);
+    TEST_ASSERT_EQ(table->inferences, 2U);
+    TEST_ASSERT_EQ(table->blocks[1].epoch_first, 2);
+    TEST_ASSERT_EQ(table->blocks[1].epoch_last, 40);
+
+    /* The sleeping SW block dominates and both runs land in the same slot */
+    const uint64_t sw_us = table->blocks[0].total_cycles / perf_monitor_cycles_per_us();
+    TEST_ASSERT(sw_us >= 4000U);
+    TEST_ASSERT(table->blocks[0].total_cycles > table->blocks[2].total_cycles);
+
+    /* The other network is untouched */
+    TEST_ASSERT_EQ(epoch_profiler_get(EPOCH_PROFILER_NET_DETECTION)->block_count, 0);
+    TEST_ASSERT(epoch_profiler_get(EPOCH_PROFILER_NET_COUNT) == NULL);
+}
+
+static void test_overflow_is_counted_not_written(void)
+{
+    epoch_profiler_reset();
+    epoch_profiler_begin_inference(EPOCH_PROFILER_NET_DETECTION);
+    for (int i = 0; i < EPOCH_PROFILER_MAX_BLOCKS + 3; i++) {
+        epoch_profiler_begin_block(EPOCH_PROFILER_NET_DETECTION, (int16_t)i, (int16_t)i, 0);
+        epoch_profiler_end_block(EPOCH_PROFILER_NET_DETECTION);
+    }
+    epoch_profiler_end_inference(EPOCH_PROFILER_NET_DETECTION);
+
+    const epoch_profile_network_t *table = epoch_profiler_get(EPOCH_PROFILER_NET_DETECTION);
+    TEST_ASSERT_EQ(table->block_count, EPOCH_PROFILER_MAX_BLOCKS);
+    TEST_ASSERT_EQ(table->overflows, 3U);
+}
+
+static void test_serialize_layout(void)
+{
+    const struct timespec delay = { 0, 1000000 };
+    uint8_t buffer[EPOCH_PROFILER_WIRE_HEADER_SIZE + 3 * EPOCH_PROFILER_WIRE_BLOCK_SIZE];
+
+    epoch_profiler_reset();
+    run_inference(EPOCH_PROFILER_NET_DETECTION, &delay);
+    run_inference(EPOCH_PROFILER_NET_DETECTION, &delay);
+
+    TEST_ASSERT_EQ(epoch_profiler_serialize(EPOCH_PROFILER_NET_DETECTION, buffer, sizeof(buffer) - 1), 0U);
+    TEST_ASSERT_EQ(epoch_profiler_serialize(EPOCH_PROFILER_NET_DETECTION, buffer, sizeof(buffer)),
+                   (uint32_t)sizeof(buffer));
+
+    TEST_ASSERT_EQ(buffer[0], EPOCH_PROFILER_WIRE_VERSION);
+    TEST_ASSERT_EQ(buffer[1], EPOCH_PROFILER_NET_DETECTION);
+    TEST_ASSERT_EQ(get_u16(buffer + 2), 3);
+    TEST_ASSERT_EQ(get_u32(buffer + 4), 2U);
+    TEST_ASSERT_EQ(get_u32(buffer + 8), perf_monitor_cycles_per_us());
+
+    const epoch_profile_network_t *table = epoch_profiler_get(EPOCH_PROFILER_NET_DETECTION);
+    const uint8_t *blob = buffer + EPOCH_PROFILER_WIRE_HEADER_SIZE + EPOCH_PROFILER_WIRE_BLOCK_SIZE;
+    TEST_ASSERT_EQ((int16_t)get_u16(blob), 2);
+    TEST_ASSERT_EQ((int16_t)get_u16(blob + 2), 40);
+    TEST_ASSERT_EQ(get_u16(blob + 4), EPOCH_PROFILER_FLAG_BLOB | EPOCH_PROFILER_FLAG_PURE_HW);
+    /* Blocks carry the per-inference average */
+    TEST_ASSERT_EQ(get_u32(buffer + EPOCH_PROFILER_WIRE_HEADER_SIZE + 6),
+                   (uint32_t)(table->blocks[0].total_cycles / 2));
+}
+
+int main(void)
+{
+    printf("test_epoch_profiler\n");
+    RUN_TEST(test_blocks_accumulate_per_network);
+    RUN_TEST(test_overflow_is_counted_not_written);
+    RUN_TEST(test_serialize_layout);
+    TEST_EXIT();
+}
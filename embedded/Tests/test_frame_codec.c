@@ -0,0 +1,419 @@
+/**
+ ******************************************************************************
+ * @file    test_frame_codec.c
+ * @author  PeleAB
+ * @brief   Host tests and benchmark for the streamed frame codec
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "frame_codec.h"
+#include "perf_monitor.h"
+#include "robust_framing.h"
+#include "test_common.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_WIDTH       800U
+#define MAX_HEIGHT      480U
+#define MAX_BYTES       (MAX_WIDTH * MAX_HEIGHT * 3U)
+#define LINK_BAUD       (921600U * 8U)  /* PcUartInit in enhanced_pc_stream.c */
+#define BENCH_REPEATS   5U
+#define MSG_FRAME_DATA  0x01
+#define FLAG_CODED      0x01            /* ROBUST_FRAME_FLAG_CODED */
+
+static uint8_t image[MAX_BYTES];
+static uint8_t decoded[MAX_BYTES];
+static uint8_t coded[MAX_BYTES + MAX_HEIGHT + sizeof(frame_codec_header_t)];
+static frame_codec_t codec;
+
+/* ========================================================================= */
+/* SYNTHETIC FRAMES                                                          */
+/* ========================================================================= */
+
+static uint32_t noise_state = 12345U;
+
+static uint32_t noise(uint32_t range)
+{
+    noise_state = noise_state * 1103515245U + 12345U;
+    return (noise_state >> 16) % range;
+}
+
+/*
+ * Camera-like scene: lit gradients, a few flat objects with edges and
+ * sensor noise of +-amplitude levels per channel. amplitude 256 is white
+ * noise, the worst case for any codec.
+ */
+static void render(uint8_t *out, uint32_t width, uint32_t height, uint32_t bpp, uint32_t amplitude)
+{
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            int32_t rgb[3] = {
+                (int32_t)(60U + (x * 120U) / width),
+                (int32_t)(80U + (y * 100U) / height),
+                (int32_t)(140U - (x + y) * 60U / (width + height)),
+            };
+            if ((x / (width / 4U + 1U) + y / (height / 3U + 1U)) % 3U == 0) {
+                rgb[0] += 50;
+                rgb[2] -= 30;
+            }
+            for (uint32_t c = 0; c < 3; c++) {
+                int32_t v = (amplitude >= 256U) ? (int32_t)noise(256U)
+                          : rgb[c] + (int32_t)noise(2U * amplitude + 1U) - (int32_t)amplitude;
+                rgb[c] = (v < 0) ? 0 : (v > 255) ? 255 : v;
+            }
+
+            uint8_t *px = &out[(y * width + x) * bpp];
+            if (bpp == 1) {
+                px[0] = (uint8_t)((rgb[0] * 77 + rgb[1] * 150 + rgb[2] * 29) >> 8);
+            } else if (bpp == 2) {
+                const uint32_t v = ((uint32_t)(rgb[0] >> 3) << 11) | ((uint32_t)(rgb[1] >> 2) << 5) |
+                                   (uint32_t)(rgb[2] >> 3);
+                px[0] = (uint8_t)(v & 0xFF);
+                px[1] = (uint8_t)(v >> 8);
+            } else {
+                px[0] = (uint8_t)rgb[0];
+                px[1] = (uint8_t)rgb[1];
+                px[2] = (uint8_t)rgb[2];
+            }
+        }
+    }
+}
+
+static uint32_t encode(const uint8_t *pixels, uint32_t width, uint32_t height, uint32_t bpp,
+                       uint32_t capacity)
+{
+    TEST_ASSERT_EQ(frame_codec_begin(&codec, width, bpp, coded, capacity), 0);
+    for (uint32_t y = 0; y < height; y++) {
+        if (frame_codec_encode_row(&codec, &pixels[y * width * bpp]) != 0) {
+            return 0;
+        }
+    }
+    return frame_codec_end(&codec);
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_lossless_round_trip(void)
+{
+    const uint32_t bpps[] = { 1, 2, 3 };
+
+    for (uint32_t i = 0; i < 3; i++) {
+        const uint32_t bpp = bpps[i], width = 320, height = 240;
+        TEST_ASSERT_EQ(frame_codec_init(&codec, NULL), 0);
+        render(image, width, height, bpp, 2);
+
+        const uint32_t size = encode(image, width, height, bpp, sizeof(coded));
+        TEST_ASSERT(size > 0);
+        TEST_ASSERT(size * 3U < width * height * bpp * 2U);
+        TEST_ASSERT_EQ(frame_codec_decode(decoded, sizeof(decoded), width, height, coded, size),
+                       (int)bpp);
+        TEST_ASSERT(memcmp(decoded, image, width * height * bpp) == 0);
+
+        frame_codec_stats_t stats;
+        frame_codec_get_stats(&codec, &stats);
+        TEST_ASSERT_EQ(stats.frames, 1);
+        TEST_ASSERT_EQ(stats.rows, height);
+        TEST_ASSERT_EQ(stats.bytes_in, width * height * bpp);
+        TEST_ASSERT_EQ(stats.bytes_out, size);
+    }
+}
+
+/* White noise goes out as raw rows: one byte per row over the frame */
+static void test_worst_case_expansion_is_bounded(void)
+{
+    const uint32_t bpps[] = { 1, 2, 3 };
+
+    for (uint32_t i = 0; i < 3; i++) {
+        const uint32_t bpp = bpps[i], width = 112, height = 112;
+        const uint32_t bound = frame_codec_bound(width, height, bpp);
+        TEST_ASSERT_EQ(bound, sizeof(frame_codec_header_t) + height * (width * bpp + 1U));
+        TEST_ASSERT_EQ(frame_codec_init(&codec, NULL), 0);
+        render(image, width, height, bpp, 256);
+
+        const uint32_t size = encode(image, width, height, bpp, bound);
+        TEST_ASSERT(size > 0 && size <= bound);
+        TEST_ASSERT_EQ(frame_codec_decode(decoded, sizeof(decoded), width, height, coded, size),
+                       (int)bpp);
+        TEST_ASSERT(memcmp(decoded, image, width * height * bpp) == 0);
+
+        frame_codec_stats_t stats;
+        frame_codec_get_stats(&codec, &stats);
+        TEST_ASSERT(stats.raw_rows > height / 2U);
+    }
+
+    /* A flat frame codes to a few bits a sample, whatever the width */
+    memset(image, 0x40, MAX_WIDTH * 3U);
+    TEST_ASSERT_EQ(frame_codec_init(&codec, NULL), 0);
+    const uint32_t size = encode(image, MAX_WIDTH, 1, 3, sizeof(coded));
+    TEST_ASSERT(size > 0 && size < 400U);
+    TEST_ASSERT_EQ(frame_codec_decode(decoded, sizeof(decoded), MAX_WIDTH, 1, coded, size), 3);
+    TEST_ASSERT(memcmp(decoded, image, MAX_WIDTH * 3U) == 0);
+}
+
+/* Dropped bits come back as the middle of their range */
+static void test_near_lossless_error_is_bounded(void)
+{
+    const uint32_t width = 112, height = 112, bpp = 3;
+    frame_codec_config_t config;
+    frame_codec_default_config(&config);
+    render(image, width, height, bpp, 2);
+
+    TEST_ASSERT_EQ(frame_codec_init(&codec, &config), 0);
+    const uint32_t lossless = encode(image, width, height, bpp, sizeof(coded));
+
+    config.drop_bits = 2;
+    TEST_ASSERT_EQ(frame_codec_init(&codec, &config), 0);
+    const uint32_t size = encode(image, width, height, bpp, sizeof(coded));
+    TEST_ASSERT(size > 0 && size < lossless);
+    TEST_ASSERT_EQ(frame_codec_decode(decoded, sizeof(decoded), width, height, coded, size), 3);
+
+    for (uint32_t i = 0; i < width * height * bpp; i++) {
+        const int32_t error = (int32_t)decoded[i] - (int32_t)image[i];
+        TEST_ASSERT(error >= -2 && error <= 2);
+    }
+
+    config.drop_bits = FRAME_CODEC_MAX_DROP_BITS + 1U;
+    TEST_ASSERT(frame_codec_init(&codec, &config) < 0);
+}
+
+static void test_rejects_bad_input(void)
+{
+    const uint32_t width = 64, height = 16, bpp = 2;
+    TEST_ASSERT_EQ(frame_codec_init(&codec, NULL), 0);
+    TEST_ASSERT(frame_codec_begin(&codec, width, 4, coded, sizeof(coded)) < 0);
+    TEST_ASSERT(frame_codec_begin(&codec, FRAME_CODEC_MAX_WIDTH + 1U, 1, coded, sizeof(coded)) < 0);
+    TEST_ASSERT(frame_codec_begin(&codec, width, bpp, coded, 2) < 0);
+
+    /* Output full: the row is refused rather than written past the end */
+    render(image, width, height, bpp, 256);
+    memset(coded, 0xEE, sizeof(coded));
+    TEST_ASSERT_EQ(encode(image, width, height, bpp, 600), 0);
+    TEST_ASSERT_EQ(coded[600], 0xEE);
+
+    /* Truncated, extended or corrupted data is refused */
+    render(image, width, height, bpp, 2);
+    const uint32_t size = encode(image, width, height, bpp, sizeof(coded));
+    TEST_ASSERT(size > 0);
+    TEST_ASSERT(frame_codec_decode(decoded, sizeof(decoded), width, height, coded, size - 1U) < 0);
+    TEST_ASSERT(frame_codec_decode(decoded, sizeof(decoded), width, height, coded, size + 1U) < 0);
+    TEST_ASSERT(frame_codec_decode(decoded, 100, width, height, coded, size) < 0);
+    coded[0] = FRAME_CODEC_VERSION + 1U;
+    TEST_ASSERT(frame_codec_decode(decoded, sizeof(decoded), width, height, coded, size) < 0);
+    coded[0] = FRAME_CODEC_VERSION;
+    coded[sizeof(frame_codec_header_t)] = FRAME_CODEC_MAX_K + 1U;
+    TEST_ASSERT(frame_codec_decode(decoded, sizeof(decoded), width, height, coded, size) < 0);
+}
+
+/* ========================================================================= */
+/* BENCHMARK                                                                 */
+/* ========================================================================= */
+
+/*
+ * Ratio and throughput of one frame. Coding pays for itself on the link
+ * when the encode time is below the wire time it saves.
+ */
+static void benchmark(const char *name, const uint8_t *pixels, uint32_t width, uint32_t height,
+                      uint32_t bpp)
+{
+    const uint32_t raw = width * height * bpp;
+    uint32_t size = 0, encode_ticks = 0, decode_ticks = 0;
+
+    TEST_ASSERT_EQ(frame_codec_init(&codec, NULL), 0);
+    for (uint32_t i = 0; i < BENCH_REPEATS; i++) {
+        uint32_t t0 = perf_monitor_now();
+        size = encode(pixels, width, height, bpp, sizeof(coded));
+        encode_ticks += perf_monitor_now() - t0;
+
+        t0 = perf_monitor_now();
+        TEST_ASSERT_EQ(frame_codec_decode(decoded, sizeof(decoded), width, height, coded, size),
+                       (int)bpp);
+        decode_ticks += perf_monitor_now() - t0;
+    }
+    TEST_ASSERT(size > 0 && size <= frame_codec_bound(width, height, bpp));
+    TEST_ASSERT(memcmp(decoded, pixels, raw) == 0);
+
+    const double per_us = (double)perf_monitor_cycles_per_us();
+    const double encode_us = (double)encode_ticks / BENCH_REPEATS / per_us;
+    const double decode_us = (double)decode_ticks / BENCH_REPEATS / per_us;
+    const double saved_us = (double)(raw - ((size < raw) ? size : raw)) * 10.0 * 1e6 / LINK_BAUD;
+    printf("    %-18s %4ux%-4u bpp %u  ratio %5.2f  encode %6.1f MB/s %5.1f ns/px"
+           "  decode %6.1f MB/s  wire saved %6.0f us\n",
+           name, (unsigned)width, (unsigned)height, (unsigned)bpp, (double)raw / size,
+           raw / encode_us, encode_us * 1000.0 / (width * height), raw / decode_us, saved_us);
+}
+
+static void test_benchmark_synthetic_frames(void)
+{
+    static const struct {
+        const char *name;
+        uint32_t width, height, bpp, noise;
+    } frames[] = {
+        { "v1 gray", 320, 240, 1, 2 },
+        { "decimated RGB565", 400, 240, 2, 2 },
+        { "ALN crop", 112, 112, 3, 2 },
+        { "ALN crop, noisy", 112, 112, 3, 12 },
+        { "white noise", 112, 112, 3, 256 },
+    };
+
+    for (uint32_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+        render(image, frames[i].width, frames[i].height, frames[i].bpp, frames[i].noise);
+        benchmark(frames[i].name, image, frames[i].width, frames[i].height, frames[i].bpp);
+    }
+}
+
+/*
+ * Recorded frames: FRAME_DATA payloads as saved by
+ * python_tools/record_frames.py (12-byte header, then the pixels)
+ */
+static int benchmark_recording(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        printf("    %s: cannot open\n", path);
+        return -1;
+    }
+
+    uint8_t header[12];
+    const size_t got = fread(header, 1, sizeof(header), file);
+    const size_t pixels_size = (got == sizeof(header)) ? fread(image, 1, sizeof(image), file) : 0;
+    fclose(file);
+
+    uint32_t width, height;
+    memcpy(&width, &header[4], sizeof(width));
+    memcpy(&height, &header[8], sizeof(height));
+    const uint32_t pixels = width * height;
+    if (pixels == 0 || pixels_size % pixels != 0 || pixels_size / pixels == 0 ||
+        pixels_size / pixels > 3U || width > FRAME_CODEC_MAX_WIDTH) {
+        printf("    %s: not a recorded frame\n", path);
+        return -1;
+    }
+
+    const char *name = strrchr(path, '/');
+    benchmark(name ? name + 1 : path, image, width, height, (uint32_t)(pixels_size / pixels));
+    return 0;
+}
+
+/* ========================================================================= */
+/* LOOPBACK STREAM                                                           */
+/* ========================================================================= */
+
+static uart_tx_queue_t queue;
+static uint8_t arena[160U * 1024U] __attribute__ ((aligned (4)));
+static uint8_t payload[12U + sizeof(coded)];
+static FILE *loopback;
+static const uint8_t *in_flight;
+static uint32_t in_flight_size;
+
+static int file_start(void *ctx, const uint8_t *data, uint32_t size)
+{
+    (void)ctx;
+    in_flight = data;
+    in_flight_size = size;
+    return 0;
+}
+
+/* The transfer reaches the file and completes */
+static void file_poll(void *ctx)
+{
+    (void)ctx;
+    if (in_flight != NULL) {
+        TEST_ASSERT_EQ(fwrite(in_flight, 1, in_flight_size, loopback), in_flight_size);
+        in_flight = NULL;
+        uart_tx_queue_on_complete(&queue);
+    }
+}
+
+/* FRAME_DATA message: tag, flags, width, height, then pixels */
+static void send_frame(uint16_t sequence_id, const char *tag, uint8_t flags, uint32_t width,
+                       uint32_t height, const uint8_t *pixels, uint32_t size)
+{
+    const uint32_t dims[2] = { width, height };
+    memcpy(payload, tag, 3);
+    payload[3] = flags;
+    memcpy(payload + 4, dims, sizeof(dims));
+    memcpy(payload + 12, pixels, size);
+
+    robust_writer_t writer;
+    TEST_ASSERT_EQ(robust_writer_begin(&writer, &queue, ROBUST_PROTOCOL_V2, MSG_FRAME_DATA,
+                                       sequence_id, 12U + size, 0, UART_TX_RELIABLE), 0);
+    TEST_ASSERT_EQ(robust_writer_write(&writer, payload, 12U + size), 0);
+    TEST_ASSERT_EQ(robust_writer_end(&writer), 0);
+    while (in_flight != NULL) {
+        file_poll(NULL);
+    }
+}
+
+/*
+ * Stream read back by python_tools/test_protocol_loopback.py: every frame
+ * uncoded, then coded. The last one drops 2 bits per channel.
+ */
+static int write_loopback(const char *path)
+{
+    static const struct {
+        const char *tag;
+        uint32_t width, height, bpp, noise, drop_bits;
+    } frames[] = {
+        { "JPG", 320, 240, 1, 2, 0 },
+        { "RAW", 400, 240, 2, 2, 0 },
+        { "ALN", 112, 112, 3, 2, 0 },
+        { "ALN", 112, 112, 3, 256, 0 },
+        { "ALN", 112, 112, 3, 12, 2 },
+    };
+    const uart_tx_port_t port = { file_start, file_poll, NULL };
+
+    loopback = fopen(path, "wb");
+    if (loopback == NULL) {
+        perror(path);
+        return -1;
+    }
+    TEST_ASSERT_EQ(uart_tx_queue_init(&queue, &port, arena, sizeof(arena), 0, 100000), 0);
+
+    for (uint32_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++) {
+        const uint32_t width = frames[i].width, height = frames[i].height, bpp = frames[i].bpp;
+        const frame_codec_config_t config = { frames[i].drop_bits };
+        render(image, width, height, bpp, frames[i].noise);
+        send_frame((uint16_t)(2U * i + 1U), frames[i].tag, 0, width, height, image,
+                   width * height * bpp);
+
+        TEST_ASSERT_EQ(frame_codec_init(&codec, &config), 0);
+        const uint32_t size = encode(image, width, height, bpp, sizeof(coded));
+        TEST_ASSERT(size > 0);
+        send_frame((uint16_t)(2U * i + 2U), frames[i].tag, FLAG_CODED, width, height, coded, size);
+    }
+    fclose(loopback);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    printf("test_frame_codec\n");
+    perf_monitor_init();
+    TEST_ASSERT_EQ(crc32_stream_init(), 0);
+    RUN_TEST(test_lossless_round_trip);
+    RUN_TEST(test_worst_case_expansion_is_bounded);
+    RUN_TEST(test_near_lossless_error_is_bounded);
+    RUN_TEST(test_rejects_bad_input);
+    RUN_TEST(test_benchmark_synthetic_frames);
+
+    /* --loopback <path> for the Python decoder, otherwise recorded frames */
+    if (argc > 2 && strcmp(argv[1], "--loopback") == 0) {
+        TEST_ASSERT_EQ(write_loopback(argv[2]), 0);
+    } else {
+        for (int i = 1; i < argc; i++) {
+            TEST_ASSERT_EQ(benchmark_recording(argv[i]), 0);
+        }
+    }
+    TEST_EXIT();
+}
@@ -0,0 +1,224 @@
+/**
+ ******************************************************************************
+ * @file    test_frame_mailbox.c
+ * @author  PeleAB
+ * @brief   Host tests and multi-threaded stress test for the frame mailbox
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "frame_mailbox.h"
+#include "test_common.h"
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#define STRESS_FRAMES       2000000U
+#define STRESS_BUFFERS      2U
+
+static frame_mailbox_t mailbox;
+
+/* Every field is derived from the sequence so torn entries are detectable */
+static uint32_t expected_buffer(uint32_t sequence)
+{
+    return sequence % STRESS_BUFFERS;
+}
+
+static uint32_t expected_timestamp(uint32_t sequence)
+{
+    return sequence * 33U + 7U;
+}
+
+static void test_queue_order_and_full_drop(void)
+{
+    frame_mailbox_entry_t entry;
+    frame_mailbox_stats_t stats;
+
+    frame_mailbox_init(&mailbox, FRAME_MAILBOX_MODE_QUEUE);
+    TEST_ASSERT(!frame_mailbox_pop(&mailbox, &entry));
+
+    for (uint32_t i = 0; i < FRAME_MAILBOX_CAPACITY; i++) {
+        TEST_ASSERT(frame_mailbox_post(&mailbox, i, 100 + i));
+    }
+    TEST_ASSERT(!frame_mailbox_post(&mailbox, 9, 999));
+
+    for (uint32_t i = 0; i < FRAME_MAILBOX_CAPACITY; i++) {
+        TEST_ASSERT(frame_mailbox_pop(&mailbox, &entry));
+        TEST_ASSERT_EQ(entry.sequence, i);
+        TEST_ASSERT_EQ(entry.buffer_index, i);
+        TEST_ASSERT_EQ(entry.timestamp, 100 + i);
+    }
+    TEST_ASSERT(!frame_mailbox_pop(&mailbox, &entry));
+
+    /* The dropped frame still consumed a sequence number */
+    frame_mailbox_post(&mailbox, 0, 0);
+    frame_mailbox_pop(&mailbox, &entry);
+    TEST_ASSERT_EQ(entry.sequence, FRAME_MAILBOX_CAPACITY + 1);
+
+    frame_mailbox_get_stats(&mailbox, &stats);
+    TEST_ASSERT_EQ(stats.posted, FRAME_MAILBOX_CAPACITY + 2);
+    TEST_ASSERT_EQ(stats.delivered, FRAME_MAILBOX_CAPACITY + 1);
+    TEST_ASSERT_EQ(stats.dropped_full, 1);
+}
+
+static void test_latest_wins_and_counts_overwrites(void)
+{
+    frame_mailbox_entry_t entry;
+    frame_mailbox_stats_t stats;
+
+    frame_mailbox_init(&mailbox, FRAME_MAILBOX_MODE_LATEST);
+    TEST_ASSERT(!frame_mailbox_pop(&mailbox, &entry));
+
+    for (uint32_t i = 0; i < 5; i++) {
+        TEST_ASSERT(frame_mailbox_post(&mailbox, i & 1, i));
+    }
+    TEST_ASSERT(frame_mailbox_pop(&mailbox, &entry));
+    TEST_ASSERT_EQ(entry.sequence, 4);
+    TEST_ASSERT_EQ(entry.buffer_index, 0);
+    TEST_ASSERT(!frame_mailbox_pop(&mailbox, &entry));
+
+    frame_mailbox_post(&mailbox, 1, 5);
+    TEST_ASSERT_EQ(frame_mailbox_flush(&mailbox), 1);
+    TEST_ASSERT(!frame_mailbox_pop(&mailbox, &entry));
+
+    frame_mailbox_get_stats(&mailbox, &stats);
+    TEST_ASSERT_EQ(stats.posted, 6);
+    TEST_ASSERT_EQ(stats.delivered, 1);
+    TEST_ASSERT_EQ(stats.flushed, 1);
+    TEST_ASSERT_EQ(stats.dropped_overwritten, 4);
+}
+
+static void test_wait_times_out(void)
+{
+    frame_mailbox_entry_t entry;
+
+    frame_mailbox_init(&mailbox, FRAME_MAILBOX_MODE_QUEUE);
+    TEST_ASSERT_EQ(frame_mailbox_wait(&mailbox, &entry, 5), -2);
+    frame_mailbox_post(&mailbox, 1, 2);
+    TEST_ASSERT_EQ(frame_mailbox_wait(&mailbox, &entry, 5), 0);
+    TEST_ASSERT_EQ(entry.buffer_index, 1);
+}
+
+/* ========================================================================= */
+/* STRESS TEST                                                               */
+/* ========================================================================= */
+
+typedef struct {
+    uint32_t received;
+    uint32_t torn;
+    uint32_t out_of_order;
+    uint32_t gaps;
+    int64_t last_sequence;
+} consumer_result_t;
+
+static atomic_bool producer_done;
+
+static void *producer_thread(void *arg)
+{
+    (void)arg;
+    for (uint32_t seq = 0; seq < STRESS_FRAMES; seq++) {
+        frame_mailbox_post(&mailbox, expected_buffer(seq), expected_timestamp(seq));
+        if ((seq & 0x3FF) == 0) {
+            sched_yield();
+        }
+    }
+    atomic_store(&producer_done, true);
+    return NULL;
+}
+
+static void *consumer_thread(void *arg)
+{
+    consumer_result_t *result = (consumer_result_t *)arg;
+    frame_mailbox_entry_t entry;
+    int64_t last = -1;
+
+    for (;;) {
+        /* Read the flag first so a final post is never missed */
+        bool done = atomic_load(&producer_done);
+        if (!frame_mailbox_pop(&mailbox, &entry)) {
+            if (done) {
+                break;
+            }
+            continue;
+        }
+
+        result->received++;
+        if (entry.buffer_index != expected_buffer(entry.sequence) ||
+            entry.timestamp != expected_timestamp(entry.sequence)) {
+            result->torn++;
+        }
+        if ((int64_t)entry.sequence <= last) {
+            result->out_of_order++;
+        } else if ((int64_t)entry.sequence != last + 1) {
+            result->gaps += (uint32_t)((int64_t)entry.sequence - last - 1);
+        }
+        last = entry.sequence;
+    }
+    result->last_sequence = last;
+    return NULL;
+}
+
+static void run_stress(frame_mailbox_mode_t mode)
+{
+    pthread_t producer;
+    pthread_t consumer;
+    consumer_result_t result;
+    frame_mailbox_stats_t stats;
+
+    memset(&result, 0, sizeof(result));
+    frame_mailbox_init(&mailbox, mode);
+    atomic_store(&producer_done, false);
+
+    TEST_ASSERT_EQ(pthread_create(&consumer, NULL, consumer_thread, &result), 0);
+    TEST_ASSERT_EQ(pthread_create(&producer, NULL, producer_thread, NULL), 0);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    frame_mailbox_get_stats(&mailbox, &stats);
+    const uint32_t dropped = stats.dropped_full + stats.dropped_overwritten;
+    /* Queue mode can drop the final frames after the last delivered one */
+    const uint32_t trailing = (uint32_t)((int64_t)STRESS_FRAMES - 1 - result.last_sequence);
+
+    TEST_ASSERT_EQ(result.torn, 0);
+    TEST_ASSERT_EQ(result.out_of_order, 0);
+    TEST_ASSERT_EQ(stats.posted, STRESS_FRAMES);
+    TEST_ASSERT_EQ(stats.delivered, result.received);
+    /* Every frame is either delivered or counted as dropped */
+    TEST_ASSERT_EQ(stats.delivered + dropped, STRESS_FRAMES);
+    TEST_ASSERT_EQ(result.gaps + trailing, dropped);
+    TEST_ASSERT(result.received > 0);
+
+    printf("    %s: delivered %u, dropped %u\n",
+           (mode == FRAME_MAILBOX_MODE_QUEUE) ? "queue " : "latest",
+           stats.delivered, dropped);
+}
+
+static void test_stress_queue_mode(void)
+{
+    run_stress(FRAME_MAILBOX_MODE_QUEUE);
+}
+
+static void test_stress_latest_mode(void)
+{
+    run_stress(FRAME_MAILBOX_MODE_LATEST);
+}
+
+int main(void)
+{
+    printf("test_frame_mailbox\n");
+    RUN_TEST(test_queue_order_and_full_drop);
+    RUN_TEST(test_latest_wins_and_counts_overwrites);
+    RUN_TEST(test_wait_times_out);
+    RUN_TEST(test_stress_queue_mode);
+    RUN_TEST(test_stress_latest_mode);
+    TEST_EXIT();
+}
@@ -0,0 +1,320 @@
+/**
+ ******************************************************************************
+ * @file    test_frame_processing.c
+ * @author  PeleAB
+ * @brief   Host tests for the frame processing stage engine
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "app_frame_processing.h"
+#include "nn_stub.h"
+#include "target_embedding.h"
+#include "test_common.h"
+#include <string.h>
+#include <unistd.h>
+
+static uint8_t nn_rgb[NN_WIDTH * NN_HEIGHT * NN_BPP];
+static uint8_t fr_rgb[FACE_RECOGNITION_WIDTH * FACE_RECOGNITION_HEIGHT * NN_BPP];
+static frame_processing_context_t ctx;
+
+/* Fake clock advanced explicitly by the recording stages */
+static uint32_t fake_now;
+static uint32_t fake_time(void)
+{
+    return fake_now;
+}
+
+static int call_order[32];
+static int call_count;
+
+static int recording_stage(frame_processing_context_t *c, void *user)
+{
+    (void)c;
+    int id = (int)(intptr_t)user;
+    if (call_count < 32) {
+        call_order[call_count++] = id;
+    }
+    fake_now += (uint32_t)id + 1;
+    return FRAME_STAGE_CONTINUE;
+}
+
+static int exiting_stage(frame_processing_context_t *c, void *user)
+{
+    recording_stage(c, user);
+    return FRAME_STAGE_EARLY_EXIT;
+}
+
+static int failing_stage(frame_processing_context_t *c, void *user)
+{
+    recording_stage(c, user);
+    return -5;
+}
+
+static void setup_recording_pipeline(void)
+{
+    TEST_ASSERT_EQ(frame_processing_init(&ctx, NULL), 0);
+    TEST_ASSERT_EQ(frame_processing_attach_buffers(&ctx, nn_rgb, fr_rgb), 0);
+    ctx.time_source = fake_time;
+    fake_now = 1000;
+    call_count = 0;
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++) {
+        frame_processing_register_stage(&ctx, (pipeline_stage_t)i, NULL, recording_stage,
+                                        (void *)(intptr_t)i, 0);
+    }
+}
+
+static void test_stages_run_in_order_with_timing(void)
+{
+    pipeline_timing_t timing;
+    setup_recording_pipeline();
+
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, &timing), 0);
+    TEST_ASSERT_EQ(call_count, PIPELINE_STAGE_COUNT);
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++) {
+        TEST_ASSERT_EQ(call_order[i], i);
+        TEST_ASSERT_EQ(timing.stage_times[i], (uint32_t)i + 1);
+    }
+    TEST_ASSERT_EQ(timing.timestamp, 1000U);
+    TEST_ASSERT_EQ(timing.total_time, (uint32_t)(PIPELINE_STAGE_COUNT * (PIPELINE_STAGE_COUNT + 1) / 2));
+}
+
+static void test_stage_interval_skips_frames(void)
+{
+    frame_processing_stats_t stats;
+    setup_recording_pipeline();
+    frame_processing_set_stage_interval(&ctx, PIPELINE_STAGE_DETECTION, 3);
+
+    for (int f = 0; f < 7; f++) {
+        TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, NULL), 0);
+    }
+    frame_processing_get_statistics(&ctx, &stats);
+    TEST_ASSERT_EQ(stats.frames_processed, 7U);
+    TEST_ASSERT_EQ(stats.stage_runs[PIPELINE_STAGE_DETECTION], 3U);  /* frames 0, 3, 6 */
+    TEST_ASSERT_EQ(stats.stage_skips[PIPELINE_STAGE_DETECTION], 4U);
+    TEST_ASSERT_EQ(stats.stage_runs[PIPELINE_STAGE_CAPTURE], 7U);
+    TEST_ASSERT_EQ(ctx.last_timing.stage_times[PIPELINE_STAGE_DETECTION], 3U);
+}
+
+static void test_early_exit_honours_always_run(void)
+{
+    frame_processing_stats_t stats;
+    setup_recording_pipeline();
+    frame_processing_register_stage(&ctx, PIPELINE_STAGE_DETECTION, "exit", exiting_stage,
+                                    (void *)(intptr_t)PIPELINE_STAGE_DETECTION, 0);
+    frame_processing_register_stage(&ctx, PIPELINE_STAGE_OUTPUT, "out", recording_stage,
+                                    (void *)(intptr_t)PIPELINE_STAGE_OUTPUT,
+                                    FRAME_STAGE_FLAG_ALWAYS_RUN);
+
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, NULL), 0);
+    TEST_ASSERT_EQ(call_count, 4);
+    TEST_ASSERT_EQ(call_order[2], PIPELINE_STAGE_DETECTION);
+    TEST_ASSERT_EQ(call_order[3], PIPELINE_STAGE_OUTPUT);
+    frame_processing_get_statistics(&ctx, &stats);
+    TEST_ASSERT_EQ(stats.early_exits, 1U);
+    TEST_ASSERT_EQ(stats.stage_skips[PIPELINE_STAGE_RECOGNITION], 1U);
+}
+
+/* An early exit from the capture stage is not the end of the stream */
+static void test_capture_early_exit_runs_always_run_stages(void)
+{
+    frame_processing_stats_t stats;
+    setup_recording_pipeline();
+    frame_processing_register_stage(&ctx, PIPELINE_STAGE_CAPTURE, "exit", exiting_stage,
+                                    (void *)(intptr_t)PIPELINE_STAGE_CAPTURE, 0);
+    frame_processing_register_stage(&ctx, PIPELINE_STAGE_OUTPUT, "out", recording_stage,
+                                    (void *)(intptr_t)PIPELINE_STAGE_OUTPUT,
+                                    FRAME_STAGE_FLAG_ALWAYS_RUN);
+
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, NULL), 0);
+    TEST_ASSERT_EQ(call_count, 2);
+    TEST_ASSERT_EQ(call_order[0], PIPELINE_STAGE_CAPTURE);
+    TEST_ASSERT_EQ(call_order[1], PIPELINE_STAGE_OUTPUT);
+    frame_processing_get_statistics(&ctx, &stats);
+    TEST_ASSERT_EQ(stats.early_exits, 1U);
+    TEST_ASSERT_EQ(stats.frames_processed, 1U);
+    TEST_ASSERT_EQ(stats.stage_skips[PIPELINE_STAGE_DETECTION], 1U);
+}
+
+static void test_stage_error_aborts_frame(void)
+{
+    frame_processing_stats_t stats;
+    setup_recording_pipeline();
+    frame_processing_register_stage(&ctx, PIPELINE_STAGE_PREPROCESSING, "fail", failing_stage,
+                                    (void *)(intptr_t)PIPELINE_STAGE_PREPROCESSING, 0);
+
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, NULL), -5);
+    TEST_ASSERT_EQ(call_count, 2);
+    frame_processing_get_statistics(&ctx, &stats);
+    TEST_ASSERT_EQ(stats.errors, 1U);
+    TEST_ASSERT_EQ(stats.frames_processed, 0U);
+}
+
+static void test_default_pipeline_with_stub_networks(void)
+{
+    const nn_stub_face_t face = {0.25f, 0.5f, 0.3f, 0.9f};
+
+    memset(nn_rgb, 0x80, sizeof(nn_rgb));
+    nn_stub_set_faces(&face, 1);
+    embeddings_bank_init();
+
+    TEST_ASSERT_EQ(frame_processing_init(&ctx, NULL), 0);
+    TEST_ASSERT_EQ(frame_processing_attach_buffers(&ctx, nn_rgb, fr_rgb), 0);
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, nn_rgb, NN_WIDTH, NN_HEIGHT, NULL), 0);
+
+    const pd_pp_box_t *boxes = (const pd_pp_box_t *)ctx.face_detection.pp_output.pOutData;
+    TEST_ASSERT_EQ(ctx.face_count, 1U);
+    TEST_ASSERT_NEAR(boxes[0].x_center, 0.25f, 0.01f);
+    TEST_ASSERT_NEAR(boxes[0].y_center, 0.5f, 0.01f);
+    TEST_ASSERT_NEAR(boxes[0].width, 0.3f, 0.01f);
+    TEST_ASSERT_EQ(ctx.recognition_count, 1U);
+    TEST_ASSERT(ctx.face_recognition.embedding_valid);
+    frame_processing_cleanup(&ctx);
+}
+
+static void test_exit_without_faces_skips_recognition(void)
+{
+    frame_processing_stats_t stats;
+
+    nn_stub_set_faces(NULL, 0);
+    TEST_ASSERT_EQ(frame_processing_init(&ctx, NULL), 0);
+    TEST_ASSERT_EQ(frame_processing_attach_buffers(&ctx, nn_rgb, fr_rgb), 0);
+    ctx.exit_without_faces = true;
+
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, nn_rgb, NN_WIDTH, NN_HEIGHT, NULL), 0);
+    frame_processing_get_statistics(&ctx, &stats);
+    TEST_ASSERT_EQ(ctx.face_count, 0U);
+    TEST_ASSERT_EQ(stats.early_exits, 1U);
+    TEST_ASSERT_EQ(stats.stage_runs[PIPELINE_STAGE_RECOGNITION], 0U);
+    frame_processing_cleanup(&ctx);
+}
+
+static void test_recognition_invalidates_detection_input(void)
+{
+    uint32_t face_count = 0;
+
+    nn_stub_set_faces(NULL, 0);
+    TEST_ASSERT_EQ(frame_processing_init(&ctx, NULL), 0);
+    TEST_ASSERT_EQ(frame_processing_attach_buffers(&ctx, nn_rgb, fr_rgb), 0);
+    TEST_ASSERT_EQ(nn_face_recognition_init(&ctx.face_recognition, &ctx.config, NULL), 0);
+
+    /* Both networks share the activation pools: the recognizer overwrites
+     * the detector input prepared before it ran */
+    TEST_ASSERT_EQ(frame_processing_preprocessing_stage(&ctx), 0);
+    TEST_ASSERT_EQ(nn_activation_get_owner(), NN_ACTIVATION_OWNER_DETECTION);
+    TEST_ASSERT_EQ(nn_face_recognition_process(&ctx.face_recognition, fr_rgb, FACE_RECOGNITION_WIDTH,
+                                               FACE_RECOGNITION_HEIGHT, &ctx.config), 0);
+    TEST_ASSERT_EQ(nn_activation_get_owner(), NN_ACTIVATION_OWNER_RECOGNITION);
+    TEST_ASSERT(frame_processing_detection_stage(&ctx, NULL, 0, &face_count) < 0);
+
+    TEST_ASSERT_EQ(frame_processing_preprocessing_stage(&ctx), 0);
+    TEST_ASSERT_EQ(frame_processing_detection_stage(&ctx, NULL, 0, &face_count), 0);
+    TEST_ASSERT_EQ(nn_activation_get_owner(), NN_ACTIVATION_OWNER_DETECTION);
+    frame_processing_cleanup(&ctx);
+}
+
+/* Sensor finishes the frame 5 ms into a 10 ms wait */
+static int timed_source_acquire(frame_source_t *src, uint8_t *dest, uint32_t dest_size)
+{
+    (void)dest;
+    (void)dest_size;
+    src->frame_timestamp = fake_now + 5;
+    fake_now += 10;
+    return 0;
+}
+
+static void test_latency_starts_at_capture_and_steady_fps(void)
+{
+    frame_source_t src = { .name = "timed", .acquire = timed_source_acquire };
+    frame_processing_stats_t stats;
+    pipeline_timing_t timing;
+
+    /* Built-in capture stage polls the source, the rest are recorders */
+    TEST_ASSERT_EQ(frame_processing_init(&ctx, NULL), 0);
+    TEST_ASSERT_EQ(frame_processing_attach_buffers(&ctx, nn_rgb, fr_rgb), 0);
+    ctx.time_source = fake_time;
+    fake_now = 1000;
+    call_count = 0;
+    for (int i = PIPELINE_STAGE_PREPROCESSING; i < PIPELINE_STAGE_COUNT; i++) {
+        frame_processing_register_stage(&ctx, (pipeline_stage_t)i, NULL, recording_stage,
+                                        (void *)(intptr_t)i, 0);
+    }
+    frame_processing_set_source(&ctx, &src);
+
+    /* 10 ms capture wait + stages 1..6 taking 2..7 ms */
+    const uint32_t frame_time = 10 + 27;
+    for (int f = 0; f < FRAME_PROCESSING_WARMUP_FRAMES + 10; f++) {
+        TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, &timing), 0);
+    }
+    TEST_ASSERT_EQ(timing.total_time, frame_time);
+    TEST_ASSERT_EQ(timing.capture_timestamp, timing.timestamp + 5);
+    TEST_ASSERT_EQ(timing.latency, frame_time - 5);
+
+    frame_processing_get_statistics(&ctx, &stats);
+    TEST_ASSERT_EQ(stats.latency_max, frame_time - 5);
+    TEST_ASSERT_EQ(stats.latency_total, (FRAME_PROCESSING_WARMUP_FRAMES + 10) * (frame_time - 5));
+    TEST_ASSERT_NEAR(stats.steady_fps, 1000.0f / (float)frame_time, 0.01f);
+}
+
+static void test_file_source_replay_and_end_of_stream(void)
+{
+    char path[] = "/tmp/test_frames_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    FILE *f = fdopen(fd, "wb");
+    for (int i = 0; i < 2; i++) {
+        memset(nn_rgb, i + 1, sizeof(nn_rgb));
+        fwrite(nn_rgb, 1, sizeof(nn_rgb), f);
+    }
+    fclose(f);
+
+    frame_source_t src;
+    TEST_ASSERT_EQ(frame_source_file_init(&src, path, false), 0);
+    TEST_ASSERT_EQ(frame_source_start(&src), 0);
+
+    TEST_ASSERT_EQ(frame_processing_init(&ctx, NULL), 0);
+    TEST_ASSERT_EQ(frame_processing_attach_buffers(&ctx, nn_rgb, fr_rgb), 0);
+    frame_processing_set_source(&ctx, &src);
+
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, NULL), 0);
+    TEST_ASSERT_EQ(nn_rgb[0], 1);
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, NULL), 0);
+    TEST_ASSERT_EQ(nn_rgb[0], 2);
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, NULL, NN_WIDTH, NN_HEIGHT, NULL),
+                   FRAME_PROCESSING_END_OF_STREAM);
+    frame_processing_cleanup(&ctx);
+
+    TEST_ASSERT_EQ(frame_source_file_init(&src, path, true), 0);
+    TEST_ASSERT_EQ(frame_source_start(&src), 0);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQ(frame_source_acquire(&src, nn_rgb, sizeof(nn_rgb)), 0);
+    }
+    TEST_ASSERT_EQ(nn_rgb[0], 1);
+    frame_source_stop(&src);
+    unlink(path);
+}
+
+int main(void)
+{
+    printf("test_frame_processing\n");
+    RUN_TEST(test_stages_run_in_order_with_timing);
+    RUN_TEST(test_stage_interval_skips_frames);
+    RUN_TEST(test_early_exit_honours_always_run);
+    RUN_TEST(test_capture_early_exit_runs_always_run_stages);
+    RUN_TEST(test_stage_error_aborts_frame);
+    RUN_TEST(test_default_pipeline_with_stub_networks);
+    RUN_TEST(test_exit_without_faces_skips_recognition);
+    RUN_TEST(test_recognition_invalidates_detection_input);
+    RUN_TEST(test_latency_starts_at_capture_and_steady_fps);
+    RUN_TEST(test_file_source_replay_and_end_of_stream);
+    TEST_EXIT();
+}
@@ -0,0 +1,267 @@
+/**
+ ******************************************************************************
+ * @file    test_gfx2d.c
+ * @author  PeleAB
+ * @brief   Host tests and benchmark for the overlay 2D engine (software backend)
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "gfx2d.h"
+#include "perf_monitor.h"
+#include "test_common.h"
+#include <string.h>
+
+#define LAYER_WIDTH     800U
+#define LAYER_HEIGHT    480U
+#define FACE_SIZE       112U
+
+static uint16_t layer[LAYER_HEIGHT * LAYER_WIDTH];
+static uint16_t thumbnail[FACE_SIZE * FACE_SIZE];
+static uint8_t face[FACE_SIZE * FACE_SIZE * 3];
+
+static const gfx2d_surface_t layer_surface = {
+    (uint8_t *)layer, LAYER_WIDTH, LAYER_HEIGHT, LAYER_WIDTH, GFX2D_FORMAT_ARGB4444
+};
+static const gfx2d_surface_t thumbnail_surface = {
+    (uint8_t *)thumbnail, FACE_SIZE, FACE_SIZE, FACE_SIZE, GFX2D_FORMAT_ARGB4444
+};
+static const gfx2d_surface_t face_surface = {
+    face, FACE_SIZE, FACE_SIZE, FACE_SIZE, GFX2D_FORMAT_RGB888
+};
+
+static uint16_t pixel(uint32_t x, uint32_t y)
+{
+    return layer[y * LAYER_WIDTH + x];
+}
+
+static uint32_t count_pixels(uint16_t value)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < LAYER_WIDTH * LAYER_HEIGHT; i++) {
+        n += (layer[i] == value);
+    }
+    return n;
+}
+
+static void reset(void)
+{
+    gfx2d_init();
+    memset(layer, 0, sizeof(layer));
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_fill_clips_and_converts(void)
+{
+    reset();
+    TEST_ASSERT_EQ(gfx2d_fill(&layer_surface, -10, 470, 30, 40, 0xFF12AB9CU), 0);
+    TEST_ASSERT_EQ(gfx2d_fill(&layer_surface, 900, 0, 10, 10, 0xFFFFFFFFU), 0);
+    TEST_ASSERT_EQ(gfx2d_wait(), 0);
+
+    /* 4 MSBs of each channel, clipped to 20 x 10 */
+    TEST_ASSERT_EQ(pixel(0, 470), 0xF1A9);
+    TEST_ASSERT_EQ(pixel(19, 479), 0xF1A9);
+    TEST_ASSERT_EQ(pixel(20, 479), 0);
+    TEST_ASSERT_EQ(pixel(0, 469), 0);
+    TEST_ASSERT_EQ(count_pixels(0xF1A9), 20U * 10U);
+
+    gfx2d_stats_t stats;
+    gfx2d_get_stats(&stats);
+    TEST_ASSERT_EQ(stats.submitted, 1U);
+    TEST_ASSERT_EQ(stats.completed, 1U);
+    TEST_ASSERT_EQ(stats.pixels, 200U);
+}
+
+static void test_rect_draws_outline_only(void)
+{
+    reset();
+    TEST_ASSERT_EQ(gfx2d_rect(&layer_surface, 100, 50, 60, 40, 2, 0xFF00FF00U), 0);
+    TEST_ASSERT_EQ(gfx2d_wait(), 0);
+
+    TEST_ASSERT_EQ(pixel(100, 50), 0xF0F0);
+    TEST_ASSERT_EQ(pixel(159, 89), 0xF0F0);
+    TEST_ASSERT_EQ(pixel(101, 70), 0xF0F0);
+    TEST_ASSERT_EQ(pixel(158, 70), 0xF0F0);
+    TEST_ASSERT_EQ(pixel(102, 52), 0);
+    TEST_ASSERT_EQ(pixel(130, 70), 0);
+    TEST_ASSERT_EQ(pixel(160, 70), 0);
+    TEST_ASSERT_EQ(count_pixels(0xF0F0), 60U * 40U - 56U * 36U);
+
+    /* Too small for a hole: one solid fill */
+    TEST_ASSERT_EQ(gfx2d_rect(&layer_surface, 300, 300, 3, 3, 2, 0xFFFF0000U), 0);
+    TEST_ASSERT_EQ(gfx2d_wait(), 0);
+    TEST_ASSERT_EQ(count_pixels(0xFF00), 9U);
+}
+
+static void test_blit_rgb888_converts_channel_order(void)
+{
+    reset();
+    for (uint32_t i = 0; i < FACE_SIZE * FACE_SIZE; i++) {
+        face[i * 3 + 0] = 0xE0;     /* R */
+        face[i * 3 + 1] = 0x50;     /* G */
+        face[i * 3 + 2] = (uint8_t)(i % FACE_SIZE);
+    }
+    TEST_ASSERT_EQ(gfx2d_blit(&thumbnail_surface, 0, 0, &face_surface), 0);
+    TEST_ASSERT_EQ(gfx2d_wait(), 0);
+
+    /* Opaque, R in bits 11..8 */
+    TEST_ASSERT_EQ(thumbnail[0], 0xFE50);
+    TEST_ASSERT_EQ(thumbnail[FACE_SIZE + 0x3F], 0xFE53);
+    TEST_ASSERT_EQ(thumbnail[FACE_SIZE * FACE_SIZE - 1], 0xFE56);
+}
+
+static void test_blit_argb4444_clips_source(void)
+{
+    reset();
+    for (uint32_t i = 0; i < FACE_SIZE * FACE_SIZE; i++) {
+        thumbnail[i] = (uint16_t)(0xF000U | i);
+    }
+
+    /* Top-left corner off screen: copy starts at source (10, 5) */
+    TEST_ASSERT_EQ(gfx2d_blit(&layer_surface, -10, -5, &thumbnail_surface), 0);
+    /* Bottom-right corner off screen */
+    TEST_ASSERT_EQ(gfx2d_blit(&layer_surface, LAYER_WIDTH - 12, LAYER_HEIGHT - 7, &thumbnail_surface), 0);
+    TEST_ASSERT_EQ(gfx2d_wait(), 0);
+
+    TEST_ASSERT_EQ(pixel(0, 0), 0xF000U | (5U * FACE_SIZE + 10U));
+    TEST_ASSERT_EQ(pixel(101, 106), 0xF000U | (111U * FACE_SIZE + 111U));
+    TEST_ASSERT_EQ(pixel(102, 0), 0);
+    TEST_ASSERT_EQ(pixel(0, 107), 0);
+    TEST_ASSERT_EQ(pixel(LAYER_WIDTH - 12, LAYER_HEIGHT - 7), 0xF000U);
+    TEST_ASSERT_EQ(pixel(LAYER_WIDTH - 1, LAYER_HEIGHT - 1), 0xF000U | (6U * FACE_SIZE + 11U));
+}
+
+static uint32_t fence_order[4];
+static uint32_t fence_count;
+static uint16_t fence_seen;
+
+static void record_fence(void *arg)
+{
+    fence_seen = pixel(0, 0);
+    fence_order[fence_count++] = (uint32_t)(uintptr_t)arg;
+}
+
+static void test_queue_runs_in_order_on_wait(void)
+{
+    reset();
+    fence_count = 0;
+    TEST_ASSERT_EQ(gfx2d_fill(&layer_surface, 0, 0, 4, 4, 0xFFFFFFFFU), 0);
+    TEST_ASSERT_EQ(gfx2d_fence(record_fence, (void *)1), 0);
+    TEST_ASSERT_EQ(gfx2d_fence(record_fence, (void *)2), 0);
+
+    /* Software backend defers until the queue is drained */
+    TEST_ASSERT(!gfx2d_idle());
+    TEST_ASSERT_EQ(pixel(0, 0), 0);
+    TEST_ASSERT_EQ(gfx2d_wait(), 0);
+    TEST_ASSERT(gfx2d_idle());
+    TEST_ASSERT_EQ(fence_count, 2U);
+    TEST_ASSERT_EQ(fence_order[0], 1U);
+    TEST_ASSERT_EQ(fence_order[1], 2U);
+    TEST_ASSERT_EQ(fence_seen, 0xFFFF);
+}
+
+static void test_flush_runs_software_queue(void)
+{
+    reset();
+    fence_count = 0;
+    TEST_ASSERT_EQ(gfx2d_fill(&layer_surface, 0, 0, 4, 4, 0xFFFFFFFFU), 0);
+    TEST_ASSERT_EQ(gfx2d_fence(record_fence, (void *)3), 0);
+
+    /* Nothing else drains the software queue for the display task */
+    TEST_ASSERT_EQ(gfx2d_flush(), 0);
+    TEST_ASSERT(gfx2d_idle());
+    TEST_ASSERT_EQ(fence_count, 1U);
+    TEST_ASSERT_EQ(fence_order[0], 3U);
+    TEST_ASSERT_EQ(fence_seen, 0xFFFF);
+}
+
+static void test_full_queue_runs_oldest(void)
+{
+    reset();
+    for (uint32_t i = 0; i < GFX2D_QUEUE_DEPTH + 3U; i++) {
+        TEST_ASSERT_EQ(gfx2d_fill(&layer_surface, (int32_t)i, 0, 1, 1, 0xF0000000U), 0);
+    }
+    /* The three oldest ran to make room */
+    TEST_ASSERT_EQ(pixel(2, 0), 0xF000);
+    TEST_ASSERT_EQ(pixel(3, 0), 0);
+    TEST_ASSERT_EQ(gfx2d_wait(), 0);
+    TEST_ASSERT_EQ(count_pixels(0xF000), GFX2D_QUEUE_DEPTH + 3U);
+
+    gfx2d_stats_t stats;
+    gfx2d_get_stats(&stats);
+    TEST_ASSERT_EQ(stats.queue_full, 3U);
+    TEST_ASSERT_EQ(stats.completed, GFX2D_QUEUE_DEPTH + 3U);
+}
+
+static void test_invalid_arguments(void)
+{
+    gfx2d_surface_t bad = layer_surface;
+
+    reset();
+    TEST_ASSERT(gfx2d_fill(NULL, 0, 0, 1, 1, 0) < 0);
+    TEST_ASSERT(gfx2d_fill(&face_surface, 0, 0, 1, 1, 0) < 0);
+    TEST_ASSERT(gfx2d_fill(&layer_surface, 0, 0, -1, 1, 0) < 0);
+    TEST_ASSERT(gfx2d_rect(&layer_surface, 0, 0, 10, 10, 0, 0) < 0);
+    TEST_ASSERT(gfx2d_blit(&face_surface, 0, 0, &thumbnail_surface) < 0);
+    TEST_ASSERT(gfx2d_fence(NULL, NULL) < 0);
+    bad.stride = LAYER_WIDTH - 1U;
+    TEST_ASSERT(gfx2d_fill(&bad, 0, 0, 1, 1, 0) < 0);
+    TEST_ASSERT(gfx2d_idle());
+}
+
+/* CPU time per frame of the overlay work: executed here in software, only
+ * queued when DMA2D runs it */
+static void test_benchmark_frame_cpu_time(void)
+{
+    const uint32_t frames = 50;
+    gfx2d_stats_t stats;
+
+    reset();
+    gfx2d_reset_stats();
+    for (uint32_t f = 0; f < frames; f++) {
+        /* Typical dirty clear: two boxes with labels and the info text */
+        gfx2d_fill(&layer_surface, 180, 60, 210, 250, 0);
+        gfx2d_fill(&layer_surface, 450, 120, 160, 190, 0);
+        gfx2d_fill(&layer_surface, 240, 400, 320, 75, 0);
+        gfx2d_rect(&layer_surface, 200, 80, 180, 220, 1, 0xFFFF0000U);
+        gfx2d_rect(&layer_surface, 460, 140, 140, 160, 1, 0xFF00FF00U);
+        gfx2d_blit(&thumbnail_surface, 0, 0, &face_surface);
+        gfx2d_blit(&layer_surface, 24, 24, &thumbnail_surface);
+        TEST_ASSERT_EQ(gfx2d_wait(), 0);
+    }
+    gfx2d_get_stats(&stats);
+    TEST_ASSERT_EQ(stats.errors, 0U);
+
+    const double ticks_per_us = (double)perf_monitor_cycles_per_us();
+    printf("    %.1f kpixels/frame: execute %.1f us, queue %.1f us per frame\n",
+           (double)stats.pixels / frames / 1000.0,
+           (double)stats.sw_cycles / frames / ticks_per_us,
+           (double)stats.submit_cycles / frames / ticks_per_us);
+}
+
+int main(void)
+{
+    printf("test_gfx2d\n");
+    RUN_TEST(test_fill_clips_and_converts);
+    RUN_TEST(test_rect_draws_outline_only);
+    RUN_TEST(test_blit_rgb888_converts_channel_order);
+    RUN_TEST(test_blit_argb4444_clips_source);
+    RUN_TEST(test_queue_runs_in_order_on_wait);
+    RUN_TEST(test_flush_runs_software_queue);
+    RUN_TEST(test_full_queue_runs_oldest);
+    RUN_TEST(test_invalid_arguments);
+    RUN_TEST(test_benchmark_frame_cpu_time);
+    TEST_EXIT();
+}
@@ -0,0 +1,169 @@
+/**
+ ******************************************************************************
+ * @file    test_memory_planner.c
+ * @author  PeleAB
+ * @brief   Host tests for the lifetime-based scratch buffer planner
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "memory_planner.h"
+#include "app_frame_processing.h"
+#include "test_common.h"
+#include <string.h>
+
+#define NN_RGB_SIZE     (NN_WIDTH * NN_HEIGHT * NN_BPP)
+#define FR_RGB_SIZE     (FACE_RECOGNITION_WIDTH * FACE_RECOGNITION_HEIGHT * NN_BPP)
+
+static uint8_t *nn_rgb;
+static uint8_t *fr_rgb;
+
+/* Same declaration as the application in main.c */
+static void declare_app_plan(memory_plan_t *plan, uint32_t nn_rgb_last_stage)
+{
+    memory_plan_init(plan);
+    memory_plan_add(plan, "nn_rgb", NN_RGB_SIZE, 0,
+                    PIPELINE_STAGE_CAPTURE, nn_rgb_last_stage, (void **)&nn_rgb);
+    memory_plan_add(plan, "fr_rgb", FR_RGB_SIZE, 0,
+                    PIPELINE_STAGE_RECOGNITION, PIPELINE_STAGE_RECOGNITION, (void **)&fr_rgb);
+}
+
+static bool ranges_overlap(const uint8_t *a, uint32_t a_size, const uint8_t *b, uint32_t b_size)
+{
+    return a < b + b_size && b < a + a_size;
+}
+
+static void test_camera_plan_aliases_nn_rgb(void)
+{
+    memory_plan_t plan;
+    declare_app_plan(&plan, PIPELINE_STAGE_PREPROCESSING);
+
+    uint32_t size = memory_plan_solve(&plan);
+    TEST_ASSERT(memory_plan_verify(&plan));
+    TEST_ASSERT_EQ(plan.unaliased_size, NN_RGB_SIZE + ALIGN_TO_32(FR_RGB_SIZE));
+    /* nn_rgb is dead before fr_rgb is live: the larger of the two is enough */
+    TEST_ASSERT_EQ(size, NN_RGB_SIZE);
+    TEST_ASSERT_EQ(plan.entries[0].offset, 0);
+    TEST_ASSERT_EQ(plan.entries[1].offset, 0);
+}
+
+static void test_pc_stream_plan_keeps_nn_rgb_live(void)
+{
+    memory_plan_t plan;
+    declare_app_plan(&plan, PIPELINE_STAGE_RECOGNITION);
+
+    uint32_t size = memory_plan_solve(&plan);
+    TEST_ASSERT(memory_plan_verify(&plan));
+    TEST_ASSERT_EQ(size, plan.unaliased_size);
+}
+
+static void test_bind_aliases_dead_nn_rgb(void)
+{
+    static uint8_t storage[256 * 1024] __attribute__ ((aligned (CACHE_LINE_ALIGNMENT)));
+    memory_plan_t plan;
+    declare_app_plan(&plan, PIPELINE_STAGE_PREPROCESSING);
+
+    uint32_t size = memory_plan_solve(&plan);
+    TEST_ASSERT_EQ(memory_plan_bind(&plan, storage, size - 1), -2);
+    TEST_ASSERT_EQ(memory_plan_bind(&plan, storage + 1, size), -4);
+    TEST_ASSERT_EQ(memory_plan_bind(&plan, storage, size), 0);
+
+    TEST_ASSERT(nn_rgb == storage);
+    TEST_ASSERT(ranges_overlap(nn_rgb, NN_RGB_SIZE, fr_rgb, FR_RGB_SIZE));
+    for (uint32_t i = 0; i < plan.entry_count; i++) {
+        TEST_ASSERT_EQ(plan.entries[i].offset % CACHE_LINE_ALIGNMENT, 0);
+    }
+}
+
+static void test_bind_publishes_disjoint_live_buffers(void)
+{
+    static uint8_t storage[256 * 1024] __attribute__ ((aligned (CACHE_LINE_ALIGNMENT)));
+    memory_plan_t plan;
+    declare_app_plan(&plan, PIPELINE_STAGE_RECOGNITION);
+
+    /* Both live during recognition: the published pointers must not overlap */
+    uint32_t size = memory_plan_solve(&plan);
+    TEST_ASSERT(size <= sizeof(storage));
+    TEST_ASSERT_EQ(memory_plan_bind(&plan, storage, size), 0);
+    TEST_ASSERT(!ranges_overlap(nn_rgb, NN_RGB_SIZE, fr_rgb, FR_RGB_SIZE));
+    TEST_ASSERT(nn_rgb >= storage && nn_rgb + NN_RGB_SIZE <= storage + size);
+    TEST_ASSERT(fr_rgb >= storage && fr_rgb + FR_RGB_SIZE <= storage + size);
+}
+
+static void test_verify_detects_live_overlap(void)
+{
+    memory_plan_t plan;
+    memory_plan_init(&plan);
+    memory_plan_add(&plan, "a", 100, 0, 0, 2, NULL);
+    memory_plan_add(&plan, "b", 100, 0, 2, 3, NULL);
+    memory_plan_add(&plan, "c", 100, 64, 3, 4, NULL);
+    memory_plan_solve(&plan);
+
+    /* a and b share stage 2, b and c share stage 3; a and c may alias */
+    TEST_ASSERT(memory_plan_verify(&plan));
+    TEST_ASSERT_EQ(plan.entries[0].offset, plan.entries[2].offset);
+    TEST_ASSERT_EQ(plan.entries[1].offset, 128);
+    TEST_ASSERT_EQ(plan.arena_size, 256);
+
+    plan.entries[1].offset = 64;
+    TEST_ASSERT(!memory_plan_verify(&plan));
+}
+
+static void test_rejects_invalid_declarations(void)
+{
+    memory_plan_t plan;
+    memory_plan_init(&plan);
+    TEST_ASSERT(memory_plan_add(&plan, "zero", 0, 0, 0, 0, NULL) < 0);
+    TEST_ASSERT(memory_plan_add(&plan, "reversed", 16, 0, 3, 1, NULL) < 0);
+    TEST_ASSERT(memory_plan_add(&plan, "align", 16, 48, 0, 0, NULL) < 0);
+    TEST_ASSERT_EQ(memory_plan_solve(&plan), 0);
+    for (int i = 0; i < MEMORY_PLAN_MAX_ENTRIES; i++) {
+        TEST_ASSERT_EQ(memory_plan_add(&plan, "x", 16, 0, 0, 0, NULL), 0);
+    }
+    TEST_ASSERT_EQ(memory_plan_add(&plan, "full", 16, 0, 0, 0, NULL), -2);
+}
+
+static void test_allocate_from_pool_region(void)
+{
+    static uint8_t storage[4096] __attribute__ ((aligned (CACHE_LINE_ALIGNMENT)));
+    memory_pool_t pool;
+    memory_plan_t plan;
+    void *a = NULL;
+    void *b = NULL;
+
+    memory_pool_init(&pool);
+    memory_pool_add_region(&pool, MEMORY_REGION_AXISRAM, storage, sizeof(storage), true);
+    memory_plan_init(&plan);
+    memory_plan_add(&plan, "a", 1000, 0, 0, 0, &a);
+    memory_plan_add(&plan, "b", 2000, 0, 1, 1, &b);
+
+    TEST_ASSERT_EQ(memory_plan_allocate(&plan, &pool, MEMORY_REGION_AXISRAM, "scratch"), 0);
+    TEST_ASSERT(a == b && a == storage);
+    TEST_ASSERT_EQ(pool.arenas[MEMORY_REGION_AXISRAM].used, ALIGN_TO_32(2000));
+    TEST_ASSERT(memory_pool_get_buffer_by_name(&pool, "scratch") != NULL);
+
+    /* Missing region: caller can fall back to another one */
+    TEST_ASSERT_EQ(memory_plan_allocate(&plan, &pool, MEMORY_REGION_PSRAM, "scratch"), -2);
+}
+
+int main(void)
+{
+    printf("test_memory_planner\n");
+    RUN_TEST(test_camera_plan_aliases_nn_rgb);
+    RUN_TEST(test_pc_stream_plan_keeps_nn_rgb_live);
+    RUN_TEST(test_bind_aliases_dead_nn_rgb);
+    RUN_TEST(test_bind_publishes_disjoint_live_buffers);
+    RUN_TEST(test_verify_detects_live_overlap);
+    RUN_TEST(test_rejects_invalid_declarations);
+    RUN_TEST(test_allocate_from_pool_region);
+    TEST_EXIT();
+}
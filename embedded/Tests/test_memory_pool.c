@@ -0,0 +1,223 @@
+/**
+ ******************************************************************************
+ * @file    test_memory_pool.c
+ * @author  PeleAB
+ * @brief   Host tests for the static arena memory pool
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "memory_pool.h"
+#include "test_common.h"
+#include <string.h>
+
+#define TEST_ARENA_SIZE     4096
+
+/* Deliberately misaligned by one byte to exercise arena trimming */
+static uint8_t cached_storage[TEST_ARENA_SIZE + CACHE_LINE_ALIGNMENT] __attribute__ ((aligned (64)));
+static uint8_t uncached_storage[TEST_ARENA_SIZE] __attribute__ ((aligned (64)));
+
+static memory_pool_t pool;
+
+static void setup_pool(void)
+{
+    memory_pool_init(&pool);
+    memory_pool_add_region(&pool, MEMORY_REGION_AXISRAM, cached_storage + 1,
+                           TEST_ARENA_SIZE, true);
+    memory_pool_add_region(&pool, MEMORY_REGION_PSRAM, uncached_storage,
+                           TEST_ARENA_SIZE, false);
+}
+
+static void test_region_is_trimmed_to_cache_lines(void)
+{
+    setup_pool();
+    const memory_arena_t *arena = &pool.arenas[MEMORY_REGION_AXISRAM];
+
+    TEST_ASSERT_EQ((uintptr_t)arena->base % CACHE_LINE_ALIGNMENT, 0);
+    TEST_ASSERT(arena->base >= cached_storage + 1);
+    TEST_ASSERT(arena->base + arena->size <= cached_storage + 1 + TEST_ARENA_SIZE);
+    TEST_ASSERT_EQ(arena->size % CACHE_LINE_ALIGNMENT, 0);
+    TEST_ASSERT_EQ(memory_pool_add_region(&pool, MEMORY_REGION_AXISRAM, cached_storage,
+                                          TEST_ARENA_SIZE, true), -2);
+}
+
+static void test_cached_buffers_own_whole_lines(void)
+{
+    setup_pool();
+
+    uint8_t *a = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 10, 4,
+                                          MEMORY_BUFFER_TYPE_TEMPORARY, "a");
+    uint8_t *b = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 33, 0,
+                                          MEMORY_BUFFER_TYPE_TEMPORARY, "b");
+    uint8_t *c = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 100, 128,
+                                          MEMORY_BUFFER_TYPE_TEMPORARY, "c");
+
+    TEST_ASSERT(a != NULL && b != NULL && c != NULL);
+    TEST_ASSERT_EQ((uintptr_t)a % CACHE_LINE_ALIGNMENT, 0);
+    TEST_ASSERT_EQ((uintptr_t)b % CACHE_LINE_ALIGNMENT, 0);
+    TEST_ASSERT_EQ((uintptr_t)c % 128, 0);
+    TEST_ASSERT_EQ(memory_pool_get_buffer(&pool, a)->size, CACHE_LINE_ALIGNMENT);
+    TEST_ASSERT_EQ(memory_pool_get_buffer(&pool, b)->size, 2 * CACHE_LINE_ALIGNMENT);
+    TEST_ASSERT_EQ(b - a, CACHE_LINE_ALIGNMENT);
+    TEST_ASSERT(memory_pool_validate(&pool));
+
+    /* Uncached regions only need word alignment */
+    uint8_t *u = memory_pool_alloc_region(&pool, MEMORY_REGION_PSRAM, 6, 0,
+                                          MEMORY_BUFFER_TYPE_PROTOCOL, "u");
+    uint8_t *v = memory_pool_alloc_region(&pool, MEMORY_REGION_PSRAM, 6, 0,
+                                          MEMORY_BUFFER_TYPE_PROTOCOL, "v");
+    TEST_ASSERT_EQ(v - u, 8);
+    TEST_ASSERT(!memory_pool_get_buffer(&pool, u)->is_cached);
+
+    /* Invalid alignment and missing regions are rejected */
+    TEST_ASSERT(memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 16, 24,
+                                         MEMORY_BUFFER_TYPE_TEMPORARY, "bad") == NULL);
+    TEST_ASSERT(memory_pool_alloc_region(&pool, MEMORY_REGION_NPURAM, 16, 0,
+                                         MEMORY_BUFFER_TYPE_NN_OUTPUT, "none") == NULL);
+    TEST_ASSERT_EQ(pool.allocation_failures, 2);
+}
+
+static void test_freed_gaps_are_reused_first_fit(void)
+{
+    setup_pool();
+    void *bufs[8];
+
+    for (int i = 0; i < 8; i++) {
+        bufs[i] = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 256, 0,
+                                           MEMORY_BUFFER_TYPE_TEMPORARY, "slot");
+        TEST_ASSERT(bufs[i] != NULL);
+    }
+
+    /* Free every other slot: three holes, the last slot joins the tail */
+    for (int i = 1; i < 8; i += 2) {
+        TEST_ASSERT_EQ(memory_pool_free(&pool, bufs[i]), 0);
+    }
+    TEST_ASSERT_EQ(memory_pool_free(&pool, bufs[1]), -2);
+
+    memory_statistics_t stats;
+    memory_pool_get_region_statistics(&pool, MEMORY_REGION_AXISRAM, &stats);
+    const uint32_t tail = pool.arenas[MEMORY_REGION_AXISRAM].size - 7 * 256;
+    TEST_ASSERT_EQ(stats.used_memory, 4 * 256);
+    TEST_ASSERT_EQ(stats.peak_memory, 8 * 256);
+    TEST_ASSERT_EQ(stats.largest_free_block, tail);
+    TEST_ASSERT_EQ(stats.free_memory, tail + 3 * 256);
+    TEST_ASSERT(stats.fragmentation_percent > 0);
+
+    /* A hole-sized request lands in the first hole, a larger one in the tail */
+    void *small = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 200, 0,
+                                           MEMORY_BUFFER_TYPE_TEMPORARY, "small");
+    void *large = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 512, 0,
+                                           MEMORY_BUFFER_TYPE_TEMPORARY, "large");
+    TEST_ASSERT(small == bufs[1]);
+    TEST_ASSERT(large == bufs[7]);
+    TEST_ASSERT(memory_pool_validate(&pool));
+
+    /* Freeing neighbours coalesces them into one usable block */
+    memory_pool_free(&pool, small);
+    memory_pool_free(&pool, bufs[2]);
+    void *merged = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 768, 0,
+                                            MEMORY_BUFFER_TYPE_TEMPORARY, "merged");
+    TEST_ASSERT(merged == bufs[1]);
+    TEST_ASSERT(memory_pool_validate(&pool));
+
+    /* Sorting reorders the table only; a corrupt region fails validation */
+    TEST_ASSERT_EQ(memory_pool_sort_buffers(&pool), 0);
+    TEST_ASSERT(memory_pool_validate(&pool));
+    pool.buffers[0].region = (memory_region_t)MEMORY_REGION_COUNT;
+    TEST_ASSERT(!memory_pool_validate(&pool));
+}
+
+static void test_exhaustion_and_reset(void)
+{
+    setup_pool();
+    const uint32_t size = pool.arenas[MEMORY_REGION_AXISRAM].size;
+
+    void *all = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, size, 0,
+                                         MEMORY_BUFFER_TYPE_TEMPORARY, "all");
+    TEST_ASSERT(all != NULL);
+    TEST_ASSERT(memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 1, 0,
+                                         MEMORY_BUFFER_TYPE_TEMPORARY, "more") == NULL);
+
+    memory_statistics_t stats;
+    memory_pool_get_statistics(&pool, &stats);
+    TEST_ASSERT_EQ(stats.total_memory, size + TEST_ARENA_SIZE);
+    TEST_ASSERT_EQ(stats.used_memory, size);
+    TEST_ASSERT_EQ(stats.fragmentation_percent, 0);
+
+    TEST_ASSERT_EQ(memory_pool_reset(&pool), 0);
+    TEST_ASSERT_EQ(pool.arenas[MEMORY_REGION_AXISRAM].used, 0);
+    TEST_ASSERT(memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, size, 0,
+                                         MEMORY_BUFFER_TYPE_TEMPORARY, "again") == all);
+
+    /* The buffer table bounds the number of live allocations */
+    memory_pool_reset(&pool);
+    for (int i = 0; i < MEMORY_POOL_MAX_BUFFERS; i++) {
+        TEST_ASSERT(memory_pool_alloc_region(&pool, MEMORY_REGION_PSRAM, 4, 0,
+                                             MEMORY_BUFFER_TYPE_PROTOCOL, "n") != NULL);
+    }
+    TEST_ASSERT(memory_pool_alloc_region(&pool, MEMORY_REGION_PSRAM, 4, 0,
+                                         MEMORY_BUFFER_TYPE_PROTOCOL, "n") == NULL);
+}
+
+static void test_cache_ops_follow_is_cached(void)
+{
+    setup_pool();
+
+    uint8_t *cached = memory_pool_alloc_region(&pool, MEMORY_REGION_AXISRAM, 256, 0,
+                                               MEMORY_BUFFER_TYPE_NN_INPUT, "cached");
+    uint8_t *plain = memory_pool_alloc_region(&pool, MEMORY_REGION_PSRAM, 256, 0,
+                                              MEMORY_BUFFER_TYPE_PROTOCOL, "plain");
+
+    TEST_ASSERT_EQ(memory_pool_clean_cache(&pool, cached), 0);
+    TEST_ASSERT_EQ(memory_pool_invalidate_range(&pool, cached + 40, 64), 0);
+    TEST_ASSERT_EQ(memory_pool_clean_invalidate_cache(&pool, cached), 0);
+    TEST_ASSERT_EQ(pool.cache_clean_ops, 2);
+    TEST_ASSERT_EQ(pool.cache_invalidate_ops, 2);
+
+    /* Uncached buffers are tracked but never maintained */
+    TEST_ASSERT_EQ(memory_pool_invalidate_cache(&pool, plain), 0);
+    TEST_ASSERT_EQ(pool.cache_invalidate_ops, 2);
+    TEST_ASSERT_EQ(memory_pool_get_buffer(&pool, plain)->access_count, 1);
+
+    /* Ranges must stay inside one buffer; interior pointers are not buffers */
+    TEST_ASSERT(memory_pool_clean_range(&pool, cached + 200, 100) < 0);
+    TEST_ASSERT(memory_pool_clean_cache(&pool, cached + 32) < 0);
+    TEST_ASSERT(memory_pool_invalidate_range(NULL, cached, 16) < 0);
+}
+
+static void test_default_pool_and_type_placement(void)
+{
+    memory_pool_t *def = memory_pool_get_default();
+    TEST_ASSERT(def == memory_pool_get_default());
+    TEST_ASSERT_EQ(def->arenas[MEMORY_REGION_AXISRAM].size, MEMORY_POOL_AXISRAM_SIZE);
+    TEST_ASSERT_EQ(def->arenas[MEMORY_REGION_PSRAM].size, MEMORY_POOL_PSRAM_SIZE);
+    TEST_ASSERT_EQ(def->arenas[MEMORY_REGION_NPURAM].size, MEMORY_POOL_NPURAM_SIZE);
+
+    void *p = memory_pool_alloc(def, 100, 0, MEMORY_BUFFER_TYPE_TRACKING, "tracking");
+    memory_buffer_t *buf = memory_pool_get_buffer_by_name(def, "tracking");
+    TEST_ASSERT(buf != NULL && buf->ptr == p);
+    TEST_ASSERT_EQ(buf->region, memory_pool_default_region(MEMORY_BUFFER_TYPE_TRACKING));
+    TEST_ASSERT_EQ(memory_pool_free(def, p), 0);
+    TEST_ASSERT(memory_pool_validate(def));
+}
+
+int main(void)
+{
+    printf("test_memory_pool\n");
+    RUN_TEST(test_region_is_trimmed_to_cache_lines);
+    RUN_TEST(test_cached_buffers_own_whole_lines);
+    RUN_TEST(test_freed_gaps_are_reused_first_fit);
+    RUN_TEST(test_exhaustion_and_reset);
+    RUN_TEST(test_cache_ops_follow_is_cached);
+    RUN_TEST(test_default_pool_and_type_placement);
+    TEST_EXIT();
+}
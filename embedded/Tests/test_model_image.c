@@ -0,0 +1,258 @@
+/**
+ ******************************************************************************
+ * @file    test_model_image.c
+ * @author  PeleAB
+ * @brief   Host tests of the relocatable image checks and model slot selection
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "model_image.h"
+#include "app_neural_network.h"
+#include "test_common.h"
+#include <string.h>
+
+/* Synthetic image: header, c-name, data (ctx + pool descriptors), got,
+ * relocations, then the weights */
+#define IMG_C_NAME          96U
+#define IMG_DATA_DATA       160U
+#define IMG_CTX             0U
+#define IMG_POOLS           64U
+#define IMG_DATA_END        144U
+#define IMG_GOT_END         160U
+#define IMG_BSS_END         1160U
+#define IMG_REL_START       320U
+#define IMG_REL_END         352U
+#define IMG_PARAMS          384U
+#define IMG_PARAMS_SIZE     4096U
+#define IMG_EXT_RAM         65536U
+#define IMG_WORDS           2048U
+
+#define TAG_FLASH(v)        (0x20000000UL | (v))
+#define TAG_RAM(v)          (0x40000000UL | (v))
+
+#define IMG_FLAGS           ((8UL << 28) | (0UL << 24) | ((uint32_t)MODEL_IMAGE_EXTRA_ASYNC << 20) | \
+                             (8UL << 16) | (2UL << 13) | (1UL << 12) | MODEL_IMAGE_CPUID_CORTEX_M55)
+#define RT_VERSION          ((1UL << 24) | (1UL << 16) | (0UL << 8))
+
+static uint32_t s_image[IMG_WORDS];
+
+static void put_word(uint32_t offset, uint32_t value)
+{
+    memcpy((uint8_t *)s_image + offset, &value, sizeof(value));
+}
+
+static void put_pool(uint32_t index, uint32_t flags, uint32_t foff, uint32_t dst, uint32_t size)
+{
+    const uint32_t desc = IMG_DATA_DATA + IMG_POOLS + index * 20U;
+    put_word(desc, TAG_FLASH(IMG_C_NAME));
+    put_word(desc + 4U, flags);
+    put_word(desc + 8U, foff);
+    put_word(desc + 12U, dst);
+    put_word(desc + 16U, size);
+}
+
+static void build_image(void)
+{
+    memset(s_image, 0, sizeof(s_image));
+    put_word(0, MODEL_IMAGE_MAGIC);
+    put_word(4, IMG_FLAGS);
+    put_word(8, TAG_RAM(0));
+    put_word(12, TAG_RAM(IMG_DATA_END));
+    put_word(16, TAG_FLASH(IMG_DATA_DATA));
+    put_word(20, TAG_RAM(IMG_GOT_END));
+    put_word(24, TAG_RAM(IMG_BSS_END));
+    put_word(28, TAG_RAM(IMG_DATA_END));
+    put_word(32, TAG_RAM(IMG_GOT_END));
+    put_word(36, TAG_FLASH(IMG_REL_START));
+    put_word(40, TAG_FLASH(IMG_REL_END));
+    put_word(44, TAG_RAM(IMG_POOLS));
+    put_word(48, TAG_FLASH(IMG_PARAMS));
+    put_word(92, TAG_RAM(IMG_CTX));
+    memcpy((uint8_t *)s_image + IMG_C_NAME, "face_detection", 15);
+
+    const uint32_t ctx = IMG_DATA_DATA + IMG_CTX;
+    put_word(ctx + 5U * 4U, TAG_FLASH(IMG_C_NAME));
+    put_word(ctx + 6U * 4U, 1234567U);
+    put_word(ctx + 7U * 4U, IMG_PARAMS_SIZE);
+    put_word(ctx + 8U * 4U, IMG_EXT_RAM);
+    put_word(ctx + 10U * 4U, RT_VERSION | 3U);
+
+    /* Weights, hyperRAM activations, then an activation pool at a fixed address */
+    put_pool(0, (1UL << 24) | (1UL << 16) | (1UL << 8) | 0U, 0, 0, IMG_PARAMS_SIZE);
+    put_pool(1, (1UL << 24) | (2UL << 16) | (3UL << 8) | 1U, 0, 0, IMG_EXT_RAM);
+    put_pool(2, (3UL << 24) | (2UL << 16) | (3UL << 8) | 2U, 0, 0x34200000UL, 448U * 1024U);
+}
+
+static model_image_limits_t firmware_limits(void)
+{
+    const model_image_limits_t limits = {
+        .slot_size = sizeof(s_image),
+        .exec_ram_size = 64U * 1024U,
+        .ext_ram_size = 8U * 1024U * 1024U,
+        .cpuid = MODEL_IMAGE_CPUID_CORTEX_M55,
+        .extra = MODEL_IMAGE_EXTRA_ASYNC,
+        .rt_version = RT_VERSION,
+    };
+    return limits;
+}
+
+static int parse_and_check(const model_image_limits_t *limits)
+{
+    model_image_info_t info;
+    int ret = model_image_parse((const uint8_t *)s_image, sizeof(s_image), &info);
+    return (ret == MODEL_IMAGE_OK) ? model_image_check(&info, limits) : ret;
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_parse_reads_header_and_pools(void)
+{
+    model_image_info_t info;
+    build_image();
+
+    TEST_ASSERT_EQ(model_image_parse((const uint8_t *)s_image, sizeof(s_image), &info), MODEL_IMAGE_OK);
+    TEST_ASSERT(strcmp(info.c_name, "face_detection") == 0);
+    TEST_ASSERT_EQ(info.flags, IMG_FLAGS);
+    TEST_ASSERT_EQ(info.code_size, IMG_DATA_DATA);
+    TEST_ASSERT_EQ(info.exec_ram_xip, IMG_BSS_END);
+    TEST_ASSERT_EQ(info.exec_ram_copy, IMG_BSS_END + IMG_DATA_DATA);
+    TEST_ASSERT_EQ(info.params_offset, IMG_PARAMS);
+    TEST_ASSERT_EQ(info.params_size, IMG_PARAMS_SIZE);
+    TEST_ASSERT_EQ(info.image_size, IMG_PARAMS + IMG_PARAMS_SIZE);
+    TEST_ASSERT_EQ(info.acts_size, 1234567U);
+    TEST_ASSERT_EQ(info.ext_ram_size, IMG_EXT_RAM);
+    TEST_ASSERT_EQ(info.pool_count, 3U);
+    TEST_ASSERT_EQ(info.pools[2].dst, 0x34200000UL);
+
+    const model_image_limits_t limits = firmware_limits();
+    TEST_ASSERT_EQ(model_image_check(&info, &limits), MODEL_IMAGE_OK);
+}
+
+static void test_rejects_malformed_images(void)
+{
+    model_image_info_t info;
+
+    build_image();
+    put_word(0, 0x464C457FUL);
+    TEST_ASSERT_EQ(model_image_parse((const uint8_t *)s_image, sizeof(s_image), &info), MODEL_IMAGE_ERR_MAGIC);
+
+    build_image();
+    TEST_ASSERT_EQ(model_image_parse((const uint8_t *)s_image, 64, &info), MODEL_IMAGE_ERR_LAYOUT);
+    TEST_ASSERT_EQ(model_image_parse((const uint8_t *)s_image, IMG_REL_END - 4U, &info), MODEL_IMAGE_ERR_LAYOUT);
+    /* Weights past the end of the slot */
+    TEST_ASSERT_EQ(model_image_parse((const uint8_t *)s_image, IMG_PARAMS + 8U, &info), MODEL_IMAGE_ERR_LAYOUT);
+    TEST_ASSERT_EQ(model_image_parse((const uint8_t *)s_image + 2, 1024, &info), MODEL_IMAGE_ERR_ARG);
+
+    /* Runtime context in bss, which is not stored in the image */
+    put_word(92, TAG_RAM(IMG_GOT_END - 16U));
+    TEST_ASSERT_EQ(model_image_parse((const uint8_t *)s_image, sizeof(s_image), &info), MODEL_IMAGE_ERR_LAYOUT);
+
+    build_image();
+    put_word(IMG_DATA_DATA + IMG_CTX + 5U * 4U, TAG_FLASH(sizeof(s_image)));
+    TEST_ASSERT_EQ(model_image_parse((const uint8_t *)s_image, sizeof(s_image), &info), MODEL_IMAGE_ERR_LAYOUT);
+}
+
+static void test_rejects_other_targets(void)
+{
+    model_image_limits_t limits = firmware_limits();
+
+    build_image();
+    put_word(4, (IMG_FLAGS & ~0xFFFUL) | 0xD21U);
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_TARGET);
+
+    build_image();
+    put_word(4, IMG_FLAGS & ~(3UL << 13));
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_TARGET);
+
+    build_image();
+    limits.extra = MODEL_IMAGE_EXTRA_ASYNC | MODEL_IMAGE_EXTRA_DBG_INFO;
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_TARGET);
+
+    limits = firmware_limits();
+    put_word(4, (IMG_FLAGS & ~(0xFUL << 28)) | (7UL << 28));
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_VERSION);
+
+    build_image();
+    limits.rt_version = (1UL << 24) | (2UL << 16);
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_VERSION);
+}
+
+static void test_rejects_images_larger_than_budgets(void)
+{
+    model_image_limits_t limits = firmware_limits();
+    build_image();
+
+    limits.exec_ram_size = IMG_BSS_END - 8U;
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_MEMORY);
+
+    limits = firmware_limits();
+    limits.slot_size = IMG_PARAMS + IMG_PARAMS_SIZE - 4U;
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_MEMORY);
+
+    limits = firmware_limits();
+    limits.ext_ram_size = IMG_EXT_RAM / 2U;
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_MEMORY);
+
+    /* Weights pool larger than the weights */
+    limits = firmware_limits();
+    put_pool(0, (1UL << 24) | (1UL << 16) | (1UL << 8) | 0U, 64U, 0, IMG_PARAMS_SIZE);
+    TEST_ASSERT_EQ(parse_and_check(&limits), MODEL_IMAGE_ERR_LAYOUT);
+}
+
+static void test_select_variant_rebinds_network(void)
+{
+    app_config_t config;
+    face_recognition_nn_t recognition;
+    static uint8_t face[FACE_RECOGNITION_WIDTH * FACE_RECOGNITION_HEIGHT * NN_BPP];
+    uint32_t count = 0;
+
+    memset(&config, 0, sizeof(config));
+    memset(&recognition, 0, sizeof(recognition));
+    TEST_ASSERT(nn_model_get_slots(&count) != NULL);
+    TEST_ASSERT_EQ(count, 4U);
+
+    TEST_ASSERT_EQ(nn_face_recognition_init(&recognition, &config, NULL), 0);
+    TEST_ASSERT(strcmp(nn_model_get_variant(NN_MODEL_RECOGNITION), NN_RECOGNITION_MODEL_VARIANT) == 0);
+    const uint32_t generation = recognition.model_generation;
+
+    TEST_ASSERT_EQ(nn_model_select(NN_MODEL_RECOGNITION, "mobilefacenet-huge"), -2);
+    TEST_ASSERT_EQ(nn_model_select(NN_MODEL_RECOGNITION, "centerface-128"), -2);
+    TEST_ASSERT_EQ(nn_model_select(NN_MODEL_ROLE_COUNT, "mobilefacenet-fast"), -2);
+
+    TEST_ASSERT_EQ(nn_face_recognition_process(&recognition, face, FACE_RECOGNITION_WIDTH,
+                                               FACE_RECOGNITION_HEIGHT, &config), 0);
+    TEST_ASSERT_EQ(nn_activation_get_owner(), NN_ACTIVATION_OWNER_RECOGNITION);
+
+    /* Installing another variant invalidates the tensors in the shared pools */
+    TEST_ASSERT_EQ(nn_model_select(NN_MODEL_RECOGNITION, "mobilefacenet-accurate"), 0);
+    TEST_ASSERT(strcmp(nn_model_get_variant(NN_MODEL_RECOGNITION), "mobilefacenet-accurate") == 0);
+    TEST_ASSERT_EQ(nn_activation_get_owner(), NN_ACTIVATION_OWNER_NONE);
+
+    TEST_ASSERT_EQ(nn_face_recognition_process(&recognition, face, FACE_RECOGNITION_WIDTH,
+                                               FACE_RECOGNITION_HEIGHT, &config), 0);
+    TEST_ASSERT(recognition.model_generation != generation);
+    TEST_ASSERT(recognition.embedding_valid);
+}
+
+int main(void)
+{
+    printf("test_model_image\n");
+    RUN_TEST(test_parse_reads_header_and_pools);
+    RUN_TEST(test_rejects_malformed_images);
+    RUN_TEST(test_rejects_other_targets);
+    RUN_TEST(test_rejects_images_larger_than_budgets);
+    RUN_TEST(test_select_variant_rebinds_network);
+    TEST_EXIT();
+}
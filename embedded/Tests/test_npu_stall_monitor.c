@@ -0,0 +1,143 @@
+/**
+ ******************************************************************************
+ * @file    test_npu_stall_monitor.c
+ * @author  PeleAB
+ * @brief   Host tests for the NPU stream engine stall telemetry
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "npu_stall_monitor.h"
+#include "test_common.h"
+#include <string.h>
+
+/* Pool base addresses from the generated c_info.json */
+#define ADDR_NPURAM5        0x342F0000U
+#define ADDR_CPURAM2        0x34100000U
+#define ADDR_HYPERRAM       0x90000000U
+#define ADDR_OCTOFLASH      0x71000000U
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void test_address_classification(void)
+{
+    TEST_ASSERT_EQ(npu_stall_pool_from_address(ADDR_NPURAM5), NPU_POOL_NPURAM);
+    TEST_ASSERT_EQ(npu_stall_pool_from_address(0x343BFFFFU), NPU_POOL_NPURAM);
+    TEST_ASSERT_EQ(npu_stall_pool_from_address(0x343C0000U), NPU_POOL_OTHER);
+    TEST_ASSERT_EQ(npu_stall_pool_from_address(ADDR_CPURAM2), NPU_POOL_CPURAM);
+    /* Non-secure alias of AXISRAM4 */
+    TEST_ASSERT_EQ(npu_stall_pool_from_address(0x24270000U), NPU_POOL_NPURAM);
+    TEST_ASSERT_EQ(npu_stall_pool_from_address(ADDR_HYPERRAM + 0x188000U), NPU_POOL_HYPERRAM);
+    TEST_ASSERT_EQ(npu_stall_pool_from_address(ADDR_OCTOFLASH), NPU_POOL_OCTOFLASH);
+    TEST_ASSERT_EQ(npu_stall_pool_from_address(0x08000000U), NPU_POOL_OTHER);
+    TEST_ASSERT(strcmp(npu_stall_pool_name(NPU_POOL_HYPERRAM), "hyperRAM") == 0);
+}
+
+static void test_samples_attributed_to_pools_and_blocks(void)
+{
+    /* Weights from flash feed a conv whose output to hyperRAM is backed up */
+    const npu_stall_engine_t stalled[] = {
+        { ADDR_OCTOFLASH, false, false },
+        { ADDR_NPURAM5, false, true },
+        { ADDR_HYPERRAM, true, true },
+    };
+    const npu_stall_engine_t flowing[] = {
+        { ADDR_OCTOFLASH, false, false },
+        { ADDR_HYPERRAM, true, false },
+    };
+
+    npu_stall_monitor_reset();
+    npu_stall_monitor_record(EPOCH_PROFILER_NET_RECOGNITION, 4, stalled, 3);
+    npu_stall_monitor_record(EPOCH_PROFILER_NET_RECOGNITION, 4, flowing, 2);
+    npu_stall_monitor_record(EPOCH_PROFILER_NET_RECOGNITION, 5, NULL, 0);
+
+    const npu_stall_network_t *report = npu_stall_monitor_get(EPOCH_PROFILER_NET_RECOGNITION);
+    TEST_ASSERT_EQ(report->samples, 3U);
+    TEST_ASSERT_EQ(report->pools[NPU_POOL_OCTOFLASH].read_running, 2U);
+    TEST_ASSERT_EQ(report->pools[NPU_POOL_OCTOFLASH].read_stalled, 0U);
+    TEST_ASSERT_EQ(report->pools[NPU_POOL_NPURAM].read_stalled, 1U);
+    TEST_ASSERT_EQ(report->pools[NPU_POOL_HYPERRAM].write_running, 2U);
+    TEST_ASSERT_EQ(report->pools[NPU_POOL_HYPERRAM].write_stalled, 1U);
+
+    TEST_ASSERT_EQ(report->blocks[4].samples, 2);
+    TEST_ASSERT_EQ(report->blocks[4].read_stalled, 1);
+    TEST_ASSERT_EQ(report->blocks[4].write_stalled, 1);
+    TEST_ASSERT_EQ(report->blocks[4].pools, (1U << NPU_POOL_OCTOFLASH) | (1U << NPU_POOL_NPURAM) |
+                                            (1U << NPU_POOL_HYPERRAM));
+    /* A block with no running engine still counts as sampled */
+    TEST_ASSERT_EQ(report->blocks[5].samples, 1);
+    TEST_ASSERT_EQ(report->blocks[5].pools, 0);
+
+    TEST_ASSERT_EQ(npu_stall_monitor_get(EPOCH_PROFILER_NET_DETECTION)->samples, 0U);
+}
+
+static void test_serialize_follows_epoch_profile(void)
+{
+    const npu_stall_engine_t engine = { ADDR_HYPERRAM, true, true };
+    uint8_t buffer[NPU_STALL_WIRE_HEADER_SIZE + NPU_POOL_COUNT * NPU_STALL_WIRE_POOL_SIZE +
+                   2 * NPU_STALL_WIRE_BLOCK_SIZE];
+
+    /* Two profiled blocks; the sample lands in the second */
+    epoch_profiler_reset();
+    npu_stall_monitor_reset();
+    epoch_profiler_begin_inference(EPOCH_PROFILER_NET_DETECTION);
+    epoch_profiler_begin_block(EPOCH_PROFILER_NET_DETECTION, 1, 1, 0);
+    epoch_profiler_end_block(EPOCH_PROFILER_NET_DETECTION);
+    epoch_profiler_begin_block(EPOCH_PROFILER_NET_DETECTION, 2, 9, 0);
+
+    epoch_profiler_net_t net;
+    uint16_t block;
+    TEST_ASSERT(epoch_profiler_get_running(&net, &block));
+    TEST_ASSERT_EQ(net, EPOCH_PROFILER_NET_DETECTION);
+    TEST_ASSERT_EQ(block, 1);
+    npu_stall_monitor_record(net, block, &engine, 1);
+
+    epoch_profiler_end_block(EPOCH_PROFILER_NET_DETECTION);
+    epoch_profiler_end_inference(EPOCH_PROFILER_NET_DETECTION);
+    TEST_ASSERT(!epoch_profiler_get_running(&net, &block));
+
+    TEST_ASSERT_EQ(npu_stall_monitor_serialize(EPOCH_PROFILER_NET_DETECTION, buffer, sizeof(buffer) - 1), 0U);
+    TEST_ASSERT_EQ(npu_stall_monitor_serialize(EPOCH_PROFILER_NET_DETECTION, buffer, sizeof(buffer)),
+                   (uint32_t)sizeof(buffer));
+    TEST_ASSERT_EQ(buffer[0], NPU_STALL_WIRE_VERSION);
+    TEST_ASSERT_EQ(buffer[2], NPU_POOL_COUNT);
+    TEST_ASSERT_EQ(get_u32(buffer + 4), 1U);
+    TEST_ASSERT_EQ(get_u16(buffer + 8), 2);
+
+    const uint8_t *pool = buffer + NPU_STALL_WIRE_HEADER_SIZE + NPU_POOL_HYPERRAM * NPU_STALL_WIRE_POOL_SIZE;
+    TEST_ASSERT_EQ(pool[0], NPU_POOL_HYPERRAM);
+    TEST_ASSERT_EQ(get_u32(pool + 9), 1U);
+    TEST_ASSERT_EQ(get_u32(pool + 13), 1U);
+
+    const uint8_t *blocks = buffer + NPU_STALL_WIRE_HEADER_SIZE + NPU_POOL_COUNT * NPU_STALL_WIRE_POOL_SIZE;
+    TEST_ASSERT_EQ(get_u16(blocks), 0);
+    TEST_ASSERT_EQ(get_u16(blocks + NPU_STALL_WIRE_BLOCK_SIZE), 1);
+    TEST_ASSERT_EQ(get_u16(blocks + NPU_STALL_WIRE_BLOCK_SIZE + 4), 1);
+    TEST_ASSERT_EQ(blocks[NPU_STALL_WIRE_BLOCK_SIZE + 6], 1U << NPU_POOL_HYPERRAM);
+}
+
+int main(void)
+{
+    printf("test_npu_stall_monitor\n");
+    RUN_TEST(test_address_classification);
+    RUN_TEST(test_samples_attributed_to_pools_and_blocks);
+    RUN_TEST(test_serialize_follows_epoch_profile);
+    TEST_EXIT();
+}
@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @file    test_perf_monitor.c
+ * @author  PeleAB
+ * @brief   Host tests for the cycle-accurate timing probes
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "perf_monitor.h"
+#include "app_frame_processing.h"
+#include "test_common.h"
+#include <string.h>
+#include <time.h>
+
+static uint8_t nn_rgb[NN_WIDTH * NN_HEIGHT * NN_BPP];
+static uint8_t fr_rgb[FACE_RECOGNITION_WIDTH * FACE_RECOGNITION_HEIGHT * NN_BPP];
+static frame_processing_context_t ctx;
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void test_summary_min_avg_p99(void)
+{
+    perf_summary_t summary;
+    const uint32_t us = perf_monitor_cycles_per_us();
+
+    perf_monitor_init();
+    TEST_ASSERT_EQ(perf_monitor_get_summary(PERF_PROBE_FACE, &summary), 0);
+    TEST_ASSERT_EQ(summary.count, 0U);
+
+    /* 1..100 us: nearest-rank p99 is the 99th value */
+    for (uint32_t i = 1; i <= 100; i++) {
+        perf_monitor_record(PERF_PROBE_FACE, i * us);
+    }
+    perf_monitor_get_summary(PERF_PROBE_FACE, &summary);
+    TEST_ASSERT_EQ(summary.count, 100U);
+    TEST_ASSERT_EQ(summary.min_us, 1U);
+    TEST_ASSERT_EQ(summary.max_us, 100U);
+    TEST_ASSERT_EQ(summary.avg_us, 50U);
+    TEST_ASSERT_EQ(summary.p99_us, 99U);
+    TEST_ASSERT_EQ(perf_monitor_get_summary(PERF_PROBE_COUNT, &summary), -1);
+}
+
+static void test_ring_keeps_recent_samples(void)
+{
+    perf_summary_t summary;
+    const uint32_t us = perf_monitor_cycles_per_us();
+
+    perf_monitor_reset();
+    perf_monitor_record(PERF_PROBE_FRAME, 5000 * us);
+    for (uint32_t i = 0; i < PERF_MONITOR_RING_SIZE; i++) {
+        perf_monitor_record(PERF_PROBE_FRAME, 10 * us);
+    }
+    perf_monitor_get_summary(PERF_PROBE_FRAME, &summary);
+
+    /* The outlier left the ring but still counts for max */
+    TEST_ASSERT_EQ(summary.count, PERF_MONITOR_RING_SIZE + 1U);
+    TEST_ASSERT_EQ(summary.p99_us, 10U);
+    TEST_ASSERT_EQ(summary.max_us, 5000U);
+    TEST_ASSERT_EQ(summary.min_us, 10U);
+}
+
+static void test_begin_end_measures_wall_time(void)
+{
+    perf_summary_t summary;
+    const struct timespec delay = { 0, 2000000 };
+
+    perf_monitor_reset();
+    perf_monitor_begin(PERF_PROBE_NN_DETECTION);
+    nanosleep(&delay, NULL);
+    perf_monitor_end(PERF_PROBE_NN_DETECTION);
+
+    perf_monitor_get_summary(PERF_PROBE_NN_DETECTION, &summary);
+    TEST_ASSERT_EQ(summary.count, 1U);
+    TEST_ASSERT(summary.min_us >= 2000U && summary.min_us < 200000U);
+}
+
+static void test_serialize_wire_format(void)
+{
+    uint8_t buffer[PERF_MONITOR_WIRE_HEADER_SIZE + PERF_PROBE_COUNT * PERF_MONITOR_WIRE_PROBE_SIZE];
+    const uint32_t us = perf_monitor_cycles_per_us();
+
+    perf_monitor_reset();
+    perf_monitor_record(PERF_PROBE_STAGE_DETECTION, 300 * us);
+    perf_monitor_record(PERF_PROBE_FACE, 40 * us);
+
+    uint32_t size = perf_monitor_serialize(buffer, sizeof(buffer), 0x12345678);
+    TEST_ASSERT_EQ(size, PERF_MONITOR_WIRE_HEADER_SIZE + 2U * PERF_MONITOR_WIRE_PROBE_SIZE);
+    TEST_ASSERT_EQ(buffer[0], PERF_MONITOR_WIRE_VERSION);
+    TEST_ASSERT_EQ(buffer[1], 2);
+    TEST_ASSERT_EQ(get_u32(buffer + 2), 0x12345678U);
+
+    const uint8_t *p = buffer + PERF_MONITOR_WIRE_HEADER_SIZE;
+    TEST_ASSERT_EQ(p[0], PERF_PROBE_STAGE_DETECTION);
+    TEST_ASSERT_EQ(get_u32(p + 1), 1U);
+    TEST_ASSERT_EQ(get_u32(p + 9), 300U);
+    p += PERF_MONITOR_WIRE_PROBE_SIZE;
+    TEST_ASSERT_EQ(p[0], PERF_PROBE_FACE);
+    TEST_ASSERT_EQ(get_u32(p + 17), 40U);
+
+    TEST_ASSERT_EQ(perf_monitor_serialize(buffer, PERF_MONITOR_WIRE_HEADER_SIZE + 1, 0), 0U);
+}
+
+static void test_pipeline_records_stage_probes(void)
+{
+    perf_summary_t summary;
+
+    perf_monitor_reset();
+    memset(nn_rgb, 0x40, sizeof(nn_rgb));
+    TEST_ASSERT_EQ(frame_processing_init(&ctx, NULL), 0);
+    TEST_ASSERT_EQ(frame_processing_attach_buffers(&ctx, nn_rgb, fr_rgb), 0);
+    TEST_ASSERT_EQ(frame_processing_process_frame(&ctx, nn_rgb, NN_WIDTH, NN_HEIGHT, NULL), 0);
+
+    perf_monitor_get_summary(PERF_PROBE_FRAME, &summary);
+    TEST_ASSERT_EQ(summary.count, 1U);
+    for (int p = PERF_PROBE_STAGE_CAPTURE; p <= PERF_PROBE_STAGE_OUTPUT; p++) {
+        perf_monitor_get_summary((perf_probe_t)p, &summary);
+        TEST_ASSERT_EQ(summary.count, 1U);
+    }
+    perf_monitor_get_summary(PERF_PROBE_NN_DETECTION, &summary);
+    TEST_ASSERT_EQ(summary.count, 1U);
+    frame_processing_cleanup(&ctx);
+}
+
+int main(void)
+{
+    printf("test_perf_monitor\n");
+    RUN_TEST(test_summary_min_avg_p99);
+    RUN_TEST(test_ring_keeps_recent_samples);
+    RUN_TEST(test_begin_end_measures_wall_time);
+    RUN_TEST(test_serialize_wire_format);
+    RUN_TEST(test_pipeline_records_stage_probes);
+    TEST_EXIT();
+}
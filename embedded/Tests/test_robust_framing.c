@@ -0,0 +1,493 @@
+/**
+ ******************************************************************************
+ * @file    test_robust_framing.c
+ * @author  PeleAB
+ * @brief   Host tests for the v1/v2 PC stream framing
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "robust_framing.h"
+#include "test_common.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_SIZE      (160U * 1024U)
+#define RESERVE_SIZE    (16U * 1024U)
+#define WIRE_SIZE       (4U * 1024U * 1024U)
+
+#define FRAME_WIDTH     800U
+#define FRAME_HEIGHT    480U
+#define FRAME_HEADER    12U     /* robust_frame_data_t */
+#define FRAME_SIZE      (FRAME_HEADER + FRAME_WIDTH * FRAME_HEIGHT * 2U)
+
+#define MSG_FRAME_DATA  0x01
+#define MSG_HEARTBEAT   0x05
+
+/* ========================================================================= */
+/* SIMULATED UART                                                            */
+/* ========================================================================= */
+
+/* Transfers complete as soon as they start: the wire holds every byte sent */
+static uart_tx_queue_t queue;
+static uint8_t arena[ARENA_SIZE] __attribute__ ((aligned (4)));
+static uint8_t wire[WIRE_SIZE];
+static uint32_t wire_size;
+static const uint8_t *in_flight;
+static uint32_t in_flight_size;
+
+static int sim_start(void *ctx, const uint8_t *data, uint32_t size)
+{
+    (void)ctx;
+    in_flight = data;
+    in_flight_size = size;
+    return 0;
+}
+
+static void sim_poll(void *ctx)
+{
+    (void)ctx;
+    if (in_flight != NULL) {
+        TEST_ASSERT(wire_size + in_flight_size <= WIRE_SIZE);
+        if (wire_size + in_flight_size <= WIRE_SIZE) {
+            memcpy(&wire[wire_size], in_flight, in_flight_size);
+            wire_size += in_flight_size;
+        }
+        in_flight = NULL;
+        uart_tx_queue_on_complete(&queue);
+    }
+}
+
+static void drain(void)
+{
+    while (in_flight != NULL) {
+        sim_poll(NULL);
+    }
+}
+
+static void reset(void)
+{
+    const uart_tx_port_t port = { sim_start, sim_poll, NULL };
+
+    wire_size = 0;
+    in_flight = NULL;
+    TEST_ASSERT_EQ(uart_tx_queue_init(&queue, &port, arena, ARENA_SIZE, RESERVE_SIZE, 100000), 0);
+}
+
+/* ========================================================================= */
+/* REFERENCE DECODER                                                         */
+/* ========================================================================= */
+
+typedef struct {
+    uint8_t version;
+    uint8_t type;
+    uint16_t sequence_id;
+    uint32_t size;
+    uint32_t chunks;
+    uint8_t *payload;
+} decoded_t;
+
+static uint32_t get_u16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return get_u16(p) | (get_u16(p + 2) << 16);
+}
+
+static uint8_t xor_of(const uint8_t *p, uint32_t size)
+{
+    uint8_t x = 0;
+    while (size-- > 0) {
+        x ^= *p++;
+    }
+    return x;
+}
+
+/* Decode the message at *pos; every header and CRC must check out */
+static bool decode(uint32_t *pos, decoded_t *msg, uint8_t *payload, uint32_t capacity)
+{
+    const uint8_t *p = &wire[*pos];
+
+    memset(msg, 0, sizeof(*msg));
+    msg->payload = payload;
+
+    if (p[0] == ROBUST_SOF_BYTE) {
+        const uint32_t size = get_u16(&p[1]);
+        if (xor_of(p, 3) != p[3] || size < ROBUST_MSG_HEADER_SIZE ||
+            size - ROBUST_MSG_HEADER_SIZE > capacity) {
+            return false;
+        }
+        const uint8_t *body = p + ROBUST_HEADER_SIZE + ROBUST_MSG_HEADER_SIZE;
+        msg->version = ROBUST_PROTOCOL_V1;
+        msg->type = p[4];
+        msg->sequence_id = (uint16_t)get_u16(&p[5]);
+        msg->size = size - ROBUST_MSG_HEADER_SIZE;
+        msg->chunks = 1;
+        if (crc32_stream_compute(body, msg->size) != get_u32(body + msg->size)) {
+            return false;
+        }
+        memcpy(payload, body, msg->size);
+        *pos += ROBUST_HEADER_SIZE + size + ROBUST_CRC_SIZE;
+        return true;
+    }
+
+    uint32_t received = 0;
+    bool last = false;
+    while (!last) {
+        p = &wire[*pos];
+        if (p[0] != ROBUST_V2_SOF_BYTE || p[1] != ROBUST_PROTOCOL_V2 ||
+            xor_of(p, ROBUST_V2_HEADER_SIZE - 1) != p[ROBUST_V2_HEADER_SIZE - 1]) {
+            return false;
+        }
+        const uint8_t flags = p[3];
+        const uint32_t chunk = get_u16(&p[6]);
+        const uint32_t total = get_u32(&p[8]);
+        const uint32_t offset = get_u32(&p[12]);
+        const uint8_t *body = p + ROBUST_V2_HEADER_SIZE;
+
+        if (msg->chunks == 0) {
+            if (!(flags & ROBUST_V2_FLAG_FIRST) || offset != 0 || total > capacity) {
+                return false;
+            }
+            msg->version = ROBUST_PROTOCOL_V2;
+            msg->type = p[2];
+            msg->sequence_id = (uint16_t)get_u16(&p[4]);
+            msg->size = total;
+        } else if ((flags & ROBUST_V2_FLAG_FIRST) || p[2] != msg->type ||
+                   get_u16(&p[4]) != msg->sequence_id || total != msg->size) {
+            return false;
+        }
+        if (offset != received || offset + chunk > total ||
+            crc32_stream_compute(body, chunk) != get_u32(body + chunk)) {
+            return false;
+        }
+        memcpy(payload + offset, body, chunk);
+        msg->chunks++;
+        received += chunk;
+        last = (flags & ROBUST_V2_FLAG_LAST) != 0;
+        if (last && offset + chunk != total) {
+            return false;
+        }
+        *pos += ROBUST_V2_HEADER_SIZE + chunk + ROBUST_CRC_SIZE;
+    }
+    return true;
+}
+
+/* ========================================================================= */
+/* MESSAGES                                                                  */
+/* ========================================================================= */
+
+static uint8_t *frame;
+static uint8_t *decoded;
+
+/* 800x480 RGB565 test card: gradients that differ on every row */
+static void fill_frame(uint32_t seed)
+{
+    memcpy(frame, "ALN", 4);
+    const uint32_t dims[2] = { FRAME_WIDTH, FRAME_HEIGHT };
+    memcpy(frame + 4, dims, sizeof(dims));
+
+    uint8_t *px = frame + FRAME_HEADER;
+    for (uint32_t y = 0; y < FRAME_HEIGHT; y++) {
+        for (uint32_t x = 0; x < FRAME_WIDTH; x++, px += 2) {
+            const uint16_t rgb = (uint16_t)((((x + seed) & 0x1F) << 11) | ((y & 0x3F) << 5) |
+                                            ((x ^ y) & 0x1F));
+            px[0] = (uint8_t)rgb;
+            px[1] = (uint8_t)(rgb >> 8);
+        }
+    }
+}
+
+/* Frame header, then one write per row as Enhanced_PC_STREAM_SendFrame() does */
+static int send_frame(uint8_t version, uint16_t sequence_id)
+{
+    robust_writer_t writer;
+    int ret = robust_writer_begin(&writer, &queue, version, MSG_FRAME_DATA, sequence_id,
+                                  FRAME_SIZE, 0, UART_TX_DROPPABLE);
+    if (ret != 0) {
+        return ret;
+    }
+    ret = robust_writer_write(&writer, frame, FRAME_HEADER);
+    for (uint32_t y = 0; y < FRAME_HEIGHT && ret == 0; y++) {
+        ret = robust_writer_write(&writer, frame + FRAME_HEADER + y * FRAME_WIDTH * 2U,
+                                  FRAME_WIDTH * 2U);
+    }
+    return (ret == 0) ? robust_writer_end(&writer) : ret;
+}
+
+static int send_bytes(uint8_t version, uint8_t type, uint16_t sequence_id,
+                      const void *data, uint32_t size)
+{
+    robust_writer_t writer;
+    int ret = robust_writer_begin(&writer, &queue, version, type, sequence_id, size, 0,
+                                  UART_TX_RELIABLE);
+    if (ret == 0) {
+        ret = robust_writer_write(&writer, data, size);
+    }
+    return (ret == 0) ? robust_writer_end(&writer) : ret;
+}
+
+/* Heartbeat announcing v2 framing, as the firmware sends it */
+static int send_heartbeat(uint16_t sequence_id)
+{
+    uint8_t heartbeat[8] = { 0x78, 0x56, 0x34, 0x12, ROBUST_PROTOCOL_V2, 0 };
+    heartbeat[6] = (uint8_t)ROBUST_V2_CHUNK_SIZE;
+    heartbeat[7] = (uint8_t)(ROBUST_V2_CHUNK_SIZE >> 8);
+    return send_bytes(ROBUST_PROTOCOL_V1, MSG_HEARTBEAT, sequence_id, heartbeat, sizeof(heartbeat));
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_v1_round_trip(void)
+{
+    uint8_t payload[300];
+    decoded_t msg;
+    uint32_t pos = 0;
+
+    reset();
+    for (uint32_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = (uint8_t)(i * 13U);
+    }
+    TEST_ASSERT_EQ(send_bytes(ROBUST_PROTOCOL_V1, 0x04, 7, payload, sizeof(payload)), 0);
+    TEST_ASSERT_EQ(send_bytes(ROBUST_PROTOCOL_V1, 0x04, 8, payload, 1), 0);
+    drain();
+
+    TEST_ASSERT(decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.version, ROBUST_PROTOCOL_V1);
+    TEST_ASSERT_EQ(msg.type, 0x04);
+    TEST_ASSERT_EQ(msg.sequence_id, 7);
+    TEST_ASSERT_EQ(msg.size, sizeof(payload));
+    TEST_ASSERT(memcmp(decoded, payload, sizeof(payload)) == 0);
+
+    TEST_ASSERT(decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.sequence_id, 8);
+    TEST_ASSERT_EQ(msg.size, 1);
+    TEST_ASSERT_EQ(pos, wire_size);
+}
+
+/* The v1 size field is 16 bits: a full resolution frame does not fit */
+static void test_v1_rejects_large_message(void)
+{
+    robust_writer_t writer;
+
+    reset();
+    TEST_ASSERT_EQ(robust_writer_begin(&writer, &queue, ROBUST_PROTOCOL_V1, MSG_FRAME_DATA, 1,
+                                       FRAME_SIZE, 0, UART_TX_DROPPABLE), -2);
+    TEST_ASSERT_EQ(robust_writer_begin(&writer, &queue, ROBUST_PROTOCOL_V1, MSG_FRAME_DATA, 1,
+                                       ROBUST_MAX_PAYLOAD_SIZE - ROBUST_MSG_HEADER_SIZE, 0,
+                                       UART_TX_DROPPABLE), 0);
+    robust_writer_abort(&writer);
+    TEST_ASSERT(uart_tx_queue_idle(&queue));
+}
+
+static void test_v2_frame_round_trip(void)
+{
+    decoded_t msg;
+    uint32_t pos = 0;
+
+    reset();
+    fill_frame(3);
+    TEST_ASSERT_EQ(send_frame(ROBUST_PROTOCOL_V2, 42), 0);
+    drain();
+
+    TEST_ASSERT(decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.version, ROBUST_PROTOCOL_V2);
+    TEST_ASSERT_EQ(msg.type, MSG_FRAME_DATA);
+    TEST_ASSERT_EQ(msg.sequence_id, 42);
+    TEST_ASSERT_EQ(msg.size, FRAME_SIZE);
+    TEST_ASSERT_EQ(msg.chunks, (FRAME_SIZE + ROBUST_V2_CHUNK_SIZE - 1) / ROBUST_V2_CHUNK_SIZE);
+    TEST_ASSERT(memcmp(decoded, frame, FRAME_SIZE) == 0);
+    TEST_ASSERT_EQ(pos, wire_size);
+}
+
+/* Only the first chunk is droppable: a frame never goes out half sent */
+static void test_v2_frame_dropped_when_busy(void)
+{
+    decoded_t msg;
+    uint32_t pos = 0;
+
+    reset();
+    fill_frame(1);
+    TEST_ASSERT_EQ(send_frame(ROBUST_PROTOCOL_V2, 1), 0);
+    TEST_ASSERT_EQ(send_frame(ROBUST_PROTOCOL_V2, 2), -1);
+    drain();
+
+    TEST_ASSERT(decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.sequence_id, 1);
+    TEST_ASSERT_EQ(pos, wire_size);
+}
+
+static void test_v2_chunk_flags(void)
+{
+    uint8_t payload[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    robust_writer_t writer;
+
+    /* One chunk: first and last */
+    reset();
+    TEST_ASSERT_EQ(send_bytes(ROBUST_PROTOCOL_V2, 0x02, 1, payload, sizeof(payload)), 0);
+    drain();
+    TEST_ASSERT_EQ(wire[3], ROBUST_V2_FLAG_FIRST | ROBUST_V2_FLAG_LAST);
+    TEST_ASSERT_EQ(wire_size, ROBUST_V2_HEADER_SIZE + sizeof(payload) + ROBUST_CRC_SIZE);
+
+    /* Exact multiple of the chunk limit: no empty trailing chunk */
+    reset();
+    TEST_ASSERT_EQ(robust_writer_begin(&writer, &queue, ROBUST_PROTOCOL_V2, 0x02, 2,
+                                       sizeof(payload), 5, UART_TX_RELIABLE), 0);
+    for (uint32_t i = 0; i < sizeof(payload); i++) {
+        TEST_ASSERT_EQ(robust_writer_write(&writer, &payload[i], 1), 0);
+    }
+    TEST_ASSERT_EQ(robust_writer_end(&writer), 0);
+    drain();
+
+    const uint32_t chunk_bytes = ROBUST_V2_HEADER_SIZE + 5 + ROBUST_CRC_SIZE;
+    TEST_ASSERT_EQ(wire_size, 2 * chunk_bytes);
+    TEST_ASSERT_EQ(wire[3], ROBUST_V2_FLAG_FIRST);
+    TEST_ASSERT_EQ(wire[chunk_bytes + 3], ROBUST_V2_FLAG_LAST);
+    TEST_ASSERT_EQ(get_u32(&wire[chunk_bytes + 12]), 5);
+    TEST_ASSERT(memcmp(&wire[chunk_bytes + ROBUST_V2_HEADER_SIZE], &payload[5], 5) == 0);
+}
+
+/* A corrupted chunk is caught by its own CRC */
+static void test_v2_chunk_crc(void)
+{
+    decoded_t msg;
+    uint32_t pos = 0;
+
+    reset();
+    fill_frame(5);
+    TEST_ASSERT_EQ(send_frame(ROBUST_PROTOCOL_V2, 1), 0);
+    drain();
+
+    const uint32_t second_chunk = ROBUST_V2_HEADER_SIZE + ROBUST_V2_CHUNK_SIZE + ROBUST_CRC_SIZE;
+    wire[second_chunk + ROBUST_V2_HEADER_SIZE + 100] ^= 0x01;
+    TEST_ASSERT(!decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.chunks, 1);
+}
+
+/* Oversized writes and short messages are refused, the queue stays usable */
+static void test_writer_misuse(void)
+{
+    uint8_t payload[32] = { 0 };
+    robust_writer_t writer;
+    decoded_t msg;
+    uint32_t pos = 0;
+
+    reset();
+    TEST_ASSERT_EQ(robust_writer_begin(&writer, &queue, ROBUST_PROTOCOL_V2, 0x03, 1, 16, 0,
+                                       UART_TX_RELIABLE), 0);
+    TEST_ASSERT(robust_writer_write(&writer, payload, sizeof(payload)) < 0);
+    TEST_ASSERT(robust_writer_end(&writer) < 0);
+
+    TEST_ASSERT_EQ(robust_writer_begin(&writer, &queue, ROBUST_PROTOCOL_V1, 0x03, 2, 16, 0,
+                                       UART_TX_RELIABLE), 0);
+    TEST_ASSERT_EQ(robust_writer_write(&writer, payload, 8), 0);
+    TEST_ASSERT(robust_writer_end(&writer) < 0);
+
+    TEST_ASSERT_EQ(send_bytes(ROBUST_PROTOCOL_V2, 0x03, 3, payload, 16), 0);
+    drain();
+    TEST_ASSERT(decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.sequence_id, 3);
+    TEST_ASSERT_EQ(pos, wire_size);
+}
+
+static void test_v1_and_v2_interleave(void)
+{
+    decoded_t msg;
+    uint32_t pos = 0;
+
+    reset();
+    fill_frame(9);
+    TEST_ASSERT_EQ(send_heartbeat(1), 0);
+    TEST_ASSERT_EQ(send_frame(ROBUST_PROTOCOL_V2, 2), 0);
+    TEST_ASSERT_EQ(send_heartbeat(3), 0);
+    drain();
+
+    TEST_ASSERT(decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.version, ROBUST_PROTOCOL_V1);
+    TEST_ASSERT_EQ(decoded[4], ROBUST_PROTOCOL_V2);
+    TEST_ASSERT(decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.version, ROBUST_PROTOCOL_V2);
+    TEST_ASSERT(decode(&pos, &msg, decoded, FRAME_SIZE));
+    TEST_ASSERT_EQ(msg.sequence_id, 3);
+    TEST_ASSERT_EQ(pos, wire_size);
+}
+
+/* ========================================================================= */
+/* LOOPBACK STREAM                                                           */
+/* ========================================================================= */
+
+/*
+ * Stream read back by python_tools/test_protocol_loopback.py: a v2 heartbeat
+ * announcement, two 800x480 RGB565 frames in v2, then a 160x120 grayscale
+ * frame in v1.
+ */
+static int write_loopback(const char *path)
+{
+    reset();
+    TEST_ASSERT_EQ(send_heartbeat(1), 0);
+    for (uint32_t i = 0; i < 2; i++) {
+        /* Frames are droppable: give the link time to empty the queue */
+        drain();
+        fill_frame(i);
+        TEST_ASSERT_EQ(send_frame(ROBUST_PROTOCOL_V2, (uint16_t)(i + 1)), 0);
+    }
+
+    const uint32_t gray_size = FRAME_HEADER + 160U * 120U;
+    const uint32_t dims[2] = { 160U, 120U };
+    memcpy(frame, "JPG", 4);
+    memcpy(frame + 4, dims, sizeof(dims));
+    for (uint32_t i = FRAME_HEADER; i < gray_size; i++) {
+        frame[i] = (uint8_t)i;
+    }
+    TEST_ASSERT_EQ(send_bytes(ROBUST_PROTOCOL_V1, MSG_FRAME_DATA, 3, frame, gray_size), 0);
+    drain();
+
+    FILE *out = fopen(path, "wb");
+    if (out == NULL) {
+        perror(path);
+        return -1;
+    }
+    const size_t written = fwrite(wire, 1, wire_size, out);
+    fclose(out);
+    return (written == wire_size) ? 0 : -1;
+}
+
+int main(int argc, char **argv)
+{
+    printf("test_robust_framing\n");
+    frame = malloc(FRAME_SIZE);
+    decoded = malloc(FRAME_SIZE);
+    TEST_ASSERT(frame != NULL && decoded != NULL);
+    TEST_ASSERT_EQ(crc32_stream_init(), 0);
+
+    RUN_TEST(test_v1_round_trip);
+    RUN_TEST(test_v1_rejects_large_message);
+    RUN_TEST(test_v2_frame_round_trip);
+    RUN_TEST(test_v2_frame_dropped_when_busy);
+    RUN_TEST(test_v2_chunk_flags);
+    RUN_TEST(test_v2_chunk_crc);
+    RUN_TEST(test_writer_misuse);
+    RUN_TEST(test_v1_and_v2_interleave);
+
+    if (argc > 1) {
+        TEST_ASSERT_EQ(write_loopback(argv[1]), 0);
+    }
+
+    free(frame);
+    free(decoded);
+    TEST_EXIT();
+}
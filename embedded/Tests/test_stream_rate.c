@@ -0,0 +1,387 @@
+/**
+ ******************************************************************************
+ * @file    test_stream_rate.c
+ * @author  PeleAB
+ * @brief   Host tests and link simulation of the stream rate control
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "stream_rate.h"
+#include "test_common.h"
+#include <string.h>
+
+/* Pipeline as streamed: 800x480 RGB565 frames, 112x112 RGB888 crops */
+#define FRAME_PIXEL_BYTES   (800U * 480U * 2U)
+#define CROP_PIXEL_BYTES    (112U * 112U * 3U)
+#define EMBEDDING_BYTES     (4U + 128U * 4U)
+#define METRICS_BYTES       28U
+#define DETECTION_BYTES     (8U + 28U)
+
+/* Transmit queue of enhanced_pc_stream.h */
+#define ARENA_SIZE          (160U * 1024U)
+#define ARENA_RESERVE       (16U * 1024U)
+#define CHUNK_SIZE          (16U * 1024U)
+
+#define WARMUP_FRAMES       30U
+
+/* ========================================================================= */
+/* LINK AND PIPELINE SIMULATION                                              */
+/* ========================================================================= */
+
+/*
+ * The link drains the queue at a fixed rate. An image is refused when its
+ * first chunk does not fit the arena less the reserve, like a droppable
+ * packet; once started, the producer blocks until the rest of it fits.
+ * Reliable messages always get in.
+ */
+typedef struct {
+    uint32_t bytes_per_s;
+    uint64_t now_us;
+    uint64_t pending;
+    uint64_t sent;
+    uint64_t busy_us;                   /* Time the link had bytes to send */
+} link_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t frames_sent;
+    uint32_t scale_sum;
+    uint32_t scale_changes;
+    uint32_t crops;
+    uint32_t crops_sent;
+    uint32_t queue_drops;
+    uint64_t max_reliable_wait_us;      /* After warm-up */
+    uint32_t max_fraction;              /* Permille, after warm-up */
+    uint64_t stream_us;                 /* After warm-up */
+    uint64_t total_us;
+} sim_result_t;
+
+typedef struct {
+    uint32_t compute_us;                /* Pipeline time without streaming */
+    uint32_t frame_ratio;               /* Sent bytes per 1000 pixel bytes */
+    uint32_t crop_ratio;
+    uint32_t frame_ns_per_byte;         /* Subsample, code and copy */
+    uint32_t crop_ns_per_byte;
+    bool controlled;                    /* false: every image at STREAM_SCALE */
+} pipeline_t;
+
+static void advance(link_t *link, uint64_t us)
+{
+    const uint64_t drained = (uint64_t)link->bytes_per_s * us / 1000000U;
+    if (link->pending > 0) {
+        link->busy_us += (drained >= link->pending) ? link->pending * 1000000U / link->bytes_per_s : us;
+    }
+    link->sent += (drained < link->pending) ? drained : link->pending;
+    link->pending -= (drained < link->pending) ? drained : link->pending;
+    link->now_us += us;
+}
+
+/* Send call of an image: CPU time, then blocked until it fits the arena */
+static bool send_image(link_t *link, uint32_t size, uint32_t cpu_us, uint32_t *elapsed_us)
+{
+    const uint64_t start = link->now_us;
+    const uint32_t first = (size < CHUNK_SIZE) ? size : CHUNK_SIZE;
+    if (link->pending + first > ARENA_SIZE - ARENA_RESERVE) {
+        *elapsed_us = 0;
+        return false;
+    }
+
+    advance(link, cpu_us);
+    if (link->pending + size > ARENA_SIZE) {
+        advance(link, (link->pending + size - ARENA_SIZE) * 1000000U / link->bytes_per_s + 1U);
+    }
+    link->pending += size;
+    *elapsed_us = (uint32_t)(link->now_us - start);
+    return true;
+}
+
+/* Reliable message: returns the time it waits behind what is queued */
+static uint64_t send_reliable(link_t *link, uint32_t size)
+{
+    const uint64_t wait = link->pending * 1000000U / link->bytes_per_s;
+    link->pending += size;
+    return wait;
+}
+
+static void update(stream_rate_t *rate, const link_t *link)
+{
+    stream_rate_update(rate, (uint32_t)link->now_us, (uint32_t)link->sent, (uint32_t)link->pending);
+}
+
+static void reliable(stream_rate_t *rate, link_t *link, sim_result_t *result, uint32_t frame,
+                     uint32_t size)
+{
+    const uint64_t wait = send_reliable(link, size);
+    if (frame >= WARMUP_FRAMES && wait > result->max_reliable_wait_us) {
+        result->max_reliable_wait_us = wait;
+    }
+    stream_rate_record(rate, STREAM_RATE_RELIABLE, 0, size, 0);
+}
+
+/* One pipeline frame: a face crop half way, the frame and its results at the end */
+static void run_frame(stream_rate_t *rate, link_t *link, const pipeline_t *pipe,
+                      sim_result_t *result, uint32_t frame)
+{
+    const uint64_t frame_start = link->now_us;
+    uint64_t stream_us = 0;
+    uint32_t elapsed;
+
+    advance(link, pipe->compute_us / 2U);
+    if (frame % 2U == 0) {
+        result->crops++;
+        update(rate, link);
+        const stream_rate_decision_t crop = pipe->controlled
+            ? stream_rate_decide(rate, STREAM_RATE_CROP, (uint32_t)link->now_us, CROP_PIXEL_BYTES)
+            : (stream_rate_decision_t){ true, 1 };
+        if (crop.send) {
+            const uint32_t size = CROP_PIXEL_BYTES * pipe->crop_ratio / 1000U;
+            if (send_image(link, size, CROP_PIXEL_BYTES * pipe->crop_ns_per_byte / 1000U, &elapsed)) {
+                stream_rate_record(rate, STREAM_RATE_CROP, CROP_PIXEL_BYTES, size, elapsed);
+                result->crops_sent++;
+                stream_us += elapsed;
+            } else {
+                stream_rate_record_drop(rate, STREAM_RATE_CROP);
+                result->queue_drops++;
+            }
+        }
+        reliable(rate, link, result, frame, EMBEDDING_BYTES);
+    }
+    advance(link, pipe->compute_us - pipe->compute_us / 2U);
+
+    result->frames++;
+    update(rate, link);
+    const uint32_t previous_scale = rate->scale;
+    const stream_rate_decision_t out = pipe->controlled
+        ? stream_rate_decide(rate, STREAM_RATE_FRAME, (uint32_t)link->now_us, FRAME_PIXEL_BYTES)
+        : (stream_rate_decision_t){ true, 2 };
+    if (out.send) {
+        const uint32_t pixels = FRAME_PIXEL_BYTES / (out.scale * out.scale);
+        const uint32_t size = pixels * pipe->frame_ratio / 1000U;
+        if (send_image(link, size, pixels * pipe->frame_ns_per_byte / 1000U, &elapsed)) {
+            stream_rate_record(rate, STREAM_RATE_FRAME, pixels, size, elapsed);
+            result->frames_sent++;
+            result->scale_sum += out.scale;
+            stream_us += elapsed;
+        } else {
+            stream_rate_record_drop(rate, STREAM_RATE_FRAME);
+            result->queue_drops++;
+        }
+    }
+    if (frame >= WARMUP_FRAMES && rate->scale != previous_scale) {
+        result->scale_changes++;
+    }
+    reliable(rate, link, result, frame, METRICS_BYTES);
+    reliable(rate, link, result, frame, DETECTION_BYTES);
+
+    if (frame >= WARMUP_FRAMES) {
+        const uint64_t period = link->now_us - frame_start;
+        const uint32_t fraction = (uint32_t)(stream_us * 1000U / period);
+        result->max_fraction = (fraction > result->max_fraction) ? fraction : result->max_fraction;
+        result->stream_us += stream_us;
+        result->total_us += period;
+    }
+}
+
+/* The controller starts from the UART baud rate, as the firmware does */
+static void simulate(const pipeline_t *pipe, uint32_t bytes_per_s, uint32_t frames,
+                     sim_result_t *result)
+{
+    static stream_rate_t rate;
+    stream_rate_config_t config;
+    link_t link = { bytes_per_s, 1000U, 0, 0, 0 };
+
+    memset(result, 0, sizeof(*result));
+    stream_rate_default_config(&config);
+    config.link_bytes_per_s = bytes_per_s;
+    TEST_ASSERT_EQ(stream_rate_init(&rate, &config), 0);
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        run_frame(&rate, &link, pipe, result, frame);
+    }
+}
+
+static const pipeline_t default_pipeline = {
+    .compute_us = 40000U,
+    .frame_ratio = 300U,                /* Tile delta of a mostly static scene */
+    .crop_ratio = 550U,                 /* Frame codec of a face crop */
+    .frame_ns_per_byte = 4U,
+    .crop_ns_per_byte = 15U,
+    .controlled = true,
+};
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_reliable_always_sent(void)
+{
+    stream_rate_t rate;
+    TEST_ASSERT_EQ(stream_rate_init(&rate, NULL), 0);
+
+    /* A queue far beyond a period of link time: images wait, results do not */
+    stream_rate_update(&rate, 0, 0, 4U * 1024U * 1024U);
+    TEST_ASSERT(!stream_rate_decide(&rate, STREAM_RATE_FRAME, 1000, FRAME_PIXEL_BYTES).send);
+    TEST_ASSERT(!stream_rate_decide(&rate, STREAM_RATE_CROP, 2000, CROP_PIXEL_BYTES).send);
+    TEST_ASSERT(stream_rate_decide(&rate, STREAM_RATE_RELIABLE, 3000, 100000).send);
+    TEST_ASSERT_EQ(rate.classes[STREAM_RATE_FRAME].skipped, 1);
+    TEST_ASSERT_EQ(rate.classes[STREAM_RATE_CROP].skipped, 1);
+}
+
+static void test_idle_link_sends_finest_scale(void)
+{
+    stream_rate_t rate;
+    TEST_ASSERT_EQ(stream_rate_init(&rate, NULL), 0);
+    stream_rate_update(&rate, 0, 0, 0);
+
+    /* Two 33 ms periods of 7.3 Mbaud carry 49152 bytes: scale 4 uncoded */
+    stream_rate_decision_t decision = stream_rate_decide(&rate, STREAM_RATE_FRAME, 0, FRAME_PIXEL_BYTES);
+    TEST_ASSERT(decision.send && decision.scale == 4);
+
+    /* Coded frames a tenth of their pixels: refined one step per REFINE_FRAMES */
+    stream_rate_record(&rate, STREAM_RATE_FRAME, FRAME_PIXEL_BYTES / 16U, FRAME_PIXEL_BYTES / 160U, 100);
+    uint32_t frames = 0;
+    do {
+        frames++;
+        stream_rate_update(&rate, frames * 40000U, frames * 10000U, 0);
+        decision = stream_rate_decide(&rate, STREAM_RATE_FRAME, frames * 40000U, FRAME_PIXEL_BYTES);
+        TEST_ASSERT(decision.send);
+    } while (decision.scale > 2 && frames < 100);
+    TEST_ASSERT_EQ(decision.scale, 2);
+    TEST_ASSERT_EQ(frames, 2U * STREAM_RATE_REFINE_FRAMES);
+    TEST_ASSERT_EQ(stream_rate_decide(&rate, STREAM_RATE_CROP, 41000, CROP_PIXEL_BYTES).scale, 1);
+}
+
+static void test_rejects_bad_config(void)
+{
+    stream_rate_t rate;
+    stream_rate_config_t config;
+
+    TEST_ASSERT(stream_rate_init(NULL, NULL) < 0);
+    stream_rate_default_config(&config);
+    config.max_fraction = 1001;
+    TEST_ASSERT(stream_rate_init(&rate, &config) < 0);
+    stream_rate_default_config(&config);
+    config.max_scale = 1;
+    TEST_ASSERT(stream_rate_init(&rate, &config) < 0);
+    stream_rate_default_config(&config);
+    config.link_bytes_per_s = 0;
+    TEST_ASSERT(stream_rate_init(&rate, &config) < 0);
+}
+
+/* Backlogged samples track a slower link; idle ones drift back up */
+static void test_link_estimate_follows_bandwidth(void)
+{
+    stream_rate_t rate;
+    TEST_ASSERT_EQ(stream_rate_init(&rate, NULL), 0);
+
+    uint32_t sent = 0;
+    for (uint32_t t = 0; t < 50; t++) {
+        stream_rate_update(&rate, t * 10000U, sent, 50000);
+        sent += 1000;                   /* 100 KB/s */
+    }
+    TEST_ASSERT(rate.link_bytes_per_s > 95000U && rate.link_bytes_per_s < 105000U);
+
+    for (uint32_t t = 50; t < 200; t++) {
+        stream_rate_update(&rate, t * 10000U, sent, 0);
+    }
+    TEST_ASSERT(rate.link_bytes_per_s > STREAM_RATE_DEFAULT_LINK_BPS * 9U / 10U);
+}
+
+/*
+ * Every link from 115200 baud to 12 Mbaud: results never wait more than
+ * two periods, streaming stays within its share of the frame time and the
+ * queue never has to refuse an image. The uncontrolled baseline, every
+ * frame at STREAM_SCALE and every crop, is printed alongside.
+ */
+static void test_simulated_links(void)
+{
+    static const uint32_t bauds[] = { 115200U, 921600U, 2000000U, 921600U * 8U, 12000000U };
+    const uint32_t frames = 300;
+
+    for (uint32_t i = 0; i < sizeof(bauds) / sizeof(bauds[0]); i++) {
+        const uint32_t bytes_per_s = bauds[i] / 10U;
+        sim_result_t ctl, base;
+        pipeline_t baseline = default_pipeline;
+        baseline.controlled = false;
+        simulate(&default_pipeline, bytes_per_s, frames, &ctl);
+        simulate(&baseline, bytes_per_s, frames, &base);
+
+        printf("    %8u baud  frames %3u/%u scale %.1f  crops %3u/%u  result wait %5.1f ms"
+               "  stream %4.1f%% (max %4.1f%%) changes %u | baseline: result wait %6.1f ms, stream %4.1f%%\n",
+               (unsigned)bauds[i], (unsigned)ctl.frames_sent, (unsigned)ctl.frames,
+               ctl.frames_sent ? (double)ctl.scale_sum / ctl.frames_sent : 0.0,
+               (unsigned)ctl.crops_sent, (unsigned)ctl.crops, ctl.max_reliable_wait_us / 1000.0,
+               100.0 * ctl.stream_us / ctl.total_us, ctl.max_fraction / 10.0, (unsigned)ctl.scale_changes,
+               base.max_reliable_wait_us / 1000.0, 100.0 * base.stream_us / base.total_us);
+
+        const uint64_t period_us = ctl.total_us / (frames - WARMUP_FRAMES);
+        TEST_ASSERT(ctl.max_reliable_wait_us <= 2U * period_us);
+        TEST_ASSERT(ctl.stream_us * 1000U <= ctl.total_us * STREAM_RATE_DEFAULT_MAX_FRACTION);
+        TEST_ASSERT_EQ(ctl.queue_drops, 0);
+        TEST_ASSERT(ctl.scale_changes < frames / 10U);
+        if (bytes_per_s >= 921600U / 10U) {
+            TEST_ASSERT(ctl.frames_sent > 0);
+        }
+        if (bytes_per_s >= 921600U * 8U / 10U) {
+            TEST_ASSERT(ctl.crops_sent > 0);
+        }
+    }
+}
+
+/* Expensive send calls: the time share caps the images, not the link */
+static void test_time_share_caps_streaming(void)
+{
+    pipeline_t slow = default_pipeline;
+    slow.frame_ns_per_byte = 200U;
+    slow.crop_ns_per_byte = 400U;
+    sim_result_t result;
+
+    simulate(&slow, 12000000U / 10U, 300, &result);
+    TEST_ASSERT(result.frames_sent > 0);
+    TEST_ASSERT(result.stream_us * 1000U <= result.total_us * STREAM_RATE_DEFAULT_MAX_FRACTION);
+    TEST_ASSERT(result.scale_sum > result.frames_sent * 3U);
+}
+
+/* A link that slows down mid-run: waits recover within the warm-up time */
+static void test_bandwidth_drop_recovers(void)
+{
+    static stream_rate_t rate;
+    link_t link = { 921600U * 8U / 10U, 1000U, 0, 0, 0 };
+    sim_result_t result;
+
+    memset(&result, 0, sizeof(result));
+    TEST_ASSERT_EQ(stream_rate_init(&rate, NULL), 0);
+    for (uint32_t frame = 0; frame < 100; frame++) {
+        run_frame(&rate, &link, &default_pipeline, &result, frame);
+    }
+
+    link.bytes_per_s = 921600U / 10U;
+    memset(&result, 0, sizeof(result));
+    for (uint32_t frame = 0; frame < 200; frame++) {
+        run_frame(&rate, &link, &default_pipeline, &result, frame);
+    }
+    TEST_ASSERT(result.max_reliable_wait_us <= 2U * result.total_us / (200U - WARMUP_FRAMES));
+    TEST_ASSERT(rate.scale >= 6);
+}
+
+int main(void)
+{
+    printf("test_stream_rate\n");
+    RUN_TEST(test_reliable_always_sent);
+    RUN_TEST(test_idle_link_sends_finest_scale);
+    RUN_TEST(test_rejects_bad_config);
+    RUN_TEST(test_link_estimate_follows_bandwidth);
+    RUN_TEST(test_simulated_links);
+    RUN_TEST(test_time_share_caps_streaming);
+    RUN_TEST(test_bandwidth_drop_recovers);
+    TEST_EXIT();
+}
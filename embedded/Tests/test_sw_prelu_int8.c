@@ -0,0 +1,260 @@
+/**
+ ******************************************************************************
+ * @file    test_sw_prelu_int8.c
+ * @author  PeleAB
+ * @brief   Host tests and benchmark for the fused int8 PReLU SW kernel
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "ll_sw_prelu_int8.h"
+#include "perf_monitor.h"
+#include "test_common.h"
+#include <string.h>
+
+/* Shape of the recognizer's first PReLU (56x56x64) */
+#define BENCH_PIXELS        (56 * 56)
+#define BENCH_CHANNELS      64
+#define TEST_MAX_PIXELS     BENCH_PIXELS
+#define TEST_MAX_CHANNELS   LL_SW_PRELU_INT8_MAX_CHANNELS
+
+static int8_t s_input[BENCH_PIXELS * BENCH_CHANNELS];
+static int8_t s_fused[BENCH_PIXELS * BENCH_CHANNELS];
+static int8_t s_reference[BENCH_PIXELS * BENCH_CHANNELS];
+static float s_slopes[TEST_MAX_CHANNELS];
+static int32_t s_m_neg[TEST_MAX_CHANNELS];
+
+static uint32_t s_rng = 0x12345678U;
+
+static uint32_t rng_next(void)
+{
+    s_rng = s_rng * 1664525U + 1013904223U;
+    return s_rng >> 8;
+}
+
+/* Uniform in [lo, hi) */
+static float rng_float(float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(rng_next() & 0xFFFF) / 65536.0f;
+}
+
+static void fill_input(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        s_input[i] = (int8_t)(rng_next() & 0xFF);
+    }
+}
+
+/* Largest |fused - reference| over the tensor, in output LSBs */
+static int max_lsb_error(uint32_t count)
+{
+    int worst = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        int diff = (int)s_fused[i] - (int)s_reference[i];
+        diff = (diff < 0) ? -diff : diff;
+        worst = (diff > worst) ? diff : worst;
+    }
+    return worst;
+}
+
+static void test_matches_float_reference(void)
+{
+    /* Odd channel counts exercise the vector tail */
+    static const uint32_t channels[] = { 64, 65, 128, 3, 512 };
+    int worst = 0;
+
+    for (int trial = 0; trial < 40; trial++) {
+        const uint32_t c = channels[trial % (int)(sizeof(channels) / sizeof(channels[0]))];
+        const uint32_t pixels = 1 + rng_next() % 97;
+        const float in_scale = rng_float(0.005f, 0.2f);
+        const float out_scale = in_scale * rng_float(0.3f, 2.0f);
+        const int32_t in_zp = (int32_t)(rng_next() % 64) - 32;
+        const int32_t out_zp = (int32_t)(rng_next() % 64) - 32;
+
+        /* Learned slopes sit mostly in [0, 0.5]; keep some negative and > 1 ones */
+        for (uint32_t i = 0; i < c; i++) {
+            s_slopes[i] = rng_float(-0.5f, 1.5f);
+        }
+        fill_input(pixels * c);
+
+        ll_sw_prelu_int8_params params;
+        TEST_ASSERT_EQ(ll_sw_prelu_int8_prepare(&params, s_m_neg, in_scale, in_zp, s_slopes, c, out_scale,
+                                                out_zp, c), 0);
+        ll_sw_prelu_int8_run(&params, s_input, s_fused, pixels);
+        ll_sw_prelu_int8_reference(s_input, s_reference, pixels, c, in_scale, in_zp, s_slopes, c,
+                                   out_scale, out_zp);
+
+        const int err = max_lsb_error(pixels * c);
+        worst = (err > worst) ? err : worst;
+    }
+    TEST_ASSERT(worst <= 1);
+}
+
+static void test_uniform_slope_and_zero_point(void)
+{
+    const float slope = 0.25f;
+    const uint32_t c = 7;
+    ll_sw_prelu_int8_params params;
+
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.05f, -3, &slope, 1, 0.05f, 5, c), 0);
+    TEST_ASSERT_EQ(params.m_neg[c - 1], params.m_neg[0]);
+
+    /* The input zero point maps to the output zero point exactly */
+    memset(s_input, -3, c);
+    ll_sw_prelu_int8_run(&params, s_input, s_fused, 1);
+    for (uint32_t i = 0; i < c; i++) {
+        TEST_ASSERT_EQ(s_fused[i], 5);
+    }
+
+    /* Same scale: positives shift by the zp delta, negatives are scaled and saturate */
+    s_input[0] = 100;
+    s_input[1] = 127;
+    s_input[2] = -123;
+    ll_sw_prelu_int8_run(&params, s_input, s_fused, 1);
+    TEST_ASSERT_EQ(s_fused[0], 108);
+    TEST_ASSERT_EQ(s_fused[1], 127);
+    TEST_ASSERT_EQ(s_fused[2], -25);
+}
+
+/* Channel-outer input into padded rows: same values as the dense kernels */
+static void test_strided_layout_matches_dense(void)
+{
+    enum { H = 3, W = 4, C = 5, PAD = 3 };
+    static int8_t chw[C * H * W];
+    static int8_t padded[H * (W * C + PAD)];
+    const ll_sw_prelu_int8_layout layout = {
+        .batches = 1, .height = H, .width = W, .channels = C,
+        .in = { .b = C * H * W, .h = W, .w = 1, .c = H * W },
+        .out = { .b = H * (W * C + PAD), .h = W * C + PAD, .w = C, .c = 1 },
+    };
+    ll_sw_prelu_int8_params params;
+
+    for (uint32_t i = 0; i < C; i++) {
+        s_slopes[i] = rng_float(-0.5f, 1.5f);
+    }
+    fill_input(H * W * C);
+    for (uint32_t p = 0; p < H * W; p++) {
+        for (uint32_t c = 0; c < C; c++) {
+            chw[c * H * W + p] = s_input[p * C + c];
+        }
+    }
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.03f, 4, s_slopes, C, 0.05f, -7, C), 0);
+
+    ll_sw_prelu_int8_run(&params, s_input, s_fused, H * W);
+    memset(padded, 0x55, sizeof(padded));
+    ll_sw_prelu_int8_run_strided(&params, chw, padded, &layout);
+    for (uint32_t h = 0; h < H; h++) {
+        TEST_ASSERT(memcmp(&padded[h * (W * C + PAD)], &s_fused[h * W * C], W * C) == 0);
+        /* Row padding is not written */
+        TEST_ASSERT_EQ(padded[h * (W * C + PAD) + W * C], 0x55);
+    }
+
+    ll_sw_prelu_int8_reference(s_input, s_reference, H * W, C, 0.03f, 4, s_slopes, C, 0.05f, -7);
+    ll_sw_prelu_int8_reference_strided(chw, padded, &layout, 0.03f, 4, s_slopes, C, 0.05f, -7);
+    for (uint32_t h = 0; h < H; h++) {
+        TEST_ASSERT(memcmp(&padded[h * (W * C + PAD)], &s_reference[h * W * C], W * C) == 0);
+    }
+}
+
+/* PReLU_6 of the recognizer: 64 channels, slope operand 1x65x1x1 (260 bytes) */
+static void test_generated_slope_operand_layout(void)
+{
+    static float operand[BENCH_CHANNELS + 1];
+    const uint32_t c = BENCH_CHANNELS;
+    const uint32_t pixels = 50;
+    ll_sw_prelu_int8_params params;
+
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_slope_count(c + 1, c), c);
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_slope_count(c, c), c);
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_slope_count(1, c), 1U);
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_slope_count(c + 2, c), 0U);
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_slope_count(c - 1, c), 0U);
+
+    /* First slopes of PReLU_6, then random ones; the padding must not be read */
+    operand[0] = 1.5481733e-01f;
+    operand[1] = -1.4742598e-01f;
+    operand[2] = 8.5097181e-20f;
+    for (uint32_t i = 3; i < c; i++) {
+        operand[i] = rng_float(0.0f, 0.5f);
+    }
+    operand[c] = 1.0e30f;
+    memcpy(s_slopes, operand, c * sizeof(float));
+    fill_input(pixels * c);
+
+    /* The whole operand is not a valid slope count */
+    TEST_ASSERT(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.04f, -12, operand, c + 1, 0.03f, -20, c) < 0);
+
+    const uint32_t count = ll_sw_prelu_int8_slope_count(c + 1, c);
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.04f, -12, operand, count, 0.03f, -20, c), 0);
+    ll_sw_prelu_int8_run(&params, s_input, s_fused, pixels);
+    ll_sw_prelu_int8_reference(s_input, s_reference, pixels, c, 0.04f, -12, s_slopes, c, 0.03f, -20);
+    TEST_ASSERT(max_lsb_error(pixels * c) <= 1);
+
+    /* Channel 1's negative slope reaches channel 1, not channel 0 or 2 */
+    TEST_ASSERT(params.m_neg[0] > 0);
+    TEST_ASSERT(params.m_neg[1] < 0);
+    TEST_ASSERT_EQ(params.m_neg[2], 0);
+}
+
+static void test_prepare_rejects_bad_params(void)
+{
+    ll_sw_prelu_int8_params params;
+
+    TEST_ASSERT(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.0f, 0, s_slopes, 4, 0.1f, 0, 4) < 0);
+    TEST_ASSERT(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.1f, 0, s_slopes, 2, 0.1f, 0, 4) < 0);
+    TEST_ASSERT(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.1f, 0, s_slopes, 5, 0.1f, 0, 4) < 0);
+    TEST_ASSERT(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.1f, 0, s_slopes, 1, 0.1f, 0,
+                                         LL_SW_PRELU_INT8_MAX_CHANNELS + 1) < 0);
+    /* A ratio of 2^22 leaves no fractional bits */
+    TEST_ASSERT(ll_sw_prelu_int8_prepare(&params, s_m_neg, 4194304.0f, 0, s_slopes, 1, 1.0f, 0, 1) < 0);
+}
+
+static void test_benchmark_cycles_per_element(void)
+{
+    const uint32_t count = BENCH_PIXELS * BENCH_CHANNELS;
+    ll_sw_prelu_int8_params params;
+
+    for (uint32_t i = 0; i < BENCH_CHANNELS; i++) {
+        s_slopes[i] = rng_float(0.0f, 0.5f);
+    }
+    fill_input(count);
+    TEST_ASSERT_EQ(ll_sw_prelu_int8_prepare(&params, s_m_neg, 0.04f, -12, s_slopes, BENCH_CHANNELS, 0.03f,
+                                            -20, BENCH_CHANNELS), 0);
+
+    /* Warm-up pass so both timings see resident buffers */
+    ll_sw_prelu_int8_run(&params, s_input, s_fused, BENCH_PIXELS);
+    perf_monitor_init();
+    uint32_t start = perf_monitor_now();
+    ll_sw_prelu_int8_run(&params, s_input, s_fused, BENCH_PIXELS);
+    const uint32_t fused = perf_monitor_now() - start;
+
+    start = perf_monitor_now();
+    ll_sw_prelu_int8_reference(s_input, s_reference, BENCH_PIXELS, BENCH_CHANNELS, 0.04f, -12, s_slopes,
+                               BENCH_CHANNELS, 0.03f, -20);
+    const uint32_t reference = perf_monitor_now() - start;
+
+    TEST_ASSERT(max_lsb_error(count) <= 1);
+    printf("    fused %.3f, float reference %.3f ticks/element (%u elements)\n",
+           (double)fused / count, (double)reference / count, (unsigned)count);
+}
+
+int main(void)
+{
+    printf("test_sw_prelu_int8\n");
+    RUN_TEST(test_matches_float_reference);
+    RUN_TEST(test_uniform_slope_and_zero_point);
+    RUN_TEST(test_strided_layout_matches_dense);
+    RUN_TEST(test_generated_slope_operand_layout);
+    RUN_TEST(test_prepare_rejects_bad_params);
+    RUN_TEST(test_benchmark_cycles_per_element);
+    TEST_EXIT();
+}
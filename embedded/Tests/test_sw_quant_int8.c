@@ -0,0 +1,258 @@
+/**
+ ******************************************************************************
+ * @file    test_sw_quant_int8.c
+ * @author  PeleAB
+ * @brief   Host tests and benchmark for the QuantizeLinear/DequantizeLinear SW kernels
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "ll_sw_quant_int8.h"
+#include "perf_monitor.h"
+#include "test_common.h"
+#include <math.h>
+#include <string.h>
+
+/* Largest recognizer tensor converted in SW (56x56x128) */
+#define BENCH_PIXELS        (56 * 56)
+#define BENCH_CHANNELS      128
+#define BENCH_COUNT         (BENCH_PIXELS * BENCH_CHANNELS)
+#define TEST_CHANNELS       LL_SW_QUANT_INT8_MAX_CHANNELS
+
+static float s_float[BENCH_COUNT];
+static float s_float_ref[BENCH_COUNT];
+static uint8_t s_quant[BENCH_COUNT];
+static uint8_t s_quant_ref[BENCH_COUNT];
+static float s_scales[TEST_CHANNELS];
+static int8_t s_zp_s8[TEST_CHANNELS];
+static uint8_t s_zp_u8[TEST_CHANNELS];
+
+static uint32_t s_rng = 0x9E3779B9U;
+
+static uint32_t rng_next(void)
+{
+    s_rng = s_rng * 1664525U + 1013904223U;
+    return s_rng >> 8;
+}
+
+static float rng_float(float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(rng_next() & 0xFFFF) / 65536.0f;
+}
+
+static void fill_params(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        s_scales[i] = rng_float(0.002f, 0.1f);
+        s_zp_s8[i] = (int8_t)((int32_t)(rng_next() % 41) - 20);
+        s_zp_u8[i] = (uint8_t)(108 + rng_next() % 41);
+    }
+}
+
+static ll_sw_quant_int8_params make_params(uint32_t count, bool is_signed)
+{
+    const ll_sw_quant_int8_params params = {
+        .scale = s_scales,
+        .zeropoint = is_signed ? (const void *)s_zp_s8 : (const void *)s_zp_u8,
+        .count = count,
+        .is_signed = is_signed,
+    };
+    return params;
+}
+
+/* ONNX QuantizeLinear: saturate(round_half_even(x / scale) + zp) */
+static int32_t onnx_quantize(float x, float scale, int32_t zp, bool is_signed)
+{
+    const int32_t q_min = is_signed ? -128 : 0;
+    const int32_t q_max = is_signed ? 127 : 255;
+    const float q = nearbyintf(x / scale) + (float)zp;
+    return (q < (float)q_min) ? q_min : ((q > (float)q_max) ? q_max : (int32_t)q);
+}
+
+static int32_t stored(const uint8_t *buffer, uint32_t i, bool is_signed)
+{
+    return is_signed ? (int32_t)(int8_t)buffer[i] : (int32_t)buffer[i];
+}
+
+static void check_quantize(uint32_t pixels, uint32_t channels, uint32_t count, bool is_signed)
+{
+    const uint32_t n = pixels * channels;
+    const ll_sw_quant_int8_params params = make_params(count, is_signed);
+
+    fill_params(count);
+    for (uint32_t i = 0; i < n; i++) {
+        s_float[i] = rng_float(-8.0f, 8.0f);
+    }
+
+    TEST_ASSERT_EQ(ll_sw_quantize_int8(s_float, s_quant, pixels, channels, &params), 0);
+    TEST_ASSERT_EQ(ll_sw_quantize_int8_reference(s_float, s_quant_ref, pixels, channels, &params), 0);
+    TEST_ASSERT(memcmp(s_quant, s_quant_ref, n) == 0);
+
+    /* Multiplying by 1/scale may move a tie by one code */
+    int worst = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const uint32_t c = (count == 1) ? 0 : i % channels;
+        const int32_t zp = is_signed ? s_zp_s8[c] : s_zp_u8[c];
+        int diff = stored(s_quant, i, is_signed) - onnx_quantize(s_float[i], s_scales[c], zp, is_signed);
+        diff = (diff < 0) ? -diff : diff;
+        worst = (diff > worst) ? diff : worst;
+    }
+    TEST_ASSERT(worst <= 1);
+}
+
+static void check_dequantize(uint32_t pixels, uint32_t channels, uint32_t count, bool is_signed)
+{
+    const uint32_t n = pixels * channels;
+    const ll_sw_quant_int8_params params = make_params(count, is_signed);
+
+    fill_params(count);
+    for (uint32_t i = 0; i < n; i++) {
+        s_quant[i] = (uint8_t)rng_next();
+    }
+
+    TEST_ASSERT_EQ(ll_sw_dequantize_int8(s_quant, s_float, pixels, channels, &params), 0);
+    TEST_ASSERT_EQ(ll_sw_dequantize_int8_reference(s_quant, s_float_ref, pixels, channels, &params), 0);
+    TEST_ASSERT(memcmp(s_float, s_float_ref, n * sizeof(float)) == 0);
+
+    /* (q - zp) is exact in float, so each output is one correctly rounded product */
+    int mismatches = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        const uint32_t c = (count == 1) ? 0 : i % channels;
+        const int32_t zp = is_signed ? s_zp_s8[c] : s_zp_u8[c];
+        mismatches += (s_float[i] != (float)(stored(s_quant, i, is_signed) - zp) * s_scales[c]);
+    }
+    TEST_ASSERT_EQ(mismatches, 0);
+}
+
+static void test_quantize_per_tensor_matches_reference(void)
+{
+    /* Odd totals leave a scalar tail after the 8-wide loop */
+    check_quantize(97, 13, 1, true);
+    check_quantize(56 * 56, 64, 1, true);
+    check_quantize(33, 7, 1, false);
+}
+
+static void test_quantize_per_channel_matches_reference(void)
+{
+    check_quantize(29, 128, 128, true);
+    check_quantize(31, 13, 13, true);
+    check_quantize(17, 65, 65, false);
+}
+
+static void test_dequantize_matches_reference(void)
+{
+    check_dequantize(97, 13, 1, true);
+    check_dequantize(56 * 56, 64, 1, true);
+    check_dequantize(41, 128, 128, true);
+    check_dequantize(17, 65, 65, false);
+    check_dequantize(9, 3, 1, false);
+}
+
+static void test_rounds_half_to_even_and_saturates(void)
+{
+    const float scale = 1.0f;
+    const int8_t zp_s8 = 0;
+    const uint8_t zp_u8 = 128;
+    const float input[] = { 0.5f, 1.5f, 2.5f, -2.5f, 1000.0f, -1000.0f, 126.5f, -127.5f, -128.5f };
+    const int8_t expect_s8[] = { 0, 2, 2, -2, 127, -128, 126, -128, -128 };
+    const uint8_t expect_u8[] = { 128, 130, 130, 126, 255, 0, 254, 0, 0 };
+    const uint32_t n = sizeof(input) / sizeof(input[0]);
+    int8_t out_s8[sizeof(input) / sizeof(input[0])];
+    uint8_t out_u8[sizeof(input) / sizeof(input[0])];
+
+    ll_sw_quant_int8_params params = { &scale, &zp_s8, 1, true };
+    TEST_ASSERT_EQ(ll_sw_quantize_int8(input, out_s8, 1, n, &params), 0);
+    TEST_ASSERT(memcmp(out_s8, expect_s8, n) == 0);
+
+    params.zeropoint = &zp_u8;
+    params.is_signed = false;
+    TEST_ASSERT_EQ(ll_sw_quantize_int8(input, out_u8, 1, n, &params), 0);
+    TEST_ASSERT(memcmp(out_u8, expect_u8, n) == 0);
+}
+
+static void test_rejects_unsupported_params(void)
+{
+    const float zero = 0.0f;
+    const int8_t zp = 0;
+    ll_sw_quant_int8_params params = { s_scales, s_zp_s8, 4, true };
+
+    fill_params(8);
+    /* Per-axis count must match the innermost dimension */
+    TEST_ASSERT(ll_sw_quantize_int8(s_float, s_quant, 2, 8, &params) < 0);
+    TEST_ASSERT(ll_sw_dequantize_int8(s_quant, s_float, 2, 8, &params) < 0);
+    params.count = TEST_CHANNELS + 1;
+    TEST_ASSERT(ll_sw_quantize_int8(s_float, s_quant, 1, TEST_CHANNELS + 1, &params) < 0);
+
+    const ll_sw_quant_int8_params degenerate = { &zero, &zp, 1, true };
+    TEST_ASSERT(ll_sw_quantize_int8(s_float, s_quant, 1, 8, &degenerate) < 0);
+    TEST_ASSERT(ll_sw_quantize_int8(NULL, s_quant, 1, 8, &params) < 0);
+}
+
+static double elements_per_tick(uint32_t ticks)
+{
+    return (double)BENCH_COUNT / (double)(ticks ? ticks : 1);
+}
+
+static void test_benchmark_elements_per_cycle(void)
+{
+    ll_sw_quant_int8_params per_tensor = make_params(1, true);
+    ll_sw_quant_int8_params per_channel = make_params(BENCH_CHANNELS, true);
+    uint32_t t[6];
+
+    fill_params(BENCH_CHANNELS);
+    for (uint32_t i = 0; i < BENCH_COUNT; i++) {
+        s_float[i] = rng_float(-4.0f, 4.0f);
+    }
+    /* Warm-up so every buffer is resident */
+    ll_sw_quantize_int8_reference(s_float, s_quant_ref, BENCH_PIXELS, BENCH_CHANNELS, &per_tensor);
+    ll_sw_dequantize_int8_reference(s_quant_ref, s_float_ref, BENCH_PIXELS, BENCH_CHANNELS, &per_tensor);
+
+    perf_monitor_init();
+    uint32_t start = perf_monitor_now();
+    ll_sw_quantize_int8(s_float, s_quant, BENCH_PIXELS, BENCH_CHANNELS, &per_tensor);
+    t[0] = perf_monitor_now() - start;
+    start = perf_monitor_now();
+    ll_sw_quantize_int8(s_float, s_quant, BENCH_PIXELS, BENCH_CHANNELS, &per_channel);
+    t[1] = perf_monitor_now() - start;
+    start = perf_monitor_now();
+    ll_sw_quantize_int8_reference(s_float, s_quant_ref, BENCH_PIXELS, BENCH_CHANNELS, &per_channel);
+    t[2] = perf_monitor_now() - start;
+
+    start = perf_monitor_now();
+    ll_sw_dequantize_int8(s_quant, s_float, BENCH_PIXELS, BENCH_CHANNELS, &per_tensor);
+    t[3] = perf_monitor_now() - start;
+    start = perf_monitor_now();
+    ll_sw_dequantize_int8(s_quant, s_float, BENCH_PIXELS, BENCH_CHANNELS, &per_channel);
+    t[4] = perf_monitor_now() - start;
+    start = perf_monitor_now();
+    ll_sw_dequantize_int8_reference(s_quant, s_float_ref, BENCH_PIXELS, BENCH_CHANNELS, &per_channel);
+    t[5] = perf_monitor_now() - start;
+
+    TEST_ASSERT(memcmp(s_quant, s_quant_ref, BENCH_COUNT) == 0);
+    TEST_ASSERT(memcmp(s_float, s_float_ref, sizeof(s_float)) == 0);
+    printf("    quantize   tensor %.3f, channel %.3f, reference %.3f elements/tick\n",
+           elements_per_tick(t[0]), elements_per_tick(t[1]), elements_per_tick(t[2]));
+    printf("    dequantize tensor %.3f, channel %.3f, reference %.3f elements/tick\n",
+           elements_per_tick(t[3]), elements_per_tick(t[4]), elements_per_tick(t[5]));
+}
+
+int main(void)
+{
+    printf("test_sw_quant_int8\n");
+    RUN_TEST(test_quantize_per_tensor_matches_reference);
+    RUN_TEST(test_quantize_per_channel_matches_reference);
+    RUN_TEST(test_dequantize_matches_reference);
+    RUN_TEST(test_rounds_half_to_even_and_saturates);
+    RUN_TEST(test_rejects_unsupported_params);
+    RUN_TEST(test_benchmark_elements_per_cycle);
+    TEST_EXIT();
+}
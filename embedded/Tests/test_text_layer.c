@@ -0,0 +1,379 @@
+/**
+ ******************************************************************************
+ * @file    test_text_layer.c
+ * @author  PeleAB
+ * @brief   Host tests and benchmark for the overlay glyph-atlas text layer
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "text_layer.h"
+#include "perf_monitor.h"
+#include "test_common.h"
+#include <stdarg.h>
+#include <string.h>
+
+/* The font is compiled into the BSP LCD utility on target */
+#include "font20.c"
+
+#define LAYER_WIDTH     800U
+#define LAYER_HEIGHT    480U
+#define TEXT_FG         0xFFFFFFFFU
+#define TEXT_BG         0x40000000U
+
+static uint16_t layer[LAYER_HEIGHT * LAYER_WIDTH];
+static uint16_t reference[LAYER_HEIGHT * LAYER_WIDTH];
+static uint16_t atlas_storage[TEXT_LAYER_GLYPH_COUNT * 14 * 20];
+static text_atlas_t atlas;
+static text_layer_t text;
+
+static const gfx2d_surface_t layer_surface = {
+    (uint8_t *)layer, LAYER_WIDTH, LAYER_HEIGHT, LAYER_WIDTH, GFX2D_FORMAT_ARGB4444
+};
+
+/* ========================================================================= */
+/* REFERENCE RENDERER (UTIL_LCD_DisplayChar() bit for bit)                   */
+/* ========================================================================= */
+
+static uint16_t ref_argb4444(uint32_t c)
+{
+    return (uint16_t)((((c >> 28) & 0xFU) << 12) | (((c >> 20) & 0xFU) << 8) |
+                      (((c >> 12) & 0xFU) << 4) | ((c >> 4) & 0xFU));
+}
+
+static void ref_char(uint16_t *dst, uint32_t x, uint32_t y, char ch, uint32_t fg, uint32_t bg)
+{
+    const uint32_t height = Font20.Height, width = Font20.Width;
+    const uint32_t bytes = (width + 7U) / 8U;
+    const uint32_t offset = 8U * bytes - width;
+    const uint8_t *c = &Font20.table[(uint32_t)(ch - ' ') * height * bytes];
+
+    for (uint32_t i = 0; i < height; i++) {
+        const uint8_t *p = c + bytes * i;
+        const uint32_t line = (bytes == 1U) ? p[0] : (bytes == 2U) ? ((uint32_t)p[0] << 8) | p[1]
+                              : ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+        for (uint32_t j = 0; j < width; j++) {
+            const bool set = (line & (1U << (width - j + offset - 1U))) != 0;
+            dst[(y + i) * LAYER_WIDTH + x + j] = ref_argb4444(set ? fg : bg);
+        }
+    }
+}
+
+/* The path the overlay used before: vsnprintf then a pixel loop per string */
+static void ref_printf(uint16_t *dst, uint32_t x, uint32_t y, const char *fmt, ...)
+{
+    char buf[TEXT_LAYER_MAX_CHARS + 1];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    for (const char *s = buf; *s != '\0' && x + Font20.Width <= LAYER_WIDTH; s++, x += Font20.Width) {
+        ref_char(dst, x, y, *s, TEXT_FG, TEXT_BG);
+    }
+}
+
+static void reset(void)
+{
+    memset(layer, 0, sizeof(layer));
+    memset(reference, 0, sizeof(reference));
+    TEST_ASSERT_EQ(text_atlas_init(&atlas, &Font20, TEXT_FG, TEXT_BG, atlas_storage, sizeof(atlas_storage)), 0);
+    text_layer_init(&text);
+    TEST_ASSERT_EQ(text_layer_begin_frame(&text, 0, &layer_surface), 0);
+}
+
+static bool same_as_reference(void)
+{
+    return memcmp(layer, reference, sizeof(layer)) == 0;
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_atlas_matches_bsp_glyphs(void)
+{
+    char all[TEXT_LAYER_GLYPH_COUNT + 1];
+
+    reset();
+    TEST_ASSERT_EQ(text_atlas_size(&Font20), sizeof(atlas_storage));
+    for (uint32_t g = 0; g < TEXT_LAYER_GLYPH_COUNT; g++) {
+        all[g] = (char)(' ' + g);
+        ref_char(reference, (g % 40U) * 14U, 100U + (g / 40U) * 20U, all[g], TEXT_FG, TEXT_BG);
+    }
+    for (uint32_t row = 0; row * 40U < TEXT_LAYER_GLYPH_COUNT; row++) {
+        char line[41];
+        const uint32_t n = (TEXT_LAYER_GLYPH_COUNT - row * 40U < 40U) ? TEXT_LAYER_GLYPH_COUNT - row * 40U : 40U;
+        memcpy(line, &all[row * 40U], n);
+        line[n] = '\0';
+        TEST_ASSERT_EQ(text_layer_draw(&atlas, &layer_surface, 0, (int32_t)(100U + row * 20U), line), n);
+    }
+    TEST_ASSERT(same_as_reference());
+}
+
+static void test_formatters_match_printf(void)
+{
+    static const float values[] = { 0.0f, 0.04f, 0.96f, 1.0f, 9.96f, 12.34f, 87.26f, 99.94f, 100.0f,
+                                    1234.56f, -3.21f, -0.01f };
+    char expected[32], out[32];
+
+    for (uint32_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        for (uint32_t d = 0; d <= 2U; d++) {
+            const uint32_t n = text_format_fixed(out, values[i], d);
+            snprintf(expected, sizeof(expected), "%.*f", (int)d, (double)values[i]);
+            if (strcmp(expected, "-0.0") == 0 || strcmp(expected, "-0") == 0 || strcmp(expected, "-0.00") == 0) {
+                memmove(expected, expected + 1, strlen(expected));
+            }
+            TEST_ASSERT(strcmp(out, expected) == 0);
+            TEST_ASSERT_EQ(n, (uint32_t)strlen(expected));
+        }
+    }
+
+    static const uint32_t ints[] = { 0U, 7U, 10U, 4096U, 4294967295U };
+    for (uint32_t i = 0; i < sizeof(ints) / sizeof(ints[0]); i++) {
+        snprintf(expected, sizeof(expected), "%u", (unsigned)ints[i]);
+        TEST_ASSERT_EQ(text_format_u32(out, ints[i]), (uint32_t)strlen(expected));
+        TEST_ASSERT(strcmp(out, expected) == 0);
+    }
+
+    text_format_fixed(out, 2.5f, 0);
+    TEST_ASSERT(strcmp(out, "3") == 0);
+}
+
+static void test_unchanged_text_is_not_redrawn(void)
+{
+    text_layer_stats_t stats;
+
+    reset();
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 10, 10, "FPS 30"), 1);
+    layer[10 * LAYER_WIDTH + 10] = 0x1234;  /* would be repaired by a redraw */
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 10, 10, "FPS 30"), 0);
+    TEST_ASSERT_EQ(layer[10 * LAYER_WIDTH + 10], 0x1234);
+
+    text_layer_get_stats(&text, &stats);
+    TEST_ASSERT_EQ(stats.prints, 2U);
+    TEST_ASSERT_EQ(stats.redraws, 1U);
+    TEST_ASSERT_EQ(stats.glyphs, 6U);
+}
+
+static void test_changed_text_clears_old_extent(void)
+{
+    reset();
+    text_layer_print(&text, 0, &atlas, 100, 50, "Boot time: 1234ms");
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 100, 50, "Boot: 9ms"), 1);
+    ref_printf(reference, 100, 50, "Boot: 9ms");
+    TEST_ASSERT(same_as_reference());
+
+    /* Longer text covers the old one, nothing to clear */
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 100, 50, "Boot: 10ms"), 1);
+    ref_printf(reference, 100, 50, "Boot: 10ms");
+    TEST_ASSERT(same_as_reference());
+
+    /* Moved label */
+    text_layer_print(&text, 1, &atlas, 300, 200, "87.5%");
+    TEST_ASSERT_EQ(text_layer_print(&text, 1, &atlas, 310, 205, "87.5%"), 1);
+    ref_printf(reference, 310, 205, "87.5%%");
+    TEST_ASSERT(same_as_reference());
+}
+
+static void test_damage_forces_redraw(void)
+{
+    reset();
+    text_layer_print(&text, 0, &atlas, 0, 0, "abc");
+    text_layer_print(&text, 1, &atlas, 0, 100, "def");
+    memset(layer, 0, LAYER_WIDTH * 40U * sizeof(uint16_t));
+    text_layer_damage(&text, 0, 0, LAYER_WIDTH, 40);
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 0, 0, "abc"), 1);
+    TEST_ASSERT_EQ(text_layer_print(&text, 1, &atlas, 0, 100, "def"), 0);
+    ref_printf(reference, 0, 0, "abc");
+    ref_printf(reference, 0, 100, "def");
+    TEST_ASSERT(same_as_reference());
+}
+
+static void test_end_frame_clears_unprinted_slots(void)
+{
+    text_layer_stats_t stats;
+
+    reset();
+    text_layer_print(&text, 3, &atlas, 200, 300, "Welcome");
+    text_layer_print(&text, 4, &atlas, 200, 320, "Hello");
+    text_layer_end_frame(&text);
+
+    text_layer_begin_frame(&text, 0, &layer_surface);
+    text_layer_print(&text, 4, &atlas, 200, 320, "Hello");
+    text_layer_end_frame(&text);
+    ref_printf(reference, 200, 320, "Hello");
+    TEST_ASSERT(same_as_reference());
+
+    text_layer_get_stats(&text, &stats);
+    TEST_ASSERT_EQ(stats.erases, 1U);
+}
+
+static void test_overlapping_slots_keep_print_order(void)
+{
+    reset();
+    text_layer_print(&text, 0, &atlas, 0, 0, "AAA");
+    text_layer_print(&text, 1, &atlas, 28, 0, "xx");
+    text_layer_end_frame(&text);
+
+    /* Erasing slot 0 wipes part of slot 1, printed after it: redrawn */
+    text_layer_begin_frame(&text, 0, &layer_surface);
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 0, 0, "A"), 1);
+    TEST_ASSERT_EQ(text_layer_print(&text, 1, &atlas, 28, 0, "xx"), 1);
+    text_layer_end_frame(&text);
+    ref_printf(reference, 0, 0, "A");
+    ref_printf(reference, 28, 0, "xx");
+    TEST_ASSERT(same_as_reference());
+
+    /* Slot 1 printed first this time: restored right after the erase */
+    text_layer_begin_frame(&text, 0, &layer_surface);
+    TEST_ASSERT_EQ(text_layer_print(&text, 1, &atlas, 28, 0, "xx"), 0);
+    text_layer_print(&text, 0, &atlas, 0, 0, "AA");
+    text_layer_print(&text, 0, &atlas, 0, 0, "B");
+    text_layer_end_frame(&text);
+    memset(reference, 0, sizeof(reference));
+    ref_printf(reference, 28, 0, "xx");
+    ref_printf(reference, 0, 0, "B");
+    TEST_ASSERT(same_as_reference());
+}
+
+static void test_buffers_are_tracked_separately(void)
+{
+    static uint16_t other[LAYER_HEIGHT * LAYER_WIDTH];
+    const gfx2d_surface_t other_surface = {
+        (uint8_t *)other, LAYER_WIDTH, LAYER_HEIGHT, LAYER_WIDTH, GFX2D_FORMAT_ARGB4444
+    };
+
+    reset();
+    memset(other, 0, sizeof(other));
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 5, 5, "12.0"), 1);
+    text_layer_end_frame(&text);
+
+    TEST_ASSERT_EQ(text_layer_begin_frame(&text, 1, &other_surface), 0);
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 5, 5, "12.0"), 1);
+    text_layer_end_frame(&text);
+    TEST_ASSERT(memcmp(layer, other, sizeof(layer)) == 0);
+
+    TEST_ASSERT_EQ(text_layer_begin_frame(&text, 0, &layer_surface), 0);
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 5, 5, "12.0"), 0);
+}
+
+static void test_clipping(void)
+{
+    reset();
+    /* 10 glyphs from x = 730: 5 fit, as the BSP stops at the edge */
+    TEST_ASSERT_EQ(text_layer_draw(&atlas, &layer_surface, 730, 0, "0123456789"), 5U);
+    ref_printf(reference, 730, 0, "0123456789");
+    TEST_ASSERT(same_as_reference());
+
+    /* Partly above and below the layer */
+    TEST_ASSERT_EQ(text_layer_print(&text, 0, &atlas, 0, -10, "top"), 1);
+    TEST_ASSERT_EQ(text_layer_print(&text, 1, &atlas, 0, (int32_t)LAYER_HEIGHT - 5, "bottom"), 1);
+    TEST_ASSERT_EQ(layer[0], ref_argb4444(TEXT_BG));
+    TEST_ASSERT_EQ(layer[(LAYER_HEIGHT - 1U) * LAYER_WIDTH], ref_argb4444(TEXT_BG));
+    TEST_ASSERT_EQ(text_layer_draw(&atlas, &layer_surface, 0, (int32_t)LAYER_HEIGHT, "x"), 0U);
+    TEST_ASSERT_EQ(text_layer_draw(&atlas, &layer_surface, -14, 0, "x"), 0U);
+
+    /* Clearing a clipped slot stays inside the layer */
+    text_layer_begin_frame(&text, 0, &layer_surface);
+    text_layer_end_frame(&text);
+    TEST_ASSERT_EQ(layer[0], 0U);
+    TEST_ASSERT_EQ(layer[(LAYER_HEIGHT - 1U) * LAYER_WIDTH], 0U);
+}
+
+static void test_invalid_arguments(void)
+{
+    gfx2d_surface_t bad = layer_surface;
+
+    reset();
+    TEST_ASSERT(text_atlas_init(&atlas, &Font20, 0, 0, atlas_storage, sizeof(atlas_storage) - 2U) < 0);
+    TEST_ASSERT(text_atlas_init(&atlas, &Font20, 0, 0, (uint8_t *)atlas_storage + 1, sizeof(atlas_storage)) < 0);
+    TEST_ASSERT(text_atlas_init(NULL, &Font20, 0, 0, atlas_storage, sizeof(atlas_storage)) < 0);
+    TEST_ASSERT(text_layer_begin_frame(&text, TEXT_LAYER_BUFFER_COUNT, &layer_surface) < 0);
+    bad.format = GFX2D_FORMAT_RGB888;
+    TEST_ASSERT(text_layer_begin_frame(&text, 0, &bad) < 0);
+    TEST_ASSERT(text_layer_print(&text, TEXT_LAYER_MAX_SLOTS, &atlas, 0, 0, "x") < 0);
+    TEST_ASSERT(text_layer_print(&text, 0, NULL, 0, 0, "x") < 0);
+    TEST_ASSERT_EQ(text_layer_draw(&atlas, &bad, 0, 0, "x"), 0U);
+
+    /* Characters outside the font draw as spaces */
+    TEST_ASSERT_EQ(text_layer_draw(&atlas, &layer_surface, 0, 0, "\x7F\x01"), 2U);
+    ref_printf(reference, 0, 0, "  ");
+    TEST_ASSERT(same_as_reference());
+}
+
+/* Overlay text of one refresh: three info lines that rarely change and two
+ * moving face labels */
+static void test_benchmark_overlay_text(void)
+{
+    const uint32_t frames = 200;
+    char buf[TEXT_LAYER_MAX_CHARS + 1];
+    uint32_t t0;
+
+    reset();
+    t0 = perf_monitor_now();
+    for (uint32_t f = 0; f < frames; f++) {
+        const float fps = 29.7f + (float)(f / 30U) * 0.1f;
+        ref_printf(reference, 295, 400, "Inference: %.1f FPS", (double)fps);
+        ref_printf(reference, 295, 420, "Embeddings: %d/%d", 3, 10);
+        ref_printf(reference, 295, 440, "Boot time: %ums", 1234U);
+        ref_printf(reference, 200 + f % 50U, 65, "%.1f%%", (double)87.3f);
+        ref_printf(reference, 460, 125 + f % 40U, "%.1f%%", (double)64.9f);
+    }
+    const uint32_t reference_ticks = perf_monitor_now() - t0;
+
+    t0 = perf_monitor_now();
+    for (uint32_t f = 0; f < frames; f++) {
+        const float fps = 29.7f + (float)(f / 30U) * 0.1f;
+        uint32_t n;
+
+        text_layer_begin_frame(&text, f & 1U, &layer_surface);
+        memcpy(buf, "Inference: ", 11);
+        n = 11U + text_format_fixed(&buf[11], fps, 1);
+        memcpy(&buf[n], " FPS", 5);
+        text_layer_print(&text, 0, &atlas, 295, 400, buf);
+        text_layer_print(&text, 1, &atlas, 295, 420, "Embeddings: 3/10");
+        memcpy(buf, "Boot time: ", 11);
+        n = 11U + text_format_u32(&buf[11], 1234U);
+        memcpy(&buf[n], "ms", 3);
+        text_layer_print(&text, 2, &atlas, 295, 440, buf);
+        n = text_format_fixed(buf, 87.3f, 1);
+        memcpy(&buf[n], "%", 2);
+        text_layer_print(&text, 6, &atlas, (int32_t)(200U + f % 50U), 65, buf);
+        n = text_format_fixed(buf, 64.9f, 1);
+        memcpy(&buf[n], "%", 2);
+        text_layer_print(&text, 7, &atlas, 460, (int32_t)(125U + f % 40U), buf);
+        text_layer_end_frame(&text);
+    }
+    const uint32_t layer_ticks = perf_monitor_now() - t0;
+
+    const double ticks_per_us = (double)perf_monitor_cycles_per_us();
+    printf("    per frame: printf + pixel loop %.1f us, atlas + cache %.1f us\n",
+           (double)reference_ticks / frames / ticks_per_us, (double)layer_ticks / frames / ticks_per_us);
+}
+
+int main(void)
+{
+    printf("test_text_layer\n");
+    RUN_TEST(test_atlas_matches_bsp_glyphs);
+    RUN_TEST(test_formatters_match_printf);
+    RUN_TEST(test_unchanged_text_is_not_redrawn);
+    RUN_TEST(test_changed_text_clears_old_extent);
+    RUN_TEST(test_damage_forces_redraw);
+    RUN_TEST(test_end_frame_clears_unprinted_slots);
+    RUN_TEST(test_overlapping_slots_keep_print_order);
+    RUN_TEST(test_buffers_are_tracked_separately);
+    RUN_TEST(test_clipping);
+    RUN_TEST(test_invalid_arguments);
+    RUN_TEST(test_benchmark_overlay_text);
+    TEST_EXIT();
+}
@@ -0,0 +1,453 @@
+/**
+ ******************************************************************************
+ * @file    test_tile_delta.c
+ * @author  PeleAB
+ * @brief   Host tests for the tile delta frame coding
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "tile_delta.h"
+#include "robust_framing.h"
+#include "test_common.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Camera frame as streamed: 800x480 RGB565 sampled every other pixel */
+#define SRC_WIDTH       800U
+#define SRC_HEIGHT      480U
+#define SRC_BPP         2U
+#define STEP            2U
+#define WIDTH           (SRC_WIDTH / STEP)
+#define HEIGHT          (SRC_HEIGHT / STEP)
+#define FRAME_BYTES     (WIDTH * HEIGHT * SRC_BPP)
+#define TILES           (((WIDTH + 15U) / 16U) * ((HEIGHT + 15U) / 16U))
+#define PAYLOAD_MAX     (sizeof(tile_delta_header_t) + TILES * 2U + FRAME_BYTES)
+
+#define MSG_FRAME_DATA  0x01
+#define MSG_FRAME_DELTA 0x0D
+
+static uint8_t source[SRC_WIDTH * SRC_HEIGHT * SRC_BPP];
+static uint8_t reference[FRAME_BYTES];
+static uint8_t decoded[FRAME_BYTES];
+static uint8_t payload[PAYLOAD_MAX];
+static tile_delta_t delta;
+
+/* ========================================================================= */
+/* SYNTHETIC SCENE                                                           */
+/* ========================================================================= */
+
+/*
+ * Surveillance-like scene: a static textured background with sensor noise
+ * of one level per channel, optional global brightness drift and a 40x40
+ * object moving across it.
+ */
+typedef struct {
+    uint32_t frame;
+    int32_t object_x;                   /* Source pixels, negative for no object */
+    int32_t object_y;
+    uint32_t drift;                     /* Brightness added to the green channel */
+} scene_t;
+
+static uint32_t noise_state = 12345U;
+
+static uint32_t noise(void)
+{
+    noise_state = noise_state * 1103515245U + 12345U;
+    return (noise_state >> 16) & 1U;
+}
+
+static void render(const scene_t *scene)
+{
+    for (uint32_t y = 0; y < SRC_HEIGHT; y++) {
+        for (uint32_t x = 0; x < SRC_WIDTH; x++) {
+            uint32_t r = ((x / 24U) * 3U + (y / 40U) * 5U) & 0x1FU;
+            uint32_t g = ((x * y) >> 10) & 0x1FU;
+            uint32_t b = ((x + 2U * y) >> 5) & 0x1FU;
+            g += scene->drift;
+            r ^= noise();
+            b ^= noise();
+
+            const bool in_object = scene->object_x >= 0 &&
+                                   (int32_t)x >= scene->object_x && (int32_t)x < scene->object_x + 40 &&
+                                   (int32_t)y >= scene->object_y && (int32_t)y < scene->object_y + 40;
+            if (in_object) {
+                r = 0x1F;
+                g = 0x3F;
+                b = 0x04;
+            }
+            if (g > 0x3F) {
+                g = 0x3F;
+            }
+            const uint16_t px = (uint16_t)((r << 11) | (g << 5) | b);
+            source[(y * SRC_WIDTH + x) * 2U] = (uint8_t)px;
+            source[(y * SRC_WIDTH + x) * 2U + 1U] = (uint8_t)(px >> 8);
+        }
+    }
+}
+
+static const tile_delta_frame_t frame = {
+    .pixels = source,
+    .width = WIDTH,
+    .height = HEIGHT,
+    .bpp = SRC_BPP,
+    .stride = SRC_WIDTH * SRC_BPP * STEP,
+    .step = STEP,
+};
+
+/* Sampled frame, packed as the host sees full frames */
+static void sample(uint8_t *out)
+{
+    for (uint32_t y = 0; y < HEIGHT; y++) {
+        for (uint32_t x = 0; x < WIDTH; x++) {
+            memcpy(&out[(y * WIDTH + x) * 2U], &source[(y * STEP * SRC_WIDTH + x * STEP) * 2U], 2);
+        }
+    }
+}
+
+/* Plan and serialize a message as Enhanced_PC_STREAM_SendFrame() does */
+static uint32_t encode(void)
+{
+    TEST_ASSERT(tile_delta_plan(&delta, &frame) >= 0);
+
+    tile_delta_header_t header;
+    tile_delta_get_header(&delta, "RAW", &header);
+    memcpy(payload, &header, sizeof(header));
+
+    uint32_t size = sizeof(header);
+    for (uint32_t i = 0; i < delta.changed_count; i++) {
+        payload[size++] = (uint8_t)delta.changed[i];
+        payload[size++] = (uint8_t)(delta.changed[i] >> 8);
+        size += tile_delta_copy_tile(&delta, &frame, delta.changed[i], &payload[size]);
+    }
+    TEST_ASSERT_EQ(size, tile_delta_payload_size(&delta));
+    return size;
+}
+
+static uint32_t pixel_diff(const uint8_t *a, const uint8_t *b)
+{
+    const uint32_t pa = a[0] | (a[1] << 8);
+    const uint32_t pb = b[0] | (b[1] << 8);
+    const int32_t dr = (int32_t)(((pa >> 11) & 0x1F) - ((pb >> 11) & 0x1F)) * 8;
+    const int32_t dg = (int32_t)(((pa >> 5) & 0x3F) - ((pb >> 5) & 0x3F)) * 4;
+    const int32_t db = (int32_t)((pa & 0x1F) - (pb & 0x1F)) * 8;
+    uint32_t d = (uint32_t)abs(dr);
+    d = ((uint32_t)abs(dg) > d) ? (uint32_t)abs(dg) : d;
+    return ((uint32_t)abs(db) > d) ? (uint32_t)abs(db) : d;
+}
+
+/* Decoded frame against the current one: worst pixel and worst tile mean */
+static void reconstruction_error(uint32_t *max_pixel, uint32_t *max_tile_mean)
+{
+    uint8_t truth[FRAME_BYTES];
+    sample(truth);
+    *max_pixel = 0;
+    *max_tile_mean = 0;
+
+    for (uint32_t ty = 0; ty < HEIGHT; ty += 16) {
+        for (uint32_t tx = 0; tx < WIDTH; tx += 16) {
+            uint32_t sum = 0, count = 0;
+            for (uint32_t y = ty; y < ty + 16 && y < HEIGHT; y++) {
+                for (uint32_t x = tx; x < tx + 16 && x < WIDTH; x++, count++) {
+                    const uint32_t d = pixel_diff(&truth[(y * WIDTH + x) * 2U],
+                                                  &decoded[(y * WIDTH + x) * 2U]);
+                    sum += d;
+                    *max_pixel = (d > *max_pixel) ? d : *max_pixel;
+                }
+            }
+            *max_tile_mean = (sum / count > *max_tile_mean) ? sum / count : *max_tile_mean;
+        }
+    }
+}
+
+static void reset(uint32_t keyframe_interval)
+{
+    tile_delta_config_t config;
+    tile_delta_default_config(&config);
+    config.keyframe_interval = keyframe_interval;
+    TEST_ASSERT_EQ(tile_delta_init(&delta, &config, reference, sizeof(reference)), 0);
+    noise_state = 12345U;
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_first_frame_is_keyframe(void)
+{
+    const scene_t scene = { 0, -1, 0, 0 };
+    uint16_t image_id = 0;
+
+    reset(0);
+    render(&scene);
+    TEST_ASSERT_EQ(tile_delta_plan(&delta, &frame), (int)TILES);
+    TEST_ASSERT(delta.keyframe);
+    const uint32_t size = encode();
+    TEST_ASSERT_EQ(size, sizeof(tile_delta_header_t) + TILES * 2U + FRAME_BYTES);
+    tile_delta_commit(&delta, &frame);
+
+    TEST_ASSERT_EQ(tile_delta_apply(decoded, sizeof(decoded), &image_id, payload, size), 0);
+    TEST_ASSERT_EQ(image_id, 1);
+    uint8_t truth[FRAME_BYTES];
+    sample(truth);
+    TEST_ASSERT(memcmp(decoded, truth, FRAME_BYTES) == 0);
+}
+
+/* Sensor noise alone resends nothing */
+static void test_static_scene_sends_no_tiles(void)
+{
+    scene_t scene = { 0, -1, 0, 0 };
+
+    reset(0);
+    render(&scene);
+    encode();
+    tile_delta_commit(&delta, &frame);
+    for (scene.frame = 1; scene.frame < 10; scene.frame++) {
+        render(&scene);
+        TEST_ASSERT_EQ(tile_delta_plan(&delta, &frame), 0);
+        TEST_ASSERT_EQ(encode(), sizeof(tile_delta_header_t));
+        tile_delta_commit(&delta, &frame);
+    }
+}
+
+/* Moving object and slow drift: bounded error, several times fewer bytes */
+static void test_round_trip_error_is_bounded(void)
+{
+    scene_t scene = { 0, 0, 100, 0 };
+    uint16_t image_id = 0;
+    uint32_t bytes = 0;
+    const uint32_t frames = 60;
+
+    reset(TILE_DELTA_DEFAULT_KEYFRAME);
+    for (scene.frame = 0; scene.frame < frames; scene.frame++) {
+        scene.object_x = (int32_t)(scene.frame * 12U);
+        scene.object_y = 100 + (int32_t)(scene.frame * 3U);
+        scene.drift = scene.frame / 6U;
+        render(&scene);
+
+        const uint32_t size = encode();
+        tile_delta_commit(&delta, &frame);
+        TEST_ASSERT_EQ(tile_delta_apply(decoded, sizeof(decoded), &image_id, payload, size), 0);
+        bytes += size;
+
+        uint32_t max_pixel, max_tile_mean;
+        reconstruction_error(&max_pixel, &max_tile_mean);
+        TEST_ASSERT(max_pixel <= TILE_DELTA_DEFAULT_PIXEL);
+        TEST_ASSERT(max_tile_mean <= TILE_DELTA_DEFAULT_SAD);
+    }
+
+    tile_delta_stats_t stats;
+    tile_delta_get_stats(&delta, &stats);
+    TEST_ASSERT_EQ(stats.frames, frames);
+    TEST_ASSERT_EQ(stats.keyframes, 2);
+    TEST_ASSERT(bytes * 4U < frames * FRAME_BYTES);
+    printf("    %u frames: %u bytes, %.1fx less than full frames, %u of %u tiles\n",
+           (unsigned)frames, (unsigned)bytes, (double)(frames * FRAME_BYTES) / bytes,
+           (unsigned)stats.tiles_sent, (unsigned)stats.tiles_total);
+}
+
+/* A message that never reached the link must not move the reference */
+static void test_uncommitted_message_keeps_host_in_step(void)
+{
+    scene_t scene = { 0, 0, 0, 0 };
+    uint16_t image_id = 0;
+
+    reset(0);
+    render(&scene);
+    TEST_ASSERT_EQ(tile_delta_apply(decoded, sizeof(decoded), &image_id, payload, encode()), 0);
+    tile_delta_commit(&delta, &frame);
+
+    scene.object_x = 200;
+    render(&scene);
+    TEST_ASSERT(encode() > sizeof(tile_delta_header_t));   /* dropped: no commit */
+
+    scene.object_x = 400;
+    render(&scene);
+    const uint32_t size = encode();
+    tile_delta_commit(&delta, &frame);
+    TEST_ASSERT_EQ(tile_delta_apply(decoded, sizeof(decoded), &image_id, payload, size), 0);
+
+    uint32_t max_pixel, max_tile_mean;
+    reconstruction_error(&max_pixel, &max_tile_mean);
+    TEST_ASSERT(max_pixel <= TILE_DELTA_DEFAULT_PIXEL);
+}
+
+/* A delta the host lost makes it wait for the next keyframe */
+static void test_lost_message_waits_for_keyframe(void)
+{
+    scene_t scene = { 0, 0, 0, 0 };
+    uint16_t image_id = 0;
+
+    reset(4);
+    render(&scene);
+    TEST_ASSERT_EQ(tile_delta_apply(decoded, sizeof(decoded), &image_id, payload, encode()), 0);
+    tile_delta_commit(&delta, &frame);
+
+    for (scene.frame = 1; scene.frame < 5; scene.frame++) {
+        scene.object_x = (int32_t)(scene.frame * 100U);
+        render(&scene);
+        const uint32_t size = encode();
+        tile_delta_commit(&delta, &frame);
+        if (scene.frame == 1) {
+            continue;                   /* lost on the link */
+        }
+        const int ret = tile_delta_apply(decoded, sizeof(decoded), &image_id, payload, size);
+        TEST_ASSERT_EQ(ret, (scene.frame < 4) ? -2 : 0);
+    }
+    TEST_ASSERT_EQ(image_id, 5);
+}
+
+static void test_keyframes_and_geometry_changes(void)
+{
+    scene_t scene = { 0, -1, 0, 0 };
+
+    reset(3);
+    render(&scene);
+    for (uint32_t i = 0; i < 7; i++) {
+        tile_delta_plan(&delta, &frame);
+        TEST_ASSERT_EQ(delta.keyframe, (i % 3U) == 0);
+        tile_delta_commit(&delta, &frame);
+    }
+
+    reset(0);
+    tile_delta_plan(&delta, &frame);
+    tile_delta_commit(&delta, &frame);
+    tile_delta_request_keyframe(&delta);
+    TEST_ASSERT_EQ(tile_delta_plan(&delta, &frame), (int)TILES);
+    tile_delta_commit(&delta, &frame);
+    TEST_ASSERT_EQ(tile_delta_plan(&delta, &frame), 0);
+
+    /* Smaller frame: a keyframe with clipped edge tiles */
+    tile_delta_frame_t small = frame;
+    small.width = 100;
+    small.height = 50;
+    TEST_ASSERT_EQ(tile_delta_plan(&delta, &small), 7 * 4);
+    TEST_ASSERT(delta.keyframe);
+    TEST_ASSERT_EQ(tile_delta_payload_size(&delta),
+                   sizeof(tile_delta_header_t) + 28U * 2U + 100U * 50U * 2U);
+}
+
+static void test_rejects_unsupported_frames(void)
+{
+    tile_delta_frame_t bad = frame;
+
+    reset(0);
+    TEST_ASSERT_EQ(tile_delta_init(&delta, NULL, reference, FRAME_BYTES - 1), 0);
+    TEST_ASSERT_EQ(tile_delta_plan(&delta, &frame), -1);
+
+    reset(0);
+    bad.bpp = 5;
+    TEST_ASSERT_EQ(tile_delta_plan(&delta, &bad), -1);
+    bad = frame;
+    bad.step = 0;
+    TEST_ASSERT_EQ(tile_delta_plan(&delta, &bad), -1);
+
+    uint16_t image_id = 0;
+    TEST_ASSERT_EQ(tile_delta_apply(decoded, sizeof(decoded), &image_id, payload, 10), -1);
+}
+
+/* ========================================================================= */
+/* LOOPBACK STREAM                                                           */
+/* ========================================================================= */
+
+static uart_tx_queue_t queue;
+static uint8_t arena[160U * 1024U] __attribute__ ((aligned (4)));
+static FILE *loopback;
+static const uint8_t *in_flight;
+static uint32_t in_flight_size;
+
+static int file_start(void *ctx, const uint8_t *data, uint32_t size)
+{
+    (void)ctx;
+    in_flight = data;
+    in_flight_size = size;
+    return 0;
+}
+
+/* The transfer reaches the file and completes */
+static void file_poll(void *ctx)
+{
+    (void)ctx;
+    if (in_flight != NULL) {
+        TEST_ASSERT_EQ(fwrite(in_flight, 1, in_flight_size, loopback), in_flight_size);
+        in_flight = NULL;
+        uart_tx_queue_on_complete(&queue);
+    }
+}
+
+static void send(uint8_t type, uint16_t sequence_id, const uint8_t *data, uint32_t size)
+{
+    robust_writer_t writer;
+    TEST_ASSERT_EQ(robust_writer_begin(&writer, &queue, ROBUST_PROTOCOL_V2, type, sequence_id,
+                                       size, 0, UART_TX_RELIABLE), 0);
+    TEST_ASSERT_EQ(robust_writer_write(&writer, data, size), 0);
+    TEST_ASSERT_EQ(robust_writer_end(&writer), 0);
+    while (in_flight != NULL) {
+        file_poll(NULL);
+    }
+}
+
+/*
+ * Stream read back by python_tools/test_protocol_loopback.py: for every
+ * frame of the moving object scene, the frame itself (FRAME_DATA) then its
+ * tile delta message.
+ */
+static int write_loopback(const char *path)
+{
+    const uart_tx_port_t port = { file_start, file_poll, NULL };
+    scene_t scene = { 0, 0, 100, 0 };
+    static uint8_t truth[12U + FRAME_BYTES];
+
+    loopback = fopen(path, "wb");
+    if (loopback == NULL) {
+        perror(path);
+        return -1;
+    }
+    TEST_ASSERT_EQ(uart_tx_queue_init(&queue, &port, arena, sizeof(arena), 0, 100000), 0);
+
+    reset(10);
+    for (scene.frame = 0; scene.frame < 12; scene.frame++) {
+        scene.object_x = (int32_t)(scene.frame * 30U);
+        scene.drift = scene.frame / 4U;
+        render(&scene);
+
+        const uint32_t dims[2] = { WIDTH, HEIGHT };
+        memcpy(truth, "RAW", 4);
+        memcpy(truth + 4, dims, sizeof(dims));
+        sample(truth + 12);
+        send(MSG_FRAME_DATA, (uint16_t)(scene.frame + 1U), truth, sizeof(truth));
+
+        const uint32_t size = encode();
+        send(MSG_FRAME_DELTA, (uint16_t)(scene.frame + 1U), payload, size);
+        tile_delta_commit(&delta, &frame);
+    }
+    fclose(loopback);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    printf("test_tile_delta\n");
+    TEST_ASSERT_EQ(crc32_stream_init(), 0);
+    RUN_TEST(test_first_frame_is_keyframe);
+    RUN_TEST(test_static_scene_sends_no_tiles);
+    RUN_TEST(test_round_trip_error_is_bounded);
+    RUN_TEST(test_uncommitted_message_keeps_host_in_step);
+    RUN_TEST(test_lost_message_waits_for_keyframe);
+    RUN_TEST(test_keyframes_and_geometry_changes);
+    RUN_TEST(test_rejects_unsupported_frames);
+
+    if (argc > 1) {
+        TEST_ASSERT_EQ(write_loopback(argv[1]), 0);
+    }
+    TEST_EXIT();
+}
@@ -0,0 +1,405 @@
+/**
+ ******************************************************************************
+ * @file    test_uart_tx_queue.c
+ * @author  PeleAB
+ * @brief   Host tests for the PC stream transmit queue on a simulated UART
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2023 STMicroelectronics.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+#include "uart_tx_queue.h"
+#include "perf_monitor.h"
+#include "test_common.h"
+#include <string.h>
+
+#define ARENA_SIZE      (160U * 1024U)
+#define RESERVE_SIZE    (16U * 1024U)
+#define WIRE_SIZE       (4U * 1024U * 1024U)
+#define PC_BAUD_RATE    (921600U * 8U)
+
+/* ========================================================================= */
+/* SIMULATED UART                                                            */
+/* ========================================================================= */
+
+typedef struct {
+    const uint8_t *data;                /* Transfer in flight */
+    uint32_t size;
+    uint32_t starts;
+    uint32_t max_chunk;
+    int fail_next;                      /* start() refuses the next transfer */
+    bool poll_completes;                /* Waiting moves the transfer along */
+    uint8_t wire[WIRE_SIZE];
+    uint32_t wire_size;
+} sim_uart_t;
+
+static sim_uart_t uart;
+static uart_tx_queue_t queue;
+static uint8_t arena[ARENA_SIZE] __attribute__ ((aligned (4)));
+
+static int sim_start(void *ctx, const uint8_t *data, uint32_t size)
+{
+    sim_uart_t *u = (sim_uart_t *)ctx;
+
+    TEST_ASSERT(u->data == NULL);       /* one transfer at a time */
+    if (u->fail_next) {
+        u->fail_next = 0;
+        return -1;
+    }
+    u->data = data;
+    u->size = size;
+    u->starts++;
+    u->max_chunk = (size > u->max_chunk) ? size : u->max_chunk;
+    return 0;
+}
+
+/* The bytes leave the UART and the completion interrupt fires */
+static bool sim_complete(void)
+{
+    if (uart.data == NULL) {
+        return false;
+    }
+    if (uart.wire_size + uart.size <= WIRE_SIZE) {
+        memcpy(&uart.wire[uart.wire_size], uart.data, uart.size);
+    }
+    uart.wire_size += uart.size;
+    uart.data = NULL;
+    uart_tx_queue_on_complete(&queue);
+    return true;
+}
+
+static void sim_poll(void *ctx)
+{
+    sim_uart_t *u = (sim_uart_t *)ctx;
+    if (u->poll_completes) {
+        sim_complete();
+    }
+}
+
+static void drain(void)
+{
+    while (sim_complete()) {
+    }
+}
+
+static void reset(uint32_t wait_us)
+{
+    const uart_tx_port_t port = { sim_start, sim_poll, &uart };
+
+    memset(&uart, 0, sizeof(uart));
+    uart.poll_completes = true;
+    TEST_ASSERT_EQ(uart_tx_queue_init(&queue, &port, arena, ARENA_SIZE, RESERVE_SIZE, wait_us), 0);
+}
+
+/* Packet of size bytes filled with a pattern derived from seed */
+static int send(uint32_t size, uart_tx_class_t packet_class, uint8_t seed)
+{
+    const uint8_t head[3] = { 0xAA, seed, (uint8_t)size };
+    const uint8_t tail[2] = { 0x55, seed };
+    uint8_t *payload = uart_tx_queue_reserve(&queue, size, packet_class);
+
+    if (payload == NULL) {
+        return -1;
+    }
+    TEST_ASSERT(((uintptr_t)payload & 3U) == 0);
+    for (uint32_t i = 0; i < size; i++) {
+        payload[i] = (uint8_t)(seed + i * 7U);
+    }
+    return uart_tx_queue_commit(&queue, head, sizeof(head), tail, sizeof(tail));
+}
+
+/* Check the packet starting at *pos on the wire and move past it */
+static bool wire_has(uint32_t *pos, uint32_t size, uint8_t seed)
+{
+    const uint8_t *w = &uart.wire[*pos];
+
+    if (*pos + 5U + size > uart.wire_size || w[0] != 0xAA || w[1] != seed || w[2] != (uint8_t)size) {
+        return false;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        if (w[3 + i] != (uint8_t)(seed + i * 7U)) {
+            return false;
+        }
+    }
+    if (w[3 + size] != 0x55 || w[4 + size] != seed) {
+        return false;
+    }
+    *pos += 5U + size;
+    return true;
+}
+
+/* ========================================================================= */
+/* TESTS                                                                     */
+/* ========================================================================= */
+
+static void test_sends_segments_in_order(void)
+{
+    uart_tx_stats_t stats;
+    uint32_t pos = 0;
+
+    reset(100000);
+    TEST_ASSERT_EQ(send(100, UART_TX_RELIABLE, 1), 0);
+    TEST_ASSERT_EQ(send(0, UART_TX_RELIABLE, 2), 0);
+    TEST_ASSERT_EQ(send(3000, UART_TX_DROPPABLE, 3), 0);
+
+    /* Only the first header is on its way; nothing blocked */
+    TEST_ASSERT_EQ(uart.starts, 1U);
+    TEST_ASSERT_EQ(uart.size, 3U);
+    TEST_ASSERT(!uart_tx_queue_idle(&queue));
+    uart_tx_queue_get_stats(&queue, &stats);
+    TEST_ASSERT_EQ(stats.depth, 3U);
+    TEST_ASSERT_EQ(stats.max_depth, 3U);
+    const uint32_t pending = stats.bytes_pending;
+
+    drain();
+    TEST_ASSERT(uart_tx_queue_idle(&queue));
+    TEST_ASSERT(wire_has(&pos, 100, 1));
+    TEST_ASSERT(wire_has(&pos, 0, 2));
+    TEST_ASSERT(wire_has(&pos, 3000, 3));
+    TEST_ASSERT_EQ(pos, uart.wire_size);
+    TEST_ASSERT_EQ(uart.starts, 8U);   /* 3 + 2 (empty payload skipped) + 3 */
+
+    uart_tx_queue_get_stats(&queue, &stats);
+    TEST_ASSERT_EQ(stats.packets_queued, 3U);
+    TEST_ASSERT_EQ(stats.packets_sent, 3U);
+    TEST_ASSERT_EQ(stats.bytes_sent, uart.wire_size);
+    TEST_ASSERT_EQ(pending, uart.wire_size);
+    TEST_ASSERT_EQ(stats.bytes_pending, 0U);
+    TEST_ASSERT_EQ(stats.depth, 0U);
+}
+
+static void test_frames_dropped_metrics_kept(void)
+{
+    uart_tx_stats_t stats;
+    uint32_t frames = 0, pos = 0;
+
+    reset(100000);
+    uart.poll_completes = false;
+    /* 57.6 KB frames while the UART is stuck on the first one */
+    for (uint8_t i = 0; i < 5; i++) {
+        frames += (send(57600, UART_TX_DROPPABLE, (uint8_t)(10 + i)) == 0);
+    }
+    TEST_ASSERT_EQ(frames, 2U);
+
+    /* Metrics still fit in the reserved room without waiting */
+    for (uint8_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQ(send(1024, UART_TX_RELIABLE, (uint8_t)(20 + i)), 0);
+    }
+    uart_tx_queue_get_stats(&queue, &stats);
+    TEST_ASSERT_EQ(stats.packets_dropped, 3U);
+    TEST_ASSERT_EQ(stats.reliable_waits, 0U);
+
+    drain();
+    TEST_ASSERT(wire_has(&pos, 57600, 10));
+    TEST_ASSERT(wire_has(&pos, 57600, 11));
+    for (uint8_t i = 0; i < 4; i++) {
+        TEST_ASSERT(wire_has(&pos, 1024, (uint8_t)(20 + i)));
+    }
+}
+
+static void test_reliable_waits_for_room(void)
+{
+    uart_tx_stats_t stats;
+    uint32_t pos = 0;
+
+    reset(100000);
+    /* Fill the arena with reliable packets, then one more */
+    TEST_ASSERT_EQ(send(60000, UART_TX_RELIABLE, 1), 0);
+    TEST_ASSERT_EQ(send(60000, UART_TX_RELIABLE, 2), 0);
+    TEST_ASSERT_EQ(send(40000, UART_TX_RELIABLE, 3), 0);
+    TEST_ASSERT_EQ(send(30000, UART_TX_RELIABLE, 4), 0);
+
+    uart_tx_queue_get_stats(&queue, &stats);
+    TEST_ASSERT_EQ(stats.reliable_waits, 1U);
+    TEST_ASSERT_EQ(stats.packets_dropped, 0U);
+    TEST_ASSERT_EQ(stats.reliable_failures, 0U);
+
+    drain();
+    TEST_ASSERT(wire_has(&pos, 60000, 1));
+    TEST_ASSERT(wire_has(&pos, 60000, 2));
+    TEST_ASSERT(wire_has(&pos, 40000, 3));
+    TEST_ASSERT(wire_has(&pos, 30000, 4));
+}
+
+static void test_reliable_gives_up_on_stuck_uart(void)
+{
+    uart_tx_stats_t stats;
+
+    reset(2000);
+    uart.poll_completes = false;
+    TEST_ASSERT_EQ(send(100000, UART_TX_RELIABLE, 1), 0);
+    TEST_ASSERT(send(100000, UART_TX_RELIABLE, 2) < 0);
+    /* Larger than the arena: refused without waiting for a drain */
+    drain();
+    TEST_ASSERT(send(ARENA_SIZE + 1U, UART_TX_RELIABLE, 3) < 0);
+
+    uart_tx_queue_get_stats(&queue, &stats);
+    TEST_ASSERT_EQ(stats.reliable_failures, 2U);
+}
+
+static void test_descriptors_kept_for_reliable(void)
+{
+    uint32_t frames = 0;
+
+    reset(100000);
+    uart.poll_completes = false;
+    for (uint32_t i = 0; i < UART_TX_QUEUE_DEPTH; i++) {
+        frames += (send(10, UART_TX_DROPPABLE, (uint8_t)i) == 0);
+    }
+    TEST_ASSERT_EQ(frames, (uint32_t)(UART_TX_QUEUE_DEPTH - UART_TX_RELIABLE_SLOTS));
+    for (uint32_t i = 0; i < UART_TX_RELIABLE_SLOTS; i++) {
+        TEST_ASSERT_EQ(send(10, UART_TX_RELIABLE, (uint8_t)i), 0);
+    }
+    drain();
+    TEST_ASSERT(uart_tx_queue_idle(&queue));
+}
+
+static void test_arena_wraps(void)
+{
+    static const uint32_t sizes[] = { 50000, 777, 31000, 4096, 12, 65000, 1, 20000, 48000, 333 };
+    uint32_t pos = 0, expected_count = 0;
+    uint32_t expected_size[64];
+    uint8_t expected_seed[64];
+
+    reset(100000);
+    /* Keep two packets in flight so new ones land around older ones */
+    for (uint32_t i = 0; i < 60; i++) {
+        const uint32_t size = sizes[i % 10];
+        const uart_tx_class_t packet_class = (i % 3 == 0) ? UART_TX_DROPPABLE : UART_TX_RELIABLE;
+        if (send(size, packet_class, (uint8_t)i) == 0) {
+            expected_size[expected_count] = size;
+            expected_seed[expected_count++] = (uint8_t)i;
+        }
+        for (uint32_t k = 0; k < 2U + (i % 4U); k++) {
+            sim_complete();
+        }
+    }
+    drain();
+    for (uint32_t i = 0; i < expected_count; i++) {
+        TEST_ASSERT(wire_has(&pos, expected_size[i], expected_seed[i]));
+    }
+    TEST_ASSERT_EQ(pos, uart.wire_size);
+    TEST_ASSERT(expected_count > 40U);
+}
+
+static void test_long_payload_is_chunked(void)
+{
+    uint32_t pos = 0;
+
+    reset(100000);
+    TEST_ASSERT_EQ(send(150000, UART_TX_RELIABLE, 9), 0);
+    drain();
+    TEST_ASSERT(wire_has(&pos, 150000, 9));
+    TEST_ASSERT_EQ(uart.max_chunk, UART_TX_MAX_CHUNK);
+}
+
+static void test_failed_transfer_skips_packet(void)
+{
+    uart_tx_stats_t stats;
+    uint32_t pos = 0;
+
+    reset(100000);
+    TEST_ASSERT_EQ(send(10, UART_TX_RELIABLE, 1), 0);
+    TEST_ASSERT_EQ(send(20, UART_TX_RELIABLE, 2), 0);
+    TEST_ASSERT_EQ(send(30, UART_TX_RELIABLE, 3), 0);
+    sim_complete();                     /* header of 1 */
+    /* Line error while the payload of 1 is going out */
+    uart.data = NULL;
+    uart_tx_queue_on_error(&queue);
+    drain();
+
+    uart_tx_queue_get_stats(&queue, &stats);
+    TEST_ASSERT_EQ(stats.errors, 1U);
+    TEST_ASSERT_EQ(stats.packets_sent, 2U);
+    /* Packet 1 is cut short; 2 and 3 follow whole */
+    pos = 3U;
+    TEST_ASSERT(wire_has(&pos, 20, 2));
+    TEST_ASSERT(wire_has(&pos, 30, 3));
+
+    /* A transfer that cannot start abandons its packet */
+    uart.fail_next = 1;
+    TEST_ASSERT_EQ(send(40, UART_TX_RELIABLE, 4), 0);
+    TEST_ASSERT(uart_tx_queue_idle(&queue));
+    TEST_ASSERT_EQ(send(50, UART_TX_RELIABLE, 5), 0);
+    drain();
+    TEST_ASSERT(wire_has(&pos, 50, 5));
+    TEST_ASSERT_EQ(pos, uart.wire_size);
+
+    uart_tx_queue_get_stats(&queue, &stats);
+    TEST_ASSERT_EQ(stats.errors, 2U);
+    TEST_ASSERT_EQ(stats.packets_sent, 3U);
+}
+
+static void test_cancel_and_invalid_arguments(void)
+{
+    const uart_tx_port_t no_start = { NULL, NULL, NULL };
+    const uart_tx_port_t port = { sim_start, sim_poll, &uart };
+    uint32_t pos = 0;
+
+    reset(100000);
+    TEST_ASSERT(uart_tx_queue_init(&queue, &no_start, arena, ARENA_SIZE, 0, 0) < 0);
+    TEST_ASSERT(uart_tx_queue_init(NULL, NULL, arena, ARENA_SIZE, 0, 0) < 0);
+    TEST_ASSERT(uart_tx_queue_init(&queue, &port, arena + 1, ARENA_SIZE - 1U, 0, 0) < 0);
+    reset(100000);
+
+    TEST_ASSERT(uart_tx_queue_reserve(&queue, 1000, UART_TX_RELIABLE) != NULL);
+    TEST_ASSERT(uart_tx_queue_reserve(&queue, 10, UART_TX_RELIABLE) == NULL);
+    uart_tx_queue_cancel(&queue);
+    TEST_ASSERT(uart_tx_queue_commit(&queue, NULL, 0, NULL, 0) < 0);
+
+    uint8_t head[UART_TX_MAX_HEAD + 1] = { 0 };
+    TEST_ASSERT(uart_tx_queue_reserve(&queue, 10, UART_TX_RELIABLE) != NULL);
+    TEST_ASSERT(uart_tx_queue_commit(&queue, head, sizeof(head), NULL, 0) < 0);
+    TEST_ASSERT(uart_tx_queue_idle(&queue));
+
+    /* Nothing leaked: a packet filling the arena still fits */
+    TEST_ASSERT_EQ(send(ARENA_SIZE, UART_TX_RELIABLE, 5), 0);
+    drain();
+    TEST_ASSERT(wire_has(&pos, ARENA_SIZE, 5));
+}
+
+/* Producer time of a streamed frame against the blocking path, which held
+ * the pipeline until every byte was on the wire */
+static void test_benchmark_enqueue_vs_wire_time(void)
+{
+    const uint32_t frames = 50, size = 57600;
+    uint32_t queued = 0;
+
+    reset(100000);
+    const uint32_t t0 = perf_monitor_now();
+    for (uint32_t f = 0; f < frames; f++) {
+        queued += (send(size, UART_TX_DROPPABLE, (uint8_t)f) == 0);
+        drain();
+    }
+    const uint32_t ticks = perf_monitor_now() - t0;
+    TEST_ASSERT_EQ(queued, frames);
+
+    /* 10 bits per byte on the wire */
+    const double wire_us = (double)(size + 12U) * 10.0 * 1e6 / (double)PC_BAUD_RATE;
+    printf("    %u-byte frame: blocking send %.0f us, queued (pattern fill included) %.1f us\n",
+           (unsigned)size, wire_us, (double)ticks / frames / (double)perf_monitor_cycles_per_us());
+}
+
+int main(void)
+{
+    printf("test_uart_tx_queue\n");
+    RUN_TEST(test_sends_segments_in_order);
+    RUN_TEST(test_frames_dropped_metrics_kept);
+    RUN_TEST(test_reliable_waits_for_room);
+    RUN_TEST(test_reliable_gives_up_on_stuck_uart);
+    RUN_TEST(test_descriptors_kept_for_reliable);
+    RUN_TEST(test_arena_wraps);
+    RUN_TEST(test_long_payload_is_chunked);
+    RUN_TEST(test_failed_transfer_skips_packet);
+    RUN_TEST(test_cancel_and_invalid_arguments);
+    RUN_TEST(test_benchmark_enqueue_vs_wire_time);
+    TEST_EXIT();
+}
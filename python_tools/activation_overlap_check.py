@@ -0,0 +1,372 @@
+#!/usr/bin/env python3
+"""
+Cross-network activation memory check for STM32N6 face detection/recognition
+
+Both networks are compiled against the same internal pools (cpuRAM2,
+npuRAM3-6) and the application runs them one at a time, so their
+activations may share addresses. This tool loads the buffer maps of every
+network from converted_models/<network>_c_info.json and checks that the
+shared plan holds:
+  - inside one network, buffers that overlap in memory never overlap in time
+    (in-place outputs and views sharing a base address are allowed)
+  - no live buffer reaches into a region the linker script gives to the
+    application (e.g. NPURAM6_APP)
+  - no network keeps parameters in a writable pool where another network
+    places activations (exclusive execution does not protect those)
+  - with --mpool, every buffer lies inside the pool declared in the plan
+  - with --no-external, no live activation is placed in hyperRAM
+
+When the generated <network>.c is found in embedded/Models/, buffers no epoch
+touches any more (float intermediates of fused SW epochs) are reported as
+dead and left out of the checks; their lifetimes are trimmed to the epochs
+that still reference them.
+
+Usage:
+    python activation_overlap_check.py
+    python activation_overlap_check.py --no-external
+    python activation_overlap_check.py --mpool face_recognition=/tmp/face_recognition.mpool
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+from typing import Dict, List, Optional, Tuple
+
+ROOT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+DEFAULT_MODELS_DIR = os.path.join(ROOT_DIR, 'converted_models')
+DEFAULT_CODE_DIR = os.path.join(ROOT_DIR, 'embedded', 'Models')
+DEFAULT_LINKER = os.path.join(ROOT_DIR, 'embedded', 'STM32CubeIDE', 'STM32N657xx.ld')
+DEFAULT_NETWORKS = ['face_detection', 'face_recognition']
+
+INTERNAL_POOLS = ['cpuRAM1', 'cpuRAM2', 'npuRAM3', 'npuRAM4', 'npuRAM5', 'npuRAM6', 'flexMEM']
+EXTERNAL_POOLS = ('hyperRAM',)
+
+_MAGNITUDES = {'BYTES': 1, 'KBYTES': 1024, 'MBYTES': 1024 * 1024}
+_LINKER_UNITS = {'': 1, 'K': 1024, 'M': 1024 * 1024}
+
+_EPOCH_BODY = re.compile(
+    r'static void LL_ATON_End_EpochBlock_(\d+)\(const void \*epoch_block\)\n\{\n(.*?)\n\}\n', re.DOTALL)
+_BODY_NAME = re.compile(r'^\s*\.name = "(\w+)",$', re.MULTILINE)
+_BODY_ADDR = re.compile(r'ATON_LIB_PHYSICAL_TO_VIRTUAL_ADDR\(0x([0-9a-fA-F]+)UL(?: \+ (\d+))?\)')
+_LINKER_REGION = re.compile(r'^\s*(\w+)\s*\([rwx]+\)\s*:\s*ORIGIN\s*=\s*(0x[0-9a-fA-F]+|\d+)\s*,'
+                            r'\s*LENGTH\s*=\s*(0x[0-9a-fA-F]+|\d+)\s*([KM]?)', re.MULTILINE)
+
+
+class Buffer:
+    """One tensor of a network placed at an absolute address"""
+
+    def __init__(self, network: str, info: Dict, pool: Dict):
+        self.network = network
+        self.id = info['id']
+        self.name = info['name']
+        self.size = info.get('size_bytes', 0)
+        self.start = pool['address'] + info.get('offset_start', 0)
+        self.end = self.start + self.size
+        self.is_param = info.get('is_param', False)
+        self.writable = pool['rights'] != 'ACC_READ'
+        self.first = info.get('epochs', {}).get('start', 0)
+        self.last = info.get('epochs', {}).get('end', self.first)
+        self.live = True
+
+    def overlaps(self, other: 'Buffer') -> bool:
+        return self.start < other.end and other.start < self.end
+
+    def overlaps_in_time(self, other: 'Buffer') -> bool:
+        # An epoch may overwrite the tensor it consumes: lifetimes that only
+        # touch at a boundary epoch do not conflict
+        return self.first < other.last and other.first < self.last
+
+    def __str__(self):
+        return f'{self.network}:{self.name} [0x{self.start:08X}-0x{self.end:08X}) epochs {self.first}-{self.last}'
+
+
+# =============================================================================
+# Input parsing
+# =============================================================================
+
+def load_network(models_dir: str, code_dir: Optional[str], name: str) -> Optional[Dict]:
+    """Pools and buffers of one network, None when its c_info.json is missing"""
+    path = os.path.join(models_dir, f'{name}_c_info.json')
+    if not os.path.exists(path):
+        return None
+    with open(path, encoding='utf-8') as f:
+        info = json.load(f)
+
+    pools = {}
+    for pool in info.get('memory_pools', []):
+        pools[pool['id']] = {'name': pool['name'], 'address': int(pool['address']),
+                             'size': pool.get('size_bytes', 0), 'rights': pool.get('rights', ''),
+                             'virtual': bool(pool.get('subpools'))}
+    buffers = [Buffer(name, b, pools[b['mpool_id']]) for b in info.get('buffers', [])
+               if b.get('mpool_id') in pools and b.get('size_bytes', 0) > 0]
+
+    network = {'name': name, 'pools': pools, 'buffers': buffers, 'dead_bytes': 0}
+    code_path = os.path.join(code_dir, f'{name}.c') if code_dir else None
+    if code_path and os.path.exists(code_path):
+        with open(code_path, encoding='utf-8') as f:
+            trim_to_generated_code(network, info, f.read())
+    return network
+
+
+def trim_to_generated_code(network: Dict, info: Dict, source: str):
+    """Restrict lifetimes to the epochs that still reference each buffer
+
+    HW and EC epochs use the tensors listed in c_info.json. SW epochs are
+    taken from the generated code, where post-generation fusion may have
+    removed their float intermediates; those are matched by the tensor names
+    and base addresses left in each LL_ATON_End_EpochBlock_N body.
+    """
+    bodies = {int(m.group(1)): m.group(2) for m in _EPOCH_BODY.finditer(source)}
+    by_id = {b.id: b for b in network['buffers']}
+    refs = {b.id: [] for b in network['buffers']}
+
+    for graph in info.get('graphs', []):
+        for node in graph.get('nodes', []):
+            match = re.match(r'epoch_(\d+)$', node.get('name', ''))
+            if not match:
+                continue
+            epoch = int(match.group(1))
+            if node.get('mapping') == 'NODE_SW' and epoch in bodies:
+                body = bodies[epoch]
+                names = set(_BODY_NAME.findall(body))
+                addresses = {int(base, 16) + int(off or 0) for base, off in _BODY_ADDR.findall(body)}
+                used = [b.id for b in network['buffers']
+                        if (b.name in names or b.start in addresses) and b.first <= epoch <= b.last]
+            else:
+                used = node.get('inputs', []) + node.get('outputs', [])
+            for buffer_id in used:
+                if buffer_id in refs:
+                    refs[buffer_id].append(epoch)
+        # Network inputs and outputs are also touched by the application
+        for buffer_id in graph.get('inputs', []) + graph.get('outputs', []):
+            if buffer_id in refs and not refs[buffer_id]:
+                refs[buffer_id].append(by_id[buffer_id].first)
+
+    for buffer_id, epochs in refs.items():
+        buffer = by_id[buffer_id]
+        if buffer.is_param:
+            continue
+        if not epochs:
+            buffer.live = False
+            network['dead_bytes'] += buffer.size
+        else:
+            buffer.first, buffer.last = min(epochs), max(epochs)
+
+
+def _pool_bytes(value: Dict) -> int:
+    text = str(value.get('value', '0'))
+    number = int(text, 16) if text.lower().startswith('0x') else int(text)
+    return number * _MAGNITUDES.get(value.get('magnitude', 'BYTES'), 1)
+
+
+def load_mpool(path: str) -> Dict[str, Tuple[int, int]]:
+    """Pool name -> (start, end) declared in a memory pool file"""
+    with open(path, encoding='utf-8') as f:
+        mpool = json.load(f)
+    regions = {}
+    for pool in mpool.get('memory', {}).get('mempools', []):
+        if pool.get('mode', 'USEMODE_ABSOLUTE') != 'USEMODE_ABSOLUTE':
+            continue
+        start = _pool_bytes(pool.get('offset', {}))
+        regions[pool['name']] = (start, start + _pool_bytes(pool.get('size', {})))
+    return regions
+
+
+def load_linker_regions(path: str) -> Dict[str, Tuple[int, int]]:
+    """MEMORY regions of the application linker script"""
+    if not path or not os.path.exists(path):
+        return {}
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+    regions = {}
+    for name, origin, length, unit in _LINKER_REGION.findall(text):
+        start = int(origin, 0)
+        regions[name] = (start, start + int(length, 0) * _LINKER_UNITS[unit])
+    return regions
+
+
+# =============================================================================
+# Checks
+# =============================================================================
+
+def physical_pool(network: Dict, address: int) -> Optional[Dict]:
+    for pool in network['pools'].values():
+        if not pool['virtual'] and pool['size'] and pool['address'] <= address < pool['address'] + pool['size']:
+            return pool
+    return None
+
+
+def check_network(network: Dict) -> List[str]:
+    """Buffers of one network sharing memory while both are alive"""
+    errors = []
+    live = sorted((b for b in network['buffers'] if b.live and b.writable), key=lambda b: b.start)
+    for i, a in enumerate(live):
+        for b in live[i + 1:]:
+            if b.start >= a.end:
+                break
+            # Same base address: in-place output or view of the same tensor
+            if a.start != b.start and a.overlaps_in_time(b):
+                errors.append(f'live buffers overlap: {a} and {b}')
+    return errors
+
+
+def check_app_regions(networks: List[Dict], regions: Dict[str, Tuple[int, int]]) -> List[str]:
+    """Network buffers reaching into memory the linker gives to the application"""
+    errors = []
+    for network in networks:
+        for b in network['buffers']:
+            if not b.live or not b.writable:
+                continue
+            for name, (start, end) in regions.items():
+                if b.start < end and start < b.end:
+                    errors.append(f'{b} overlaps application region {name} [0x{start:08X}-0x{end:08X})')
+    return errors
+
+
+def check_params(networks: List[Dict]) -> List[str]:
+    """Writable parameters of one network overwritten by another network"""
+    errors = []
+    for owner in networks:
+        params = [b for b in owner['buffers'] if b.is_param and b.writable]
+        for other in networks:
+            if other is owner:
+                continue
+            for p in params:
+                for b in other['buffers']:
+                    if b.live and not b.is_param and p.overlaps(b):
+                        errors.append(f'parameter {p} is overwritten by {b}')
+    return errors
+
+
+def check_plan(network: Dict, plan: Dict[str, Tuple[int, int]]) -> List[str]:
+    """Buffers placed outside the pools declared in the memory pool file"""
+    errors = []
+    for b in network['buffers']:
+        if not b.live or b.is_param:
+            continue
+        pool = physical_pool(network, b.start)
+        name = pool['name'] if pool else None
+        start, end = plan.get(name, (0, 0))
+        last = physical_pool(network, b.end - 1)
+        if last is not None and last['name'] != name:
+            # Buffers of virtual pools may span adjacent physical pools
+            end = plan.get(last['name'], (0, 0))[1]
+        if not (start <= b.start and b.end <= end):
+            errors.append(f'{b} is outside the planned {name or "pool"} '
+                          f'[0x{start:08X}-0x{end:08X})')
+    return errors
+
+
+def check_external(network: Dict) -> List[str]:
+    errors = []
+    for b in network['buffers']:
+        pool = physical_pool(network, b.start)
+        if b.live and not b.is_param and pool and pool['name'] in EXTERNAL_POOLS:
+            errors.append(f'activation in {pool["name"]}: {b} ({b.size:,} bytes)')
+    return errors
+
+
+# =============================================================================
+# Report
+# =============================================================================
+
+def pool_usage(network: Dict) -> Dict[str, Tuple[int, int]]:
+    """Physical pool -> (lowest address, highest end) of live activations"""
+    usage = {}
+    for b in network['buffers']:
+        if not b.live or b.is_param:
+            continue
+        address = b.start
+        while address < b.end:
+            pool = physical_pool(network, address)
+            if pool is None:
+                break
+            end = min(b.end, pool['address'] + pool['size'])
+            low, high = usage.get(pool['name'], (end, address))
+            usage[pool['name']] = (min(low, address), max(high, end))
+            address = end
+    return usage
+
+
+def print_report(networks: List[Dict]):
+    usages = {n['name']: pool_usage(n) for n in networks}
+    for network in networks:
+        usage = usages[network['name']]
+        live = [b for b in network['buffers'] if b.live and not b.is_param]
+        dead = [b for b in network['buffers'] if not b.live]
+        print(f"\n{network['name']}: {len(live)} live activation buffers, {len(dead)} "
+              f"({network['dead_bytes']:,} tensor bytes) no longer referenced by the generated code")
+        print(f"  {'pool':<10} {'range':>23} {'bytes':>10}")
+        for pool in INTERNAL_POOLS + list(EXTERNAL_POOLS):
+            if pool in usage:
+                low, high = usage[pool]
+                print(f"  {pool:<10} 0x{low:08X}-0x{high:08X} {high - low:>10,}")
+
+    if len(networks) < 2:
+        return
+    print('\nshared between networks (valid only while inferences are exclusive):')
+    for pool in INTERNAL_POOLS + list(EXTERNAL_POOLS):
+        spans = [usages[n['name']][pool] for n in networks if pool in usages[n['name']]]
+        if len(spans) < 2:
+            continue
+        low = max(s[0] for s in spans)
+        high = min(s[1] for s in spans)
+        if high > low:
+            print(f"  {pool:<10} 0x{low:08X}-0x{high:08X} {high - low:>10,}")
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description='Check the shared activation memory plan of the networks')
+    parser.add_argument('--models-dir', default=DEFAULT_MODELS_DIR, help='directory holding <network>_c_info.json')
+    parser.add_argument('--code-dir', default=DEFAULT_CODE_DIR,
+                        help='directory holding the generated <network>.c ("" to use c_info.json lifetimes)')
+    parser.add_argument('--linker', default=DEFAULT_LINKER, help='application linker script ("" to skip)')
+    parser.add_argument('--network', action='append', help='network name (repeatable, default: all)')
+    parser.add_argument('--mpool', action='append', default=[], metavar='NETWORK=FILE',
+                        help='memory pool file the network must fit in (repeatable)')
+    parser.add_argument('--no-external', action='store_true', help='fail when an activation is in hyperRAM')
+    args = parser.parse_args(argv)
+
+    networks = []
+    for name in args.network or DEFAULT_NETWORKS:
+        network = load_network(args.models_dir, args.code_dir or None, name)
+        if network is None:
+            print(f'{name}: c_info.json not found in {args.models_dir}')
+            return 2
+        networks.append(network)
+
+    plans = {}
+    for entry in args.mpool:
+        name, _, path = entry.partition('=')
+        plans[name] = load_mpool(path)
+
+    # Application regions are those of the linker script inside a network pool
+    app_regions = {}
+    for name, (start, end) in load_linker_regions(args.linker).items():
+        if any(physical_pool(n, start) or physical_pool(n, end - 1) for n in networks):
+            app_regions[name] = (start, end)
+
+    errors = []
+    for network in networks:
+        errors.extend(check_network(network))
+        if network['name'] in plans:
+            errors.extend(check_plan(network, plans[network['name']]))
+        if args.no_external:
+            errors.extend(check_external(network))
+    errors.extend(check_app_regions(networks, app_regions))
+    errors.extend(check_params(networks))
+
+    print_report(networks)
+    if errors:
+        print(f'\n{len(errors)} ERRORS:')
+        for line in errors:
+            print(f'  {line}')
+        return 1
+    print('\nno overlap between live buffers')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""
+Per-epoch NPU/SW profile report for STM32N6 face detection/recognition
+
+Reads the epoch block tables the firmware exports when built with
+`make EPOCH_PROFILE=1` (robust protocol message 0x0B), joins them with the
+ST Edge AI generate report and c_info.json of each network and prints the
+epoch blocks ranked by measured time.
+
+With `make NPU_STALLS=1` the firmware also exports sampled stream engine
+stall reports (message 0x0C); they add per-block stall columns and a
+per-memory-pool table.
+
+Usage:
+    python epoch_profile_report.py --capture uart.bin
+    python epoch_profile_report.py --port /dev/ttyACM0 --seconds 10
+"""
+
+import argparse
+import os
+import struct
+import sys
+from collections import Counter
+from typing import Dict, List, Optional, Tuple
+
+from model_analysis import DEFAULT_MODELS_DIR, load_c_info_epochs, load_report_epochs
+
+# Robust protocol framing (see embedded/Src/enhanced_pc_stream.c)
+SOF_BYTE = 0xAA
+FRAME_HEADER_SIZE = 4       # SOF(1) + PayloadSize(2) + XOR checksum(1)
+MSG_HEADER_SIZE = 3         # MessageType(1) + SequenceId(2)
+CRC_SIZE = 4
+MSG_EPOCH_PROFILE = 0x0B
+MSG_STALL_REPORT = 0x0C
+
+# Table layout (see embedded/Inc/epoch_profiler.h)
+WIRE_VERSION = 1
+WIRE_HEADER_FORMAT = '<BBHII'
+WIRE_HEADER_SIZE = 12
+WIRE_BLOCK_FORMAT = '<hhHI'
+WIRE_BLOCK_SIZE = 10
+
+# Stall report layout (see embedded/Inc/npu_stall_monitor.h)
+STALL_WIRE_VERSION = 1
+STALL_HEADER_FORMAT = '<BBBBIH'
+STALL_HEADER_SIZE = 10
+STALL_POOL_FORMAT = '<BIIII'
+STALL_POOL_SIZE = 17
+STALL_BLOCK_FORMAT = '<HHHB'
+STALL_BLOCK_SIZE = 7
+POOL_NAMES = ['npuRAM', 'cpuRAM', 'hyperRAM', 'octoFlash', 'other']
+
+# epoch_profiler_net_t -> generated model name
+NETWORKS = {0: 'face_detection', 1: 'face_recognition'}
+
+# EpochBlock_Flags_t bits
+FLAG_BLOB = 1 << 2
+FLAG_PURE_HW = 1 << 4
+FLAG_PURE_SW = 1 << 5
+FLAG_HYBRID = 1 << 6
+
+
+# =============================================================================
+# Capture decoding
+# =============================================================================
+
+def iter_messages(data: bytes):
+    """Yield (msg_type, payload) for every well-formed frame in a raw capture
+
+    The payload CRC is not checked; the header checksum and the SOF of the
+    following frame are enough to resynchronize on a clean capture.
+    """
+    pos = 0
+    while pos + FRAME_HEADER_SIZE <= len(data):
+        if data[pos] != SOF_BYTE:
+            pos += 1
+            continue
+        size = data[pos + 1] | (data[pos + 2] << 8)
+        if data[pos + 3] != (data[pos] ^ data[pos + 1] ^ data[pos + 2]) or size < MSG_HEADER_SIZE:
+            pos += 1
+            continue
+        end = pos + FRAME_HEADER_SIZE + size + CRC_SIZE
+        if end > len(data):
+            break
+        body = data[pos + FRAME_HEADER_SIZE:pos + FRAME_HEADER_SIZE + size]
+        yield body[0], body[MSG_HEADER_SIZE:]
+        pos = end
+
+
+def parse_epoch_profile(payload: bytes) -> Optional[Dict]:
+    """Parse one epoch_profiler_serialize() table"""
+    if len(payload) < WIRE_HEADER_SIZE:
+        return None
+    version, network, block_count, inferences, cycles_per_us = \
+        struct.unpack(WIRE_HEADER_FORMAT, payload[:WIRE_HEADER_SIZE])
+    if version != WIRE_VERSION or len(payload) < WIRE_HEADER_SIZE + block_count * WIRE_BLOCK_SIZE:
+        return None
+
+    blocks = []
+    for i in range(block_count):
+        offset = WIRE_HEADER_SIZE + i * WIRE_BLOCK_SIZE
+        first, last, flags, cycles = struct.unpack(WIRE_BLOCK_FORMAT, payload[offset:offset + WIRE_BLOCK_SIZE])
+        blocks.append({'index': i, 'first': first, 'last': last, 'flags': flags, 'cycles': cycles})
+
+    return {'network': network, 'inferences': inferences,
+            'cycles_per_us': max(cycles_per_us, 1), 'blocks': blocks}
+
+
+def parse_stall_report(payload: bytes) -> Optional[Dict]:
+    """Parse one npu_stall_monitor_serialize() report"""
+    if len(payload) < STALL_HEADER_SIZE:
+        return None
+    version, network, pool_count, period_ms, sample_count, block_count = \
+        struct.unpack(STALL_HEADER_FORMAT, payload[:STALL_HEADER_SIZE])
+    expected = STALL_HEADER_SIZE + pool_count * STALL_POOL_SIZE + block_count * STALL_BLOCK_SIZE
+    if version != STALL_WIRE_VERSION or len(payload) < expected:
+        return None
+
+    pools = {}
+    offset = STALL_HEADER_SIZE
+    for _ in range(pool_count):
+        pool, read_running, read_stalled, write_running, write_stalled = \
+            struct.unpack(STALL_POOL_FORMAT, payload[offset:offset + STALL_POOL_SIZE])
+        name = POOL_NAMES[pool] if pool < len(POOL_NAMES) else f'pool_{pool}'
+        pools[name] = {'read_running': read_running, 'read_stalled': read_stalled,
+                       'write_running': write_running, 'write_stalled': write_stalled}
+        offset += STALL_POOL_SIZE
+
+    blocks = []
+    for _ in range(block_count):
+        samples, read_stalled, write_stalled, mask = \
+            struct.unpack(STALL_BLOCK_FORMAT, payload[offset:offset + STALL_BLOCK_SIZE])
+        names = [n for i, n in enumerate(POOL_NAMES) if mask & (1 << i)]
+        blocks.append({'samples': samples, 'read_stalled': read_stalled,
+                       'write_stalled': write_stalled, 'pools': names})
+        offset += STALL_BLOCK_SIZE
+
+    return {'network': network, 'period_ms': period_ms, 'samples': sample_count,
+            'pools': pools, 'blocks': blocks}
+
+
+def latest_profiles(data: bytes) -> Tuple[Dict[int, Dict], Dict[int, Dict]]:
+    """Keep the last epoch table and stall report received for each network"""
+    profiles = {}
+    stalls = {}
+    for msg_type, payload in iter_messages(data):
+        if msg_type == MSG_EPOCH_PROFILE:
+            profile = parse_epoch_profile(payload)
+            if profile is not None:
+                profiles[profile['network']] = profile
+        elif msg_type == MSG_STALL_REPORT:
+            report = parse_stall_report(payload)
+            if report is not None:
+                stalls[report['network']] = report
+    return profiles, stalls
+
+
+def read_port(port: str, baudrate: int, seconds: float) -> bytes:
+    """Record raw bytes from a serial port"""
+    try:
+        import serial
+    except ImportError:
+        sys.exit('pyserial is required for --port (pip install pyserial)')
+
+    import time
+    data = bytearray()
+    with serial.Serial(port, baudrate, timeout=0.1) as ser:
+        deadline = time.time() + seconds
+        while time.time() < deadline:
+            data += ser.read(4096)
+    return bytes(data)
+
+
+# =============================================================================
+# Generated model information
+# =============================================================================
+
+def load_model(models_dir: str, name: str) -> Tuple[Dict, Dict]:
+    """Load report and c_info epoch tables, empty when the file is missing"""
+    report_path = os.path.join(models_dir, f'{name}_generate_report.txt')
+    c_info_path = os.path.join(models_dir, f'{name}_c_info.json')
+    report = load_report_epochs(report_path) if os.path.exists(report_path) else {}
+    c_info = load_c_info_epochs(c_info_path) if os.path.exists(c_info_path) else {}
+    return report, c_info
+
+
+def describe_operations(kinds: List[str]) -> str:
+    """Compact 'Conv x12, Add x3' summary of the operators in a block"""
+    counts = Counter(kinds)
+    parts = [k if n == 1 else f'{k} x{n}' for k, n in counts.most_common(3)]
+    if len(counts) > 3:
+        parts.append('...')
+    return ', '.join(parts)
+
+
+def kind_from_flags(flags: int) -> str:
+    if flags & FLAG_BLOB:
+        return 'EC'
+    if flags & FLAG_PURE_SW:
+        return 'SW'
+    if flags & FLAG_HYBRID:
+        return 'HYB'
+    return 'HW'
+
+
+def describe_block(block: Dict, report: Dict, c_info: Dict) -> Tuple[str, str, str]:
+    """(epoch id, kind, operation) for one measured block"""
+    first, last = block['first'], block['last']
+    if first < 0:
+        return f"#{block['index']}", kind_from_flags(block['flags']), '(build with EPOCH_PROFILE=1)'
+
+    epoch_id = str(first) if last <= first else f'{first}-{last}'
+    kind = report.get(first, ('??', ''))[0]
+    if kind == '??':
+        kind = c_info.get(first, {}).get('mapping') or kind_from_flags(block['flags'])
+
+    sw_ops = [report[e][1] for e in range(first, max(first, last) + 1) if e in report and report[e][1]]
+    kinds = []
+    for e in range(first, max(first, last) + 1):
+        kinds.extend(c_info.get(e, {}).get('operations', []))
+    return epoch_id, kind, describe_operations(sw_ops or kinds)
+
+
+# =============================================================================
+# Report
+# =============================================================================
+
+def stall_columns(stall: Optional[Dict], index: int) -> str:
+    """'rd% wr% pools' for one block, blank without a stall report"""
+    if stall is None or index >= len(stall['blocks']) or stall['blocks'][index]['samples'] == 0:
+        return f"{'':>5} {'':>5} {'':<26}"
+    block = stall['blocks'][index]
+    return (f"{100.0 * block['read_stalled'] / block['samples']:>4.0f}% "
+            f"{100.0 * block['write_stalled'] / block['samples']:>4.0f}% "
+            f"{'+'.join(block['pools']):<26}")
+
+
+def print_stall_pools(stall: Dict):
+    """Per-pool share of engine samples and stalled samples"""
+    print(f"stream engine samples: {stall['samples']} at {stall['period_ms']} ms "
+          "(read stall = consumer backpressure, write stall = memory not accepting)")
+    print(f"{'pool':<10} {'reads':>8} {'stalled':>8} {'writes':>8} {'stalled':>8}")
+    for name, pool in stall['pools'].items():
+        if pool['read_running'] == 0 and pool['write_running'] == 0:
+            continue
+        read_pct = 100.0 * pool['read_stalled'] / max(pool['read_running'], 1)
+        write_pct = 100.0 * pool['write_stalled'] / max(pool['write_running'], 1)
+        print(f"{name:<10} {pool['read_running']:>8} {read_pct:>7.1f}% "
+              f"{pool['write_running']:>8} {write_pct:>7.1f}%")
+
+
+def print_profile(profile: Dict, models_dir: str, top: int, stall: Optional[Dict] = None):
+    name = NETWORKS.get(profile['network'], f"network_{profile['network']}")
+    report, c_info = load_model(models_dir, name)
+
+    blocks = profile['blocks']
+    total = sum(b['cycles'] for b in blocks) or 1
+    per_us = profile['cycles_per_us']
+
+    print(f"\n{name}: {len(blocks)} epoch blocks, {profile['inferences']} inferences, "
+          f"{total / per_us / 1000.0:.2f} ms per inference")
+    stall_header = f"{'rd%':>5} {'wr%':>5} {'pools':<26} " if stall else ''
+    print(f"{'rank':>4}  {'epoch':<9} {'kind':<4} {'us':>9} {'%':>6}  {stall_header}operation")
+
+    by_kind = Counter()
+    ranked = sorted(blocks, key=lambda b: b['cycles'], reverse=True)
+    for rank, block in enumerate(ranked, 1):
+        epoch_id, kind, operation = describe_block(block, report, c_info)
+        by_kind[kind] += block['cycles']
+        if top and rank > top:
+            continue
+        columns = stall_columns(stall, block['index']) + ' ' if stall else ''
+        print(f"{rank:>4}  {epoch_id:<9} {kind:<4} {block['cycles'] / per_us:>9.1f} "
+              f"{100.0 * block['cycles'] / total:>5.1f}%  {columns}{operation}")
+
+    print('time by kind: ' + ', '.join(f'{k} {100.0 * c / total:.1f}%' for k, c in by_kind.most_common()))
+    if stall:
+        print_stall_pools(stall)
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description='Rank NPU/SW epoch blocks by measured time')
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--capture', help='raw UART capture file')
+    source.add_argument('--port', help='serial port to record from')
+    parser.add_argument('--baudrate', type=int, default=921600 * 8)
+    parser.add_argument('--seconds', type=float, default=5.0, help='recording time with --port')
+    parser.add_argument('--models-dir', default=DEFAULT_MODELS_DIR,
+                        help='directory holding <network>_generate_report.txt and <network>_c_info.json')
+    parser.add_argument('--top', type=int, default=20, help='rows per network (0 for all)')
+    args = parser.parse_args(argv)
+
+    if args.capture:
+        with open(args.capture, 'rb') as f:
+            data = f.read()
+    else:
+        data = read_port(args.port, args.baudrate, args.seconds)
+
+    profiles, stalls = latest_profiles(data)
+    if not profiles:
+        print('No epoch profile messages found (is the firmware built with EPOCH_PROFILE=1?)')
+        return 1
+
+    for network in sorted(profiles):
+        print_profile(profiles[network], args.models_dir, args.top, stalls.get(network))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""
+Generated-model analysis for STM32N6 face detection/recognition
+
+Parses the ST Edge AI outputs checked in under converted_models/
+(<network>_generate_report.txt and <network>_c_info.json) and prints, per
+network:
+  - SW / HW / EC epoch counts grouped by operator type
+  - MACs executed by SW epochs on the Cortex-M55
+  - weight and activation bytes per memory pool
+
+With --baseline the numbers are compared against a stored JSON baseline and
+the exit code is 1 when SW epochs, SW MACs or external memory (octoFlash,
+hyperRAM) bytes grow, so a model conversion can be gated offline.
+
+Usage:
+    python model_analysis.py
+    python model_analysis.py --baseline ../converted_models/model_baseline.json
+    python model_analysis.py --write-baseline ../converted_models/model_baseline.json
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+from collections import Counter, defaultdict
+from typing import Dict, List, Optional, Tuple
+
+DEFAULT_MODELS_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'converted_models')
+DEFAULT_NETWORKS = ['face_detection', 'face_recognition']
+
+# Pools reported in this order; others (virtual pools) are skipped
+POOL_ORDER = ['flexMEM', 'cpuRAM1', 'cpuRAM2', 'npuRAM3', 'npuRAM4', 'npuRAM5', 'npuRAM6',
+              'octoFlash', 'hyperRAM']
+EXTERNAL_POOLS = ('octoFlash', 'hyperRAM')
+
+# Per output element cost of element-wise SW kernels, as counted by the
+# generate report (e.g. a 56x56x64 DequantizeLinear is 401,408 macc)
+SW_ELEMENT_COST = {'QuantizeLinear': 2, 'DequantizeLinear': 2, 'PRelu': 2}
+SW_WEIGHTED_OPS = ('Conv', 'Gemm', 'MatMul')
+
+_SIZE_UNITS = {'B': 1, 'kB': 1024, 'MB': 1024 * 1024, 'GB': 1024 * 1024 * 1024}
+
+
+# =============================================================================
+# Generated model parsing
+# =============================================================================
+
+_REPORT_EPOCH = re.compile(r'^epoch (\d+)\s+(EC|HW|-SW-|\?\?)\s*(?:\(\s*(.*?)\s*\))?\s*$')
+_REPORT_MACC = re.compile(r'^model: macc=([\d,]+)')
+_REPORT_POOL = re.compile(r'^\s*(\w+)\s+\[0x[0-9A-Fa-f]+ - 0x[0-9A-Fa-f]+\]:.*?'
+                          r'weights:\s+([\d.]+)\s+(\w+)\s+\(.*?activations:\s+([\d.]+)\s+(\w+)')
+
+
+def load_report_epochs(path: str) -> Dict[int, Tuple[str, str]]:
+    """Epoch -> (HW/SW/EC kind, SW operation) from *_generate_report.txt"""
+    epochs = {}
+    with open(path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            match = _REPORT_EPOCH.match(line.rstrip())
+            if match:
+                kind = match.group(2).strip('-')
+                epochs[int(match.group(1))] = (kind, match.group(3) or '')
+    return epochs
+
+
+def load_c_info_epochs(path: str) -> Dict[int, Dict]:
+    """Epoch -> {mapping, operations, macc} from *_c_info.json"""
+    with open(path, encoding='utf-8') as f:
+        info = json.load(f)
+
+    epochs = {}
+    for graph in info.get('graphs', []):
+        for node in graph.get('nodes', []):
+            match = re.match(r'epoch_(\d+)$', node.get('name', ''))
+            if not match:
+                continue
+            kinds = []
+            for sub in node.get('subgraph_nodes', []):
+                kind = sub.get('description', '').replace('Node kind=', '')
+                if kind and kind != 'Param':
+                    kinds.append(kind)
+            macc = node.get('macc', 0) + sum(s.get('macc', 0) for s in node.get('subgraph_nodes', []))
+            epochs[int(match.group(1))] = {'mapping': node.get('mapping', '').replace('NODE_', ''),
+                                           'operations': kinds, 'macc': macc}
+    return epochs
+
+
+def load_report_summary(path: str) -> Dict:
+    """Total macc and per-pool (weights, activations) bytes from the report
+
+    The report rounds sizes to kB/MB; callers use it only to split the exact
+    pool usage of c_info.json into weights and activations.
+    """
+    summary = {'macc': 0, 'pools': {}}
+    with open(path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            match = _REPORT_MACC.match(line)
+            if match:
+                summary['macc'] = int(match.group(1).replace(',', ''))
+                continue
+            match = _REPORT_POOL.match(line)
+            if match:
+                weights = float(match.group(2)) * _SIZE_UNITS.get(match.group(3), 1)
+                activations = float(match.group(4)) * _SIZE_UNITS.get(match.group(5), 1)
+                summary['pools'][match.group(1)] = (int(weights), int(activations))
+    return summary
+
+
+def _elements(shape: List[int]) -> int:
+    count = 1
+    for dim in shape:
+        count *= max(dim, 1)
+    return count
+
+
+def estimate_sw_macc(kind: str, inputs: List[Dict], outputs: List[Dict]) -> int:
+    """MACs of one SW node estimated from its tensors
+
+    The compiler leaves macc at 0 for SW epochs. Weighted ops cost one MAC per
+    weight per output pixel; element-wise ops use the report's per-element cost.
+    """
+    out_elements = sum(_elements(b.get('shape', [])) for b in outputs)
+    if kind in SW_WEIGHTED_OPS:
+        weights = [b for b in inputs if b.get('is_param') and len(b.get('shape', [])) > 1]
+        if weights:
+            shape = weights[0]['shape']
+            return out_elements * (_elements(shape) // max(shape[0], 1))
+    return out_elements * SW_ELEMENT_COST.get(kind, 1)
+
+
+def analyze_c_info(path: str, report: Dict) -> Dict:
+    """Operator breakdown, SW MACs and pool usage of one network"""
+    with open(path, encoding='utf-8') as f:
+        info = json.load(f)
+    buffers = {b['id']: b for b in info.get('buffers', [])}
+
+    operators = defaultdict(Counter)
+    epochs = Counter()
+    sw_macc = 0
+    sw_macc_by_op = Counter()
+    for graph in info.get('graphs', []):
+        for node in graph.get('nodes', []):
+            if not re.match(r'epoch_(\d+)$', node.get('name', '')):
+                continue
+            mapping = node.get('mapping', '').replace('NODE_', '')
+            subs = [s for s in node.get('subgraph_nodes', [])
+                    if s.get('description', '').replace('Node kind=', '') not in ('', 'Param', 'Return')]
+            if not subs:
+                continue
+            epochs[mapping] += 1
+            for sub in subs:
+                kind = sub['description'].replace('Node kind=', '')
+                operators[kind][mapping] += 1
+                if mapping.startswith('SW'):
+                    macc = sub.get('macc', 0) or estimate_sw_macc(
+                        kind, [buffers[i] for i in sub.get('inputs', []) if i in buffers],
+                        [buffers[i] for i in sub.get('outputs', []) if i in buffers])
+                    sw_macc += macc
+                    sw_macc_by_op[kind] += macc
+
+    pools = {}
+    for pool in info.get('memory_pools', []):
+        name = pool.get('name', '')
+        if name not in POOL_ORDER:
+            continue
+        used = pool.get('used_size_bytes', 0)
+        weights, activations = report['pools'].get(name, (0, used))
+        if activations == 0:
+            weights = used
+        elif weights == 0:
+            activations = used
+        pools[name] = {'weights': weights, 'activations': activations, 'size': pool.get('size_bytes', 0)}
+
+    return {'epochs': dict(epochs), 'operators': {k: dict(v) for k, v in operators.items()},
+            'sw_macc': sw_macc, 'sw_macc_by_op': dict(sw_macc_by_op), 'macc': report['macc'],
+            'pools': pools}
+
+
+def analyze_network(models_dir: str, name: str) -> Optional[Dict]:
+    """Analysis of one network, None when its files are missing"""
+    report_path = os.path.join(models_dir, f'{name}_generate_report.txt')
+    c_info_path = os.path.join(models_dir, f'{name}_c_info.json')
+    if not os.path.exists(report_path) or not os.path.exists(c_info_path):
+        return None
+    return analyze_c_info(c_info_path, load_report_summary(report_path))
+
+
+# =============================================================================
+# Baseline
+# =============================================================================
+
+def external_bytes(analysis: Dict) -> int:
+    return sum(p['weights'] + p['activations'] for n, p in analysis['pools'].items() if n in EXTERNAL_POOLS)
+
+
+def sw_epochs(analysis: Dict) -> int:
+    return sum(n for k, n in analysis['epochs'].items() if k.startswith('SW'))
+
+
+def baseline_entry(analysis: Dict) -> Dict:
+    return {'sw_epochs': sw_epochs(analysis),
+            'sw_macc': analysis['sw_macc'],
+            'epochs': analysis['epochs'],
+            'pools': {n: {'weights': p['weights'], 'activations': p['activations']}
+                      for n, p in analysis['pools'].items()}}
+
+
+def compare_baseline(name: str, analysis: Dict, baseline: Dict) -> List[str]:
+    """Regressions of one network against its baseline entry"""
+    regressions = []
+    current = baseline_entry(analysis)
+    for key in ('sw_epochs', 'sw_macc'):
+        if current[key] > baseline.get(key, current[key]):
+            regressions.append(f'{name}: {key} grew {baseline[key]:,} -> {current[key]:,}')
+
+    for pool in EXTERNAL_POOLS:
+        before = baseline.get('pools', {}).get(pool, {})
+        after = current['pools'].get(pool, {})
+        for field in ('weights', 'activations'):
+            if after.get(field, 0) > before.get(field, 0):
+                regressions.append(f'{name}: {pool} {field} grew '
+                                   f'{before.get(field, 0):,} -> {after.get(field, 0):,} bytes')
+    return regressions
+
+
+# =============================================================================
+# Report
+# =============================================================================
+
+def print_analysis(name: str, analysis: Dict, baseline: Optional[Dict]):
+    epochs = analysis['epochs']
+    print(f"\n{name}: {sum(epochs.values())} epochs "
+          f"({', '.join(f'{k} {n}' for k, n in sorted(epochs.items()))})")
+
+    mappings = sorted({m for ops in analysis['operators'].values() for m in ops})
+    print(f"  {'operator':<18}" + ''.join(f'{m:>7}' for m in mappings) + f"{'SW macc':>12}")
+    for kind, counts in sorted(analysis['operators'].items(), key=lambda kv: -sum(kv[1].values())):
+        row = ''.join(f'{counts.get(m, 0) or "":>7}' for m in mappings)
+        sw = analysis['sw_macc_by_op'].get(kind)
+        print(f"  {kind:<18}{row}{(f'{sw:,}' if sw else ''):>12}")
+
+    total = max(analysis['macc'], 1)
+    print(f"  SW macc: {analysis['sw_macc']:,} of {analysis['macc']:,} "
+          f"({100.0 * analysis['sw_macc'] / total:.2f}%)")
+
+    print(f"  {'pool':<10} {'weights':>12} {'activations':>12} {'size':>12}")
+    for pool in POOL_ORDER:
+        stats = analysis['pools'].get(pool)
+        if stats is None or stats['size'] == 0:
+            continue
+        print(f"  {pool:<10} {stats['weights']:>12,} {stats['activations']:>12,} {stats['size']:>12,}")
+
+    if baseline is not None:
+        before = baseline.get('sw_epochs', 0)
+        ext_before = sum(p.get('weights', 0) + p.get('activations', 0)
+                         for n, p in baseline.get('pools', {}).items() if n in EXTERNAL_POOLS)
+        print(f"  vs baseline: SW epochs {sw_epochs(analysis) - before:+d}, "
+              f"SW macc {analysis['sw_macc'] - baseline.get('sw_macc', 0):+,}, "
+              f"external bytes {external_bytes(analysis) - ext_before:+,}")
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description='Summarize SW/HW epochs and memory placement of generated models')
+    parser.add_argument('--models-dir', default=DEFAULT_MODELS_DIR,
+                        help='directory holding <network>_generate_report.txt and <network>_c_info.json')
+    parser.add_argument('--network', action='append', help='network name (repeatable, default: all)')
+    parser.add_argument('--baseline', help='fail when SW epochs or external memory grow against this file')
+    parser.add_argument('--write-baseline', help='store the current numbers as a baseline')
+    args = parser.parse_args(argv)
+
+    baseline = {}
+    if args.baseline:
+        with open(args.baseline, encoding='utf-8') as f:
+            baseline = json.load(f)
+
+    results = {}
+    for name in args.network or DEFAULT_NETWORKS:
+        analysis = analyze_network(args.models_dir, name)
+        if analysis is None:
+            print(f'{name}: generate report or c_info.json not found in {args.models_dir}')
+            return 2
+        results[name] = analysis
+        print_analysis(name, analysis, baseline.get(name) if args.baseline else None)
+
+    if args.write_baseline:
+        with open(args.write_baseline, 'w', encoding='utf-8') as f:
+            json.dump({n: baseline_entry(a) for n, a in results.items()}, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print(f'\nbaseline written to {args.write_baseline}')
+
+    if args.baseline:
+        regressions = []
+        for name, analysis in results.items():
+            if name in baseline:
+                regressions.extend(compare_baseline(name, analysis, baseline[name]))
+            else:
+                print(f'{name}: not in baseline, skipped')
+        if regressions:
+            print('\nREGRESSIONS:')
+            for line in regressions:
+                print(f'  {line}')
+            return 1
+        print('\nno regression against baseline')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
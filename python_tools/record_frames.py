@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""
+Record streamed frames for the frame codec benchmark
+
+Saves every FRAME_DATA message of a UART capture or a live port as one file
+holding the frame header (12 bytes, flags cleared) and the uncoded pixels,
+the input of the host benchmark:
+
+    python record_frames.py --port /dev/ttyACM0 --seconds 10 --out frames
+    make -C ../embedded build_host/Tests/test_frame_codec
+    ../embedded/build_host/Tests/test_frame_codec frames/*.bin
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+from robust_protocol import FrameDataParser, MessageType, RobustProtocolParser
+
+
+def read_port(port: str, baudrate: int, seconds: float) -> bytes:
+    """Record raw bytes from a serial port"""
+    try:
+        import serial
+    except ImportError:
+        sys.exit('pyserial is required for --port (pip install pyserial)')
+
+    import time
+    data = bytearray()
+    with serial.Serial(port, baudrate, timeout=0.1) as ser:
+        deadline = time.time() + seconds
+        while time.time() < deadline:
+            data += ser.read(4096)
+    return bytes(data)
+
+
+def save_frames(data: bytes, out_dir: str) -> int:
+    """Write the frames found in data, returning how many were saved"""
+    messages = []
+    parser = RobustProtocolParser()
+    parser.register_handler(MessageType.FRAME_DATA, messages.append)
+    # In reads of the serial reader's size: the parser buffer is a bounded ring
+    for start in range(0, len(data), 65536):
+        parser.add_data(data[start:start + 65536])
+        while parser.process_messages():
+            pass
+
+    os.makedirs(out_dir, exist_ok=True)
+    saved = 0
+    for message in messages:
+        payload = message.payload
+        if len(payload) < 12:
+            continue
+        tag = payload[:3].decode('ascii', errors='replace').rstrip('\x00')
+        width, height = struct.unpack('<II', payload[4:12])
+        pixels = FrameDataParser.frame_pixels(payload, width, height)
+        if pixels is None:
+            continue
+
+        path = os.path.join(out_dir, f'{saved:04d}_{tag}_{width}x{height}.bin')
+        with open(path, 'wb') as f:
+            f.write(payload[:3] + b'\x00' + payload[4:12])
+            f.write(bytes(pixels))
+        saved += 1
+    return saved
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description='Save streamed frames for the codec benchmark')
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument('--capture', help='raw UART capture file')
+    source.add_argument('--port', help='serial port to record from')
+    parser.add_argument('--baudrate', type=int, default=921600 * 8)
+    parser.add_argument('--seconds', type=float, default=5.0, help='recording time with --port')
+    parser.add_argument('--out', default='frames', help='directory for the frame files')
+    args = parser.parse_args(argv)
+
+    if args.capture:
+        with open(args.capture, 'rb') as f:
+            data = f.read()
+    else:
+        data = read_port(args.port, args.baudrate, args.seconds)
+
+    saved = save_frames(data, args.out)
+    print(f'{saved} frames saved to {args.out}')
+    return 0 if saved else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
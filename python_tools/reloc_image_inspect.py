@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+"""
+Relocatable network image inspector for the STM32N6 model slots
+
+With RELOC_MODELS=1 the firmware installs the detector and the recognizer
+from relocatable images (ll_aton_reloc_install) written to the octoFlash
+slots listed in stm32_tools_config.json. This tool reads such an image on
+the host and applies the same checks as the firmware (model_image.c) before
+anything is flashed:
+  - header magic, section bounds, runtime context and memory pool descriptors
+  - runtime binary version (8.0), Cortex-M55 CPUID, hard-float ABI and the
+    secure/debug-info/async build options of the firmware
+  - LL_ATON runtime version against ll_aton_version.h
+  - image size against its slot, exec RAM (data/got/bss) and external RAM
+    against what the firmware reserves per network
+It also reports the weights CRC stored in the image against the weights
+actually present, and with --check-slots verifies that the slot table of
+the configuration and of app_neural_network.c agree and do not overlap.
+
+Usage:
+    python reloc_image_inspect.py face_detection_rel.bin --slot centerface-128
+    python reloc_image_inspect.py image.bin --slot-size 8M --dbg-info
+    python reloc_image_inspect.py --check-slots
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+from typing import Dict, List, Optional, Tuple
+
+ROOT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+DEFAULT_CONFIG = os.path.join(ROOT_DIR, 'stm32_tools_config.json')
+DEFAULT_VERSION_H = os.path.join(ROOT_DIR, 'embedded', 'Middlewares', 'AI_Runtime', 'Npu', 'll_aton',
+                                 'll_aton_version.h')
+DEFAULT_APP_SOURCE = os.path.join(ROOT_DIR, 'embedded', 'Src', 'app_neural_network.c')
+
+# ============================================================================
+# Image layout (ll_aton_reloc_network.c)
+# ============================================================================
+
+MAGIC = 0x4E49424E
+HEADER_FIELDS = ['magic', 'flags',
+                 'data_start', 'data_end', 'data_data', 'bss_start', 'bss_end', 'got_start', 'got_end',
+                 'rel_start', 'rel_end', 'params_start', 'params_offset',
+                 'ec_network_init', 'ec_inference_init', 'input_setter', 'input_getter', 'output_setter',
+                 'output_getter', 'get_epoch_items', 'get_output_buffers', 'get_input_buffers',
+                 'get_internal_buffers', 'ctx']
+CTX_FIELDS = ['state', 'file_addr', 'ram_addr', 'rom_addr', 'cbs', 'c_name', 'acts_sz', 'params_sz',
+              'ext_ram_sz', 'rt_version_desc', 'rt_version', 'rt_version_extra', 'params_bin_sz',
+              'params_bin_crc32', 'll_instance', 'itf_network']
+HEADER_SIZE = 4 * len(HEADER_FIELDS)
+CTX_SIZE = 4 * len(CTX_FIELDS)
+POOL_DESC_SIZE = 20
+MAX_POOLS = 10
+
+RT_MAJOR, RT_MINOR = 8, 0
+CPUID_CORTEX_M55 = 0xD22
+FPABI_HARD = 2
+EXTRA_SECURE, EXTRA_DBG_INFO, EXTRA_ASYNC = 1, 2, 4
+
+# Firmware budgets (app_neural_network.c, NN_RELOC_xxx)
+EXEC_RAM_SIZE = 64 * 1024
+EXT_RAM_SIZE = 8 * 1024 * 1024
+
+POOL_TYPES = {1: 'RELOC', 2: 'COPY', 3: 'RESET'}
+POOL_DTYPES = {1: 'PARAM', 2: 'ACTIV', 3: 'MIXED'}
+
+_SIZE = re.compile(r'^(\d+|0x[0-9a-fA-F]+)([KM]?)$')
+_VERSION = re.compile(r'#define LL_ATON_VERSION_(MAJOR|MINOR|MICRO) \((\d+)\)')
+_APP_SLOT = re.compile(r'\{\s*NN_MODEL_(\w+),\s*"([\w-]+)",\s*(0x[0-9a-fA-F]+)UL,\s*(0x[0-9a-fA-F]+)UL\s*\}')
+
+
+def offset(value: int) -> int:
+    return value & 0x0FFFFFFF
+
+
+def round_up8(value: int) -> int:
+    return (value + 7) & ~7
+
+
+def parse_size(text: str) -> int:
+    match = _SIZE.match(text.strip())
+    if not match:
+        raise argparse.ArgumentTypeError(f'invalid size: {text}')
+    return int(match.group(1), 0) * {'': 1, 'K': 1024, 'M': 1024 * 1024}[match.group(2)]
+
+
+def c_string(data: bytes, start: int) -> str:
+    if start >= len(data):
+        return '?'
+    end = data.find(b'\0', start)
+    return data[start:end if end >= 0 else len(data)].decode('ascii', 'replace')
+
+
+# ============================================================================
+# Parsing
+# ============================================================================
+
+def parse_image(data: bytes) -> Tuple[Optional[Dict], List[str]]:
+    """Header information of an image, and the layout errors found"""
+    if len(data) < HEADER_SIZE:
+        return None, [f'{len(data)} bytes, smaller than the {HEADER_SIZE}-byte header']
+    hdr = dict(zip(HEADER_FIELDS, struct.unpack_from(f'<{len(HEADER_FIELDS)}I', data, 0)))
+    if hdr['magic'] != MAGIC:
+        return None, [f"magic 0x{hdr['magic']:08X}, expected 0x{MAGIC:08X}"]
+
+    errors = []
+    data_data = offset(hdr['data_data'])
+    bss_start, bss_end = offset(hdr['bss_start']), offset(hdr['bss_end'])
+    rel_start, rel_end = offset(hdr['rel_start']), offset(hdr['rel_end'])
+    ctx = offset(hdr['ctx'])
+    if data_data < HEADER_SIZE or data_data + bss_start > len(data):
+        errors.append(f'data section 0x{data_data:X}+{bss_start} outside the {len(data)}-byte image')
+    if bss_start > bss_end or offset(hdr['data_end']) > bss_start or offset(hdr['got_end']) > bss_start:
+        errors.append('data, got and bss sections out of order')
+    if rel_start > rel_end or rel_end > len(data):
+        errors.append(f'relocations 0x{rel_start:X}-0x{rel_end:X} outside the image')
+    if ctx + CTX_SIZE > bss_start:
+        errors.append(f'runtime context at data+0x{ctx:X} is not stored in the image')
+    if errors:
+        return None, errors
+
+    rt = dict(zip(CTX_FIELDS, struct.unpack_from(f'<{len(CTX_FIELDS)}I', data, data_data + ctx)))
+    info = {
+        'hdr': hdr,
+        'ctx': rt,
+        'c_name': c_string(data, offset(rt['c_name'])),
+        'rt_desc': c_string(data, offset(rt['rt_version_desc'])),
+        'code_size': round_up8(data_data),
+        'exec_ram_xip': round_up8(bss_end),
+        'exec_ram_copy': round_up8(bss_end) + round_up8(data_data),
+        'params_offset': offset(hdr['params_offset']),
+        'ext_ram_size': round_up8(rt['ext_ram_sz']),
+        'pools': [],
+    }
+    info['image_size'] = max(rel_end, data_data + bss_start)
+    if info['params_offset']:
+        params_end = info['params_offset'] + rt['params_sz']
+        if params_end > len(data):
+            errors.append(f"weights end at 0x{params_end:X}, past the {len(data)}-byte image")
+        info['image_size'] = max(info['image_size'], params_end)
+
+    if (hdr['params_start'] & 0xF0000000) == 0x40000000:
+        desc = data_data + offset(hdr['params_start'])
+        while len(info['pools']) < MAX_POOLS:
+            if desc + POOL_DESC_SIZE > data_data + bss_start:
+                errors.append('memory pool descriptors run past the data section')
+                break
+            name, flags, foff, dst, size = struct.unpack_from('<5I', data, desc)
+            if not name or not flags:
+                break
+            info['pools'].append({'name': c_string(data, offset(name)), 'flags': flags,
+                                  'foff': foff, 'dst': dst, 'size': size})
+            desc += POOL_DESC_SIZE
+    return info, errors
+
+
+# ============================================================================
+# Firmware checks (model_image_check)
+# ============================================================================
+
+def check_image(info: Dict, slot_size: int, exec_ram: int, ext_ram: int, extra: int,
+                rt_version: int) -> List[str]:
+    errors = []
+    flags = info['hdr']['flags']
+    if (flags >> 28) & 0xF != RT_MAJOR or (flags >> 24) & 0xF != RT_MINOR:
+        errors.append(f'binary version {(flags >> 28) & 0xF}.{(flags >> 24) & 0xF}, expected {RT_MAJOR}.{RT_MINOR}')
+    if flags & 0xFFF != CPUID_CORTEX_M55:
+        errors.append(f'built for CPUID 0x{flags & 0xFFF:03X}, expected 0x{CPUID_CORTEX_M55:03X} (Cortex-M55)')
+    if (flags >> 13) & 0x3 != FPABI_HARD:
+        errors.append(f'float ABI {(flags >> 13) & 0x3}, expected hard ({FPABI_HARD})')
+    image_extra = (flags >> 20) & 0x7
+    for bit, name in ((EXTRA_SECURE, 'secure'), (EXTRA_DBG_INFO, 'LL_ATON_EB_DBG_INFO'),
+                      (EXTRA_ASYNC, 'LL_ATON_RT_ASYNC')):
+        if (image_extra & bit) != (extra & bit):
+            errors.append(f"{name} is {'set' if image_extra & bit else 'not set'} in the image, "
+                          f"{'set' if extra & bit else 'not set'} in the firmware")
+    if info['ctx']['rt_version'] & 0xFFFFFF00 != rt_version & 0xFFFFFF00:
+        errors.append(f"LL_ATON runtime {version_str(info['ctx']['rt_version'])}, "
+                      f"firmware {version_str(rt_version)}")
+
+    if info['image_size'] > slot_size:
+        errors.append(f"image needs {info['image_size']:,} bytes, slot holds {slot_size:,}")
+    if info['exec_ram_xip'] > exec_ram:
+        errors.append(f"exec RAM {info['exec_ram_xip']:,} bytes, firmware reserves {exec_ram:,}")
+    if info['ext_ram_size'] > ext_ram:
+        errors.append(f"external RAM {info['ext_ram_size']:,} bytes, firmware reserves {ext_ram:,}")
+    for pool in info['pools']:
+        if (pool['flags'] >> 24) & 0xFF != 1:
+            continue
+        pool_id = pool['flags'] & 0xFF
+        if pool_id == 0 and pool['foff'] + pool['size'] > info['ctx']['params_sz']:
+            errors.append(f"weights pool {pool['name']} runs past the weights")
+        if pool_id == 1 and round_up8(pool['size']) > ext_ram:
+            errors.append(f"external pool {pool['name']} needs {pool['size']:,} bytes, firmware reserves {ext_ram:,}")
+    return errors
+
+
+def weights_crc(data: bytes, info: Dict) -> Optional[int]:
+    start, size = info['params_offset'], info['ctx']['params_bin_sz']
+    if not start or not size or start + size > len(data):
+        return None
+    return zlib.crc32(data[start:start + size]) & 0xFFFFFFFF
+
+
+def version_str(version: int) -> str:
+    return f'{(version >> 24) & 0xFF}.{(version >> 16) & 0xFF}.{(version >> 8) & 0xFF}'
+
+
+def firmware_rt_version(path: str) -> int:
+    with open(path, encoding='utf-8') as f:
+        parts = dict(_VERSION.findall(f.read()))
+    return (int(parts['MAJOR']) << 24) | (int(parts['MINOR']) << 16) | (int(parts['MICRO']) << 8)
+
+
+def print_info(path: str, info: Dict, crc: Optional[int]):
+    hdr, rt, flags = info['hdr'], info['ctx'], info['hdr']['flags']
+    print(f"\n{os.path.basename(path)}: \"{info['c_name']}\" ({info['rt_desc']})")
+    print(f"  flags          0x{flags:08X}: v{(flags >> 28) & 0xF}.{(flags >> 24) & 0xF} "
+          f"toolchain={(flags >> 16) & 0xF} fpabi={(flags >> 13) & 0x3} fpu={(flags >> 12) & 1} "
+          f"cpuid=0x{flags & 0xFFF:03X} secure={(flags >> 20) & 1} dbg={(flags >> 21) & 1} "
+          f"async={(flags >> 22) & 1}")
+    print(f"  runtime        {version_str(rt['rt_version'])}-{rt['rt_version_extra']}")
+    print(f"  image          {info['image_size']:>10,} bytes (code {info['code_size']:,}, "
+          f"relocations {offset(hdr['rel_end']) - offset(hdr['rel_start']):,})")
+    print(f"  weights        {rt['params_sz']:>10,} bytes at +0x{info['params_offset']:X}")
+    print(f"  activations    {rt['acts_sz']:>10,} bytes, external RAM {info['ext_ram_size']:,}")
+    print(f"  exec RAM       {info['exec_ram_xip']:>10,} bytes XIP, {info['exec_ram_copy']:,} COPY")
+    if crc is not None:
+        state = 'ok' if crc == rt['params_bin_crc32'] else f"MISMATCH (header 0x{rt['params_bin_crc32']:08X})"
+        print(f'  weights crc32  0x{crc:08X} {state}')
+    for pool in info['pools']:
+        flags = pool['flags']
+        kind = f"{POOL_TYPES.get(flags >> 24 & 0xFF, '?')}/{POOL_DTYPES.get(flags >> 16 & 0xFF, '?')}"
+        where = f"0x{pool['dst']:08X}" if pool['dst'] else 'relocated'
+        print(f"  pool {flags & 0xFF:<2} {pool['name']:<12} {kind:<12} {where:>10} {pool['size']:>10,} bytes")
+
+
+# ============================================================================
+# Slot table
+# ============================================================================
+
+def load_config_slots(path: str) -> Dict[str, Dict]:
+    with open(path, encoding='utf-8') as f:
+        config = json.load(f)
+    slots = {}
+    for model, entry in config.get('models', {}).items():
+        for variant in entry.get('variants', []):
+            slots[variant['name']] = {'model': model, 'address': int(variant['address'], 16),
+                                      'size': variant['slot_kbytes'] * 1024}
+    return slots
+
+
+def check_slots(slots: Dict[str, Dict], app_source: str) -> List[str]:
+    errors = []
+    ordered = sorted(slots.items(), key=lambda item: item[1]['address'])
+    for (name, slot), (next_name, next_slot) in zip(ordered, ordered[1:]):
+        if slot['address'] + slot['size'] > next_slot['address']:
+            errors.append(f'slot {name} overlaps slot {next_name}')
+
+    if os.path.exists(app_source):
+        with open(app_source, encoding='utf-8') as f:
+            app_slots = {m[1]: (m[0], int(m[2], 16), int(m[3], 16)) for m in _APP_SLOT.findall(f.read())}
+        for name in sorted(set(slots) | set(app_slots)):
+            if name not in app_slots or name not in slots:
+                errors.append(f"slot {name} only in {'the configuration' if name in slots else 'the firmware'}")
+                continue
+            role, address, size = app_slots[name]
+            expected_role = 'DETECTION' if slots[name]['model'] == 'face_detection' else 'RECOGNITION'
+            if (role, address, size) != (expected_role, slots[name]['address'], slots[name]['size']):
+                errors.append(f'slot {name} differs between the configuration and the firmware')
+    return errors
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description='Validate relocatable network images against the firmware')
+    parser.add_argument('images', nargs='*', help='relocatable image (.bin)')
+    parser.add_argument('--config', default=DEFAULT_CONFIG, help='tools configuration holding the model slots')
+    parser.add_argument('--slot', help='variant whose slot the image is written to')
+    parser.add_argument('--slot-size', type=parse_size, help='slot size (default: from --slot)')
+    parser.add_argument('--exec-ram', type=parse_size, default=EXEC_RAM_SIZE, help='exec RAM per network')
+    parser.add_argument('--ext-ram', type=parse_size, default=EXT_RAM_SIZE, help='external RAM per network')
+    parser.add_argument('--dbg-info', action='store_true', help='firmware built with EPOCH_PROFILE=1')
+    parser.add_argument('--no-secure', action='store_true', help='firmware built without -mcmse')
+    parser.add_argument('--check-slots', action='store_true', help='check the slot table itself')
+    args = parser.parse_args(argv)
+
+    slots = load_config_slots(args.config)
+    errors = []
+    if args.check_slots:
+        errors.extend(check_slots(slots, DEFAULT_APP_SOURCE))
+        for name, slot in sorted(slots.items(), key=lambda item: item[1]['address']):
+            print(f"  {name:<24} {slot['model']:<18} 0x{slot['address']:08X} {slot['size']:>12,} bytes")
+
+    slot_size = args.slot_size
+    if args.slot:
+        if args.slot not in slots:
+            print(f'unknown slot {args.slot}, configured: {", ".join(sorted(slots))}')
+            return 2
+        slot_size = slot_size or slots[args.slot]['size']
+    extra = EXTRA_ASYNC | (0 if args.no_secure else EXTRA_SECURE) | (EXTRA_DBG_INFO if args.dbg_info else 0)
+    rt_version = firmware_rt_version(DEFAULT_VERSION_H)
+
+    for path in args.images:
+        with open(path, 'rb') as f:
+            data = f.read()
+        info, layout_errors = parse_image(data)
+        errors.extend(f'{os.path.basename(path)}: {e}' for e in layout_errors)
+        if info is None:
+            continue
+        print_info(path, info, weights_crc(data, info))
+        for error in check_image(info, slot_size or len(data), args.exec_ram, args.ext_ram, extra, rt_version):
+            errors.append(f'{os.path.basename(path)}: {error}')
+
+    if errors:
+        print(f'\n{len(errors)} ERRORS:')
+        for line in errors:
+            print(f'  {line}')
+        return 1
+    print('\nok')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -13,7 +13,6 @@ import zlib
 from collections import deque
 from enum import IntEnum
 from typing import Optional, Tuple, List, Dict, Any, Callable
-import cv2
 import numpy as np
 
 logger = logging.getLogger(__name__)
@@ -29,6 +28,10 @@ class MessageType(IntEnum):
     COMMAND_REQUEST = 0x07
     COMMAND_RESPONSE = 0x08
     DEBUG_INFO = 0x09
+    PERF_SUMMARY = 0x0A
+    EPOCH_PROFILE = 0x0B
+    STALL_REPORT = 0x0C
+    FRAME_DELTA = 0x0D
 
 class ProtocolConstants:
     """Protocol constants and configuration"""
@@ -44,6 +47,17 @@ class ProtocolConstants:
     MSG_HEADER_FORMAT = '<BH'          # MessageType(1) + SequenceId(2)
     MSG_HEADER_SIZE = 3
 
+    # v2 chunked framing: a message is one or more chunks, each with its own CRC32
+    PROTOCOL_V1 = 1
+    PROTOCOL_V2 = 2
+    V2_SOF_BYTE = 0xAB
+    V2_HEADER_FORMAT = '<BBBBHHII'     # SOF, Version, Type, Flags, SequenceId, ChunkSize,
+                                       # MessageSize, ChunkOffset (checksum byte follows)
+    V2_HEADER_SIZE = 17
+    V2_FLAG_FIRST = 0x01
+    V2_FLAG_LAST = 0x02
+    V2_MAX_MESSAGE_SIZE = 16 * 1024 * 1024  # Reassembly limit
+
 def calculate_checksum(data: bytes) -> int:
     """Calculate simple XOR checksum for header validation"""
     checksum = 0
@@ -66,13 +80,17 @@ class Crc32:
     # Calculate CRC from input buffer
     def calculate(self, buf):
         crc = 0xFFFFFFFF
+        words = len(buf) - (len(buf) % 4)
 
         i = 0
-        while i < len(buf):
+        while i < words:
             b = [buf[i + 3], buf[i + 2], buf[i + 1], buf[i + 0]]
             i += 4
             for byte in b:
                 crc = ((crc << 8) & 0xFFFFFFFF) ^ self.crc_table[(crc >> 24) ^ byte]
+        # The last 1 to 3 bytes are fed one by one, in order
+        for byte in buf[words:]:
+            crc = ((crc << 8) & 0xFFFFFFFF) ^ self.crc_table[(crc >> 24) ^ byte]
         return crc
 
     # Create bytes array from integer input
@@ -92,7 +110,8 @@ def calculate_stm32_crc32(data: bytes) -> int:
     - Input reflection: None
     - Output reflection: None
     - Output XOR: None
-    - Processes data in 4-byte chunks with STM32 word-based ordering
+    - Processes data in 4-byte chunks with STM32 word-based ordering,
+      then the last 1 to 3 bytes one by one
     """
     return _stm32_crc.calculate(data)
 
@@ -254,8 +273,11 @@ class RobustProtocolParser:
             'throughput_mbps': 0.0,
             'last_throughput_time': time.time()
         }
+        self.stats['v2_chunks'] = 0
         self.running = False
         self.last_sequence_id = {}  # Track sequence per message type
+        self.device_protocol_version = ProtocolConstants.PROTOCOL_V1  # Announced by heartbeats
+        self._reassembly = None  # v2 message being reassembled
         
         # Register default message handlers
         self.register_handler(MessageType.FRAME_DATA, self._handle_frame_data)
@@ -295,10 +317,11 @@ class RobustProtocolParser:
             if not byte_data:
                 return False
                 
-            if byte_data[0] == ProtocolConstants.SOF_BYTE:
+            if byte_data[0] in (ProtocolConstants.SOF_BYTE, ProtocolConstants.V2_SOF_BYTE):
+                header_size = self._header_size(byte_data[0])
                 # Found potential SOF, verify it's a valid header before declaring success
-                if self.buffer.available() >= ProtocolConstants.HEADER_SIZE:
-                    header_data = self.buffer.peek(ProtocolConstants.HEADER_SIZE)
+                if self.buffer.available() >= header_size:
+                    header_data = self.buffer.peek(header_size)
                     if header_data and self._validate_header_quickly(header_data):
                         return True
                 else:
@@ -315,8 +338,35 @@ class RobustProtocolParser:
             
         return False
     
+    @staticmethod
+    def _header_size(sof: int) -> int:
+        """Frame header size for a start of frame byte"""
+        if sof == ProtocolConstants.V2_SOF_BYTE:
+            return ProtocolConstants.V2_HEADER_SIZE
+        return ProtocolConstants.HEADER_SIZE
+
+    @staticmethod
+    def _unpack_v2_header(header_data: bytes) -> Optional[Tuple[int, int, int, int, int, int]]:
+        """Validate a v2 chunk header, returns (type, flags, seq, chunk, total, offset) or None"""
+        if len(header_data) < ProtocolConstants.V2_HEADER_SIZE:
+            return None
+        sof, version, msg_type, flags, sequence_id, chunk_size, total_size, offset = struct.unpack(
+            ProtocolConstants.V2_HEADER_FORMAT, header_data[:ProtocolConstants.V2_HEADER_SIZE - 1])
+        if sof != ProtocolConstants.V2_SOF_BYTE or version != ProtocolConstants.PROTOCOL_V2:
+            return None
+        if calculate_checksum(header_data[:ProtocolConstants.V2_HEADER_SIZE - 1]) != \
+                header_data[ProtocolConstants.V2_HEADER_SIZE - 1]:
+            return None
+        if total_size > ProtocolConstants.V2_MAX_MESSAGE_SIZE or offset + chunk_size > total_size:
+            return None
+        if chunk_size == 0 and total_size != 0:
+            return None
+        return msg_type, flags, sequence_id, chunk_size, total_size, offset
+
     def _validate_header_quickly(self, header_data: bytes) -> bool:
         """Quick validation to check if header looks valid"""
+        if header_data and header_data[0] == ProtocolConstants.V2_SOF_BYTE:
+            return self._unpack_v2_header(header_data) is not None
         if len(header_data) < 4:
             return False
             
@@ -371,119 +421,181 @@ class RobustProtocolParser:
             self.stats['parse_errors'] += 1
             return None
     
+    # Outcome of parsing one packet or chunk
+    _NEED_DATA = 0
+    _FAILED = 1
+    _CONSUMED = 2
+
     def parse_message(self) -> Optional[ProtocolMessage]:
-        """Parse a complete message from buffer"""
+        """Parse the next complete message: a v1 packet or a reassembled v2 message"""
         max_attempts = 3  # Limit attempts to avoid infinite loops
+        failures = 0
         
-        for attempt in range(max_attempts):
+        while failures < max_attempts:
             # Find frame sync
             if not self.find_sync():
                 return None
-                
-            # Parse header
-            header_info = self.parse_header()
-            if not header_info:
-                # Invalid header, consume SOF and try again
-                self.buffer.consume(1)
-                if attempt == max_attempts - 1:
-                    return None
-                continue
-                
-            payload_size, header_checksum = header_info
             
-            # Check if complete message is available (payload + CRC32)
-            total_size = ProtocolConstants.HEADER_SIZE + payload_size + ProtocolConstants.CRC_SIZE
-            if self.buffer.available() < total_size:
+            sof = self.buffer.peek(1)
+            if sof[0] == ProtocolConstants.V2_SOF_BYTE:
+                status, message = self._parse_v2_chunk()
+            else:
+                status, message = self._parse_v1_packet()
+            
+            if message is not None:
+                return message
+            if status == self._NEED_DATA:
                 return None  # Wait for more data
-                
-            # Consume header
-            header_data = self.buffer.consume(ProtocolConstants.HEADER_SIZE)
-            if not header_data:
-                if attempt == max_attempts - 1:
-                    return None
-                continue
-                
-            # Read payload + CRC32
-            payload_and_crc = self.buffer.consume(payload_size + ProtocolConstants.CRC_SIZE)
-            if not payload_and_crc:
-                logger.error("Failed to read payload and CRC32 after header")
-                self.stats['parse_errors'] += 1
-                if attempt == max_attempts - 1:
-                    return None
-                continue
-                
-            # Split payload and CRC32
-            payload_data = payload_and_crc[:payload_size]
-            crc32_bytes = payload_and_crc[payload_size:]
-            
-            # Extract and validate CRC32 (calculated only on payload data, not message header)
-            try:
-                received_crc32, = struct.unpack('<I', crc32_bytes)
-                # CRC32 is calculated only on payload data (after message header)
-                actual_payload = payload_data[ProtocolConstants.MSG_HEADER_SIZE:]
-                if not validate_crc32(actual_payload, received_crc32):
-                    calculated_crc32 = calculate_stm32_crc32(actual_payload)
-                    logger.debug(f"CRC32 mismatch: expected {received_crc32:08X}, calculated {calculated_crc32:08X}")
-                    self.stats['crc_errors'] += 1
-                    if attempt == max_attempts - 1:
-                        return None
-                    continue
-            except struct.error:
-                logger.warning("Failed to unpack CRC32")
-                self.stats['parse_errors'] += 1
-                if attempt == max_attempts - 1:
-                    return None
-                continue
-                
-            # Successfully read complete message, break out of retry loop
-            break
-        else:
-            # All attempts failed
-            return None
+            if status == self._FAILED:
+                failures += 1
+            # Intermediate v2 chunks are not failures: keep going
+        
+        return None
+    
+    def _parse_v1_packet(self) -> Tuple[int, Optional[ProtocolMessage]]:
+        """Parse a v1 packet (4-byte header, 16-bit size)"""
+        # Parse header
+        header_info = self.parse_header()
+        if not header_info:
+            # Invalid header, consume SOF and try again
+            self.buffer.consume(1)
+            return self._FAILED, None
+            
+        payload_size, header_checksum = header_info
+        
+        # Check if complete message is available (payload + CRC32)
+        total_size = ProtocolConstants.HEADER_SIZE + payload_size + ProtocolConstants.CRC_SIZE
+        if self.buffer.available() < total_size:
+            return self._NEED_DATA, None
+            
+        # Consume header, then read payload + CRC32
+        self.buffer.consume(ProtocolConstants.HEADER_SIZE)
+        payload_and_crc = self.buffer.consume(payload_size + ProtocolConstants.CRC_SIZE)
+        if not payload_and_crc:
+            logger.error("Failed to read payload and CRC32 after header")
+            self.stats['parse_errors'] += 1
+            return self._FAILED, None
             
+        # Split payload and CRC32
+        payload_data = payload_and_crc[:payload_size]
+        received_crc32, = struct.unpack('<I', payload_and_crc[payload_size:])
+        
         # Parse message header within payload
         if len(payload_data) < ProtocolConstants.MSG_HEADER_SIZE:
             logger.warning(f"Payload too small for message header: {len(payload_data)}")
             self.stats['parse_errors'] += 1
-            return None
+            return self._FAILED, None
+        
+        # CRC32 is calculated only on payload data (after message header)
+        actual_payload = payload_data[ProtocolConstants.MSG_HEADER_SIZE:]
+        if not validate_crc32(actual_payload, received_crc32):
+            calculated_crc32 = calculate_stm32_crc32(actual_payload)
+            logger.debug(f"CRC32 mismatch: expected {received_crc32:08X}, calculated {calculated_crc32:08X}")
+            self.stats['crc_errors'] += 1
+            return self._FAILED, None
             
-        try:
-            msg_type_int, sequence_id = struct.unpack(
-                ProtocolConstants.MSG_HEADER_FORMAT, 
-                payload_data[:ProtocolConstants.MSG_HEADER_SIZE]
-            )
-            
-            # Validate message type
-            try:
-                msg_type = MessageType(msg_type_int)
-            except ValueError:
-                logger.warning(f"Unknown message type: {msg_type_int}")
+        msg_type_int, sequence_id = struct.unpack(
+            ProtocolConstants.MSG_HEADER_FORMAT, 
+            payload_data[:ProtocolConstants.MSG_HEADER_SIZE]
+        )
+        message = self._deliver(msg_type_int, sequence_id, actual_payload)
+        return (self._CONSUMED if message else self._FAILED), message
+    
+    def _parse_v2_chunk(self) -> Tuple[int, Optional[ProtocolMessage]]:
+        """Parse a v2 chunk; returns the message once its last chunk is in"""
+        header_data = self.buffer.peek(ProtocolConstants.V2_HEADER_SIZE)
+        if not header_data:
+            return self._NEED_DATA, None
+        
+        header = self._unpack_v2_header(header_data)
+        if header is None:
+            self.stats['checksum_errors'] += 1
+            self.buffer.consume(1)
+            return self._FAILED, None
+        msg_type_int, flags, sequence_id, chunk_size, total_size, offset = header
+        
+        chunk_total = ProtocolConstants.V2_HEADER_SIZE + chunk_size + ProtocolConstants.CRC_SIZE
+        if self.buffer.available() < chunk_total:
+            return self._NEED_DATA, None
+        
+        chunk_data = self.buffer.consume(chunk_total)
+        body = chunk_data[ProtocolConstants.V2_HEADER_SIZE:ProtocolConstants.V2_HEADER_SIZE + chunk_size]
+        received_crc32, = struct.unpack('<I', chunk_data[-ProtocolConstants.CRC_SIZE:])
+        self.stats['v2_chunks'] += 1
+        
+        # Each chunk has its own CRC: a bad one loses the message it belongs to
+        if not validate_crc32(body, received_crc32):
+            logger.debug(f"v2 chunk CRC32 mismatch at offset {offset} of {total_size}")
+            self.stats['crc_errors'] += 1
+            self._reassembly = None
+            return self._FAILED, None
+        
+        if flags & ProtocolConstants.V2_FLAG_FIRST:
+            if self._reassembly is not None:
+                logger.debug("v2 message abandoned before its last chunk")
+            if offset != 0:
                 self.stats['parse_errors'] += 1
-                return None
-                
-            # Extract message payload (after message header)
-            message_payload = payload_data[ProtocolConstants.MSG_HEADER_SIZE:]
-            
-            # Create message object
-            message = ProtocolMessage(msg_type, sequence_id, message_payload)
-            
-            # Check for dropped messages (simple sequence check)
-            last_seq = self.last_sequence_id.get(msg_type, sequence_id - 1)
-            if sequence_id != (last_seq + 1) % 65536:  # 16-bit sequence wraparound
-                dropped = (sequence_id - last_seq - 1) % 65536
-                if dropped > 0 and dropped < 1000:  # Reasonable drop count
-                    self.stats['messages_dropped'] += dropped
-                    logger.debug(f"Dropped {dropped} messages of type {msg_type.name}")
-                    
-            self.last_sequence_id[msg_type] = sequence_id
-            self.stats['messages_received'] += 1
-            
-            return message
-            
-        except struct.error as e:
-            logger.warning(f"Error parsing message header: {e}")
+                self._reassembly = None
+                return self._FAILED, None
+            self._reassembly = {
+                'type': msg_type_int,
+                'sequence_id': sequence_id,
+                'data': bytearray(total_size),
+                'received': 0,
+            }
+        
+        partial = self._reassembly
+        if (partial is None or partial['type'] != msg_type_int or
+                partial['sequence_id'] != sequence_id or len(partial['data']) != total_size or
+                partial['received'] != offset):
+            # Chunk of a message whose start was lost, or out of order
+            self.stats['parse_errors'] += 1
+            self._reassembly = None
+            return self._FAILED, None
+        
+        partial['data'][offset:offset + chunk_size] = body
+        partial['received'] += chunk_size
+        
+        if not flags & ProtocolConstants.V2_FLAG_LAST:
+            return self._CONSUMED, None
+        
+        self._reassembly = None
+        if partial['received'] != total_size:
+            self.stats['parse_errors'] += 1
+            return self._FAILED, None
+        message = self._deliver(msg_type_int, sequence_id, bytes(partial['data']))
+        return (self._CONSUMED if message else self._FAILED), message
+    
+    def _deliver(self, msg_type_int: int, sequence_id: int, payload: bytes) -> Optional[ProtocolMessage]:
+        """Build a message and track its sequence, whatever framing carried it"""
+        # Validate message type
+        try:
+            msg_type = MessageType(msg_type_int)
+        except ValueError:
+            logger.warning(f"Unknown message type: {msg_type_int}")
             self.stats['parse_errors'] += 1
             return None
+        
+        # Create message object
+        message = ProtocolMessage(msg_type, sequence_id, payload)
+        
+        # Check for dropped messages (simple sequence check)
+        last_seq = self.last_sequence_id.get(msg_type, sequence_id - 1)
+        if sequence_id != (last_seq + 1) % 65536:  # 16-bit sequence wraparound
+            dropped = (sequence_id - last_seq - 1) % 65536
+            if dropped > 0 and dropped < 1000:  # Reasonable drop count
+                self.stats['messages_dropped'] += dropped
+                logger.debug(f"Dropped {dropped} messages of type {msg_type.name}")
+                
+        self.last_sequence_id[msg_type] = sequence_id
+        self.stats['messages_received'] += 1
+        
+        # Heartbeats announce the framing of the other messages:
+        # Timestamp(4) + ProtocolVersion(1) + Reserved(1) + ChunkSize(2)
+        if msg_type == MessageType.HEARTBEAT and len(payload) >= 6:
+            self.device_protocol_version = payload[4]
+        
+        return message
     
     def process_messages(self, max_messages: int = 50) -> int:
         """Process available messages, returns number processed (increased throughput)"""
@@ -522,6 +634,7 @@ class RobustProtocolParser:
         for key in self.stats:
             self.stats[key] = 0
         self.last_sequence_id.clear()
+        self._reassembly = None
     
     # Default message handlers (can be overridden)
     def _handle_frame_data(self, message: ProtocolMessage):
@@ -545,31 +658,223 @@ class RobustProtocolParser:
         logger.debug("Heartbeat received")
 
 class FrameDataParser:
-    """Parser for frame data messages"""
+    """Parser for frame data messages
+    
+    The static methods decode whole frames; an instance also keeps the frames
+    that FRAME_DELTA messages update, one per frame type.
+    """
+    
+    # Tile delta header: FrameType(4) + Width(4) + Height(4) + Bpp(1) + Flags(1) +
+    # TileSize(1) + Reserved(1) + FrameId(2) + BaseId(2) + TileCount(4)
+    DELTA_HEADER_FORMAT = '<4sIIBBBBHHI'
+    DELTA_HEADER_SIZE = 24
+    DELTA_FLAG_KEYFRAME = 0x01
+    
+    # FrameType(3) + Flags(1) + Width(4) + Height(4); older firmware sends Flags 0
+    FRAME_FLAG_CODED = 0x01
+    
+    # Coded pixels (embedded/Inc/frame_codec.h): Version(1) + Bpp(1) + DropBits(1) +
+    # Reserved(1), then per row K(1) + UnaryBytes(2) + unary bits + remainder bits,
+    # or 0xFF + the row as sent uncoded
+    CODEC_VERSION = 1
+    CODEC_HEADER_SIZE = 4
+    CODEC_ROW_RAW = 0xFF
+    CODEC_MAX_K = 7
+    
+    def __init__(self):
+        self.delta_frames: Dict[str, Tuple[int, int, int, int, bytearray]] = {}
+        self.delta_stats = {'frames': 0, 'keyframes': 0, 'tiles': 0, 'out_of_step': 0}
+    
+    def parse_frame_delta(self, payload: bytes) -> Optional[Tuple[str, np.ndarray, int, int]]:
+        """Apply a tile delta message and return the updated frame
+        
+        Tiles are TileSize square, row major, clipped at the right and bottom
+        edges; each is a u16 tile index followed by its pixel rows. A delta
+        whose BaseId is not the frame held is ignored until the next keyframe.
+        """
+        frame_type = None
+        try:
+            if len(payload) < self.DELTA_HEADER_SIZE:
+                return None
+            (frame_type, width, height, bpp, flags, tile_size, _, frame_id, base_id,
+             tile_count) = struct.unpack(self.DELTA_HEADER_FORMAT, payload[:self.DELTA_HEADER_SIZE])
+            frame_type = frame_type.decode('ascii').rstrip('\x00')
+            if bpp == 0 or bpp > 4 or tile_size == 0 or width == 0 or height == 0:
+                return None
+            
+            held = self.delta_frames.get(frame_type)
+            if flags & self.DELTA_FLAG_KEYFRAME:
+                image = bytearray(width * height * bpp)
+                self.delta_stats['keyframes'] += 1
+            elif held is not None and held[0] == base_id and held[1:4] == (width, height, bpp):
+                image = held[4]
+            else:
+                self.delta_stats['out_of_step'] += 1
+                return None
+            
+            # Row-major tile grid, each tile copied row by row into the image
+            tiles_x = (width + tile_size - 1) // tile_size
+            tiles_y = (height + tile_size - 1) // tile_size
+            stride = width * bpp
+            view = memoryview(payload)
+            pos = self.DELTA_HEADER_SIZE
+            for _ in range(tile_count):
+                tile, = struct.unpack_from('<H', payload, pos)
+                pos += 2
+                if tile >= tiles_x * tiles_y:
+                    raise ValueError(f"tile {tile} outside {tiles_x}x{tiles_y}")
+                x0 = (tile % tiles_x) * tile_size
+                y0 = (tile // tiles_x) * tile_size
+                row = min(tile_size, width - x0) * bpp
+                for y in range(y0, min(y0 + tile_size, height)):
+                    start = y * stride + x0 * bpp
+                    image[start:start + row] = view[pos:pos + row]
+                    pos += row
+            if pos != len(payload):
+                raise ValueError(f"{len(payload) - pos} bytes left after {tile_count} tiles")
+            
+            self.delta_frames[frame_type] = (frame_id, width, height, bpp, image)
+            self.delta_stats['frames'] += 1
+            self.delta_stats['tiles'] += tile_count
+            
+            frame = FrameDataParser.decode_pixels(bytes(image), width, height)
+            if frame is not None:
+                return frame_type, frame, width, height
+            return None
+        
+        except Exception as e:
+            logger.error(f"Error parsing frame delta: {e}")
+            # Whatever was applied is no longer a known frame
+            if frame_type is not None:
+                self.delta_frames.pop(frame_type, None)
+        
+        return None
+    
+    @staticmethod
+    def decode_pixels(image_data: bytes, width: int, height: int) -> Optional[np.ndarray]:
+        """Convert raw pixels to a BGR image, telling the format from the data size
+        
+        v1 frames are grayscale (1 byte per pixel); v2 frames keep the camera
+        format: RGB565 little endian (2 bytes) or RGB888 in R, G, B order (3 bytes).
+        """
+        pixels = width * height
+        if pixels == 0:
+            return None
+        
+        if len(image_data) == pixels:
+            gray = np.frombuffer(image_data, dtype=np.uint8).reshape((height, width))
+            # Convert to 3-channel for consistency
+            return np.dstack((gray, gray, gray))
+        
+        if len(image_data) == pixels * 2:
+            rgb565 = np.frombuffer(image_data, dtype='<u2').reshape((height, width))
+            r = ((rgb565 >> 11) & 0x1F).astype(np.uint8)
+            g = ((rgb565 >> 5) & 0x3F).astype(np.uint8)
+            b = (rgb565 & 0x1F).astype(np.uint8)
+            # Expand to 8 bits, replicating the high bits into the low ones
+            return np.dstack(((b << 3) | (b >> 2), (g << 2) | (g >> 4), (r << 3) | (r >> 2)))
+        
+        if len(image_data) == pixels * 3:
+            rgb = np.frombuffer(image_data, dtype=np.uint8).reshape((height, width, 3))
+            return np.ascontiguousarray(rgb[:, :, ::-1])
+        
+        logger.warning(f"Raw data size mismatch: {len(image_data)} bytes for {width}x{height}")
+        return None
+    
+    @staticmethod
+    def decode_coded(data: bytes, width: int, height: int) -> Optional[bytes]:
+        """Undo the firmware frame coding, returning the pixels as sent uncoded
+        
+        Each row holds one unary code (zeros then a 1) and one k-bit remainder
+        per channel sample, in two bit streams, so a whole row splits at once.
+        The residuals are left differences modulo the channel range, zigzag
+        mapped: a cumulative sum along the row gives the channel values back.
+        """
+        data = bytes(data)
+        if len(data) < FrameDataParser.CODEC_HEADER_SIZE:
+            return None
+        version, bpp, drop_bits = data[0], data[1], data[2]
+        if version != FrameDataParser.CODEC_VERSION or bpp not in (1, 2, 3) or drop_bits > 3:
+            return None
+        
+        channels = 3 if bpp == 2 else bpp
+        bits = np.array([5, 6, 5] if bpp == 2 else [8] * channels, dtype=np.int32) - drop_bits
+        masks = (1 << bits) - 1
+        fill = (1 << (drop_bits - 1)) if drop_bits else 0
+        samples = width * channels
+        row_bytes = width * bpp
+        buffer = np.frombuffer(data, dtype=np.uint8)
+        image = np.empty((height, row_bytes), dtype=np.uint8)
+        pos = FrameDataParser.CODEC_HEADER_SIZE
+        
+        for y in range(height):
+            if pos >= len(data):
+                return None
+            k = data[pos]
+            if k == FrameDataParser.CODEC_ROW_RAW:
+                if len(data) - pos - 1 < row_bytes:
+                    return None
+                image[y] = buffer[pos + 1:pos + 1 + row_bytes]
+                pos += 1 + row_bytes
+                continue
+            if k > FrameDataParser.CODEC_MAX_K or len(data) - pos < 3:
+                return None
+            
+            unary_bytes = data[pos + 1] | (data[pos + 2] << 8)
+            remainder_bytes = (samples * k + 7) // 8
+            pos += 3
+            if len(data) - pos < unary_bytes + remainder_bytes:
+                return None
+            
+            ones = np.flatnonzero(np.unpackbits(buffer[pos:pos + unary_bytes]))
+            if len(ones) < samples:
+                return None
+            z = np.diff(ones[:samples], prepend=-1).astype(np.int32) - 1
+            if k:
+                low = np.unpackbits(buffer[pos + unary_bytes:pos + unary_bytes + remainder_bytes])
+                z = (z << k) | (low[:samples * k].reshape(samples, k).astype(np.int32) @
+                                (1 << np.arange(k - 1, -1, -1, dtype=np.int32)))
+            z = z.reshape(width, channels)
+            if (z > masks).any():
+                return None
+            
+            d = np.where(z & 1, masks + 1 - ((z + 1) >> 1), z >> 1)
+            values = ((np.cumsum(d, axis=0) & masks) << drop_bits) | fill
+            if bpp == 2:
+                rgb565 = (values[:, 0] << 11) | (values[:, 1] << 5) | values[:, 2]
+                image[y] = rgb565.astype('<u2').view(np.uint8)
+            else:
+                image[y] = values.reshape(-1)
+            pos += unary_bytes + remainder_bytes
+        
+        return image.tobytes() if pos == len(data) else None
+    
+    @staticmethod
+    def frame_pixels(payload: bytes, width: int, height: int) -> Optional[bytes]:
+        """Pixels of a frame payload, decoded when the header flags say they are coded"""
+        if payload[3] & FrameDataParser.FRAME_FLAG_CODED:
+            return FrameDataParser.decode_coded(payload[12:], width, height)
+        return memoryview(payload)[12:]
     
     @staticmethod
     def parse_frame(payload: bytes) -> Optional[Tuple[str, np.ndarray, int, int]]:
         """Parse frame data payload"""
         try:
-            # Frame format: FrameType(4) + Width(4) + Height(4) + ImageData(...)
+            # Frame format: FrameType(3) + Flags(1) + Width(4) + Height(4) + ImageData(...)
 
             if len(payload) < 12:
                 return None
                 
-            frame_type, width, height = struct.unpack('<4sII', payload[:12])
+            frame_type, _, width, height = struct.unpack('<3sBII', payload[:12])
             frame_type = frame_type.decode('ascii').rstrip('\x00')
             
-            image_data = payload[12:]
-            
-            # All frames are now raw grayscale data
-            if len(image_data) == width * height:
-                frame = np.frombuffer(image_data, dtype=np.uint8).reshape((height, width))
-                # Convert to 3-channel for consistency
-                frame = cv2.cvtColor(frame, cv2.COLOR_GRAY2BGR)
-                return frame_type, frame, width, height
-            else:
-                logger.warning(f"Raw data size mismatch: expected {width * height}, got {len(image_data)}")
+            pixels = FrameDataParser.frame_pixels(payload, width, height)
+            if pixels is None:
                 return None
+            frame = FrameDataParser.decode_pixels(pixels, width, height)
+            if frame is not None:
+                return frame_type, frame, width, height
+            return None
                     
         except Exception as e:
             logger.error(f"Error parsing frame data: {e}")
@@ -581,27 +886,23 @@ class FrameDataParser:
 
         """Optimized frame parsing with reduced memory allocations"""
         try:
-            # Frame format: FrameType(4) + Width(4) + Height(4) + ImageData(...)
+            # Frame format: FrameType(3) + Flags(1) + Width(4) + Height(4) + ImageData(...)
             if len(payload) < 12:
                 return None
                 
             # Fast header parsing without intermediate objects
-            frame_type = payload[:4].decode('ascii').rstrip('\x00')
+            frame_type = payload[:3].decode('ascii').rstrip('\x00')
             width = struct.unpack('<I', payload[4:8])[0]
             height = struct.unpack('<I', payload[8:12])[0]
 
-            # Direct slice for image data (no copy)
-            image_data = payload[12:]
-            
-            # All frames are now raw grayscale data
-            if len(image_data) == width * height:
-                frame = np.frombuffer(image_data, dtype=np.uint8).reshape((height, width))
-                # Convert to 3-channel for consistency
-                frame = cv2.cvtColor(frame, cv2.COLOR_GRAY2BGR)
-                return frame_type, frame, width, height
-            else:
-                logger.warning(f"Raw data size mismatch: expected {width * height}, got {len(image_data)}")
+            # Direct slice for uncoded image data (no copy)
+            pixels = FrameDataParser.frame_pixels(payload, width, height)
+            if pixels is None:
                 return None
+            frame = FrameDataParser.decode_pixels(pixels, width, height)
+            if frame is not None:
+                return frame_type, frame, width, height
+            return None
                     
         except Exception as e:
             logger.error(f"Error parsing frame data (fast): {e}")
@@ -682,6 +983,44 @@ class EmbeddingDataParser:
             
         return None
 
+class PerfSummaryParser:
+    """Parser for perf_monitor timing summary messages"""
+
+    # Probe IDs match perf_probe_t in embedded/Inc/perf_monitor.h
+    PROBE_NAMES = ['frame', 'capture', 'preprocessing', 'detection', 'tracking',
+                   'recognition', 'postprocessing', 'output', 'nn_detection',
+                   'nn_recognition', 'face', 'overlay_clear', 'frame_codec', 'display_task']
+    WIRE_VERSION = 1
+
+    @staticmethod
+    def parse_summary(payload: bytes) -> Optional[Tuple[int, Dict[str, Dict[str, int]]]]:
+        """Parse summary payload into (timestamp_ms, {probe: {count, min_us, avg_us, p99_us, max_us}})"""
+        try:
+            # Summary format: Version(1) + ProbeCount(1) + TimestampMs(4) + Probes(21 each)
+            if len(payload) < 6:
+                return None
+
+            version, probe_count, timestamp_ms = struct.unpack('<BBI', payload[:6])
+            if version != PerfSummaryParser.WIRE_VERSION or len(payload) < 6 + probe_count * 21:
+                return None
+
+            probes = {}
+            offset = 6
+            for _ in range(probe_count):
+                probe_id, count, min_us, avg_us, p99_us, max_us = struct.unpack('<BIIIII', payload[offset:offset+21])
+                offset += 21
+                names = PerfSummaryParser.PROBE_NAMES
+                name = names[probe_id] if probe_id < len(names) else f'probe_{probe_id}'
+                probes[name] = {'count': count, 'min_us': min_us, 'avg_us': avg_us,
+                                'p99_us': p99_us, 'max_us': max_us}
+
+            return timestamp_ms, probes
+
+        except Exception as e:
+            logger.error(f"Error parsing perf summary: {e}")
+
+        return None
+
 # Test function
 def test_protocol():
     """Test the robust protocol implementation"""
@@ -576,9 +576,11 @@ class RobustSerialReader(QThread):
         self.serial_port = serial_port
         self._running = False
         self.protocol_parser = RobustProtocolParser()
+        self.frame_decoder = FrameDataParser()  # Holds the frames tile deltas update
         
         # Register message handlers
         self.protocol_parser.register_handler(MessageType.FRAME_DATA, self._handle_frame_data)
+        self.protocol_parser.register_handler(MessageType.FRAME_DELTA, self._handle_frame_delta)
         self.protocol_parser.register_handler(MessageType.DETECTION_RESULTS, self._handle_detections)
         self.protocol_parser.register_handler(MessageType.EMBEDDING_DATA, self._handle_embedding)
         self.protocol_parser.register_handler(MessageType.PERFORMANCE_METRICS, self._handle_performance_metrics)
@@ -647,20 +649,30 @@ class RobustSerialReader(QThread):
     def _handle_frame_data(self, message: ProtocolMessage):
         """Handle frame data message with optimized decoding"""
         try:
-            frame_data = FrameDataParser.parse_frame_fast(message.payload)
-            if frame_data:
-                frame_type, image, width, height = frame_data
-                # Store current frame for ALN detection
-                if frame_type == "RAW":
-                    self.current_frame = image.copy() if image is not None else None
-                if frame_type == "ALN":
-                    self.current_faces.append(image.copy())
-                    if len(self.current_faces) > 5:
-                        self.current_faces = self.current_faces[1:]
-                self.frame_received.emit(image, frame_type)
+            self._dispatch_frame(FrameDataParser.parse_frame_fast(message.payload))
         except Exception as e:
             logger.error(f"Error handling frame data: {e}")
     
+    def _handle_frame_delta(self, message: ProtocolMessage):
+        """Handle a tile delta frame: update the held frame and show it"""
+        try:
+            self._dispatch_frame(self.frame_decoder.parse_frame_delta(message.payload))
+        except Exception as e:
+            logger.error(f"Error handling frame delta: {e}")
+    
+    def _dispatch_frame(self, frame_data):
+        """Route a decoded frame to the views"""
+        if frame_data:
+            frame_type, image, width, height = frame_data
+            # Store current frame for ALN detection
+            if frame_type == "RAW":
+                self.current_frame = image.copy() if image is not None else None
+            if frame_type == "ALN":
+                self.current_faces.append(image.copy())
+                if len(self.current_faces) > 5:
+                    self.current_faces = self.current_faces[1:]
+            self.frame_received.emit(image, frame_type)
+    
     def _handle_detections(self, message: ProtocolMessage):
         """Handle detection results message"""
         try:
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""
+Loopback test of the PC stream framing on Linux
+
+Builds the firmware host tests that write loopback streams, lets each write
+into a pseudo terminal, and decodes the other end with RobustProtocolParser,
+as the UI does with the serial port:
+- test_robust_framing: v1 heartbeat, two 800x480 RGB565 frames in v2 chunks,
+  a v1 grayscale frame
+- test_tile_delta: frames of a moving object scene, each as a whole frame
+  then as a tile delta, to check the reconstruction error
+- test_frame_codec: gray, RGB565 and RGB888 frames, each uncoded then coded
+"""
+
+import os
+import pty
+import select
+import subprocess
+import sys
+import tty
+from pathlib import Path
+
+import numpy as np
+
+from robust_protocol import (
+    FrameDataParser, MessageType, ProtocolConstants, RobustProtocolParser
+)
+
+EMBEDDED_DIR = Path(__file__).resolve().parent.parent / "embedded"
+FRAMING_TEST = "build_host/Tests/test_robust_framing"
+DELTA_TEST = "build_host/Tests/test_tile_delta"
+CODEC_TEST = "build_host/Tests/test_frame_codec"
+
+# Error bounds of the tile delta defaults (tile_delta.h)
+DELTA_PIXEL_THRESHOLD = 48
+DELTA_SAD_THRESHOLD = 8
+
+
+def expected_rgb565_frame(seed: int) -> np.ndarray:
+    """BGR rendering of the test card drawn by fill_frame() in test_robust_framing.c"""
+    y, x = np.mgrid[0:480, 0:800].astype(np.uint32)
+    r = (x + seed) & 0x1F
+    g = y & 0x3F
+    b = (x ^ y) & 0x1F
+    return np.dstack(((b << 3) | (b >> 2), (g << 2) | (g >> 4), (r << 3) | (r >> 2))).astype(np.uint8)
+
+
+def rgb565_difference(a: np.ndarray, b: np.ndarray) -> np.ndarray:
+    """Largest channel difference per pixel, 8-bit units, as tile_delta.c measures it"""
+    a = a.astype(np.int32)
+    b = b.astype(np.int32)
+    dr = np.abs((a >> 11) - (b >> 11)) * 8
+    dg = np.abs(((a >> 5) & 0x3F) - ((b >> 5) & 0x3F)) * 4
+    db = np.abs((a & 0x1F) - (b & 0x1F)) * 8
+    return np.maximum(np.maximum(dr, dg), db)
+
+
+def run_loopback(binary: str, *args: str):
+    """Run an encoder into a pty and decode what comes out of the other end"""
+    subprocess.run(["make", "-s", "-C", str(EMBEDDED_DIR), binary], check=True)
+
+    master, slave = pty.openpty()
+    tty.setraw(slave)  # 8-bit clean, no newline translation
+
+    messages = []
+    parser = RobustProtocolParser()
+    for msg_type in MessageType:
+        parser.register_handler(msg_type, messages.append)
+
+    # Read while the encoder writes, parsing as the data comes, like the UI serial reader
+    proc = subprocess.Popen([str(EMBEDDED_DIR / binary), *args, os.ttyname(slave)],
+                            stdout=subprocess.DEVNULL)
+    while True:
+        if select.select([master], [], [], 0.2)[0]:
+            parser.add_data(os.read(master, 65536))
+            while parser.process_messages():
+                pass
+        elif proc.poll() is not None:
+            break
+    os.close(slave)
+    os.close(master)
+    if proc.returncode != 0:
+        raise RuntimeError(f"{binary} failed with {proc.returncode}")
+    return messages, parser
+
+
+def check_framing(check):
+    """v1 and v2 framing side by side"""
+    messages, parser = run_loopback(FRAMING_TEST)
+    stats = parser.get_stats()
+
+    types = [m.msg_type for m in messages]
+    check(types == [MessageType.HEARTBEAT] + [MessageType.FRAME_DATA] * 3,
+          f"message sequence {types}")
+    check(parser.device_protocol_version == ProtocolConstants.PROTOCOL_V2,
+          "heartbeat announces v2")
+    check(stats['crc_errors'] == 0 and stats['checksum_errors'] == 0 and stats['parse_errors'] == 0,
+          f"errors in {stats}")
+    check(stats['v2_chunks'] >= 2 * (768012 // 16384 + 1), f"v2 chunk count {stats['v2_chunks']}")
+
+    frames = [FrameDataParser.parse_frame_fast(m.payload) for m in messages[1:]]
+    for seed, parsed in enumerate(frames[:2]):
+        check(parsed is not None, f"frame {seed} decodes")
+        if parsed:
+            tag, image, width, height = parsed
+            check((tag, width, height) == ("ALN", 800, 480), f"frame {seed} header")
+            check(np.array_equal(image, expected_rgb565_frame(seed)), f"frame {seed} pixels")
+    if len(frames) > 2 and frames[2]:
+        tag, image, width, height = frames[2]
+        gray = (np.arange(12, 12 + 160 * 120) & 0xFF).astype(np.uint8).reshape(120, 160)
+        check((tag, image.shape) == ("JPG", (120, 160, 3)), "v1 frame header")
+        check(np.array_equal(image[:, :, 1], gray), "v1 frame pixels")
+    else:
+        check(False, "v1 frame decodes")
+
+    print(f"framing: {len(messages)} messages, {stats['v2_chunks']} v2 chunks, "
+          f"{stats['bytes_received']} bytes")
+
+
+def check_tile_delta(check):
+    """Tile delta reconstruction against the frames it codes"""
+    messages, parser = run_loopback(DELTA_TEST)
+    decoder = FrameDataParser()
+    truth = None
+    delta_bytes = 0
+    full_bytes = 0
+
+    for message in messages:
+        if message.msg_type == MessageType.FRAME_DATA:
+            truth = message.payload
+            continue
+        check(message.msg_type == MessageType.FRAME_DELTA, f"unexpected {message.msg_type.name}")
+        decoded = decoder.parse_frame_delta(message.payload)
+        check(decoded is not None, f"delta {message.sequence_id} decodes")
+        if decoded is None or truth is None:
+            continue
+
+        tag, image, width, height = decoded
+        held = np.frombuffer(bytes(decoder.delta_frames[tag][4]), dtype='<u2').reshape(height, width)
+        actual = np.frombuffer(truth[12:], dtype='<u2').reshape(height, width)
+        diff = rgb565_difference(held, actual)
+        tiles = diff[:height // 16 * 16, :width // 16 * 16].reshape(height // 16, 16, width // 16, 16)
+        check(diff.max() <= DELTA_PIXEL_THRESHOLD, f"delta {message.sequence_id} pixel error {diff.max()}")
+        check(tiles.mean(axis=(1, 3)).max() <= DELTA_SAD_THRESHOLD,
+              f"delta {message.sequence_id} tile error {tiles.mean(axis=(1, 3)).max():.1f}")
+        check(np.array_equal(image, FrameDataParser.decode_pixels(bytes(decoder.delta_frames[tag][4]),
+                                                                  width, height)),
+              "delta frame rendering")
+        delta_bytes += len(message.payload)
+        full_bytes += len(truth)
+
+    stats = decoder.delta_stats
+    check(stats['frames'] == 12 and stats['keyframes'] == 2 and stats['out_of_step'] == 0,
+          f"delta stats {stats}")
+    check(delta_bytes * 4 < full_bytes, f"delta {delta_bytes} bytes against {full_bytes}")
+    print(f"tile delta: {stats['frames']} frames, {stats['tiles']} tiles, "
+          f"{full_bytes / max(delta_bytes, 1):.1f}x fewer bytes than whole frames")
+
+
+def check_frame_codec(check):
+    """Python decoding of coded frames against the same frames sent uncoded"""
+    messages, parser = run_loopback(CODEC_TEST, "--loopback")
+    check(len(messages) == 10 and all(m.msg_type == MessageType.FRAME_DATA for m in messages),
+          f"{len(messages)} codec frames")
+
+    raw_bytes = coded_bytes = 0
+    for plain, coded in zip(messages[0::2], messages[1::2]):
+        check(plain.payload[3] == 0 and coded.payload[3] & FrameDataParser.FRAME_FLAG_CODED,
+              f"frame {coded.sequence_id} flags")
+        expected = FrameDataParser.parse_frame_fast(plain.payload)
+        decoded = FrameDataParser.parse_frame_fast(coded.payload)
+        check(decoded is not None, f"frame {coded.sequence_id} decodes")
+        if expected is None or decoded is None:
+            continue
+        check(expected[0] == decoded[0] and expected[2:] == decoded[2:], f"frame {coded.sequence_id} header")
+
+        error = np.abs(expected[1].astype(np.int32) - decoded[1].astype(np.int32)).max()
+        drop_bits = coded.payload[12 + 2]
+        check(error <= ((1 << drop_bits) >> 1), f"frame {coded.sequence_id} error {error}")
+        raw_bytes += len(plain.payload)
+        coded_bytes += len(coded.payload)
+
+    print(f"frame codec: {len(messages) // 2} frames, {raw_bytes / max(coded_bytes, 1):.2f}x "
+          f"fewer bytes coded")
+
+
+def main() -> int:
+    failures = []
+
+    def check(condition: bool, what: str):
+        if not condition:
+            failures.append(what)
+
+    check_framing(check)
+    check_tile_delta(check)
+    check_frame_codec(check)
+
+    for failure in failures:
+        print(f"FAIL: {failure}")
+    print("PASS" if not failures else "FAILED")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
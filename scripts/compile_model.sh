@@ -84,8 +84,19 @@ generate_memory_pool() {
     
     # Get memory address for this model type
     local address=$(python3 -c "import json; config=json.load(open('$CONFIG_FILE')); print(config['models']['$model_type']['address'])")
-    
+
+    # Writable pool sizes in KB, overridable per model through "mempool_kbytes".
+    # Both networks share cpuRAM2 and npuRAM3-6 (they never run at the same
+    # time); the upper 256 KB of npuRAM6 belong to the application (.npuram_bss)
+    local sizes=$(python3 -c "import json; config=json.load(open('$CONFIG_FILE')); \
+sizes={'cpuRAM2': 1024, 'npuRAM3': 448, 'npuRAM4': 448, 'npuRAM5': 448, 'npuRAM6': 192, 'hyperRAM': 16384}; \
+sizes.update(config['models']['$model_type'].get('mempool_kbytes', {})); \
+print(' '.join(str(sizes[k]) for k in ('cpuRAM2', 'npuRAM3', 'npuRAM4', 'npuRAM5', 'npuRAM6', 'hyperRAM')))")
+    local cpuram2_kb npuram3_kb npuram4_kb npuram5_kb npuram6_kb hyperram_kb
+    read -r cpuram2_kb npuram3_kb npuram4_kb npuram5_kb npuram6_kb hyperram_kb <<< "$sizes"
+
     print_status "Generating memory pool for $model_type at address $address"
+    print_status "Activation pools (KB): cpuRAM2 $cpuram2_kb, npuRAM3-6 $npuram3_kb/$npuram4_kb/$npuram5_kb/$npuram6_kb, hyperRAM $hyperram_kb"
     
     cat > "$mpool_file" << EOF
 {
@@ -128,7 +139,7 @@ generate_memory_pool() {
 				"fformat": "FORMAT_RAW",
 				"prop":	  { "rights": "ACC_WRITE", "throughput": "MID",  "latency": "MID", "byteWidth": 8, "freqRatio": 2.50, "read_power": 17.324, "write_power": 15.321 },
 				"offset": { "value": "0x34100000", "magnitude":  "BYTES" },
-				"size":   { "value": "1024",       "magnitude": "KBYTES" }
+				"size":   { "value": "$cpuram2_kb", "magnitude": "KBYTES" }
 			},
 			{
 				"fname": "AXISRAM3",
@@ -136,7 +147,7 @@ generate_memory_pool() {
 				"fformat": "FORMAT_RAW",
 				"prop":	  { "rights": "ACC_WRITE", "throughput": "HIGH", "latency": "LOW", "byteWidth": 8, "freqRatio": 1.25, "read_power": 18.531, "write_power": 16.201 },
 				"offset": { "value": "0x34200000", "magnitude":  "BYTES" },
-				"size":   { "value": "448",        "magnitude": "KBYTES" }
+				"size":   { "value": "$npuram3_kb", "magnitude": "KBYTES" }
 			},
 			{
 				"fname": "AXISRAM4",
@@ -144,7 +155,7 @@ generate_memory_pool() {
 				"fformat": "FORMAT_RAW",
 				"prop":	  { "rights": "ACC_WRITE", "throughput": "HIGH", "latency": "LOW", "byteWidth": 8, "freqRatio": 1.25, "read_power": 18.531, "write_power": 16.201 },
 				"offset": { "value": "0x34270000", "magnitude":  "BYTES" },
-				"size":   { "value": "448",        "magnitude": "KBYTES" }
+				"size":   { "value": "$npuram4_kb", "magnitude": "KBYTES" }
 			},
 			{
 				"fname": "AXISRAM5",
@@ -152,7 +163,7 @@ generate_memory_pool() {
 				"fformat": "FORMAT_RAW",
 				"prop":	  { "rights": "ACC_WRITE", "throughput": "HIGH", "latency": "LOW", "byteWidth": 8, "freqRatio": 1.25, "read_power": 18.531, "write_power": 16.201 },
 				"offset": { "value": "0x342e0000", "magnitude":  "BYTES" },
-				"size":   { "value": "448",        "magnitude": "KBYTES" }
+				"size":   { "value": "$npuram5_kb", "magnitude": "KBYTES" }
 			},
 			{
 				"fname": "AXISRAM6",
@@ -160,7 +171,7 @@ generate_memory_pool() {
 				"fformat": "FORMAT_RAW",
 				"prop":	  { "rights": "ACC_WRITE", "throughput": "HIGH", "latency": "LOW", "byteWidth": 8, "freqRatio": 1.25, "read_power": 19.006, "write_power": 15.790 },
 				"offset": { "value": "0x34350000", "magnitude":  "BYTES" },
-				"size":   { "value": "448",        "magnitude": "KBYTES" }
+				"size":   { "value": "$npuram6_kb", "magnitude": "KBYTES" }
 			},
 			{
 				"fname": "xSPI1",
@@ -168,7 +179,7 @@ generate_memory_pool() {
 				"fformat": "FORMAT_RAW",
 				"prop":	  { "rights": "ACC_WRITE", "throughput": "MID", "latency": "HIGH", "byteWidth": 2, "freqRatio": 5.00, "cacheable": "CACHEABLE_ON","read_power": 380, "write_power": 340.0, "constants_preferred": "true" },
 				"offset": { "value": "0x90000000", "magnitude":  "BYTES" },
-				"size":   { "value": "16",         "magnitude": "MBYTES" }
+				"size":   { "value": "$hyperram_kb", "magnitude": "KBYTES" }
 			},
 			{
 				"fname": "xSPI2",
@@ -213,6 +224,32 @@ EOF
     print_status "Created neural art configuration: $config_file"
 }
 
+# Function to rewrite ONNX patterns the NPU runs in software (see prepare_model.py)
+# Sets PREPARED_MODEL_FILE to the model to compile
+prepare_model() {
+    local model_type="$1"
+    local model_file="$2"
+    PREPARED_MODEL_FILE="$model_file"
+
+    local enabled=$(python3 -c "import json; config=json.load(open('$CONFIG_FILE')); print(config['models']['$model_type'].get('prepare_model', False))" 2>/dev/null || echo "False")
+    if [ "$enabled" != "True" ] || [[ "$model_file" != *.onnx ]]; then
+        return 0
+    fi
+
+    # Keep the file name so the compiler artifacts are named as before
+    local prepared_dir="/tmp/${model_type}_prepared"
+    mkdir -p "$prepared_dir"
+    local prepared_file="$prepared_dir/$(basename "$model_file")"
+
+    print_status "Preparing $(basename "$model_file") for the NPU"
+    if ! python3 "$SCRIPT_DIR/prepare_model.py" "$model_file" "$prepared_file" --check; then
+        print_error "Model preparation failed (set \"prepare_model\": false in $CONFIG_FILE to skip)"
+        return 1
+    fi
+
+    PREPARED_MODEL_FILE="$prepared_file"
+}
+
 # Function to convert model using STM32EdgeAI
 convert_model() {
     local model_type="$1"
@@ -370,6 +407,38 @@ copy_to_project() {
     fi
 }
 
+# Function to collapse DequantizeLinear -> PRelu -> QuantizeLinear SW epochs
+# into the fused integer kernel and Concat -> DepthToSpace pairs into a single
+# DMA transfer in the generated network (see fuse_sw_epochs.py)
+fuse_sw_epochs() {
+    local model_type="$1"
+    local network_file="$PROJECT_ROOT/embedded/Models/${model_type}.c"
+
+    if [ ! -f "$network_file" ]; then
+        return 0
+    fi
+
+    print_status "Fusing SW epochs in $(basename "$network_file")"
+    python3 "$SCRIPT_DIR/fuse_sw_epochs.py" "$network_file"
+}
+
+# Function to check that the activations of both networks still share the
+# internal pools safely (see python_tools/activation_overlap_check.py)
+check_activation_memory() {
+    local checker="$PROJECT_ROOT/python_tools/activation_overlap_check.py"
+    local output_dir="$PROJECT_ROOT/converted_models"
+
+    for model in face_detection face_recognition; do
+        if [ ! -f "$output_dir/${model}_c_info.json" ]; then
+            print_warning "No c_info.json for $model, skipping the shared activation memory check"
+            return 0
+        fi
+    done
+
+    print_status "Checking shared activation memory of both networks"
+    python3 "$checker" --models-dir "$output_dir"
+}
+
 # Main execution
 main() {
     print_status "STM32EdgeAI Model Compilation Script"
@@ -400,13 +469,30 @@ main() {
     # Load configuration
     load_config
     
+    # Rewrite the graph for the NPU when configured
+    if ! prepare_model "$model_type" "$model_file"; then
+        exit 1
+    fi
+
     # Convert model
-    if convert_model "$model_type" "$model_file"; then
+    if convert_model "$model_type" "$PREPARED_MODEL_FILE"; then
         # Organize output files
         organize_output_files "$model_type"
         
         # Copy to project directories
         copy_to_project "$model_type"
+
+        # Run the remaining PRelu triples and upsampling expansions as single epochs
+        if ! fuse_sw_epochs "$model_type"; then
+            print_error "SW epoch fusion failed"
+            exit 1
+        fi
+
+        # Both networks are placed in the same internal pools
+        if ! check_activation_memory; then
+            print_error "Activation memory check failed"
+            exit 1
+        fi
         
         print_status "Model compilation completed successfully!"
         print_status "Next steps:"
@@ -0,0 +1,372 @@
+#!/usr/bin/env python3
+"""
+Post-generation epoch fusion for the ll_aton network C code
+
+The compiler emits every PRelu it cannot map to the NPU as three SW epochs
+with float tensors in between:
+    DequantizeLinear (int8 -> float) -> PRelu (float) -> QuantizeLinear
+This pass rewrites each such triple in the generated <network>.c so the first
+epoch calls the fused int8 kernel ll_sw_forward_prelu_integer() and the other
+two become empty. The epoch table is unchanged; the float intermediates are
+no longer written or cache-cleaned.
+
+A triple is fused only when the epochs are consecutive, the tensors chain
+(DQ output is the PRelu input, PRelu output is the Q input), both int8 ends
+are signed, channel-innermost and dense, and quantization is per-tensor.
+
+The detector's nearest-neighbour ConvTranspose expansions come out as a
+channel Concat epoch followed by a DepthToSpace epoch, each a separate DMA
+pass over the intermediate tensor. Such pairs are rewritten so the first
+epoch calls LL_ATON_LIB_DMA_Concat_DepthToSpace(), which streams every
+Concat input straight into its place in the DepthToSpace output, and the
+second becomes empty. A pair is fused when the epochs are consecutive, the
+Concat is on channels with blocksize_h * blocksize_w equally shaped
+canonical inputs, and the intermediate is read by no other SW epoch.
+
+Running the pass again on fused code is a no-op.
+
+Usage:
+    python3 fuse_sw_epochs.py embedded/Models/face_recognition.c [--check]
+"""
+
+import argparse
+import re
+import sys
+from collections import Counter
+
+EPOCH_RE = re.compile(
+    r"(static void LL_ATON_End_EpochBlock_(\d+)\(const void \*epoch_block\)\n\{\n)(.*?)(\n\}\n)",
+    re.DOTALL,
+)
+FIELD_RE = re.compile(r"^\s*\.([\w.]+) = (.*),$")
+STRUCT_RE = re.compile(r"^\s*(\w+_sw_info) (\w+) = \{$", re.MULTILINE)
+NODE_RE = re.compile(r"/\* kind=(\w+) node=(\w+) \*/")
+CALL_RE = re.compile(r"^\s*(ll_sw_forward_\w+)\(&\w+\);$", re.MULTILINE)
+CACHE_MARK = "  /* *** MCU cache clean"
+UNUSED_MARK = "  LL_ATON_LIB_UNUSED(epoch_block);"
+CONCAT_RE = re.compile(r"^  LL_ATON_LIB_Concat\((\w+), (\d+), (\w+), (\d+), (\d+), (\d+)\);$", re.MULTILINE)
+D2S_RE = re.compile(r"^  LL_ATON_LIB_DMA_DepthToSpace\((\w+), 1, (\w+), (\d+), (\d+), (\d+), (\d+)\);$", re.MULTILINE)
+OUT_DECL_RE = re.compile(r"^  static const \w+ \w+_tensor_info_out_\d+", re.MULTILINE)
+NAME_RE = re.compile(r'^\s*\.name = "(\w+)",$', re.MULTILINE)
+SHAPE_DECL_RE = re.compile(r"^\s*static const uint32_t (\w+)\[\] = \{ ([\d, ]+) \};$", re.MULTILINE)
+
+
+# =============================================================================
+# Generated code parsing
+# =============================================================================
+
+class SwEpoch:
+    """One generated LL_ATON_End_EpochBlock_N holding a single SW node"""
+
+    def __init__(self, match):
+        self.match = match
+        self.number = int(match.group(2))
+        self.body = match.group(3)
+        struct = STRUCT_RE.search(self.body)
+        call = CALL_RE.search(self.body)
+        node = NODE_RE.search(self.body)
+        self.struct_type = struct.group(1) if struct else None
+        self.struct_name = struct.group(2) if struct else None
+        self.function = call.group(1) if call else None
+        self.kind = node.group(1) if node else None
+        self.node = node.group(2) if node else None
+        # Field lines in emission order, e.g. ("general.input.dim.tensor_c", "64")
+        self.fields = []
+        for line in self.body.splitlines():
+            field = FIELD_RE.match(line)
+            if field:
+                self.fields.append((field.group(1), field.group(2)))
+        self.values = dict(self.fields)
+
+    def group(self, prefix):
+        """Field lines under a tensor prefix ("general.input", "is", ...)"""
+        return [(k, v) for k, v in self.fields if k.startswith(prefix + ".")]
+
+    def cache_clean(self):
+        index = self.body.find(CACHE_MARK)
+        return self.body[index:].rstrip("\n") if index >= 0 else ""
+
+    def cache_invalidate(self):
+        """Cache maintenance emitted ahead of the epoch's work"""
+        index = self.body.find(UNUSED_MARK)
+        return self.body[:index] if index > 0 else ""
+
+    def tensors(self, direction):
+        """Tensor names of the epoch's "in" or "out" LL_Buffer_InfoTypeDef array"""
+        decl = OUT_DECL_RE.search(self.body)
+        start, end = (0, decl.start()) if decl else (0, len(self.body))
+        if direction == "out":
+            start, end = (decl.start(), len(self.body)) if decl else (0, 0)
+        return NAME_RE.findall(self.body, start, end)
+
+
+def _address(value):
+    """Base + offset expression of a mem.start_offset initializer"""
+    found = re.search(r"\((0x[0-9a-fA-F]+UL \+ \d+)\)", value or "")
+    return found.group(1) if found else None
+
+
+def _dense_int8(epoch, prefix):
+    v = epoch.values
+    return (v.get(prefix + ".format.is_signed") == "1"
+            and v.get(prefix + ".stride.c") == "1"
+            and v.get(prefix + ".stride.w") == v.get(prefix + ".dim.tensor_c"))
+
+
+def fusable(dq, prelu, q):
+    """Reason the triple cannot be fused, or None"""
+    if dq.function != "ll_sw_forward_dequantizelinear":
+        return "not a DequantizeLinear"
+    if prelu.function != "ll_sw_forward_activ" or prelu.values.get("general.type") != "LL_SW_PRELU":
+        return "not a float PRelu"
+    if q.function != "ll_sw_forward_quantizelinear":
+        return "not a QuantizeLinear"
+    if prelu.number != dq.number + 1 or q.number != dq.number + 2:
+        return "epochs are not consecutive"
+    if _address(dq.values.get("general.output.mem.start_offset")) != \
+            _address(prelu.values.get("general.input.mem.start_offset")):
+        return "DQ output does not feed the PRelu"
+    if _address(prelu.values.get("general.output.mem.start_offset")) != \
+            _address(q.values.get("general.input.mem.start_offset")):
+        return "PRelu output does not feed the Q"
+    if not _dense_int8(dq, "general.input") or not _dense_int8(q, "general.output"):
+        return "int8 ends are not signed dense HWC"
+    if dq.values.get("is.dim.num_elem") != "1" or q.values.get("os.dim.num_elem") != "1":
+        return "per-axis quantization"
+    return None
+
+
+def _buffers(text):
+    """(start, end, nbits) of every LL_Buffer_InfoTypeDef entry in text"""
+    buffers = []
+    for entry in text.split('.name = "')[1:]:
+        base = re.search(r"\.addr_base = \{\(unsigned char \*\)\((0x[0-9a-fA-F]+)UL\)", entry)
+        start = re.search(r"\.offset_start = (\d+),", entry)
+        end = re.search(r"\.offset_end = (\d+),", entry)
+        nbits = re.search(r"\.nbits = (\d+),", entry)
+        if not (base and start and end and nbits):
+            return None
+        address = int(base.group(1), 16)
+        buffers.append((address + int(start.group(1)), address + int(end.group(1)), int(nbits.group(1))))
+    return buffers
+
+
+def _overwrites_unread(inputs, output, dims, bh, bw):
+    """True when the fused transfer would overwrite input bytes before reading them
+
+    The inputs are streamed one after the other, pixel by pixel, in the order of
+    LL_ATON_LIB_DMA_Concat_DepthToSpace(); each pixel is read before it is written.
+    """
+    batches, height, width, channels = dims
+    pixel = channels * ((inputs[0][2] + 7) // 8)
+    out_height, out_width = height * bh, width * bw
+    pending = Counter()
+    for start, end, _ in inputs:
+        pending.update(range(start, end))
+    for k, (start, end, _) in enumerate(inputs):
+        row, col = divmod(k, bw)
+        for p in range((end - start) // pixel):
+            pending.subtract(range(start + p * pixel, start + (p + 1) * pixel))
+            b, rest = divmod(p, height * width)
+            y, x = divmod(rest, width)
+            dst = output + ((b * out_height + y * bh + row) * out_width + x * bw + col) * pixel
+            if any(pending[a] > 0 for a in range(dst, dst + pixel)):
+                return True
+    return False
+
+
+def concat_d2s_fusable(concat, d2s, epochs):
+    """Reason the Concat -> DepthToSpace pair cannot be fused, or None"""
+    cat = CONCAT_RE.search(concat.body)
+    dts = D2S_RE.search(d2s.body)
+    if concat.kind != "Concat" or cat is None:
+        return "not a DMA Concat"
+    if d2s.kind != "DepthToSpace" or dts is None:
+        return "not a DMA DepthToSpace"
+    if d2s.number != concat.number + 1:
+        return "epochs are not consecutive"
+    ninputs, axis = int(cat.group(2)), int(cat.group(4))
+    if axis != 1:
+        return "Concat is not on channels"
+    if ninputs != int(dts.group(3)) * int(dts.group(4)):
+        return "input count does not match the blocksize"
+    middle = concat.tensors("out")
+    if len(middle) != 1 or d2s.tensors("in") != middle:
+        return "Concat output does not feed the DepthToSpace"
+    readers = [e.number for e in epochs if middle[0] in e.tensors("in")]
+    if readers != [d2s.number]:
+        return "intermediate has other readers"
+    inputs = concat.body[:OUT_DECL_RE.search(concat.body).start()]
+    shapes = set(re.findall(r"^\s*\.shape = (\w+),$", inputs, re.MULTILINE))
+    batches = set(re.findall(r"^\s*\.batch = (\d+),$", inputs, re.MULTILINE))
+    dims = dict(SHAPE_DECL_RE.findall(inputs))
+    if len(shapes) != 1 or len(batches) != 1 or not shapes <= dims.keys():
+        return "inputs are not equally shaped"
+    shape = [int(d) for d in dims[shapes.pop()].split(", ")]
+    if len(shape) != 4 or shape[-1] != int(batches.pop()):
+        return "inputs are not in canonical format"
+    # The compiler may place an input inside the DepthToSpace output once the
+    # intermediate exists; without it, reads must still precede overwrites
+    sources = _buffers(inputs)
+    output = _buffers(d2s.body[OUT_DECL_RE.search(d2s.body).start():])
+    if not sources or not output or len(output) != 1:
+        return "tensor placement not found"
+    if _overwrites_unread(sources, output[0][0], shape, int(dts.group(3)), int(dts.group(4))):
+        return "output overwrites inputs before they are read"
+    return None
+
+
+# =============================================================================
+# Code generation
+# =============================================================================
+
+def _field_lines(fields, rename=None):
+    lines = []
+    for key, value in fields:
+        if rename:
+            key = rename + key[key.index("."):]
+        lines.append(f"    .{key} = {value},")
+    return lines
+
+
+def fused_body(dq, prelu, q, index):
+    name = f"prelu_integer{index}_sw_info"
+    chain = f"{dq.node} -> {prelu.node} -> {q.node}"
+    lines = [
+        "  LL_ATON_LIB_UNUSED(epoch_block);",
+        "",
+        "",
+        "/* Unit= 27 [PROCESSOR 0] */",
+        f"/* kind=PRelu node={prelu.node} (fused: {chain}) */",
+        f"  Prelu_integer_sw_info {name} = {{",
+        '    /* "general.input" tensor-related info: */',
+    ]
+    lines += _field_lines(dq.group("general.input"))
+    lines.append('    /* "is" tensor-related info: */')
+    lines += _field_lines(dq.group("is"))
+    lines.append('    /* "izp" tensor-related info: */')
+    lines += _field_lines(dq.group("izp"))
+    lines.append('    /* "slope" tensor-related info: */')
+    lines += _field_lines(prelu.group("operand"), rename="slope")
+    lines.append('    /* "os" tensor-related info: */')
+    lines += _field_lines(q.group("os"))
+    lines.append('    /* "ozp" tensor-related info: */')
+    lines += _field_lines(q.group("ozp"))
+    lines.append('    /* "general.output" tensor-related info: */')
+    lines += _field_lines(q.group("general.output"))
+    lines += [
+        "    .general.type = LL_SW_PRELU,",
+        "  };",
+        "",
+        "  /* Low Level SW Layer function invocation (fused DequantizeLinear/PRelu/QuantizeLinear) */",
+        f"  /* Node {prelu.node} mapped on EmbedNets (INTEGER) as PRelu | Category: Computational */",
+        f"  ll_sw_forward_prelu_integer(&{name});",
+    ]
+    clean = q.cache_clean()
+    if clean:
+        lines.append(clean)
+    return "\n".join(lines) + "\n"
+
+
+def concat_d2s_body(concat, d2s):
+    """Concat epoch rewritten to write the DepthToSpace output directly"""
+    cat = CONCAT_RE.search(concat.body)
+    dts = D2S_RE.search(d2s.body)
+    node_line = f"/* kind=Concat node={concat.node} */"
+    inputs_start = concat.body.index(node_line) + len(node_line) + 1
+    inputs = concat.body[inputs_start:OUT_DECL_RE.search(concat.body).start()]
+    output = d2s.body[OUT_DECL_RE.search(d2s.body).start():dts.start()]
+    header = concat.body[concat.body.index(UNUSED_MARK):inputs_start - len(node_line) - 1]
+    call = (f"  LL_ATON_LIB_DMA_Concat_DepthToSpace({cat.group(1)}, {cat.group(2)}, {dts.group(2)}, "
+            f"{dts.group(3)}, {dts.group(4)}, {cat.group(5)}, {cat.group(6)});")
+    body = (d2s.cache_invalidate() + header
+            + f"/* kind=Concat node={concat.node} (fused: {concat.node} -> {d2s.node}) */\n"
+            + inputs + output + call + "\n")
+    clean = d2s.cache_clean()
+    if clean:
+        body += "\n" + clean + "\n"
+    return body
+
+
+def empty_body(node, into, function="ll_sw_forward_prelu_integer"):
+    return ("  LL_ATON_LIB_UNUSED(epoch_block);\n\n"
+            f"  /* {node} fused into epoch {into} ({function}) */\n")
+
+
+def fuse_source(source):
+    """Return (new_source, fused_triples, fused_pairs, skipped) for a generated network"""
+    epochs = [SwEpoch(m) for m in EPOCH_RE.finditer(source)]
+    replacements = {}
+    fused = []
+    skipped = []
+    i = 0
+    while i + 2 < len(epochs):
+        dq, prelu, q = epochs[i:i + 3]
+        if prelu.kind == "PRelu":
+            reason = fusable(dq, prelu, q)
+            if reason is None:
+                replacements[dq.number] = fused_body(dq, prelu, q, len(fused))
+                replacements[prelu.number] = empty_body(prelu.node, dq.number)
+                replacements[q.number] = empty_body(q.node, dq.number)
+                fused.append((dq.number, prelu.node))
+                i += 3
+                continue
+            skipped.append((prelu.node, reason))
+        i += 1
+
+    pairs = []
+    for concat, d2s in zip(epochs, epochs[1:]):
+        if concat.kind != "Concat" or concat.number in replacements:
+            continue
+        reason = concat_d2s_fusable(concat, d2s, epochs)
+        if reason is None:
+            replacements[concat.number] = concat_d2s_body(concat, d2s)
+            replacements[d2s.number] = empty_body(d2s.node, concat.number, "LL_ATON_LIB_DMA_Concat_DepthToSpace")
+            pairs.append((concat.number, d2s.node))
+        elif d2s.kind == "DepthToSpace":
+            skipped.append((d2s.node, reason))
+
+    def replace(match):
+        body = replacements.get(int(match.group(2)))
+        if body is None:
+            return match.group(0)
+        return match.group(1) + body + match.group(4)
+
+    return EPOCH_RE.sub(replace, source), fused, pairs, skipped
+
+
+# =============================================================================
+# Command line
+# =============================================================================
+
+def main():
+    parser = argparse.ArgumentParser(description="Fuse DQ -> PRelu -> Q and Concat -> DepthToSpace SW epochs "
+                                                 "in generated ll_aton code")
+    parser.add_argument("network", help="generated network C file (e.g. embedded/Models/face_recognition.c)")
+    parser.add_argument("--check", action="store_true",
+                        help="only report; exit 1 if unfused triples or pairs remain")
+    args = parser.parse_args()
+
+    with open(args.network) as f:
+        source = f.read()
+    result, fused, pairs, skipped = fuse_source(source)
+
+    for epoch, node in fused:
+        print(f"  epoch {epoch}: {node} -> ll_sw_forward_prelu_integer")
+    for epoch, node in pairs:
+        print(f"  epoch {epoch}: {node} -> LL_ATON_LIB_DMA_Concat_DepthToSpace")
+    for node, reason in skipped:
+        print(f"  {node}: left unfused ({reason})")
+    print(f"Fused {len(fused)} PRelu triple(s), {len(pairs)} Concat/DepthToSpace pair(s), "
+          f"{len(fused) * 2 + len(pairs)} SW epoch(s) emptied")
+
+    if args.check:
+        return 1 if fused or pairs else 0
+    if result != source:
+        with open(args.network, "w") as f:
+            f.write(result)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
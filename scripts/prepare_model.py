@@ -0,0 +1,374 @@
+#!/usr/bin/env python3
+"""
+ONNX model preparation for the STM32N6 Neural-ART compiler
+
+Runs before compile_model.sh and rewrites graph patterns the NPU cannot map
+into equivalent ones it executes natively.
+
+PReLU pass:
+    The compiler maps PRelu to a float SW kernel, so every
+    DequantizeLinear -> PRelu -> QuantizeLinear chain becomes three SW epochs.
+    Each PRelu is rewritten as
+        y = Relu(x) + alpha * Min(x, 0),  Min(x, 0) = x - Relu(x)
+    with per-channel alpha as a Mul constant. A uniform alpha becomes a
+    single LeakyRelu.
+    In quantized graphs every new tensor gets a Q/DQ pair so the compiler
+    fuses Relu/Sub/Mul/Add into integer HW epochs. Relu(x) and Min(x, 0)
+    reuse the input quantization and are exact; alpha * Min(x, 0) uses the
+    output quantization, so the only new error is the int8 rounding of alpha.
+
+The rewritten model is checked against the original with onnxruntime.
+
+Usage:
+    python3 prepare_model.py input.onnx output.onnx [--check]
+"""
+
+import argparse
+import sys
+
+import numpy as np
+import onnx
+from onnx import helper, numpy_helper
+
+# Output code difference accepted by --check for quantized PRelus
+DEFAULT_MAX_LSB = 1
+CHECK_SAMPLES = 16
+CHECK_SEED = 1234
+
+
+# =============================================================================
+# Graph helpers
+# =============================================================================
+
+class Graph:
+    """Producer/consumer index and initializer access over a GraphProto"""
+
+    def __init__(self, model: onnx.ModelProto):
+        self.model = model
+        self.graph = model.graph
+        self.initializers = {i.name: i for i in self.graph.initializer}
+        self.constants = {}
+        for node in self.graph.node:
+            if node.op_type == 'Constant':
+                self.constants[node.output[0]] = numpy_helper.to_array(node.attribute[0].t)
+        self.producers = {o: n for n in self.graph.node for o in n.output}
+        self.consumers = {}
+        for node in self.graph.node:
+            for name in node.input:
+                self.consumers.setdefault(name, []).append(node)
+        self.outputs = {o.name for o in self.graph.output}
+        self.counter = 0
+
+    def value(self, name: str):
+        """Constant value of a tensor, None if it is computed"""
+        if name in self.initializers:
+            return numpy_helper.to_array(self.initializers[name])
+        return self.constants.get(name)
+
+    def single_consumer(self, name: str, op_type: str):
+        consumers = self.consumers.get(name, [])
+        if len(consumers) != 1 or consumers[0].op_type != op_type or name in self.outputs:
+            return None
+        return consumers[0]
+
+    def unique(self, base: str) -> str:
+        self.counter += 1
+        return f'{base}_npu{self.counter}'
+
+    def add_initializer(self, base: str, array: np.ndarray) -> str:
+        name = self.unique(base)
+        self.graph.initializer.append(numpy_helper.from_array(array, name))
+        return name
+
+
+def quant_params(lo: float, hi: float, zp_dtype) -> tuple:
+    """Asymmetric scale/zero point covering [lo, hi] (0 always included)"""
+    lo, hi = min(lo, 0.0), max(hi, 0.0)
+    info = np.iinfo(zp_dtype)
+    scale = (hi - lo) / float(info.max - info.min)
+    if scale <= 0.0:
+        scale = 1.0
+    zero_point = int(np.clip(np.round(info.min - lo / scale), info.min, info.max))
+    return np.float32(scale), zp_dtype(zero_point)
+
+
+def quantize_constant(values: np.ndarray) -> tuple:
+    """Symmetric int8 quantization of a Mul constant, returns (q, scale, dequantized)"""
+    scale = np.float32(max(float(np.max(np.abs(values))), 1e-12) / 127.0)
+    q = np.clip(np.round(values / scale), -127, 127).astype(np.int8)
+    return q, scale, q.astype(np.float32) * scale
+
+
+# =============================================================================
+# PReLU rewrite
+# =============================================================================
+
+def _qdq(g: Graph, nodes: list, tensor: str, scale, zero_point) -> str:
+    """Append Q/DQ on a float tensor and return the dequantized name"""
+    scale_name = g.add_initializer(f'{tensor}_scale', np.array(scale, dtype=np.float32))
+    zp_name = g.add_initializer(f'{tensor}_zero_point', np.array(zero_point))
+    q_name, dq_name = g.unique(f'{tensor}_quantized'), g.unique(f'{tensor}_dq')
+    nodes.append(helper.make_node('QuantizeLinear', [tensor, scale_name, zp_name], [q_name],
+                                  name=g.unique('QuantizeLinear')))
+    nodes.append(helper.make_node('DequantizeLinear', [q_name, scale_name, zp_name], [dq_name],
+                                  name=g.unique('DequantizeLinear')))
+    return dq_name
+
+
+def _const_input(g: Graph, nodes: list, base: str, values: np.ndarray, quantized: bool) -> tuple:
+    """Mul constant, through an int8 DequantizeLinear in quantized graphs"""
+    if not quantized:
+        return g.add_initializer(base, values.astype(np.float32)), values.astype(np.float32)
+    q, scale, dequantized = quantize_constant(values)
+    q_name = g.add_initializer(f'{base}_quantized', q)
+    scale_name = g.add_initializer(f'{base}_scale', np.array(scale, dtype=np.float32))
+    zp_name = g.add_initializer(f'{base}_zero_point', np.array(0, dtype=np.int8))
+    out = g.unique(base)
+    nodes.append(helper.make_node('DequantizeLinear', [q_name, scale_name, zp_name], [out],
+                                  name=g.unique('DequantizeLinear')))
+    return out, dequantized
+
+
+def rewrite_prelu(g: Graph, node) -> list:
+    """Replacement nodes for one PRelu, None to keep it"""
+    alpha = g.value(node.input[1])
+    if alpha is None:
+        return None
+    x, y = node.input[0], node.output[0]
+    alpha = alpha.astype(np.float32)
+
+    if np.all(alpha == alpha.flat[0]):
+        return [helper.make_node('LeakyRelu', [x], [y], name=g.unique(node.name or 'LeakyRelu'),
+                                 alpha=float(alpha.flat[0]))]
+
+    # Quantized when fed by DequantizeLinear and feeding a single QuantizeLinear
+    dq = g.producers.get(x)
+    quantized = (dq is not None and dq.op_type == 'DequantizeLinear' and
+                 g.single_consumer(y, 'QuantizeLinear') is not None)
+    nodes = []
+    if quantized:
+        x_scale = g.value(dq.input[1])
+        x_zp = g.value(dq.input[2]) if len(dq.input) > 2 else np.uint8(0)
+        if x_scale is None or x_zp is None or np.ndim(x_scale) != 0 or np.ndim(x_zp) != 0:
+            return None
+        x_scale = float(x_scale)
+        x_lo = x_scale * (np.iinfo(x_zp.dtype).min - int(x_zp))
+
+    alpha_name, alpha_dq = _const_input(g, nodes, f'{node.name}_alpha', alpha, quantized)
+
+    relu = g.unique(f'{node.name}_relu')
+    negative = g.unique(f'{node.name}_min0')
+    scaled = g.unique(f'{node.name}_alpha_min0')
+    nodes.append(helper.make_node('Relu', [x], [relu], name=g.unique('Relu')))
+    if quantized:
+        relu = _qdq(g, nodes, relu, x_scale, x_zp)
+    nodes.append(helper.make_node('Sub', [x, relu], [negative], name=g.unique('Sub')))
+    if quantized:
+        # Relu(x) and Min(x, 0) stay on the input grid, so both are exact
+        negative = _qdq(g, nodes, negative, x_scale, x_zp)
+    nodes.append(helper.make_node('Mul', [negative, alpha_name], [scaled], name=g.unique('Mul')))
+    if quantized:
+        # y is alpha * Min(x, 0) wherever that term is non-zero, so the output
+        # quantization rounds it exactly like the original PRelu did
+        q = g.single_consumer(y, 'QuantizeLinear')
+        y_scale = g.value(q.input[1])
+        y_zp = g.value(q.input[2]) if len(q.input) > 2 else None
+        if y_scale is not None and y_zp is not None and np.ndim(y_scale) == 0 and np.ndim(y_zp) == 0:
+            scaled = _qdq(g, nodes, scaled, np.float32(y_scale), y_zp)
+        else:
+            ends = (alpha_dq * min(x_lo, 0.0)).ravel()
+            scaled = _qdq(g, nodes, scaled, *quant_params(float(ends.min()), float(ends.max()),
+                                                          x_zp.dtype.type))
+    nodes.append(helper.make_node('Add', [relu, scaled], [y], name=g.unique(node.name or 'Add')))
+    return nodes
+
+
+def prelu_pass(model: onnx.ModelProto) -> tuple:
+    """Rewrite every PRelu in place
+
+    Returns counts per replacement and (PRelu node, replacement nodes) pairs
+    for the equivalence check.
+    """
+    g = Graph(model)
+    stats = {'prelu': 0, 'leaky_relu': 0, 'relu_sub_mul_add': 0, 'kept': 0}
+    rewrites = []
+    rewritten = []
+    for node in g.graph.node:
+        if node.op_type != 'PRelu':
+            rewritten.append(node)
+            continue
+        stats['prelu'] += 1
+        replacement = rewrite_prelu(g, node)
+        if replacement is None:
+            stats['kept'] += 1
+            rewritten.append(node)
+            continue
+        stats['leaky_relu' if replacement[-1].op_type == 'LeakyRelu' else 'relu_sub_mul_add'] += 1
+        rewrites.append((node, replacement))
+        rewritten.extend(replacement)
+
+    del g.graph.node[:]
+    g.graph.node.extend(rewritten)
+
+    # Drop the slopes of rewritten PRelus
+    used = {name for node in g.graph.node for name in node.input}
+    unused = [i for i in g.graph.initializer if i.name not in used]
+    for initializer in unused:
+        g.graph.initializer.remove(initializer)
+    return stats, rewrites
+
+
+# =============================================================================
+# Equivalence check
+# =============================================================================
+
+def _input_feed(session, model: onnx.ModelProto, rng) -> dict:
+    """Random inputs spanning the quantized input range when there is one"""
+    g = Graph(model)
+    feed = {}
+    for inp in session.get_inputs():
+        shape = [d if isinstance(d, int) and d > 0 else 1 for d in inp.shape]
+        lo, hi = -1.0, 1.0
+        q = g.single_consumer(inp.name, 'QuantizeLinear')
+        if q is not None and g.value(q.input[1]) is not None:
+            scale = float(g.value(q.input[1]))
+            zp = g.value(q.input[2]) if len(q.input) > 2 else np.uint8(0)
+            info = np.iinfo(zp.dtype)
+            lo, hi = scale * (info.min - int(zp)), scale * (info.max - int(zp))
+        feed[inp.name] = rng.uniform(lo, hi, size=shape).astype(np.float32)
+    return feed
+
+
+def _session(ort, model: onnx.ModelProto):
+    options = ort.SessionOptions()
+    options.graph_optimization_level = ort.GraphOptimizationLevel.ORT_DISABLE_ALL
+    options.log_severity_level = 3
+    return ort.InferenceSession(model.SerializeToString(), options, providers=['CPUExecutionProvider'])
+
+
+def _block_model(model: onnx.ModelProto, nodes: list, x: str, out: str) -> onnx.ModelProto:
+    """Stand-alone model of `nodes` fed by float tensor x"""
+    producers = [n for n in model.graph.node if n.op_type == 'Constant']
+    names = {name for n in nodes for name in n.input}
+    constants = [n for n in producers if n.output[0] in names]
+    initializers = [i for i in model.graph.initializer if i.name in names]
+    graph = helper.make_graph(constants + list(nodes), 'block',
+                              [helper.make_tensor_value_info(x, onnx.TensorProto.FLOAT, None)],
+                              [helper.make_empty_tensor_value_info(out)], initializers)
+    block = helper.make_model(graph, opset_imports=model.opset_import)
+    block.ir_version = model.ir_version
+    return block
+
+
+def check_equivalence(original: onnx.ModelProto, prepared: onnx.ModelProto, rewrites: list,
+                      samples: int, max_lsb: int) -> bool:
+    """Compare every rewritten PRelu against the original on the same inputs
+
+    Activations of the original model on random inputs feed both the PRelu
+    and its replacement, including the following QuantizeLinear when there
+    is one. Quantized outputs may differ by at most max_lsb codes; float
+    outputs must match to float precision. The end-to-end output cosine is
+    printed for information only: on random inputs the int8 network amplifies
+    one-code differences, so it is not a usable gate.
+    """
+    try:
+        import onnxruntime as ort
+    except ImportError:
+        print('onnxruntime is required for --check (pip install onnxruntime)')
+        return False
+
+    g = Graph(original)
+    captured = onnx.ModelProto()
+    captured.CopyFrom(original)
+    graph_tensors = {i.name for i in original.graph.input} | {o.name for o in original.graph.output}
+    probes = []
+    for node, _ in rewrites:
+        if node.input[0] not in graph_tensors and node.input[0] not in probes:
+            probes.append(node.input[0])
+            captured.graph.output.append(helper.make_empty_tensor_value_info(node.input[0]))
+    ref = _session(ort, captured)
+    new = _session(ort, prepared)
+    n_outputs = len(original.graph.output)
+    output_names = [o.name for o in original.graph.output]
+
+    blocks = []
+    for node, replacement in rewrites:
+        q = g.single_consumer(node.output[0], 'QuantizeLinear')
+        tail = [q] if q is not None else []
+        out = q.output[0] if q is not None else node.output[0]
+        blocks.append((node.name, node.input[0], q is not None,
+                       _session(ort, _block_model(original, [node] + tail, node.input[0], out)),
+                       _session(ort, _block_model(prepared, replacement + tail, node.input[0], out))))
+
+    rng = np.random.default_rng(CHECK_SEED)
+    worst = {}
+    worst_cosine = 1.0
+    for _ in range(samples):
+        feed = _input_feed(ref, original, rng)
+        results = ref.run(None, feed)
+        for a, b in zip(results[:n_outputs], new.run(None, feed)):
+            a, b = a.astype(np.float64).ravel(), b.astype(np.float64).ravel()
+            denom = np.linalg.norm(a) * np.linalg.norm(b)
+            worst_cosine = min(worst_cosine, float(np.dot(a, b) / denom) if denom > 0 else 1.0)
+
+        tensors = dict(feed)
+        tensors.update(zip(output_names + probes, results))
+        for name, x_name, quantized, ref_block, new_block in blocks:
+            x = tensors[x_name]
+            a = ref_block.run(None, {ref_block.get_inputs()[0].name: x})[0]
+            b = new_block.run(None, {new_block.get_inputs()[0].name: x})[0]
+            if quantized:
+                diff = float(np.max(np.abs(a.astype(np.int32) - b.astype(np.int32))))
+            else:
+                diff = float(np.max(np.abs(a - b)) / max(float(np.max(np.abs(a))), 1e-12))
+            worst[name] = (quantized, max(worst.get(name, (quantized, 0.0))[1], diff))
+
+    ok = True
+    for name, (quantized, diff) in worst.items():
+        passed = diff <= max_lsb if quantized else diff <= 1e-5
+        ok &= passed
+        if not passed:
+            unit = 'LSB' if quantized else 'relative'
+            print(f'  {name}: max diff {diff:g} {unit}')
+
+    quantized_diffs = [d for q, d in worst.values() if q]
+    print(f'equivalence: {samples} samples, {len(worst)} rewritten PRelus, worst quantized diff '
+          f'{max(quantized_diffs) if quantized_diffs else 0:g} LSB (max {max_lsb}), '
+          f'end-to-end cosine {worst_cosine:.6f}')
+    return ok
+
+
+# =============================================================================
+# Main
+# =============================================================================
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description='Rewrite ONNX patterns the STM32N6 NPU runs in software')
+    parser.add_argument('input', help='source ONNX model')
+    parser.add_argument('output', help='prepared ONNX model')
+    parser.add_argument('--check', action='store_true', help='compare both models with onnxruntime')
+    parser.add_argument('--samples', type=int, default=CHECK_SAMPLES, help='random inputs for --check')
+    parser.add_argument('--max-lsb', type=int, default=DEFAULT_MAX_LSB,
+                        help='accepted output code difference per rewritten PRelu')
+    args = parser.parse_args(argv)
+
+    original = onnx.load(args.input)
+    prepared = onnx.ModelProto()
+    prepared.CopyFrom(original)
+
+    stats, rewrites = prelu_pass(prepared)
+    print(f"PRelu: {stats['prelu']} found, {stats['relu_sub_mul_add']} -> Relu/Sub/Mul/Add, "
+          f"{stats['leaky_relu']} -> LeakyRelu, {stats['kept']} kept")
+
+    onnx.checker.check_model(prepared)
+    onnx.save(prepared, args.output)
+    print(f'prepared model written to {args.output}')
+
+    if args.check and not check_equivalence(original, prepared, rewrites, args.samples, args.max_lsb):
+        print('equivalence check FAILED')
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())